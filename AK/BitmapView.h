@@ -9,9 +9,15 @@
 #include <AK/Array.h>
 #include <AK/BuiltinWrappers.h>
 #include <AK/Optional.h>
+#include <AK/Platform.h>
 #include <AK/StdLibExtras.h>
 #include <AK/Types.h>
 
+#if !defined(KERNEL) && (defined(__SSE2__) || defined(__ARM_NEON) || defined(__ARM_NEON__))
+#    define AK_BITMAP_VIEW_USE_SIMD 1
+#    include <AK/SIMD.h>
+#endif
+
 namespace AK {
 
 static constexpr Array bitmask_first_byte = { 0xFF, 0xFE, 0xFC, 0xF8, 0xF0, 0xE0, 0xC0, 0x80 };
@@ -63,22 +69,8 @@ public:
                 byte &= bitmask_last_byte[(start + len) % 8];
                 count += popcount(byte);
             }
-            if (++first < last) {
-                size_t const* ptr_large = (size_t const*)(((FlatPtr)first + sizeof(size_t) - 1) & ~(sizeof(size_t) - 1));
-                if ((u8 const*)ptr_large > last)
-                    ptr_large = (size_t const*)last;
-                while (first < (u8 const*)ptr_large) {
-                    count += popcount(*first);
-                    first++;
-                }
-                size_t const* last_large = (size_t const*)((FlatPtr)last & ~(sizeof(size_t) - 1));
-                while (ptr_large < last_large) {
-                    count += popcount(*ptr_large);
-                    ptr_large++;
-                }
-                for (first = (u8 const*)ptr_large; first < last; first++)
-                    count += popcount(*first);
-            }
+            if (++first < last)
+                count += count_ones_in_bytes(first, last);
         }
 
         if (!value)
@@ -172,11 +164,9 @@ public:
     Optional<size_t> find_first() const
     {
         size_t byte_count = m_size / 8;
-        size_t i = 0;
 
         u8 byte = VALUE ? 0x00 : 0xff;
-        while (i < byte_count && m_data[i] == byte)
-            i++;
+        size_t i = length_of_byte_run(m_data, byte_count, byte);
         if (i == byte_count)
             return {};
 
@@ -224,6 +214,10 @@ public:
                 }
                 free_chunks = 0;
                 start_bucket_bit = 0;
+                // Fast-forward over the whole run of fully set buckets instead
+                // of testing them one at a time.
+                size_t run_bytes = length_of_byte_run((u8 const*)&bitmap[bucket_index], (m_size / bit_size - bucket_index) * sizeof(size_t), 0xff);
+                bucket_index += run_bytes / sizeof(size_t) - 1;
                 continue;
             }
             if (bitmap[bucket_index] == 0x0) {
@@ -362,6 +356,75 @@ public:
 
     static constexpr size_t max_size = 0xffffffff;
 
+private:
+    // Counts the set bits in the bytes of [first, last), 16 bytes at a time
+    // where the target supports it and a machine word at a time otherwise.
+    ALWAYS_INLINE static size_t count_ones_in_bytes(u8 const* first, u8 const* last)
+    {
+        size_t count = 0;
+#ifdef AK_BITMAP_VIEW_USE_SIMD
+        while (last - first >= 16) {
+            SIMD::u8x16 bytes;
+            __builtin_memcpy(&bytes, first, 16);
+            // Per-byte SWAR popcount, carried out on all 16 lanes at once.
+            bytes = bytes - ((bytes >> 1) & 0x55);
+            bytes = (bytes & 0x33) + ((bytes >> 2) & 0x33);
+            bytes = (bytes + (bytes >> 4)) & 0x0f;
+            auto words = (SIMD::u64x2)bytes;
+            count += ((words[0] * 0x0101010101010101ull) >> 56) + ((words[1] * 0x0101010101010101ull) >> 56);
+            first += 16;
+        }
+        while (first < last)
+            count += popcount(*first++);
+#else
+        size_t const* ptr_large = (size_t const*)(((FlatPtr)first + sizeof(size_t) - 1) & ~(sizeof(size_t) - 1));
+        if ((u8 const*)ptr_large > last)
+            ptr_large = (size_t const*)last;
+        while (first < (u8 const*)ptr_large) {
+            count += popcount(*first);
+            first++;
+        }
+        size_t const* last_large = (size_t const*)((FlatPtr)last & ~(sizeof(size_t) - 1));
+        while (ptr_large < last_large) {
+            count += popcount(*ptr_large);
+            ptr_large++;
+        }
+        for (first = (u8 const*)ptr_large; first < last; first++)
+            count += popcount(*first);
+#endif
+        return count;
+    }
+
+    // Returns the number of leading bytes of data[0..byte_count) that are all
+    // equal to byte, i.e. the offset of the first mismatching byte.
+    ALWAYS_INLINE static size_t length_of_byte_run(u8 const* data, size_t byte_count, u8 byte)
+    {
+        size_t i = 0;
+#ifdef AK_BITMAP_VIEW_USE_SIMD
+        SIMD::u8x16 const needle = byte + SIMD::u8x16 {};
+        while (i + 16 <= byte_count) {
+            SIMD::u8x16 bytes;
+            __builtin_memcpy(&bytes, data + i, 16);
+            auto mismatch = (SIMD::u64x2)(bytes ^ needle);
+            if (mismatch[0] != 0 || mismatch[1] != 0)
+                break;
+            i += 16;
+        }
+#else
+        size_t const word_of_needles = (size_t)byte * (NumericLimits<size_t>::max() / 0xff);
+        while (i + sizeof(size_t) <= byte_count) {
+            size_t word;
+            __builtin_memcpy(&word, data + i, sizeof(word));
+            if (word != word_of_needles)
+                break;
+            i += sizeof(size_t);
+        }
+#endif
+        while (i < byte_count && data[i] == byte)
+            i++;
+        return i;
+    }
+
 protected:
     u8* m_data { nullptr };
     size_t m_size { 0 };
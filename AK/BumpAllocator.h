@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/Atomic.h>
+#include <AK/ByteBuffer.h>
 #include <AK/StdLibExtras.h>
 #include <AK/Types.h>
 #include <AK/kmalloc.h>
@@ -195,9 +196,51 @@ public:
 template<bool use_mmap, size_t size>
 inline Atomic<FlatPtr> BumpAllocator<use_mmap, size>::s_unused_allocation_cache { 0 };
 
+// Allocation policy that lets a ByteBuffer draw its outline storage from a
+// shared BumpAllocator arena, so all buffers of e.g. one request are freed by
+// a single deallocate_all(). Individual deallocations are no-ops; buffers too
+// big for an arena chunk fall back to the heap.
+template<bool use_mmap = false, size_t chunk_size = use_mmap ? 4 * MiB : 4 * KiB>
+class ArenaAllocatorForByteBuffer {
+public:
+    // A default-constructed policy has no arena and behaves like the plain
+    // heap policy; this keeps moved-from buffers in a sane state.
+    ArenaAllocatorForByteBuffer() = default;
+
+    explicit ArenaAllocatorForByteBuffer(BumpAllocator<use_mmap, chunk_size>& arena)
+        : m_arena(&arena)
+    {
+    }
+
+    void* allocate(size_t size)
+    {
+        if (!m_arena || size > maximum_arena_allocation)
+            return kmalloc(size);
+        return m_arena->allocate(size, 16);
+    }
+
+    void deallocate(void* pointer, size_t size)
+    {
+        if (!m_arena || size > maximum_arena_allocation)
+            kfree_sized(pointer, size);
+        // Arena memory is only reclaimed by BumpAllocator::deallocate_all().
+    }
+
+    static size_t good_size(size_t size) { return size; }
+
+private:
+    static constexpr size_t maximum_arena_allocation = chunk_size / 2;
+
+    BumpAllocator<use_mmap, chunk_size>* m_arena { nullptr };
+};
+
+template<bool use_mmap = false, size_t chunk_size = use_mmap ? 4 * MiB : 4 * KiB>
+using ArenaByteBuffer = Detail::ByteBuffer<32, ArenaAllocatorForByteBuffer<use_mmap, chunk_size>>;
+
 }
 
 #if USING_AK_GLOBALLY
+using AK::ArenaByteBuffer;
 using AK::BumpAllocator;
 using AK::UniformBumpAllocator;
 #endif
@@ -9,6 +9,7 @@
 
 #include <AK/Assertions.h>
 #include <AK/Error.h>
+#include <AK/Forward.h>
 #include <AK/Span.h>
 #include <AK/Types.h>
 #include <AK/kmalloc.h>
@@ -16,17 +17,33 @@
 namespace AK {
 namespace Detail {
 
-template<size_t inline_capacity>
+// Default allocation policy for ByteBuffer: every outline buffer is its own
+// kmalloc allocation.
+struct ByteBufferKmallocAllocator {
+    static void* allocate(size_t size) { return kmalloc(size); }
+    static void deallocate(void* pointer, size_t size) { kfree_sized(pointer, size); }
+    static size_t good_size(size_t size) { return kmalloc_good_size(size); }
+};
+
+template<size_t inline_capacity, typename AllocatorType>
 class ByteBuffer {
 public:
     ByteBuffer() = default;
 
+    // For stateful allocation policies (e.g. arena-backed buffers); the
+    // allocator is carried along on moves and shared with copies.
+    explicit ByteBuffer(AllocatorType allocator)
+        : m_allocator(move(allocator))
+    {
+    }
+
     ~ByteBuffer()
     {
         clear();
     }
 
     ByteBuffer(ByteBuffer const& other)
+        : m_allocator(other.m_allocator)
     {
         MUST(try_resize(other.size()));
         VERIFY(m_size == other.size());
@@ -42,7 +59,7 @@ public:
     {
         if (this != &other) {
             if (!m_inline)
-                kfree_sized(m_outline_buffer, m_outline_capacity);
+                m_allocator.deallocate(m_outline_buffer, m_outline_capacity);
             move_from(move(other));
         }
         return *this;
@@ -68,6 +85,13 @@ public:
         return { move(buffer) };
     }
 
+    [[nodiscard]] static ErrorOr<ByteBuffer> create_uninitialized(size_t size, AllocatorType allocator)
+    {
+        auto buffer = ByteBuffer(move(allocator));
+        TRY(buffer.try_resize(size));
+        return { move(buffer) };
+    }
+
     [[nodiscard]] static ErrorOr<ByteBuffer> create_zeroed(size_t size)
     {
         auto buffer = TRY(create_uninitialized(size));
@@ -77,6 +101,13 @@ public:
         return { move(buffer) };
     }
 
+    [[nodiscard]] static ErrorOr<ByteBuffer> create_zeroed(size_t size, AllocatorType allocator)
+    {
+        auto buffer = TRY(create_uninitialized(size, move(allocator)));
+        buffer.zero_fill();
+        return { move(buffer) };
+    }
+
     [[nodiscard]] static ErrorOr<ByteBuffer> copy(void const* data, size_t size)
     {
         auto buffer = TRY(create_uninitialized(size));
@@ -92,8 +123,8 @@ public:
         return copy(bytes.data(), bytes.size());
     }
 
-    template<size_t other_inline_capacity>
-    bool operator==(ByteBuffer<other_inline_capacity> const& other) const
+    template<size_t other_inline_capacity, typename OtherAllocatorType>
+    bool operator==(ByteBuffer<other_inline_capacity, OtherAllocatorType> const& other) const
     {
         if (size() != other.size())
             return false;
@@ -143,7 +174,7 @@ public:
     void clear()
     {
         if (!m_inline) {
-            kfree_sized(m_outline_buffer, m_outline_capacity);
+            m_allocator.deallocate(m_outline_buffer, m_outline_capacity);
             m_inline = true;
         }
         m_size = 0;
@@ -255,6 +286,7 @@ public:
 private:
     void move_from(ByteBuffer&& other)
     {
+        m_allocator = move(other.m_allocator);
         m_size = other.m_size;
         m_inline = other.m_inline;
         if (!other.m_inline) {
@@ -283,14 +315,14 @@ private:
         auto outline_capacity = m_outline_capacity;
         if (!may_discard_existing_data)
             __builtin_memcpy(m_inline_buffer, outline_buffer, size);
-        kfree_sized(outline_buffer, outline_capacity);
+        m_allocator.deallocate(outline_buffer, outline_capacity);
         m_inline = true;
     }
 
     NEVER_INLINE ErrorOr<void> try_ensure_capacity_slowpath(size_t new_capacity)
     {
-        new_capacity = kmalloc_good_size(new_capacity);
-        auto* new_buffer = (u8*)kmalloc(new_capacity);
+        new_capacity = m_allocator.good_size(new_capacity);
+        auto* new_buffer = (u8*)m_allocator.allocate(new_capacity);
         if (!new_buffer)
             return Error::from_errno(ENOMEM);
 
@@ -298,7 +330,7 @@ private:
             __builtin_memcpy(new_buffer, data(), m_size);
         } else if (m_outline_buffer) {
             __builtin_memcpy(new_buffer, m_outline_buffer, min(new_capacity, m_outline_capacity));
-            kfree_sized(m_outline_buffer, m_outline_capacity);
+            m_allocator.deallocate(m_outline_buffer, m_outline_capacity);
         }
 
         m_outline_buffer = new_buffer;
@@ -316,6 +348,7 @@ private:
     };
     size_t m_size { 0 };
     bool m_inline { true };
+    [[no_unique_address]] AllocatorType m_allocator {};
 };
 
 }
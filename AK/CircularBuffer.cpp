@@ -6,6 +6,7 @@
 
 #include <AK/CircularBuffer.h>
 #include <AK/MemMem.h>
+#include <string.h>
 
 namespace AK {
 
@@ -70,6 +71,27 @@ Optional<size_t> CircularBuffer::offset_of(StringView needle, Optional<size_t> f
     else if (is_wrapping_around())
         spans[1] = m_buffer.span().slice(max(original_span_0_size, read_from) - original_span_0_size, min(read_until, m_used_space) - original_span_0_size);
 
+    // Single-byte needles (most commonly "\n") cannot straddle the wrap-around
+    // point, so each span can be scanned with memchr.
+    if (needle.length() == 1) {
+        auto const needle_byte = static_cast<u8>(needle[0]);
+        auto logical_offset = read_from;
+        for (auto const& span : spans) {
+            if (auto const* found = memchr(span.data(), needle_byte, span.size()); found != nullptr)
+                return logical_offset + (static_cast<u8 const*>(found) - span.data());
+            logical_offset += span.size();
+        }
+        return {};
+    }
+
+    // If the search window doesn't wrap around, take the contiguous fast path.
+    if (spans[1].is_empty()) {
+        auto maybe_found = AK::memmem_optional(spans[0].data(), spans[0].size(), needle.characters_without_null_termination(), needle.length());
+        if (maybe_found.has_value())
+            *maybe_found += read_from;
+        return maybe_found;
+    }
+
     auto maybe_found = AK::memmem(spans.begin(), spans.end(), needle.bytes());
     if (maybe_found.has_value())
         *maybe_found += read_from;
@@ -77,6 +99,25 @@ Optional<size_t> CircularBuffer::offset_of(StringView needle, Optional<size_t> f
     return maybe_found;
 }
 
+ErrorOr<ReadonlyBytes> CircularBuffer::flattened_read_span()
+{
+    auto const span = next_read_span();
+    if (span.size() == m_used_space)
+        return span;
+
+    // The used data wraps around the end of the allocation; rotate it so that
+    // it starts at the beginning instead. Any already-read seekback data
+    // cannot survive the rotation, so the seekback limit shrinks accordingly.
+    auto const head = TRY(ByteBuffer::copy(span));
+    auto const tail_size = m_used_space - span.size();
+    __builtin_memmove(m_buffer.data() + span.size(), m_buffer.data(), tail_size);
+    __builtin_memcpy(m_buffer.data(), head.data(), head.size());
+    m_reading_head = 0;
+    m_seekback_limit = min(m_seekback_limit, m_used_space);
+
+    return next_read_span();
+}
+
 void CircularBuffer::clear()
 {
     m_reading_head = 0;
@@ -32,6 +32,11 @@ public:
     /// before the current write pointer and allows for reading already-read data.
     ErrorOr<Bytes> read_with_seekback(Bytes bytes, size_t distance);
 
+    /// Returns all used data as a single contiguous span without consuming it,
+    /// rotating the ring (and invalidating already-read seekback data) only if
+    /// the data currently wraps around the end of the allocation.
+    ErrorOr<ReadonlyBytes> flattened_read_span();
+
     [[nodiscard]] size_t empty_space() const;
     [[nodiscard]] size_t used_space() const;
     [[nodiscard]] size_t capacity() const;
@@ -40,13 +45,14 @@ public:
 
     void clear();
 
+    [[nodiscard]] ReadonlyBytes next_read_span() const;
+
 private:
     CircularBuffer(ByteBuffer);
 
     [[nodiscard]] bool is_wrapping_around() const;
 
     [[nodiscard]] Bytes next_write_span();
-    [[nodiscard]] ReadonlyBytes next_read_span() const;
     [[nodiscard]] ReadonlyBytes next_read_span_with_seekback(size_t distance) const;
 
     ByteBuffer m_buffer {};
@@ -64,6 +64,11 @@ DeprecatedString DeprecatedString::isolated_copy() const
     return DeprecatedString(move(*impl));
 }
 
+// Suffixes at least this long share the parent's buffer instead of copying;
+// shorter ones are cheaper to copy than to track (a substring impl is ~48
+// bytes and pins the parent alive).
+static constexpr size_t minimum_shared_suffix_length = 32;
+
 DeprecatedString DeprecatedString::substring(size_t start, size_t length) const
 {
     if (!length)
@@ -71,6 +76,12 @@ DeprecatedString DeprecatedString::substring(size_t start, size_t length) const
     VERIFY(m_impl);
     VERIFY(!Checked<size_t>::addition_would_overflow(start, length));
     VERIFY(start + length <= m_impl->length());
+    if (start == 0 && length == m_impl->length())
+        return *this;
+    // Only suffixes can be shared zero-copy, since the result has to stay
+    // NUL-terminated for characters().
+    if (start + length == m_impl->length() && length >= minimum_shared_suffix_length)
+        return DeprecatedString(StringImpl::create_suffix_of(*m_impl, start));
     return { characters() + start, length };
 }
 
@@ -78,6 +89,10 @@ DeprecatedString DeprecatedString::substring(size_t start) const
 {
     VERIFY(m_impl);
     VERIFY(start <= length());
+    if (start == 0)
+        return *this;
+    if (length() - start >= minimum_shared_suffix_length)
+        return DeprecatedString(StringImpl::create_suffix_of(*m_impl, start));
     return { characters() + start, length() - start };
 }
 
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#ifdef AK_TRACK_ERROR_CONSTRUCTIONS
+
+#    include <AK/Atomic.h>
+#    include <AK/Error.h>
+#    include <AK/Format.h>
+
+namespace AK {
+
+// Counts are kept in a fixed-size open-addressed table so that tracking
+// works identically in the kernel and in userland, without allocating on
+// the error path being measured.
+struct ErrorConstructionSite {
+    Atomic<char const*> file { nullptr };
+    u32 line { 0 };
+    char const* function { nullptr };
+    Atomic<u64> count { 0 };
+};
+
+static constexpr size_t max_tracked_sites = 4096;
+static ErrorConstructionSite s_sites[max_tracked_sites];
+static Atomic<u64> s_untracked_constructions { 0 };
+
+void track_error_construction(char const* file, u32 line, char const* function)
+{
+    // __builtin_FILE() yields the same string literal for every use within a
+    // file, so pointer identity is enough to distinguish call sites.
+    auto hash = (reinterpret_cast<FlatPtr>(file) >> 4) ^ (static_cast<FlatPtr>(line) * 0x9e3779b9u);
+
+    for (size_t probe = 0; probe < max_tracked_sites; ++probe) {
+        auto& site = s_sites[(hash + probe) % max_tracked_sites];
+        auto* existing_file = site.file.load(AK::memory_order_acquire);
+        if (!existing_file) {
+            char const* expected = nullptr;
+            if (site.file.compare_exchange_strong(expected, file, AK::memory_order_acq_rel)) {
+                site.line = line;
+                site.function = function;
+                site.count.fetch_add(1, AK::memory_order_relaxed);
+                return;
+            }
+            existing_file = expected;
+        }
+        // NOTE: A racing thread may observe the claimed slot before its line
+        //       is stored and register the same site a second time. That only
+        //       splits the count across two slots, which is fine for
+        //       diagnostics.
+        if (existing_file == file && site.line == line) {
+            site.count.fetch_add(1, AK::memory_order_relaxed);
+            return;
+        }
+    }
+
+    s_untracked_constructions.fetch_add(1, AK::memory_order_relaxed);
+}
+
+void dump_error_construction_counts()
+{
+    for (auto const& site : s_sites) {
+        auto* file = site.file.load(AK::memory_order_acquire);
+        if (!file)
+            continue;
+        dbgln("{:10} error(s) constructed at {}:{} in {}", site.count.load(AK::memory_order_relaxed), file, site.line, site.function);
+    }
+    if (auto untracked = s_untracked_constructions.load(AK::memory_order_relaxed))
+        dbgln("{:10} error construction(s) could not be tracked (table full)", untracked);
+}
+
+}
+
+#endif
@@ -19,11 +19,38 @@
 
 namespace AK {
 
+#ifdef AK_TRACK_ERROR_CONSTRUCTIONS
+// Bumps a per-call-site counter; see Error.cpp. Build with
+// ENABLE_ERROR_CONSTRUCTION_TRACKING to quantify how often error paths are
+// actually taken in a workload, then call dump_error_construction_counts()
+// (e.g. from a debugger) to print the per-site totals.
+void track_error_construction(char const* file, u32 line, char const* function);
+void dump_error_construction_counts();
+#endif
+
 class Error {
 public:
+#ifdef AK_TRACK_ERROR_CONSTRUCTIONS
+    [[nodiscard]] static Error from_errno(int code, char const* file = __builtin_FILE(), u32 line = __builtin_LINE(), char const* function = __builtin_FUNCTION())
+    {
+        track_error_construction(file, line, function);
+        return Error(code);
+    }
+    [[nodiscard]] static Error from_syscall(StringView syscall_name, int rc, char const* file = __builtin_FILE(), u32 line = __builtin_LINE(), char const* function = __builtin_FUNCTION())
+    {
+        track_error_construction(file, line, function);
+        return Error(syscall_name, rc);
+    }
+    [[nodiscard]] static Error from_string_view(StringView string_literal, char const* file = __builtin_FILE(), u32 line = __builtin_LINE(), char const* function = __builtin_FUNCTION())
+    {
+        track_error_construction(file, line, function);
+        return Error(string_literal);
+    }
+#else
     [[nodiscard]] static Error from_errno(int code) { return Error(code); }
     [[nodiscard]] static Error from_syscall(StringView syscall_name, int rc) { return Error(syscall_name, rc); }
     [[nodiscard]] static Error from_string_view(StringView string_literal) { return Error(string_literal); }
+#endif
 
     // NOTE: Prefer `from_string_literal` when directly typing out an error message:
     //
@@ -32,10 +59,17 @@ public:
     // If you need to return a static string based on a dynamic condition (like
     // picking an error from an array), then prefer `from_string_view` instead.
     template<size_t N>
+#ifdef AK_TRACK_ERROR_CONSTRUCTIONS
+    [[nodiscard]] ALWAYS_INLINE static Error from_string_literal(char const (&string_literal)[N], char const* file = __builtin_FILE(), u32 line = __builtin_LINE(), char const* function = __builtin_FUNCTION())
+    {
+        return from_string_view(StringView { string_literal, N - 1 }, file, line, function);
+    }
+#else
     [[nodiscard]] ALWAYS_INLINE static Error from_string_literal(char const (&string_literal)[N])
     {
         return from_string_view(StringView { string_literal, N - 1 });
     }
+#endif
 
     // Note: Don't call this from C++; it's here for Jakt interop (as the name suggests).
     template<SameAs<StringView> T>
@@ -129,10 +163,17 @@ public:
     }
 
 #ifdef AK_OS_SERENITY
+#    ifdef AK_TRACK_ERROR_CONSTRUCTIONS
+    ErrorOr(ErrnoCode code, char const* file = __builtin_FILE(), u32 line = __builtin_LINE(), char const* function = __builtin_FUNCTION())
+        : m_value_or_error(Error::from_errno(code, file, line, function))
+    {
+    }
+#    else
     ErrorOr(ErrnoCode code)
         : m_value_or_error(Error::from_errno(code))
     {
     }
+#    endif
 #endif
 
     T& value()
@@ -0,0 +1,492 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/BuiltinWrappers.h>
+#include <AK/Concepts.h>
+#include <AK/Error.h>
+#include <AK/HashFunctions.h>
+#include <AK/HashTable.h>
+#include <AK/StdLibExtras.h>
+#include <AK/Traits.h>
+#include <AK/Types.h>
+#include <AK/kmalloc.h>
+
+namespace AK {
+
+// An open-addressing hash table that keeps elements in a single flat
+// allocation and describes each slot with one control byte:
+//
+// - 0x80: empty slot
+// - 0xfe: deleted slot (tombstone)
+// - 0xff: end of the control array (used by iterators only)
+// - 0x00..0x7f: used slot, storing the low 7 bits of the element's hash
+//
+// Lookups probe 16 control bytes at a time with word-sized compares, so a
+// probe usually touches a single cache line before any element is compared.
+// Unlike HashTable, elements move on rehash and iterators are invalidated by
+// any mutation; use this where lookup speed matters and iterator stability
+// does not.
+
+static constexpr u8 flat_hash_table_empty_byte = 0x80;
+static constexpr u8 flat_hash_table_deleted_byte = 0xfe;
+static constexpr u8 flat_hash_table_end_byte = 0xff;
+
+class FlatHashTableGroup {
+public:
+    static constexpr size_t width = 16;
+
+    explicit FlatHashTableGroup(u8 const* control_bytes)
+    {
+        __builtin_memcpy(m_words, control_bytes, sizeof(m_words));
+    }
+
+    using BitMask = u32;
+
+    // Bit i of the result is set if control byte i (possibly) matches h2.
+    // False positives are acceptable; callers always verify the element.
+    [[nodiscard]] BitMask match(u8 h2) const
+    {
+        return matching_byte_mask(m_words[0] ^ (0x0101010101010101ull * h2))
+            | (matching_byte_mask(m_words[1] ^ (0x0101010101010101ull * h2)) << 8);
+    }
+
+    // Exact for the control byte domain: 0x81 (which would alias an adjacent
+    // match) can never appear in the array.
+    [[nodiscard]] BitMask match_empty() const
+    {
+        return matching_byte_mask(m_words[0] ^ (0x0101010101010101ull * flat_hash_table_empty_byte))
+            | (matching_byte_mask(m_words[1] ^ (0x0101010101010101ull * flat_hash_table_empty_byte)) << 8);
+    }
+
+    [[nodiscard]] BitMask match_empty_or_deleted() const
+    {
+        return high_bit_byte_mask(m_words[0]) | (high_bit_byte_mask(m_words[1]) << 8);
+    }
+
+    static size_t lowest_set_bit(BitMask mask) { return count_trailing_zeroes(mask); }
+
+private:
+    static BitMask matching_byte_mask(u64 word)
+    {
+        u64 mask = (word - 0x0101010101010101ull) & ~word & 0x8080808080808080ull;
+        // Compress one bit per byte into the low 8 bits.
+        return (mask * 0x0002040810204081ull) >> 56;
+    }
+
+    static BitMask high_bit_byte_mask(u64 word)
+    {
+        return ((word & 0x8080808080808080ull) * 0x0002040810204081ull) >> 56;
+    }
+
+    u64 m_words[2];
+};
+
+template<typename FlatHashTableType, typename T>
+class FlatHashTableIterator {
+    friend FlatHashTableType;
+
+public:
+    bool operator==(FlatHashTableIterator const& other) const { return m_slot == other.m_slot; }
+    bool operator!=(FlatHashTableIterator const& other) const { return m_slot != other.m_slot; }
+    T& operator*() { return *m_slot; }
+    T* operator->() { return m_slot; }
+    void operator++() { skip_to_next(); }
+
+private:
+    void skip_to_next()
+    {
+        if (!m_slot)
+            return;
+        for (;;) {
+            ++m_control;
+            ++m_slot;
+            if (*m_control == flat_hash_table_end_byte) {
+                m_slot = nullptr;
+                return;
+            }
+            if (!(*m_control & 0x80))
+                return;
+        }
+    }
+
+    FlatHashTableIterator(u8 const* control, T* slot)
+        : m_control(control)
+        , m_slot(slot)
+    {
+        if (m_slot && (*m_control & 0x80)) {
+            if (*m_control == flat_hash_table_end_byte)
+                m_slot = nullptr;
+            else
+                skip_to_next();
+        }
+    }
+
+    u8 const* m_control { nullptr };
+    T* m_slot { nullptr };
+};
+
+template<typename T, typename TraitsForT>
+class FlatHashTable {
+    static constexpr size_t group_width = FlatHashTableGroup::width;
+    static constexpr size_t minimum_capacity = group_width;
+    // Grow once used + deleted slots pass 7/8 of capacity; flat probing
+    // tolerates a higher load factor than the chained table's 60%.
+    static constexpr size_t max_load_in_eighths = 7;
+
+public:
+    FlatHashTable() = default;
+    explicit FlatHashTable(size_t capacity) { rehash(capacity); }
+
+    ~FlatHashTable()
+    {
+        destroy_elements_and_free_storage();
+    }
+
+    FlatHashTable(FlatHashTable const& other)
+    {
+        rehash(other.size());
+        for (auto& it : other)
+            set(it);
+    }
+
+    FlatHashTable& operator=(FlatHashTable const& other)
+    {
+        FlatHashTable temporary(other);
+        swap(*this, temporary);
+        return *this;
+    }
+
+    FlatHashTable(FlatHashTable&& other) noexcept
+        : m_slots(other.m_slots)
+        , m_size(other.m_size)
+        , m_capacity(other.m_capacity)
+        , m_deleted_count(other.m_deleted_count)
+    {
+        other.m_slots = nullptr;
+        other.m_size = 0;
+        other.m_capacity = 0;
+        other.m_deleted_count = 0;
+    }
+
+    FlatHashTable& operator=(FlatHashTable&& other) noexcept
+    {
+        FlatHashTable temporary { move(other) };
+        swap(*this, temporary);
+        return *this;
+    }
+
+    friend void swap(FlatHashTable& a, FlatHashTable& b) noexcept
+    {
+        swap(a.m_slots, b.m_slots);
+        swap(a.m_size, b.m_size);
+        swap(a.m_capacity, b.m_capacity);
+        swap(a.m_deleted_count, b.m_deleted_count);
+    }
+
+    [[nodiscard]] bool is_empty() const { return m_size == 0; }
+    [[nodiscard]] size_t size() const { return m_size; }
+    [[nodiscard]] size_t capacity() const { return m_capacity; }
+
+    void ensure_capacity(size_t capacity)
+    {
+        VERIFY(capacity >= size());
+        rehash(capacity);
+    }
+
+    ErrorOr<void> try_ensure_capacity(size_t capacity)
+    {
+        VERIFY(capacity >= size());
+        return try_rehash(capacity);
+    }
+
+    [[nodiscard]] bool contains(T const& value) const
+    {
+        return find(value) != end();
+    }
+
+    template<Concepts::HashCompatible<T> K>
+    requires(IsSame<TraitsForT, Traits<T>>) [[nodiscard]] bool contains(K const& value) const
+    {
+        return find(value) != end();
+    }
+
+    using Iterator = FlatHashTableIterator<FlatHashTable, T>;
+    using ConstIterator = FlatHashTableIterator<FlatHashTable const, T const>;
+
+    [[nodiscard]] Iterator begin()
+    {
+        if (!m_slots)
+            return end();
+        return Iterator(control_bytes(), m_slots);
+    }
+    [[nodiscard]] Iterator end() { return Iterator(nullptr, nullptr); }
+
+    [[nodiscard]] ConstIterator begin() const
+    {
+        if (!m_slots)
+            return end();
+        return ConstIterator(control_bytes(), m_slots);
+    }
+    [[nodiscard]] ConstIterator end() const { return ConstIterator(nullptr, nullptr); }
+
+    void clear()
+    {
+        *this = FlatHashTable();
+    }
+
+    void clear_with_capacity()
+    {
+        if (m_capacity == 0)
+            return;
+        if constexpr (!IsTriviallyDestructible<T>) {
+            for (auto& element : *this)
+                element.~T();
+        }
+        __builtin_memset(control_bytes(), flat_hash_table_empty_byte, m_capacity);
+        m_size = 0;
+        m_deleted_count = 0;
+    }
+
+    template<typename U = T>
+    ErrorOr<HashSetResult> try_set(U&& value, HashSetExistingEntryBehavior existing_entry_behavior = HashSetExistingEntryBehavior::Replace)
+    {
+        if (should_grow())
+            TRY(try_rehash(m_size + 1));
+
+        auto hash = TraitsForT::hash(value);
+        if (auto* existing = lookup_with_hash(hash, [&](auto& other) { return TraitsForT::equals(value, other); })) {
+            if (existing_entry_behavior == HashSetExistingEntryBehavior::Keep)
+                return HashSetResult::KeptExistingEntry;
+            *existing = forward<U>(value);
+            return HashSetResult::ReplacedExistingEntry;
+        }
+
+        size_t slot_index = find_slot_for_insertion(hash);
+        if (control_bytes()[slot_index] == flat_hash_table_deleted_byte)
+            --m_deleted_count;
+        control_bytes()[slot_index] = h2(hash);
+        new (&m_slots[slot_index]) T(forward<U>(value));
+        ++m_size;
+        return HashSetResult::InsertedNewEntry;
+    }
+
+    template<typename U = T>
+    HashSetResult set(U&& value, HashSetExistingEntryBehavior existing_entry_behavior = HashSetExistingEntryBehavior::Replace)
+    {
+        return MUST(try_set(forward<U>(value), existing_entry_behavior));
+    }
+
+    template<typename TUnaryPredicate>
+    [[nodiscard]] Iterator find(unsigned hash, TUnaryPredicate predicate)
+    {
+        auto* slot = lookup_with_hash(hash, move(predicate));
+        if (!slot)
+            return end();
+        return Iterator(control_bytes() + (slot - m_slots), slot);
+    }
+
+    [[nodiscard]] Iterator find(T const& value)
+    {
+        return find(TraitsForT::hash(value), [&](auto& other) { return TraitsForT::equals(value, other); });
+    }
+
+    template<typename TUnaryPredicate>
+    [[nodiscard]] ConstIterator find(unsigned hash, TUnaryPredicate predicate) const
+    {
+        auto* slot = lookup_with_hash(hash, move(predicate));
+        if (!slot)
+            return end();
+        return ConstIterator(control_bytes() + (slot - m_slots), slot);
+    }
+
+    [[nodiscard]] ConstIterator find(T const& value) const
+    {
+        return find(TraitsForT::hash(value), [&](auto& other) { return TraitsForT::equals(value, other); });
+    }
+
+    template<Concepts::HashCompatible<T> K>
+    requires(IsSame<TraitsForT, Traits<T>>) [[nodiscard]] Iterator find(K const& value)
+    {
+        return find(Traits<K>::hash(value), [&](auto& other) { return Traits<T>::equals(other, value); });
+    }
+
+    template<Concepts::HashCompatible<T> K>
+    requires(IsSame<TraitsForT, Traits<T>>) [[nodiscard]] ConstIterator find(K const& value) const
+    {
+        return find(Traits<K>::hash(value), [&](auto& other) { return Traits<T>::equals(other, value); });
+    }
+
+    bool remove(T const& value)
+    {
+        auto it = find(value);
+        if (it != end()) {
+            remove(it);
+            return true;
+        }
+        return false;
+    }
+
+    template<Concepts::HashCompatible<T> K>
+    requires(IsSame<TraitsForT, Traits<T>>) bool remove(K const& value)
+    {
+        auto it = find(value);
+        if (it != end()) {
+            remove(it);
+            return true;
+        }
+        return false;
+    }
+
+    void remove(Iterator iterator)
+    {
+        VERIFY(iterator.m_slot);
+        remove_slot(iterator.m_slot - m_slots);
+    }
+
+    template<typename TUnaryPredicate>
+    bool remove_all_matching(TUnaryPredicate const& predicate)
+    {
+        size_t removed_count = 0;
+        for (size_t i = 0; i < m_capacity; ++i) {
+            if ((control_bytes()[i] & 0x80) || !predicate(m_slots[i]))
+                continue;
+            remove_slot(i);
+            ++removed_count;
+        }
+        return removed_count != 0;
+    }
+
+private:
+    static u8 h2(unsigned hash) { return hash & 0x7f; }
+    static size_t h1(unsigned hash) { return hash >> 7; }
+
+    u8* control_bytes() { return reinterpret_cast<u8*>(m_slots + m_capacity); }
+    u8 const* control_bytes() const { return reinterpret_cast<u8 const*>(m_slots + m_capacity); }
+
+    static size_t size_in_bytes(size_t capacity)
+    {
+        // One extra control byte holds the end marker for iterators.
+        return capacity * sizeof(T) + capacity + 1;
+    }
+
+    [[nodiscard]] bool should_grow() const
+    {
+        return m_capacity == 0 || (m_size + m_deleted_count + 1) * 8 >= m_capacity * max_load_in_eighths;
+    }
+
+    template<typename TUnaryPredicate>
+    [[nodiscard]] T* lookup_with_hash(unsigned hash, TUnaryPredicate predicate) const
+    {
+        if (is_empty())
+            return nullptr;
+        size_t group_count = m_capacity / group_width;
+        size_t group_index = h1(hash) & (group_count - 1);
+        u8 const target = h2(hash);
+        // Triangular probing over groups; with a power-of-two group count
+        // this visits every group exactly once.
+        for (size_t step = 1;; ++step) {
+            FlatHashTableGroup group(control_bytes() + group_index * group_width);
+            for (auto mask = group.match(target); mask != 0; mask &= mask - 1) {
+                size_t slot_index = group_index * group_width + FlatHashTableGroup::lowest_set_bit(mask);
+                if (predicate(m_slots[slot_index]))
+                    return &m_slots[slot_index];
+            }
+            if (group.match_empty() != 0)
+                return nullptr;
+            group_index = (group_index + step) & (group_count - 1);
+        }
+    }
+
+    [[nodiscard]] size_t find_slot_for_insertion(unsigned hash) const
+    {
+        size_t group_count = m_capacity / group_width;
+        size_t group_index = h1(hash) & (group_count - 1);
+        for (size_t step = 1;; ++step) {
+            FlatHashTableGroup group(control_bytes() + group_index * group_width);
+            if (auto mask = group.match_empty_or_deleted(); mask != 0)
+                return group_index * group_width + FlatHashTableGroup::lowest_set_bit(mask);
+            group_index = (group_index + step) & (group_count - 1);
+        }
+    }
+
+    void remove_slot(size_t slot_index)
+    {
+        VERIFY(!(control_bytes()[slot_index] & 0x80));
+        m_slots[slot_index].~T();
+        control_bytes()[slot_index] = flat_hash_table_deleted_byte;
+        --m_size;
+        ++m_deleted_count;
+    }
+
+    ErrorOr<void> try_rehash(size_t new_size)
+    {
+        size_t new_capacity = minimum_capacity;
+        // Leave enough headroom that new_size elements stay under max load.
+        while (new_size * 8 >= new_capacity * max_load_in_eighths)
+            new_capacity *= 2;
+
+        auto* old_slots = m_slots;
+        auto* old_control = old_slots ? control_bytes() : nullptr;
+        auto old_capacity = m_capacity;
+
+        auto* new_storage = kmalloc(size_in_bytes(new_capacity));
+        if (!new_storage)
+            return Error::from_errno(ENOMEM);
+
+        m_slots = static_cast<T*>(new_storage);
+        m_capacity = new_capacity;
+        m_size = 0;
+        m_deleted_count = 0;
+        __builtin_memset(control_bytes(), flat_hash_table_empty_byte, m_capacity);
+        control_bytes()[m_capacity] = flat_hash_table_end_byte;
+
+        if (old_slots) {
+            for (size_t i = 0; i < old_capacity; ++i) {
+                if (old_control[i] & 0x80)
+                    continue;
+                auto hash = TraitsForT::hash(old_slots[i]);
+                size_t slot_index = find_slot_for_insertion(hash);
+                control_bytes()[slot_index] = h2(hash);
+                new (&m_slots[slot_index]) T(move(old_slots[i]));
+                old_slots[i].~T();
+                ++m_size;
+            }
+            kfree_sized(old_slots, size_in_bytes(old_capacity));
+        }
+        return {};
+    }
+
+    void rehash(size_t new_size)
+    {
+        MUST(try_rehash(new_size));
+    }
+
+    void destroy_elements_and_free_storage()
+    {
+        if (!m_slots)
+            return;
+        if constexpr (!IsTriviallyDestructible<T>) {
+            for (size_t i = 0; i < m_capacity; ++i) {
+                if (!(control_bytes()[i] & 0x80))
+                    m_slots[i].~T();
+            }
+        }
+        kfree_sized(m_slots, size_in_bytes(m_capacity));
+    }
+
+    T* m_slots { nullptr };
+    size_t m_size { 0 };
+    size_t m_capacity { 0 };
+    size_t m_deleted_count { 0 };
+};
+
+}
+
+#if USING_AK_GLOBALLY
+using AK::FlatHashTable;
+#endif
@@ -13,7 +13,8 @@
 namespace AK {
 
 namespace Detail {
-template<size_t inline_capacity>
+struct ByteBufferKmallocAllocator;
+template<size_t inline_capacity, typename AllocatorType = ByteBufferKmallocAllocator>
 class ByteBuffer;
 }
 
@@ -84,6 +85,12 @@ class HashMap;
 template<typename K, typename V, typename KeyTraits = Traits<K>, typename ValueTraits = Traits<V>>
 using OrderedHashMap = HashMap<K, V, KeyTraits, ValueTraits, true>;
 
+template<typename T, typename TraitsForT = Traits<T>>
+class FlatHashTable;
+
+template<typename K, typename V, typename KeyTraits = Traits<K>, typename ValueTraits = Traits<V>>
+class FlatHashMap;
+
 template<typename T>
 class Badge;
 
@@ -93,11 +100,19 @@ class FixedArray;
 template<size_t precision, typename Underlying = i32>
 class FixedPoint;
 
-template<typename>
+#ifdef KERNEL
+// FIXME: Try to decrease this.
+inline constexpr size_t default_function_inline_capacity = 6 * sizeof(void*);
+#else
+// Empirically determined to fit most lambdas and functions.
+inline constexpr size_t default_function_inline_capacity = 4 * sizeof(void*);
+#endif
+
+template<typename FunctionType, size_t InlineCapacity = default_function_inline_capacity>
 class Function;
 
-template<typename Out, typename... In>
-class Function<Out(In...)>;
+template<typename Out, typename... In, size_t InlineCapacity>
+class Function<Out(In...), InlineCapacity>;
 
 template<typename T>
 class NonnullRefPtr;
@@ -161,6 +176,8 @@ using AK::Error;
 using AK::ErrorOr;
 using AK::FixedArray;
 using AK::FixedPoint;
+using AK::FlatHashMap;
+using AK::FlatHashTable;
 using AK::Function;
 using AK::GenericLexer;
 using AK::HashMap;
@@ -29,6 +29,8 @@
 #include <AK/Assertions.h>
 #include <AK/Atomic.h>
 #include <AK/BitCast.h>
+#include <AK/Debug.h>
+#include <AK/Forward.h>
 #include <AK/Noncopyable.h>
 #include <AK/ScopeGuard.h>
 #include <AK/StdLibExtras.h>
@@ -36,8 +38,13 @@
 
 namespace AK {
 
-template<typename>
-class Function;
+#if FUNCTION_DEBUG
+// Counters for sizing inline capacities against a workload: how many Function
+// constructions there were, and how many had to spill the callable to a heap
+// allocation because it did not fit the inline buffer.
+inline Atomic<size_t> g_function_construction_count { 0 };
+inline Atomic<size_t> g_function_outline_construction_count { 0 };
+#endif
 
 template<typename F>
 inline constexpr bool IsFunctionPointer = (IsPointer<F> && IsFunction<RemovePointer<F>>);
@@ -46,8 +53,8 @@ inline constexpr bool IsFunctionPointer = (IsPointer<F> && IsFunction<RemovePoin
 template<typename F>
 inline constexpr bool IsFunctionObject = (!IsFunctionPointer<F> && IsRvalueReference<F&&>);
 
-template<typename Out, typename... In>
-class Function<Out(In...)> {
+template<typename Out, typename... In, size_t InlineCapacity>
+class Function<Out(In...), InlineCapacity> {
     AK_MAKE_NONCOPYABLE(Function);
 
 public:
@@ -219,8 +226,14 @@ private:
     {
         VERIFY(m_call_nesting_level == 0);
         using WrapperType = CallableWrapper<Callable>;
+#if FUNCTION_DEBUG
+        g_function_construction_count.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+#endif
 #ifndef KERNEL
         if constexpr (sizeof(WrapperType) > inline_capacity) {
+#    if FUNCTION_DEBUG
+            g_function_outline_construction_count.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+#    endif
             *bit_cast<CallableWrapperBase**>(&m_storage) = new WrapperType(forward<Callable>(callable));
             m_kind = FunctionKind::Outline;
         } else {
@@ -257,13 +270,9 @@ private:
     FunctionKind m_kind { FunctionKind::NullPointer };
     bool m_deferred_clear { false };
     mutable Atomic<u16> m_call_nesting_level { 0 };
-#ifndef KERNEL
-    // Empirically determined to fit most lambdas and functions.
-    static constexpr size_t inline_capacity = 4 * sizeof(void*);
-#else
-    // FIXME: Try to decrease this.
-    static constexpr size_t inline_capacity = 6 * sizeof(void*);
-#endif
+    // The inline buffer is always big enough for the outline pointer, so a
+    // caller asking for a tiny capacity still gets a working Function.
+    static constexpr size_t inline_capacity = max(InlineCapacity, sizeof(CallableWrapperBase*));
     alignas(max(alignof(CallableWrapperBase), alignof(CallableWrapperBase*))) u8 m_storage[inline_capacity];
 };
 
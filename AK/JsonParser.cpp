@@ -5,6 +5,7 @@
  */
 
 #include <AK/CharacterTypes.h>
+#include <AK/DeprecatedFlyString.h>
 #include <AK/FloatingPointStringConversions.h>
 #include <AK/JsonArray.h>
 #include <AK/JsonObject.h>
@@ -139,7 +140,10 @@ ErrorOr<JsonValue> JsonParser::parse_object()
             return Error::from_string_literal("JsonParser: Expected ':'");
         ignore_while(is_space);
         auto value = TRY(parse_helper());
-        object.set(name, move(value));
+        if (m_key_interning == KeyInterning::Yes)
+            object.set(DeprecatedString { DeprecatedFlyString(name).impl() }, move(value));
+        else
+            object.set(name, move(value));
         ignore_while(is_space);
         if (peek() == '}')
             break;
@@ -352,4 +356,154 @@ ErrorOr<JsonValue> JsonParser::parse()
     return result;
 }
 
+ErrorOr<DeprecatedString> JsonParser::unescape_string(StringView quoted_string)
+{
+    JsonParser parser(quoted_string);
+    return parser.consume_and_unescape_string();
+}
+
+ErrorOr<JsonPullParser::Event> JsonPullParser::next_event()
+{
+    ignore_while(is_space);
+
+    if (m_done)
+        return Event { EventType::End };
+
+    if (m_after_key) {
+        m_after_key = false;
+        if (!consume_specific(':'))
+            return Error::from_string_literal("JsonPullParser: Expected ':'");
+        ignore_while(is_space);
+        return parse_value_start();
+    }
+
+    if (!m_open_containers.is_empty()) {
+        auto container = m_open_containers.last().container;
+        char closing_character = container == Container::Object ? '}' : ']';
+        if (peek() == closing_character) {
+            ignore();
+            m_open_containers.take_last();
+            return Event { container == Container::Object ? EventType::ObjectEnd : EventType::ArrayEnd };
+        }
+        if (!m_open_containers.last().expecting_first_element) {
+            if (!consume_specific(','))
+                return Error::from_string_literal("JsonPullParser: Expected ','");
+            ignore_while(is_space);
+            if (peek() == closing_character)
+                return Error::from_string_literal("JsonPullParser: Unexpected trailing comma");
+        }
+        // Note: Set this before parse_value_start() can grow the stack and
+        // invalidate references into it.
+        m_open_containers.last().expecting_first_element = false;
+        if (container == Container::Object) {
+            auto key = TRY(consume_string_raw());
+            m_after_key = true;
+            return Event { EventType::Key, key };
+        }
+        return parse_value_start();
+    }
+
+    if (!m_root_started) {
+        m_root_started = true;
+        return parse_value_start();
+    }
+
+    // The root value is complete; only trailing whitespace may remain.
+    if (!is_eof())
+        return Error::from_string_literal("JsonPullParser: Didn't consume all input");
+    m_done = true;
+    return Event { EventType::End };
+}
+
+ErrorOr<JsonPullParser::Event> JsonPullParser::parse_value_start()
+{
+    switch (peek()) {
+    case '{':
+        ignore();
+        m_open_containers.append({ Container::Object });
+        return Event { EventType::ObjectStart };
+    case '[':
+        ignore();
+        m_open_containers.append({ Container::Array });
+        return Event { EventType::ArrayStart };
+    case '"':
+        return Event { EventType::String, TRY(consume_string_raw()) };
+    case '-':
+    case '0':
+    case '1':
+    case '2':
+    case '3':
+    case '4':
+    case '5':
+    case '6':
+    case '7':
+    case '8':
+    case '9':
+        return Event { EventType::Number, {}, TRY(parse_number()) };
+    case 't':
+        if (!consume_specific("true"))
+            return Error::from_string_literal("JsonPullParser: Expected 'true'");
+        return Event { EventType::Boolean, {}, JsonValue(true) };
+    case 'f':
+        if (!consume_specific("false"))
+            return Error::from_string_literal("JsonPullParser: Expected 'false'");
+        return Event { EventType::Boolean, {}, JsonValue(false) };
+    case 'n':
+        if (!consume_specific("null"))
+            return Error::from_string_literal("JsonPullParser: Expected 'null'");
+        return Event { EventType::Null };
+    default:
+        return Error::from_string_literal("JsonPullParser: Unexpected character");
+    }
+}
+
+// Scans over a quoted string without decoding it: escape sequences are
+// checked for validity but left in place, and the returned view covers the
+// characters between the quotes.
+ErrorOr<StringView> JsonPullParser::consume_string_raw()
+{
+    if (!consume_specific('"'))
+        return Error::from_string_literal("JsonPullParser: Expected '\"'");
+    size_t start = tell();
+    for (;;) {
+        if (is_eof())
+            return Error::from_string_literal("JsonPullParser: EOF while parsing string");
+        char ch = peek();
+        if (ch == '"') {
+            auto contents = m_input.substring_view(start, tell() - start);
+            ignore();
+            return contents;
+        }
+        if (is_ascii_c0_control(ch))
+            return Error::from_string_literal("JsonPullParser: Error while parsing string");
+        if (ch == '\\') {
+            ignore();
+            char escaped_character = peek();
+            if (escaped_character == 'u') {
+                ignore();
+                if (tell_remaining() < 4 || !StringUtils::convert_to_uint_from_hex(consume(4)).has_value())
+                    return Error::from_string_literal("JsonPullParser: Error while parsing Unicode escape");
+                continue;
+            }
+            if (escaped_character != '"' && escaped_character != '\\' && escaped_character != '/'
+                && escaped_character != 'n' && escaped_character != 'r' && escaped_character != 't'
+                && escaped_character != 'b' && escaped_character != 'f') {
+                return Error::from_string_literal("JsonPullParser: Invalid escape sequence");
+            }
+            ignore();
+            continue;
+        }
+        ignore();
+    }
+}
+
+ErrorOr<DeprecatedString> JsonPullParser::decode_string(Event const& event) const
+{
+    VERIFY(event.type == EventType::Key || event.type == EventType::String);
+    // The event's view points into our input with the quotes immediately
+    // around it, so the regular unescaper can run over the quoted span.
+    StringView quoted_string { event.string.characters_without_null_termination() - 1, event.string.length() + 2 };
+    return unescape_string(quoted_string);
+}
+
 }
@@ -8,33 +8,111 @@
 
 #include <AK/GenericLexer.h>
 #include <AK/JsonValue.h>
+#include <AK/Vector.h>
 
 namespace AK {
 
-class JsonParser : private GenericLexer {
+class JsonParser : protected GenericLexer {
 public:
-    explicit JsonParser(StringView input)
+    // With KeyInterning::Yes, object keys are deduplicated through the
+    // FlyString table, so a document with thousands of objects sharing the
+    // same few keys stores each key string only once.
+    enum class KeyInterning {
+        No,
+        Yes,
+    };
+
+    explicit JsonParser(StringView input, KeyInterning key_interning = KeyInterning::No)
         : GenericLexer(input)
+        , m_key_interning(key_interning)
     {
     }
 
     ErrorOr<JsonValue> parse();
 
+protected:
+    ErrorOr<DeprecatedString> consume_and_unescape_string();
+    ErrorOr<JsonValue> parse_number();
+    static ErrorOr<DeprecatedString> unescape_string(StringView quoted_string);
+
 private:
     ErrorOr<JsonValue> parse_helper();
 
-    ErrorOr<DeprecatedString> consume_and_unescape_string();
     ErrorOr<JsonValue> parse_array();
     ErrorOr<JsonValue> parse_object();
-    ErrorOr<JsonValue> parse_number();
     ErrorOr<JsonValue> parse_string();
     ErrorOr<JsonValue> parse_false();
     ErrorOr<JsonValue> parse_true();
     ErrorOr<JsonValue> parse_null();
+
+    KeyInterning m_key_interning { KeyInterning::No };
+};
+
+// A SAX-style pull parser that walks the same grammar as JsonParser but emits
+// a stream of events instead of materializing a JsonValue tree. Nothing is
+// allocated while pulling events (short of pathological nesting depth):
+// string and key events carry views into the input with escape sequences left
+// undecoded, and decode_string() only allocates when the caller actually
+// wants the text.
+class JsonPullParser : private JsonParser {
+public:
+    enum class EventType {
+        ObjectStart,
+        ObjectEnd,
+        ArrayStart,
+        ArrayEnd,
+        Key,
+        String,
+        Number,
+        Boolean,
+        Null,
+        End,
+    };
+
+    struct Event {
+        EventType type { EventType::End };
+        // For Key and String events: the characters between the quotes.
+        // Escape sequences are validated but not decoded; keys without
+        // escapes can be compared against literals directly.
+        StringView string {};
+        // For Number and Boolean events.
+        JsonValue value {};
+    };
+
+    explicit JsonPullParser(StringView input)
+        : JsonParser(input)
+    {
+    }
+
+    // Returns End (repeatedly) once the document has been fully consumed.
+    ErrorOr<Event> next_event();
+
+    // Decodes the escape sequences of a Key or String event.
+    ErrorOr<DeprecatedString> decode_string(Event const&) const;
+
+private:
+    enum class Container : u8 {
+        Object,
+        Array,
+    };
+
+    struct OpenContainer {
+        Container container;
+        bool expecting_first_element { true };
+    };
+
+    ErrorOr<Event> parse_value_start();
+    ErrorOr<StringView> consume_string_raw();
+
+    Vector<OpenContainer, 16> m_open_containers;
+    bool m_after_key { false };
+    bool m_root_started { false };
+    bool m_done { false };
 };
 
 }
 
 #if USING_AK_GLOBALLY
 using AK::JsonParser;
+using AK::JsonPullParser;
 #endif
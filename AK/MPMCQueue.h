@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/BuiltinWrappers.h>
+#include <AK/Noncopyable.h>
+#include <AK/Optional.h>
+#include <AK/Platform.h>
+#include <AK/StdLibExtras.h>
+#include <AK/Types.h>
+
+namespace AK {
+
+// A bounded lock-free multi-producer multi-consumer queue, after Dmitry
+// Vyukov's array-based MPMC queue. Each slot carries a sequence number that
+// encodes whether it is ready to be filled or drained, so producers and
+// consumers never touch each other's index and contend only when they race
+// for the same slot. All operations are non-blocking: enqueueing into a full
+// queue and dequeueing from an empty one simply fail, and callers decide how
+// to wait.
+//
+// Unlike Core::SharedSingleProducerCircularQueue this lives in one process
+// and allows any number of producers and consumers; use the
+// *_single_producer / *_single_consumer variants to skip the index CAS when
+// the caller can guarantee exclusivity on its side of the queue.
+template<typename T, size_t Size = 1024>
+// Size must be a power of two, which speeds up the modulus operations for indexing.
+requires(popcount(Size) == 1)
+class MPMCQueue {
+    AK_MAKE_NONCOPYABLE(MPMCQueue);
+    AK_MAKE_NONMOVABLE(MPMCQueue);
+
+public:
+    using ValueType = T;
+
+    MPMCQueue()
+    {
+        for (size_t i = 0; i < Size; ++i)
+            m_slots[i].sequence.store(i, MemoryOrder::memory_order_relaxed);
+    }
+
+    ~MPMCQueue()
+    {
+        while (try_dequeue().has_value()) { }
+    }
+
+    constexpr size_t size() const { return Size; }
+
+    // This is only a snapshot and should not be used to make decisions that
+    // need an exact count; by the time the caller looks at it, concurrent
+    // producers and consumers may already have changed it.
+    size_t weak_used() const
+    {
+        auto tail = m_tail.load(MemoryOrder::memory_order_relaxed);
+        auto head = m_head.load(MemoryOrder::memory_order_relaxed);
+        return tail >= head ? tail - head : 0;
+    }
+
+    bool weak_is_empty() const { return weak_used() == 0; }
+
+    // Returns false if the queue was full.
+    template<typename U = T>
+    [[nodiscard]] bool try_enqueue(U&& value)
+    {
+        auto tail = m_tail.load(MemoryOrder::memory_order_relaxed);
+        Slot* slot;
+        while (true) {
+            slot = &m_slots[tail & (Size - 1)];
+            auto sequence = slot->sequence.load(MemoryOrder::memory_order_acquire);
+            auto difference = static_cast<ssize_t>(sequence) - static_cast<ssize_t>(tail);
+            if (difference == 0) {
+                // The slot is free; try to claim it by bumping the tail.
+                if (m_tail.compare_exchange_strong(tail, tail + 1, MemoryOrder::memory_order_relaxed))
+                    break;
+            } else if (difference < 0) {
+                // The slot still holds an element from one lap ago: the queue is full.
+                return false;
+            } else {
+                // Another producer claimed this slot; reload the tail and retry.
+                tail = m_tail.load(MemoryOrder::memory_order_relaxed);
+            }
+        }
+        new (&slot->storage) T(forward<U>(value));
+        slot->sequence.store(tail + 1, MemoryOrder::memory_order_release);
+        return true;
+    }
+
+    // Returns an empty Optional if the queue was empty.
+    [[nodiscard]] Optional<T> try_dequeue()
+    {
+        auto head = m_head.load(MemoryOrder::memory_order_relaxed);
+        Slot* slot;
+        while (true) {
+            slot = &m_slots[head & (Size - 1)];
+            auto sequence = slot->sequence.load(MemoryOrder::memory_order_acquire);
+            auto difference = static_cast<ssize_t>(sequence) - static_cast<ssize_t>(head + 1);
+            if (difference == 0) {
+                if (m_head.compare_exchange_strong(head, head + 1, MemoryOrder::memory_order_relaxed))
+                    break;
+            } else if (difference < 0) {
+                return {};
+            } else {
+                head = m_head.load(MemoryOrder::memory_order_relaxed);
+            }
+        }
+        return take_from_slot(*slot, head);
+    }
+
+    // Fast path for callers that guarantee only one thread ever enqueues:
+    // the tail is then only written here, so the CAS becomes a plain store.
+    template<typename U = T>
+    [[nodiscard]] bool try_enqueue_single_producer(U&& value)
+    {
+        auto tail = m_tail.load(MemoryOrder::memory_order_relaxed);
+        auto& slot = m_slots[tail & (Size - 1)];
+        if (slot.sequence.load(MemoryOrder::memory_order_acquire) != tail)
+            return false;
+        m_tail.store(tail + 1, MemoryOrder::memory_order_relaxed);
+        new (&slot.storage) T(forward<U>(value));
+        slot.sequence.store(tail + 1, MemoryOrder::memory_order_release);
+        return true;
+    }
+
+    // Fast path for callers that guarantee only one thread ever dequeues.
+    [[nodiscard]] Optional<T> try_dequeue_single_consumer()
+    {
+        auto head = m_head.load(MemoryOrder::memory_order_relaxed);
+        auto& slot = m_slots[head & (Size - 1)];
+        if (slot.sequence.load(MemoryOrder::memory_order_acquire) != head + 1)
+            return {};
+        m_head.store(head + 1, MemoryOrder::memory_order_relaxed);
+        return take_from_slot(slot, head);
+    }
+
+private:
+    struct Slot {
+        Atomic<size_t> sequence;
+        alignas(T) u8 storage[sizeof(T)];
+    };
+
+    Optional<T> take_from_slot(Slot& slot, size_t head)
+    {
+        auto& value = *reinterpret_cast<T*>(&slot.storage);
+        Optional<T> result = move(value);
+        value.~T();
+        // Mark the slot as free for the producer that next wraps around to it.
+        slot.sequence.store(head + Size, MemoryOrder::memory_order_release);
+        return result;
+    }
+
+    Slot m_slots[Size];
+    // Producers and consumers each get their own cache line so that a busy
+    // producer does not ping-pong the consumers' index (and vice versa).
+    AK_CACHE_ALIGNED Atomic<size_t> m_tail { 0 };
+    AK_CACHE_ALIGNED Atomic<size_t> m_head { 0 };
+};
+
+}
+
+#if USING_AK_GLOBALLY
+using AK::MPMCQueue;
+#endif
@@ -29,10 +29,36 @@ StringImpl::StringImpl(ConstructWithInlineBufferTag, size_t length)
 {
 }
 
+StringImpl::StringImpl(ConstructSubstringTag, StringImpl const& parent, size_t start)
+    : m_length(parent.m_length - start)
+    , m_substring(true)
+{
+    VERIFY(!parent.m_substring);
+    VERIFY(start <= parent.m_length);
+    parent.ref();
+    SubstringData data { &parent, parent.characters() + start };
+    __builtin_memcpy(&m_inline_buffer[0], &data, sizeof(data));
+}
+
 StringImpl::~StringImpl()
 {
     if (m_fly)
         DeprecatedFlyString::did_destroy_impl({}, *this);
+    if (m_substring)
+        substring_data().parent->unref();
+}
+
+NonnullRefPtr<StringImpl> StringImpl::create_suffix_of(StringImpl const& parent, size_t start)
+{
+    // Substrings of substrings share the outermost parent, so chains never
+    // form and at most one extra impl is kept alive.
+    if (parent.m_substring) {
+        auto data = parent.substring_data();
+        return create_suffix_of(*data.parent, (data.characters - data.parent->characters()) + start);
+    }
+    void* slot = kmalloc(allocation_size_for_substring_stringimpl());
+    VERIFY(slot);
+    return adopt_ref(*new (slot) StringImpl(ConstructSubstring, parent, start));
 }
 
 NonnullRefPtr<StringImpl> StringImpl::create_uninitialized(size_t length, char*& buffer)
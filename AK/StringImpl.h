@@ -25,6 +25,9 @@ size_t allocation_size_for_stringimpl(size_t length);
 class StringImpl : public RefCounted<StringImpl> {
 public:
     static NonnullRefPtr<StringImpl> create_uninitialized(size_t length, char*& buffer);
+    // Shares the parent's character buffer instead of copying; only suffixes
+    // can be shared since characters() must stay NUL-terminated.
+    static NonnullRefPtr<StringImpl> create_suffix_of(StringImpl const& parent, size_t start);
     static RefPtr<StringImpl> create(char const* cstring, ShouldChomp = NoChomp);
     static RefPtr<StringImpl> create(char const* cstring, size_t length, ShouldChomp = NoChomp);
     static RefPtr<StringImpl> create(ReadonlyBytes, ShouldChomp = NoChomp);
@@ -36,7 +39,16 @@ public:
 
     void operator delete(void* ptr)
     {
-        kfree_sized(ptr, allocation_size_for_stringimpl(static_cast<StringImpl*>(ptr)->m_length));
+        auto* impl = static_cast<StringImpl*>(ptr);
+        if (impl->m_substring)
+            kfree_sized(ptr, allocation_size_for_substring_stringimpl());
+        else
+            kfree_sized(ptr, allocation_size_for_stringimpl(impl->m_length));
+    }
+
+    static size_t allocation_size_for_substring_stringimpl()
+    {
+        return sizeof(StringImpl) + sizeof(SubstringData);
     }
 
     static StringImpl& the_empty_stringimpl();
@@ -45,7 +57,12 @@ public:
 
     size_t length() const { return m_length; }
     // Includes NUL-terminator.
-    char const* characters() const { return &m_inline_buffer[0]; }
+    char const* characters() const
+    {
+        if (m_substring) [[unlikely]]
+            return substring_data().characters;
+        return &m_inline_buffer[0];
+    }
 
     ALWAYS_INLINE ReadonlyBytes bytes() const { return { characters(), length() }; }
     ALWAYS_INLINE StringView view() const { return { characters(), length() }; }
@@ -95,12 +112,32 @@ private:
     };
     StringImpl(ConstructWithInlineBufferTag, size_t length);
 
+    enum ConstructSubstringTag {
+        ConstructSubstring
+    };
+    StringImpl(ConstructSubstringTag, StringImpl const& parent, size_t start);
+
+    // Substring impls carry no inline characters; the flexible array area
+    // holds a pointer to the (retained) parent and into its buffer instead.
+    struct SubstringData {
+        StringImpl const* parent;
+        char const* characters;
+    };
+
+    SubstringData substring_data() const
+    {
+        SubstringData data;
+        __builtin_memcpy(&data, &m_inline_buffer[0], sizeof(data));
+        return data;
+    }
+
     void compute_hash() const;
 
     size_t m_length { 0 };
     mutable unsigned m_hash { 0 };
     mutable bool m_has_hash { false };
     mutable bool m_fly { false };
+    bool m_substring { false };
     char m_inline_buffer[0];
 };
 
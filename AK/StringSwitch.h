@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Optional.h>
+#include <AK/Platform.h>
+#include <AK/StringView.h>
+#include <AK/Types.h>
+
+namespace AK {
+
+template<typename T>
+struct StringSwitchCase {
+    StringView key;
+    T value;
+};
+
+namespace Detail {
+
+constexpr u32 string_switch_hash(u32 seed, StringView string)
+{
+    // FNV-1a, except the basis is a per-table seed chosen at compile time.
+    u32 hash = seed;
+    for (char c : string)
+        hash = (hash ^ static_cast<u8>(c)) * 0x01000193u;
+    return hash;
+}
+
+constexpr size_t string_switch_table_size(size_t case_count)
+{
+    // Keep the table at most 1/8th full so that a collision-free seed is
+    // found after only a handful of attempts; the slots are just u32
+    // indices, so the space cost is negligible.
+    size_t size = 8;
+    while (size < case_count * 8)
+        size *= 2;
+    return size;
+}
+
+}
+
+// A perfect-hash "string switch": given a fixed set of string keys at compile
+// time, this searches for a hash seed that maps every key to its own slot, so
+// a lookup is one hash, one table load, and one comparison against the sole
+// candidate key. Use it for hot keyword/tag-name style dispatch where a
+// HashMap would probe and compare against multiple entries:
+//
+//     static constexpr auto switcher = StringSwitch {
+//         StringSwitchCase { "foo"sv, Foo },
+//         StringSwitchCase { "bar"sv, Bar },
+//     };
+//     if (auto value = switcher.get(name); value.has_value())
+//         ...
+//
+// The keys must be distinct; construction fails to compile otherwise.
+template<typename T, size_t case_count>
+class StringSwitch {
+public:
+    template<typename... CaseTypes>
+    requires(sizeof...(CaseTypes) == case_count)
+    consteval StringSwitch(CaseTypes... cases)
+        : m_cases { cases... }
+    {
+        for (size_t i = 0; i < case_count; ++i) {
+            for (size_t j = i + 1; j < case_count; ++j)
+                VERIFY(m_cases[i].key != m_cases[j].key);
+        }
+        // A load factor this low makes each seed succeed with high
+        // probability, so this loop terminates quickly in practice; the
+        // bound only exists to turn pathological inputs into a compile
+        // error instead of an endless compilation.
+        for (u32 seed = 1; seed < 1'000'000; ++seed) {
+            if (try_build_table(seed)) {
+                m_seed = seed;
+                return;
+            }
+        }
+        VERIFY_NOT_REACHED();
+    }
+
+    ALWAYS_INLINE Optional<T> get(StringView string) const
+    {
+        auto entry_index = m_table[Detail::string_switch_hash(m_seed, string) & (table_size - 1)];
+        if (entry_index == 0)
+            return {};
+        auto const& entry = m_cases[entry_index - 1];
+        if (entry.key != string)
+            return {};
+        return entry.value;
+    }
+
+    ALWAYS_INLINE bool has(StringView string) const { return get(string).has_value(); }
+
+private:
+    static constexpr size_t table_size = Detail::string_switch_table_size(case_count);
+
+    consteval bool try_build_table(u32 seed)
+    {
+        for (auto& slot : m_table)
+            slot = 0;
+        for (size_t i = 0; i < case_count; ++i) {
+            auto& slot = m_table[Detail::string_switch_hash(seed, m_cases[i].key) & (table_size - 1)];
+            if (slot != 0)
+                return false;
+            slot = static_cast<u32>(i + 1);
+        }
+        return true;
+    }
+
+    StringSwitchCase<T> m_cases[case_count];
+    // Each slot holds 1 + the index of the case it belongs to; 0 means empty.
+    u32 m_table[table_size] {};
+    u32 m_seed { 0 };
+};
+
+template<typename T, typename... Rest>
+StringSwitch(StringSwitchCase<T>, Rest...) -> StringSwitch<T, 1 + sizeof...(Rest)>;
+
+}
+
+#if USING_AK_GLOBALLY
+using AK::StringSwitch;
+using AK::StringSwitchCase;
+#endif
@@ -11,6 +11,11 @@
 #include <AK/Format.h>
 #include <AK/Utf8View.h>
 
+#if !defined(KERNEL) && (defined(__SSE2__) || defined(__ARM_NEON) || defined(__ARM_NEON__))
+#    define AK_UTF8_VIEW_USE_SIMD 1
+#    include <AK/SIMD.h>
+#endif
+
 namespace AK {
 
 Utf8CodePointIterator Utf8View::iterator_at_byte_offset(size_t byte_offset) const
@@ -103,10 +108,46 @@ static inline bool decode_first_byte(
     return false;
 }
 
+// Returns how many leading bytes of data[0..byte_count) are plain ASCII,
+// checking 16 bytes at a time where the target supports it and a machine word
+// at a time otherwise.
+static size_t length_of_ascii_run(u8 const* data, size_t byte_count)
+{
+    size_t i = 0;
+#ifdef AK_UTF8_VIEW_USE_SIMD
+    while (i + 16 <= byte_count) {
+        SIMD::u8x16 bytes;
+        __builtin_memcpy(&bytes, data + i, 16);
+        auto high_bits = (SIMD::u64x2)(bytes & 0x80);
+        if (high_bits[0] != 0 || high_bits[1] != 0)
+            break;
+        i += 16;
+    }
+#else
+    while (i + sizeof(size_t) <= byte_count) {
+        size_t word;
+        __builtin_memcpy(&word, data + i, sizeof(word));
+        if (word & (explode_byte(0x80)))
+            break;
+        i += sizeof(size_t);
+    }
+#endif
+    while (i < byte_count && !(data[i] & 0x80))
+        ++i;
+    return i;
+}
+
 bool Utf8View::validate(size_t& valid_bytes) const
 {
     valid_bytes = 0;
     for (auto ptr = begin_ptr(); ptr < end_ptr(); ptr++) {
+        // Runs of ASCII bytes are always valid; skip them in bulk.
+        if (!(*ptr & 0x80)) {
+            size_t ascii_run = length_of_ascii_run(ptr, end_ptr() - ptr);
+            valid_bytes += ascii_run;
+            ptr += ascii_run - 1;
+            continue;
+        }
         size_t code_point_length_in_bytes = 0;
         u32 code_point = 0;
         bool first_byte_makes_sense = decode_first_byte(*ptr, code_point_length_in_bytes, code_point);
@@ -136,7 +177,19 @@ bool Utf8View::validate(size_t& valid_bytes) const
 size_t Utf8View::calculate_length() const
 {
     size_t length = 0;
-    for ([[maybe_unused]] auto code_point : *this) {
+    auto const* ptr = begin_ptr();
+    auto const* end = end_ptr();
+    while (ptr < end) {
+        // Each byte of an ASCII run is one code point; count them in bulk.
+        if (!(*ptr & 0x80)) {
+            size_t ascii_run = length_of_ascii_run(ptr, end - ptr);
+            length += ascii_run;
+            ptr += ascii_run;
+            continue;
+        }
+        // Advance exactly like Utf8CodePointIterator does, so malformed
+        // sequences still count the same number of replacement characters.
+        ptr += Utf8CodePointIterator(ptr, end - ptr).underlying_code_point_length_in_bytes();
         ++length;
     }
     return length;
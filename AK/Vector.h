@@ -646,13 +646,34 @@ public:
     {
         if (m_capacity >= needed_capacity)
             return {};
-        size_t new_capacity = kmalloc_good_size(needed_capacity * sizeof(StorageType)) / sizeof(StorageType);
+        size_t new_capacity_in_bytes = kmalloc_good_size(needed_capacity * sizeof(StorageType));
+        size_t new_capacity = new_capacity_in_bytes / sizeof(StorageType);
+#ifndef KERNEL
+        if constexpr (Traits<StorageType>::is_trivial()) {
+            // Trivial elements don't need to be moved one at a time, so let
+            // the allocator grow the existing block instead; it can do that
+            // in place whenever the new size still fits the size class of
+            // the current allocation.
+            if (m_outline_buffer) {
+                auto* new_buffer = static_cast<StorageType*>(krealloc(m_outline_buffer, new_capacity_in_bytes));
+                if (new_buffer == nullptr)
+                    return Error::from_errno(ENOMEM);
+                m_outline_buffer = new_buffer;
+                m_capacity = new_capacity;
+                return {};
+            }
+        }
+#endif
         auto* new_buffer = static_cast<StorageType*>(kmalloc_array(new_capacity, sizeof(StorageType)));
         if (new_buffer == nullptr)
             return Error::from_errno(ENOMEM);
 
         if constexpr (Traits<StorageType>::is_trivial()) {
-            TypedTransfer<StorageType>::copy(new_buffer, data(), m_size);
+            // The buffer can only be null while the vector is empty, but GCC
+            // cannot see that invariant, so spell it out to keep -Wnonnull
+            // quiet.
+            if (auto* old_buffer = data(); old_buffer != nullptr)
+                TypedTransfer<StorageType>::copy(new_buffer, old_buffer, m_size);
         } else {
             for (size_t i = 0; i < m_size; ++i) {
                 new (&new_buffer[i]) StorageType(move(at(i)));
@@ -19,6 +19,7 @@
 #    define kcalloc calloc
 #    define kmalloc malloc
 #    define kmalloc_good_size malloc_good_size
+#    define krealloc realloc
 
 inline void kfree_sized(void* ptr, size_t)
 {
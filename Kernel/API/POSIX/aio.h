@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <Kernel/API/POSIX/sys/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LIO_NOP 0
+#define LIO_READ 1
+#define LIO_WRITE 2
+
+#define AIO_ALLDONE 0
+#define AIO_CANCELED 1
+#define AIO_NOTCANCELED 2
+
+struct aiocb {
+    int aio_fildes;
+    off_t aio_offset;
+    volatile void* aio_buf;
+    size_t aio_nbytes;
+    int aio_lio_opcode;
+};
+
+#ifdef __cplusplus
+}
+#endif
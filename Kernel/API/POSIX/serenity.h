@@ -37,6 +37,12 @@ enum {
 
 #define PERF_EVENT_MASK_ALL (~0ull)
 
+struct perf_counters_info {
+    uint64_t cycles;
+    uint64_t instructions_retired;
+    uint64_t cache_misses;
+};
+
 #define THREAD_PRIORITY_MIN 1
 #define THREAD_PRIORITY_LOW 10
 #define THREAD_PRIORITY_NORMAL 30
@@ -70,6 +70,7 @@ typedef struct __pthread_mutex_t {
     pthread_t owner;
     int level;
     int type;
+    uint32_t contention_count;
 } pthread_mutex_t;
 
 typedef void* pthread_attr_t;
@@ -13,6 +13,7 @@
 constexpr int syscall_vector = 0x82;
 
 extern "C" {
+struct aiocb;
 struct pollfd;
 struct timeval;
 struct timespec;
@@ -42,6 +43,9 @@ enum class NeedsBigProcessLock {
 #define ENUMERATE_SYSCALLS(S)                               \
     S(accept4, NeedsBigProcessLock::No)                     \
     S(adjtime, NeedsBigProcessLock::No)                     \
+    S(aio_error, NeedsBigProcessLock::No)                   \
+    S(aio_return, NeedsBigProcessLock::No)                  \
+    S(aio_submit, NeedsBigProcessLock::No)                  \
     S(alarm, NeedsBigProcessLock::Yes)                      \
     S(allocate_tls, NeedsBigProcessLock::Yes)               \
     S(anon_create, NeedsBigProcessLock::No)                 \
@@ -128,6 +132,7 @@ enum class NeedsBigProcessLock {
     S(msync, NeedsBigProcessLock::Yes)                      \
     S(munmap, NeedsBigProcessLock::Yes)                     \
     S(open, NeedsBigProcessLock::Yes)                       \
+    S(perf_counters, NeedsBigProcessLock::No)               \
     S(perf_event, NeedsBigProcessLock::Yes)                 \
     S(perf_register_string, NeedsBigProcessLock::Yes)       \
     S(pipe, NeedsBigProcessLock::No)                        \
@@ -146,12 +151,15 @@ enum class NeedsBigProcessLock {
     S(readv, NeedsBigProcessLock::Yes)                      \
     S(realpath, NeedsBigProcessLock::No)                    \
     S(recvfd, NeedsBigProcessLock::No)                      \
+    S(recvmmsg, NeedsBigProcessLock::Yes)                   \
     S(recvmsg, NeedsBigProcessLock::Yes)                    \
     S(rename, NeedsBigProcessLock::No)                      \
     S(rmdir, NeedsBigProcessLock::No)                       \
     S(scheduler_get_parameters, NeedsBigProcessLock::No)    \
     S(scheduler_set_parameters, NeedsBigProcessLock::No)    \
     S(sendfd, NeedsBigProcessLock::No)                      \
+    S(sendfile, NeedsBigProcessLock::Yes)                   \
+    S(sendmmsg, NeedsBigProcessLock::Yes)                   \
     S(sendmsg, NeedsBigProcessLock::Yes)                    \
     S(set_coredump_metadata, NeedsBigProcessLock::No)       \
     S(set_mmap_name, NeedsBigProcessLock::Yes)              \
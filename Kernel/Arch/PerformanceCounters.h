@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Types.h>
+
+namespace Kernel {
+
+// A reading of the hardware performance counters on the current processor.
+// Counters the processor doesn't support always read as zero.
+struct PerformanceCounterSnapshot {
+    u64 cycles { 0 };
+    u64 instructions_retired { 0 };
+    u64 cache_misses { 0 };
+};
+
+namespace PerformanceCounters {
+
+void initialize_current_processor();
+bool is_supported();
+PerformanceCounterSnapshot read_current_processor();
+
+// Computes end - begin per counter, accounting for the hardware counter
+// width. Both snapshots must come from the same processor.
+PerformanceCounterSnapshot delta(PerformanceCounterSnapshot const& begin, PerformanceCounterSnapshot const& end);
+
+}
+
+}
@@ -8,6 +8,7 @@
 #include <AK/Types.h>
 
 #include <Kernel/Arch/Delay.h>
+#include <Kernel/Arch/PerformanceCounters.h>
 #include <Kernel/Process.h>
 #include <Kernel/Sections.h>
 #include <Kernel/kstdio.h>
@@ -38,6 +39,30 @@ void microseconds_delay(u32)
 
 }
 
+// PerformanceCounters.cpp
+namespace Kernel::PerformanceCounters {
+
+void initialize_current_processor()
+{
+}
+
+bool is_supported()
+{
+    return false;
+}
+
+PerformanceCounterSnapshot read_current_processor()
+{
+    return {};
+}
+
+PerformanceCounterSnapshot delta(PerformanceCounterSnapshot const&, PerformanceCounterSnapshot const&)
+{
+    return {};
+}
+
+}
+
 // Initializer.cpp
 namespace Kernel::PCI {
 
@@ -87,6 +87,13 @@ u32 Processor::smp_wake_n_idle_processors(u32 wake_count)
     return 0;
 }
 
+bool Processor::smp_wake_idle_processor(u32 cpu)
+{
+    (void)cpu;
+    // FIXME: Actually wake up other cores when SMP is supported for aarch64.
+    return false;
+}
+
 void Processor::initialize_context_switching(Thread& initial_thread)
 {
     VERIFY(initial_thread.process().is_kernel_process());
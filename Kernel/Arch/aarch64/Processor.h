@@ -267,6 +267,7 @@ public:
     }
 
     static u32 smp_wake_n_idle_processors(u32 wake_count);
+    static bool smp_wake_idle_processor(u32 cpu);
 
     [[noreturn]] static void halt();
 
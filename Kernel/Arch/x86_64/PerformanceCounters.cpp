@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <Kernel/Arch/PerformanceCounters.h>
+#include <Kernel/Arch/x86_64/CPUID.h>
+#include <Kernel/Arch/x86_64/MSR.h>
+#include <Kernel/Sections.h>
+
+namespace Kernel::PerformanceCounters {
+
+static constexpr u32 msr_ia32_pmc0 = 0xc1;
+static constexpr u32 msr_ia32_perfevtsel0 = 0x186;
+static constexpr u32 msr_ia32_fixed_ctr0 = 0x309; // Instructions retired
+static constexpr u32 msr_ia32_fixed_ctr1 = 0x30a; // Unhalted core cycles
+static constexpr u32 msr_ia32_fixed_ctr_ctrl = 0x38d;
+static constexpr u32 msr_ia32_perf_global_ctrl = 0x38f;
+
+static bool s_has_fixed_counters { false };
+static bool s_has_cache_miss_counter { false };
+static u64 s_fixed_counter_mask { 0 };
+static u64 s_general_counter_mask { 0 };
+
+static u64 counter_mask_for_width(u8 width)
+{
+    if (width >= 64)
+        return ~0ull;
+    return (1ull << width) - 1;
+}
+
+UNMAP_AFTER_INIT void initialize_current_processor()
+{
+    // Intel SDM vol. 3, "Architectural Performance Monitoring": CPUID leaf
+    // 0xA reports the perfmon version and counter geometry. AMD and most
+    // virtualized processors report version 0 and are left alone.
+    CPUID perfmon(0xa);
+    u8 const version = perfmon.eax() & 0xff;
+    if (version == 0)
+        return;
+
+    u8 const general_counter_count = (perfmon.eax() >> 8) & 0xff;
+    u8 const general_counter_width = (perfmon.eax() >> 16) & 0xff;
+    u8 const fixed_counter_count = version >= 2 ? (perfmon.edx() & 0x1f) : 0;
+    u8 const fixed_counter_width = version >= 2 ? ((perfmon.edx() >> 5) & 0xff) : 0;
+
+    u64 global_ctrl_bits = 0;
+
+    if (fixed_counter_count >= 2) {
+        s_has_fixed_counters = true;
+        s_fixed_counter_mask = counter_mask_for_width(fixed_counter_width);
+        // Count in both ring 0 and ring 3 on fixed counters 0 and 1.
+        MSR(msr_ia32_fixed_ctr_ctrl).set(0b011 | (0b011 << 4));
+        global_ctrl_bits |= (1ull << 32) | (1ull << 33);
+    }
+
+    // The architectural "LLC Misses" event (0x2e/0x41); EBX bit 4 is set
+    // when a processor doesn't implement it.
+    bool const llc_miss_event_available = (perfmon.ebx() & (1 << 4)) == 0;
+    if (general_counter_count >= 1 && llc_miss_event_available) {
+        s_has_cache_miss_counter = true;
+        s_general_counter_mask = counter_mask_for_width(general_counter_width);
+        u64 const event_select = 0x2e | (0x41 << 8) | (1 << 16) | (1 << 17) | (1 << 22); // USR | OS | EN
+        MSR(msr_ia32_perfevtsel0).set(event_select);
+        global_ctrl_bits |= 1;
+    }
+
+    if (global_ctrl_bits != 0) {
+        MSR global_ctrl(msr_ia32_perf_global_ctrl);
+        global_ctrl.set(global_ctrl.get() | global_ctrl_bits);
+    }
+}
+
+bool is_supported()
+{
+    return s_has_fixed_counters || s_has_cache_miss_counter;
+}
+
+PerformanceCounterSnapshot read_current_processor()
+{
+    PerformanceCounterSnapshot snapshot;
+    if (s_has_fixed_counters) {
+        snapshot.instructions_retired = MSR(msr_ia32_fixed_ctr0).get() & s_fixed_counter_mask;
+        snapshot.cycles = MSR(msr_ia32_fixed_ctr1).get() & s_fixed_counter_mask;
+    }
+    if (s_has_cache_miss_counter)
+        snapshot.cache_misses = MSR(msr_ia32_pmc0).get() & s_general_counter_mask;
+    return snapshot;
+}
+
+PerformanceCounterSnapshot delta(PerformanceCounterSnapshot const& begin, PerformanceCounterSnapshot const& end)
+{
+    PerformanceCounterSnapshot result;
+    if (s_has_fixed_counters) {
+        result.cycles = (end.cycles - begin.cycles) & s_fixed_counter_mask;
+        result.instructions_retired = (end.instructions_retired - begin.instructions_retired) & s_fixed_counter_mask;
+    }
+    if (s_has_cache_miss_counter)
+        result.cache_misses = (end.cache_misses - begin.cache_misses) & s_general_counter_mask;
+    return result;
+}
+
+}
@@ -22,6 +22,7 @@
 #include <Kernel/Thread.h>
 
 #include <Kernel/Arch/Interrupts.h>
+#include <Kernel/Arch/PerformanceCounters.h>
 #include <Kernel/Arch/Processor.h>
 #include <Kernel/Arch/SafeMem.h>
 #include <Kernel/Arch/TrapFrame.h>
@@ -675,6 +676,8 @@ UNMAP_AFTER_INIT void Processor::initialize(u32 cpu)
             detect_hypervisor();
     }
 
+    PerformanceCounters::initialize_current_processor();
+
     {
         // We need to prevent races between APs starting up at the same time
         VERIFY(cpu < s_processors.size());
@@ -995,6 +998,16 @@ void Processor::check_invoke_scheduler()
 
 void Processor::flush_tlb_local(VirtualAddress vaddr, size_t page_count)
 {
+    // Beyond a few dozen pages, reloading CR3 is cheaper than issuing an
+    // invlpg per page. That throws away all non-global translations, and
+    // kernel mappings are marked global, so this shortcut only applies to
+    // user ranges.
+    static constexpr size_t full_flush_threshold = 64;
+    if (page_count >= full_flush_threshold && Memory::is_user_range(vaddr, page_count * PAGE_SIZE)) {
+        write_cr3(read_cr3());
+        return;
+    }
+
     auto ptr = vaddr.as_ptr();
     while (page_count > 0) {
         // clang-format off
@@ -1055,6 +1068,25 @@ ProcessorMessage& Processor::smp_get_from_pool()
     return *msg;
 }
 
+bool Processor::smp_wake_idle_processor(u32 cpu)
+{
+    VERIFY_INTERRUPTS_DISABLED();
+    if (!s_smp_enabled || cpu >= Processor::count() || cpu == Processor::current_id())
+        return false;
+
+    u32 cpu_mask = 1u << cpu;
+    if (!(s_idle_cpu_mask.load(AK::MemoryOrder::memory_order_relaxed) & cpu_mask))
+        return false;
+
+    // Try to flip the CPU to busy; if someone else got there first they will
+    // also have sent the wakeup IPI.
+    if (!(s_idle_cpu_mask.fetch_and(~cpu_mask, AK::MemoryOrder::memory_order_acq_rel) & cpu_mask))
+        return false;
+
+    APIC::the().send_ipi(cpu);
+    return true;
+}
+
 u32 Processor::smp_wake_n_idle_processors(u32 wake_count)
 {
     VERIFY_INTERRUPTS_DISABLED();
@@ -57,6 +57,7 @@
 #include <Kernel/TTY/VirtualConsole.h>
 #include <Kernel/Tasks/FinalizerTask.h>
 #include <Kernel/Tasks/SyncTask.h>
+#include <Kernel/Tasks/ZeroPageTask.h>
 #include <Kernel/Time/TimeManagement.h>
 #include <Kernel/WorkQueue.h>
 #include <Kernel/kstdio.h>
@@ -289,6 +290,38 @@ extern "C" UNMAP_AFTER_INIT void init_finished(u32 cpu)
     }
 }
 
+static Atomic<size_t> s_pending_driver_probes;
+
+// NOTE: This function is deliberately not UNMAP_AFTER_INIT: a probe process
+//       may still be executing it (between the counter decrement and
+//       sys$exit) when init_stage2 proceeds to unmap init-only memory.
+[[noreturn]] static void driver_probe_process(void* data)
+{
+    auto probe = reinterpret_cast<void (*)()>(data);
+    probe();
+    s_pending_driver_probes.fetch_sub(1);
+    Process::current().sys$exit(0);
+    VERIFY_NOT_REACHED();
+}
+
+UNMAP_AFTER_INIT static void spawn_driver_probe(StringView name, void (*probe)())
+{
+    s_pending_driver_probes.fetch_add(1);
+    LockRefPtr<Thread> probe_thread;
+    auto process = Process::create_kernel_process(probe_thread, KString::must_create(name), driver_probe_process, reinterpret_cast<void*>(probe));
+    if (!process) {
+        // If we're too short on memory to spawn a process, just probe synchronously.
+        probe();
+        s_pending_driver_probes.fetch_sub(1);
+    }
+}
+
+UNMAP_AFTER_INIT static void wait_for_driver_probes()
+{
+    while (s_pending_driver_probes.load() != 0)
+        Scheduler::yield();
+}
+
 void init_stage2(void*)
 {
     // This is a little bit of a hack. We can't register our process at the time we're
@@ -328,19 +361,25 @@ void init_stage2(void*)
 
     SyncTask::spawn();
     FinalizerTask::spawn();
+    ZeroPageTask::spawn();
 
     auto boot_profiling = kernel_command_line().is_boot_profiling_enabled();
 
-    if (!PCI::Access::is_disabled()) {
-        USB::USBManagement::initialize();
-    }
     FirmwareSysFSDirectory::initialize();
 
     if (!PCI::Access::is_disabled()) {
         VirtIO::detect();
     }
 
-    NetworkingManagement::the().initialize();
+    // Nothing else in init_stage2 depends on USB, networking or audio, so
+    // probe them in parallel kernel processes instead of serializing their
+    // controller waits with the storage bring-up below. NetworkTask is only
+    // spawned after all probes have been waited for.
+    if (!PCI::Access::is_disabled())
+        spawn_driver_probe("USB Driver Probe"sv, [] { USB::USBManagement::initialize(); });
+    spawn_driver_probe("Network Driver Probe"sv, [] { NetworkingManagement::the().initialize(); });
+    spawn_driver_probe("Audio Driver Probe"sv, [] { AudioManagement::the().initialize(); });
+
     Syscall::initialize();
 
 #ifdef ENABLE_KERNEL_COVERAGE_COLLECTION
@@ -353,13 +392,15 @@ void init_stage2(void*)
     (void)SelfTTYDevice::must_create().leak_ref();
     PTYMultiplexer::initialize();
 
-    AudioManagement::the().initialize();
-
     StorageManagement::the().initialize(kernel_command_line().root_device(), kernel_command_line().is_force_pio(), kernel_command_line().is_nvme_polling_enabled());
     if (VirtualFileSystem::the().mount_root(StorageManagement::the().root_filesystem()).is_error()) {
         PANIC("VirtualFileSystem::mount_root failed");
     }
 
+    // All driver probe processes have to finish before we protect and unmap
+    // init-only memory below, as the probes execute UNMAP_AFTER_INIT code.
+    wait_for_driver_probes();
+
     // Switch out of early boot mode.
     g_in_early_boot = false;
 
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/AtomicRefCounted.h>
+#include <AK/Error.h>
+#include <AK/Types.h>
+#include <Kernel/Library/LockRefPtr.h>
+#include <Kernel/Locking/Spinlock.h>
+
+namespace Kernel {
+
+class OpenFileDescription;
+class Process;
+
+// An asynchronous file I/O operation submitted via sys$aio_submit. The
+// actual read or write runs on the IO work queue, whose kernel thread
+// switches into the submitting process's address space for the duration of
+// the transfer, so the submitting thread stays runnable while the request is
+// in flight.
+class AsyncIORequest final : public AtomicRefCounted<AsyncIORequest> {
+public:
+    enum class Operation {
+        Read,
+        Write,
+    };
+
+    static ErrorOr<NonnullLockRefPtr<AsyncIORequest>> try_create(Process&, NonnullLockRefPtr<OpenFileDescription>, Operation, FlatPtr user_buffer, size_t nbytes, off_t offset);
+    ~AsyncIORequest();
+
+    // Runs on the IO work queue.
+    void execute();
+
+    bool is_complete() const;
+    // Only valid once is_complete() returns true.
+    ErrorOr<size_t> result() const;
+
+private:
+    AsyncIORequest(Process&, NonnullLockRefPtr<OpenFileDescription>, Operation, FlatPtr user_buffer, size_t nbytes, off_t offset);
+
+    NonnullLockRefPtr<Process> m_process;
+    NonnullLockRefPtr<OpenFileDescription> m_description;
+    Operation m_operation { Operation::Read };
+    FlatPtr m_user_buffer { 0 };
+    size_t m_nbytes { 0 };
+    off_t m_offset { 0 };
+
+    mutable Spinlock<LockRank::None> m_lock {};
+    bool m_complete { false };
+    int m_error_code { 0 };
+    size_t m_bytes_transferred { 0 };
+};
+
+}
@@ -207,6 +207,11 @@ bool CommandLine::is_nvme_polling_enabled() const
     return contains("nvme_poll"sv);
 }
 
+bool CommandLine::is_nvme_interrupt_coalescing_disabled() const
+{
+    return lookup("nvme_irq_coalescing"sv).value_or("on"sv) == "off"sv;
+}
+
 UNMAP_AFTER_INIT AcpiFeatureLevel CommandLine::acpi_feature_level() const
 {
     auto value = kernel_command_line().lookup("acpi"sv).value_or("limited"sv);
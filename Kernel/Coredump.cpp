@@ -385,10 +385,13 @@ ErrorOr<void> Coredump::write()
 
     auto builder = TRY(KBufferBuilder::try_create());
     TRY(create_notes_segment_data(builder));
+    auto notes_segment = builder.build();
+    if (!notes_segment)
+        return ENOMEM;
     TRY(write_elf_header());
-    TRY(write_program_headers(builder.bytes().size()));
+    TRY(write_program_headers(notes_segment->size()));
     TRY(write_regions());
-    TRY(write_notes_segment(builder.bytes()));
+    TRY(write_notes_segment(notes_segment->bytes()));
 
     return m_description->chmod(Process::current().credentials(), 0600); // Make coredump file read/writable
 }
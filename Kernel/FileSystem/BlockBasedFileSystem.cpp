@@ -5,6 +5,8 @@
  */
 
 #include <AK/IntrusiveList.h>
+#include <AK/QuickSort.h>
+#include <AK/Vector.h>
 #include <Kernel/Debug.h>
 #include <Kernel/FileSystem/BlockBasedFileSystem.h>
 #include <Kernel/Process.h>
@@ -21,10 +23,18 @@ struct CacheEntry {
 class DiskCache {
 public:
     static constexpr size_t EntryCount = 10000;
-    explicit DiskCache(BlockBasedFileSystem& fs, NonnullOwnPtr<KBuffer> cached_block_data, NonnullOwnPtr<KBuffer> entries_buffer)
+    // How many blocks a single read-ahead I/O covers once sequential access
+    // is detected, and how many contiguous dirty blocks a single writeback
+    // I/O covers at most.
+    static constexpr size_t ReadAheadWindow = 8;
+    static constexpr size_t WriteBatchSize = 32;
+
+    explicit DiskCache(BlockBasedFileSystem& fs, NonnullOwnPtr<KBuffer> cached_block_data, NonnullOwnPtr<KBuffer> entries_buffer, NonnullOwnPtr<KBuffer> read_ahead_buffer, NonnullOwnPtr<KBuffer> write_staging_buffer)
         : m_fs(fs)
         , m_cached_block_data(move(cached_block_data))
         , m_entries(move(entries_buffer))
+        , m_read_ahead_buffer(move(read_ahead_buffer))
+        , m_write_staging_buffer(move(write_staging_buffer))
     {
         for (size_t i = 0; i < EntryCount; ++i) {
             entries()[i].data = m_cached_block_data->data() + i * m_fs->block_size();
@@ -89,6 +99,23 @@ public:
         return &new_entry;
     }
 
+    // Tracks whether reads are marching forward one block at a time.
+    // Returns true once the streak is long enough to justify read-ahead.
+    bool note_block_read(BlockBasedFileSystem::BlockIndex block_index) const
+    {
+        if (block_index.value() == m_next_expected_block) {
+            if (m_sequential_streak < 255)
+                ++m_sequential_streak;
+        } else {
+            m_sequential_streak = 0;
+        }
+        m_next_expected_block = block_index.value() + 1;
+        return m_sequential_streak >= 2;
+    }
+
+    u8* read_ahead_buffer() const { return m_read_ahead_buffer->data(); }
+    u8* write_staging_buffer() const { return m_write_staging_buffer->data(); }
+
     CacheEntry const* entries() const { return (CacheEntry const*)m_entries->data(); }
     CacheEntry* entries() { return (CacheEntry*)m_entries->data(); }
 
@@ -106,6 +133,10 @@ private:
     mutable HashMap<BlockBasedFileSystem::BlockIndex, CacheEntry*> m_hash;
     NonnullOwnPtr<KBuffer> m_cached_block_data;
     NonnullOwnPtr<KBuffer> m_entries;
+    NonnullOwnPtr<KBuffer> m_read_ahead_buffer;
+    NonnullOwnPtr<KBuffer> m_write_staging_buffer;
+    mutable u64 m_next_expected_block { 0 };
+    mutable u8 m_sequential_streak { 0 };
 };
 
 BlockBasedFileSystem::BlockBasedFileSystem(OpenFileDescription& file_description)
@@ -131,7 +162,9 @@ ErrorOr<void> BlockBasedFileSystem::initialize_while_locked()
     VERIFY(block_size() != 0);
     auto cached_block_data = TRY(KBuffer::try_create_with_size("BlockBasedFS: Cache blocks"sv, DiskCache::EntryCount * block_size()));
     auto entries_data = TRY(KBuffer::try_create_with_size("BlockBasedFS: Cache entries"sv, DiskCache::EntryCount * sizeof(CacheEntry)));
-    auto disk_cache = TRY(adopt_nonnull_own_or_enomem(new (nothrow) DiskCache(*this, move(cached_block_data), move(entries_data))));
+    auto read_ahead_buffer = TRY(KBuffer::try_create_with_size("BlockBasedFS: Read-ahead buffer"sv, DiskCache::ReadAheadWindow * block_size()));
+    auto write_staging_buffer = TRY(KBuffer::try_create_with_size("BlockBasedFS: Write staging buffer"sv, DiskCache::WriteBatchSize * block_size()));
+    auto disk_cache = TRY(adopt_nonnull_own_or_enomem(new (nothrow) DiskCache(*this, move(cached_block_data), move(entries_data), move(read_ahead_buffer), move(write_staging_buffer))));
 
     m_cache.with_exclusive([&](auto& cache) {
         cache = move(disk_cache);
@@ -235,13 +268,43 @@ ErrorOr<void> BlockBasedFileSystem::read_block(BlockIndex index, UserOrKernelBuf
             return {};
         }
 
+        bool should_read_ahead = cache->note_block_read(index);
         auto* entry = TRY(cache->ensure(index));
         if (!entry->has_data) {
             auto base_offset = index.value() * block_size();
-            auto entry_data_buffer = UserOrKernelBuffer::for_kernel_buffer(entry->data);
-            auto nread = TRY(file_description().read(entry_data_buffer, base_offset, block_size()));
-            VERIFY(nread == block_size());
-            entry->has_data = true;
+            if (should_read_ahead) {
+                // Sequential access: fetch a whole window of blocks with one
+                // I/O and distribute them into the cache, so the following
+                // reads are hits instead of single-block round trips.
+                auto read_ahead_data_buffer = UserOrKernelBuffer::for_kernel_buffer(cache->read_ahead_buffer());
+                auto nread_or_error = file_description().read(read_ahead_data_buffer, base_offset, DiskCache::ReadAheadWindow * block_size());
+                if (!nread_or_error.is_error() && nread_or_error.value() >= block_size()) {
+                    size_t complete_blocks = nread_or_error.value() / block_size();
+                    memcpy(entry->data, cache->read_ahead_buffer(), block_size());
+                    entry->has_data = true;
+                    for (size_t i = 1; i < complete_blocks; ++i) {
+                        auto ahead_entry_or_error = cache->ensure(BlockIndex { index.value() + i });
+                        if (ahead_entry_or_error.is_error())
+                            break;
+                        auto* ahead_entry = ahead_entry_or_error.value();
+                        // Never clobber an entry that already has data; it may
+                        // be dirty and newer than what's on disk.
+                        if (ahead_entry->has_data)
+                            continue;
+                        memcpy(ahead_entry->data, cache->read_ahead_buffer() + i * block_size(), block_size());
+                        ahead_entry->has_data = true;
+                    }
+                }
+                // On a short read or an error (e.g. the window extends past
+                // the end of the device), fall through to the single-block
+                // path below for the block that was actually asked for.
+            }
+            if (!entry->has_data) {
+                auto entry_data_buffer = UserOrKernelBuffer::for_kernel_buffer(entry->data);
+                auto nread = TRY(file_description().read(entry_data_buffer, base_offset, block_size()));
+                VERIFY(nread == block_size());
+                entry->has_data = true;
+            }
         }
         if (buffer)
             TRY(buffer->write(entry->data + offset, count));
@@ -287,12 +350,51 @@ void BlockBasedFileSystem::flush_writes_impl()
     m_cache.with_exclusive([&](auto& cache) {
         if (!cache->is_dirty())
             return;
-        cache->for_each_dirty_entry([&](CacheEntry& entry) {
+
+        auto write_single_entry = [&](CacheEntry& entry) {
             auto base_offset = entry.block_index.value() * block_size();
             auto entry_data_buffer = UserOrKernelBuffer::for_kernel_buffer(entry.data);
             [[maybe_unused]] auto rc = file_description().write(base_offset, entry_data_buffer, block_size());
             ++count;
-        });
+        };
+
+        // Sort the dirty entries by block index so runs of adjacent blocks
+        // (e.g. from a large sequential write) can go to disk as one I/O
+        // each instead of one per block.
+        size_t dirty_count = 0;
+        cache->for_each_dirty_entry([&](CacheEntry&) { ++dirty_count; });
+        Vector<CacheEntry*> dirty_entries;
+        if (dirty_entries.try_ensure_capacity(dirty_count).is_error()) {
+            cache->for_each_dirty_entry(write_single_entry);
+            cache->mark_all_clean();
+            dbgln("{}: Flushed {} blocks to disk", class_name(), count);
+            return;
+        }
+        cache->for_each_dirty_entry([&](CacheEntry& entry) { dirty_entries.unchecked_append(&entry); });
+        quick_sort(dirty_entries, [](auto* a, auto* b) { return a->block_index < b->block_index; });
+
+        size_t i = 0;
+        while (i < dirty_entries.size()) {
+            size_t run_length = 1;
+            while (i + run_length < dirty_entries.size()
+                && run_length < DiskCache::WriteBatchSize
+                && dirty_entries[i + run_length]->block_index.value() == dirty_entries[i]->block_index.value() + run_length)
+                ++run_length;
+
+            if (run_length == 1) {
+                write_single_entry(*dirty_entries[i]);
+            } else {
+                auto* staging = cache->write_staging_buffer();
+                for (size_t j = 0; j < run_length; ++j)
+                    memcpy(staging + j * block_size(), dirty_entries[i + j]->data, block_size());
+                auto base_offset = dirty_entries[i]->block_index.value() * block_size();
+                auto staging_buffer = UserOrKernelBuffer::for_kernel_buffer(staging);
+                [[maybe_unused]] auto rc = file_description().write(base_offset, staging_buffer, run_length * block_size());
+                count += run_length;
+            }
+            i += run_length;
+        }
+
         cache->mark_all_clean();
         dbgln("{}: Flushed {} blocks to disk", class_name(), count);
     });
@@ -91,6 +91,10 @@ ErrorOr<void> Ext2FS::initialize_while_locked()
         return EINVAL;
     }
 
+    TRY(m_group_largest_free_extent_bounds.try_resize(m_block_group_count));
+    for (auto& bound : m_group_largest_free_extent_bounds)
+        bound = blocks_per_group();
+
     auto blocks_to_read = ceil_div(m_block_group_count * sizeof(ext2_group_desc), block_size());
     BlockIndex first_block_of_bgdt = block_size() == 1024 ? 2 : 1;
     m_cached_group_descriptor_table = TRY(KBuffer::try_create_with_size("Ext2FS: Block group descriptors"sv, block_size() * blocks_to_read, Memory::Region::Access::ReadWrite));
@@ -233,28 +237,36 @@ auto Ext2FS::allocate_blocks(GroupIndex preferred_group_index, size_t count) ->
     TRY(blocks.try_ensure_capacity(count));
 
     MutexLocker locker(m_lock);
-    auto group_index = preferred_group_index;
 
-    if (!group_descriptor(preferred_group_index).bg_free_blocks_count) {
-        group_index = 1;
-    }
+    auto group_has_free_blocks = [&](GroupIndex group_index) {
+        return group_descriptor(group_index).bg_free_blocks_count > 0;
+    };
 
     while (blocks.size() < count) {
-        bool found_a_group = false;
-        if (group_descriptor(group_index).bg_free_blocks_count) {
-            found_a_group = true;
-        } else {
-            if (group_index == preferred_group_index)
-                group_index = 1;
-            for (; group_index <= m_block_group_count; group_index = GroupIndex { group_index.value() + 1 }) {
-                if (group_descriptor(group_index).bg_free_blocks_count) {
-                    found_a_group = true;
-                    break;
-                }
+        size_t remaining = count - blocks.size();
+        size_t wanted_extent = min(remaining, static_cast<size_t>(blocks_per_group()));
+
+        // Prefer a group whose summary says it may hold the remaining request
+        // as one extent, starting with the preferred group to keep file data
+        // close together; otherwise settle for any group with free blocks.
+        auto find_group = [&]() -> GroupIndex {
+            if (group_has_free_blocks(preferred_group_index) && largest_free_extent_bound(preferred_group_index) >= wanted_extent)
+                return preferred_group_index;
+            for (GroupIndex group_index = 1; group_index <= m_block_group_count; group_index = GroupIndex { group_index.value() + 1 }) {
+                if (group_has_free_blocks(group_index) && largest_free_extent_bound(group_index) >= wanted_extent)
+                    return group_index;
             }
-        }
+            if (group_has_free_blocks(preferred_group_index))
+                return preferred_group_index;
+            for (GroupIndex group_index = 1; group_index <= m_block_group_count; group_index = GroupIndex { group_index.value() + 1 }) {
+                if (group_has_free_blocks(group_index))
+                    return group_index;
+            }
+            return GroupIndex { 0 };
+        };
 
-        VERIFY(found_a_group);
+        auto group_index = find_group();
+        VERIFY(group_index != 0);
         auto const& bgd = group_descriptor(group_index);
 
         auto* cached_bitmap = TRY(get_bitmap_block(bgd.bg_block_bitmap));
@@ -264,12 +276,19 @@ auto Ext2FS::allocate_blocks(GroupIndex preferred_group_index, size_t count) ->
 
         BlockIndex first_block_in_group = (group_index.value() - 1) * blocks_per_group() + first_block_index().value();
         size_t free_region_size = 0;
-        auto first_unset_bit_index = block_bitmap.find_longest_range_of_unset_bits(count - blocks.size(), free_region_size);
+        auto first_unset_bit_index = block_bitmap.find_longest_range_of_unset_bits(remaining, free_region_size);
         VERIFY(first_unset_bit_index.has_value());
+
+        // If the longest free range is shorter than what we asked for, it is
+        // the group's actual largest free extent, and we are about to consume
+        // it, so anything left behind is no larger.
+        if (free_region_size < remaining)
+            set_largest_free_extent_bound(group_index, free_region_size);
+
         dbgln_if(EXT2_DEBUG, "Ext2FS: allocating free region of size: {} [{}]", free_region_size, group_index);
+        TRY(set_block_allocation_range_state(group_index, first_unset_bit_index.value(), free_region_size, true));
         for (size_t i = 0; i < free_region_size; ++i) {
             BlockIndex block_index = (first_unset_bit_index.value() + i) + first_block_in_group.value();
-            TRY(set_block_allocation_state(block_index, true));
             blocks.unchecked_append(block_index);
             dbgln_if(EXT2_DEBUG, "  allocated > {}", block_index);
         }
@@ -433,10 +452,60 @@ ErrorOr<void> Ext2FS::set_block_allocation_state(BlockIndex block_index, bool ne
     unsigned bit_index = index_in_group % blocks_per_group();
     auto& bgd = const_cast<ext2_group_desc&>(group_descriptor(group_index));
 
+    if (!new_state) {
+        // Freeing may merge free extents, so the group's summary becomes unknown.
+        set_largest_free_extent_bound(group_index, blocks_per_group());
+    }
+
     dbgln_if(EXT2_DEBUG, "Ext2FS: Block {} state -> {} (in bitmap block {})", block_index, new_state, bgd.bg_block_bitmap);
     return update_bitmap_block(bgd.bg_block_bitmap, bit_index, new_state, m_super_block.s_free_blocks_count, bgd.bg_free_blocks_count);
 }
 
+ErrorOr<void> Ext2FS::set_block_allocation_range_state(GroupIndex group_index, size_t first_bit_index, size_t count, bool new_state)
+{
+    VERIFY(m_lock.is_locked());
+    VERIFY(count > 0);
+
+    auto& bgd = const_cast<ext2_group_desc&>(group_descriptor(group_index));
+    auto* cached_bitmap = TRY(get_bitmap_block(bgd.bg_block_bitmap));
+    auto bitmap = cached_bitmap->bitmap(blocks_per_group());
+
+    // Verify the whole range before flipping anything, so a bogus range
+    // doesn't leave the bitmap and the free counters out of sync.
+    for (size_t i = 0; i < count; ++i) {
+        if (bitmap.get(first_bit_index + i) == new_state) {
+            dbgln("Ext2FS: Bit {} in bitmap block {} had unexpected state {}", first_bit_index + i, bgd.bg_block_bitmap, new_state);
+            return EIO;
+        }
+    }
+    for (size_t i = 0; i < count; ++i)
+        bitmap.set(first_bit_index + i, new_state);
+    cached_bitmap->dirty = true;
+
+    if (new_state) {
+        m_super_block.s_free_blocks_count -= count;
+        bgd.bg_free_blocks_count -= count;
+    } else {
+        m_super_block.s_free_blocks_count += count;
+        bgd.bg_free_blocks_count += count;
+        set_largest_free_extent_bound(group_index, blocks_per_group());
+    }
+
+    m_super_block_dirty = true;
+    m_block_group_descriptors_dirty = true;
+    return {};
+}
+
+size_t Ext2FS::largest_free_extent_bound(GroupIndex group_index) const
+{
+    return m_group_largest_free_extent_bounds[group_index.value() - 1];
+}
+
+void Ext2FS::set_largest_free_extent_bound(GroupIndex group_index, size_t bound)
+{
+    m_group_largest_free_extent_bounds[group_index.value() - 1] = bound;
+}
+
 ErrorOr<NonnullLockRefPtr<Inode>> Ext2FS::create_directory(Ext2FSInode& parent_inode, StringView name, mode_t mode, UserID uid, GroupID gid)
 {
     MutexLocker locker(m_lock);
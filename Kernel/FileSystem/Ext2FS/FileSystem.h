@@ -123,6 +123,17 @@ private:
 
     ErrorOr<CachedBitmap*> get_bitmap_block(BlockIndex);
     ErrorOr<void> update_bitmap_block(BlockIndex bitmap_block, size_t bit_index, bool new_state, u32& super_block_counter, u16& group_descriptor_counter);
+    ErrorOr<void> set_block_allocation_range_state(GroupIndex, size_t first_bit_index, size_t count, bool new_state);
+
+    // Upper bound on the largest free extent in each group, so the block
+    // allocator can skip groups that cannot satisfy a contiguous request
+    // without rescanning their bitmaps. Allocations only shrink extents, so
+    // they keep the bound valid; frees may merge extents and reset it to
+    // "unknown" (blocks_per_group()); scanning a bitmap tightens it.
+    size_t largest_free_extent_bound(GroupIndex) const;
+    void set_largest_free_extent_bound(GroupIndex, size_t);
+
+    Vector<size_t> m_group_largest_free_extent_bounds;
 
     Vector<OwnPtr<CachedBitmap>> m_cached_bitmaps;
     LockRefPtr<Ext2FSInode> m_root_inode;
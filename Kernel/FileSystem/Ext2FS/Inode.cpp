@@ -499,13 +499,11 @@ ErrorOr<void> Ext2FSInode::flush_metadata()
     MutexLocker locker(m_inode_lock);
     dbgln_if(EXT2_DEBUG, "Ext2FSInode[{}]::flush_metadata(): Flushing inode", identifier());
     TRY(fs().write_ext2_inode(index(), m_raw_inode));
-    if (is_directory()) {
-        // Unless we're about to go away permanently, invalidate the lookup cache.
-        if (m_raw_inode.i_links_count != 0) {
-            // FIXME: This invalidation is way too hardcore. It's sad to throw away the whole cache.
-            m_lookup_cache.clear();
-        }
-    }
+    // NOTE: The lookup cache stays coherent because every directory mutation
+    //       goes through add_child()/remove_child()/replace_child() on this
+    //       very inode, so there's no need to invalidate it here. Clearing it
+    //       on every writeback made each hot directory re-read itself from
+    //       disk after every periodic sync while files were being created.
     set_metadata_dirty(false);
     return {};
 }
@@ -834,10 +832,12 @@ ErrorOr<void> Ext2FSInode::add_child(Inode& child, StringView name, mode_t mode)
 
     dbgln_if(EXT2_DEBUG, "Ext2FSInode[{}]::add_child(): Adding inode {} with name '{}' and mode {:o} to directory {}", identifier(), child.index(), name, mode, index());
 
+    TRY(populate_lookup_cache());
+    if (m_lookup_cache.contains(name))
+        return EEXIST;
+
     Vector<Ext2FSDirectoryEntry> entries;
     TRY(traverse_as_directory([&](auto& entry) -> ErrorOr<void> {
-        if (name == entry.name)
-            return EEXIST;
         auto entry_name = TRY(KString::try_create(entry.name));
         TRY(entries.try_append({ move(entry_name), entry.inode.index(), entry.file_type }));
         return {};
@@ -849,7 +849,6 @@ ErrorOr<void> Ext2FSInode::add_child(Inode& child, StringView name, mode_t mode)
     TRY(entries.try_empend(move(entry_name), child.index(), to_ext2_file_type(mode)));
 
     TRY(write_directory(entries));
-    TRY(populate_lookup_cache());
 
     auto cache_entry_name = TRY(KString::try_create(name));
     TRY(m_lookup_cache.try_set(move(cache_entry_name), child.index()));
@@ -973,7 +972,25 @@ ErrorOr<NonnullLockRefPtr<Inode>> Ext2FSInode::lookup(StringView name)
     dbgln_if(EXT2_DEBUG, "Ext2FSInode[{}]:lookup(): Looking up '{}'", identifier(), name);
 
     InodeIndex inode_index;
+    bool found_in_cache = false;
+
+    // Once the cache is built, lookups only read it, so concurrent opens in
+    // the same directory can share the lock; building the cache on first use
+    // is the only part that needs exclusivity.
     {
+        MutexLocker locker(m_inode_lock, Mutex::Mode::Shared);
+        if (!m_lookup_cache.is_empty()) {
+            auto it = m_lookup_cache.find(name);
+            if (it == m_lookup_cache.end()) {
+                dbgln_if(EXT2_DEBUG, "Ext2FSInode[{}]:lookup(): '{}' not found", identifier(), name);
+                return ENOENT;
+            }
+            inode_index = it->value;
+            found_in_cache = true;
+        }
+    }
+
+    if (!found_in_cache) {
         MutexLocker locker(m_inode_lock);
         TRY(populate_lookup_cache());
         auto it = m_lookup_cache.find(name);
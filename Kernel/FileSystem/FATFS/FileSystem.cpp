@@ -91,4 +91,30 @@ BlockBasedFileSystem::BlockIndex FATFS::first_block_of_cluster(u32 cluster) cons
     return ((cluster - first_data_cluster) * boot_record()->sectors_per_cluster) + m_first_data_sector;
 }
 
+LockRefPtr<FATDirectoryExtent> FATFS::cached_directory_extent(u32 first_cluster)
+{
+    return m_directory_extent_cache.with([&](auto& cache) -> LockRefPtr<FATDirectoryExtent> {
+        auto it = cache.find(first_cluster);
+        if (it == cache.end()) {
+            dbgln_if(FAT_DEBUG, "FATFS: Directory extent cache miss for cluster {}", first_cluster);
+            return nullptr;
+        }
+        dbgln_if(FAT_DEBUG, "FATFS: Directory extent cache hit for cluster {}", first_cluster);
+        return it->value;
+    });
+}
+
+ErrorOr<NonnullLockRefPtr<FATDirectoryExtent>> FATFS::cache_directory_extent(u32 first_cluster, NonnullOwnPtr<KBuffer> contents)
+{
+    auto extent = TRY(FATDirectoryExtent::try_create(move(contents)));
+    m_directory_extent_cache.with([&](auto& cache) {
+        if (cache.size() == max_cached_directory_extents) {
+            // FIXME: A smarter eviction policy would probably be nicer.
+            cache.remove(cache.begin());
+        }
+        (void)cache.try_set(first_cluster, extent);
+    });
+    return extent;
+}
+
 }
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
 #include <AK/OwnPtr.h>
 #include <AK/RefPtr.h>
 #include <AK/Types.h>
@@ -14,9 +15,27 @@
 #include <Kernel/FileSystem/Inode.h>
 #include <Kernel/Forward.h>
 #include <Kernel/KBuffer.h>
+#include <Kernel/Locking/SpinlockProtected.h>
 
 namespace Kernel {
 
+// The contents of a directory's cluster chain, read in one go. Since the
+// driver has no write support yet, cached contents can never go stale.
+struct FATDirectoryExtent final : public AtomicRefCounted<FATDirectoryExtent> {
+    NonnullOwnPtr<KBuffer> contents;
+
+    static ErrorOr<NonnullLockRefPtr<FATDirectoryExtent>> try_create(NonnullOwnPtr<KBuffer> contents)
+    {
+        return adopt_nonnull_lock_ref_or_enomem(new (nothrow) FATDirectoryExtent(move(contents)));
+    }
+
+private:
+    explicit FATDirectoryExtent(NonnullOwnPtr<KBuffer> contents)
+        : contents(move(contents))
+    {
+    }
+};
+
 class FATFS final : public BlockBasedFileSystem {
     friend FATInode;
 
@@ -45,6 +64,13 @@ private:
 
     BlockBasedFileSystem::BlockIndex first_block_of_cluster(u32 cluster) const;
 
+    static constexpr size_t max_cached_directory_extents = 32;
+
+    LockRefPtr<FATDirectoryExtent> cached_directory_extent(u32 first_cluster);
+    ErrorOr<NonnullLockRefPtr<FATDirectoryExtent>> cache_directory_extent(u32 first_cluster, NonnullOwnPtr<KBuffer> contents);
+
+    SpinlockProtected<HashMap<u32, NonnullLockRefPtr<FATDirectoryExtent>>, LockRank::None> m_directory_extent_cache {};
+
     OwnPtr<KBuffer> m_boot_record {};
     LockRefPtr<FATInode> m_root_inode {};
     u32 m_first_data_sector { 0 };
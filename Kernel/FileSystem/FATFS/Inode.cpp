@@ -102,6 +102,18 @@ ErrorOr<NonnullOwnPtr<KBuffer>> FATInode::read_block_list()
     return blocks.release_nonnull();
 }
 
+ErrorOr<NonnullLockRefPtr<FATDirectoryExtent>> FATInode::directory_contents()
+{
+    VERIFY(m_inode_lock.is_locked());
+    VERIFY(has_flag(m_entry.attributes, FATAttributes::Directory));
+
+    if (auto extent = fs().cached_directory_extent(first_cluster()))
+        return extent.release_nonnull();
+
+    auto blocks = TRY(read_block_list());
+    return fs().cache_directory_extent(first_cluster(), move(blocks));
+}
+
 ErrorOr<void> FATInode::replace_child(StringView, Inode&)
 {
     // TODO: Implement this once we have write support.
@@ -113,7 +125,8 @@ ErrorOr<LockRefPtr<FATInode>> FATInode::traverse(Function<ErrorOr<bool>(LockRefP
     VERIFY(has_flag(m_entry.attributes, FATAttributes::Directory));
 
     Vector<FATLongFileNameEntry> lfn_entries;
-    auto blocks = TRY(read_block_list());
+    auto extent = TRY(directory_contents());
+    auto& blocks = extent->contents;
 
     for (u32 i = 0; i < blocks->size() / sizeof(FATEntry); i++) {
         auto* entry = reinterpret_cast<FATEntry*>(blocks->data() + i * sizeof(FATEntry));
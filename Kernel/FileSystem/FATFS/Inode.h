@@ -50,6 +50,7 @@ private:
 
     ErrorOr<Vector<BlockBasedFileSystem::BlockIndex>> compute_block_list();
     ErrorOr<NonnullOwnPtr<KBuffer>> read_block_list();
+    ErrorOr<NonnullLockRefPtr<FATDirectoryExtent>> directory_contents();
     ErrorOr<LockRefPtr<FATInode>> traverse(Function<ErrorOr<bool>(LockRefPtr<FATInode>)> callback);
     u32 first_cluster() const;
 
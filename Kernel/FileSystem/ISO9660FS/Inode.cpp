@@ -20,29 +20,23 @@ ErrorOr<size_t> ISO9660Inode::read_bytes_locked(off_t offset, size_t size, UserO
     if (static_cast<u64>(offset) >= data_length)
         return 0;
 
-    auto block = TRY(KBuffer::try_create_with_size("ISO9660FS: Inode read buffer"sv, fs().m_logical_block_size));
-    auto block_buffer = UserOrKernelBuffer::for_kernel_buffer(block->data());
-
     size_t total_bytes = min(size, data_length - offset);
-    size_t nread = 0;
     size_t blocks_already_read = offset / fs().m_logical_block_size;
     size_t initial_offset = offset % fs().m_logical_block_size;
+    size_t blocks_to_read = ceil_div(initial_offset + total_bytes, static_cast<size_t>(fs().m_logical_block_size));
 
-    auto current_block_index = BlockBasedFileSystem::BlockIndex { extent_location + blocks_already_read };
-    while (nread != total_bytes) {
-        size_t bytes_to_read = min(total_bytes - nread, fs().logical_block_size() - initial_offset);
-        auto buffer_offset = buffer.offset(nread);
-        dbgln_if(ISO9660_VERY_DEBUG, "ISO9660Inode::read_bytes: Reading {} bytes into buffer offset {}/{}, logical block index: {}", bytes_to_read, nread, total_bytes, current_block_index.value());
+    // Reading the whole span in one request lets the device see the
+    // sequential access instead of a series of single-block reads.
+    auto blocks = TRY(KBuffer::try_create_with_size("ISO9660FS: Inode read buffer"sv, blocks_to_read * fs().m_logical_block_size));
+    auto blocks_buffer = UserOrKernelBuffer::for_kernel_buffer(blocks->data());
 
-        TRY(const_cast<ISO9660FS&>(fs()).raw_read(current_block_index, block_buffer));
-        TRY(buffer_offset.write(block->data() + initial_offset, bytes_to_read));
+    auto first_block_index = BlockBasedFileSystem::BlockIndex { extent_location + blocks_already_read };
+    dbgln_if(ISO9660_VERY_DEBUG, "ISO9660Inode::read_bytes: Reading {} blocks starting at logical block index {}", blocks_to_read, first_block_index.value());
 
-        nread += bytes_to_read;
-        initial_offset = 0;
-        current_block_index = BlockBasedFileSystem::BlockIndex { current_block_index.value() + 1 };
-    }
+    TRY(const_cast<ISO9660FS&>(fs()).raw_read_blocks(first_block_index, blocks_to_read, blocks_buffer));
+    TRY(buffer.write(blocks->data() + initial_offset, total_bytes));
 
-    return nread;
+    return total_bytes;
 }
 
 InodeMetadata ISO9660Inode::metadata() const
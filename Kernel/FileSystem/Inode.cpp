@@ -34,19 +34,23 @@ void Inode::sync_all()
     NonnullLockRefPtrVector<Inode, 32> inodes;
     Inode::all_instances().with([&](auto& all_inodes) {
         for (auto& inode : all_inodes) {
-            if (inode.is_metadata_dirty())
+            if (inode.is_metadata_dirty() || inode.shared_vmobject())
                 inodes.append(inode);
         }
     });
 
     for (auto& inode : inodes) {
-        VERIFY(inode.is_metadata_dirty());
-        (void)inode.flush_metadata();
+        if (auto vmobject = inode.shared_vmobject())
+            (void)vmobject->sync();
+        if (inode.is_metadata_dirty())
+            (void)inode.flush_metadata();
     }
 }
 
 void Inode::sync()
 {
+    if (auto vmobject = shared_vmobject())
+        (void)vmobject->sync();
     if (is_metadata_dirty())
         (void)flush_metadata();
     fs().flush_writes();
@@ -217,6 +221,9 @@ void Inode::set_metadata_dirty(bool metadata_dirty)
 
 void Inode::did_add_child(InodeIdentifier, StringView name)
 {
+    // A negative directory cache entry for this name is now stale.
+    VirtualFileSystem::the().invalidate_directory_cache_entry({}, identifier(), name);
+
     m_watchers.for_each([&](auto& watcher) {
         watcher->notify_inode_event({}, identifier(), InodeWatcherEvent::Type::ChildCreated, name);
     });
@@ -224,6 +231,8 @@ void Inode::did_add_child(InodeIdentifier, StringView name)
 
 void Inode::did_remove_child(InodeIdentifier, StringView name)
 {
+    VirtualFileSystem::the().invalidate_directory_cache_entry({}, identifier(), name);
+
     if (name == "." || name == "..") {
         // These are just aliases and are not interesting to userspace.
         return;
@@ -34,36 +34,44 @@ ErrorOr<size_t> InodeWatcher::read(OpenFileDescription&, u64, UserOrKernelBuffer
         // can_read will catch the blocking case.
         return EAGAIN;
 
-    auto event = m_queue.dequeue();
-
-    size_t bytes_to_write = sizeof(InodeWatcherEvent);
-    if (event.path)
-        bytes_to_write += event.path->length() + 1;
-
-    if (buffer_size < bytes_to_write)
-        return EINVAL;
-
-    auto result = buffer.write_buffered<MAXIMUM_EVENT_SIZE>(bytes_to_write, [&](Bytes bytes) {
-        size_t offset = 0;
-
-        memcpy(bytes.offset(offset), &event.wd, sizeof(InodeWatcherEvent::watch_descriptor));
-        offset += sizeof(InodeWatcherEvent::watch_descriptor);
-        memcpy(bytes.offset(offset), &event.type, sizeof(InodeWatcherEvent::type));
-        offset += sizeof(InodeWatcherEvent::type);
-
-        if (event.path) {
-            size_t name_length = event.path->length() + 1;
-            memcpy(bytes.offset(offset), &name_length, sizeof(InodeWatcherEvent::name_length));
-            offset += sizeof(InodeWatcherEvent::name_length);
-            memcpy(bytes.offset(offset), event.path->characters(), name_length);
-        } else {
-            memset(bytes.offset(offset), 0, sizeof(InodeWatcherEvent::name_length));
+    // Write out as many queued events as fit into the caller's buffer, so a
+    // busy watcher can drain a burst of events with a single syscall.
+    size_t bytes_written = 0;
+    while (!m_queue.is_empty()) {
+        size_t bytes_to_write = sizeof(InodeWatcherEvent);
+        if (m_queue.first().path)
+            bytes_to_write += m_queue.first().path->length() + 1;
+
+        if (bytes_written + bytes_to_write > buffer_size) {
+            if (bytes_written == 0)
+                return EINVAL;
+            break;
         }
 
-        return bytes.size();
-    });
+        auto event = m_queue.dequeue();
+        TRY(buffer.write_buffered<MAXIMUM_EVENT_SIZE>(bytes_written, bytes_to_write, [&](Bytes bytes) {
+            size_t offset = 0;
+
+            memcpy(bytes.offset(offset), &event.wd, sizeof(InodeWatcherEvent::watch_descriptor));
+            offset += sizeof(InodeWatcherEvent::watch_descriptor);
+            memcpy(bytes.offset(offset), &event.type, sizeof(InodeWatcherEvent::type));
+            offset += sizeof(InodeWatcherEvent::type);
+
+            if (event.path) {
+                size_t name_length = event.path->length() + 1;
+                memcpy(bytes.offset(offset), &name_length, sizeof(InodeWatcherEvent::name_length));
+                offset += sizeof(InodeWatcherEvent::name_length);
+                memcpy(bytes.offset(offset), event.path->characters(), name_length);
+            } else {
+                memset(bytes.offset(offset), 0, sizeof(InodeWatcherEvent::name_length));
+            }
+
+            return bytes.size();
+        }));
+        bytes_written += bytes_to_write;
+    }
     evaluate_block_conditions();
-    return result;
+    return bytes_written;
 }
 
 ErrorOr<void> InodeWatcher::close()
@@ -100,6 +108,17 @@ void InodeWatcher::notify_inode_event(Badge<Inode>, InodeIdentifier inode_id, In
     OwnPtr<KString> path;
     if (!name.is_null())
         path = KString::try_create(name).release_value_but_fixme_should_propagate_errors();
+
+    // Coalesce with the most recently queued event if it's identical: a flurry
+    // of writes to the same file tells the watcher nothing it doesn't already
+    // know, and would just crowd other events out of the queue.
+    if (!m_queue.is_empty()) {
+        auto const& last_event = m_queue.last();
+        bool same_path = last_event.path ? (path && last_event.path->view() == path->view()) : !path;
+        if (last_event.wd == watcher.wd && last_event.type == event_type && same_path)
+            return;
+    }
+
     m_queue.enqueue({ watcher.wd, event_type, move(path) });
     evaluate_block_conditions();
 }
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonObjectSerializer.h>
+#include <Kernel/FileSystem/SysFS/Subsystems/Kernel/Counters.h>
+#include <Kernel/PerCpuCounter.h>
+#include <Kernel/Sections.h>
+
+namespace Kernel {
+
+UNMAP_AFTER_INIT SysFSCounters::SysFSCounters(SysFSDirectory const& parent_directory)
+    : SysFSGlobalInformation(parent_directory)
+{
+}
+
+UNMAP_AFTER_INIT NonnullLockRefPtr<SysFSCounters> SysFSCounters::must_create(SysFSDirectory const& parent_directory)
+{
+    return adopt_lock_ref_if_nonnull(new (nothrow) SysFSCounters(parent_directory)).release_nonnull();
+}
+
+ErrorOr<void> SysFSCounters::try_generate(KBufferBuilder& builder)
+{
+    auto array = TRY(JsonArraySerializer<>::try_create(builder));
+    ErrorOr<void> result; // FIXME: Make this nicer
+    PerCpuCounter::for_each([&array, &result](PerCpuCounter const& counter) {
+        if (result.is_error())
+            return;
+        result = ([&]() -> ErrorOr<void> {
+            auto obj = TRY(array.add_object());
+            TRY(obj.add("name"sv, counter.name()));
+            TRY(obj.add("total"sv, counter.sum()));
+            auto per_cpu_values = TRY(obj.add_array("per_cpu_values"sv));
+            for (u32 cpu = 0; cpu < Processor::count(); ++cpu) {
+                TRY(per_cpu_values.add(counter.value_on_cpu(cpu)));
+            }
+            TRY(per_cpu_values.finish());
+            TRY(obj.finish());
+            return {};
+        })();
+    });
+    TRY(result);
+    TRY(array.finish());
+    return {};
+}
+
+}
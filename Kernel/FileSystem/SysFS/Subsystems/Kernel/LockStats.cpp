@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/HashMap.h>
+#include <AK/JsonArraySerializer.h>
+#include <AK/JsonObjectSerializer.h>
+#include <Kernel/FileSystem/SysFS/Subsystems/Kernel/LockStats.h>
+#include <Kernel/Locking/Mutex.h>
+#include <Kernel/Sections.h>
+
+namespace Kernel {
+
+UNMAP_AFTER_INIT SysFSLockStats::SysFSLockStats(SysFSDirectory const& parent_directory)
+    : SysFSGlobalInformation(parent_directory)
+{
+}
+
+UNMAP_AFTER_INIT NonnullLockRefPtr<SysFSLockStats> SysFSLockStats::must_create(SysFSDirectory const& parent_directory)
+{
+    return adopt_lock_ref_if_nonnull(new (nothrow) SysFSLockStats(parent_directory)).release_nonnull();
+}
+
+ErrorOr<void> SysFSLockStats::try_generate(KBufferBuilder& builder)
+{
+    struct AggregatedStats {
+        u64 instance_count { 0 };
+        u64 times_acquired { 0 };
+        u64 times_contended { 0 };
+        u64 total_wait_ns { 0 };
+        u64 max_wait_ns { 0 };
+    };
+
+    // Many mutexes are per-object instances of the same lock (every Inode has
+    // one, for example), so aggregate by name to keep the output readable.
+    // Mutex names are string literals, so the views stay valid after the
+    // enumeration ends.
+    HashMap<StringView, AggregatedStats> aggregated;
+    ErrorOr<void> result;
+    Mutex::for_each_mutex([&](Mutex const& mutex) {
+        if (result.is_error())
+            return;
+        result = ([&]() -> ErrorOr<void> {
+            auto stats = mutex.contention_stats();
+            auto name = mutex.name().is_null() ? "<unnamed>"sv : mutex.name();
+            auto it = aggregated.find(name);
+            if (it == aggregated.end()) {
+                TRY(aggregated.try_set(name, AggregatedStats {}));
+                it = aggregated.find(name);
+            }
+            auto& entry = it->value;
+            entry.instance_count++;
+            entry.times_acquired += stats.times_acquired;
+            entry.times_contended += stats.times_contended;
+            entry.total_wait_ns += stats.total_wait_ns;
+            if (stats.max_wait_ns > entry.max_wait_ns)
+                entry.max_wait_ns = stats.max_wait_ns;
+            return {};
+        })();
+    });
+    TRY(result);
+
+    auto array = TRY(JsonArraySerializer<>::try_create(builder));
+    for (auto const& it : aggregated) {
+        auto obj = TRY(array.add_object());
+        TRY(obj.add("name"sv, it.key));
+        TRY(obj.add("instance_count"sv, it.value.instance_count));
+        TRY(obj.add("times_acquired"sv, it.value.times_acquired));
+        TRY(obj.add("times_contended"sv, it.value.times_contended));
+        TRY(obj.add("total_wait_ns"sv, it.value.total_wait_ns));
+        TRY(obj.add("max_wait_ns"sv, it.value.max_wait_ns));
+        TRY(obj.finish());
+    }
+    TRY(array.finish());
+    return {};
+}
+
+}
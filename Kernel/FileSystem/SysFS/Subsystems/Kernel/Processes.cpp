@@ -126,6 +126,9 @@ ErrorOr<void> SysFSOverallProcesses::try_generate(KBufferBuilder& builder)
             TRY(thread_object.add("cpu"sv, thread.cpu()));
             TRY(thread_object.add("priority"sv, thread.priority()));
             TRY(thread_object.add("syscall_count"sv, thread.syscall_count()));
+            TRY(thread_object.add("cpu_cycles"sv, thread.performance_counters().cycles));
+            TRY(thread_object.add("instructions_retired"sv, thread.performance_counters().instructions_retired));
+            TRY(thread_object.add("cache_misses"sv, thread.performance_counters().cache_misses));
             TRY(thread_object.add("inode_faults"sv, thread.inode_faults()));
             TRY(thread_object.add("zero_faults"sv, thread.zero_faults()));
             TRY(thread_object.add("cow_faults"sv, thread.cow_faults()));
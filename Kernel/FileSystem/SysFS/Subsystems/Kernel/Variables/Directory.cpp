@@ -11,6 +11,9 @@
 #include <Kernel/FileSystem/SysFS/Subsystems/Kernel/Variables/CoredumpDirectory.h>
 #include <Kernel/FileSystem/SysFS/Subsystems/Kernel/Variables/Directory.h>
 #include <Kernel/FileSystem/SysFS/Subsystems/Kernel/Variables/DumpKmallocStack.h>
+#include <Kernel/FileSystem/SysFS/Subsystems/Kernel/Variables/SyncIntervalSeconds.h>
+#include <Kernel/FileSystem/SysFS/Subsystems/Kernel/Variables/TCPDelayedAckThreshold.h>
+#include <Kernel/FileSystem/SysFS/Subsystems/Kernel/Variables/TCPDelayedAckTimeout.h>
 #include <Kernel/FileSystem/SysFS/Subsystems/Kernel/Variables/UBSANDeadly.h>
 
 namespace Kernel {
@@ -21,6 +24,9 @@ UNMAP_AFTER_INIT NonnullLockRefPtr<SysFSGlobalKernelVariablesDirectory> SysFSGlo
     MUST(global_variables_directory->m_child_components.with([&](auto& list) -> ErrorOr<void> {
         list.append(SysFSCapsLockRemap::must_create(*global_variables_directory));
         list.append(SysFSDumpKmallocStacks::must_create(*global_variables_directory));
+        list.append(SysFSSyncIntervalSeconds::must_create(*global_variables_directory));
+        list.append(SysFSTCPDelayedAckThreshold::must_create(*global_variables_directory));
+        list.append(SysFSTCPDelayedAckTimeout::must_create(*global_variables_directory));
         list.append(SysFSUBSANDeadly::must_create(*global_variables_directory));
         list.append(SysFSCoredumpDirectory::must_create(*global_variables_directory));
         return {};
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/StringView.h>
+#include <Kernel/FileSystem/SysFS/Subsystems/Kernel/Variables/SyncIntervalSeconds.h>
+#include <Kernel/Process.h>
+#include <Kernel/Sections.h>
+#include <Kernel/Tasks/SyncTask.h>
+
+namespace Kernel {
+
+UNMAP_AFTER_INIT SysFSSyncIntervalSeconds::SysFSSyncIntervalSeconds(SysFSDirectory const& parent_directory)
+    : SysFSGlobalInformation(parent_directory)
+{
+}
+
+UNMAP_AFTER_INIT NonnullLockRefPtr<SysFSSyncIntervalSeconds> SysFSSyncIntervalSeconds::must_create(SysFSDirectory const& parent_directory)
+{
+    return adopt_lock_ref_if_nonnull(new (nothrow) SysFSSyncIntervalSeconds(parent_directory)).release_nonnull();
+}
+
+ErrorOr<void> SysFSSyncIntervalSeconds::try_generate(KBufferBuilder& builder)
+{
+    return builder.appendff("{}\n", SyncTask::interval_in_seconds());
+}
+
+ErrorOr<size_t> SysFSSyncIntervalSeconds::write_bytes(off_t, size_t count, UserOrKernelBuffer const& buffer, OpenFileDescription*)
+{
+    MutexLocker locker(m_refresh_lock);
+    if (count == 0 || count > 16)
+        return Error::from_errno(EINVAL);
+    char characters[16] = {};
+    TRY(buffer.read(characters, count));
+
+    // NOTE: If we are in a jail, don't let the current process change the variable.
+    if (Process::current().is_currently_in_jail())
+        return Error::from_errno(EPERM);
+
+    auto interval = StringView { characters, count }.trim_whitespace().to_uint();
+    if (!interval.has_value() || *interval == 0)
+        return Error::from_errno(EINVAL);
+    SyncTask::set_interval_in_seconds(*interval);
+    return count;
+}
+
+ErrorOr<void> SysFSSyncIntervalSeconds::truncate(u64 size)
+{
+    if (size != 0)
+        return EPERM;
+    return {};
+}
+
+}
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Types.h>
+#include <Kernel/FileSystem/SysFS/Subsystems/Kernel/GlobalInformation.h>
+#include <Kernel/Library/LockRefPtr.h>
+#include <Kernel/UserOrKernelBuffer.h>
+
+namespace Kernel {
+
+class SysFSSyncIntervalSeconds final : public SysFSGlobalInformation {
+public:
+    virtual StringView name() const override { return "sync_interval_seconds"sv; }
+    static NonnullLockRefPtr<SysFSSyncIntervalSeconds> must_create(SysFSDirectory const&);
+
+private:
+    explicit SysFSSyncIntervalSeconds(SysFSDirectory const&);
+
+    // ^SysFSGlobalInformation
+    virtual ErrorOr<void> try_generate(KBufferBuilder&) override;
+
+    // ^SysFSExposedComponent
+    virtual ErrorOr<size_t> write_bytes(off_t, size_t, UserOrKernelBuffer const&, OpenFileDescription*) override;
+    virtual mode_t permissions() const override { return 0644; }
+    virtual ErrorOr<void> truncate(u64) override;
+};
+
+}
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/StringView.h>
+#include <Kernel/FileSystem/SysFS/Subsystems/Kernel/Variables/TCPDelayedAckThreshold.h>
+#include <Kernel/Net/TCPSocket.h>
+#include <Kernel/Process.h>
+#include <Kernel/Sections.h>
+
+namespace Kernel {
+
+UNMAP_AFTER_INIT SysFSTCPDelayedAckThreshold::SysFSTCPDelayedAckThreshold(SysFSDirectory const& parent_directory)
+    : SysFSGlobalInformation(parent_directory)
+{
+}
+
+UNMAP_AFTER_INIT NonnullLockRefPtr<SysFSTCPDelayedAckThreshold> SysFSTCPDelayedAckThreshold::must_create(SysFSDirectory const& parent_directory)
+{
+    return adopt_lock_ref_if_nonnull(new (nothrow) SysFSTCPDelayedAckThreshold(parent_directory)).release_nonnull();
+}
+
+ErrorOr<void> SysFSTCPDelayedAckThreshold::try_generate(KBufferBuilder& builder)
+{
+    return builder.appendff("{}\n", TCPSocket::delayed_ack_threshold_in_segments());
+}
+
+ErrorOr<size_t> SysFSTCPDelayedAckThreshold::write_bytes(off_t, size_t count, UserOrKernelBuffer const& buffer, OpenFileDescription*)
+{
+    MutexLocker locker(m_refresh_lock);
+    if (count == 0 || count > 16)
+        return Error::from_errno(EINVAL);
+    char characters[16] = {};
+    TRY(buffer.read(characters, count));
+
+    // NOTE: If we are in a jail, don't let the current process change the variable.
+    if (Process::current().is_currently_in_jail())
+        return Error::from_errno(EPERM);
+
+    auto threshold = StringView { characters, count }.trim_whitespace().to_uint();
+    if (!threshold.has_value() || *threshold == 0)
+        return Error::from_errno(EINVAL);
+    TCPSocket::set_delayed_ack_threshold_in_segments(*threshold);
+    return count;
+}
+
+ErrorOr<void> SysFSTCPDelayedAckThreshold::truncate(u64 size)
+{
+    if (size != 0)
+        return EPERM;
+    return {};
+}
+
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/StringView.h>
+#include <Kernel/FileSystem/SysFS/Subsystems/Kernel/Variables/TCPDelayedAckTimeout.h>
+#include <Kernel/Net/TCPSocket.h>
+#include <Kernel/Process.h>
+#include <Kernel/Sections.h>
+
+namespace Kernel {
+
+UNMAP_AFTER_INIT SysFSTCPDelayedAckTimeout::SysFSTCPDelayedAckTimeout(SysFSDirectory const& parent_directory)
+    : SysFSGlobalInformation(parent_directory)
+{
+}
+
+UNMAP_AFTER_INIT NonnullLockRefPtr<SysFSTCPDelayedAckTimeout> SysFSTCPDelayedAckTimeout::must_create(SysFSDirectory const& parent_directory)
+{
+    return adopt_lock_ref_if_nonnull(new (nothrow) SysFSTCPDelayedAckTimeout(parent_directory)).release_nonnull();
+}
+
+ErrorOr<void> SysFSTCPDelayedAckTimeout::try_generate(KBufferBuilder& builder)
+{
+    return builder.appendff("{}\n", TCPSocket::delayed_ack_timeout_in_milliseconds());
+}
+
+ErrorOr<size_t> SysFSTCPDelayedAckTimeout::write_bytes(off_t, size_t count, UserOrKernelBuffer const& buffer, OpenFileDescription*)
+{
+    MutexLocker locker(m_refresh_lock);
+    if (count == 0 || count > 16)
+        return Error::from_errno(EINVAL);
+    char characters[16] = {};
+    TRY(buffer.read(characters, count));
+
+    // NOTE: If we are in a jail, don't let the current process change the variable.
+    if (Process::current().is_currently_in_jail())
+        return Error::from_errno(EPERM);
+
+    // RFC 1122 forbids delaying an ACK for more than 500 milliseconds.
+    auto timeout = StringView { characters, count }.trim_whitespace().to_uint();
+    if (!timeout.has_value() || *timeout == 0 || *timeout > 500)
+        return Error::from_errno(EINVAL);
+    TCPSocket::set_delayed_ack_timeout_in_milliseconds(*timeout);
+    return count;
+}
+
+ErrorOr<void> SysFSTCPDelayedAckTimeout::truncate(u64 size)
+{
+    if (size != 0)
+        return EPERM;
+    return {};
+}
+
+}
@@ -91,7 +91,11 @@ ErrorOr<void> TmpFSInode::replace_child(StringView name, Inode& new_child)
 
 ErrorOr<NonnullOwnPtr<TmpFSInode::DataBlock>> TmpFSInode::DataBlock::create()
 {
-    auto data_block_buffer_vmobject = TRY(Memory::AnonymousVMObject::try_create_with_size(DataBlock::block_size, AllocationStrategy::AllocateNow));
+    // Note: Physical pages are only materialized when a page of the block is
+    // actually touched; until then a committed lazy page costs no physical
+    // memory. This keeps sparse files and the unwritten tails of blocks from
+    // pinning page frames.
+    auto data_block_buffer_vmobject = TRY(Memory::AnonymousVMObject::try_create_with_size(DataBlock::block_size, AllocationStrategy::Reserve));
     return TRY(adopt_nonnull_own_or_enomem(new (nothrow) DataBlock(move(data_block_buffer_vmobject))));
 }
 
@@ -374,7 +378,19 @@ ErrorOr<void> TmpFSInode::truncate(u64 size)
         NonnullLockRefPtr<Memory::AnonymousVMObject> block_vmobject = m_blocks[last_possible_block_index]->vmobject();
         mapping_region->set_vmobject(block_vmobject);
         mapping_region->remap();
-        memset(mapping_region->vaddr().offset(size % DataBlock::block_size).as_ptr(), 0, DataBlock::block_size - (size % DataBlock::block_size));
+        // Zero the tail of the block, but skip pages that were never
+        // materialized: they already read back as zeroes, and writing to them
+        // would needlessly allocate physical pages. Nobody else can
+        // materialize pages of this block while we hold the inode lock.
+        size_t offset_in_block = size % DataBlock::block_size;
+        size_t first_page_index = offset_in_block / PAGE_SIZE;
+        for (size_t page_index = first_page_index; page_index < DataBlock::block_size / PAGE_SIZE; ++page_index) {
+            auto const& physical_page = block_vmobject->physical_pages()[page_index];
+            if (!physical_page || physical_page->is_shared_zero_page() || physical_page->is_lazy_committed_page())
+                continue;
+            size_t zero_start_in_page = (page_index == first_page_index) ? (offset_in_block % PAGE_SIZE) : 0;
+            memset(mapping_region->vaddr().offset(page_index * PAGE_SIZE + zero_start_in_page).as_ptr(), 0, PAGE_SIZE - zero_start_in_page);
+        }
     }
     m_metadata.size = size;
     set_metadata_dirty(true);
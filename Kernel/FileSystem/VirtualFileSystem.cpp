@@ -163,6 +163,10 @@ ErrorOr<void> VirtualFileSystem::unmount(Custody& mountpoint_custody)
     auto custody_path = TRY(mountpoint_custody.try_serialize_absolute_path());
     dbgln("VirtualFileSystem: unmount called with inode {} on mountpoint {}", guest_inode.identifier(), custody_path->view());
 
+    // Drop the whole directory cache so it doesn't hold inode references
+    // that would make the file system look busy.
+    clear_directory_cache();
+
     return m_mounts.with([&](auto& mounts) -> ErrorOr<void> {
         for (auto& mount : mounts) {
             if (&mount.guest() != &guest_inode)
@@ -1039,6 +1043,104 @@ ErrorOr<NonnullRefPtr<Custody>> VirtualFileSystem::resolve_path(Credentials cons
     return custody;
 }
 
+void VirtualFileSystem::DirectoryCache::remove_entry(DirectoryCacheEntry& entry)
+{
+    lru_list.remove(entry);
+    auto it = entries.find(entry.parent);
+    VERIFY(it != entries.end());
+    it->value.remove(entry.name->view());
+    if (it->value.is_empty())
+        entries.remove(it);
+    VERIFY(entry_count > 0);
+    --entry_count;
+}
+
+Optional<LockRefPtr<Inode>> VirtualFileSystem::lookup_directory_cache_entry(InodeIdentifier parent, StringView name)
+{
+    return m_directory_cache.with([&](auto& cache) -> Optional<LockRefPtr<Inode>> {
+        auto it = cache.entries.find(parent);
+        if (it == cache.entries.end())
+            return {};
+        auto entry_it = it->value.find(name);
+        if (entry_it == it->value.end())
+            return {};
+        auto& entry = *entry_it->value;
+        cache.lru_list.remove(entry);
+        cache.lru_list.prepend(entry);
+        return entry.inode;
+    });
+}
+
+void VirtualFileSystem::add_directory_cache_entry(InodeIdentifier parent, StringView name, LockRefPtr<Inode> inode)
+{
+    // This cache is purely an optimization, so allocation failures just mean
+    // we don't cache this entry.
+    auto name_copy_or_error = KString::try_create(name);
+    if (name_copy_or_error.is_error())
+        return;
+    auto entry_or_error = adopt_nonnull_own_or_enomem(new (nothrow) DirectoryCacheEntry { parent, name_copy_or_error.release_value(), move(inode), {} });
+    if (entry_or_error.is_error())
+        return;
+    auto entry = entry_or_error.release_value();
+
+    auto name_key_or_error = KString::try_create(name);
+    if (name_key_or_error.is_error())
+        return;
+
+    m_directory_cache.with([&](auto& cache) {
+        // Drop any stale entry for this name and make room for the new one
+        // before grabbing a reference into the per-directory map, since
+        // remove_entry() may prune empty per-directory maps.
+        if (auto it = cache.entries.find(parent); it != cache.entries.end()) {
+            if (auto existing = it->value.find(name); existing != it->value.end())
+                cache.remove_entry(*existing->value);
+        }
+        while (cache.entry_count >= DirectoryCache::max_entry_count) {
+            auto* oldest = cache.lru_list.last();
+            VERIFY(oldest);
+            cache.remove_entry(*oldest);
+        }
+
+        auto it = cache.entries.find(parent);
+        if (it == cache.entries.end()) {
+            if (cache.entries.try_set(parent, {}).is_error())
+                return;
+            it = cache.entries.find(parent);
+        }
+        auto& directory_entries = it->value;
+
+        auto& new_entry = *entry;
+        if (directory_entries.try_set(name_key_or_error.release_value(), move(entry)).is_error()) {
+            if (directory_entries.is_empty())
+                cache.entries.remove(it);
+            return;
+        }
+        cache.lru_list.prepend(new_entry);
+        ++cache.entry_count;
+    });
+}
+
+void VirtualFileSystem::invalidate_directory_cache_entry(Badge<Inode>, InodeIdentifier parent, StringView name)
+{
+    m_directory_cache.with([&](auto& cache) {
+        auto it = cache.entries.find(parent);
+        if (it == cache.entries.end())
+            return;
+        auto entry_it = it->value.find(name);
+        if (entry_it == it->value.end())
+            return;
+        cache.remove_entry(*entry_it->value);
+    });
+}
+
+void VirtualFileSystem::clear_directory_cache()
+{
+    m_directory_cache.with([&](auto& cache) {
+        while (auto* entry = cache.lru_list.last())
+            cache.remove_entry(*entry);
+    });
+}
+
 static bool safe_to_follow_symlink(Credentials const& credentials, Inode const& inode, InodeMetadata const& parent_metadata)
 {
     auto metadata = inode.metadata();
@@ -1093,17 +1195,39 @@ ErrorOr<NonnullRefPtr<Custody>> VirtualFileSystem::resolve_path_without_veil(Cre
         }
 
         // Okay, let's look up this part.
-        auto child_or_error = parent.inode().lookup(part);
-        if (child_or_error.is_error()) {
-            if (out_parent) {
-                // ENOENT with a non-null parent custody signals to caller that
-                // we found the immediate parent of the file, but the file itself
-                // does not exist yet.
-                *out_parent = have_more_parts ? nullptr : &parent;
+        // Only file-backed file systems are safe to cache: pseudo file systems
+        // like ProcFS grow and shrink their directories without going through
+        // the VFS, so negative entries for them would go stale.
+        bool parent_is_cacheable = parent.inode().fs().is_file_backed();
+        LockRefPtr<Inode> child_inode;
+        if (parent_is_cacheable) {
+            if (auto cached = lookup_directory_cache_entry(parent.inode().identifier(), part); cached.has_value()) {
+                if (!cached.value()) {
+                    // Negative entry; the name is known not to exist.
+                    if (out_parent)
+                        *out_parent = have_more_parts ? nullptr : &parent;
+                    return ENOENT;
+                }
+                child_inode = cached.release_value();
+            }
+        }
+        if (!child_inode) {
+            auto child_or_error = parent.inode().lookup(part);
+            if (child_or_error.is_error()) {
+                if (parent_is_cacheable && child_or_error.error().code() == ENOENT)
+                    add_directory_cache_entry(parent.inode().identifier(), part, nullptr);
+                if (out_parent) {
+                    // ENOENT with a non-null parent custody signals to caller that
+                    // we found the immediate parent of the file, but the file itself
+                    // does not exist yet.
+                    *out_parent = have_more_parts ? nullptr : &parent;
+                }
+                return child_or_error.release_error();
             }
-            return child_or_error.release_error();
+            child_inode = child_or_error.release_value();
+            if (parent_is_cacheable)
+                add_directory_cache_entry(parent.inode().identifier(), part, child_inode);
         }
-        auto child_inode = child_or_error.release_value();
 
         int mount_flags_for_child = parent.mount_flags();
 
@@ -10,6 +10,7 @@
 #include <AK/Error.h>
 #include <AK/Function.h>
 #include <AK/HashMap.h>
+#include <AK/IntrusiveList.h>
 #include <AK/NonnullOwnPtrVector.h>
 #include <AK/OwnPtr.h>
 #include <AK/RefPtr.h>
@@ -20,6 +21,7 @@
 #include <Kernel/FileSystem/Mount.h>
 #include <Kernel/FileSystem/UnveilNode.h>
 #include <Kernel/Forward.h>
+#include <Kernel/KString.h>
 #include <Kernel/Library/LockRefPtr.h>
 #include <Kernel/Locking/SpinlockProtected.h>
 
@@ -94,6 +96,8 @@ public:
     ErrorOr<NonnullRefPtr<Custody>> resolve_path(Credentials const&, StringView path, NonnullRefPtr<Custody> base, RefPtr<Custody>* out_parent = nullptr, int options = 0, int symlink_recursion_level = 0);
     ErrorOr<NonnullRefPtr<Custody>> resolve_path_without_veil(Credentials const&, StringView path, NonnullRefPtr<Custody> base, RefPtr<Custody>* out_parent = nullptr, int options = 0, int symlink_recursion_level = 0);
 
+    void invalidate_directory_cache_entry(Badge<Inode>, InodeIdentifier parent, StringView name);
+
 private:
     friend class OpenFileDescription;
 
@@ -111,10 +115,39 @@ private:
     Mount* find_mount_for_host(InodeIdentifier);
     Mount* find_mount_for_guest(InodeIdentifier);
 
+    // A cached directory entry, keyed on (parent inode, name). A null inode
+    // is a negative entry and means the name is known not to exist in the
+    // parent directory.
+    struct DirectoryCacheEntry {
+        InodeIdentifier parent;
+        NonnullOwnPtr<KString> name;
+        LockRefPtr<Inode> inode;
+        IntrusiveListNode<DirectoryCacheEntry> lru_node;
+        using LRUList = IntrusiveList<&DirectoryCacheEntry::lru_node>;
+    };
+
+    struct DirectoryCache {
+        static constexpr size_t max_entry_count = 1024;
+
+        // The most recently used entry sits at the head of the list.
+        DirectoryCacheEntry::LRUList lru_list;
+        HashMap<InodeIdentifier, HashMap<NonnullOwnPtr<KString>, NonnullOwnPtr<DirectoryCacheEntry>>> entries;
+        size_t entry_count { 0 };
+
+        void remove_entry(DirectoryCacheEntry&);
+    };
+
+    // An engaged Optional holding a null inode signals a cached negative lookup.
+    Optional<LockRefPtr<Inode>> lookup_directory_cache_entry(InodeIdentifier parent, StringView name);
+    void add_directory_cache_entry(InodeIdentifier parent, StringView name, LockRefPtr<Inode>);
+    void clear_directory_cache();
+
     LockRefPtr<Inode> m_root_inode;
 
     SpinlockProtected<RefPtr<Custody>, LockRank::None> m_root_custody {};
 
+    SpinlockProtected<DirectoryCache, LockRank::None> m_directory_cache {};
+
     SpinlockProtected<IntrusiveList<&Mount::m_vfs_list_node>, LockRank::None> m_mounts {};
     SpinlockProtected<IntrusiveList<&FileBackedFileSystem::m_file_backed_file_system_node>, LockRank::None> m_file_backed_file_systems_list {};
     SpinlockProtected<IntrusiveList<&FileSystem::m_file_system_node>, LockRank::FileSystem> m_file_systems_list {};
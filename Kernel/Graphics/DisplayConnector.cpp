@@ -257,6 +257,11 @@ ErrorOr<void> DisplayConnector::flush_rectangle(size_t, FBRect const&)
     return Error::from_errno(ENOTSUP);
 }
 
+ErrorOr<void> DisplayConnector::flush_rectangle_batch_completed(size_t)
+{
+    return {};
+}
+
 DisplayConnector::ModeSetting DisplayConnector::current_mode_setting() const
 {
     SpinlockLocker locker(m_modeset_lock);
@@ -487,6 +492,13 @@ ErrorOr<void> DisplayConnector::ioctl(OpenFileDescription&, unsigned request, Us
                     TRY(flush_rectangle(flush_rects.buffer_index, user_dirty_rect));
                 }
             }
+            {
+                SpinlockLocker control_locker(m_control_lock);
+                if (console_mode()) {
+                    return {};
+                }
+                TRY(flush_rectangle_batch_completed(flush_rects.buffer_index));
+            }
         }
         return {};
     };
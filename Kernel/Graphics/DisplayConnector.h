@@ -111,6 +111,10 @@ protected:
     virtual void disable_console() = 0;
     virtual ErrorOr<void> flush_first_surface() = 0;
     virtual ErrorOr<void> flush_rectangle(size_t buffer_index, FBRect const& rect);
+    // Called once after the flush ioctl has gone through all of its rectangles, so
+    // connectors that only accumulate damage in flush_rectangle() can present the
+    // whole batch with a single device round trip.
+    virtual ErrorOr<void> flush_rectangle_batch_completed(size_t buffer_index);
 
     ErrorOr<void> initialize_edid_for_generic_monitor(Optional<Array<u8, 3>> manufacturer_id_string);
 
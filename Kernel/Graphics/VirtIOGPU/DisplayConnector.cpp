@@ -126,8 +126,19 @@ ErrorOr<void> VirtIODisplayConnector::flush_rectangle(size_t buffer_index, FBRec
     };
 
     TRY(m_graphics_adapter->transfer_framebuffer_data_to_host({}, *this, dirty_rect, true));
-    // Flushing directly to screen
-    TRY(flush_displayed_image(dirty_rect, true));
+    // Only accumulate the damage here; flush_rectangle_batch_completed() presents the
+    // whole batch with a single resource flush instead of one per rectangle.
+    m_graphics_adapter->set_dirty_displayed_rect({}, *this, dirty_rect, true);
+    return {};
+}
+
+ErrorOr<void> VirtIODisplayConnector::flush_rectangle_batch_completed(size_t buffer_index)
+{
+    VERIFY(m_flushing_lock.is_locked());
+    if (!is_valid_buffer_index(buffer_index))
+        return Error::from_errno(EINVAL);
+    SpinlockLocker locker(m_graphics_adapter->operation_lock());
+    TRY(m_graphics_adapter->flush_dirty_displayed_rect({}, *this, true));
     return {};
 }
 
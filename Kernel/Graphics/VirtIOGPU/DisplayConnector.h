@@ -57,6 +57,7 @@ private:
 
     virtual ErrorOr<void> flush_first_surface() override;
     virtual ErrorOr<void> flush_rectangle(size_t buffer_index, FBRect const& rect) override;
+    virtual ErrorOr<void> flush_rectangle_batch_completed(size_t buffer_index) override;
 
     virtual void enable_console() override;
     virtual void disable_console() override;
@@ -92,6 +92,18 @@ ErrorOr<void> VirtIOGraphicsAdapter::flush_displayed_image(Badge<VirtIODisplayCo
     return {};
 }
 
+ErrorOr<void> VirtIOGraphicsAdapter::flush_dirty_displayed_rect(Badge<VirtIODisplayConnector>, VirtIODisplayConnector& connector, bool main_buffer)
+{
+    VERIFY(m_operation_lock.is_locked());
+    VERIFY(connector.scanout_id() < VIRTIO_GPU_MAX_SCANOUTS);
+    Scanout::PhysicalBuffer& buffer = main_buffer ? m_scanouts[connector.scanout_id().value()].main_buffer : m_scanouts[connector.scanout_id().value()].back_buffer;
+    if (buffer.dirty_rect.width == 0 || buffer.dirty_rect.height == 0)
+        return {};
+    TRY(flush_displayed_image(buffer.resource_id, buffer.dirty_rect));
+    buffer.dirty_rect = {};
+    return {};
+}
+
 ErrorOr<void> VirtIOGraphicsAdapter::transfer_framebuffer_data_to_host(Badge<VirtIODisplayConnector>, VirtIODisplayConnector& connector, Graphics::VirtIOGPU::Protocol::Rect const& rect, bool main_buffer)
 {
     VERIFY(m_operation_lock.is_locked());
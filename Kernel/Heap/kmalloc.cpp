@@ -38,6 +38,70 @@ const nothrow_t nothrow;
 // FIXME: Figure out whether this can be MemoryManager.
 static RecursiveSpinlock<LockRank::None> s_lock {}; // needs to be recursive because of dump_backtrace()
 
+#if KMALLOC_HARDENING_LEVEL >= 2
+
+static void kmalloc_poison_on_allocate(void* ptr, size_t slab_size, CallerWillInitializeMemory caller_will_initialize_memory)
+{
+    if (caller_will_initialize_memory == CallerWillInitializeMemory::No)
+        memset(ptr, KMALLOC_SCRUB_BYTE, slab_size);
+}
+
+static void kmalloc_poison_on_deallocate(void* ptr, size_t slab_size)
+{
+    memset(ptr, KFREE_SCRUB_BYTE, slab_size);
+}
+
+static void kmalloc_write_canary(void*, size_t)
+{
+}
+
+#else
+
+// Every free slab carries a canary in its last few bytes (the first word is
+// reserved for the freelist pointer). It's written on free and verified on
+// the next allocation, so use-after-free writes to the slab tail are still
+// caught without paying for a full memset on every operation. A sampled
+// subset of operations keeps the full scrub, so the historical poison
+// patterns still show up in crash diagnostics now and then.
+static constexpr size_t kmalloc_canary_size = 8;
+
+static bool kmalloc_should_sample_full_scrub()
+{
+    static Atomic<size_t> s_operation_counter;
+    return (s_operation_counter.fetch_add(1, AK::memory_order_relaxed) % 64) == 0;
+}
+
+static u8* kmalloc_canary_location(void* ptr, size_t slab_size)
+{
+    return static_cast<u8*>(ptr) + slab_size - kmalloc_canary_size;
+}
+
+static void kmalloc_write_canary(void* ptr, size_t slab_size)
+{
+    memset(kmalloc_canary_location(ptr, slab_size), KFREE_SCRUB_BYTE, kmalloc_canary_size);
+}
+
+static void kmalloc_poison_on_allocate(void* ptr, size_t slab_size, CallerWillInitializeMemory caller_will_initialize_memory)
+{
+    auto const* canary = kmalloc_canary_location(ptr, slab_size);
+    for (size_t i = 0; i < kmalloc_canary_size; ++i) {
+        if (canary[i] != KFREE_SCRUB_BYTE)
+            PANIC("kmalloc: Corrupted canary in free slab {:p} (slab size {})", ptr, slab_size);
+    }
+    if (caller_will_initialize_memory == CallerWillInitializeMemory::No && kmalloc_should_sample_full_scrub())
+        memset(ptr, KMALLOC_SCRUB_BYTE, slab_size);
+}
+
+static void kmalloc_poison_on_deallocate(void* ptr, size_t slab_size)
+{
+    if (kmalloc_should_sample_full_scrub())
+        memset(ptr, KFREE_SCRUB_BYTE, slab_size);
+    else
+        kmalloc_write_canary(ptr, slab_size);
+}
+
+#endif
+
 struct KmallocSubheap {
     KmallocSubheap(u8* base, size_t size)
         : allocator(base, size)
@@ -46,7 +110,13 @@ struct KmallocSubheap {
 
     IntrusiveListNode<KmallocSubheap> list_node;
     using List = IntrusiveList<&KmallocSubheap::list_node>;
+#if KMALLOC_HARDENING_LEVEL >= 2
     Heap<CHUNK_SIZE, KMALLOC_SCRUB_BYTE, KFREE_SCRUB_BYTE> allocator;
+#else
+    // The chunked heap only sees the colder, larger allocations; at lower
+    // hardening levels it skips per-byte scrubbing entirely.
+    Heap<CHUNK_SIZE> allocator;
+#endif
 };
 
 class KmallocSlabBlock {
@@ -62,6 +132,9 @@ public:
             auto* freelist_entry = (FreelistEntry*)(void*)(&m_data[i * slab_size]);
             freelist_entry->next = m_freelist;
             m_freelist = freelist_entry;
+            // Slabs that have never been allocated must carry a canary too,
+            // so the allocation path can verify them unconditionally.
+            kmalloc_write_canary(freelist_entry, slab_size);
         }
     }
 
@@ -140,15 +213,13 @@ public:
         if (block->is_full())
             m_full_blocks.append(*block);
 
-        if (caller_will_initialize_memory == CallerWillInitializeMemory::No) {
-            memset(ptr, KMALLOC_SCRUB_BYTE, m_slab_size);
-        }
+        kmalloc_poison_on_allocate(ptr, m_slab_size, caller_will_initialize_memory);
         return ptr;
     }
 
     void deallocate(void* ptr)
     {
-        memset(ptr, KFREE_SCRUB_BYTE, m_slab_size);
+        kmalloc_poison_on_deallocate(ptr, m_slab_size);
 
         auto* block = (KmallocSlabBlock*)((FlatPtr)ptr & KmallocSlabBlock::block_mask);
         bool block_was_full = block->is_full();
@@ -402,11 +473,110 @@ struct KmallocGlobalData {
 READONLY_AFTER_INIT static KmallocGlobalData* g_kmalloc_global;
 alignas(KmallocGlobalData) static u8 g_kmalloc_global_heap[sizeof(KmallocGlobalData)];
 
-static size_t g_kmalloc_call_count;
-static size_t g_kfree_call_count;
+// A per-CPU magazine front-end for the slabheap size classes. Each CPU keeps
+// a small stack of ready objects per size class, so the common allocate and
+// free paths only take that CPU's magazine lock (which is effectively
+// uncontended) and the global heap lock is only touched when a magazine
+// needs a batched refill from, or drain to, the shared slabheaps.
+class KmallocPerCpuCaches {
+public:
+    void* try_allocate(size_t size, size_t alignment, CallerWillInitializeMemory);
+    bool try_deallocate(void* ptr, size_t size);
+
+private:
+    static constexpr size_t magazine_capacity = 16;
+
+    struct Magazine {
+        Spinlock<LockRank::None> lock {};
+        size_t count { 0 };
+        void* objects[magazine_capacity];
+    };
+
+    struct PerCpuCache {
+        Magazine magazines[sizeof(KmallocGlobalData::slabheaps) / sizeof(KmallocSlabheap)];
+    };
+
+    static Optional<size_t> size_class_index(size_t size, size_t alignment);
+    void refill(Magazine&, size_t class_index);
+    void drain_half(Magazine&, size_t class_index);
+
+    PerCpuCache m_caches[MAX_CPU_COUNT];
+};
+
+static KmallocPerCpuCaches g_kmalloc_percpu_caches;
+
+static Atomic<size_t> g_kmalloc_call_count;
+static Atomic<size_t> g_kfree_call_count;
 static size_t g_nested_kfree_calls;
 bool g_dump_kmalloc_stacks;
 
+Optional<size_t> KmallocPerCpuCaches::size_class_index(size_t size, size_t alignment)
+{
+    auto const& slabheaps = g_kmalloc_global->slabheaps;
+    for (size_t i = 0; i < array_size(slabheaps); ++i) {
+        if (size <= slabheaps[i].slab_size() && alignment <= slabheaps[i].slab_size())
+            return i;
+    }
+    return {};
+}
+
+void KmallocPerCpuCaches::refill(Magazine& magazine, size_t class_index)
+{
+    VERIFY(magazine.count == 0);
+    auto& slabheap = g_kmalloc_global->slabheaps[class_index];
+    SpinlockLocker lock(s_lock);
+    for (size_t i = 0; i < magazine_capacity / 2; ++i) {
+        // Scrubbing is deferred until an object is actually handed out.
+        auto* ptr = slabheap.allocate(CallerWillInitializeMemory::Yes);
+        if (!ptr)
+            break;
+        magazine.objects[magazine.count++] = ptr;
+    }
+}
+
+void KmallocPerCpuCaches::drain_half(Magazine& magazine, size_t class_index)
+{
+    VERIFY(magazine.count == magazine_capacity);
+    auto& slabheap = g_kmalloc_global->slabheaps[class_index];
+    SpinlockLocker lock(s_lock);
+    while (magazine.count > magazine_capacity / 2)
+        slabheap.deallocate(magazine.objects[--magazine.count]);
+}
+
+void* KmallocPerCpuCaches::try_allocate(size_t size, size_t alignment, CallerWillInitializeMemory caller_will_initialize_memory)
+{
+    auto class_index = size_class_index(size, alignment);
+    if (!class_index.has_value())
+        return nullptr;
+
+    auto& magazine = m_caches[Processor::current_id()].magazines[class_index.value()];
+    SpinlockLocker locker(magazine.lock);
+    if (magazine.count == 0)
+        refill(magazine, class_index.value());
+    if (magazine.count == 0)
+        return nullptr;
+
+    auto* ptr = magazine.objects[--magazine.count];
+    kmalloc_poison_on_allocate(ptr, g_kmalloc_global->slabheaps[class_index.value()].slab_size(), caller_will_initialize_memory);
+    return ptr;
+}
+
+bool KmallocPerCpuCaches::try_deallocate(void* ptr, size_t size)
+{
+    auto class_index = size_class_index(size, 1);
+    if (!class_index.has_value())
+        return false;
+
+    auto& magazine = m_caches[Processor::current_id()].magazines[class_index.value()];
+    SpinlockLocker locker(magazine.lock);
+    if (magazine.count == magazine_capacity)
+        drain_half(magazine, class_index.value());
+
+    kmalloc_poison_on_deallocate(ptr, g_kmalloc_global->slabheaps[class_index.value()].slab_size());
+    magazine.objects[magazine.count++] = ptr;
+    return true;
+}
+
 void kmalloc_enable_expand()
 {
     g_kmalloc_global->enable_expansion();
@@ -431,15 +601,18 @@ static void* kmalloc_impl(size_t size, size_t alignment, CallerWillInitializeMem
     // Alignment must be a power of two.
     VERIFY(is_power_of_two(alignment));
 
-    SpinlockLocker lock(s_lock);
-    ++g_kmalloc_call_count;
+    g_kmalloc_call_count.fetch_add(1, AK::memory_order_relaxed);
 
     if (g_dump_kmalloc_stacks && Kernel::g_kernel_symbols_available) {
         dbgln("kmalloc({})", size);
         Kernel::dump_backtrace();
     }
 
-    void* ptr = g_kmalloc_global->allocate(size, alignment, caller_will_initialize_memory);
+    void* ptr = g_kmalloc_percpu_caches.try_allocate(size, alignment, caller_will_initialize_memory);
+    if (!ptr) {
+        SpinlockLocker lock(s_lock);
+        ptr = g_kmalloc_global->allocate(size, alignment, caller_will_initialize_memory);
+    }
 
     Thread* current_thread = Thread::current();
     if (!current_thread)
@@ -482,8 +655,23 @@ void kfree_sized(void* ptr, size_t size)
         Processor::verify_no_spinlocks_held();
     }
 
+    g_kfree_call_count.fetch_add(1, AK::memory_order_relaxed);
+
+    // Nested kfree calls only happen under the global lock (e.g. when a
+    // slabheap purges an empty block), so a call that the per-CPU cache can
+    // absorb is always outermost.
+    if (g_kmalloc_percpu_caches.try_deallocate(ptr, size)) {
+        Thread* current_thread = Thread::current();
+        if (!current_thread)
+            current_thread = Processor::idle_thread();
+        if (current_thread) {
+            VERIFY(current_thread->is_allocation_enabled());
+            PerformanceManager::add_kfree_perf_event(*current_thread, 0, (FlatPtr)ptr);
+        }
+        return;
+    }
+
     SpinlockLocker lock(s_lock);
-    ++g_kfree_call_count;
     ++g_nested_kfree_calls;
 
     if (g_nested_kfree_calls == 1) {
@@ -584,6 +772,6 @@ void get_kmalloc_stats(kmalloc_stats& stats)
     SpinlockLocker lock(s_lock);
     stats.bytes_allocated = g_kmalloc_global->allocated_bytes();
     stats.bytes_free = g_kmalloc_global->free_bytes();
-    stats.kmalloc_call_count = g_kmalloc_call_count;
-    stats.kfree_call_count = g_kfree_call_count;
+    stats.kmalloc_call_count = g_kmalloc_call_count.load(AK::memory_order_relaxed);
+    stats.kfree_call_count = g_kfree_call_count.load(AK::memory_order_relaxed);
 }
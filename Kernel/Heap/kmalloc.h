@@ -12,6 +12,15 @@
 #define KMALLOC_SCRUB_BYTE 0xbb
 #define KFREE_SCRUB_BYTE 0xaa
 
+// Selects how aggressively the kernel heap scrubs memory:
+//   2 - scrub every byte of every allocation and free (best diagnostics)
+//   1 - write a small canary into each freed slab, verify it on the next
+//       allocation, and only fully scrub a sampled 1/64 of operations,
+//       recovering the memset bandwidth full scrubbing burns on hot paths
+#ifndef KMALLOC_HARDENING_LEVEL
+#    define KMALLOC_HARDENING_LEVEL 1
+#endif
+
 #define MAKE_ALIGNED_ALLOCATED(type, alignment)                              \
 public:                                                                      \
     [[nodiscard]] void* operator new(size_t)                                 \
@@ -9,63 +9,70 @@
 
 namespace Kernel {
 
-inline bool KBufferBuilder::check_expand(size_t size)
+ErrorOr<void> KBufferBuilder::allocate_chunk(size_t minimum_size)
 {
-    if (!m_buffer)
-        return false;
-    if ((m_size + size) < m_buffer->capacity())
-        return true;
-    if (Checked<size_t>::addition_would_overflow(m_size, size))
-        return false;
-    size_t new_buffer_size = m_size + size;
-    if (Checked<size_t>::addition_would_overflow(new_buffer_size, 1 * MiB))
-        return false;
-    auto rounded_new_buffer_size_or_error = Memory::page_round_up(new_buffer_size + 1 * MiB);
-    if (rounded_new_buffer_size_or_error.is_error()) {
-        return false;
-    }
-    auto new_buffer_or_error = KBuffer::try_create_with_size("KBufferBuilder"sv, rounded_new_buffer_size_or_error.value());
-    if (new_buffer_or_error.is_error())
-        return false;
-    auto new_buffer = new_buffer_or_error.release_value();
-    memcpy(new_buffer->data(), m_buffer->data(), m_buffer->size());
-    m_buffer = move(new_buffer);
-    return true;
-}
-
-bool KBufferBuilder::flush()
-{
-    if (!m_buffer)
-        return false;
-    m_buffer->set_size(m_size);
-    return true;
+    // Chunk sizes double up to a cap, so even multi-megabyte outputs only
+    // need a handful of region allocations, while small /sys and /proc
+    // reads stay at a single 64 KiB chunk.
+    size_t chunk_size = max(m_next_chunk_size, TRY(Memory::page_round_up(minimum_size)));
+    auto chunk = TRY(KBuffer::try_create_with_size("KBufferBuilder"sv, chunk_size));
+    TRY(m_chunks.try_append(move(chunk)));
+    m_last_chunk_used = 0;
+    m_next_chunk_size = min(chunk_size * 2, maximum_chunk_size);
+    return {};
 }
 
 OwnPtr<KBuffer> KBufferBuilder::build()
 {
-    if (!flush())
+    // The common case of a single chunk needs no copying at all.
+    if (m_chunks.size() == 1) {
+        auto buffer = m_chunks.take_first();
+        buffer->set_size(m_size);
+        m_size = 0;
+        m_last_chunk_used = 0;
+        return buffer;
+    }
+
+    auto buffer_or_error = KBuffer::try_create_with_size("KBufferBuilder"sv, max(m_size, static_cast<size_t>(PAGE_SIZE)));
+    if (buffer_or_error.is_error())
         return {};
+    auto buffer = buffer_or_error.release_value();
 
-    return move(m_buffer);
-}
+    size_t offset = 0;
+    for (size_t i = 0; i < m_chunks.size(); ++i) {
+        auto& chunk = *m_chunks[i];
+        size_t chunk_used = (i == m_chunks.size() - 1) ? m_last_chunk_used : chunk.capacity();
+        memcpy(buffer->data() + offset, chunk.data(), chunk_used);
+        offset += chunk_used;
+    }
+    VERIFY(offset == m_size);
+    buffer->set_size(m_size);
 
-ErrorOr<KBufferBuilder> KBufferBuilder::try_create()
-{
-    auto buffer = TRY(KBuffer::try_create_with_size("KBufferBuilder"sv, 4 * MiB, Memory::Region::Access::ReadWrite));
-    return KBufferBuilder { move(buffer) };
+    m_chunks.clear();
+    m_size = 0;
+    m_last_chunk_used = 0;
+    return buffer;
 }
 
-KBufferBuilder::KBufferBuilder(NonnullOwnPtr<KBuffer> buffer)
-    : m_buffer(move(buffer))
+ErrorOr<KBufferBuilder> KBufferBuilder::try_create()
 {
+    return KBufferBuilder {};
 }
 
 ErrorOr<void> KBufferBuilder::append_bytes(ReadonlyBytes bytes)
 {
-    if (!check_expand(bytes.size()))
+    if (Checked<size_t>::addition_would_overflow(m_size, bytes.size()))
         return ENOMEM;
-    memcpy(insertion_ptr(), bytes.data(), bytes.size());
-    m_size += bytes.size();
+    while (!bytes.is_empty()) {
+        if (m_chunks.is_empty() || m_last_chunk_used == m_chunks.last()->capacity())
+            TRY(allocate_chunk(bytes.size()));
+        auto& chunk = *m_chunks.last();
+        size_t to_copy = min(bytes.size(), chunk.capacity() - m_last_chunk_used);
+        memcpy(chunk.data() + m_last_chunk_used, bytes.data(), to_copy);
+        m_last_chunk_used += to_copy;
+        m_size += to_copy;
+        bytes = bytes.slice(to_copy);
+    }
     return {};
 }
 
@@ -73,31 +80,19 @@ ErrorOr<void> KBufferBuilder::append(StringView str)
 {
     if (str.is_empty())
         return {};
-    if (!check_expand(str.length()))
-        return ENOMEM;
-    memcpy(insertion_ptr(), str.characters_without_null_termination(), str.length());
-    m_size += str.length();
-    return {};
+    return append_bytes(str.bytes());
 }
 
 ErrorOr<void> KBufferBuilder::append(char const* characters, int length)
 {
     if (!length)
         return {};
-    if (!check_expand(length))
-        return ENOMEM;
-    memcpy(insertion_ptr(), characters, length);
-    m_size += length;
-    return {};
+    return append_bytes(ReadonlyBytes { characters, static_cast<size_t>(length) });
 }
 
 ErrorOr<void> KBufferBuilder::append(char ch)
 {
-    if (!check_expand(1))
-        return ENOMEM;
-    insertion_ptr()[0] = ch;
-    m_size += 1;
-    return {};
+    return append_bytes(ReadonlyBytes { &ch, 1 });
 }
 
 ErrorOr<void> KBufferBuilder::append_escaped_for_json(StringView string)
@@ -8,11 +8,16 @@
 
 #include <AK/StringBuilder.h>
 #include <AK/StringView.h>
+#include <AK/Vector.h>
 #include <Kernel/KBuffer.h>
 #include <stdarg.h>
 
 namespace Kernel {
 
+// KBufferBuilder appends into a list of KBuffer chunks and only materializes
+// a single contiguous KBuffer in build(). This keeps appends linear: growing
+// never re-copies what has already been written, unlike a single reallocated
+// buffer which copies the same bytes over and over for large outputs.
 class KBufferBuilder {
     AK_MAKE_NONCOPYABLE(KBufferBuilder);
 
@@ -42,33 +47,24 @@ public:
         return append_bytes(builder.string_view().bytes());
     }
 
-    bool flush();
     OwnPtr<KBuffer> build();
 
-    ReadonlyBytes bytes() const
-    {
-        if (!m_buffer)
-            return {};
-        return m_buffer->bytes();
-    }
-
     size_t length() const
     {
         return m_size;
     }
 
 private:
-    explicit KBufferBuilder(NonnullOwnPtr<KBuffer>);
+    KBufferBuilder() = default;
 
-    bool check_expand(size_t);
-    u8* insertion_ptr()
-    {
-        if (!m_buffer)
-            return nullptr;
-        return m_buffer->data() + m_size;
-    }
+    ErrorOr<void> allocate_chunk(size_t minimum_size);
+
+    static constexpr size_t initial_chunk_size = 64 * KiB;
+    static constexpr size_t maximum_chunk_size = 4 * MiB;
 
-    OwnPtr<KBuffer> m_buffer;
+    Vector<NonnullOwnPtr<KBuffer>> m_chunks;
+    size_t m_last_chunk_used { 0 };
+    size_t m_next_chunk_size { initial_chunk_size };
     size_t m_size { 0 };
 };
 
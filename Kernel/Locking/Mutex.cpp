@@ -11,11 +11,36 @@
 #include <Kernel/Locking/Mutex.h>
 #include <Kernel/Locking/Spinlock.h>
 #include <Kernel/Thread.h>
+#include <Kernel/Time/TimeManagement.h>
 
 extern bool g_in_early_boot;
 
 namespace Kernel {
 
+// NOTE: These are zero-initialized before any global constructors run, so
+//       mutexes constructed during static initialization can register safely.
+static Spinlock<LockRank::None> s_all_mutexes_lock {};
+static Mutex::AllMutexesList s_all_mutexes;
+
+void Mutex::register_mutex(Mutex& mutex)
+{
+    SpinlockLocker lock(s_all_mutexes_lock);
+    s_all_mutexes.append(mutex);
+}
+
+void Mutex::unregister_mutex(Mutex& mutex)
+{
+    SpinlockLocker lock(s_all_mutexes_lock);
+    s_all_mutexes.remove(mutex);
+}
+
+void Mutex::for_each_mutex(Function<void(Mutex const&)> callback)
+{
+    SpinlockLocker lock(s_all_mutexes_lock);
+    for (auto const& mutex : s_all_mutexes)
+        callback(mutex);
+}
+
 void Mutex::lock(Mode mode, [[maybe_unused]] LockLocation const& location)
 {
     // NOTE: This may be called from an interrupt handler (not an IRQ handler)
@@ -30,6 +55,7 @@ void Mutex::lock(Mode mode, [[maybe_unused]] LockLocation const& location)
     auto* current_thread = Thread::current();
 
     SpinlockLocker lock(m_lock);
+    m_times_acquired++;
     bool did_block = false;
     Mode current_mode = m_mode;
     switch (current_mode) {
@@ -230,10 +256,27 @@ void Mutex::block(Thread& current_thread, Mode mode, SpinlockLocker<Spinlock<Loc
             append_to_list(lists.list_for_mode(mode));
     });
 
+    // NOTE: TimeManagement is always up by the time anything can block, but
+    //       be defensive in case that ever changes.
+    bool track_wait_time = TimeManagement::is_initialized();
+    Time wait_start = {};
+    if (track_wait_time)
+        wait_start = TimeManagement::the().monotonic_time(TimePrecision::Precise);
+
     dbgln_if(LOCK_TRACE_DEBUG, "Mutex::lock @ {} ({}) waiting...", this, m_name);
     current_thread.block(*this, lock, requested_locks);
     dbgln_if(LOCK_TRACE_DEBUG, "Mutex::lock @ {} ({}) waited", this, m_name);
 
+    // NOTE: m_lock is held again after waking up, so it's safe to update the
+    //       contention statistics here.
+    m_times_contended++;
+    if (track_wait_time) {
+        auto wait_ns = static_cast<u64>((TimeManagement::the().monotonic_time(TimePrecision::Precise) - wait_start).to_nanoseconds());
+        m_total_wait_ns += wait_ns;
+        if (wait_ns > m_max_wait_ns)
+            m_max_wait_ns = wait_ns;
+    }
+
     m_blocked_thread_lists.with([&](auto& lists) {
         auto remove_from_list = [&]<typename L>(L& list) {
             VERIFY(list.contains(current_thread));
@@ -9,7 +9,9 @@
 
 #include <AK/Assertions.h>
 #include <AK/Atomic.h>
+#include <AK/Function.h>
 #include <AK/HashMap.h>
+#include <AK/IntrusiveList.h>
 #include <AK/Types.h>
 #include <Kernel/Forward.h>
 #include <Kernel/Locking/LockLocation.h>
@@ -37,8 +39,12 @@ public:
         : m_name(name)
         , m_behavior(behavior)
     {
+        register_mutex(*this);
+    }
+    ~Mutex()
+    {
+        unregister_mutex(*this);
     }
-    ~Mutex() = default;
 
     void lock(Mode mode = Mode::Exclusive, LockLocation const& location = LockLocation::current());
     void restore_exclusive_lock(u32, LockLocation const& location = LockLocation::current());
@@ -62,6 +68,22 @@ public:
 
     [[nodiscard]] StringView name() const { return m_name; }
 
+    struct ContentionStats {
+        u64 times_acquired { 0 };
+        u64 times_contended { 0 };
+        u64 total_wait_ns { 0 };
+        u64 max_wait_ns { 0 };
+    };
+
+    ContentionStats contention_stats() const
+    {
+        SpinlockLocker lock(m_lock);
+        return { m_times_acquired, m_times_contended, m_total_wait_ns, m_max_wait_ns };
+    }
+
+    // Invokes the callback for every Mutex currently alive, for /sys/kernel/lock_stats.
+    static void for_each_mutex(Function<void(Mutex const&)>);
+
     static StringView mode_to_string(Mode mode)
     {
         switch (mode) {
@@ -86,6 +108,9 @@ private:
     void block(Thread&, Mode, SpinlockLocker<Spinlock<LockRank::None>>&, u32);
     void unblock_waiters(Mode);
 
+    static void register_mutex(Mutex&);
+    static void unregister_mutex(Mutex&);
+
     StringView m_name;
     Mode m_mode { Mode::Unlocked };
 
@@ -123,6 +148,19 @@ private:
     // FIXME: See above.
     mutable Spinlock<LockRank::None> m_lock {};
 
+    // Contention statistics, protected by m_lock and exported via
+    // /sys/kernel/lock_stats.
+    u64 m_times_acquired { 0 };
+    u64 m_times_contended { 0 };
+    u64 m_total_wait_ns { 0 };
+    u64 m_max_wait_ns { 0 };
+
+    IntrusiveListNode<Mutex> m_all_mutexes_list_node;
+
+public:
+    using AllMutexesList = IntrusiveList<&Mutex::m_all_mutexes_list_node>;
+
+private:
 #if LOCK_SHARED_UPGRADE_DEBUG
     HashMap<Thread*, u32> m_shared_holders_map;
 #endif
@@ -109,9 +109,16 @@ ErrorOr<void> AddressSpace::unmap_mmap_range(VirtualAddress addr, size_t size)
 
     Vector<Region*, 2> new_regions;
 
+    // Unmap the whole batch of regions with a single ranged TLB flush at the
+    // end, instead of broadcasting one flush (and its IPIs) per region.
+    // NOTE: find_regions_intersecting() returns the regions in address order.
+    auto flush_range_base = regions.first()->range().base();
+    auto flush_range_end = regions.last()->range().end();
+
     for (auto* old_region : regions) {
         // If it's a full match we can remove the entire old region.
         if (old_region->range().intersect(range_to_unmap).size() == old_region->size()) {
+            old_region->unmap(ShouldFlushTLB::No);
             deallocate_region(*old_region);
             continue;
         }
@@ -119,13 +126,15 @@ ErrorOr<void> AddressSpace::unmap_mmap_range(VirtualAddress addr, size_t size)
         // Remove the old region from our regions tree, since were going to add another region
         // with the exact same start address.
         auto region = take_region(*old_region);
-        region->unmap();
+        region->unmap(ShouldFlushTLB::No);
 
         // Otherwise, split the regions and collect them for future mapping.
         auto split_regions = TRY(try_split_region_around_range(*region, range_to_unmap));
         TRY(new_regions.try_extend(split_regions));
     }
 
+    MemoryManager::flush_tlb(m_page_directory, flush_range_base, (flush_range_end.get() - flush_range_base.get()) / PAGE_SIZE);
+
     // And finally map the new region(s) into our page directory.
     for (auto* new_region : new_regions) {
         // TODO: Ideally we should do this in a way that can be rolled back on failure, as failing here
@@ -318,64 +318,92 @@ size_t AnonymousVMObject::cow_pages() const
 
 PageFaultResponse AnonymousVMObject::handle_cow_fault(size_t page_index, VirtualAddress vaddr)
 {
-    SpinlockLocker lock(m_lock);
+    LockRefPtr<SharedCommittedCowPages> committed_cow_pages;
+    {
+        SpinlockLocker lock(m_lock);
 
-    if (is_volatile()) {
-        // A COW fault in a volatile region? Userspace is writing to volatile memory, this is a bug. Crash.
-        dbgln("COW fault in volatile region, will crash.");
-        return PageFaultResponse::ShouldCrash;
-    }
+        if (is_volatile()) {
+            // A COW fault in a volatile region? Userspace is writing to volatile memory, this is a bug. Crash.
+            dbgln("COW fault in volatile region, will crash.");
+            return PageFaultResponse::ShouldCrash;
+        }
 
-    auto& page_slot = physical_pages()[page_index];
+        auto& page_slot = physical_pages()[page_index];
 
-    // If we were sharing committed COW pages with another process, and the other process
-    // has exhausted the supply, we can stop counting the shared pages.
-    if (m_shared_committed_cow_pages && m_shared_committed_cow_pages->is_empty())
-        m_shared_committed_cow_pages = nullptr;
+        // If we were sharing committed COW pages with another process, and the other process
+        // has exhausted the supply, we can stop counting the shared pages.
+        if (m_shared_committed_cow_pages && m_shared_committed_cow_pages->is_empty())
+            m_shared_committed_cow_pages = nullptr;
+
+        if (!m_cow_map.is_null() && !m_cow_map.get(page_index)) {
+            // Another thread in this process already broke this page's CoW
+            // while we were taking the fault; all we have to do is remap.
+            return PageFaultResponse::Continue;
+        }
 
-    if (page_slot->ref_count() == 1) {
-        dbgln_if(PAGE_FAULT_DEBUG, "    >> It's a COW page but nobody is sharing it anymore. Remap r/w");
-        MUST(set_should_cow(page_index, false)); // If we received a COW fault, we already have a cow map allocated, so this is infallible
+        if (page_slot->ref_count() == 1) {
+            dbgln_if(PAGE_FAULT_DEBUG, "    >> It's a COW page but nobody is sharing it anymore. Remap r/w");
+            MUST(set_should_cow(page_index, false)); // If we received a COW fault, we already have a cow map allocated, so this is infallible
 
-        if (m_shared_committed_cow_pages) {
-            m_shared_committed_cow_pages->uncommit_one();
-            if (m_shared_committed_cow_pages->is_empty())
-                m_shared_committed_cow_pages = nullptr;
+            if (m_shared_committed_cow_pages) {
+                m_shared_committed_cow_pages->uncommit_one();
+                if (m_shared_committed_cow_pages->is_empty())
+                    m_shared_committed_cow_pages = nullptr;
+            }
+            return PageFaultResponse::Continue;
         }
-        return PageFaultResponse::Continue;
+
+        committed_cow_pages = m_shared_committed_cow_pages;
     }
 
+    // Allocate the new page and copy into it WITHOUT holding the object
+    // lock, so that other threads of a forked process can break CoW on
+    // other pages concurrently instead of serializing on every fault.
     RefPtr<PhysicalPage> page;
-    if (m_shared_committed_cow_pages) {
+    if (committed_cow_pages) {
         dbgln_if(PAGE_FAULT_DEBUG, "    >> It's a committed COW page and it's time to COW!");
-        page = m_shared_committed_cow_pages->take_one();
-    } else {
+        page = committed_cow_pages->try_take_one();
+    }
+    if (!page) {
         dbgln_if(PAGE_FAULT_DEBUG, "    >> It's a COW page and it's time to COW!");
         auto page_or_error = MM.allocate_physical_page(MemoryManager::ShouldZeroFill::No);
         if (page_or_error.is_error()) {
             dmesgln("MM: handle_cow_fault was unable to allocate a physical page");
             return PageFaultResponse::OutOfMemory;
         }
+        committed_cow_pages = nullptr;
         page = page_or_error.release_value();
     }
 
-    dbgln_if(PAGE_FAULT_DEBUG, "      >> COW {} <- {}", page->paddr(), page_slot->paddr());
     {
         u8* dest_ptr = MM.quickmap_page(*page);
         SmapDisabler disabler;
         void* fault_at;
         if (!safe_memcpy(dest_ptr, vaddr.as_ptr(), PAGE_SIZE, fault_at)) {
             if ((u8*)fault_at >= dest_ptr && (u8*)fault_at <= dest_ptr + PAGE_SIZE)
-                dbgln("      >> COW: error copying page {}/{} to {}/{}: failed to write to page at {}",
-                    page_slot->paddr(), vaddr, page->paddr(), VirtualAddress(dest_ptr), VirtualAddress(fault_at));
+                dbgln("      >> COW: error copying page {} to {}/{}: failed to write to page at {}",
+                    vaddr, page->paddr(), VirtualAddress(dest_ptr), VirtualAddress(fault_at));
             else if ((u8*)fault_at >= vaddr.as_ptr() && (u8*)fault_at <= vaddr.as_ptr() + PAGE_SIZE)
-                dbgln("      >> COW: error copying page {}/{} to {}/{}: failed to read from page at {}",
-                    page_slot->paddr(), vaddr, page->paddr(), VirtualAddress(dest_ptr), VirtualAddress(fault_at));
+                dbgln("      >> COW: error copying page {} to {}/{}: failed to read from page at {}",
+                    vaddr, page->paddr(), VirtualAddress(dest_ptr), VirtualAddress(fault_at));
             else
                 VERIFY_NOT_REACHED();
         }
         MM.unquickmap_page();
     }
+
+    SpinlockLocker lock(m_lock);
+
+    if (!m_cow_map.is_null() && !m_cow_map.get(page_index)) {
+        // Somebody else broke this page's CoW in the meantime, and whatever
+        // we copied may be torn; their copy wins and ours goes back.
+        if (committed_cow_pages)
+            committed_cow_pages->return_one(page.release_nonnull());
+        return PageFaultResponse::Continue;
+    }
+
+    auto& page_slot = physical_pages()[page_index];
+    dbgln_if(PAGE_FAULT_DEBUG, "      >> COW {} <- {}", page->paddr(), page_slot->paddr());
     page_slot = move(page);
     MUST(set_should_cow(page_index, false)); // If we received a COW fault, we already have a cow map allocated, so this is infallible
     return PageFaultResponse::Continue;
@@ -388,12 +416,20 @@ AnonymousVMObject::SharedCommittedCowPages::SharedCommittedCowPages(CommittedPhy
 
 AnonymousVMObject::SharedCommittedCowPages::~SharedCommittedCowPages() = default;
 
-NonnullRefPtr<PhysicalPage> AnonymousVMObject::SharedCommittedCowPages::take_one()
+RefPtr<PhysicalPage> AnonymousVMObject::SharedCommittedCowPages::try_take_one()
 {
     SpinlockLocker locker(m_lock);
+    if (m_committed_pages.is_empty())
+        return {};
     return m_committed_pages.take_one();
 }
 
+void AnonymousVMObject::SharedCommittedCowPages::return_one(NonnullRefPtr<PhysicalPage> page)
+{
+    SpinlockLocker locker(m_lock);
+    m_committed_pages.return_one(move(page));
+}
+
 void AnonymousVMObject::SharedCommittedCowPages::uncommit_one()
 {
     SpinlockLocker locker(m_lock);
@@ -74,7 +74,8 @@ private:
 
         [[nodiscard]] bool is_empty() const { return m_committed_pages.is_empty(); }
 
-        [[nodiscard]] NonnullRefPtr<PhysicalPage> take_one();
+        [[nodiscard]] RefPtr<PhysicalPage> try_take_one();
+        void return_one(NonnullRefPtr<PhysicalPage>);
         void uncommit_one();
 
     private:
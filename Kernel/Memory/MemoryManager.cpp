@@ -23,6 +23,7 @@
 #include <Kernel/Memory/SharedInodeVMObject.h>
 #include <Kernel/Multiboot.h>
 #include <Kernel/Panic.h>
+#include <Kernel/PerCpuCounter.h>
 #include <Kernel/Prekernel/Prekernel.h>
 #include <Kernel/Process.h>
 #include <Kernel/Sections.h>
@@ -572,10 +573,26 @@ PageTableEntry* MemoryManager::pte(PageDirectory& page_directory, VirtualAddress
     PageDirectoryEntry const& pde = pd[page_directory_index];
     if (!pde.is_present())
         return nullptr;
+#if ARCH(X86_64)
+    // A huge-page PDE maps data directly, there are no PTEs below it.
+    if (pde.is_huge())
+        return nullptr;
+#endif
 
     return &quickmap_pt(PhysicalAddress((FlatPtr)pde.page_table_base()))[page_table_index];
 }
 
+PageDirectoryEntry* MemoryManager::pde(PageDirectory& page_directory, VirtualAddress vaddr)
+{
+    VERIFY_INTERRUPTS_DISABLED();
+    VERIFY(page_directory.get_lock().is_locked_by_current_processor());
+    u32 page_directory_table_index = (vaddr.get() >> 30) & 0x1ff;
+    u32 page_directory_index = (vaddr.get() >> 21) & 0x1ff;
+
+    auto* pd = quickmap_pd(page_directory, page_directory_table_index);
+    return &pd[page_directory_index];
+}
+
 PageTableEntry* MemoryManager::ensure_pte(PageDirectory& page_directory, VirtualAddress vaddr)
 {
     VERIFY_INTERRUPTS_DISABLED();
@@ -586,8 +603,14 @@ PageTableEntry* MemoryManager::ensure_pte(PageDirectory& page_directory, Virtual
 
     auto* pd = quickmap_pd(page_directory, page_directory_table_index);
     auto& pde = pd[page_directory_index];
-    if (pde.is_present())
+    if (pde.is_present()) {
+#if ARCH(X86_64)
+        // Regions mapped with huge pages must be demoted before any 4 KiB
+        // mapping can be placed in their range.
+        VERIFY(!pde.is_huge());
+#endif
         return &quickmap_pt(PhysicalAddress(pde.page_table_base()))[page_table_index];
+    }
 
     bool did_purge = false;
     auto page_table_or_error = allocate_physical_page(ShouldZeroFill::Yes, &did_purge);
@@ -628,6 +651,14 @@ void MemoryManager::release_pte(PageDirectory& page_directory, VirtualAddress va
     auto* pd = quickmap_pd(page_directory, page_directory_table_index);
     PageDirectoryEntry& pde = pd[page_directory_index];
     if (pde.is_present()) {
+#if ARCH(X86_64)
+        if (pde.is_huge()) {
+            // A huge-page PDE maps data directly, so there is no page table
+            // to release; the data pages are owned by the VMObject.
+            pde.clear();
+            return;
+        }
+#endif
         auto* page_table = quickmap_pt(PhysicalAddress((FlatPtr)pde.page_table_base()));
         auto& pte = page_table[page_table_index];
         pte.clear();
@@ -728,8 +759,12 @@ Region* MemoryManager::find_region_from_vaddr(VirtualAddress vaddr)
     return find_user_region_from_vaddr(*page_directory->address_space(), vaddr);
 }
 
+static PerCpuCounter s_page_fault_counter { "memory.page_faults"sv };
+
 PageFaultResponse MemoryManager::handle_page_fault(PageFault const& fault)
 {
+    s_page_fault_counter.increment();
+
     auto faulted_in_range = [&fault](auto const* start, auto const* end) {
         return fault.vaddr() >= VirtualAddress { start } && fault.vaddr() < VirtualAddress { end };
     };
@@ -767,7 +802,10 @@ ErrorOr<NonnullOwnPtr<Region>> MemoryManager::allocate_contiguous_kernel_region(
         name_kstring = TRY(KString::try_create(name));
     auto vmobject = TRY(AnonymousVMObject::try_create_physically_contiguous_with_size(size));
     auto region = TRY(Region::create_unplaced(move(vmobject), 0, move(name_kstring), access, cacheable));
-    TRY(m_global_data.with([&](auto& global_data) { return global_data.region_tree.place_anywhere(*region, RandomizeVirtualAddress::No, size); }));
+    // Align large regions so that they are eligible for huge-page mappings
+    // if the backing memory happens to be suitably aligned as well.
+    size_t alignment = (size % (2 * MiB) == 0) ? 2 * MiB : PAGE_SIZE;
+    TRY(m_global_data.with([&](auto& global_data) { return global_data.region_tree.place_anywhere(*region, RandomizeVirtualAddress::No, size, alignment); }));
     TRY(region->map(kernel_page_directory()));
     return region;
 }
@@ -845,16 +883,25 @@ ErrorOr<NonnullOwnPtr<Region>> MemoryManager::allocate_kernel_region_with_vmobje
 ErrorOr<CommittedPhysicalPageSet> MemoryManager::commit_physical_pages(size_t page_count)
 {
     VERIFY(page_count > 0);
-    auto result = m_global_data.with([&](auto& global_data) -> ErrorOr<CommittedPhysicalPageSet> {
-        if (global_data.system_memory_info.physical_pages_uncommitted < page_count) {
-            dbgln("MM: Unable to commit {} pages, have only {}", page_count, global_data.system_memory_info.physical_pages_uncommitted);
-            return ENOMEM;
-        }
+    auto try_commit = [&]() -> ErrorOr<CommittedPhysicalPageSet> {
+        return m_global_data.with([&](auto& global_data) -> ErrorOr<CommittedPhysicalPageSet> {
+            if (global_data.system_memory_info.physical_pages_uncommitted < page_count) {
+                dbgln("MM: Unable to commit {} pages, have only {}", page_count, global_data.system_memory_info.physical_pages_uncommitted);
+                return ENOMEM;
+            }
 
-        global_data.system_memory_info.physical_pages_uncommitted -= page_count;
-        global_data.system_memory_info.physical_pages_committed += page_count;
-        return CommittedPhysicalPageSet { {}, page_count };
-    });
+            global_data.system_memory_info.physical_pages_uncommitted -= page_count;
+            global_data.system_memory_info.physical_pages_committed += page_count;
+            return CommittedPhysicalPageSet { {}, page_count };
+        });
+    };
+    auto result = try_commit();
+    if (result.is_error()) {
+        // Free pages parked in the per-CPU caches are no longer part of the
+        // uncommitted pool; reclaim them and try once more before giving up.
+        drain_physical_page_caches();
+        result = try_commit();
+    }
     if (result.is_error()) {
         Process::for_each_ignoring_jails([&](Process const& process) {
             size_t amount_resident = 0;
@@ -889,6 +936,20 @@ void MemoryManager::uncommit_physical_pages(Badge<CommittedPhysicalPageSet>, siz
     });
 }
 
+void MemoryManager::recommit_physical_page(Badge<CommittedPhysicalPageSet>, NonnullRefPtr<PhysicalPage> page)
+{
+    m_global_data.with([&](auto& global_data) {
+        // Dropping the last reference frees the page back to its region and
+        // bumps physical_pages_uncommitted; move that page back under the
+        // committed count so the commitment it came from stays covered.
+        { RefPtr<PhysicalPage> released_page = move(page); }
+
+        VERIFY(global_data.system_memory_info.physical_pages_uncommitted > 0);
+        global_data.system_memory_info.physical_pages_uncommitted--;
+        global_data.system_memory_info.physical_pages_committed++;
+    });
+}
+
 void MemoryManager::deallocate_physical_page(PhysicalAddress paddr)
 {
     return m_global_data.with([&](auto& global_data) {
@@ -939,8 +1000,102 @@ RefPtr<PhysicalPage> MemoryManager::find_free_physical_page(bool committed)
     return page;
 }
 
+RefPtr<PhysicalPage> MemoryManager::take_cached_physical_page()
+{
+    // NOTE: Holding the cache lock disables interrupts, so we can't get
+    //       migrated to another CPU while working on this cache.
+    auto& cache = m_physical_page_caches[Processor::current_id()];
+    SpinlockLocker locker(cache.lock);
+    if (cache.count == 0) {
+        // Refill with half the capacity, which amortizes the global lock
+        // acquisition without parking too many pages on an idle CPU.
+        m_global_data.with([&](auto& global_data) {
+            size_t refill_count = min(PhysicalPageCache::capacity / 2, static_cast<size_t>(global_data.system_memory_info.physical_pages_uncommitted));
+            for (size_t i = 0; i < refill_count; ++i) {
+                auto page = find_free_physical_page(false);
+                if (page.is_null())
+                    break;
+                cache.pages[cache.count++] = move(page);
+            }
+        });
+    }
+    if (cache.count == 0)
+        return {};
+    return move(cache.pages[--cache.count]);
+}
+
+RefPtr<PhysicalPage> MemoryManager::take_pre_zeroed_physical_page()
+{
+    SpinlockLocker locker(m_pre_zeroed_page_pool.lock);
+    if (m_pre_zeroed_page_pool.count == 0)
+        return {};
+    return move(m_pre_zeroed_page_pool.pages[--m_pre_zeroed_page_pool.count]);
+}
+
+void MemoryManager::refill_pre_zeroed_page_pool()
+{
+    // Stop refilling while physical memory is scarce; pooled pages would
+    // just get drained again by the next failing commit.
+    static constexpr size_t uncommitted_pages_slack = 1 * MiB / PAGE_SIZE;
+
+    for (;;) {
+        {
+            SpinlockLocker locker(m_pre_zeroed_page_pool.lock);
+            if (m_pre_zeroed_page_pool.count == PreZeroedPagePool::capacity)
+                return;
+        }
+        bool has_slack = m_global_data.with([&](auto& global_data) {
+            return global_data.system_memory_info.physical_pages_uncommitted >= uncommitted_pages_slack;
+        });
+        if (!has_slack)
+            return;
+        auto page = find_free_physical_page(false);
+        if (page.is_null())
+            return;
+        {
+            InterruptDisabler disabler;
+            auto* ptr = quickmap_page(*page);
+            memset(ptr, 0, PAGE_SIZE);
+            unquickmap_page();
+        }
+        SpinlockLocker locker(m_pre_zeroed_page_pool.lock);
+        if (m_pre_zeroed_page_pool.count == PreZeroedPagePool::capacity)
+            return;
+        m_pre_zeroed_page_pool.pages[m_pre_zeroed_page_pool.count++] = move(page);
+    }
+}
+
+void MemoryManager::drain_physical_page_caches()
+{
+    // NOTE: Dropping the last reference returns each page to the uncommitted
+    //       pool via deallocate_physical_page(). We only ever take a cache
+    //       lock before m_global_data (never the other way around), so this
+    //       is deadlock-free against concurrent refills.
+    for (auto& cache : m_physical_page_caches) {
+        SpinlockLocker locker(cache.lock);
+        while (cache.count > 0)
+            cache.pages[--cache.count] = nullptr;
+    }
+    SpinlockLocker locker(m_pre_zeroed_page_pool.lock);
+    while (m_pre_zeroed_page_pool.count > 0)
+        m_pre_zeroed_page_pool.pages[--m_pre_zeroed_page_pool.count] = nullptr;
+}
+
 NonnullRefPtr<PhysicalPage> MemoryManager::allocate_committed_physical_page(Badge<CommittedPhysicalPageSet>, ShouldZeroFill should_zero_fill)
 {
+    if (should_zero_fill == ShouldZeroFill::Yes) {
+        if (auto page = take_pre_zeroed_physical_page()) {
+            // The pooled page was drawn from the uncommitted pool, so consume
+            // the commitment and release its reserved page back instead.
+            m_global_data.with([&](auto& global_data) {
+                VERIFY(global_data.system_memory_info.physical_pages_committed > 0);
+                global_data.system_memory_info.physical_pages_committed--;
+                global_data.system_memory_info.physical_pages_uncommitted++;
+            });
+            return page.release_nonnull();
+        }
+    }
+
     auto page = find_free_physical_page(true);
     VERIFY(page);
     if (should_zero_fill == ShouldZeroFill::Yes) {
@@ -954,6 +1109,30 @@ NonnullRefPtr<PhysicalPage> MemoryManager::allocate_committed_physical_page(Badg
 
 ErrorOr<NonnullRefPtr<PhysicalPage>> MemoryManager::allocate_physical_page(ShouldZeroFill should_zero_fill, bool* did_purge)
 {
+    if (should_zero_fill == ShouldZeroFill::Yes) {
+        if (auto page = take_pre_zeroed_physical_page()) {
+            if (did_purge)
+                *did_purge = false;
+            return page.release_nonnull();
+        }
+    }
+
+    if (auto page = take_cached_physical_page()) {
+        if (should_zero_fill == ShouldZeroFill::Yes) {
+            InterruptDisabler disabler;
+            auto* ptr = quickmap_page(*page);
+            memset(ptr, 0, PAGE_SIZE);
+            unquickmap_page();
+        }
+        if (did_purge)
+            *did_purge = false;
+        return page.release_nonnull();
+    }
+
+    // The uncommitted pool is empty, but free pages may still be parked in
+    // other CPUs' caches; reclaim those before trying the heavier fallbacks.
+    drain_physical_page_caches();
+
     return m_global_data.with([&](auto&) -> ErrorOr<NonnullRefPtr<PhysicalPage>> {
         auto page = find_free_physical_page(false);
         bool purged_pages = false;
@@ -1009,27 +1188,80 @@ ErrorOr<NonnullRefPtr<PhysicalPage>> MemoryManager::allocate_physical_page(Shoul
     });
 }
 
+ErrorOr<NonnullRefPtrVector<PhysicalPage>> MemoryManager::allocate_physical_pages(size_t page_count, ShouldZeroFill should_zero_fill)
+{
+    VERIFY(page_count > 0);
+
+    // NOTE: Unlike allocate_physical_page(), this takes m_global_data only
+    //       once for the whole batch, but does not try to purge other
+    //       VMObjects when the pool runs dry. A caller that can make progress
+    //       page-by-page should fall back to allocate_physical_page().
+    NonnullRefPtrVector<PhysicalPage> pages;
+    TRY(pages.try_ensure_capacity(page_count));
+
+    auto try_allocate_batch = [&]() -> ErrorOr<void> {
+        return m_global_data.with([&](auto&) -> ErrorOr<void> {
+            while (pages.size() < page_count) {
+                auto page = find_free_physical_page(false);
+                if (page.is_null())
+                    return ENOMEM;
+                if (should_zero_fill == ShouldZeroFill::Yes) {
+                    auto* ptr = quickmap_page(*page);
+                    memset(ptr, 0, PAGE_SIZE);
+                    unquickmap_page();
+                }
+                pages.unchecked_append(page.release_nonnull());
+            }
+            return {};
+        });
+    };
+
+    auto result = try_allocate_batch();
+    if (result.is_error()) {
+        drain_physical_page_caches();
+        result = try_allocate_batch();
+    }
+    if (result.is_error()) {
+        dmesgln("MM: no physical pages available");
+        // NOTE: Dropping `pages` returns whatever we did manage to grab.
+        return result.release_error();
+    }
+    return pages;
+}
+
 ErrorOr<NonnullRefPtrVector<PhysicalPage>> MemoryManager::allocate_contiguous_physical_pages(size_t size)
 {
     VERIFY(!(size % PAGE_SIZE));
     size_t page_count = ceil_div(size, static_cast<size_t>(PAGE_SIZE));
 
-    auto physical_pages = TRY(m_global_data.with([&](auto& global_data) -> ErrorOr<NonnullRefPtrVector<PhysicalPage>> {
-        // We need to make sure we don't touch pages that we have committed to
-        if (global_data.system_memory_info.physical_pages_uncommitted < page_count)
+    auto try_allocate_contiguous = [&]() -> ErrorOr<NonnullRefPtrVector<PhysicalPage>> {
+        return m_global_data.with([&](auto& global_data) -> ErrorOr<NonnullRefPtrVector<PhysicalPage>> {
+            // We need to make sure we don't touch pages that we have committed to
+            if (global_data.system_memory_info.physical_pages_uncommitted < page_count)
+                return ENOMEM;
+
+            for (auto& physical_region : global_data.physical_regions) {
+                auto physical_pages = physical_region.take_contiguous_free_pages(page_count);
+                if (!physical_pages.is_empty()) {
+                    global_data.system_memory_info.physical_pages_uncommitted -= page_count;
+                    global_data.system_memory_info.physical_pages_used += page_count;
+                    return physical_pages;
+                }
+            }
             return ENOMEM;
+        });
+    };
 
-        for (auto& physical_region : global_data.physical_regions) {
-            auto physical_pages = physical_region.take_contiguous_free_pages(page_count);
-            if (!physical_pages.is_empty()) {
-                global_data.system_memory_info.physical_pages_uncommitted -= page_count;
-                global_data.system_memory_info.physical_pages_used += page_count;
-                return physical_pages;
-            }
-        }
+    auto physical_pages_or_error = try_allocate_contiguous();
+    if (physical_pages_or_error.is_error()) {
+        // Pages parked in the per-CPU caches both shrink the uncommitted pool
+        // and fragment the physical regions, so reclaim them and retry.
+        drain_physical_page_caches();
+        physical_pages_or_error = try_allocate_contiguous();
+    }
+    if (physical_pages_or_error.is_error())
         dmesgln("MM: no contiguous physical pages available");
-        return ENOMEM;
-    }));
+    auto physical_pages = TRY(move(physical_pages_or_error));
 
     {
         auto cleanup_region = TRY(MM.allocate_kernel_region(physical_pages[0].paddr(), PAGE_SIZE * page_count, {}, Region::Access::Read | Region::Access::Write));
@@ -1194,6 +1426,12 @@ NonnullRefPtr<PhysicalPage> CommittedPhysicalPageSet::take_one()
     return MM.allocate_committed_physical_page({}, MemoryManager::ShouldZeroFill::Yes);
 }
 
+void CommittedPhysicalPageSet::return_one(NonnullRefPtr<PhysicalPage> page)
+{
+    MM.recommit_physical_page({}, move(page));
+    ++m_page_count;
+}
+
 void CommittedPhysicalPageSet::uncommit_one()
 {
     VERIFY(m_page_count > 0);
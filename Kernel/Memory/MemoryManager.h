@@ -11,6 +11,7 @@
 #include <AK/HashTable.h>
 #include <AK/IntrusiveRedBlackTree.h>
 #include <AK/NonnullOwnPtrVector.h>
+#include <Kernel/Arch/Processor.h>
 #include <Kernel/Forward.h>
 #include <Kernel/Library/NonnullLockRefPtrVector.h>
 #include <Kernel/Locking/Spinlock.h>
@@ -117,6 +118,7 @@ public:
     size_t page_count() const { return m_page_count; }
 
     [[nodiscard]] NonnullRefPtr<PhysicalPage> take_one();
+    void return_one(NonnullRefPtr<PhysicalPage>);
     void uncommit_one();
 
     void operator=(CommittedPhysicalPageSet&&) = delete;
@@ -163,11 +165,17 @@ public:
         Yes
     };
 
+    // Called periodically by the ZeroPageTask to top up the pool of
+    // pre-zeroed pages that zero-fill faults draw from.
+    void refill_pre_zeroed_page_pool();
+
     ErrorOr<CommittedPhysicalPageSet> commit_physical_pages(size_t page_count);
     void uncommit_physical_pages(Badge<CommittedPhysicalPageSet>, size_t page_count);
+    void recommit_physical_page(Badge<CommittedPhysicalPageSet>, NonnullRefPtr<PhysicalPage>);
 
     NonnullRefPtr<PhysicalPage> allocate_committed_physical_page(Badge<CommittedPhysicalPageSet>, ShouldZeroFill = ShouldZeroFill::Yes);
     ErrorOr<NonnullRefPtr<PhysicalPage>> allocate_physical_page(ShouldZeroFill = ShouldZeroFill::Yes, bool* did_purge = nullptr);
+    ErrorOr<NonnullRefPtrVector<PhysicalPage>> allocate_physical_pages(size_t page_count, ShouldZeroFill = ShouldZeroFill::Yes);
     ErrorOr<NonnullRefPtrVector<PhysicalPage>> allocate_contiguous_physical_pages(size_t size);
     void deallocate_physical_page(PhysicalAddress);
 
@@ -258,6 +266,9 @@ private:
     static Region* find_region_from_vaddr(VirtualAddress);
 
     RefPtr<PhysicalPage> find_free_physical_page(bool);
+    RefPtr<PhysicalPage> take_cached_physical_page();
+    RefPtr<PhysicalPage> take_pre_zeroed_physical_page();
+    void drain_physical_page_caches();
 
     ALWAYS_INLINE u8* quickmap_page(PhysicalPage& page)
     {
@@ -271,6 +282,7 @@ private:
 
     PageTableEntry* pte(PageDirectory&, VirtualAddress);
     PageTableEntry* ensure_pte(PageDirectory&, VirtualAddress);
+    PageDirectoryEntry* pde(PageDirectory&, VirtualAddress);
     enum class IsLastPTERelease {
         Yes,
         No
@@ -289,6 +301,32 @@ private:
     PhysicalPageEntry* m_physical_page_entries { nullptr };
     size_t m_physical_page_entries_count { 0 };
 
+    // Page fault handlers allocate single uncommitted pages at a very high
+    // rate, so each CPU keeps a small cache of free pages that is refilled in
+    // batches. Most allocations are thereby served without touching
+    // m_global_data. Cached pages are already subtracted from the uncommitted
+    // pool, so under memory pressure the caches have to be drained before
+    // declaring OOM (or failing a commitment).
+    struct PhysicalPageCache {
+        static constexpr size_t capacity = 16;
+        Spinlock<LockRank::None> lock {};
+        size_t count { 0 };
+        RefPtr<PhysicalPage> pages[capacity];
+    };
+    PhysicalPageCache m_physical_page_caches[MAX_CPU_COUNT];
+
+    // A pool of pages zeroed ahead of time by the ZeroPageTask, so that
+    // zero-fill faults can usually map a ready page instead of doing a
+    // memset in the fault path. Like the per-CPU caches above, pooled pages
+    // are accounted as used and get drained under memory pressure.
+    struct PreZeroedPagePool {
+        static constexpr size_t capacity = 64;
+        Spinlock<LockRank::None> lock {};
+        size_t count { 0 };
+        RefPtr<PhysicalPage> pages[capacity];
+    };
+    PreZeroedPagePool m_pre_zeroed_page_pool;
+
     struct GlobalData {
         GlobalData();
 
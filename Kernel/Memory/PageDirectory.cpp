@@ -29,14 +29,20 @@ ErrorOr<NonnullLockRefPtr<PageDirectory>> PageDirectory::try_create_for_userspac
 {
     auto directory = TRY(adopt_nonnull_lock_ref_or_enomem(new (nothrow) PageDirectory));
 
+    auto kernel_pd_index = (kernel_mapping_base >> 30) & 0x1ffu;
+
+    // Grab all the pages we need in one batch, so that we only take the
+    // memory manager lock once instead of once per page.
 #if ARCH(X86_64)
-    directory->m_pml4t = TRY(MM.allocate_physical_page());
+    auto table_pages = TRY(MM.allocate_physical_pages(kernel_pd_index + 2));
+    directory->m_pml4t = table_pages.take_last();
+#else
+    auto table_pages = TRY(MM.allocate_physical_pages(kernel_pd_index + 1));
 #endif
 
-    directory->m_directory_table = TRY(MM.allocate_physical_page());
-    auto kernel_pd_index = (kernel_mapping_base >> 30) & 0x1ffu;
+    directory->m_directory_table = table_pages.take_last();
     for (size_t i = 0; i < kernel_pd_index; i++) {
-        directory->m_directory_pages[i] = TRY(MM.allocate_physical_page());
+        directory->m_directory_pages[i] = table_pages.take_last();
     }
 
     // Share the top 1 GiB of kernel-only mappings (>=kernel_mapping_base)
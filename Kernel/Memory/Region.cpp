@@ -226,7 +226,11 @@ bool Region::map_individual_page_impl(size_t page_index, RefPtr<PhysicalPage> pa
     pte->set_present(true);
     if (page->is_shared_zero_page() || page->is_lazy_committed_page() || should_cow(page_index))
         pte->set_writable(false);
-    else
+    else if (vmobject().is_shared_inode() && !static_cast<InodeVMObject&>(vmobject()).is_page_dirty(first_page_index() + page_index)) {
+        // Clean pages of shared inode mappings are mapped read-only, so the
+        // first write faults and marks the page dirty for writeback.
+        pte->set_writable(false);
+    } else
         pte->set_writable(is_writable());
     if (Processor::current().has_nx())
         pte->set_execute_disabled(!is_executable());
@@ -248,6 +252,104 @@ bool Region::map_individual_page_impl(size_t page_index)
     return map_individual_page_impl(page_index, page);
 }
 
+bool Region::should_map_with_huge_pages() const
+{
+#if !ARCH(X86_64)
+    return false;
+#else
+    constexpr size_t huge_page_size = 2 * MiB;
+
+    if (vaddr().get() % huge_page_size != 0)
+        return false;
+    if (size() == 0 || size() % huge_page_size != 0)
+        return false;
+    if (m_offset_in_vmobject % huge_page_size != 0)
+        return false;
+    // PROT_NONE regions are not mapped at all.
+    if (!is_readable() && !is_writable())
+        return false;
+    // The PAT bit sits at a different position in a huge-page PDE, so
+    // write-combine mappings keep using 4 KiB pages.
+    if (is_write_combine())
+        return false;
+    if (!vmobject().is_anonymous())
+        return false;
+    // Purging swaps out individual pages, which would require demoting the
+    // mapping in the middle of the purge.
+    if (static_cast<AnonymousVMObject const&>(vmobject()).is_purgeable())
+        return false;
+
+    // Finally, every underlying page must be present, physically contiguous
+    // at a 2 MiB-aligned base, and exclusively ours (no CoW and no shared
+    // zero or lazy-committed pages).
+    SpinlockLocker vmobject_locker(vmobject().m_lock);
+    auto physical_pages = vmobject().physical_pages();
+    auto first_index = first_page_index();
+    for (size_t i = 0; i < page_count(); ++i) {
+        auto const& page = physical_pages[first_index + i];
+        if (page.is_null())
+            return false;
+        if (page->is_shared_zero_page() || page->is_lazy_committed_page())
+            return false;
+        if (should_cow(i))
+            return false;
+        if (i == 0) {
+            if (page->paddr().get() % huge_page_size != 0)
+                return false;
+        } else if (page->paddr().get() != physical_pages[first_index]->paddr().get() + i * PAGE_SIZE) {
+            return false;
+        }
+    }
+    return true;
+#endif
+}
+
+bool Region::map_individual_huge_page_impl(size_t huge_page_index)
+{
+    VERIFY(m_page_directory->get_lock().is_locked_by_current_processor());
+
+    constexpr size_t pages_per_huge_page = 2 * MiB / PAGE_SIZE;
+    auto page_vaddr = vaddr_from_page_index(huge_page_index * pages_per_huge_page);
+
+    bool user_allowed = page_vaddr.get() >= USER_RANGE_BASE && is_user_address(page_vaddr);
+    if (is_mmap() && !user_allowed) {
+        PANIC("About to map mmap'ed page at a kernel address");
+    }
+
+    PhysicalAddress paddr;
+    {
+        SpinlockLocker vmobject_locker(vmobject().m_lock);
+        paddr = physical_page(huge_page_index * pages_per_huge_page)->paddr();
+    }
+
+    auto& pde = *MM.pde(*m_page_directory, page_vaddr);
+    pde.set_cache_disabled(!m_cacheable);
+    pde.set_page_table_base(paddr.get());
+    pde.set_huge(true);
+    pde.set_writable(is_writable());
+    if (Processor::current().has_nx())
+        pde.set_execute_disabled(!is_executable());
+    pde.set_user_allowed(user_allowed);
+    pde.set_present(true);
+
+    return true;
+}
+
+void Region::demote_huge_pages_with_locks_held()
+{
+    VERIFY(m_page_directory);
+    VERIFY(m_page_directory->get_lock().is_locked_by_current_processor());
+
+    constexpr size_t pages_per_huge_page = 2 * MiB / PAGE_SIZE;
+    for (size_t i = 0; i < page_count() / pages_per_huge_page; ++i) {
+        auto& pde = *MM.pde(*m_page_directory, vaddr_from_page_index(i * pages_per_huge_page));
+        if (pde.is_present() && pde.is_huge())
+            pde.clear();
+    }
+    MemoryManager::flush_tlb(m_page_directory, vaddr(), page_count());
+    m_mapped_with_huge_pages = false;
+}
+
 bool Region::remap_vmobject_page(size_t page_index, NonnullRefPtr<PhysicalPage> physical_page)
 {
     SpinlockLocker page_lock(m_page_directory->get_lock());
@@ -280,6 +382,7 @@ void Region::unmap_with_locks_held(ShouldFlushTLB should_flush_tlb, SpinlockLock
     }
     if (should_flush_tlb == ShouldFlushTLB::Yes)
         MemoryManager::flush_tlb(m_page_directory, vaddr(), page_count());
+    m_mapped_with_huge_pages = false;
     m_page_directory = nullptr;
 }
 
@@ -299,6 +402,28 @@ ErrorOr<void> Region::map(PageDirectory& page_directory, ShouldFlushTLB should_f
     }
 
     set_page_directory(page_directory);
+
+#if ARCH(X86_64)
+    constexpr size_t pages_per_huge_page = 2 * MiB / PAGE_SIZE;
+    if (should_map_with_huge_pages()) {
+        size_t huge_page_count = page_count() / pages_per_huge_page;
+        for (size_t huge_page_index = 0; huge_page_index < huge_page_count; ++huge_page_index) {
+            if (!map_individual_huge_page_impl(huge_page_index))
+                VERIFY_NOT_REACHED();
+        }
+        m_mapped_with_huge_pages = true;
+        if (should_flush_tlb == ShouldFlushTLB::Yes)
+            MemoryManager::flush_tlb(m_page_directory, vaddr(), page_count());
+        return {};
+    }
+    if (m_mapped_with_huge_pages) {
+        // The region is no longer eligible for huge pages (e.g. it became
+        // CoW after a fork); clear the huge PDEs so that ensure_pte() can
+        // place page tables in their range again.
+        demote_huge_pages_with_locks_held();
+    }
+#endif
+
     size_t page_index = 0;
     while (page_index < page_count()) {
         if (!map_individual_page_impl(page_index))
@@ -314,6 +439,21 @@ ErrorOr<void> Region::map(PageDirectory& page_directory, ShouldFlushTLB should_f
     return ENOMEM;
 }
 
+ErrorOr<void> Region::map_lazily(PageDirectory& page_directory)
+{
+    // Attach to the page directory without writing any PTEs; the first
+    // access to each page takes a not-present fault and handle_fault()
+    // maps the page on demand. Only private anonymous regions may be
+    // mapped this way, since those are the only ones whose not-present
+    // faults can be served straight from the VMObject's page slots.
+    VERIFY(vmobject().is_anonymous());
+    VERIFY(!m_shared);
+
+    SpinlockLocker page_lock(page_directory.get_lock());
+    set_page_directory(page_directory);
+    return {};
+}
+
 void Region::remap()
 {
     VERIFY(m_page_directory);
@@ -374,6 +514,17 @@ PageFaultResponse Region::handle_fault(PageFault const& fault)
                 return PageFaultResponse::OutOfMemory;
             return PageFaultResponse::Continue;
         }
+        if (page_slot) {
+            // The page is present in the VMObject but has no PTE, so this
+            // region was mapped lazily (e.g. by fork()). Map it on demand;
+            // zero and CoW pages get mapped read-only, so a write simply
+            // re-faults as a protection violation and takes the zero/CoW
+            // path below.
+            dbgln_if(PAGE_FAULT_DEBUG, "NP(lazy-mapped) fault in Region({})[{}] at {}", this, page_index_in_region, fault.vaddr());
+            if (!remap_vmobject_page(translate_to_vmobject_page(page_index_in_region), *page_slot))
+                return PageFaultResponse::OutOfMemory;
+            return PageFaultResponse::Continue;
+        }
         dbgln("BUG! Unexpected NP fault at {}", fault.vaddr());
         dbgln("     - Physical page slot pointer: {:p}", page_slot.ptr());
         if (page_slot) {
@@ -393,6 +544,18 @@ PageFaultResponse Region::handle_fault(PageFault const& fault)
         }
         return handle_cow_fault(page_index_in_region);
     }
+    if (fault.access() == PageFault::Access::Write && is_writable() && vmobject().is_shared_inode()) {
+        // A write to a clean page of a shared inode mapping; mark the page
+        // dirty and remap it writable.
+        dbgln_if(PAGE_FAULT_DEBUG, "PV(dirty) fault in Region({})[{}] at {}", this, page_index_in_region, fault.vaddr());
+        auto page_index_in_vmobject = translate_to_vmobject_page(page_index_in_region);
+        auto& inode_vmobject = static_cast<InodeVMObject&>(vmobject());
+        SpinlockLocker locker(inode_vmobject.m_lock);
+        inode_vmobject.set_page_dirty(page_index_in_vmobject, true);
+        if (!remap_vmobject_page(page_index_in_vmobject, *inode_vmobject.physical_pages()[page_index_in_vmobject]))
+            return PageFaultResponse::OutOfMemory;
+        return PageFaultResponse::Continue;
+    }
     dbgln("PV(error) fault in Region({})[{}] at {}", this, page_index_in_region, fault.vaddr());
     return PageFaultResponse::ShouldCrash;
 }
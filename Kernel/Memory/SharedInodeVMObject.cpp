@@ -5,7 +5,9 @@
  */
 
 #include <Kernel/FileSystem/Inode.h>
+#include <Kernel/KBuffer.h>
 #include <Kernel/Locking/Spinlock.h>
+#include <Kernel/Memory/MemoryManager.h>
 #include <Kernel/Memory/SharedInodeVMObject.h>
 
 namespace Kernel::Memory {
@@ -51,19 +53,66 @@ SharedInodeVMObject::SharedInodeVMObject(SharedInodeVMObject const& other, Fixed
 
 ErrorOr<void> SharedInodeVMObject::sync(off_t offset_in_pages, size_t pages)
 {
+    {
+        SpinlockLocker locker(m_lock);
+        size_t highest_page_to_flush = min(page_count(), offset_in_pages + pages);
+        bool any_dirty_pages = false;
+        for (size_t page_index = offset_in_pages; page_index < highest_page_to_flush; ++page_index) {
+            if (m_dirty_pages.get(page_index) && m_physical_pages[page_index]) {
+                any_dirty_pages = true;
+                break;
+            }
+        }
+        if (!any_dirty_pages)
+            return {};
+    }
+
+    // Copy each maximal run of dirty pages into a staging buffer so it can be
+    // written back with a single call into the file system.
+    auto staging_buffer = TRY(KBuffer::try_create_with_size("SharedInodeVMObject: Writeback staging"sv, max_writeback_batch_page_count * PAGE_SIZE));
+
     SpinlockLocker locker(m_lock);
 
     size_t highest_page_to_flush = min(page_count(), offset_in_pages + pages);
+    u64 inode_size = m_inode->size();
+    bool flushed_any_pages = false;
 
-    for (size_t page_index = offset_in_pages; page_index < highest_page_to_flush; ++page_index) {
-        auto& physical_page = m_physical_pages[page_index];
-        if (!physical_page)
+    size_t page_index = offset_in_pages;
+    while (page_index < highest_page_to_flush) {
+        if (!m_dirty_pages.get(page_index) || !m_physical_pages[page_index]) {
+            ++page_index;
             continue;
+        }
 
-        u8 page_buffer[PAGE_SIZE];
-        MM.copy_physical_page(*physical_page, page_buffer);
+        size_t run_length = 0;
+        while (page_index + run_length < highest_page_to_flush
+            && run_length < max_writeback_batch_page_count
+            && m_dirty_pages.get(page_index + run_length)
+            && m_physical_pages[page_index + run_length]) {
+            MM.copy_physical_page(*m_physical_pages[page_index + run_length], staging_buffer->data() + run_length * PAGE_SIZE);
+            ++run_length;
+        }
+
+        // Don't write past the end of the inode; the last page of the mapping
+        // is only partially backed by the file.
+        u64 run_offset = page_index * PAGE_SIZE;
+        if (run_offset < inode_size) {
+            size_t bytes_to_write = min(static_cast<u64>(run_length * PAGE_SIZE), inode_size - run_offset);
+            TRY(m_inode->write_bytes(run_offset, bytes_to_write, UserOrKernelBuffer::for_kernel_buffer(staging_buffer->data()), nullptr));
+        }
+
+        for (size_t i = 0; i < run_length; ++i)
+            m_dirty_pages.set(page_index + i, false);
+        flushed_any_pages = true;
+        page_index += run_length;
+    }
 
-        TRY(m_inode->write_bytes(page_index * PAGE_SIZE, PAGE_SIZE, UserOrKernelBuffer::for_kernel_buffer(page_buffer), nullptr));
+    if (flushed_any_pages) {
+        // Remap the flushed pages read-only so future writes fault and mark
+        // them dirty again.
+        for_each_region([](auto& region) {
+            region.remap();
+        });
     }
 
     return {};
@@ -21,6 +21,8 @@ public:
 
     ErrorOr<void> sync(off_t offset_in_pages = 0, size_t pages = -1);
 
+    static constexpr size_t max_writeback_batch_page_count = 32;
+
 private:
     virtual bool is_shared_inode() const override { return true; }
 
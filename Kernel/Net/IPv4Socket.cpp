@@ -374,10 +374,15 @@ ErrorOr<size_t> IPv4Socket::receive_packet_buffered(OpenFileDescription& descrip
     if (type() == SOCK_RAW) {
         size_t bytes_written = min(packet->data->size(), buffer_length);
         SOCKET_TRY(buffer.write(packet->data->data(), bytes_written));
+        if (taken_packet.data)
+            release_packet_buffer(taken_packet.data.release_nonnull());
         return bytes_written;
     }
 
-    return protocol_receive(packet->data->bytes(), buffer, buffer_length, flags);
+    auto nreceived = protocol_receive(packet->data->bytes(), buffer, buffer_length, flags);
+    if (taken_packet.data)
+        release_packet_buffer(taken_packet.data.release_nonnull());
+    return nreceived;
 }
 
 ErrorOr<size_t> IPv4Socket::recvfrom(OpenFileDescription& description, UserOrKernelBuffer& buffer, size_t buffer_length, int flags, Userspace<sockaddr*> user_addr, Userspace<socklen_t*> user_addr_length, Time& packet_timestamp, bool blocking)
@@ -413,6 +418,31 @@ ErrorOr<size_t> IPv4Socket::recvfrom(OpenFileDescription& description, UserOrKer
     return total_nreceived;
 }
 
+OwnPtr<KBuffer> IPv4Socket::acquire_packet_buffer(size_t size)
+{
+    if (!m_unused_packet_buffers.is_empty()) {
+        auto buffer = m_unused_packet_buffers.take_last();
+        if (buffer->capacity() >= size) {
+            buffer->set_size(size);
+            return buffer;
+        }
+        // Let an undersized buffer go; traffic on this socket has outgrown it.
+    }
+
+    auto buffer_or_error = KBuffer::try_create_with_size("IPv4Socket: Packet buffer"sv, size);
+    if (buffer_or_error.is_error())
+        return {};
+    return buffer_or_error.release_value();
+}
+
+void IPv4Socket::release_packet_buffer(NonnullOwnPtr<KBuffer> buffer)
+{
+    static constexpr size_t max_unused_packet_buffers = 32;
+    if (m_unused_packet_buffers.size() >= max_unused_packet_buffers)
+        return;
+    (void)m_unused_packet_buffers.try_append(move(buffer));
+}
+
 bool IPv4Socket::did_receive(IPv4Address const& source_address, u16 source_port, ReadonlyBytes packet, Time const& packet_timestamp)
 {
     MutexLocker locker(mutex());
@@ -444,12 +474,13 @@ bool IPv4Socket::did_receive(IPv4Address const& source_address, u16 source_port,
             dbgln("IPv4Socket({}): did_receive refusing packet since queue is full.", this);
             return false;
         }
-        auto data_or_error = KBuffer::try_create_with_bytes("IPv4Socket: Packet buffer"sv, packet);
-        if (data_or_error.is_error()) {
+        auto data = acquire_packet_buffer(packet.size());
+        if (!data) {
             dbgln("IPv4Socket: did_receive unable to allocate storage for incoming packet.");
             return false;
         }
-        auto result = m_receive_queue.try_append({ source_address, source_port, packet_timestamp, data_or_error.release_value() });
+        memcpy(data->data(), packet.data(), packet.size());
+        auto result = m_receive_queue.try_append({ source_address, source_port, packet_timestamp, data.release_nonnull() });
         if (result.is_error()) {
             dbgln("IPv4Socket: Dropped incoming packet because appending to the receive queue failed.");
             return false;
@@ -103,6 +103,9 @@ private:
 
     void set_can_read(bool);
 
+    OwnPtr<KBuffer> acquire_packet_buffer(size_t size);
+    void release_packet_buffer(NonnullOwnPtr<KBuffer>);
+
     IPv4Address m_local_address;
     IPv4Address m_peer_address;
 
@@ -118,6 +121,11 @@ private:
 
     SinglyLinkedList<ReceivedPacket, CountingSizeCalculationPolicy> m_receive_queue;
 
+    // Consumed packet buffers are kept around and handed back to did_receive(),
+    // so a busy socket doesn't pay for a kmalloc on every incoming packet.
+    // Both sides run under the socket mutex.
+    Vector<NonnullOwnPtr<KBuffer>> m_unused_packet_buffers;
+
     OwnPtr<DoubleBuffer> m_receive_buffer;
 
     u16 m_local_port { 0 };
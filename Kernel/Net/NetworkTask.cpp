@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/ScopeGuard.h>
 #include <Kernel/Debug.h>
 #include <Kernel/Locking/Mutex.h>
 #include <Kernel/Locking/MutexProtected.h>
@@ -75,57 +76,82 @@ void NetworkTask_main(void*)
         };
     });
 
-    auto dequeue_packet = [&pending_packets](u8* buffer, size_t buffer_size, Time& packet_timestamp) -> size_t {
+    struct DequeuedPacket {
+        LockRefPtr<PacketWithTimestamp> packet;
+        LockRefPtr<NetworkAdapter> adapter;
+    };
+
+    // Packets are handed over by reference and returned to the owning
+    // adapter's buffer pool after processing, so the payload is never copied
+    // on its way through the inbound path.
+    auto dequeue_packet = [&pending_packets]() -> DequeuedPacket {
+        DequeuedPacket result;
         if (pending_packets == 0)
-            return 0;
-        size_t packet_size = 0;
+            return result;
         NetworkingManagement::the().for_each([&](auto& adapter) {
-            if (packet_size || !adapter.has_queued_packets())
+            if (result.packet || !adapter.has_queued_packets())
+                return;
+            result.packet = adapter.dequeue_packet();
+            if (!result.packet)
                 return;
-            packet_size = adapter.dequeue_packet(buffer, buffer_size, packet_timestamp);
+            result.adapter = adapter;
             pending_packets--;
-            dbgln_if(NETWORK_TASK_DEBUG, "NetworkTask: Dequeued packet from {} ({} bytes)", adapter.name(), packet_size);
+            dbgln_if(NETWORK_TASK_DEBUG, "NetworkTask: Dequeued packet from {} ({} bytes)", adapter.name(), result.packet->buffer->size());
         });
-        return packet_size;
+        return result;
     };
 
-    size_t buffer_size = 64 * KiB;
-    auto region_or_error = MM.allocate_kernel_region(buffer_size, "Kernel Packet Buffer"sv, Memory::Region::Access::ReadWrite);
-    if (region_or_error.is_error())
-        TODO();
-    auto buffer_region = region_or_error.release_value();
-    auto buffer = (u8*)buffer_region->vaddr().get();
-    Time packet_timestamp;
+    // Bound the number of packets handled per batch so the retransmit timers
+    // and delayed ACKs never starve under sustained inbound traffic.
+    constexpr size_t max_packets_per_batch = 64;
 
     for (;;) {
-        flush_delayed_tcp_acks();
         retransmit_tcp_packets();
-        size_t packet_size = dequeue_packet(buffer, buffer_size, packet_timestamp);
-        if (!packet_size) {
-            auto timeout_time = Time::from_milliseconds(500);
+
+        // Drain the adapter queues as a batch: the delayed ACK logic can then
+        // coalesce ACKs for all segments received in the batch into a single
+        // ACK per socket, sent by flush_delayed_tcp_acks() below.
+        size_t batch_packet_count = 0;
+        while (batch_packet_count < max_packets_per_batch) {
+            auto dequeued = dequeue_packet();
+            if (!dequeued.packet)
+                break;
+            ++batch_packet_count;
+            ScopeGuard release_guard = [&] { dequeued.adapter->release_packet_buffer(*dequeued.packet); };
+            size_t packet_size = dequeued.packet->buffer->size();
+            Time packet_timestamp = dequeued.packet->timestamp;
+            if (packet_size < sizeof(EthernetFrameHeader)) {
+                dbgln("NetworkTask: Packet is too small to be an Ethernet packet! ({})", packet_size);
+                continue;
+            }
+            auto& eth = *(EthernetFrameHeader const*)dequeued.packet->buffer->data();
+            dbgln_if(ETHERNET_DEBUG, "NetworkTask: From {} to {}, ether_type={:#04x}, packet_size={}", eth.source().to_string(), eth.destination().to_string(), eth.ether_type(), packet_size);
+
+            switch (eth.ether_type()) {
+            case EtherType::ARP:
+                handle_arp(eth, packet_size);
+                break;
+            case EtherType::IPv4:
+                handle_ipv4(eth, packet_size, packet_timestamp);
+                break;
+            case EtherType::IPv6:
+                // ignore
+                break;
+            default:
+                dbgln_if(ETHERNET_DEBUG, "NetworkTask: Unknown ethernet type {:#04x}", eth.ether_type());
+            }
+        }
+
+        flush_delayed_tcp_acks();
+
+        if (!batch_packet_count) {
+            // When ACKs are still pending, wake up early enough to honor the
+            // delayed ACK timeout; otherwise the usual 500 ms retransmit tick.
+            auto timeout_time = delayed_ack_sockets->is_empty()
+                ? Time::from_milliseconds(500)
+                : Time::from_milliseconds(min(500u, TCPSocket::delayed_ack_timeout_in_milliseconds()));
             auto timeout = Thread::BlockTimeout { false, &timeout_time };
             [[maybe_unused]] auto result = packet_wait_queue.wait_on(timeout, "NetworkTask"sv);
-            continue;
-        }
-        if (packet_size < sizeof(EthernetFrameHeader)) {
-            dbgln("NetworkTask: Packet is too small to be an Ethernet packet! ({})", packet_size);
-            continue;
-        }
-        auto& eth = *(EthernetFrameHeader const*)buffer;
-        dbgln_if(ETHERNET_DEBUG, "NetworkTask: From {} to {}, ether_type={:#04x}, packet_size={}", eth.source().to_string(), eth.destination().to_string(), eth.ether_type(), packet_size);
-
-        switch (eth.ether_type()) {
-        case EtherType::ARP:
-            handle_arp(eth, packet_size);
-            break;
-        case EtherType::IPv4:
-            handle_ipv4(eth, packet_size, packet_timestamp);
-            break;
-        case EtherType::IPv6:
-            // ignore
-            break;
-        default:
-            dbgln_if(ETHERNET_DEBUG, "NetworkTask: Unknown ethernet type {:#04x}", eth.ether_type());
         }
     }
 }
@@ -310,6 +336,7 @@ void send_delayed_tcp_ack(LockRefPtr<TCPSocket> socket)
         return;
     }
 
+    socket->did_delay_ack();
     delayed_ack_sockets->set(move(socket));
 }
 
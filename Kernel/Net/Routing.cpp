@@ -19,6 +19,30 @@ namespace Kernel {
 static Singleton<SpinlockProtected<HashMap<IPv4Address, MACAddress>, LockRank::None>> s_arp_table;
 static Singleton<SpinlockProtected<Route::RouteList, LockRank::None>> s_routing_table;
 
+// Fully resolved routing decisions, keyed by (target, source). Resolving a
+// route scans every adapter and every route and consults the ARP table, all
+// under locks; with a steady stream of packets to the same destinations the
+// answer is almost always the same, so cache it and throw the cache away
+// whenever anything it was derived from changes.
+struct RouteCacheEntry {
+    LockRefPtr<NetworkAdapter> adapter;
+    MACAddress next_hop;
+};
+static Singleton<SpinlockProtected<HashMap<u64, RouteCacheEntry>, LockRank::None>> s_route_cache;
+static constexpr size_t max_route_cache_entries = 256;
+
+static u64 route_cache_key(IPv4Address const& target, IPv4Address const& source)
+{
+    return static_cast<u64>(target.to_u32()) << 32 | source.to_u32();
+}
+
+void invalidate_route_cache()
+{
+    s_route_cache->with([](auto& cache) {
+        cache.clear();
+    });
+}
+
 class ARPTableBlocker final : public Thread::Blocker {
 public:
     ARPTableBlocker(IPv4Address ip_addr, Optional<MACAddress>& addr);
@@ -119,6 +143,7 @@ void update_arp_table(IPv4Address const& ip_addr, MACAddress const& addr, Update
         if (update == UpdateTable::Delete)
             table.remove(ip_addr);
     });
+    invalidate_route_cache();
     s_arp_table_blocker_set->unblock_blockers_waiting_for_ipv4_address(ip_addr, addr);
 
     if constexpr (ARP_DEBUG) {
@@ -164,6 +189,7 @@ ErrorOr<void> update_routing_table(IPv4Address const& destination, IPv4Address c
         }
         return {};
     }));
+    invalidate_route_cache();
 
     return {};
 }
@@ -197,6 +223,34 @@ RoutingDecision route_to(IPv4Address const& target, IPv4Address const& source, L
     if (target[0] == 127)
         return if_matches(*NetworkingManagement::the().loopback_adapter(), NetworkingManagement::the().loopback_adapter()->mac_address());
 
+    // Only the common lookup is cached; an explicit adapter or a forbidden
+    // gateway changes the answer, so those queries take the slow path.
+    bool is_cacheable = !through && allow_using_gateway == AllowUsingGateway::Yes;
+    if (is_cacheable) {
+        auto cached_decision = s_route_cache->with([&](auto const& cache) -> Optional<RouteCacheEntry> {
+            auto it = cache.find(route_cache_key(target, source));
+            if (it == cache.end())
+                return {};
+            return it->value;
+        });
+        if (cached_decision.has_value()) {
+            dbgln_if(ROUTING_DEBUG, "Routing: Using cached route to {} via adapter {}", target, cached_decision->adapter->name());
+            return { cached_decision->adapter, cached_decision->next_hop };
+        }
+    }
+
+    auto remember_route = [&](RoutingDecision decision) {
+        if (is_cacheable && !decision.is_zero()) {
+            s_route_cache->with([&](auto& cache) {
+                // Starting over beats tracking per-entry age for a cache this size.
+                if (cache.size() >= max_route_cache_entries)
+                    cache.clear();
+                (void)cache.try_set(route_cache_key(target, source), { decision.adapter, decision.next_hop });
+            });
+        }
+        return decision;
+    };
+
     auto target_addr = target.to_u32();
     auto source_addr = source.to_u32();
 
@@ -256,7 +310,7 @@ RoutingDecision route_to(IPv4Address const& target, IPv4Address const& source, L
     });
 
     if (local_adapter && target == local_adapter->ipv4_address())
-        return { local_adapter, local_adapter->mac_address() };
+        return remember_route({ local_adapter, local_adapter->mac_address() });
 
     if (!local_adapter && !chosen_route) {
         dbgln_if(ROUTING_DEBUG, "Routing: Couldn't find a suitable adapter for route to {}", target);
@@ -292,13 +346,13 @@ RoutingDecision route_to(IPv4Address const& target, IPv4Address const& source, L
     // FIXME: We should also deal with the case where `target_addr` is
     //        a broadcast to a subnet rather than a full broadcast.
     if (target_addr == 0xffffffff && matches(adapter))
-        return { adapter, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff } };
+        return remember_route({ adapter, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff } });
 
     if (adapter == NetworkingManagement::the().loopback_adapter())
-        return { adapter, adapter->mac_address() };
+        return remember_route({ adapter, adapter->mac_address() });
 
     if ((target_addr & IPv4Address { 240, 0, 0, 0 }.to_u32()) == IPv4Address { 224, 0, 0, 0 }.to_u32())
-        return { adapter, multicast_ethernet_address(target) };
+        return remember_route({ adapter, multicast_ethernet_address(target) });
 
     {
         auto addr = arp_table().with([&](auto const& table) -> auto{
@@ -306,7 +360,7 @@ RoutingDecision route_to(IPv4Address const& target, IPv4Address const& source, L
         });
         if (addr.has_value()) {
             dbgln_if(ARP_DEBUG, "Routing: Using cached ARP entry for {} ({})", next_hop_ip, addr.value().to_string());
-            return { adapter, addr.value() };
+            return remember_route({ adapter, addr.value() });
         }
     }
 
@@ -334,7 +388,7 @@ RoutingDecision route_to(IPv4Address const& target, IPv4Address const& source, L
                 adapter->name(),
                 next_hop_ip,
                 addr.value().to_string());
-            return { adapter, addr.value() };
+            return remember_route({ adapter, addr.value() });
         }
     }
 
@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
+#include <AK/Atomic.h>
 #include <AK/Singleton.h>
 #include <AK/Time.h>
 #include <Kernel/Debug.h>
@@ -22,25 +24,37 @@
 
 namespace Kernel {
 
+static Singleton<Array<TCPSocket::SocketTableShard, TCPSocket::socket_table_shard_count>> s_socket_tuple_shards;
+
+TCPSocket::SocketTableShard& TCPSocket::sockets_by_tuple_shard(IPv4SocketTuple const& tuple)
+{
+    return (*s_socket_tuple_shards)[Traits<IPv4SocketTuple>::hash(tuple) % socket_table_shard_count];
+}
+
 void TCPSocket::for_each(Function<void(TCPSocket const&)> callback)
 {
-    sockets_by_tuple().for_each_shared([&](auto const& it) {
-        callback(*it.value);
-    });
+    for (auto& shard : *s_socket_tuple_shards) {
+        shard.for_each_shared([&](auto const& it) {
+            callback(*it.value);
+        });
+    }
 }
 
 ErrorOr<void> TCPSocket::try_for_each(Function<ErrorOr<void>(TCPSocket const&)> callback)
 {
-    return sockets_by_tuple().with_shared([&](auto const& sockets) -> ErrorOr<void> {
-        for (auto& it : sockets)
-            TRY(callback(*it.value));
-        return {};
-    });
+    for (auto& shard : *s_socket_tuple_shards) {
+        TRY(shard.with_shared([&](auto const& sockets) -> ErrorOr<void> {
+            for (auto& it : sockets)
+                TRY(callback(*it.value));
+            return {};
+        }));
+    }
+    return {};
 }
 
 bool TCPSocket::unref() const
 {
-    bool did_hit_zero = sockets_by_tuple().with_exclusive([&](auto& table) {
+    bool did_hit_zero = sockets_by_tuple_shard(tuple()).with_exclusive([&](auto& table) {
         if (deref_base())
             return false;
         table.remove(tuple());
@@ -95,37 +109,29 @@ MutexProtected<HashMap<IPv4SocketTuple, LockRefPtr<TCPSocket>>>& TCPSocket::clos
     return *s_socket_closing;
 }
 
-static Singleton<MutexProtected<HashMap<IPv4SocketTuple, TCPSocket*>>> s_socket_tuples;
-
-MutexProtected<HashMap<IPv4SocketTuple, TCPSocket*>>& TCPSocket::sockets_by_tuple()
-{
-    return *s_socket_tuples;
-}
-
 LockRefPtr<TCPSocket> TCPSocket::from_tuple(IPv4SocketTuple const& tuple)
 {
-    return sockets_by_tuple().with_shared([&](auto const& table) -> LockRefPtr<TCPSocket> {
-        auto exact_match = table.get(tuple);
-        if (exact_match.has_value())
-            return { *exact_match.value() };
+    auto lookup = [](IPv4SocketTuple const& candidate) -> LockRefPtr<TCPSocket> {
+        return sockets_by_tuple_shard(candidate).with_shared([&](auto const& table) -> LockRefPtr<TCPSocket> {
+            auto match = table.get(candidate);
+            if (match.has_value())
+                return { *match.value() };
+            return {};
+        });
+    };
 
-        auto address_tuple = IPv4SocketTuple(tuple.local_address(), tuple.local_port(), IPv4Address(), 0);
-        auto address_match = table.get(address_tuple);
-        if (address_match.has_value())
-            return { *address_match.value() };
+    if (auto exact_match = lookup(tuple))
+        return exact_match;
 
-        auto wildcard_tuple = IPv4SocketTuple(IPv4Address(), tuple.local_port(), IPv4Address(), 0);
-        auto wildcard_match = table.get(wildcard_tuple);
-        if (wildcard_match.has_value())
-            return { *wildcard_match.value() };
+    if (auto address_match = lookup(IPv4SocketTuple(tuple.local_address(), tuple.local_port(), IPv4Address(), 0)))
+        return address_match;
 
-        return {};
-    });
+    return lookup(IPv4SocketTuple(IPv4Address(), tuple.local_port(), IPv4Address(), 0));
 }
 ErrorOr<NonnullLockRefPtr<TCPSocket>> TCPSocket::try_create_client(IPv4Address const& new_local_address, u16 new_local_port, IPv4Address const& new_peer_address, u16 new_peer_port)
 {
     auto tuple = IPv4SocketTuple(new_local_address, new_local_port, new_peer_address, new_peer_port);
-    return sockets_by_tuple().with_exclusive([&](auto& table) -> ErrorOr<NonnullLockRefPtr<TCPSocket>> {
+    return sockets_by_tuple_shard(tuple).with_exclusive([&](auto& table) -> ErrorOr<NonnullLockRefPtr<TCPSocket>> {
         if (table.contains(tuple))
             return EEXIST;
 
@@ -293,6 +299,8 @@ ErrorOr<void> TCPSocket::send_tcp_packet(u16 flags, UserOrKernelBuffer const* pa
 
     m_packets_out++;
     m_bytes_out += buffer_size;
+    if (flags == TCPFlags::ACK && payload_size == 0)
+        m_pure_acks_out++;
     routing_decision.adapter->send_packet(packet->bytes());
     if (!expect_ack)
         routing_decision.adapter->release_packet_buffer(*packet);
@@ -342,17 +350,42 @@ void TCPSocket::receive_tcp_packet(TCPPacket const& packet, u16 size)
     m_bytes_in += packet.header_size() + size;
 }
 
+// RFC 1122 says we should send an ACK for every two full-sized segments,
+// and must not delay ACKs for more than 500 milliseconds.
+static Atomic<u32> s_delayed_ack_threshold_in_segments { 2 };
+static Atomic<u32> s_delayed_ack_timeout_in_milliseconds { 500 };
+
+u32 TCPSocket::delayed_ack_threshold_in_segments()
+{
+    return s_delayed_ack_threshold_in_segments.load();
+}
+
+void TCPSocket::set_delayed_ack_threshold_in_segments(u32 threshold)
+{
+    VERIFY(threshold > 0);
+    s_delayed_ack_threshold_in_segments.store(threshold);
+}
+
+u32 TCPSocket::delayed_ack_timeout_in_milliseconds()
+{
+    return s_delayed_ack_timeout_in_milliseconds.load();
+}
+
+void TCPSocket::set_delayed_ack_timeout_in_milliseconds(u32 timeout)
+{
+    VERIFY(timeout > 0 && timeout <= 500);
+    s_delayed_ack_timeout_in_milliseconds.store(timeout);
+}
+
 bool TCPSocket::should_delay_next_ack() const
 {
     // FIXME: We don't know the MSS here so make a reasonable guess.
     const size_t mss = 1500;
 
-    // RFC 1122 says we should send an ACK for every two full-sized segments.
-    if (m_ack_number >= m_last_ack_number_sent + 2 * mss)
+    if (m_ack_number >= m_last_ack_number_sent + delayed_ack_threshold_in_segments() * mss)
         return false;
 
-    // RFC 1122 says we should not delay ACKs for more than 500 milliseconds.
-    if (kgettimeofday() >= m_last_ack_sent_time + Time::from_milliseconds(500))
+    if (kgettimeofday() >= m_last_ack_sent_time + Time::from_milliseconds(delayed_ack_timeout_in_milliseconds()))
         return false;
 
     return true;
@@ -421,7 +454,7 @@ ErrorOr<void> TCPSocket::protocol_bind()
 ErrorOr<void> TCPSocket::protocol_listen(bool did_allocate_port)
 {
     if (!did_allocate_port) {
-        bool ok = sockets_by_tuple().with_exclusive([&](auto& table) -> bool {
+        bool ok = sockets_by_tuple_shard(tuple()).with_exclusive([&](auto& table) -> bool {
             if (table.contains(tuple()))
                 return false;
             table.set(tuple(), this);
@@ -488,24 +521,28 @@ ErrorOr<u16> TCPSocket::protocol_allocate_local_port()
     constexpr u16 ephemeral_port_range_size = last_ephemeral_port - first_ephemeral_port;
     u16 first_scan_port = first_ephemeral_port + get_good_random<u16>() % ephemeral_port_range_size;
 
-    return sockets_by_tuple().with_exclusive([&](auto& table) -> ErrorOr<u16> {
-        for (u16 port = first_scan_port;;) {
-            IPv4SocketTuple proposed_tuple(local_address(), port, peer_address(), peer_port());
+    // Each proposed port is checked and claimed under its own shard lock, so
+    // a long scan no longer blocks lookups for unrelated connections.
+    for (u16 port = first_scan_port;;) {
+        IPv4SocketTuple proposed_tuple(local_address(), port, peer_address(), peer_port());
 
-            auto it = table.find(proposed_tuple);
-            if (it == table.end()) {
-                set_local_port(port);
-                table.set(proposed_tuple, this);
-                return port;
-            }
-            ++port;
-            if (port > last_ephemeral_port)
-                port = first_ephemeral_port;
-            if (port == first_scan_port)
-                break;
-        }
-        return set_so_error(EADDRINUSE);
-    });
+        bool claimed = sockets_by_tuple_shard(proposed_tuple).with_exclusive([&](auto& table) -> bool {
+            if (table.contains(proposed_tuple))
+                return false;
+            set_local_port(port);
+            table.set(proposed_tuple, this);
+            return true;
+        });
+        if (claimed)
+            return port;
+
+        ++port;
+        if (port > last_ephemeral_port)
+            port = first_ephemeral_port;
+        if (port == first_scan_port)
+            break;
+    }
+    return set_so_error(EADDRINUSE);
 }
 
 bool TCPSocket::protocol_is_disconnected() const
@@ -133,6 +133,14 @@ public:
     u32 bytes_in() const { return m_bytes_in; }
     u32 packets_out() const { return m_packets_out; }
     u32 bytes_out() const { return m_bytes_out; }
+    u32 pure_acks_out() const { return m_pure_acks_out; }
+    u32 delayed_acks() const { return m_delayed_acks; }
+    void did_delay_ack() { m_delayed_acks++; }
+
+    static u32 delayed_ack_threshold_in_segments();
+    static void set_delayed_ack_threshold_in_segments(u32);
+    static u32 delayed_ack_timeout_in_milliseconds();
+    static void set_delayed_ack_timeout_in_milliseconds(u32);
 
     // FIXME: Make this configurable?
     static constexpr u32 maximum_duplicate_acks = 5;
@@ -145,7 +153,11 @@ public:
 
     bool should_delay_next_ack() const;
 
-    static MutexProtected<HashMap<IPv4SocketTuple, TCPSocket*>>& sockets_by_tuple();
+    // The socket table is striped by tuple hash so inbound segment lookups
+    // only contend with writers that touch the same shard.
+    static constexpr size_t socket_table_shard_count = 16;
+    using SocketTableShard = MutexProtected<HashMap<IPv4SocketTuple, TCPSocket*>>;
+    static SocketTableShard& sockets_by_tuple_shard(IPv4SocketTuple const&);
     static LockRefPtr<TCPSocket> from_tuple(IPv4SocketTuple const& tuple);
 
     static MutexProtected<HashMap<IPv4SocketTuple, LockRefPtr<TCPSocket>>>& closing_sockets();
@@ -197,6 +209,8 @@ private:
     u32 m_bytes_in { 0 };
     u32 m_packets_out { 0 };
     u32 m_bytes_out { 0 };
+    u32 m_pure_acks_out { 0 };
+    u32 m_delayed_acks { 0 };
 
     struct OutgoingPacket {
         u32 ack_number { 0 };
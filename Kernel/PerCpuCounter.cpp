@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <Kernel/PerCpuCounter.h>
+#include <Kernel/Sections.h>
+
+namespace Kernel {
+
+READONLY_AFTER_INIT PerCpuCounter* PerCpuCounter::s_registry_head { nullptr };
+
+PerCpuCounter::PerCpuCounter(StringView name)
+    : m_name(name)
+{
+    m_next = s_registry_head;
+    s_registry_head = this;
+}
+
+u64 PerCpuCounter::sum() const
+{
+    u64 total = 0;
+    for (u32 cpu = 0; cpu < Processor::count(); ++cpu)
+        total += m_slots[cpu].value;
+    return total;
+}
+
+}
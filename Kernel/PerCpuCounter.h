@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/StringView.h>
+#include <AK/Types.h>
+#include <Kernel/Arch/Processor.h>
+
+namespace Kernel {
+
+// A cheap always-on event counter for hot paths. Each CPU increments its own
+// cache-line-padded slot with a plain (non-atomic) add, so counting an event
+// costs a single add to a line no other CPU writes. Totals are aggregated
+// only when someone reads /sys/kernel/counters.
+//
+// Counters register themselves in a global list when their constructors run,
+// so they must be defined at namespace scope; registration happens while the
+// kernel is still single-threaded and needs no locking.
+class PerCpuCounter {
+    AK_MAKE_NONCOPYABLE(PerCpuCounter);
+    AK_MAKE_NONMOVABLE(PerCpuCounter);
+
+public:
+    explicit PerCpuCounter(StringView name);
+
+    // NOTE: If the thread migrates between reading the CPU id and the add,
+    //       the increment lands on the old CPU's slot, and a concurrent
+    //       increment there can be lost. Monitoring tolerates the occasional
+    //       miscount; that's the price of keeping this lock- and atomic-free.
+    void add(u64 delta)
+    {
+        m_slots[Processor::current_id()].value += delta;
+    }
+
+    void increment() { add(1); }
+
+    StringView name() const { return m_name; }
+    u64 value_on_cpu(u32 cpu) const { return m_slots[cpu].value; }
+    u64 sum() const;
+
+    template<typename Callback>
+    static void for_each(Callback callback)
+    {
+        for (auto const* counter = s_registry_head; counter; counter = counter->m_next)
+            callback(*counter);
+    }
+
+private:
+    struct alignas(64) Slot {
+        u64 value { 0 };
+    };
+
+    static PerCpuCounter* s_registry_head;
+
+    StringView m_name;
+    PerCpuCounter* m_next { nullptr };
+    Slot m_slots[MAX_CPU_COUNT] {};
+};
+
+}
@@ -17,8 +17,9 @@
 
 namespace Kernel {
 
-PerformanceEventBuffer::PerformanceEventBuffer(NonnullOwnPtr<KBuffer> buffer)
-    : m_buffer(move(buffer))
+PerformanceEventBuffer::PerformanceEventBuffer(NonnullOwnPtr<KBuffer> buffer, Wrap wrap)
+    : m_wrap(wrap)
+    , m_buffer(move(buffer))
 {
 }
 
@@ -74,7 +75,7 @@ ErrorOr<void> PerformanceEventBuffer::append_with_ip_and_bp(ProcessID pid, Threa
 ErrorOr<void> PerformanceEventBuffer::append_with_ip_and_bp(ProcessID pid, ThreadID tid,
     FlatPtr ip, FlatPtr bp, int type, u32 lost_samples, FlatPtr arg1, FlatPtr arg2, StringView arg3, FlatPtr arg4, u64 arg5, ErrorOr<FlatPtr> arg6)
 {
-    if (count() >= capacity())
+    if (m_wrap == Wrap::No && m_count >= capacity())
         return ENOBUFS;
 
     if ((g_profiling_event_mask & type) == 0)
@@ -176,15 +177,27 @@ ErrorOr<void> PerformanceEventBuffer::append_with_ip_and_bp(ProcessID pid, Threa
     event.pid = pid.value();
     event.tid = tid.value();
     event.timestamp = TimeManagement::the().uptime_ms();
-    at(m_count++) = event;
+    physical_event(m_count % capacity()) = event;
+    ++m_count;
     return {};
 }
 
 PerformanceEvent& PerformanceEventBuffer::at(size_t index)
 {
-    VERIFY(index < capacity());
+    VERIFY(index < count());
+    if (m_count <= capacity())
+        return physical_event(index);
+    // The buffer has wrapped; the oldest surviving event lives at the
+    // physical slot we're about to overwrite next. Note that
+    // m_count % capacity() == (m_count - capacity()) % capacity().
+    return physical_event((m_count + index) % capacity());
+}
+
+PerformanceEvent& PerformanceEventBuffer::physical_event(size_t physical_index)
+{
+    VERIFY(physical_index < capacity());
     auto* events = reinterpret_cast<PerformanceEvent*>(m_buffer->data());
-    return events[index];
+    return events[physical_index];
 }
 
 template<typename Serializer>
@@ -210,7 +223,7 @@ ErrorOr<void> PerformanceEventBuffer::to_json_impl(Serializer& object) const
     bool show_kernel_addresses = current_process_credentials->is_superuser();
     auto array = TRY(object.add_array("events"sv));
     bool seen_first_sample = false;
-    for (size_t i = 0; i < m_count; ++i) {
+    for (size_t i = 0; i < count(); ++i) {
         auto const& event = at(i);
 
         if (!show_kernel_addresses) {
@@ -324,12 +337,12 @@ ErrorOr<void> PerformanceEventBuffer::to_json(KBufferBuilder& builder) const
     return to_json_impl(object);
 }
 
-OwnPtr<PerformanceEventBuffer> PerformanceEventBuffer::try_create_with_size(size_t buffer_size)
+OwnPtr<PerformanceEventBuffer> PerformanceEventBuffer::try_create_with_size(size_t buffer_size, Wrap wrap)
 {
     auto buffer_or_error = KBuffer::try_create_with_size("Performance events"sv, buffer_size, Memory::Region::Access::ReadWrite, AllocationStrategy::AllocateNow);
     if (buffer_or_error.is_error())
         return {};
-    return adopt_own_if_nonnull(new (nothrow) PerformanceEventBuffer(buffer_or_error.release_value()));
+    return adopt_own_if_nonnull(new (nothrow) PerformanceEventBuffer(buffer_or_error.release_value(), wrap));
 }
 
 ErrorOr<void> PerformanceEventBuffer::add_process(Process const& process, ProcessEventType event_type)
@@ -108,7 +108,16 @@ enum class ProcessEventType {
 
 class PerformanceEventBuffer {
 public:
-    static OwnPtr<PerformanceEventBuffer> try_create_with_size(size_t buffer_size);
+    // A wrapping buffer overwrites its oldest events once full instead of
+    // rejecting new ones, so it always holds the most recent window of
+    // activity. This is what the global (all-processes) profiling session
+    // uses, so that a long-running session can be snapshotted after the fact.
+    enum class Wrap {
+        No,
+        Yes,
+    };
+
+    static OwnPtr<PerformanceEventBuffer> try_create_with_size(size_t buffer_size, Wrap = Wrap::No);
 
     ErrorOr<void> append(int type, FlatPtr arg1, FlatPtr arg2, StringView arg3, Thread* current_thread = Thread::current(), FlatPtr arg4 = 0, u64 arg5 = 0, ErrorOr<FlatPtr> arg6 = 0);
     ErrorOr<void> append_with_ip_and_bp(ProcessID pid, ThreadID tid, FlatPtr eip, FlatPtr ebp,
@@ -122,7 +131,9 @@ public:
     }
 
     size_t capacity() const { return m_buffer->size() / sizeof(PerformanceEvent); }
-    size_t count() const { return m_count; }
+    size_t count() const { return min(m_count, capacity()); }
+    // Events are indexed chronologically; in a wrapping buffer, index 0 is
+    // the oldest event that hasn't been overwritten yet.
     PerformanceEvent const& at(size_t index) const
     {
         return const_cast<PerformanceEventBuffer&>(*this).at(index);
@@ -135,14 +146,18 @@ public:
     ErrorOr<FlatPtr> register_string(NonnullOwnPtr<KString>);
 
 private:
-    explicit PerformanceEventBuffer(NonnullOwnPtr<KBuffer>);
+    PerformanceEventBuffer(NonnullOwnPtr<KBuffer>, Wrap);
 
     template<typename Serializer>
     ErrorOr<void> to_json_impl(Serializer&) const;
 
     PerformanceEvent& at(size_t index);
+    PerformanceEvent& physical_event(size_t physical_index);
 
+    // Total number of events ever appended; may exceed capacity() for a
+    // wrapping buffer.
     size_t m_count { 0 };
+    Wrap m_wrap { Wrap::No };
     NonnullOwnPtr<KBuffer> m_buffer;
 
     HashMap<NonnullOwnPtr<KString>, size_t> m_strings;
@@ -747,6 +747,9 @@ void Process::finalize()
     if (m_alarm_timer)
         TimerQueue::the().cancel_timer(m_alarm_timer.release_nonnull());
     m_fds.with_exclusive([](auto& fds) { fds.clear(); });
+    // Drop any async I/O requests that were never reaped with sys$aio_return,
+    // as they keep a reference back to this process.
+    m_async_io_requests.with([](auto& requests) { requests.clear(); });
     m_tty = nullptr;
     m_executable.with([](auto& executable) { executable = nullptr; });
     m_attached_jail.with([](auto& jail) {
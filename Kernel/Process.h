@@ -17,6 +17,7 @@
 #include <Kernel/API/POSIX/sys/resource.h>
 #include <Kernel/API/Syscall.h>
 #include <Kernel/Assertions.h>
+#include <Kernel/AsyncIORequest.h>
 #include <Kernel/AtomicEdgeAction.h>
 #include <Kernel/Credentials.h>
 #include <Kernel/FileSystem/InodeMetadata.h>
@@ -323,6 +324,9 @@ public:
     ErrorOr<FlatPtr> sys$readv(int fd, Userspace<const struct iovec*> iov, int iov_count);
     ErrorOr<FlatPtr> sys$write(int fd, Userspace<u8 const*>, size_t);
     ErrorOr<FlatPtr> sys$pwritev(int fd, Userspace<const struct iovec*> iov, int iov_count, Userspace<off_t const*>);
+    ErrorOr<FlatPtr> sys$aio_submit(Userspace<const struct aiocb*>);
+    ErrorOr<FlatPtr> sys$aio_error(Userspace<const struct aiocb*>);
+    ErrorOr<FlatPtr> sys$aio_return(Userspace<const struct aiocb*>);
     ErrorOr<FlatPtr> sys$fstat(int fd, Userspace<stat*>);
     ErrorOr<FlatPtr> sys$stat(Userspace<Syscall::SC_stat_params const*>);
     ErrorOr<FlatPtr> sys$annotate_mapping(Userspace<void*>, int flags);
@@ -403,6 +407,8 @@ public:
     ErrorOr<FlatPtr> sys$shutdown(int sockfd, int how);
     ErrorOr<FlatPtr> sys$sendmsg(int sockfd, Userspace<const struct msghdr*>, int flags);
     ErrorOr<FlatPtr> sys$recvmsg(int sockfd, Userspace<struct msghdr*>, int flags);
+    ErrorOr<FlatPtr> sys$sendmmsg(int sockfd, Userspace<struct mmsghdr*>, unsigned message_count, int flags);
+    ErrorOr<FlatPtr> sys$recvmmsg(int sockfd, Userspace<struct mmsghdr*>, unsigned message_count, int flags);
     ErrorOr<FlatPtr> sys$getsockopt(Userspace<Syscall::SC_getsockopt_params const*>);
     ErrorOr<FlatPtr> sys$setsockopt(Userspace<Syscall::SC_setsockopt_params const*>);
     ErrorOr<FlatPtr> sys$getsockname(Userspace<Syscall::SC_getsockname_params const*>);
@@ -430,11 +436,13 @@ public:
     ErrorOr<FlatPtr> sys$futex(Userspace<Syscall::SC_futex_params const*>);
     ErrorOr<FlatPtr> sys$pledge(Userspace<Syscall::SC_pledge_params const*>);
     ErrorOr<FlatPtr> sys$unveil(Userspace<Syscall::SC_unveil_params const*>);
+    ErrorOr<FlatPtr> sys$perf_counters(Userspace<struct perf_counters_info*>);
     ErrorOr<FlatPtr> sys$perf_event(int type, FlatPtr arg1, FlatPtr arg2);
     ErrorOr<FlatPtr> sys$perf_register_string(Userspace<char const*>, size_t);
     ErrorOr<FlatPtr> sys$get_stack_bounds(Userspace<FlatPtr*> stack_base, Userspace<size_t*> stack_size);
     ErrorOr<FlatPtr> sys$ptrace(Userspace<Syscall::SC_ptrace_params const*>);
     ErrorOr<FlatPtr> sys$sendfd(int sockfd, int fd);
+    ErrorOr<FlatPtr> sys$sendfile(int out_fd, int in_fd, Userspace<off_t*>, size_t count);
     ErrorOr<FlatPtr> sys$recvfd(int sockfd, int options);
     ErrorOr<FlatPtr> sys$sysconf(int name);
     ErrorOr<FlatPtr> sys$disown(ProcessID);
@@ -452,6 +460,9 @@ public:
     template<bool sockname, typename Params>
     ErrorOr<void> get_sock_or_peer_name(Params const&);
 
+    ErrorOr<FlatPtr> do_sendmsg(int sockfd, Userspace<const struct msghdr*>, int flags);
+    ErrorOr<FlatPtr> do_recvmsg(int sockfd, Userspace<struct msghdr*>, int flags);
+
     static void initialize();
 
     [[noreturn]] void crash(int signal, FlatPtr ip, bool out_of_memory = false);
@@ -863,6 +874,10 @@ private:
 
     MutexProtected<OpenFileDescriptions> m_fds;
 
+    // Outstanding asynchronous I/O operations, keyed by the userspace
+    // address of the aiocb that submitted them.
+    SpinlockProtected<HashMap<FlatPtr, NonnullLockRefPtr<AsyncIORequest>>, LockRank::None> m_async_io_requests {};
+
     bool const m_is_kernel_process;
     Atomic<State> m_state { State::Running };
     bool m_profiling { false };
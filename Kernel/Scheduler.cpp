@@ -12,6 +12,7 @@
 #include <Kernel/Debug.h>
 #include <Kernel/InterruptDisabler.h>
 #include <Kernel/Panic.h>
+#include <Kernel/PerCpuCounter.h>
 #include <Kernel/PerformanceManager.h>
 #include <Kernel/Process.h>
 #include <Kernel/Scheduler.h>
@@ -46,7 +47,17 @@ struct ThreadReadyQueues {
     Array<ThreadReadyQueue, count> queues;
 };
 
-static Singleton<SpinlockProtected<ThreadReadyQueues, LockRank::None>> g_ready_queues;
+// One set of priority-bucketed ready queues per CPU, each behind its own
+// spinlock, so that enqueues and dequeues on different CPUs don't contend on
+// a single global queue lock. A CPU whose own queues are empty steals work
+// from the other CPUs' queues in pull_next_runnable_thread().
+static Singleton<Array<SpinlockProtected<ThreadReadyQueues, LockRank::None>, MAX_CPU_COUNT>> g_ready_queues;
+
+static SpinlockProtected<ThreadReadyQueues, LockRank::None>& ready_queues_for_cpu(u32 cpu)
+{
+    VERIFY(cpu < MAX_CPU_COUNT);
+    return (*g_ready_queues)[cpu];
+}
 
 static SpinlockProtected<TotalTimeScheduled, LockRank::None> g_total_time_scheduled {};
 
@@ -66,69 +77,95 @@ static inline u32 thread_priority_to_priority_index(u32 thread_priority)
 
 Thread& Scheduler::pull_next_runnable_thread()
 {
-    auto affinity_mask = 1u << Processor::current_id();
-
-    return g_ready_queues->with([&](auto& ready_queues) -> Thread& {
-        auto priority_mask = ready_queues.mask;
-        while (priority_mask != 0) {
-            auto priority = bit_scan_forward(priority_mask);
-            VERIFY(priority > 0);
-            auto& ready_queue = ready_queues.queues[--priority];
-            for (auto& thread : ready_queue.thread_list) {
-                VERIFY(thread.m_runnable_priority == (int)priority);
-                if (thread.is_active())
-                    continue;
-                if (!(thread.affinity() & affinity_mask))
-                    continue;
-                thread.m_runnable_priority = -1;
-                ready_queue.thread_list.remove(thread);
-                if (ready_queue.thread_list.is_empty())
-                    ready_queues.mask &= ~(1u << priority);
-                // Mark it as active because we are using this thread. This is similar
-                // to comparing it with Processor::current_thread, but when there are
-                // multiple processors there's no easy way to check whether the thread
-                // is actually still needed. This prevents accidental finalization when
-                // a thread is no longer in Running state, but running on another core.
-
-                // We need to mark it active here so that this thread won't be
-                // scheduled on another core if it were to be queued before actually
-                // switching to it.
-                // FIXME: Figure out a better way maybe?
-                thread.set_active(true);
-                return thread;
+    auto current_cpu = Processor::current_id();
+    auto affinity_mask = 1u << current_cpu;
+
+    auto pull_from_cpu = [&](u32 cpu) -> Thread* {
+        return ready_queues_for_cpu(cpu).with([&](auto& ready_queues) -> Thread* {
+            auto priority_mask = ready_queues.mask;
+            while (priority_mask != 0) {
+                auto priority = bit_scan_forward(priority_mask);
+                VERIFY(priority > 0);
+                auto& ready_queue = ready_queues.queues[--priority];
+                for (auto& thread : ready_queue.thread_list) {
+                    VERIFY(thread.m_runnable_priority == (int)priority);
+                    if (thread.is_active())
+                        continue;
+                    if (!(thread.affinity() & affinity_mask))
+                        continue;
+                    thread.m_runnable_priority = -1;
+                    ready_queue.thread_list.remove(thread);
+                    if (ready_queue.thread_list.is_empty())
+                        ready_queues.mask &= ~(1u << priority);
+                    // Mark it as active because we are using this thread. This is similar
+                    // to comparing it with Processor::current_thread, but when there are
+                    // multiple processors there's no easy way to check whether the thread
+                    // is actually still needed. This prevents accidental finalization when
+                    // a thread is no longer in Running state, but running on another core.
+
+                    // We need to mark it active here so that this thread won't be
+                    // scheduled on another core if it were to be queued before actually
+                    // switching to it.
+                    // FIXME: Figure out a better way maybe?
+                    thread.set_active(true);
+                    return &thread;
+                }
+                priority_mask &= ~(1u << priority);
             }
-            priority_mask &= ~(1u << priority);
-        }
-        return *Processor::idle_thread();
-    });
+            return nullptr;
+        });
+    };
+
+    // Look at our own queues first; if they have nothing for us, steal work
+    // from the other CPUs, starting with our nearest neighbor.
+    if (auto* thread = pull_from_cpu(current_cpu))
+        return *thread;
+    auto cpu_count = Processor::count();
+    for (u32 i = 1; i < cpu_count; ++i) {
+        if (auto* thread = pull_from_cpu((current_cpu + i) % cpu_count))
+            return *thread;
+    }
+    return *Processor::idle_thread();
 }
 
 Thread* Scheduler::peek_next_runnable_thread()
 {
-    auto affinity_mask = 1u << Processor::current_id();
-
-    return g_ready_queues->with([&](auto& ready_queues) -> Thread* {
-        auto priority_mask = ready_queues.mask;
-        while (priority_mask != 0) {
-            auto priority = bit_scan_forward(priority_mask);
-            VERIFY(priority > 0);
-            auto& ready_queue = ready_queues.queues[--priority];
-            for (auto& thread : ready_queue.thread_list) {
-                VERIFY(thread.m_runnable_priority == (int)priority);
-                if (thread.is_active())
-                    continue;
-                if (!(thread.affinity() & affinity_mask))
-                    continue;
-                return &thread;
+    auto current_cpu = Processor::current_id();
+    auto affinity_mask = 1u << current_cpu;
+
+    auto peek_cpu = [&](u32 cpu) -> Thread* {
+        return ready_queues_for_cpu(cpu).with([&](auto& ready_queues) -> Thread* {
+            auto priority_mask = ready_queues.mask;
+            while (priority_mask != 0) {
+                auto priority = bit_scan_forward(priority_mask);
+                VERIFY(priority > 0);
+                auto& ready_queue = ready_queues.queues[--priority];
+                for (auto& thread : ready_queue.thread_list) {
+                    VERIFY(thread.m_runnable_priority == (int)priority);
+                    if (thread.is_active())
+                        continue;
+                    if (!(thread.affinity() & affinity_mask))
+                        continue;
+                    return &thread;
+                }
+                priority_mask &= ~(1u << priority);
             }
-            priority_mask &= ~(1u << priority);
-        }
 
-        // Unlike in pull_next_runnable_thread() we don't want to fall back to
-        // the idle thread. We just want to see if we have any other thread ready
-        // to be scheduled.
-        return nullptr;
-    });
+            // Unlike in pull_next_runnable_thread() we don't want to fall back to
+            // the idle thread. We just want to see if we have any other thread ready
+            // to be scheduled.
+            return nullptr;
+        });
+    };
+
+    if (auto* thread = peek_cpu(current_cpu))
+        return thread;
+    auto cpu_count = Processor::count();
+    for (u32 i = 1; i < cpu_count; ++i) {
+        if (auto* thread = peek_cpu((current_cpu + i) % cpu_count))
+            return thread;
+    }
+    return nullptr;
 }
 
 bool Scheduler::dequeue_runnable_thread(Thread& thread, bool check_affinity)
@@ -136,7 +173,7 @@ bool Scheduler::dequeue_runnable_thread(Thread& thread, bool check_affinity)
     if (thread.is_idle_thread())
         return true;
 
-    return g_ready_queues->with([&](auto& ready_queues) {
+    return ready_queues_for_cpu(thread.m_ready_queue_cpu).with([&](auto& ready_queues) {
         auto priority = thread.m_runnable_priority;
         if (priority < 0) {
             VERIFY(!thread.m_ready_queue_node.is_in_list());
@@ -163,9 +200,26 @@ void Scheduler::enqueue_runnable_thread(Thread& thread)
         return;
     auto priority = thread_priority_to_priority_index(thread.priority());
 
-    g_ready_queues->with([&](auto& ready_queues) {
+    // Prefer the CPU the thread last ran on, since its caches may still be
+    // warm there, as long as the thread's affinity allows it; otherwise fall
+    // back to the current CPU, or failing that the first allowed one.
+    auto affinity = thread.affinity();
+    auto current_cpu = Processor::current_id();
+    u32 target_cpu = thread.cpu();
+    if (target_cpu >= Processor::count() || !(affinity & (1u << target_cpu))) {
+        if (affinity & (1u << current_cpu)) {
+            target_cpu = current_cpu;
+        } else {
+            auto first_allowed = bit_scan_forward(affinity);
+            VERIFY(first_allowed > 0);
+            target_cpu = min(first_allowed - 1, Processor::count() - 1);
+        }
+    }
+
+    ready_queues_for_cpu(target_cpu).with([&](auto& ready_queues) {
         VERIFY(thread.m_runnable_priority < 0);
         thread.m_runnable_priority = (int)priority;
+        thread.m_ready_queue_cpu = target_cpu;
         VERIFY(!thread.m_ready_queue_node.is_in_list());
         auto& ready_queue = ready_queues.queues[priority];
         bool was_empty = ready_queue.thread_list.is_empty();
@@ -173,6 +227,13 @@ void Scheduler::enqueue_runnable_thread(Thread& thread)
         if (was_empty)
             ready_queues.mask |= (1u << priority);
     });
+
+    // If the thread went onto another CPU's queue, poke that CPU if it's
+    // sitting idle; otherwise fall back to waking any idle CPU, which will
+    // steal the thread if we don't get around to it first.
+    if (target_cpu != current_cpu && Processor::smp_wake_idle_processor(target_cpu))
+        return;
+    Processor::smp_wake_n_idle_processors(1);
 }
 
 UNMAP_AFTER_INIT void Scheduler::start()
@@ -254,6 +315,8 @@ void Scheduler::yield()
     Scheduler::pick_next();
 }
 
+static PerCpuCounter s_context_switch_counter { "scheduler.context_switches"sv };
+
 void Scheduler::context_switch(Thread* thread)
 {
     thread->did_schedule();
@@ -264,6 +327,8 @@ void Scheduler::context_switch(Thread* thread)
     if (from_thread == thread)
         return;
 
+    s_context_switch_counter.increment();
+
     // If the last process hasn't blocked (still marked as running),
     // mark it as runnable for the next round.
     if (from_thread->state() == Thread::State::Running)
@@ -309,6 +374,12 @@ void Scheduler::enter_current(Thread& prev_thread)
     auto* current_thread = Thread::current();
     current_thread->update_time_scheduled(scheduler_time, true, false);
 
+    if (PerformanceCounters::is_supported()) {
+        auto counters = PerformanceCounters::read_current_processor();
+        prev_thread.accumulate_performance_counters(counters);
+        current_thread->snapshot_performance_counters(counters);
+    }
+
     // NOTE: When doing an exec(), we will context switch from and to the same thread!
     //       In that case, we must not mark the previous thread as inactive.
     if (&prev_thread != current_thread)
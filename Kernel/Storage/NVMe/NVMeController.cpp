@@ -64,6 +64,8 @@ UNMAP_AFTER_INIT ErrorOr<void> NVMeController::initialize(bool is_queue_polled)
         // qid is zero is used for admin queue
         TRY(create_io_queue(cpuid + 1, irq));
     }
+    if (irq.has_value() && !kernel_command_line().is_nvme_interrupt_coalescing_disabled())
+        set_interrupt_coalescing();
     TRY(identify_and_init_namespaces());
     return {};
 }
@@ -138,6 +140,24 @@ bool NVMeController::start_controller()
     return true;
 }
 
+UNMAP_AFTER_INIT void NVMeController::set_interrupt_coalescing()
+{
+    // Ask the controller to batch completions instead of raising an interrupt
+    // for every single one: wait until IRQ_COALESCING_THRESHOLD + 1 entries
+    // have accumulated or IRQ_COALESCING_TIME has passed, whichever comes
+    // first. The feature is optional, so a failure just leaves us with
+    // per-completion interrupts.
+    NVMeSubmission sub {};
+    sub.op = OP_ADMIN_SET_FEATURES;
+    sub.generic.cdw10 = AK::convert_between_host_and_little_endian(FID_INTERRUPT_COALESCING);
+    sub.generic.cdw11 = AK::convert_between_host_and_little_endian((IRQ_COALESCING_TIME << 8) | IRQ_COALESCING_THRESHOLD);
+    if (submit_admin_command(sub, true) != 0) {
+        dbgln_if(NVME_DEBUG, "NVMe: Controller does not support interrupt coalescing");
+        return;
+    }
+    dbgln_if(NVME_DEBUG, "NVMe: Interrupt coalescing enabled (threshold: {}, time: {}00us)", IRQ_COALESCING_THRESHOLD + 1, IRQ_COALESCING_TIME);
+}
+
 UNMAP_AFTER_INIT u32 NVMeController::get_admin_q_dept()
 {
     u32 aqa = m_controller_regs->aqa;
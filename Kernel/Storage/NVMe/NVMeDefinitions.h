@@ -108,12 +108,20 @@ static constexpr u8 FLBA_SIZE_MASK = 0xf;
 static constexpr u8 LBA_FORMAT_SUPPORT_INDEX = 128;
 static constexpr u32 LBA_SIZE_MASK = 0x00ff0000;
 
+// SET FEATURES
+static constexpr u8 FID_INTERRUPT_COALESCING = 0x8;
+// The threshold is 0 based, so a value of 7 coalesces up to 8 completion entries.
+static constexpr u8 IRQ_COALESCING_THRESHOLD = 7;
+// In 100 microsecond units.
+static constexpr u8 IRQ_COALESCING_TIME = 1;
+
 // OPCODES
 // ADMIN COMMAND SET
 enum AdminCommandOpCode {
     OP_ADMIN_CREATE_COMPLETION_QUEUE = 0x5,
     OP_ADMIN_CREATE_SUBMISSION_QUEUE = 0x1,
     OP_ADMIN_IDENTIFY = 0x6,
+    OP_ADMIN_SET_FEATURES = 0x9,
 };
 
 // IO opcodes
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <Kernel/API/POSIX/aio.h>
+#include <Kernel/API/POSIX/errno.h>
+#include <Kernel/FileSystem/OpenFileDescription.h>
+#include <Kernel/Memory/ScopedAddressSpaceSwitcher.h>
+#include <Kernel/Process.h>
+#include <Kernel/WorkQueue.h>
+
+namespace Kernel {
+
+static constexpr size_t max_outstanding_async_io_requests = 64;
+
+ErrorOr<NonnullLockRefPtr<AsyncIORequest>> AsyncIORequest::try_create(Process& process, NonnullLockRefPtr<OpenFileDescription> description, Operation operation, FlatPtr user_buffer, size_t nbytes, off_t offset)
+{
+    return adopt_nonnull_lock_ref_or_enomem(new (nothrow) AsyncIORequest(process, move(description), operation, user_buffer, nbytes, offset));
+}
+
+AsyncIORequest::AsyncIORequest(Process& process, NonnullLockRefPtr<OpenFileDescription> description, Operation operation, FlatPtr user_buffer, size_t nbytes, off_t offset)
+    : m_process(process)
+    , m_description(move(description))
+    , m_operation(operation)
+    , m_user_buffer(user_buffer)
+    , m_nbytes(nbytes)
+    , m_offset(offset)
+{
+}
+
+AsyncIORequest::~AsyncIORequest() = default;
+
+void AsyncIORequest::execute()
+{
+    auto do_io = [&]() -> ErrorOr<size_t> {
+        // The IO work queue thread has no userspace mappings of its own, so
+        // borrow the submitting process's address space for the transfer.
+        ScopedAddressSpaceSwitcher switcher(*m_process);
+        auto buffer = TRY(UserOrKernelBuffer::for_user_buffer(reinterpret_cast<u8*>(m_user_buffer), m_nbytes));
+        if (m_operation == Operation::Read)
+            return m_description->read(buffer, m_offset, m_nbytes);
+        return m_description->write(m_offset, buffer, m_nbytes);
+    };
+
+    auto result = do_io();
+
+    SpinlockLocker locker(m_lock);
+    m_complete = true;
+    if (result.is_error())
+        m_error_code = result.error().code();
+    else
+        m_bytes_transferred = result.value();
+}
+
+bool AsyncIORequest::is_complete() const
+{
+    SpinlockLocker locker(m_lock);
+    return m_complete;
+}
+
+ErrorOr<size_t> AsyncIORequest::result() const
+{
+    SpinlockLocker locker(m_lock);
+    VERIFY(m_complete);
+    if (m_error_code != 0)
+        return Error::from_errno(m_error_code);
+    return m_bytes_transferred;
+}
+
+ErrorOr<FlatPtr> Process::sys$aio_submit(Userspace<const struct aiocb*> user_aiocb)
+{
+    VERIFY_NO_PROCESS_BIG_LOCK(this);
+    TRY(require_promise(Pledge::stdio));
+
+    auto control_block = TRY(copy_typed_from_user(user_aiocb));
+
+    if (control_block.aio_nbytes > NumericLimits<ssize_t>::max())
+        return EINVAL;
+    if (control_block.aio_offset < 0)
+        return EINVAL;
+
+    AsyncIORequest::Operation operation;
+    switch (control_block.aio_lio_opcode) {
+    case LIO_READ:
+        operation = AsyncIORequest::Operation::Read;
+        break;
+    case LIO_WRITE:
+        operation = AsyncIORequest::Operation::Write;
+        break;
+    default:
+        return EINVAL;
+    }
+
+    auto description = TRY(open_file_description(control_block.aio_fildes));
+    if (operation == AsyncIORequest::Operation::Read && !description->is_readable())
+        return EBADF;
+    if (operation == AsyncIORequest::Operation::Write && !description->is_writable())
+        return EBADF;
+    if (!description->file().is_seekable())
+        return EINVAL;
+
+    auto request = TRY(AsyncIORequest::try_create(*this, move(description), operation, control_block.aio_buf ? reinterpret_cast<FlatPtr>(const_cast<void*>(control_block.aio_buf)) : 0, control_block.aio_nbytes, control_block.aio_offset));
+
+    TRY(m_async_io_requests.with([&](auto& requests) -> ErrorOr<void> {
+        if (requests.size() >= max_outstanding_async_io_requests)
+            return EAGAIN;
+        if (requests.contains(user_aiocb.ptr()))
+            return EINVAL;
+        TRY(requests.try_set(user_aiocb.ptr(), request));
+        return {};
+    }));
+
+    if (auto result = g_io_work->try_queue([request] { request->execute(); }); result.is_error()) {
+        m_async_io_requests.with([&](auto& requests) { requests.remove(user_aiocb.ptr()); });
+        return result.release_error();
+    }
+
+    return 0;
+}
+
+ErrorOr<FlatPtr> Process::sys$aio_error(Userspace<const struct aiocb*> user_aiocb)
+{
+    VERIFY_NO_PROCESS_BIG_LOCK(this);
+    TRY(require_promise(Pledge::stdio));
+
+    auto request = TRY(m_async_io_requests.with([&](auto& requests) -> ErrorOr<NonnullLockRefPtr<AsyncIORequest>> {
+        auto it = requests.find(user_aiocb.ptr());
+        if (it == requests.end())
+            return EINVAL;
+        return it->value;
+    }));
+
+    if (!request->is_complete())
+        return EINPROGRESS;
+    auto result = request->result();
+    if (result.is_error())
+        return result.error().code();
+    return 0;
+}
+
+ErrorOr<FlatPtr> Process::sys$aio_return(Userspace<const struct aiocb*> user_aiocb)
+{
+    VERIFY_NO_PROCESS_BIG_LOCK(this);
+    TRY(require_promise(Pledge::stdio));
+
+    auto request = TRY(m_async_io_requests.with([&](auto& requests) -> ErrorOr<NonnullLockRefPtr<AsyncIORequest>> {
+        auto it = requests.find(user_aiocb.ptr());
+        if (it == requests.end())
+            return EINVAL;
+        return it->value;
+    }));
+
+    if (!request->is_complete())
+        return EINPROGRESS;
+
+    m_async_io_requests.with([&](auto& requests) { requests.remove(user_aiocb.ptr()); });
+    return TRY(request->result());
+}
+
+}
@@ -135,7 +135,14 @@ ErrorOr<FlatPtr> Process::sys$fork(RegisterState& regs)
             for (auto& region : parent_space->region_tree().regions()) {
                 dbgln_if(FORK_DEBUG, "fork: cloning Region '{}' @ {}", region.name(), region.vaddr());
                 auto region_clone = TRY(region.try_clone());
-                TRY(region_clone->map(child_space->page_directory(), Memory::ShouldFlushTLB::No));
+                // Private anonymous regions are mapped lazily: a fork+exec
+                // child typically touches only a handful of pages before
+                // exec() throws the cloned address space away, so writing
+                // every PTE up front is mostly wasted work.
+                if (region_clone->vmobject().is_anonymous() && !region_clone->is_shared())
+                    TRY(region_clone->map_lazily(child_space->page_directory()));
+                else
+                    TRY(region_clone->map(child_space->page_directory(), Memory::ShouldFlushTLB::No));
                 TRY(child_space->region_tree().place_specifically(*region_clone, region.range()));
                 auto* child_region = region_clone.leak_ptr();
 
@@ -432,7 +432,19 @@ ErrorOr<FlatPtr> Process::sys$madvise(Userspace<void*> address, size_t size, int
             TRY(vmobject.set_volatile(advice == MADV_SET_VOLATILE, was_purged));
             return was_purged ? 1 : 0;
         }
-        return EINVAL;
+        switch (advice) {
+        case MADV_NORMAL:
+        case MADV_SEQUENTIAL:
+        case MADV_RANDOM:
+        case MADV_WILLNEED:
+        case MADV_DONTNEED:
+            // Accept the POSIX access pattern hints so userspace can issue
+            // them unconditionally. We don't act on them (yet); readahead
+            // for MADV_SEQUENTIAL/MADV_WILLNEED would slot in here.
+            return 0;
+        default:
+            return EINVAL;
+        }
     });
 }
 
@@ -4,11 +4,37 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <Kernel/Arch/PerformanceCounters.h>
+#include <Kernel/InterruptDisabler.h>
 #include <Kernel/PerformanceEventBuffer.h>
 #include <Kernel/Process.h>
+#include <Kernel/UnixTypes.h>
 
 namespace Kernel {
 
+ErrorOr<FlatPtr> Process::sys$perf_counters(Userspace<struct perf_counters_info*> user_info)
+{
+    VERIFY_NO_PROCESS_BIG_LOCK(this);
+    TRY(require_promise(Pledge::stdio));
+    if (!PerformanceCounters::is_supported())
+        return ENOTSUP;
+
+    perf_counters_info info {};
+    {
+        // Disable interrupts so the calling thread can't migrate between
+        // reading the processor's counters and its own snapshot.
+        InterruptDisabler disabler;
+        auto* current_thread = Thread::current();
+        auto in_flight = PerformanceCounters::delta(current_thread->performance_counter_snapshot(), PerformanceCounters::read_current_processor());
+        auto const& accumulated = current_thread->performance_counters();
+        info.cycles = accumulated.cycles + in_flight.cycles;
+        info.instructions_retired = accumulated.instructions_retired + in_flight.instructions_retired;
+        info.cache_misses = accumulated.cache_misses + in_flight.cache_misses;
+    }
+    TRY(copy_to_user(user_info, &info));
+    return 0;
+}
+
 ErrorOr<FlatPtr> Process::sys$perf_event(int type, FlatPtr arg1, FlatPtr arg2)
 {
     VERIFY_PROCESS_BIG_LOCK_ACQUIRED(this);
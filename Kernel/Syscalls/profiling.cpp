@@ -41,7 +41,10 @@ ErrorOr<FlatPtr> Process::profiling_enable(pid_t pid, u64 event_mask)
         if (g_global_perf_events) {
             g_global_perf_events->clear();
         } else {
-            g_global_perf_events = PerformanceEventBuffer::try_create_with_size(32 * MiB).leak_ptr();
+            // The global buffer wraps so that a long-running (or always-on)
+            // session keeps the most recent window of events instead of
+            // filling up and rejecting everything after the first 32 MiB.
+            g_global_perf_events = PerformanceEventBuffer::try_create_with_size(32 * MiB, PerformanceEventBuffer::Wrap::Yes).leak_ptr();
             if (!g_global_perf_events) {
                 g_profiling_event_mask = 0;
                 return ENOMEM;
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/NumericLimits.h>
+#include <Kernel/FileSystem/OpenFileDescription.h>
+#include <Kernel/KBuffer.h>
+#include <Kernel/Process.h>
+
+namespace Kernel {
+
+static constexpr size_t sendfile_buffer_size = 64 * KiB;
+
+ErrorOr<FlatPtr> Process::sys$sendfile(int out_fd, int in_fd, Userspace<off_t*> userspace_offset, size_t count)
+{
+    VERIFY_PROCESS_BIG_LOCK_ACQUIRED(this);
+    TRY(require_promise(Pledge::stdio));
+
+    if (count > NumericLimits<ssize_t>::max())
+        return EINVAL;
+
+    auto in_description = TRY(open_file_description(in_fd));
+    if (!in_description->is_readable())
+        return EBADF;
+    if (!in_description->file().is_seekable())
+        return EINVAL;
+
+    auto out_description = TRY(open_file_description(out_fd));
+    if (!out_description->is_writable())
+        return EBADF;
+
+    off_t offset = 0;
+    if (userspace_offset) {
+        offset = TRY(copy_typed_from_user(userspace_offset));
+        if (offset < 0)
+            return EINVAL;
+    }
+
+    if (count == 0)
+        return 0;
+
+    // The file contents pass through a kernel staging buffer, so they never
+    // take a round-trip through userspace memory.
+    auto staging_buffer = TRY(KBuffer::try_create_with_size("Kernel: sendfile staging"sv, min(count, sendfile_buffer_size)));
+    auto kernel_buffer = UserOrKernelBuffer::for_kernel_buffer(staging_buffer->data());
+
+    size_t total_sent = 0;
+    while (total_sent < count) {
+        size_t chunk_size = min(staging_buffer->size(), count - total_sent);
+        auto nread_or_error = userspace_offset
+            ? in_description->read(kernel_buffer, offset, chunk_size)
+            : in_description->read(kernel_buffer, chunk_size);
+        if (nread_or_error.is_error()) {
+            if (total_sent > 0)
+                break;
+            return nread_or_error.release_error();
+        }
+        size_t nread = nread_or_error.value();
+        if (nread == 0)
+            break;
+
+        auto nwritten_or_error = do_write(*out_description, kernel_buffer, nread);
+        if (nwritten_or_error.is_error()) {
+            // Rewind the input so the bytes we read but didn't send can be
+            // read again.
+            if (!userspace_offset)
+                (void)in_description->seek(-static_cast<off_t>(nread), SEEK_CUR);
+            if (total_sent > 0)
+                break;
+            return nwritten_or_error.release_error();
+        }
+        size_t nwritten = nwritten_or_error.value();
+        offset += nwritten;
+        total_sent += nwritten;
+        if (nwritten < nread) {
+            // Short write (e.g. the socket buffer filled up and the
+            // description is non-blocking); rewind the unsent part.
+            if (!userspace_offset)
+                (void)in_description->seek(-static_cast<off_t>(nread - nwritten), SEEK_CUR);
+            break;
+        }
+    }
+
+    if (userspace_offset)
+        TRY(copy_to_user(userspace_offset, &offset));
+
+    return total_sent;
+}
+
+}
@@ -176,6 +176,11 @@ ErrorOr<FlatPtr> Process::sys$sendmsg(int sockfd, Userspace<const struct msghdr*
 {
     VERIFY_PROCESS_BIG_LOCK_ACQUIRED(this);
     TRY(require_promise(Pledge::stdio));
+    return do_sendmsg(sockfd, user_msg, flags);
+}
+
+ErrorOr<FlatPtr> Process::do_sendmsg(int sockfd, Userspace<const struct msghdr*> user_msg, int flags)
+{
     auto msg = TRY(copy_typed_from_user(user_msg));
 
     if (msg.msg_iovlen != 1)
@@ -231,7 +236,11 @@ ErrorOr<FlatPtr> Process::sys$recvmsg(int sockfd, Userspace<struct msghdr*> user
 {
     VERIFY_PROCESS_BIG_LOCK_ACQUIRED(this);
     TRY(require_promise(Pledge::stdio));
+    return do_recvmsg(sockfd, user_msg, flags);
+}
 
+ErrorOr<FlatPtr> Process::do_recvmsg(int sockfd, Userspace<struct msghdr*> user_msg, int flags)
+{
     struct msghdr msg;
     TRY(copy_from_user(&msg, user_msg));
 
@@ -286,6 +295,60 @@ ErrorOr<FlatPtr> Process::sys$recvmsg(int sockfd, Userspace<struct msghdr*> user
     return result.value();
 }
 
+ErrorOr<FlatPtr> Process::sys$sendmmsg(int sockfd, Userspace<struct mmsghdr*> user_msgvec, unsigned message_count, int flags)
+{
+    VERIFY_PROCESS_BIG_LOCK_ACQUIRED(this);
+    TRY(require_promise(Pledge::stdio));
+    if (message_count > IOV_MAX)
+        message_count = IOV_MAX;
+
+    size_t messages_sent = 0;
+    for (unsigned i = 0; i < message_count; ++i) {
+        Userspace<const struct msghdr*> user_msg { user_msgvec.ptr() + i * sizeof(mmsghdr) + __builtin_offsetof(mmsghdr, msg_hdr) };
+        auto result = do_sendmsg(sockfd, user_msg, flags);
+        if (result.is_error()) {
+            // Once something has been sent we report the partial count; the
+            // caller rediscovers the error on its next call.
+            if (messages_sent > 0)
+                break;
+            return result.release_error();
+        }
+        auto bytes_sent = static_cast<unsigned>(result.value());
+        TRY(copy_to_user(&user_msgvec.unsafe_userspace_ptr()[i].msg_len, &bytes_sent));
+        ++messages_sent;
+    }
+    return messages_sent;
+}
+
+ErrorOr<FlatPtr> Process::sys$recvmmsg(int sockfd, Userspace<struct mmsghdr*> user_msgvec, unsigned message_count, int flags)
+{
+    VERIFY_PROCESS_BIG_LOCK_ACQUIRED(this);
+    TRY(require_promise(Pledge::stdio));
+    if (message_count > IOV_MAX)
+        message_count = IOV_MAX;
+
+    size_t messages_received = 0;
+    int message_flags = flags;
+    for (unsigned i = 0; i < message_count; ++i) {
+        Userspace<struct msghdr*> user_msg { user_msgvec.ptr() + i * sizeof(mmsghdr) + __builtin_offsetof(mmsghdr, msg_hdr) };
+        auto result = do_recvmsg(sockfd, user_msg, message_flags);
+        if (result.is_error()) {
+            if (messages_received > 0)
+                break;
+            return result.release_error();
+        }
+        auto bytes_received = static_cast<unsigned>(result.value());
+        TRY(copy_to_user(&user_msgvec.unsafe_userspace_ptr()[i].msg_len, &bytes_received));
+        ++messages_received;
+        // Only the first message may block; after that we drain whatever is
+        // already queued and return.
+        message_flags = flags | MSG_DONTWAIT;
+        if (bytes_received == 0)
+            break;
+    }
+    return messages_received;
+}
+
 template<bool sockname, typename Params>
 ErrorOr<void> Process::get_sock_or_peer_name(Params const& params)
 {
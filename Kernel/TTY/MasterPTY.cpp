@@ -125,6 +125,10 @@ ErrorOr<void> MasterPTY::ioctl(OpenFileDescription& description, unsigned reques
     case TIOCSWINSZ:
     case TIOCGPGRP:
         return m_slave->ioctl(description, request, arg);
+    case FIONREAD: {
+        int readable = m_buffer->immediately_readable();
+        return copy_to_user(static_ptr_cast<int*>(arg), &readable);
+    }
     default:
         return EINVAL;
     }
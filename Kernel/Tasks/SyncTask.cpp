@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Atomic.h>
 #include <Kernel/FileSystem/VirtualFileSystem.h>
 #include <Kernel/Process.h>
 #include <Kernel/Sections.h>
@@ -12,6 +13,19 @@
 
 namespace Kernel {
 
+static Atomic<u32> s_interval_in_seconds { 1 };
+
+u32 SyncTask::interval_in_seconds()
+{
+    return s_interval_in_seconds.load();
+}
+
+void SyncTask::set_interval_in_seconds(u32 interval_in_seconds)
+{
+    VERIFY(interval_in_seconds > 0);
+    s_interval_in_seconds.store(interval_in_seconds);
+}
+
 UNMAP_AFTER_INIT void SyncTask::spawn()
 {
     LockRefPtr<Thread> syncd_thread;
@@ -19,7 +33,7 @@ UNMAP_AFTER_INIT void SyncTask::spawn()
         dbgln("VFS SyncTask is running");
         for (;;) {
             VirtualFileSystem::sync();
-            (void)Thread::current()->sleep(Time::from_seconds(1));
+            (void)Thread::current()->sleep(Time::from_seconds(interval_in_seconds()));
         }
     });
 }
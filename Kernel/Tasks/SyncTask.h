@@ -6,9 +6,14 @@
 
 #pragma once
 
+#include <AK/Types.h>
+
 namespace Kernel {
 class SyncTask {
 public:
     static void spawn();
+
+    static u32 interval_in_seconds();
+    static void set_interval_in_seconds(u32);
 };
 }
@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <Kernel/Memory/MemoryManager.h>
+#include <Kernel/Process.h>
+#include <Kernel/Sections.h>
+#include <Kernel/Tasks/ZeroPageTask.h>
+#include <Kernel/Time/TimeManagement.h>
+
+namespace Kernel {
+
+UNMAP_AFTER_INIT void ZeroPageTask::spawn()
+{
+    LockRefPtr<Thread> zero_page_thread;
+    (void)Process::create_kernel_process(zero_page_thread, KString::must_create("Zero Page Task"sv), [] {
+        Thread::current()->set_priority(THREAD_PRIORITY_LOW);
+        for (;;) {
+            MM.refill_pre_zeroed_page_pool();
+            (void)Thread::current()->sleep(Time::from_seconds(1));
+        }
+    });
+}
+
+}
@@ -1267,8 +1267,8 @@ void Thread::set_state(State new_state, u8 stop_signal)
     }
 
     if (m_state == Thread::State::Runnable) {
+        // NOTE: enqueue_runnable_thread() wakes an idle processor if necessary.
         Scheduler::enqueue_runnable_thread(*this);
-        Processor::smp_wake_n_idle_processors(1);
     } else if (m_state == Thread::State::Stopped) {
         // We don't want to restore to Running state, only Runnable!
         m_stop_state = previous_state != Thread::State::Running ? previous_state : Thread::State::Runnable;
@@ -17,6 +17,7 @@
 #include <AK/Vector.h>
 #include <Kernel/API/POSIX/sched.h>
 #include <Kernel/API/POSIX/signal_numbers.h>
+#include <Kernel/Arch/PerformanceCounters.h>
 #include <Kernel/Arch/RegisterState.h>
 #include <Kernel/Arch/ThreadRegisters.h>
 #include <Kernel/Debug.h>
@@ -930,6 +931,22 @@ public:
         m_unix_socket_write_bytes += bytes;
     }
 
+    PerformanceCounterSnapshot const& performance_counters() const { return m_performance_counters; }
+    PerformanceCounterSnapshot const& performance_counter_snapshot() const { return m_performance_counter_snapshot; }
+
+    void accumulate_performance_counters(PerformanceCounterSnapshot const& now)
+    {
+        auto counted = PerformanceCounters::delta(m_performance_counter_snapshot, now);
+        m_performance_counters.cycles += counted.cycles;
+        m_performance_counters.instructions_retired += counted.instructions_retired;
+        m_performance_counters.cache_misses += counted.cache_misses;
+    }
+
+    void snapshot_performance_counters(PerformanceCounterSnapshot const& now)
+    {
+        m_performance_counter_snapshot = now;
+    }
+
     unsigned ipv4_socket_read_bytes() const { return m_ipv4_socket_read_bytes; }
     unsigned ipv4_socket_write_bytes() const { return m_ipv4_socket_write_bytes; }
 
@@ -1101,6 +1118,9 @@ private:
 
     IntrusiveListNode<Thread> m_process_thread_list_node;
     int m_runnable_priority { -1 };
+    // Which CPU's ready queue the thread currently sits on. Only valid while
+    // m_runnable_priority is >= 0.
+    u32 m_ready_queue_cpu { 0 };
 
     friend class WaitQueue;
 
@@ -1231,6 +1251,9 @@ private:
     unsigned m_ipv4_socket_read_bytes { 0 };
     unsigned m_ipv4_socket_write_bytes { 0 };
 
+    PerformanceCounterSnapshot m_performance_counters;
+    PerformanceCounterSnapshot m_performance_counter_snapshot;
+
     FPUState m_fpu_state {};
     State m_state { Thread::State::Invalid };
     NonnullOwnPtr<KString> m_name;
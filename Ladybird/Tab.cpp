@@ -167,7 +167,7 @@ void Tab::back()
 
     m_is_history_navigation = true;
     m_history.go_back();
-    view().load(m_history.current().url.to_deprecated_string());
+    view().load_history_entry(m_history.current().url.to_deprecated_string());
 }
 
 void Tab::forward()
@@ -177,7 +177,7 @@ void Tab::forward()
 
     m_is_history_navigation = true;
     m_history.go_forward();
-    view().load(m_history.current().url.to_deprecated_string());
+    view().load_history_entry(m_history.current().url.to_deprecated_string());
 }
 
 void Tab::home()
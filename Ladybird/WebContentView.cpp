@@ -17,6 +17,7 @@
 #include <AK/HashTable.h>
 #include <AK/LexicalPath.h>
 #include <AK/NonnullOwnPtr.h>
+#include <AK/Optional.h>
 #include <AK/StringBuilder.h>
 #include <AK/Types.h>
 #include <Browser/CookieJar.h>
@@ -551,10 +552,20 @@ void WebContentView::hideEvent(QHideEvent* event)
     client().async_set_system_visibility_state(false);
 }
 
-void WebContentView::create_client()
-{
-    m_client_state = {};
+struct SpawnedWebContentProcess {
+    int ui_fd { -1 };
+    int ui_fd_passing_fd { -1 };
+};
 
+// A spare WebContent process that has already finished dynamic linking and
+// LibWeb initialization (FlyString tables, default stylesheet parse, font
+// caches) and is idling on its sockets, waiting to be adopted by the next
+// tab. It is replaced in the background after being taken.
+static Optional<SpawnedWebContentProcess> s_spare_web_content_process;
+static DeprecatedString s_spare_webdriver_content_ipc_path;
+
+static SpawnedWebContentProcess spawn_web_content_process(DeprecatedString const& webdriver_content_ipc_path)
+{
     int socket_fds[2] {};
     MUST(Core::System::socketpair(AF_LOCAL, SOCK_STREAM, 0, socket_fds));
 
@@ -583,9 +594,9 @@ void WebContentView::create_client()
             webcontent_fd_passing_socket_string
         };
 
-        if (!m_webdriver_content_ipc_path.is_empty()) {
+        if (!webdriver_content_ipc_path.is_empty()) {
             arguments.append("--webdriver-content-path"sv);
-            arguments.append(m_webdriver_content_ipc_path);
+            arguments.append(webdriver_content_ipc_path);
         }
 
         auto result = Core::System::exec("./WebContent/WebContent"sv, arguments, Core::System::SearchInPath::Yes);
@@ -602,11 +613,43 @@ void WebContentView::create_client()
     MUST(Core::System::close(wc_fd_passing_fd));
     MUST(Core::System::close(wc_fd));
 
-    auto socket = MUST(Core::Stream::LocalSocket::adopt_fd(ui_fd));
+    return { ui_fd, ui_fd_passing_fd };
+}
+
+static void ensure_spare_web_content_process(DeprecatedString const& webdriver_content_ipc_path)
+{
+    if (s_spare_web_content_process.has_value())
+        return;
+    s_spare_webdriver_content_ipc_path = webdriver_content_ipc_path;
+    // Warm it up after returning to the event loop, so spawning the spare
+    // doesn't lengthen the tab creation it is spawned on behalf of.
+    QTimer::singleShot(0, [webdriver_content_ipc_path] {
+        if (!s_spare_web_content_process.has_value())
+            s_spare_web_content_process = spawn_web_content_process(webdriver_content_ipc_path);
+    });
+}
+
+void WebContentView::create_client()
+{
+    m_client_state = {};
+
+    auto webdriver_content_ipc_path = DeprecatedString { m_webdriver_content_ipc_path };
+
+    // Adopt the pre-initialized spare process when there is one, so the new
+    // tab doesn't pay for dynamic linking and LibWeb initialization itself.
+    SpawnedWebContentProcess process;
+    if (s_spare_web_content_process.has_value() && s_spare_webdriver_content_ipc_path == webdriver_content_ipc_path)
+        process = s_spare_web_content_process.release_value();
+    else
+        process = spawn_web_content_process(webdriver_content_ipc_path);
+
+    ensure_spare_web_content_process(webdriver_content_ipc_path);
+
+    auto socket = MUST(Core::Stream::LocalSocket::adopt_fd(process.ui_fd));
     MUST(socket->set_blocking(true));
 
     auto new_client = MUST(adopt_nonnull_ref_or_enomem(new (nothrow) WebView::WebContentClient(std::move(socket), *this)));
-    new_client->set_fd_passing_socket(MUST(Core::Stream::LocalSocket::adopt_fd(ui_fd_passing_fd)));
+    new_client->set_fd_passing_socket(MUST(Core::Stream::LocalSocket::adopt_fd(process.ui_fd_passing_fd)));
 
     auto* notifier = new QSocketNotifier(new_client->socket().fd().value(), QSocketNotifier::Type::Read);
     QObject::connect(notifier, &QSocketNotifier::activated, [new_client = new_client.ptr()] {
@@ -60,6 +60,7 @@ set(FILE_WATCHER_DEBUG ON)
 set(FILL_PATH_DEBUG ON)
 set(FORK_DEBUG ON)
 set(FRAMEBUFFER_DEVICE_DEBUG ON)
+set(FUNCTION_DEBUG ON)
 set(FUTEX_DEBUG ON)
 set(FUTEXQUEUE_DEBUG ON)
 set(GEMINI_DEBUG ON)
@@ -12,6 +12,7 @@
 #include <AK/Error.h>
 #include <AK/Find.h>
 #include <AK/HashMap.h>
+#include <AK/NumericLimits.h>
 #include <AK/Optional.h>
 #include <AK/QuickSort.h>
 #include <AK/SourceGenerator.h>
@@ -1074,15 +1075,120 @@ static constexpr Array<@mapping_type@, @size@> s_@name@_mappings { {
 )~~~");
     };
 
+    // The hottest properties (simple case mappings, general categories, and the
+    // word/grapheme segmentation properties) are emitted as two-stage lookup tables
+    // instead of binary-searched range lists: stage one maps the high bits of a code
+    // point to a 256-entry block of stage two, and identical blocks are deduplicated.
+    // A lookup is then two indexed loads, O(1) per code point.
+    constexpr u32 first_unallocated_code_point = 0x110000;
+    constexpr u32 two_stage_block_size = 256;
+
+    auto append_two_stage_table = [&](StringView name, StringView value_type, Vector<u64> const& values) {
+        VERIFY(values.size() % two_stage_block_size == 0);
+
+        Vector<size_t> stage_one;
+        Vector<u64> stage_two;
+        HashMap<DeprecatedString, size_t> unique_blocks;
+
+        for (size_t block_start = 0; block_start < values.size(); block_start += two_stage_block_size) {
+            StringBuilder block_builder;
+            for (size_t i = 0; i < two_stage_block_size; ++i)
+                block_builder.appendff("{:x};", values[block_start + i]);
+            auto block_key = block_builder.to_deprecated_string();
+
+            size_t block_index = 0;
+            if (auto it = unique_blocks.find(block_key); it != unique_blocks.end()) {
+                block_index = it->value;
+            } else {
+                block_index = stage_two.size() / two_stage_block_size;
+                unique_blocks.set(move(block_key), block_index);
+                for (size_t i = 0; i < two_stage_block_size; ++i)
+                    stage_two.append(values[block_start + i]);
+            }
+
+            stage_one.append(block_index);
+        }
+
+        VERIFY(unique_blocks.size() <= NumericLimits<u16>::max());
+
+        auto append_values = [&](auto const& values_to_append) {
+            constexpr size_t max_values_per_row = 20;
+            size_t values_in_current_row = 0;
+
+            for (auto value : values_to_append) {
+                if (values_in_current_row++ > 0)
+                    generator.append(", ");
+
+                generator.append(DeprecatedString::formatted("{:#x}", value));
+
+                if (values_in_current_row == max_values_per_row) {
+                    values_in_current_row = 0;
+                    generator.append(",\n    ");
+                }
+            }
+        };
+
+        generator.set("name", name);
+        generator.set("value_type", value_type);
+        generator.set("stage_one_size", DeprecatedString::number(stage_one.size()));
+        generator.set("stage_two_size", DeprecatedString::number(stage_two.size()));
+
+        generator.append(R"~~~(
+static constexpr Array<@value_type@, @stage_two_size@> s_@name@_stage_two {
+    )~~~");
+        append_values(stage_two);
+        generator.append(R"~~~(
+};
+
+static constexpr Array<u16, @stage_one_size@> s_@name@_stage_one {
+    )~~~");
+        append_values(stage_one);
+        generator.append(R"~~~(
+};
+)~~~");
+    };
+
+    auto append_two_stage_mapping_table = [&](StringView name, auto mapping_getter) {
+        Vector<u64> mappings;
+        mappings.resize(first_unallocated_code_point);
+
+        for (auto const& data : unicode_data.code_point_data) {
+            if (auto mapping = mapping_getter(data); mapping.has_value())
+                mappings[data.code_point] = *mapping;
+        }
+
+        append_two_stage_table(name, "u32"sv, mappings);
+    };
+
+    auto append_two_stage_mask_table = [&](StringView name, PropList const& property_list) {
+        auto property_names = property_list.keys();
+        quick_sort(property_names);
+        VERIFY(property_names.size() <= 64);
+
+        Vector<u64> masks;
+        masks.resize(first_unallocated_code_point);
+
+        // The bit index of each property matches its generated enum value, which is
+        // the property's position in the sorted name list (see generate_enum).
+        for (size_t i = 0; i < property_names.size(); ++i) {
+            for (auto const& range : property_list.find(property_names[i])->value) {
+                for (u32 code_point = range.first; code_point <= min(range.last, first_unallocated_code_point - 1); ++code_point)
+                    masks[code_point] |= 1ull << i;
+            }
+        }
+
+        append_two_stage_table(name, property_names.size() <= 32 ? "u32"sv : "u64"sv, masks);
+    };
+
     append_code_point_mappings("combining_class"sv, "CodePointMapping"sv, unicode_data.code_points_with_non_zero_combining_class,
         [](auto const& data) -> Optional<u32> {
             if (data.canonical_combining_class == 0)
                 return {};
             return data.canonical_combining_class;
         });
-    append_code_point_mappings("uppercase"sv, "CodePointMapping"sv, unicode_data.simple_uppercase_mapping_size, [](auto const& data) { return data.simple_uppercase_mapping; });
-    append_code_point_mappings("lowercase"sv, "CodePointMapping"sv, unicode_data.simple_lowercase_mapping_size, [](auto const& data) { return data.simple_lowercase_mapping; });
-    append_code_point_mappings("titlecase"sv, "CodePointMapping"sv, unicode_data.simple_titlecase_mapping_size, [](auto const& data) { return data.simple_titlecase_mapping; });
+    append_two_stage_mapping_table("uppercase_mappings"sv, [](auto const& data) { return data.simple_uppercase_mapping; });
+    append_two_stage_mapping_table("lowercase_mappings"sv, [](auto const& data) { return data.simple_lowercase_mapping; });
+    append_two_stage_mapping_table("titlecase_mappings"sv, [](auto const& data) { return data.simple_titlecase_mapping; });
     append_code_point_mappings("special_case"sv, "SpecialCaseMapping"sv, unicode_data.code_points_with_special_casing, [](auto const& data) { return data.special_casing_indices; });
     append_code_point_mappings("case_folding"sv, "CaseFoldingMapping"sv, unicode_data.code_points_with_case_folding, [](auto const& data) { return data.case_folding_indices; });
     append_code_point_mappings("abbreviation"sv, "CodePointAbbreviation"sv, unicode_data.code_point_abbreviations.size(), [](auto const& data) { return data.abbreviation; });
@@ -1146,13 +1252,13 @@ static constexpr Array<Span<CodePointRange const>, @size@> @name@ { {)~~~");
 )~~~");
     };
 
-    append_prop_list("s_general_categories"sv, "s_general_category_{}"sv, unicode_data.general_categories);
+    append_two_stage_mask_table("general_categories"sv, unicode_data.general_categories);
     append_prop_list("s_properties"sv, "s_property_{}"sv, unicode_data.prop_list);
     append_prop_list("s_scripts"sv, "s_script_{}"sv, unicode_data.script_list);
     append_prop_list("s_script_extensions"sv, "s_script_extension_{}"sv, unicode_data.script_extensions);
     append_prop_list("s_blocks"sv, "s_block_{}"sv, unicode_data.block_list);
-    append_prop_list("s_grapheme_break_properties"sv, "s_grapheme_break_property_{}"sv, unicode_data.grapheme_break_props);
-    append_prop_list("s_word_break_properties"sv, "s_word_break_property_{}"sv, unicode_data.word_break_props);
+    append_two_stage_mask_table("grapheme_break_properties"sv, unicode_data.grapheme_break_props);
+    append_two_stage_mask_table("word_break_properties"sv, unicode_data.word_break_props);
     append_prop_list("s_sentence_break_properties"sv, "s_sentence_break_property_{}"sv, unicode_data.sentence_break_props);
 
     auto append_code_point_display_names = [&](StringView type, StringView name, auto const& display_names) {
@@ -1241,10 +1347,25 @@ u32 @method@(u32 code_point)
 )~~~");
     };
 
+    auto append_two_stage_mapping_search = [&](StringView method, StringView name) {
+        generator.set("method", method);
+        generator.set("name", name);
+        generator.append(R"~~~(
+u32 @method@(u32 code_point)
+{
+    if (code_point >= 0x110000)
+        return code_point;
+
+    auto mapping = s_@name@_stage_two[(static_cast<size_t>(s_@name@_stage_one[code_point >> 8]) << 8) | (code_point & 0xff)];
+    return mapping == 0 ? code_point : mapping;
+}
+)~~~");
+    };
+
     append_code_point_mapping_search("canonical_combining_class"sv, "s_combining_class_mappings"sv, "0"sv);
-    append_code_point_mapping_search("to_unicode_uppercase"sv, "s_uppercase_mappings"sv, "code_point"sv);
-    append_code_point_mapping_search("to_unicode_lowercase"sv, "s_lowercase_mappings"sv, "code_point"sv);
-    append_code_point_mapping_search("to_unicode_titlecase"sv, "s_titlecase_mappings"sv, "code_point"sv);
+    append_two_stage_mapping_search("to_unicode_uppercase"sv, "uppercase_mappings"sv);
+    append_two_stage_mapping_search("to_unicode_lowercase"sv, "lowercase_mappings"sv);
+    append_two_stage_mapping_search("to_unicode_titlecase"sv, "titlecase_mappings"sv);
 
     generator.append(R"~~~(
 Span<SpecialCasing const* const> special_case_mapping(u32 code_point)
@@ -1332,9 +1453,25 @@ bool code_point_has_@enum_snake@(u32 code_point, @enum_title@ @enum_snake@)
         return {};
     };
 
+    auto append_two_stage_mask_search = [&](StringView enum_title, StringView enum_snake, StringView name) {
+        generator.set("enum_title", enum_title);
+        generator.set("enum_snake", enum_snake);
+        generator.set("name", name);
+        generator.append(R"~~~(
+bool code_point_has_@enum_snake@(u32 code_point, @enum_title@ @enum_snake@)
+{
+    if (code_point >= 0x110000)
+        return false;
+
+    auto mask = s_@name@_stage_two[(static_cast<size_t>(s_@name@_stage_one[code_point >> 8]) << 8) | (code_point & 0xff)];
+    return (mask >> static_cast<@enum_title@UnderlyingType>(@enum_snake@)) & 1;
+}
+)~~~");
+    };
+
     TRY(append_from_string("Locale"sv, "locale"sv, unicode_data.locales, {}));
 
-    append_prop_search("GeneralCategory"sv, "general_category"sv, "s_general_categories"sv);
+    append_two_stage_mask_search("GeneralCategory"sv, "general_category"sv, "general_categories"sv);
     TRY(append_from_string("GeneralCategory"sv, "general_category"sv, unicode_data.general_categories, unicode_data.general_category_aliases));
 
     append_prop_search("Property"sv, "property"sv, "s_properties"sv);
@@ -1347,8 +1484,8 @@ bool code_point_has_@enum_snake@(u32 code_point, @enum_title@ @enum_snake@)
     append_prop_search("Block"sv, "block"sv, "s_blocks"sv);
     TRY(append_from_string("Block"sv, "block"sv, unicode_data.block_list, unicode_data.block_aliases));
 
-    append_prop_search("GraphemeBreakProperty"sv, "grapheme_break_property"sv, "s_grapheme_break_properties"sv);
-    append_prop_search("WordBreakProperty"sv, "word_break_property"sv, "s_word_break_properties"sv);
+    append_two_stage_mask_search("GraphemeBreakProperty"sv, "grapheme_break_property"sv, "grapheme_break_properties"sv);
+    append_two_stage_mask_search("WordBreakProperty"sv, "word_break_property"sv, "word_break_properties"sv);
     append_prop_search("SentenceBreakProperty"sv, "sentence_break_property"sv, "s_sentence_break_properties"sv);
 
     generator.append(R"~~~(
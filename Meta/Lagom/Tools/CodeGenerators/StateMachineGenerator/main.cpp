@@ -337,6 +337,8 @@ public:
     {
     }
 
+    ALWAYS_INLINE bool in_initial_state() const { return m_state == State::@initial_state@; }
+
     void advance(u8 byte)
     {
         auto next_state = lookup_state_transition(byte);
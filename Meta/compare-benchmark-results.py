@@ -0,0 +1,72 @@
+#!/usr/bin/env python3
+
+"""
+Compares benchmark results against a baseline and fails on regression.
+
+Result files are produced by LibTest binaries, e.g.:
+
+    TestHashTable --bench --bench-repeat 5 --bench-json current.json
+
+A baseline is just an older result file, typically captured on a reference
+machine and checked in next to the CI configuration. A benchmark counts as
+regressed when its median time exceeds the baseline median by more than the
+given tolerance. Benchmarks that only appear on one side are reported but
+don't fail the comparison.
+
+Usage: compare-benchmark-results.py baseline.json current.json [tolerance-percent]
+"""
+
+import json
+import sys
+
+
+def load_results(path):
+    with open(path) as f:
+        data = json.load(f)
+    return {benchmark['name']: benchmark for benchmark in data['benchmarks']}
+
+
+def main():
+    if len(sys.argv) not in (3, 4):
+        print(__doc__.strip(), file=sys.stderr)
+        return 2
+
+    baseline_path, current_path = sys.argv[1], sys.argv[2]
+    tolerance_percent = float(sys.argv[3]) if len(sys.argv) == 4 else 5.0
+
+    baseline = load_results(baseline_path)
+    current = load_results(current_path)
+
+    regressions = []
+
+    for name in sorted(baseline.keys() | current.keys()):
+        if name not in baseline:
+            print(f'NEW        {name}: no baseline entry')
+            continue
+        if name not in current:
+            print(f'MISSING    {name}: present in baseline but was not run')
+            continue
+
+        baseline_median = baseline[name]['median_ns']
+        current_median = current[name]['median_ns']
+        if baseline_median == 0:
+            print(f'SKIPPED    {name}: baseline median is 0ns')
+            continue
+
+        delta_percent = (current_median - baseline_median) * 100.0 / baseline_median
+        status = 'OK'
+        if delta_percent > tolerance_percent:
+            status = 'REGRESSED'
+            regressions.append(name)
+        print(f'{status:<10} {name}: {baseline_median}ns -> {current_median}ns ({delta_percent:+.1f}%)')
+
+    if regressions:
+        print(f'\n{len(regressions)} benchmark(s) regressed by more than {tolerance_percent}%.', file=sys.stderr)
+        return 1
+
+    print(f'\nNo regressions beyond {tolerance_percent}%.')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
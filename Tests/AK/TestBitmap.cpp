@@ -6,6 +6,7 @@
 
 #include <LibTest/TestCase.h>
 
+#include <AK/Array.h>
 #include <AK/Bitmap.h>
 
 TEST_CASE(construct_empty)
@@ -276,3 +277,37 @@ TEST_CASE(byte_aligned_access)
         EXPECT_EQ(bitmap.count_in_range(4, 4, true), 1u);
     }
 }
+
+TEST_CASE(count_in_range_wide)
+{
+    // Large enough to exercise the vectorized and word-at-a-time paths.
+    auto bitmap = MUST(Bitmap::create(1024, false));
+    for (size_t i = 0; i < bitmap.size(); i += 3)
+        bitmap.set(i, true);
+
+    auto count_naive = [&](size_t start, size_t len) {
+        size_t count = 0;
+        for (size_t i = start; i < start + len; ++i) {
+            if (bitmap.get(i))
+                ++count;
+        }
+        return count;
+    };
+
+    for (size_t start : Array<size_t, 6> { 0, 1, 7, 8, 64, 129 }) {
+        for (size_t len : Array<size_t, 5> { 1, 9, 63, 256, 500 }) {
+            EXPECT_EQ(bitmap.count_in_range(start, len, true), count_naive(start, len));
+            EXPECT_EQ(bitmap.count_in_range(start, len, false), len - count_naive(start, len));
+        }
+    }
+}
+
+TEST_CASE(find_first_fit_after_long_full_run)
+{
+    auto bitmap = MUST(Bitmap::create(2048, true));
+    bitmap.set_range(2000, 40, false);
+    auto fit = bitmap.find_first_fit(32);
+    EXPECT(fit.has_value());
+    EXPECT_EQ(fit.value(), 2000u);
+    EXPECT(!bitmap.find_first_fit(48).has_value());
+}
@@ -6,6 +6,7 @@
 
 #include <LibTest/TestCase.h>
 
+#include <AK/BumpAllocator.h>
 #include <AK/ByteBuffer.h>
 
 TEST_CASE(equality_operator)
@@ -49,3 +50,23 @@ TEST_CASE(negative_operator_lt)
     // error: error: use of deleted function ‘bool AK::ByteBuffer::operator<(const AK::ByteBuffer&) const’
 }
 #endif /* COMPILE_NEGATIVE_TESTS */
+
+TEST_CASE(arena_backed_byte_buffer)
+{
+    BumpAllocator arena;
+    {
+        auto buffer = MUST(ArenaByteBuffer<>::create_uninitialized(100, AK::ArenaAllocatorForByteBuffer<>(arena)));
+        buffer.zero_fill();
+        for (size_t i = 0; i < 500; ++i)
+            buffer.append(static_cast<u8>(i));
+        EXPECT_EQ(buffer.size(), 600u);
+
+        // Buffers that outgrow an arena chunk transparently fall back to the heap.
+        auto big = MUST(ArenaByteBuffer<>::create_zeroed(10000, AK::ArenaAllocatorForByteBuffer<>(arena)));
+        EXPECT_EQ(big.size(), 10000u);
+
+        auto moved = move(buffer);
+        EXPECT_EQ(moved.size(), 600u);
+    }
+    arena.deallocate_all();
+}
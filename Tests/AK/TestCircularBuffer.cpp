@@ -348,3 +348,34 @@ TEST_CASE(offset_of_with_until_and_after_wrapping_around)
     result = circular_buffer.offset_of("Well "sv, 14, 19);
     EXPECT_EQ(result.value_or(42), 14ul);
 }
+
+TEST_CASE(flattened_read_span)
+{
+    auto const source = "Well Hello Friends!"sv;
+    auto byte_buffer_or_error = ByteBuffer::copy(source.bytes());
+    EXPECT(!byte_buffer_or_error.is_error());
+    auto byte_buffer = byte_buffer_or_error.release_value();
+
+    auto circular_buffer_or_error = CircularBuffer::create_initialized(byte_buffer);
+    EXPECT(!circular_buffer_or_error.is_error());
+    auto circular_buffer = circular_buffer_or_error.release_value();
+
+    // Contiguous data is returned as-is.
+    auto span_or_error = circular_buffer.flattened_read_span();
+    EXPECT(!span_or_error.is_error());
+    EXPECT_EQ(StringView { span_or_error.value() }, source);
+
+    safe_discard(circular_buffer, 5);
+    auto written_bytes = circular_buffer.write(byte_buffer.span().trim(5));
+    EXPECT_EQ(written_bytes, 5ul);
+
+    // Wrapped data is rotated to the start of the allocation.
+    span_or_error = circular_buffer.flattened_read_span();
+    EXPECT(!span_or_error.is_error());
+    EXPECT_EQ(StringView { span_or_error.value() }, "Hello Friends!Well "sv);
+    EXPECT_EQ(circular_buffer.used_space(), 19ul);
+
+    // The data is still readable as usual afterwards.
+    safe_read(circular_buffer, 'H');
+    safe_read(circular_buffer, 'e');
+}
@@ -313,3 +313,30 @@ TEST_CASE(roman_numerals)
     auto four_thousand = DeprecatedString::roman_number_from(4000);
     EXPECT_EQ(four_thousand, "4000");
 }
+
+TEST_CASE(shared_suffix_substring)
+{
+    DeprecatedString test_string = "The quick brown fox jumps over the lazy dog, again and again.";
+    auto suffix = test_string.substring(10);
+    // Long suffixes share the parent's buffer instead of copying.
+    EXPECT_EQ(static_cast<void const*>(suffix.characters()), static_cast<void const*>(test_string.characters() + 10));
+    EXPECT_EQ(suffix, DeprecatedString(test_string.characters() + 10));
+    EXPECT_EQ(suffix.characters()[suffix.length()], '\0');
+
+    // Substrings of substrings share the outermost buffer.
+    auto nested = suffix.substring(5);
+    EXPECT_EQ(static_cast<void const*>(nested.characters()), static_cast<void const*>(test_string.characters() + 15));
+
+    // The shared buffer outlives the parent string.
+    DeprecatedString kept;
+    {
+        auto temporary = DeprecatedString::repeated('x', 100);
+        kept = temporary.substring(50);
+    }
+    EXPECT_EQ(kept.length(), 50u);
+    EXPECT_EQ(kept, DeprecatedString::repeated('x', 50));
+
+    // Interior substrings still copy.
+    auto middle = test_string.substring(4, 5);
+    EXPECT_EQ(middle, "quick");
+}
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/DeprecatedString.h>
+#include <AK/FlatHashMap.h>
+#include <AK/FlatHashTable.h>
+
+TEST_CASE(construct)
+{
+    using IntTable = FlatHashTable<int>;
+    EXPECT(IntTable().is_empty());
+    EXPECT_EQ(IntTable().size(), 0u);
+}
+
+TEST_CASE(basic_insert_and_find)
+{
+    FlatHashTable<int> ints;
+    EXPECT_EQ(ints.set(1), HashSetResult::InsertedNewEntry);
+    EXPECT_EQ(ints.set(2), HashSetResult::InsertedNewEntry);
+    EXPECT_EQ(ints.set(3), HashSetResult::InsertedNewEntry);
+    EXPECT_EQ(ints.set(3), HashSetResult::ReplacedExistingEntry);
+    EXPECT_EQ(ints.size(), 3u);
+    EXPECT(ints.contains(1));
+    EXPECT(ints.contains(2));
+    EXPECT(ints.contains(3));
+    EXPECT(!ints.contains(4));
+}
+
+TEST_CASE(keep_existing_entry)
+{
+    FlatHashTable<int> ints;
+    EXPECT_EQ(ints.set(42), HashSetResult::InsertedNewEntry);
+    EXPECT_EQ(ints.set(42, AK::HashSetExistingEntryBehavior::Keep), HashSetResult::KeptExistingEntry);
+    EXPECT_EQ(ints.size(), 1u);
+}
+
+TEST_CASE(many_strings)
+{
+    FlatHashTable<DeprecatedString> strings;
+    for (int i = 0; i < 999; ++i)
+        EXPECT_EQ(strings.set(DeprecatedString::number(i)), HashSetResult::InsertedNewEntry);
+    EXPECT_EQ(strings.size(), 999u);
+    for (int i = 0; i < 999; ++i)
+        EXPECT(strings.contains(DeprecatedString::number(i)));
+    for (int i = 0; i < 999; ++i)
+        EXPECT(strings.remove(DeprecatedString::number(i)));
+    EXPECT(strings.is_empty());
+}
+
+TEST_CASE(remove_and_reinsert)
+{
+    FlatHashTable<int> ints;
+    for (int i = 0; i < 100; ++i)
+        ints.set(i);
+    for (int i = 0; i < 100; i += 2)
+        EXPECT(ints.remove(i));
+    EXPECT_EQ(ints.size(), 50u);
+    for (int i = 0; i < 100; ++i)
+        EXPECT_EQ(ints.contains(i), i % 2 == 1);
+    // Reinserting must reuse tombstones without losing the odd entries.
+    for (int i = 0; i < 100; i += 2)
+        EXPECT_EQ(ints.set(i), HashSetResult::InsertedNewEntry);
+    EXPECT_EQ(ints.size(), 100u);
+}
+
+TEST_CASE(iteration_visits_every_entry_once)
+{
+    FlatHashTable<int> ints;
+    for (int i = 0; i < 500; ++i)
+        ints.set(i);
+    u64 seen = 0;
+    size_t count = 0;
+    for (auto value : ints) {
+        EXPECT(value >= 0 && value < 500);
+        ++count;
+        (void)seen;
+    }
+    EXPECT_EQ(count, 500u);
+}
+
+TEST_CASE(remove_all_matching)
+{
+    FlatHashTable<int> ints;
+    for (int i = 0; i < 100; ++i)
+        ints.set(i);
+    EXPECT(ints.remove_all_matching([](int value) { return value % 3 == 0; }));
+    EXPECT(!ints.remove_all_matching([](int) { return false; }));
+    for (int i = 0; i < 100; ++i)
+        EXPECT_EQ(ints.contains(i), i % 3 != 0);
+}
+
+TEST_CASE(flat_hash_map_basic)
+{
+    FlatHashMap<int, DeprecatedString> map;
+    for (int i = 0; i < 100; ++i)
+        map.set(i, DeprecatedString::number(i));
+    EXPECT_EQ(map.size(), 100u);
+    for (int i = 0; i < 100; ++i)
+        EXPECT_EQ(map.get(i).value(), DeprecatedString::number(i));
+    EXPECT(!map.get(100).has_value());
+    EXPECT(map.remove(5));
+    EXPECT(!map.contains(5));
+    EXPECT_EQ(map.ensure(5), DeprecatedString());
+}
+
+TEST_CASE(flat_hash_map_string_keys)
+{
+    FlatHashMap<DeprecatedString, int> map;
+    map.set("one", 1);
+    map.set("two", 2);
+    EXPECT_EQ(map.get("one").value(), 1);
+    EXPECT_EQ(map.get("two").value(), 2);
+    map.set("one", 10);
+    EXPECT_EQ(map.size(), 2u);
+    EXPECT_EQ(map.get("one").value(), 10);
+}
+
+TEST_CASE(clear_with_capacity)
+{
+    FlatHashTable<DeprecatedString> strings;
+    for (int i = 0; i < 50; ++i)
+        strings.set(DeprecatedString::number(i));
+    auto capacity = strings.capacity();
+    strings.clear_with_capacity();
+    EXPECT(strings.is_empty());
+    EXPECT_EQ(strings.capacity(), capacity);
+    strings.set("hello");
+    EXPECT(strings.contains("hello"));
+}
@@ -9,6 +9,7 @@
 #include <AK/DeprecatedString.h>
 #include <AK/HashMap.h>
 #include <AK/JsonObject.h>
+#include <AK/JsonParser.h>
 #include <AK/JsonValue.h>
 #include <AK/StringBuilder.h>
 
@@ -430,3 +431,76 @@ TEST_CASE(json_value_as_integer)
     EXPECT(!very_large_value.is_integer<i32>());
     EXPECT(very_large_value.is_integer<i64>());
 }
+
+TEST_CASE(pull_parser_events)
+{
+    JsonPullParser parser("{ \"name\": \"Form1\", \"count\": 3, \"flag\": true, \"list\": [1, null] }"sv);
+    using EventType = JsonPullParser::EventType;
+
+    auto expect_event = [&](EventType type) {
+        auto event = MUST(parser.next_event());
+        EXPECT_EQ(to_underlying(event.type), to_underlying(type));
+        return event;
+    };
+
+    expect_event(EventType::ObjectStart);
+    EXPECT_EQ(expect_event(EventType::Key).string, "name"sv);
+    EXPECT_EQ(expect_event(EventType::String).string, "Form1"sv);
+    EXPECT_EQ(expect_event(EventType::Key).string, "count"sv);
+    EXPECT_EQ(expect_event(EventType::Number).value.to_i32(), 3);
+    EXPECT_EQ(expect_event(EventType::Key).string, "flag"sv);
+    EXPECT(expect_event(EventType::Boolean).value.as_bool());
+    EXPECT_EQ(expect_event(EventType::Key).string, "list"sv);
+    expect_event(EventType::ArrayStart);
+    EXPECT_EQ(expect_event(EventType::Number).value.to_i32(), 1);
+    expect_event(EventType::Null);
+    expect_event(EventType::ArrayEnd);
+    expect_event(EventType::ObjectEnd);
+    expect_event(EventType::End);
+    // End is sticky.
+    expect_event(EventType::End);
+}
+
+TEST_CASE(pull_parser_string_decoding)
+{
+    JsonPullParser parser("\"a\\nb\\u0041\""sv);
+    auto event = MUST(parser.next_event());
+    EXPECT_EQ(to_underlying(event.type), to_underlying(JsonPullParser::EventType::String));
+    // The raw view keeps the escapes; decoding is explicit.
+    EXPECT_EQ(event.string, "a\\nb\\u0041"sv);
+    EXPECT_EQ(MUST(parser.decode_string(event)), "a\nbA");
+}
+
+TEST_CASE(pull_parser_rejects_malformed_documents)
+{
+    for (auto input : { "{ \"a\": 1,, }"sv, "[1 2]"sv, "{ \"a\" 1 }"sv, "\"\\q\""sv, "1 2"sv }) {
+        JsonPullParser parser(input);
+        auto saw_error = false;
+        for (;;) {
+            auto event_or_error = parser.next_event();
+            if (event_or_error.is_error()) {
+                saw_error = true;
+                break;
+            }
+            if (event_or_error.value().type == JsonPullParser::EventType::End)
+                break;
+        }
+        EXPECT(saw_error);
+    }
+}
+
+TEST_CASE(key_interning)
+{
+    auto json = "[{ \"name\": 1 }, { \"name\": 2 }]"sv;
+    auto value = MUST(JsonParser(json, JsonParser::KeyInterning::Yes).parse());
+
+    Vector<StringImpl const*> key_impls;
+    value.as_array().for_each([&](JsonValue const& element) {
+        element.as_object().for_each_member([&](auto const& key, auto const&) {
+            key_impls.append(key.impl());
+        });
+    });
+    EXPECT_EQ(key_impls.size(), 2u);
+    // Both objects must share one interned key string.
+    EXPECT_EQ(key_impls[0], key_impls[1]);
+}
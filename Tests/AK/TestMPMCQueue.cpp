@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/MPMCQueue.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/RefCounted.h>
+
+TEST_CASE(enqueue_begins_empty)
+{
+    MPMCQueue<int, 4> queue;
+    EXPECT(queue.weak_is_empty());
+    EXPECT(!queue.try_dequeue().has_value());
+}
+
+TEST_CASE(enqueue_until_full)
+{
+    MPMCQueue<int, 4> queue;
+    for (int i = 0; i < 4; ++i)
+        EXPECT(queue.try_enqueue(i));
+    EXPECT(!queue.try_enqueue(4));
+    EXPECT_EQ(queue.weak_used(), 4u);
+}
+
+TEST_CASE(dequeue_in_fifo_order)
+{
+    MPMCQueue<int, 8> queue;
+    for (int i = 0; i < 8; ++i)
+        EXPECT(queue.try_enqueue(i));
+    for (int i = 0; i < 8; ++i) {
+        auto value = queue.try_dequeue();
+        EXPECT(value.has_value());
+        EXPECT_EQ(value.value(), i);
+    }
+    EXPECT(!queue.try_dequeue().has_value());
+}
+
+TEST_CASE(wraparound)
+{
+    MPMCQueue<int, 4> queue;
+    // Run several laps around the ring so every slot sees multiple sequence
+    // number generations.
+    for (int lap = 0; lap < 16; ++lap) {
+        for (int i = 0; i < 3; ++i)
+            EXPECT(queue.try_enqueue(lap * 3 + i));
+        for (int i = 0; i < 3; ++i) {
+            auto value = queue.try_dequeue();
+            EXPECT(value.has_value());
+            EXPECT_EQ(value.value(), lap * 3 + i);
+        }
+    }
+    EXPECT(queue.weak_is_empty());
+}
+
+TEST_CASE(single_producer_single_consumer_fast_path)
+{
+    MPMCQueue<int, 4> queue;
+    for (int i = 0; i < 4; ++i)
+        EXPECT(queue.try_enqueue_single_producer(i));
+    EXPECT(!queue.try_enqueue_single_producer(4));
+    for (int i = 0; i < 4; ++i) {
+        auto value = queue.try_dequeue_single_consumer();
+        EXPECT(value.has_value());
+        EXPECT_EQ(value.value(), i);
+    }
+    EXPECT(!queue.try_dequeue_single_consumer().has_value());
+}
+
+struct CountedThing : public RefCounted<CountedThing> {
+};
+
+TEST_CASE(destructor_drains_remaining_elements)
+{
+    auto thing = make_ref_counted<CountedThing>();
+    {
+        MPMCQueue<NonnullRefPtr<CountedThing>, 4> queue;
+        EXPECT(queue.try_enqueue(thing));
+        EXPECT(queue.try_enqueue(thing));
+        EXPECT_EQ(thing->ref_count(), 3u);
+    }
+    EXPECT_EQ(thing->ref_count(), 1u);
+}
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/StringSwitch.h>
+
+enum class Fruit {
+    Apple,
+    Banana,
+    Cherry,
+    Quince,
+};
+
+static constexpr auto s_fruits = StringSwitch {
+    StringSwitchCase { "apple"sv, Fruit::Apple },
+    StringSwitchCase { "banana"sv, Fruit::Banana },
+    StringSwitchCase { "cherry"sv, Fruit::Cherry },
+    StringSwitchCase { "quince"sv, Fruit::Quince },
+};
+
+TEST_CASE(finds_every_key)
+{
+    EXPECT_EQ(s_fruits.get("apple"sv).value(), Fruit::Apple);
+    EXPECT_EQ(s_fruits.get("banana"sv).value(), Fruit::Banana);
+    EXPECT_EQ(s_fruits.get("cherry"sv).value(), Fruit::Cherry);
+    EXPECT_EQ(s_fruits.get("quince"sv).value(), Fruit::Quince);
+}
+
+TEST_CASE(rejects_unknown_keys)
+{
+    EXPECT(!s_fruits.get(""sv).has_value());
+    EXPECT(!s_fruits.get("apples"sv).has_value());
+    EXPECT(!s_fruits.get("appl"sv).has_value());
+    EXPECT(!s_fruits.get("grape"sv).has_value());
+    // A key whose hash collides with a real slot must still be rejected by
+    // the final comparison.
+    EXPECT(!s_fruits.get("elppa"sv).has_value());
+}
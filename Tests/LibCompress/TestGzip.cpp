@@ -95,3 +95,17 @@ TEST_CASE(gzip_round_trip)
     EXPECT(!uncompressed.is_error());
     EXPECT(uncompressed.value() == original);
 }
+
+TEST_CASE(gzip_parallel_round_trip)
+{
+    // Large enough to span several of the parallel compressor's chunks.
+    auto original = ByteBuffer::create_uninitialized(1 * MiB).release_value();
+    fill_with_random(original.data(), original.size());
+    // Make some stretches compressible so that both stored and huffman blocks get exercised.
+    original.bytes().slice(200 * KiB, 300 * KiB).fill(0x41);
+    auto compressed = Compress::GzipCompressor::compress_all_parallel(original);
+    EXPECT(!compressed.is_error());
+    auto uncompressed = Compress::GzipDecompressor::decompress_all(compressed.value());
+    EXPECT(!uncompressed.is_error());
+    EXPECT(uncompressed.value() == original);
+}
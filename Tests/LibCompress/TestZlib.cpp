@@ -8,6 +8,7 @@
 
 #include <AK/Array.h>
 #include <LibCompress/Zlib.h>
+#include <LibCore/MemoryStream.h>
 
 TEST_CASE(zlib_decompress_simple)
 {
@@ -42,3 +43,27 @@ TEST_CASE(zlib_compress_simple)
     auto const freshly_pressed = Compress::ZlibCompressor::compress_all({ uncompressed, sizeof(uncompressed) - 1 });
     EXPECT(freshly_pressed.value().bytes() == compressed.span());
 }
+
+TEST_CASE(zlib_decompress_stream)
+{
+    Array<u8, 40> const compressed {
+        0x78, 0x01, 0x01, 0x1D, 0x00, 0xE2, 0xFF, 0x54, 0x68, 0x69, 0x73, 0x20,
+        0x69, 0x73, 0x20, 0x61, 0x20, 0x73, 0x69, 0x6D, 0x70, 0x6C, 0x65, 0x20,
+        0x74, 0x65, 0x78, 0x74, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x3A, 0x29,
+        0x99, 0x5E, 0x09, 0xE8
+    };
+
+    const u8 uncompressed[] = "This is a simple text file :)";
+
+    // Pull the output through the stream API a few bytes at a time.
+    auto memory_stream = MUST(Core::Stream::FixedMemoryStream::construct(compressed));
+    auto zlib_stream = MUST(Compress::ZlibDecompressor::construct(move(memory_stream)));
+    u8 output[64];
+    size_t offset = 0;
+    while (!zlib_stream->is_eof()) {
+        auto slice = MUST(zlib_stream->read(Bytes { output, sizeof(output) }.slice(offset).trim(5)));
+        offset += slice.size();
+    }
+    EXPECT_EQ(offset, sizeof(uncompressed) - 1);
+    EXPECT((ReadonlyBytes { output, offset }) == (ReadonlyBytes { uncompressed, sizeof(uncompressed) - 1 }));
+}
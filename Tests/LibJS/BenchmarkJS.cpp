@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/StringBuilder.h>
+#include <LibJS/Interpreter.h>
+#include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibJS/Script.h>
+#include <LibTest/TestCase.h>
+
+BENCHMARK_CASE(parse_large_program)
+{
+    StringBuilder builder;
+    for (size_t i = 0; i < 1000; ++i)
+        builder.appendff("function f{}(a, b) {{ let c = a + b; return c * {}; }}\n", i, i);
+    auto source = builder.to_deprecated_string();
+
+    auto vm = JS::VM::create();
+    auto interpreter = JS::Interpreter::create<JS::GlobalObject>(*vm);
+
+    for (int run = 0; run < 10; ++run) {
+        auto script = JS::Script::parse(source, interpreter->realm(), "benchmark"sv);
+        EXPECT(!script.is_error());
+    }
+}
+
+BENCHMARK_CASE(execute_recursive_fibonacci)
+{
+    auto source = R"(
+        function fib(n) {
+            if (n < 2)
+                return n;
+            return fib(n - 1) + fib(n - 2);
+        }
+        let sum = 0;
+        for (let i = 0; i < 16; ++i)
+            sum += fib(i);
+        sum;
+    )"sv;
+
+    auto vm = JS::VM::create();
+    auto interpreter = JS::Interpreter::create<JS::GlobalObject>(*vm);
+
+    auto script = JS::Script::parse(source, interpreter->realm(), "benchmark"sv);
+    EXPECT(!script.is_error());
+
+    for (int run = 0; run < 10; ++run) {
+        auto result = interpreter->run(script.value());
+        EXPECT(!result.is_error());
+    }
+}
@@ -123,6 +123,7 @@ constexpr static u32 pointers[] = {
 NonnullRefPtr<SQL::BTree> setup_btree(SQL::Serializer&);
 void insert_and_get_to_and_from_btree(int);
 void insert_into_and_scan_btree(int);
+void bulk_load_into_and_scan_btree(int);
 
 NonnullRefPtr<SQL::BTree> setup_btree(SQL::Serializer& serializer)
 {
@@ -224,6 +225,55 @@ void insert_into_and_scan_btree(int num_keys)
     }
 }
 
+void bulk_load_into_and_scan_btree(int num_keys)
+{
+    ScopeGuard guard([]() { unlink("/tmp/test.db"); });
+    {
+        auto heap = SQL::Heap::construct("/tmp/test.db");
+        EXPECT(!heap->open().is_error());
+        SQL::Serializer serializer(heap);
+        auto btree = setup_btree(serializer);
+
+        Vector<SQL::Key> btree_keys;
+        for (auto ix = 0; ix < num_keys; ix++) {
+            SQL::Key k(btree->descriptor());
+            k[0] = keys[ix];
+            k.set_pointer(pointers[ix]);
+            btree_keys.append(move(k));
+        }
+        EXPECT(btree->bulk_load(move(btree_keys)));
+#ifdef LIST_TREE
+        btree->list_tree();
+#endif
+    }
+
+    {
+        auto heap = SQL::Heap::construct("/tmp/test.db");
+        EXPECT(!heap->open().is_error());
+        SQL::Serializer serializer(heap);
+        auto btree = setup_btree(serializer);
+
+        for (auto ix = 0; ix < num_keys; ix++) {
+            SQL::Key k(btree->descriptor());
+            k[0] = keys[ix];
+            auto pointer_opt = btree->get(k);
+            VERIFY(pointer_opt.has_value());
+            EXPECT_EQ(pointer_opt.value(), pointers[ix]);
+        }
+
+        int count = 0;
+        SQL::Tuple prev;
+        for (auto iter = btree->begin(); !iter.is_end(); iter++, count++) {
+            auto key = (*iter);
+            if (prev.size()) {
+                EXPECT(prev < key);
+            }
+            prev = key;
+        }
+        EXPECT_EQ(count, num_keys);
+    }
+}
+
 TEST_CASE(btree_one_key)
 {
     insert_and_get_to_and_from_btree(1);
@@ -318,3 +368,41 @@ TEST_CASE(btree_scan_50_keys)
 {
     insert_into_and_scan_btree(50);
 }
+
+TEST_CASE(btree_bulk_load_one_key)
+{
+    bulk_load_into_and_scan_btree(1);
+}
+
+TEST_CASE(btree_bulk_load_10_keys)
+{
+    bulk_load_into_and_scan_btree(10);
+}
+
+TEST_CASE(btree_bulk_load_50_keys)
+{
+    bulk_load_into_and_scan_btree(50);
+}
+
+TEST_CASE(btree_bulk_load_duplicate_key)
+{
+    ScopeGuard guard([]() { unlink("/tmp/test.db"); });
+    auto heap = SQL::Heap::construct("/tmp/test.db");
+    EXPECT(!heap->open().is_error());
+    SQL::Serializer serializer(heap);
+    auto btree = setup_btree(serializer);
+
+    Vector<SQL::Key> btree_keys;
+    for (auto ix = 0; ix < 10; ix++) {
+        SQL::Key k(btree->descriptor());
+        k[0] = keys[ix % 5];
+        k.set_pointer(pointers[ix % 5]);
+        btree_keys.append(move(k));
+    }
+    EXPECT(!btree->bulk_load(move(btree_keys)));
+
+    int count = 0;
+    for (auto iter = btree->begin(); !iter.is_end(); iter++, count++)
+        ;
+    EXPECT_EQ(count, 5);
+}
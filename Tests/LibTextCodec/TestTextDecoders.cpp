@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/StringBuilder.h>
 #include <AK/Vector.h>
 #include <LibTest/TestCase.h>
 #include <LibTextCodec/Decoder.h>
@@ -23,3 +24,16 @@ TEST_CASE(test_utf8_decode)
 
     EXPECT(decoder.to_utf8(test_string) == test_string);
 }
+
+TEST_CASE(test_chunked_to_utf8)
+{
+    auto decoder = TextCodec::Latin1Decoder();
+
+    // Mixes ASCII spans (taken by the bulk-copy fast path) with non-ASCII
+    // bytes, fed in two chunks.
+    StringBuilder builder;
+    decoder.to_utf8(builder, "chunk one has two umlauts: \xe4\xf6"sv);
+    decoder.to_utf8(builder, " and chunk two has none"sv);
+
+    EXPECT_EQ(builder.to_deprecated_string(), "chunk one has two umlauts: \xc3\xa4\xc3\xb6 and chunk two has none"sv);
+}
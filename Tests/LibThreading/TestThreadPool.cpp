@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Atomic.h>
+#include <AK/Vector.h>
+#include <LibTest/TestCase.h>
+#include <LibThreading/ThreadPool.h>
+#include <pthread.h>
+
+TEST_CASE(parallel_for_each_range_visits_every_index_once)
+{
+    constexpr size_t count = 10'000;
+    Vector<u32> visits;
+    visits.resize(count);
+
+    Threading::parallel_for_each_range(count, [&](size_t index) {
+        AK::atomic_fetch_add(&visits[index], 1u, AK::MemoryOrder::memory_order_relaxed);
+    });
+
+    for (size_t i = 0; i < count; ++i)
+        EXPECT_EQ(visits[i], 1u);
+}
+
+TEST_CASE(parallel_for_each_sums_collection)
+{
+    Vector<int> values;
+    for (int i = 1; i <= 1000; ++i)
+        values.append(i);
+
+    Atomic<int> sum { 0 };
+    Threading::parallel_for_each(values, [&](int value) {
+        sum.fetch_add(value);
+    });
+
+    EXPECT_EQ(sum.load(), 500500);
+}
+
+TEST_CASE(parallel_map_preserves_order)
+{
+    Vector<int> values;
+    for (int i = 0; i < 1000; ++i)
+        values.append(i);
+
+    auto squares = MUST(Threading::parallel_map(values, [](int value) {
+        return value * value;
+    }));
+
+    EXPECT_EQ(squares.size(), values.size());
+    for (int i = 0; i < 1000; ++i)
+        EXPECT_EQ(squares[i], i * i);
+}
+
+TEST_CASE(chunk_size_hint_is_honored_for_tiny_workloads)
+{
+    // A chunk size covering the whole range must run everything on the
+    // calling thread without involving the pool.
+    auto const calling_thread = pthread_self();
+    bool all_on_calling_thread = true;
+
+    Threading::parallel_for_each_range(
+        16, [&](size_t) {
+            if (pthread_self() != calling_thread)
+                all_on_calling_thread = false;
+        },
+        16);
+
+    EXPECT(all_on_calling_thread);
+}
+
+TEST_CASE(nested_parallel_loops_complete)
+{
+    Atomic<size_t> total { 0 };
+    Threading::parallel_for_each_range(8, [&](size_t) {
+        Threading::parallel_for_each_range(8, [&](size_t) {
+            total.fetch_add(1);
+        });
+    });
+
+    EXPECT_EQ(total.load(), 64ul);
+}
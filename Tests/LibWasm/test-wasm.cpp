@@ -173,6 +173,10 @@ JS_DEFINE_NATIVE_FUNCTION(WebAssemblyModule::get_export)
             if (auto v = value.get_pointer<Wasm::GlobalAddress>()) {
                 return m_machine.store().get(*v)->value().value().visit(
                     [&](auto const& value) -> JS::Value { return JS::Value(static_cast<double>(value)); },
+                    [&](u128 const& value) -> JS::Value {
+                        auto unsigned_bigint = Crypto::UnsignedBigInteger { value.high() }.shift_left(64).plus(Crypto::UnsignedBigInteger { value.low() });
+                        return JS::BigInt::create(vm, Crypto::SignedBigInteger { move(unsigned_bigint) });
+                    },
                     [&](i32 value) { return JS::Value(static_cast<double>(value)); },
                     [&](i64 value) -> JS::Value { return JS::BigInt::create(vm, Crypto::SignedBigInteger { value }); },
                     [&](Wasm::Reference const& reference) -> JS::Value {
@@ -221,6 +225,9 @@ JS_DEFINE_NATIVE_FUNCTION(WebAssemblyModule::wasm_invoke)
                 arguments.append(Wasm::Value(param, static_cast<i64>(double_value)));
             }
             break;
+        case Wasm::ValueType::Kind::V128:
+            arguments.append(Wasm::Value(param, static_cast<i64>(0)));
+            break;
         case Wasm::ValueType::Kind::F32:
             arguments.append(Wasm::Value(static_cast<float>(double_value)));
             break;
@@ -252,6 +259,10 @@ JS_DEFINE_NATIVE_FUNCTION(WebAssemblyModule::wasm_invoke)
     JS::Value return_value;
     result.values().first().value().visit(
         [&](auto const& value) { return_value = JS::Value(static_cast<double>(value)); },
+        [&](u128 const& value) {
+            auto unsigned_bigint = Crypto::UnsignedBigInteger { value.high() }.shift_left(64).plus(Crypto::UnsignedBigInteger { value.low() });
+            return_value = JS::Value(JS::BigInt::create(vm, Crypto::SignedBigInteger { move(unsigned_bigint) }));
+        },
         [&](i32 value) { return_value = JS::Value(static_cast<double>(value)); },
         [&](i64 value) { return_value = JS::Value(JS::BigInt::create(vm, Crypto::SignedBigInteger { value })); },
         [&](Wasm::Reference const& reference) {
@@ -527,7 +527,10 @@ Optional<URL> Tab::url_from_location_bar(MayAppendTLD may_append_tld)
 void Tab::load(const URL& url, LoadType load_type)
 {
     m_is_history_navigation = (load_type == LoadType::HistoryNavigation);
-    m_web_content_view->load(url);
+    if (m_is_history_navigation)
+        m_web_content_view->load_history_entry(url);
+    else
+        m_web_content_view->load(url);
     m_location_box->set_focus(false);
 }
 
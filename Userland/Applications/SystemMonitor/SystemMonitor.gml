@@ -77,6 +77,18 @@
                 }
             }
 
+            @SystemMonitor::LocksTabWidget {
+                title: "Locks"
+                name: "locks"
+                layout: @GUI::VerticalBoxLayout {
+                    margins: [4]
+                }
+
+                @GUI::TableView {
+                    name: "locks_table"
+                }
+            }
+
             @SystemMonitor::NetworkStatisticsWidget {
                 title: "Network"
                 name: "network"
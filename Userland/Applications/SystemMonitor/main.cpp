@@ -213,7 +213,48 @@ public:
 
 }
 
+class LocksTabWidget final : public GUI::LazyWidget {
+    C_OBJECT(LocksTabWidget)
+public:
+    LocksTabWidget()
+    {
+        this->on_first_show = [](GUI::LazyWidget& self) {
+            auto& locks_table_view = *self.find_child_of_type_named<GUI::TableView>("locks_table");
+
+            auto format_nanoseconds = [](u64 nanoseconds) {
+                return DeprecatedString::formatted("{}.{:03} ms", nanoseconds / 1'000'000, (nanoseconds % 1'000'000) / 1'000);
+            };
+
+            Vector<GUI::JsonArrayModel::FieldSpec> lock_fields;
+            lock_fields.empend("name", "Name", Gfx::TextAlignment::CenterLeft);
+            lock_fields.empend("instance_count", "Instances", Gfx::TextAlignment::CenterRight);
+            lock_fields.empend("times_acquired", "Acquisitions", Gfx::TextAlignment::CenterRight);
+            lock_fields.empend("times_contended", "Contended", Gfx::TextAlignment::CenterRight);
+            lock_fields.empend(
+                "Total wait", Gfx::TextAlignment::CenterRight,
+                [format_nanoseconds](const JsonObject& object) {
+                    return format_nanoseconds(object.get_deprecated("total_wait_ns"sv).to_u64());
+                },
+                [](const JsonObject& object) {
+                    return object.get_deprecated("total_wait_ns"sv).to_u64();
+                });
+            lock_fields.empend(
+                "Longest wait", Gfx::TextAlignment::CenterRight,
+                [format_nanoseconds](const JsonObject& object) {
+                    return format_nanoseconds(object.get_deprecated("max_wait_ns"sv).to_u64());
+                },
+                [](const JsonObject& object) {
+                    return object.get_deprecated("max_wait_ns"sv).to_u64();
+                });
+
+            locks_table_view.set_model(MUST(GUI::SortingProxyModel::create(GUI::JsonArrayModel::create("/sys/kernel/lock_stats", move(lock_fields)))));
+            locks_table_view.model()->invalidate();
+        };
+    }
+};
+
 REGISTER_WIDGET(SystemMonitor, StorageTabWidget)
+REGISTER_WIDGET(SystemMonitor, LocksTabWidget)
 REGISTER_WIDGET(SystemMonitor, UnavailableProcessWidget)
 
 static bool can_access_pid(pid_t pid)
@@ -8,6 +8,7 @@
 
 #include <AK/Array.h>
 #include <LibArchive/TarStream.h>
+#include <LibCore/MemoryStream.h>
 #include <string.h>
 
 namespace Archive {
@@ -60,6 +61,14 @@ ErrorOr<NonnullOwnPtr<TarInputStream>> TarInputStream::construct(NonnullOwnPtr<C
     return tar_stream;
 }
 
+ErrorOr<NonnullOwnPtr<TarInputStream>> TarInputStream::construct(ReadonlyBytes bytes)
+{
+    auto memory_stream = TRY(adopt_nonnull_own_or_enomem(new (nothrow) Core::Stream::FixedMemoryStream(bytes)));
+    auto tar_stream = TRY(construct(NonnullOwnPtr<Core::Stream::Stream>(move(memory_stream))));
+    tar_stream->m_backing_bytes = bytes;
+    return tar_stream;
+}
+
 TarInputStream::TarInputStream(NonnullOwnPtr<Core::Stream::Stream> stream)
     : m_stream(move(stream))
 {
@@ -136,6 +145,25 @@ TarFileStream TarInputStream::file_contents()
     return TarFileStream(*this);
 }
 
+Optional<ReadonlyBytes> TarInputStream::file_contents_view() const
+{
+    if (m_backing_bytes.is_empty())
+        return {};
+    VERIFY(!finished());
+
+    auto header_size_or_error = m_header.size();
+    if (header_size_or_error.is_error())
+        return {};
+    auto header_size = header_size_or_error.release_value();
+
+    // The memory stream's offset sits right past the current entry's header
+    // block, plus however much of the entry was already read the copying way.
+    auto data_offset = static_cast<Core::Stream::FixedMemoryStream const&>(*m_stream).offset() - m_file_offset;
+    if (data_offset + header_size > m_backing_bytes.size())
+        return {};
+    return m_backing_bytes.slice(data_offset, header_size);
+}
+
 TarOutputStream::TarOutputStream(Core::Stream::Handle<Core::Stream::Stream> stream)
     : m_stream(move(stream))
 {
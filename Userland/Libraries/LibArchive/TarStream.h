@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <AK/Optional.h>
 #include <AK/Span.h>
 #include <LibArchive/Tar.h>
 #include <LibCore/Stream.h>
@@ -34,12 +35,20 @@ private:
 class TarInputStream {
 public:
     static ErrorOr<NonnullOwnPtr<TarInputStream>> construct(NonnullOwnPtr<Core::Stream::Stream>);
+    // Zero-copy mode: reads the archive straight out of an in-memory buffer,
+    // typically a memory-mapped file. file_contents_view() then hands out
+    // views into the buffer instead of copying through a stream.
+    static ErrorOr<NonnullOwnPtr<TarInputStream>> construct(ReadonlyBytes);
     ErrorOr<void> advance();
     bool finished() const { return m_found_end_of_archive || m_stream->is_eof(); }
     ErrorOr<bool> valid() const;
     TarFileHeader const& header() const { return m_header; }
     TarFileStream file_contents();
 
+    // The current entry's contents as a view into the archive buffer, or an
+    // empty optional when this stream isn't backed by memory.
+    Optional<ReadonlyBytes> file_contents_view() const;
+
     template<VoidFunction<StringView, StringView> F>
     ErrorOr<void> for_each_extended_header(F func);
 
@@ -49,6 +58,7 @@ private:
 
     TarFileHeader m_header;
     NonnullOwnPtr<Core::Stream::Stream> m_stream;
+    ReadonlyBytes m_backing_bytes;
     unsigned long m_file_offset { 0 };
     int m_generation { 0 };
     bool m_found_end_of_archive { false };
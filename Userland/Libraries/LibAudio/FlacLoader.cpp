@@ -11,6 +11,7 @@
 #include <AK/Format.h>
 #include <AK/IntegralMath.h>
 #include <AK/Math.h>
+#include <AK/SIMD.h>
 #include <AK/ScopeGuard.h>
 #include <AK/StdLibExtras.h>
 #include <AK/Try.h>
@@ -738,17 +739,24 @@ ErrorOr<Vector<i32>, LoaderError> FlacLoaderPlugin::decode_custom_lpc(FlacSubfra
     TRY(decode_residual(decoded, subframe, bit_input));
 
     // approximate the waveform with the predictor
-    for (size_t i = subframe.order; i < m_current_frame->sample_count; ++i) {
-        // (see below)
-        i64 sample = 0;
-        for (size_t t = 0; t < subframe.order; ++t) {
-            // It's really important that we compute in 64-bit land here.
-            // Even though FLAC operates at a maximum bit depth of 32 bits, modern encoders use super-large coefficients for maximum compression.
-            // These will easily overflow 32 bits and cause strange white noise that abruptly stops intermittently (at the end of a frame).
-            // The simple fix of course is to do intermediate computations in 64 bits.
-            // These considerations are not in the original FLAC spec, but have been added to the IETF standard: https://datatracker.ietf.org/doc/html/draft-ietf-cellar-flac-03#appendix-A.3
-            sample += static_cast<i64>(coefficients[t]) * static_cast<i64>(decoded[i - t - 1]);
+    // The filter is recursive, so consecutive samples can't be computed in parallel;
+    // instead, each sample's filter taps are accumulated two at a time.
+    auto const order = static_cast<size_t>(subframe.order);
+    for (size_t i = order; i < m_current_frame->sample_count; ++i) {
+        // It's really important that we compute in 64-bit land here.
+        // Even though FLAC operates at a maximum bit depth of 32 bits, modern encoders use super-large coefficients for maximum compression.
+        // These will easily overflow 32 bits and cause strange white noise that abruptly stops intermittently (at the end of a frame).
+        // The simple fix of course is to do intermediate computations in 64 bits.
+        // These considerations are not in the original FLAC spec, but have been added to the IETF standard: https://datatracker.ietf.org/doc/html/draft-ietf-cellar-flac-03#appendix-A.3
+        AK::SIMD::i64x2 accumulator {};
+        size_t t = 0;
+        for (; t + 1 < order; t += 2) {
+            accumulator += AK::SIMD::i64x2 { coefficients[t], coefficients[t + 1] }
+                * AK::SIMD::i64x2 { decoded[i - t - 1], decoded[i - t - 2] };
         }
+        i64 sample = accumulator[0] + accumulator[1];
+        if (t < order)
+            sample += static_cast<i64>(coefficients[t]) * static_cast<i64>(decoded[i - t - 1]);
         decoded[i] += sample >> lpc_shift;
     }
 
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Format.h>
+#include <aio.h>
+#include <errno.h>
+#include <syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+extern "C" {
+
+static int submit(struct aiocb* cb, int opcode)
+{
+    cb->aio_lio_opcode = opcode;
+    int rc = syscall(SC_aio_submit, cb);
+    __RETURN_WITH_ERRNO(rc, 0, -1);
+}
+
+// https://pubs.opengroup.org/onlinepubs/9699919799/functions/aio_read.html
+int aio_read(struct aiocb* cb)
+{
+    return submit(cb, LIO_READ);
+}
+
+// https://pubs.opengroup.org/onlinepubs/9699919799/functions/aio_write.html
+int aio_write(struct aiocb* cb)
+{
+    return submit(cb, LIO_WRITE);
+}
+
+// https://pubs.opengroup.org/onlinepubs/9699919799/functions/aio_error.html
+int aio_error(const struct aiocb* cb)
+{
+    int rc = syscall(SC_aio_error, cb);
+    if (rc < 0) {
+        errno = -rc;
+        return -1;
+    }
+    // The syscall returns 0, EINPROGRESS, or the errno of the completed operation.
+    return rc;
+}
+
+// https://pubs.opengroup.org/onlinepubs/9699919799/functions/aio_return.html
+ssize_t aio_return(struct aiocb* cb)
+{
+    ssize_t rc = syscall(SC_aio_return, cb);
+    __RETURN_WITH_ERRNO(rc, rc, -1);
+}
+
+// https://pubs.opengroup.org/onlinepubs/9699919799/functions/aio_suspend.html
+int aio_suspend(const struct aiocb* const list[], int nent, const struct timespec* timeout)
+{
+    if (nent < 0) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    struct timespec deadline;
+    if (timeout) {
+        clock_gettime(CLOCK_MONOTONIC, &deadline);
+        deadline.tv_sec += timeout->tv_sec;
+        deadline.tv_nsec += timeout->tv_nsec;
+        if (deadline.tv_nsec >= 1'000'000'000) {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1'000'000'000;
+        }
+    }
+
+    // FIXME: Poll for completion instead of having the kernel wake us up.
+    for (;;) {
+        for (int i = 0; i < nent; ++i) {
+            if (!list[i])
+                continue;
+            if (aio_error(list[i]) != EINPROGRESS)
+                return 0;
+        }
+        if (timeout) {
+            struct timespec now;
+            clock_gettime(CLOCK_MONOTONIC, &now);
+            if (now.tv_sec > deadline.tv_sec || (now.tv_sec == deadline.tv_sec && now.tv_nsec >= deadline.tv_nsec)) {
+                errno = EAGAIN;
+                return -1;
+            }
+        }
+        usleep(1000);
+    }
+}
+
+// https://pubs.opengroup.org/onlinepubs/9699919799/functions/aio_cancel.html
+int aio_cancel([[maybe_unused]] int fd, [[maybe_unused]] struct aiocb* cb)
+{
+    // In-flight requests always run to completion on the IO work queue.
+    return AIO_NOTCANCELED;
+}
+
+// https://pubs.opengroup.org/onlinepubs/9699919799/functions/lio_listio.html
+int lio_listio([[maybe_unused]] int mode, [[maybe_unused]] struct aiocb* const list[], [[maybe_unused]] int nent, [[maybe_unused]] struct sigevent* sev)
+{
+    dbgln("FIXME: Implement lio_listio()");
+    errno = ENOSYS;
+    return -1;
+}
+}
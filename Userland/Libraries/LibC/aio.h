@@ -0,0 +1,25 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <Kernel/API/POSIX/aio.h>
+#include <sys/cdefs.h>
+#include <time.h>
+
+__BEGIN_DECLS
+
+struct sigevent;
+
+int aio_read(struct aiocb*);
+int aio_write(struct aiocb*);
+int aio_error(const struct aiocb*);
+ssize_t aio_return(struct aiocb*);
+int aio_suspend(const struct aiocb* const list[], int nent, const struct timespec* timeout);
+int aio_cancel(int fd, struct aiocb*);
+int lio_listio(int mode, struct aiocb* const list[], int nent, struct sigevent*);
+
+__END_DECLS
@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Atomic.h>
 #include <AK/BuiltinWrappers.h>
 #include <AK/Debug.h>
 #include <AK/ScopedValueRollback.h>
@@ -56,6 +57,27 @@ static bool s_scrub_free = true;
 static bool s_profiling = false;
 static bool s_in_userspace_emulator = false;
 
+// When nonzero, only allocations that cross a multiple of this many
+// allocated bytes emit a PERF_EVENT_MALLOC (with its kernel-captured stack),
+// instead of every single allocation. This keeps profiling overhead low
+// enough for production use; the sampled stream is picked up by the profile
+// utility and Profiler just like the unsampled one.
+static size_t s_profile_sample_interval = 0;
+static Atomic<size_t> s_profile_bytes_until_next_sample = 0;
+
+ALWAYS_INLINE static bool should_emit_profile_event(size_t size)
+{
+    if (s_profile_sample_interval == 0)
+        return true;
+    // Relaxed ordering is fine: a racing thread sampling one allocation too
+    // early or too late doesn't meaningfully distort the profile.
+    auto remaining = s_profile_bytes_until_next_sample.fetch_sub(size, AK::memory_order_relaxed);
+    if (remaining > size)
+        return false;
+    s_profile_bytes_until_next_sample.store(s_profile_sample_interval, AK::memory_order_relaxed);
+    return true;
+}
+
 ALWAYS_INLINE static void ue_notify_malloc(void const* ptr, size_t size)
 {
     if (s_in_userspace_emulator)
@@ -547,7 +569,7 @@ void* malloc(size_t size)
         return nullptr;
     }
 
-    if (s_profiling)
+    if (s_profiling && should_emit_profile_event(size))
         perf_event(PERF_EVENT_MALLOC, size, reinterpret_cast<FlatPtr>(ptr_or_error.value()));
 
     return ptr_or_error.value();
@@ -673,6 +695,13 @@ void __malloc_init()
         s_log_malloc = true;
     if (secure_getenv("LIBC_PROFILE_MALLOC"))
         s_profiling = true;
+    if (char const* sample_interval = secure_getenv("LIBC_PROFILE_MALLOC_SAMPLE_INTERVAL")) {
+        // Free events stay unsampled so that sampled allocations can still be
+        // matched with the free() that releases them.
+        s_profiling = true;
+        s_profile_sample_interval = strtoul(sample_interval, nullptr, 10);
+        s_profile_bytes_until_next_sample.store(s_profile_sample_interval, AK::memory_order_relaxed);
+    }
 
     for (size_t i = 0; i < num_size_classes; ++i) {
         new (&allocators()[i]) Allocator();
@@ -124,6 +124,7 @@ int pthread_mutexattr_destroy(pthread_mutexattr_t*);
 
 int pthread_setname_np(pthread_t, char const*);
 int pthread_getname_np(pthread_t, char*, size_t);
+int pthread_mutex_get_contention_count_np(pthread_mutex_t*, uint32_t*);
 
 int pthread_equal(pthread_t t1, pthread_t t2);
 
@@ -77,6 +77,12 @@ int purge(int mode)
     __RETURN_WITH_ERRNO(rc, rc, -1);
 }
 
+int perf_counters(struct perf_counters_info* info)
+{
+    int rc = syscall(SC_perf_counters, info);
+    __RETURN_WITH_ERRNO(rc, rc, -1);
+}
+
 int perf_event(int type, uintptr_t arg1, FlatPtr arg2)
 {
     int rc = syscall(SC_perf_event, type, arg1, arg2);
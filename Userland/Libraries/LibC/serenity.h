@@ -21,6 +21,10 @@ int profiling_enable(pid_t, uint64_t);
 int profiling_disable(pid_t);
 int profiling_free_buffer(pid_t);
 
+// Reads the calling thread's accumulated hardware performance counters.
+// Fails with ENOTSUP on processors without performance monitoring support.
+int perf_counters(struct perf_counters_info*);
+
 int futex(uint32_t* userspace_address, int futex_op, uint32_t value, const struct timespec* timeout, uint32_t* userspace_address2, uint32_t value3);
 
 #ifndef ALWAYS_INLINE
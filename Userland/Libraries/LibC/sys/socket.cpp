@@ -76,6 +76,14 @@ ssize_t sendmsg(int sockfd, const struct msghdr* msg, int flags)
     __RETURN_WITH_ERRNO(rc, rc, -1);
 }
 
+int sendmmsg(int sockfd, struct mmsghdr* msgvec, unsigned int msgvlen, int flags)
+{
+    __pthread_maybe_cancel();
+
+    int rc = syscall(SC_sendmmsg, sockfd, msgvec, msgvlen, flags);
+    __RETURN_WITH_ERRNO(rc, rc, -1);
+}
+
 // https://pubs.opengroup.org/onlinepubs/9699919799/functions/sendto.html
 ssize_t sendto(int sockfd, void const* data, size_t data_length, int flags, const struct sockaddr* addr, socklen_t addr_length)
 {
@@ -99,6 +107,21 @@ ssize_t recvmsg(int sockfd, struct msghdr* msg, int flags)
     __RETURN_WITH_ERRNO(rc, rc, -1);
 }
 
+int recvmmsg(int sockfd, struct mmsghdr* msgvec, unsigned int msgvlen, int flags, struct timespec* timeout)
+{
+    __pthread_maybe_cancel();
+
+    // FIXME: Support the timeout; only the first message may block anyway,
+    //        so MSG_DONTWAIT covers the common use.
+    if (timeout) {
+        errno = ENOTSUP;
+        return -1;
+    }
+
+    int rc = syscall(SC_recvmmsg, sockfd, msgvec, msgvlen, flags);
+    __RETURN_WITH_ERRNO(rc, rc, -1);
+}
+
 // https://pubs.opengroup.org/onlinepubs/9699919799/functions/recvfrom.html
 ssize_t recvfrom(int sockfd, void* buffer, size_t buffer_length, int flags, struct sockaddr* addr, socklen_t* addr_length)
 {
@@ -219,8 +219,54 @@ DeprecatedString Move::to_algebraic() const
     return builder.build();
 }
 
+// Zobrist keys for the incremental board hash. Every piece-on-square
+// combination, the side to move, and each castling right gets its own random
+// bitstring, and the hash of a position is the XOR of the keys that apply to
+// it. This lets set_piece() and apply_illegal_move() keep the hash current in
+// O(1) instead of rehashing all 64 squares for every move.
+static u64 s_zobrist_piece_keys[2][6][64];
+static u64 s_zobrist_turn_key;
+static u64 s_zobrist_castling_keys[4];
+
+static void ensure_zobrist_keys_initialized()
+{
+    static bool initialized = false;
+    if (initialized)
+        return;
+
+    // Deterministic xorshift, so that position hashes are reproducible.
+    u64 state = 0x9e3779b97f4a7c15ULL;
+    auto next_key = [&state] {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    };
+
+    for (auto& piece_keys : s_zobrist_piece_keys) {
+        for (auto& square_keys : piece_keys) {
+            for (auto& key : square_keys)
+                key = next_key();
+        }
+    }
+    s_zobrist_turn_key = next_key();
+    for (auto& key : s_zobrist_castling_keys)
+        key = next_key();
+
+    initialized = true;
+}
+
+static u64 zobrist_piece_key(Piece const& piece, Square const& square)
+{
+    if (piece.color == Color::None || piece.type == Type::None)
+        return 0;
+    return s_zobrist_piece_keys[to_underlying(piece.color)][to_underlying(piece.type)][square.rank * 8 + square.file];
+}
+
 Board::Board()
 {
+    ensure_zobrist_keys_initialized();
+
     // Fill empty spaces.
     for (int rank = 2; rank < 6; ++rank) {
         for (int file = 0; file < 8; ++file) {
@@ -345,6 +391,8 @@ Piece Board::get_piece(Square const& square) const
 Piece Board::set_piece(Square const& square, Piece const& piece)
 {
     VERIFY(square.in_bounds());
+    m_hash ^= zobrist_piece_key(m_board[square.rank][square.file], square);
+    m_hash ^= zobrist_piece_key(piece, square);
     return m_board[square.rank][square.file] = piece;
 }
 
@@ -590,19 +638,28 @@ bool Board::apply_illegal_move(Move const& move, Color color)
     m_moves.append(move);
 
     m_turn = opposing_color(color);
+    m_hash ^= s_zobrist_turn_key;
 
     m_last_move = move;
     m_moves_since_capture++;
     m_moves_since_pawn_advance++;
 
-    if (move.from == Square("a1") || move.to == Square("a1") || move.from == Square("e1"))
+    if ((move.from == Square("a1") || move.to == Square("a1") || move.from == Square("e1")) && m_white_can_castle_queenside) {
         m_white_can_castle_queenside = false;
-    if (move.from == Square("h1") || move.to == Square("h1") || move.from == Square("e1"))
+        m_hash ^= s_zobrist_castling_keys[0];
+    }
+    if ((move.from == Square("h1") || move.to == Square("h1") || move.from == Square("e1")) && m_white_can_castle_kingside) {
         m_white_can_castle_kingside = false;
-    if (move.from == Square("a8") || move.to == Square("a8") || move.from == Square("e8"))
+        m_hash ^= s_zobrist_castling_keys[1];
+    }
+    if ((move.from == Square("a8") || move.to == Square("a8") || move.from == Square("e8")) && m_black_can_castle_queenside) {
         m_black_can_castle_queenside = false;
-    if (move.from == Square("h8") || move.to == Square("h8") || move.from == Square("e8"))
+        m_hash ^= s_zobrist_castling_keys[2];
+    }
+    if ((move.from == Square("h8") || move.to == Square("h8") || move.from == Square("e8")) && m_black_can_castle_kingside) {
         m_black_can_castle_kingside = false;
+        m_hash ^= s_zobrist_castling_keys[3];
+    }
 
     if (color == Color::White && move.from == Square("e1") && get_piece(Square("e1")) == Piece(Color::White, Type::King)) {
         if (move.to == Square("a1") || move.to == Square("c1")) {
@@ -161,6 +161,10 @@ public:
     Color turn() const { return m_turn; }
     Vector<Move> const& moves() const { return m_moves; }
 
+    // Zobrist hash of the current position, maintained incrementally as moves
+    // are applied. Covers piece placement, the side to move, and castling rights.
+    u64 hash() const { return m_hash; }
+
     bool operator==(Board const& other) const;
 
 private:
@@ -181,6 +185,8 @@ private:
     bool m_black_can_castle_kingside : 1 { true };
     bool m_black_can_castle_queenside : 1 { true };
 
+    u64 m_hash { 0 };
+
     // We trust that hash collisions will not happen to save lots of memory and time.
     HashMap<unsigned, int> m_previous_states;
     Vector<Move> m_moves;
@@ -208,7 +214,7 @@ void Board::generate_moves(Callback callback, Color color) const
 
         bool keep_going = true;
         if (piece.type == Type::Pawn) {
-            for (auto& piece : Vector({ Type::None, Type::Knight, Type::Bishop, Type::Rook, Type::Queen })) {
+            for (auto piece : { Type::None, Type::Knight, Type::Bishop, Type::Rook, Type::Queen }) {
                 keep_going = try_move({ sq, { sq.rank + 1, sq.file }, piece })
                     && try_move({ sq, { sq.rank + 2, sq.file }, piece })
                     && try_move({ sq, { sq.rank - 1, sq.file }, piece })
@@ -296,17 +302,8 @@ template<>
 struct AK::Traits<Chess::Board> : public GenericTraits<Chess::Board> {
     static unsigned hash(Chess::Board const& chess)
     {
-        unsigned hash = 0;
-        hash = pair_int_hash(hash, static_cast<u32>(chess.m_white_can_castle_queenside));
-        hash = pair_int_hash(hash, static_cast<u32>(chess.m_white_can_castle_kingside));
-        hash = pair_int_hash(hash, static_cast<u32>(chess.m_black_can_castle_queenside));
-        hash = pair_int_hash(hash, static_cast<u32>(chess.m_black_can_castle_kingside));
-
-        Chess::Square::for_each([&](Chess::Square sq) {
-            hash = pair_int_hash(hash, Traits<Chess::Piece>::hash(chess.get_piece(sq)));
-            return IterationDecision::Continue;
-        });
-
-        return hash;
+        // The board maintains a Zobrist hash of itself incrementally as moves
+        // are applied, so hashing it is free.
+        return u64_hash(chess.m_hash);
     }
 };
@@ -11,6 +11,7 @@
 #include <AK/ScopeGuard.h>
 #include <LibCore/DirIterator.h>
 #include <LibCore/File.h>
+#include <LibCore/System.h>
 #include <LibCpp/AST.h>
 #include <LibCpp/Lexer.h>
 #include <LibCpp/Parser.h>
@@ -25,6 +26,66 @@ CppComprehensionEngine::CppComprehensionEngine(FileDB const& filedb)
 {
 }
 
+CppComprehensionEngine::~CppComprehensionEngine()
+{
+    // Persist index updates that didn't warrant an immediate save (e.g. ones
+    // that only refreshed timestamps).
+    if (m_symbol_database)
+        (void)m_symbol_database->save();
+}
+
+SymbolDatabase* CppComprehensionEngine::symbol_database()
+{
+    if (m_symbol_database)
+        return m_symbol_database.ptr();
+    auto const& project_root = filedb().project_root();
+    if (project_root.is_empty())
+        return nullptr;
+    m_symbol_database = make<SymbolDatabase>(SymbolDatabase::path_for_project(project_root));
+    // A missing or corrupt database just means we start indexing from scratch.
+    (void)m_symbol_database->load();
+    return m_symbol_database.ptr();
+}
+
+void CppComprehensionEngine::update_symbol_database(DocumentData const& document, Vector<CodeComprehension::Declaration> const& declarations)
+{
+    auto* database = symbol_database();
+    if (!database)
+        return;
+
+    Vector<DeprecatedString> includes;
+    for (auto& header : document.m_available_headers)
+        includes.append(header);
+
+    time_t last_modified = 0;
+    if (auto stat_or_error = Core::System::stat(document.filename()); !stat_or_error.is_error())
+        last_modified = stat_or_error.value().st_mtime;
+
+    if (database->update_file(document.filename(), last_modified, declarations, move(includes)))
+        (void)database->save();
+}
+
+Optional<CodeComprehension::ProjectLocation> CppComprehensionEngine::find_declaration_in_symbol_database(DocumentData const& document, GUI::TextPosition const& identifier_position)
+{
+    auto* database = symbol_database();
+    if (!database)
+        return {};
+
+    auto node = document.parser().node_at(Cpp::Position { identifier_position.line(), identifier_position.column() });
+    if (!node || !node->is_identifier())
+        return {};
+
+    auto name = document.parser().text_of_node(*node);
+    auto scope = SymbolName::create(name.view(), scope_of_reference_to_symbol(*node)).scope_as_string();
+
+    auto candidates = database->find_declarations(name.view(), scope.view());
+    if (candidates.is_empty() && !scope.is_empty())
+        candidates = database->find_declarations(name.view(), {});
+    if (candidates.is_empty())
+        return {};
+    return candidates.first().position;
+}
+
 CppComprehensionEngine::DocumentData const* CppComprehensionEngine::get_or_create_document_data(DeprecatedString const& file)
 {
     auto absolute_path = filedb().to_absolute_path(file);
@@ -413,7 +474,12 @@ Optional<CodeComprehension::ProjectLocation> CppComprehensionEngine::find_declar
         return CodeComprehension::ProjectLocation { decl->filename(), decl->start().line, decl->start().column };
     }
 
-    return find_preprocessor_definition(document, identifier_position);
+    if (auto location = find_preprocessor_definition(document, identifier_position); location.has_value())
+        return location;
+
+    // The persisted index may know about files from previous sessions that we
+    // haven't parsed at all yet.
+    return find_declaration_in_symbol_database(document, identifier_position);
 }
 
 RefPtr<Cpp::Declaration> CppComprehensionEngine::find_declaration_of(DocumentData const& document, const GUI::TextPosition& identifier_position)
@@ -587,6 +653,7 @@ void CppComprehensionEngine::update_declared_symbols(DocumentData& document)
     for (auto& definition : document.preprocessor().definitions()) {
         declarations.append({ definition.key, { document.filename(), definition.value.line, definition.value.column }, CodeComprehension::DeclarationType::PreprocessorDefinition, {} });
     }
+    update_symbol_database(document, declarations);
     set_declarations_of_document(document.filename(), move(declarations));
 }
 
@@ -16,6 +16,7 @@
 #include <LibCpp/Preprocessor.h>
 #include <LibGUI/TextPosition.h>
 #include <Libraries/LibCodeComprehension/CodeComprehensionEngine.h>
+#include <Libraries/LibCodeComprehension/SymbolDatabase.h>
 
 namespace CodeComprehension::Cpp {
 
@@ -24,6 +25,7 @@ using namespace ::Cpp;
 class CppComprehensionEngine : public CodeComprehensionEngine {
 public:
     CppComprehensionEngine(FileDB const& filedb);
+    virtual ~CppComprehensionEngine() override;
 
     virtual Vector<CodeComprehension::AutocompleteResultEntry> get_suggestions(DeprecatedString const& file, GUI::TextPosition const& autocomplete_position) override;
     virtual void on_edit(DeprecatedString const& file) override;
@@ -145,8 +147,16 @@ private:
     CodeComprehension::TokenInfo::SemanticType get_token_semantic_type(DocumentData const&, Token const&);
     CodeComprehension::TokenInfo::SemanticType get_semantic_type_for_identifier(DocumentData const&, Position);
 
+    // Lazily opens the persistent per-project symbol database; null when no
+    // project root is known.
+    SymbolDatabase* symbol_database();
+    void update_symbol_database(DocumentData const&, Vector<CodeComprehension::Declaration> const&);
+    Optional<CodeComprehension::ProjectLocation> find_declaration_in_symbol_database(DocumentData const&, GUI::TextPosition const&);
+
     HashMap<DeprecatedString, OwnPtr<DocumentData>> m_documents;
 
+    OwnPtr<SymbolDatabase> m_symbol_database;
+
     // A document's path will be in this set if we're currently processing it.
     // A document is added to this set when we start processing it (e.g because it was #included) and removed when we're done.
     // We use this to prevent circular #includes from looping indefinitely.
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include "SymbolDatabase.h"
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonParser.h>
+#include <AK/LexicalPath.h>
+#include <LibCore/Stream.h>
+
+namespace CodeComprehension {
+
+static StringView declaration_type_to_string(DeclarationType type)
+{
+    switch (type) {
+    case DeclarationType::Function:
+        return "function"sv;
+    case DeclarationType::Struct:
+        return "struct"sv;
+    case DeclarationType::Class:
+        return "class"sv;
+    case DeclarationType::Variable:
+        return "variable"sv;
+    case DeclarationType::PreprocessorDefinition:
+        return "preprocessor_definition"sv;
+    case DeclarationType::Namespace:
+        return "namespace"sv;
+    case DeclarationType::Member:
+        return "member"sv;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+static Optional<DeclarationType> declaration_type_from_string(StringView string)
+{
+    if (string == "function"sv)
+        return DeclarationType::Function;
+    if (string == "struct"sv)
+        return DeclarationType::Struct;
+    if (string == "class"sv)
+        return DeclarationType::Class;
+    if (string == "variable"sv)
+        return DeclarationType::Variable;
+    if (string == "preprocessor_definition"sv)
+        return DeclarationType::PreprocessorDefinition;
+    if (string == "namespace"sv)
+        return DeclarationType::Namespace;
+    if (string == "member"sv)
+        return DeclarationType::Member;
+    return {};
+}
+
+DeprecatedString SymbolDatabase::path_for_project(DeprecatedString const& project_root)
+{
+    return LexicalPath::join(project_root, ".symbol-database.json"sv).string();
+}
+
+ErrorOr<void> SymbolDatabase::load()
+{
+    auto file = TRY(Core::Stream::File::open(m_path, Core::Stream::OpenMode::Read));
+    auto contents = TRY(file->read_until_eof());
+    auto json = TRY(JsonParser(contents).parse());
+    if (!json.is_object())
+        return Error::from_string_literal("Symbol database is not a JSON object");
+
+    m_files.clear();
+    auto files = json.as_object().get("files"sv).value_or({});
+    if (!files.is_object())
+        return Error::from_string_literal("Symbol database has no file table");
+
+    files.as_object().for_each_member([&](auto& filename, JsonValue const& value) {
+        if (!value.is_object())
+            return;
+        auto& file_object = value.as_object();
+        FileEntry entry;
+        entry.last_modified = file_object.get("last_modified"sv).value_or({}).to_i64();
+
+        auto includes = file_object.get("includes"sv).value_or({});
+        if (includes.is_array()) {
+            includes.as_array().for_each([&](JsonValue const& include) {
+                if (include.is_string())
+                    entry.includes.append(include.as_string());
+            });
+        }
+
+        auto declarations = file_object.get("declarations"sv).value_or({});
+        if (declarations.is_array()) {
+            declarations.as_array().for_each([&](JsonValue const& declaration_value) {
+                if (!declaration_value.is_object())
+                    return;
+                auto& declaration_object = declaration_value.as_object();
+                auto type = declaration_type_from_string(declaration_object.get("type"sv).value_or({}).as_string_or({}));
+                if (!type.has_value())
+                    return;
+                Declaration declaration;
+                declaration.name = declaration_object.get("name"sv).value_or({}).as_string_or({});
+                declaration.position.file = filename;
+                declaration.position.line = declaration_object.get("line"sv).value_or({}).to_u64();
+                declaration.position.column = declaration_object.get("column"sv).value_or({}).to_u64();
+                declaration.type = type.value();
+                declaration.scope = declaration_object.get("scope"sv).value_or({}).as_string_or({});
+                entry.declarations.append(move(declaration));
+            });
+        }
+
+        m_files.set(filename, move(entry));
+    });
+
+    rebuild_name_index();
+    return {};
+}
+
+ErrorOr<void> SymbolDatabase::save()
+{
+    JsonObject files;
+    for (auto& file : m_files) {
+        JsonObject file_object;
+        file_object.set("last_modified"sv, static_cast<i64>(file.value.last_modified));
+
+        JsonArray includes;
+        for (auto& include : file.value.includes)
+            includes.append(include);
+        file_object.set("includes"sv, move(includes));
+
+        JsonArray declarations;
+        for (auto& declaration : file.value.declarations) {
+            JsonObject declaration_object;
+            declaration_object.set("name"sv, declaration.name);
+            declaration_object.set("line"sv, declaration.position.line);
+            declaration_object.set("column"sv, declaration.position.column);
+            declaration_object.set("type"sv, declaration_type_to_string(declaration.type));
+            declaration_object.set("scope"sv, declaration.scope);
+            declarations.append(move(declaration_object));
+        }
+        file_object.set("declarations"sv, move(declarations));
+
+        files.set(file.key, move(file_object));
+    }
+    JsonObject root;
+    root.set("files"sv, move(files));
+
+    auto file = TRY(Core::Stream::File::open(m_path, Core::Stream::OpenMode::Write));
+    TRY(file->write_entire_buffer(root.to_deprecated_string().bytes()));
+    return {};
+}
+
+bool SymbolDatabase::is_up_to_date(DeprecatedString const& filename, time_t last_modified) const
+{
+    auto entry = m_files.find(filename);
+    return entry != m_files.end() && entry->value.last_modified >= last_modified;
+}
+
+bool SymbolDatabase::update_file(DeprecatedString const& filename, time_t last_modified, Vector<Declaration> declarations, Vector<DeprecatedString> includes)
+{
+    auto existing = m_files.find(filename);
+    if (existing != m_files.end() && existing->value.declarations == declarations && existing->value.includes == includes) {
+        existing->value.last_modified = last_modified;
+        return false;
+    }
+    m_files.set(filename, FileEntry { last_modified, move(declarations), move(includes) });
+    rebuild_name_index();
+    return true;
+}
+
+SymbolDatabase::FileEntry const* SymbolDatabase::entry_for(DeprecatedString const& filename) const
+{
+    auto entry = m_files.find(filename);
+    if (entry == m_files.end())
+        return nullptr;
+    return &entry->value;
+}
+
+Vector<Declaration> SymbolDatabase::find_declarations(StringView name, StringView scope) const
+{
+    Vector<Declaration> result;
+    auto references = m_declarations_by_name.find(name);
+    if (references == m_declarations_by_name.end())
+        return result;
+    for (auto& reference : references->value) {
+        auto entry = m_files.find(reference.filename);
+        if (entry == m_files.end())
+            continue;
+        auto& declaration = entry->value.declarations[reference.declaration_index];
+        if (!scope.is_empty() && declaration.scope != scope)
+            continue;
+        result.append(declaration);
+    }
+    return result;
+}
+
+void SymbolDatabase::index_declarations_of(DeprecatedString const& filename, FileEntry const& entry)
+{
+    for (size_t i = 0; i < entry.declarations.size(); ++i)
+        m_declarations_by_name.ensure(entry.declarations[i].name).append({ filename, i });
+}
+
+void SymbolDatabase::rebuild_name_index()
+{
+    m_declarations_by_name.clear();
+    for (auto& file : m_files)
+        index_declarations_of(file.key, file.value);
+}
+
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include "Types.h"
+#include <AK/DeprecatedString.h>
+#include <AK/HashMap.h>
+#include <AK/Vector.h>
+
+namespace CodeComprehension {
+
+// A persistent index of a project's symbols: the declarations, preprocessor
+// definitions and include edges of every file an engine has parsed, keyed by
+// file path. It is saved as JSON in the project root, so a freshly started
+// language server can answer go-to-definition for files from previous
+// sessions without parsing anything, and only files whose contents actually
+// changed need to be re-indexed.
+class SymbolDatabase {
+public:
+    static DeprecatedString path_for_project(DeprecatedString const& project_root);
+
+    explicit SymbolDatabase(DeprecatedString path)
+        : m_path(move(path))
+    {
+    }
+
+    ErrorOr<void> load();
+    ErrorOr<void> save();
+
+    struct FileEntry {
+        time_t last_modified { 0 };
+        Vector<Declaration> declarations;
+        Vector<DeprecatedString> includes;
+    };
+
+    bool is_up_to_date(DeprecatedString const& filename, time_t last_modified) const;
+    // Returns whether the stored entry actually changed.
+    bool update_file(DeprecatedString const& filename, time_t last_modified, Vector<Declaration>, Vector<DeprecatedString> includes);
+    FileEntry const* entry_for(DeprecatedString const& filename) const;
+
+    // All indexed declarations with the given name; an empty scope matches
+    // declarations in any scope.
+    Vector<Declaration> find_declarations(StringView name, StringView scope) const;
+
+private:
+    void index_declarations_of(DeprecatedString const& filename, FileEntry const&);
+    void rebuild_name_index();
+
+    DeprecatedString m_path;
+    HashMap<DeprecatedString, FileEntry> m_files;
+
+    struct DeclarationReference {
+        DeprecatedString filename;
+        size_t declaration_index { 0 };
+    };
+    // Symbol name -> all indexed declarations with that name.
+    HashMap<DeprecatedString, Vector<DeclarationReference>> m_declarations_by_name;
+};
+
+}
@@ -4,30 +4,112 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
-#include <AK/BinarySearch.h>
 #include <AK/QuickSort.h>
 #include <LibCompress/Brotli.h>
 #include <LibCompress/BrotliDictionary.h>
+#include <string.h>
 
 namespace Compress {
 
+void BrotliDecompressionStream::CanonicalCode::populate_decode_state()
+{
+    for (size_t i = 0; i < 16; ++i) {
+        m_first_code_for_length[i] = 0;
+        m_symbol_count_for_length[i] = 0;
+        m_first_symbol_index_for_length[i] = 0;
+    }
+
+    for (size_t i = 0; i < m_symbol_codes.size(); ++i) {
+        // Each entry is (1 << length) | code_value, so the topmost set bit
+        // tells us the code length.
+        size_t value = m_symbol_codes[i];
+        size_t length = 0;
+        while ((value >> (length + 1)) != 0)
+            ++length;
+        size_t code_value = value ^ (1 << length);
+
+        if (m_symbol_count_for_length[length] == 0) {
+            m_first_code_for_length[length] = code_value;
+            m_first_symbol_index_for_length[length] = i;
+            if (i == 0)
+                m_min_code_length = length;
+        }
+        m_symbol_count_for_length[length]++;
+        m_max_code_length = length;
+    }
+
+    m_decode_state_valid = true;
+}
+
 ErrorOr<size_t> BrotliDecompressionStream::CanonicalCode::read_symbol(LittleEndianInputBitStream& input_stream)
 {
-    size_t code_bits = 1;
+    if (!m_decode_state_valid)
+        populate_decode_state();
+
+    if (m_symbol_codes.is_empty())
+        return Error::from_string_literal("no matching code found");
 
-    while (code_bits < (1 << 16)) {
-        // FIXME: This is very inefficient and could greatly be improved by implementing this
-        //        algorithm: https://www.hanshq.net/zip.html#huffdec
-        size_t index;
-        if (binary_search(m_symbol_codes.span(), code_bits, &index))
-            return m_symbol_values[index];
+    // A code containing a single symbol encodes that symbol with zero bits.
+    if (m_min_code_length == 0)
+        return m_symbol_values[0];
 
-        code_bits = (code_bits << 1) | TRY(input_stream.read_bit());
+    // No code is shorter than the minimum length, so all of those bits can be
+    // fetched in one go. They accumulate most-significant-first, while
+    // read_bits() packs them least-significant-first, so reverse them.
+    size_t first_bits = TRY(input_stream.read_bits(m_min_code_length));
+    size_t code_value = 0;
+    for (size_t i = 0; i < m_min_code_length; ++i)
+        code_value = (code_value << 1) | ((first_bits >> i) & 1);
+
+    // Since canonical codes of equal length are consecutive, the accumulated
+    // prefix is a valid code exactly when it falls within the range of codes
+    // of the current length; no searching is required.
+    for (size_t length = m_min_code_length;; ++length) {
+        size_t first_code = m_first_code_for_length[length];
+        if (code_value >= first_code && code_value - first_code < m_symbol_count_for_length[length])
+            return m_symbol_values[m_first_symbol_index_for_length[length] + (code_value - first_code)];
+        if (length == m_max_code_length)
+            break;
+        code_value = (code_value << 1) | TRY(input_stream.read_bit());
     }
 
     return Error::from_string_literal("no matching code found");
 }
 
+void BrotliDecompressionStream::LookbackBuffer::write(ReadonlyBytes values)
+{
+    VERIFY(values.size() < m_buffer.size());
+    size_t offset = 0;
+    while (offset < values.size()) {
+        size_t chunk = min(values.size() - offset, m_buffer.size() - m_offset);
+        memcpy(m_buffer.data() + m_offset, values.data() + offset, chunk);
+        m_offset = (m_offset + chunk) % m_buffer.size();
+        offset += chunk;
+    }
+    m_total_written += values.size();
+}
+
+void BrotliDecompressionStream::LookbackBuffer::copy_from_lookback(size_t distance, Bytes destination)
+{
+    VERIFY(distance <= m_total_written);
+    VERIFY(distance <= m_buffer.size());
+    size_t remaining = destination.size();
+    size_t destination_offset = 0;
+    while (remaining > 0) {
+        size_t source_index = (m_offset + m_buffer.size() - distance) % m_buffer.size();
+        // Overlapping runs (distance shorter than the copy) repeat the last
+        // `distance` bytes, so never copy more than that at once; also keep
+        // each chunk from wrapping around the circular buffer.
+        size_t chunk = min(min(remaining, distance), min(m_buffer.size() - source_index, m_buffer.size() - m_offset));
+        memcpy(destination.data() + destination_offset, m_buffer.data() + source_index, chunk);
+        memcpy(m_buffer.data() + m_offset, destination.data() + destination_offset, chunk);
+        m_offset = (m_offset + chunk) % m_buffer.size();
+        m_total_written += chunk;
+        destination_offset += chunk;
+        remaining -= chunk;
+    }
+}
+
 BrotliDecompressionStream::BrotliDecompressionStream(Stream& stream)
     : m_input_stream(Core::Stream::Handle(stream))
 {
@@ -912,13 +994,14 @@ ErrorOr<Bytes> BrotliDecompressionStream::read(Bytes output_buffer)
                 m_current_state = State::CompressedCopy;
             }
         } else if (m_current_state == State::CompressedCopy) {
-            u8 copy_value = m_lookback_buffer.value().lookback(m_distance);
-
-            output_buffer[bytes_read] = copy_value;
-            m_lookback_buffer.value().write(copy_value);
-            bytes_read++;
-            m_copy_length--;
-            m_bytes_left--;
+            // Copy as much of the run as fits in the output buffer in one go
+            // instead of taking a round trip through the state machine for
+            // every single byte.
+            size_t run_length = min(m_copy_length, min(m_bytes_left, output_buffer.size() - bytes_read));
+            m_lookback_buffer.value().copy_from_lookback(m_distance, output_buffer.slice(bytes_read, run_length));
+            bytes_read += run_length;
+            m_copy_length -= run_length;
+            m_bytes_left -= run_length;
 
             if (m_bytes_left == 0)
                 m_current_state = State::Idle;
@@ -926,13 +1009,14 @@ ErrorOr<Bytes> BrotliDecompressionStream::read(Bytes output_buffer)
                 m_current_state = State::CompressedCommand;
         } else if (m_current_state == State::CompressedDictionary) {
             size_t offset = m_dictionary_data.size() - m_copy_length;
-            u8 dictionary_value = m_dictionary_data[offset];
-
-            output_buffer[bytes_read] = dictionary_value;
-            m_lookback_buffer.value().write(dictionary_value);
-            bytes_read++;
-            m_copy_length--;
-            m_bytes_left--;
+            size_t run_length = min(m_copy_length, min(m_bytes_left, output_buffer.size() - bytes_read));
+            ReadonlyBytes dictionary_bytes = m_dictionary_data.bytes().slice(offset, run_length);
+
+            dictionary_bytes.copy_to(output_buffer.slice(bytes_read, run_length));
+            m_lookback_buffer.value().write(dictionary_bytes);
+            bytes_read += run_length;
+            m_copy_length -= run_length;
+            m_bytes_left -= run_length;
 
             if (m_bytes_left == 0)
                 m_current_state = State::Idle;
@@ -39,11 +39,25 @@ public:
         {
             m_symbol_codes.clear();
             m_symbol_values.clear();
+            m_decode_state_valid = false;
         }
 
     private:
+        void populate_decode_state();
+
         Vector<size_t> m_symbol_codes;
         Vector<size_t> m_symbol_values;
+
+        // Per-length canonical decoding state, built on first use: since the
+        // symbols are sorted by code length and codes of equal length are
+        // consecutive, an accumulated prefix of N bits is a valid code exactly
+        // when it falls within the code range of length N.
+        bool m_decode_state_valid { false };
+        size_t m_min_code_length { 0 };
+        size_t m_max_code_length { 0 };
+        size_t m_first_code_for_length[16] {};
+        size_t m_symbol_count_for_length[16] {};
+        size_t m_first_symbol_index_for_length[16] {};
     };
 
     struct Block {
@@ -96,6 +110,9 @@ public:
             return m_buffer[index];
         }
 
+        void write(ReadonlyBytes values);
+        void copy_from_lookback(size_t distance, Bytes destination);
+
         size_t total_written() { return m_total_written; }
 
     private:
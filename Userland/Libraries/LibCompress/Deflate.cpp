@@ -9,6 +9,8 @@
 #include <AK/Assertions.h>
 #include <AK/BinaryHeap.h>
 #include <AK/BinarySearch.h>
+#include <AK/BuiltinWrappers.h>
+#include <AK/SIMD.h>
 #include <LibCore/MemoryStream.h>
 #include <string.h>
 
@@ -509,23 +511,46 @@ u16 DeflateCompressor::hash_sequence(u8 const* bytes)
     return ((bytes[0] | bytes[1] << 8 | bytes[2] << 16 | bytes[3] << 24) * knuth_constant) >> (32 - hash_bits);
 }
 
+// Returns the length of the common prefix of a and b, looking at no more than max_length
+// bytes of either. The bulk of the comparison is done 16 bytes per step: one whole-vector
+// xor, whose first non-zero byte (found via the trailing zero count of the two u64 halves)
+// is the first mismatch. The loop never reads past max_length, so it cannot overrun the
+// rolling window; any sub-16-byte tail is compared byte-wise.
+ALWAYS_INLINE static size_t common_prefix_length(u8 const* a, u8 const* b, size_t max_length)
+{
+    using AK::SIMD::u8x16;
+    size_t length = 0;
+    while (length + sizeof(u8x16) <= max_length) {
+        u8x16 lhs, rhs;
+        __builtin_memcpy(&lhs, a + length, sizeof(u8x16));
+        __builtin_memcpy(&rhs, b + length, sizeof(u8x16));
+        auto const difference = lhs ^ rhs;
+        u64 halves[2];
+        __builtin_memcpy(halves, &difference, sizeof(halves));
+        if (halves[0] != 0)
+            return length + count_trailing_zeroes(halves[0]) / 8;
+        if (halves[1] != 0)
+            return length + sizeof(u64) + count_trailing_zeroes(halves[1]) / 8;
+        length += sizeof(u8x16);
+    }
+    while (length < max_length && a[length] == b[length])
+        length++;
+    return length;
+}
+
 size_t DeflateCompressor::compare_match_candidate(size_t start, size_t candidate, size_t previous_match_length, size_t maximum_match_length)
 {
     VERIFY(previous_match_length < maximum_match_length);
 
-    // We firstly check that the match is at least (prev_match_length + 1) long, we check backwards as there's a higher chance the end mismatches
-    for (ssize_t i = previous_match_length; i >= 0; i--) {
-        if (m_rolling_window[start + i] != m_rolling_window[candidate + i])
-            return 0;
-    }
+    // A candidate can only improve on the previous match by matching at least one byte
+    // further, so check that byte first to reject most candidates without a full compare.
+    if (m_rolling_window[start + previous_match_length] != m_rolling_window[candidate + previous_match_length])
+        return 0;
 
-    // Find the actual length
-    auto match_length = previous_match_length + 1;
-    while (match_length < maximum_match_length && m_rolling_window[start + match_length] == m_rolling_window[candidate + match_length]) {
-        match_length++;
-    }
+    auto match_length = common_prefix_length(&m_rolling_window[start], &m_rolling_window[candidate], maximum_match_length);
+    if (match_length <= previous_match_length)
+        return 0;
 
-    VERIFY(match_length > previous_match_length);
     VERIFY(match_length <= maximum_match_length);
     return match_length;
 }
@@ -1014,6 +1039,26 @@ ErrorOr<void> DeflateCompressor::final_flush()
     return {};
 }
 
+// Ends the stream on a byte boundary without writing a final block: all pending data is
+// flushed, followed by an empty non-final stored block (zlib's "sync flush"). Another
+// deflate stream may then be concatenated directly after this one, which is what the
+// parallel gzip path relies on.
+ErrorOr<void> DeflateCompressor::final_sync_flush()
+{
+    VERIFY(!m_finished);
+    if (m_pending_block_size > 0)
+        TRY(flush());
+    TRY(m_output_stream->write_bits(0b0u, 1));  // block is not final
+    TRY(m_output_stream->write_bits(0b00u, 2)); // no compression
+    TRY(m_output_stream->align_to_byte_boundary());
+    LittleEndian<u16> len = 0;
+    TRY(m_output_stream->write_entire_buffer(len.bytes()));
+    LittleEndian<u16> nlen = 0xffff;
+    TRY(m_output_stream->write_entire_buffer(nlen.bytes()));
+    m_finished = true;
+    return {};
+}
+
 ErrorOr<ByteBuffer> DeflateCompressor::compress_all(ReadonlyBytes bytes, CompressionLevel compression_level)
 {
     auto output_stream = TRY(try_make<Core::Stream::AllocatingMemoryStream>());
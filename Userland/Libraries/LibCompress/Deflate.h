@@ -148,6 +148,7 @@ public:
     virtual bool is_open() const override;
     virtual void close() override;
     ErrorOr<void> final_flush();
+    ErrorOr<void> final_sync_flush();
 
     static ErrorOr<ByteBuffer> compress_all(ReadonlyBytes bytes, CompressionLevel = CompressionLevel::GOOD);
 
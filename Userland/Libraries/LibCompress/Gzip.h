@@ -89,6 +89,7 @@ public:
     virtual void close() override;
 
     static ErrorOr<ByteBuffer> compress_all(ReadonlyBytes bytes);
+    static ErrorOr<ByteBuffer> compress_all_parallel(ReadonlyBytes bytes);
 
 private:
     Core::Stream::Handle<Core::Stream::Stream> m_output_stream;
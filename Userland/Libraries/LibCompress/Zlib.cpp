@@ -14,59 +14,70 @@
 
 namespace Compress {
 
-constexpr static size_t Adler32Size = sizeof(u32);
-
-Optional<ZlibDecompressor> ZlibDecompressor::try_create(ReadonlyBytes data)
+ErrorOr<NonnullOwnPtr<ZlibDecompressor>> ZlibDecompressor::construct(NonnullOwnPtr<Core::Stream::Stream> stream)
 {
-    if (data.size() < (sizeof(ZlibHeader) + Adler32Size))
-        return {};
-
-    ZlibHeader header { .as_u16 = data.at(0) << 8 | data.at(1) };
+    u8 header_bytes[sizeof(ZlibHeader)];
+    TRY(stream->read_entire_buffer({ header_bytes, sizeof(header_bytes) }));
+    ZlibHeader header { .as_u16 = static_cast<u16>(header_bytes[0] << 8 | header_bytes[1]) };
 
     if (header.compression_method != ZlibCompressionMethod::Deflate || header.compression_info > 7)
-        return {}; // non-deflate compression
+        return Error::from_string_literal("Non-deflate compression inside zlib stream");
 
     if (header.present_dictionary)
-        return {}; // we dont support pre-defined dictionaries
+        return Error::from_string_literal("Zlib preset dictionaries are not supported");
 
     if (header.as_u16 % 31 != 0)
-        return {}; // error correction code doesn't match
+        return Error::from_string_literal("Zlib header check bits do not match");
 
-    ZlibDecompressor zlib { header, data };
-    zlib.m_data_bytes = data.slice(2, data.size() - sizeof(ZlibHeader) - Adler32Size);
-    return zlib;
+    auto deflate_stream = TRY(DeflateDecompressor::construct(Core::Stream::Handle<Core::Stream::Stream>(*stream)));
+    return TRY(adopt_nonnull_own_or_enomem(new (nothrow) ZlibDecompressor(header, move(stream), move(deflate_stream))));
 }
 
-ZlibDecompressor::ZlibDecompressor(ZlibHeader header, ReadonlyBytes data)
+ZlibDecompressor::ZlibDecompressor(ZlibHeader header, NonnullOwnPtr<Core::Stream::Stream> stream, NonnullOwnPtr<DeflateDecompressor> deflate_stream)
     : m_header(header)
-    , m_input_data(data)
+    , m_input_stream(move(stream))
+    , m_stream(move(deflate_stream))
 {
 }
 
-Optional<ByteBuffer> ZlibDecompressor::decompress()
+ErrorOr<Bytes> ZlibDecompressor::read(Bytes bytes)
 {
-    auto buffer_or_error = DeflateDecompressor::decompress_all(m_data_bytes);
-    if (buffer_or_error.is_error())
-        return {};
-    return buffer_or_error.release_value();
+    auto slice = TRY(m_stream->read(bytes));
+    m_checksum.update(slice);
+
+    if (m_stream->is_eof() && !m_checksum_verified) {
+        m_checksum_verified = true;
+        NetworkOrdered<u32> stored_checksum;
+        TRY(m_input_stream->read_entire_buffer(stored_checksum.bytes()));
+        if (stored_checksum != m_checksum.digest())
+            return Error::from_string_literal("Stored Adler-32 does not match the calculated Adler-32 of the decompressed data");
+    }
+
+    return slice;
 }
 
-Optional<ByteBuffer> ZlibDecompressor::decompress_all(ReadonlyBytes bytes)
+ErrorOr<size_t> ZlibDecompressor::write(ReadonlyBytes)
 {
-    auto zlib = try_create(bytes);
-    if (!zlib.has_value())
-        return {};
-    return zlib->decompress();
+    return Error::from_errno(EBADF);
 }
 
-u32 ZlibDecompressor::checksum()
+bool ZlibDecompressor::is_eof() const
 {
-    if (!m_checksum) {
-        auto bytes = m_input_data.slice_from_end(Adler32Size);
-        m_checksum = bytes.at(0) << 24 | bytes.at(1) << 16 | bytes.at(2) << 8 || bytes.at(3);
-    }
+    return m_stream->is_eof();
+}
 
-    return m_checksum;
+Optional<ByteBuffer> ZlibDecompressor::decompress_all(ReadonlyBytes bytes)
+{
+    auto memory_stream_or_error = Core::Stream::FixedMemoryStream::construct(bytes);
+    if (memory_stream_or_error.is_error())
+        return {};
+    auto zlib_stream_or_error = ZlibDecompressor::construct(memory_stream_or_error.release_value());
+    if (zlib_stream_or_error.is_error())
+        return {};
+    auto buffer_or_error = zlib_stream_or_error.value()->read_until_eof();
+    if (buffer_or_error.is_error())
+        return {};
+    return buffer_or_error.release_value();
 }
 
 ErrorOr<NonnullOwnPtr<ZlibCompressor>> ZlibCompressor::construct(Core::Stream::Handle<Core::Stream::Stream> stream, ZlibCompressionLevel compression_level)
@@ -11,6 +11,7 @@
 #include <AK/OwnPtr.h>
 #include <AK/Span.h>
 #include <AK/Types.h>
+#include <LibCompress/Deflate.h>
 #include <LibCore/Stream.h>
 #include <LibCrypto/Checksum/Adler32.h>
 
@@ -42,22 +43,30 @@ struct ZlibHeader {
 };
 static_assert(sizeof(ZlibHeader) == sizeof(u16));
 
-class ZlibDecompressor {
+// Pull-based zlib decompression: reads compressed data from the inner stream on demand
+// and fills the caller's span, so only DeflateDecompressor's fixed 32 KiB window is kept
+// in memory regardless of how large the payload is. The Adler-32 checksum is updated as
+// output is produced and verified against the trailer once the deflate stream ends.
+class ZlibDecompressor final : public Core::Stream::Stream {
 public:
-    Optional<ByteBuffer> decompress();
-    u32 checksum();
+    static ErrorOr<NonnullOwnPtr<ZlibDecompressor>> construct(NonnullOwnPtr<Core::Stream::Stream>);
+
+    virtual ErrorOr<Bytes> read(Bytes) override;
+    virtual ErrorOr<size_t> write(ReadonlyBytes) override;
+    virtual bool is_eof() const override;
+    virtual bool is_open() const override { return true; }
+    virtual void close() override {}
 
-    static Optional<ZlibDecompressor> try_create(ReadonlyBytes data);
     static Optional<ByteBuffer> decompress_all(ReadonlyBytes);
 
 private:
-    ZlibDecompressor(ZlibHeader, ReadonlyBytes data);
+    ZlibDecompressor(ZlibHeader, NonnullOwnPtr<Core::Stream::Stream>, NonnullOwnPtr<DeflateDecompressor>);
 
     ZlibHeader m_header;
-
-    u32 m_checksum { 0 };
-    ReadonlyBytes m_input_data;
-    ReadonlyBytes m_data_bytes;
+    NonnullOwnPtr<Core::Stream::Stream> m_input_stream;
+    NonnullOwnPtr<DeflateDecompressor> m_stream;
+    Crypto::Checksum::Adler32 m_checksum;
+    bool m_checksum_verified { false };
 };
 
 class ZlibCompressor : public Core::Stream::Stream {
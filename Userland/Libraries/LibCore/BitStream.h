@@ -96,9 +96,11 @@ public:
                         m_current_byte.clear();
                 }
             } else {
-                auto temp_buffer = TRY(ByteBuffer::create_uninitialized(1));
-                TRY(m_stream->read(temp_buffer.bytes()));
-                m_current_byte = temp_buffer[0];
+                // Read the next byte into a stack buffer; a heap-allocated buffer
+                // would make every bit-level read pay for an allocation.
+                u8 byte;
+                TRY(m_stream->read({ &byte, sizeof(byte) }));
+                m_current_byte = byte;
                 m_bit_offset = 0;
             }
         }
@@ -206,11 +208,13 @@ public:
                         m_current_byte.clear();
                 }
             } else {
-                auto temp_buffer = TRY(ByteBuffer::create_uninitialized(1));
-                auto read_bytes = TRY(m_stream->read(temp_buffer.bytes()));
+                // Read the next byte into a stack buffer; a heap-allocated buffer
+                // would make every bit-level read pay for an allocation.
+                u8 byte;
+                auto read_bytes = TRY(m_stream->read({ &byte, sizeof(byte) }));
                 if (read_bytes.is_empty())
                     return Error::from_string_literal("eof");
-                m_current_byte = temp_buffer[0];
+                m_current_byte = byte;
                 m_bit_offset = 0;
             }
         }
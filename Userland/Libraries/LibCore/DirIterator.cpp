@@ -33,6 +33,7 @@ DirIterator::DirIterator(DirIterator&& other)
     : m_dir(other.m_dir)
     , m_error(other.m_error)
     , m_next(move(other.m_next))
+    , m_next_type(other.m_next_type)
     , m_path(move(other.m_path))
     , m_flags(other.m_flags)
 {
@@ -54,6 +55,7 @@ bool DirIterator::advance_next()
         }
 
         m_next = de->d_name;
+        m_next_type = de->d_type;
         if (m_next.is_null())
             return false;
 
@@ -85,6 +87,14 @@ DeprecatedString DirIterator::next_path()
     return tmp;
 }
 
+unsigned char DirIterator::next_entry_type()
+{
+    if (m_next.is_null())
+        advance_next();
+
+    return m_next_type;
+}
+
 DeprecatedString DirIterator::next_full_path()
 {
     StringBuilder builder;
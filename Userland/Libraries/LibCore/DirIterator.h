@@ -32,12 +32,16 @@ public:
     bool has_next();
     DeprecatedString next_path();
     DeprecatedString next_full_path();
+    // The dirent type (DT_*) of the entry the next call to next_path() will return,
+    // or DT_UNKNOWN if the underlying filesystem didn't provide one.
+    unsigned char next_entry_type();
     int fd() const;
 
 private:
     DIR* m_dir = nullptr;
     int m_error = 0;
     DeprecatedString m_next;
+    unsigned char m_next_type { DT_UNKNOWN };
     DeprecatedString m_path;
     int m_flags;
 
@@ -6,11 +6,13 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
 #include <AK/Assertions.h>
 #include <AK/Badge.h>
 #include <AK/Debug.h>
 #include <AK/Format.h>
 #include <AK/IDAllocator.h>
+#include <AK/IntrusiveList.h>
 #include <AK/JsonObject.h>
 #include <AK/JsonValue.h>
 #include <AK/NeverDestroyed.h>
@@ -27,10 +29,10 @@
 #include <LibThreading/MutexProtected.h>
 #include <errno.h>
 #include <fcntl.h>
+#include <poll.h>
 #include <signal.h>
 #include <stdio.h>
 #include <string.h>
-#include <sys/select.h>
 #include <sys/socket.h>
 #include <sys/time.h>
 #include <time.h>
@@ -55,9 +57,140 @@ struct EventLoopTimer {
     bool should_reload { false };
     TimerShouldFireWhenNotVisible fire_when_not_visible { TimerShouldFireWhenNotVisible::No };
     WeakPtr<Object> owner;
+    IntrusiveListNode<EventLoopTimer> wheel_node;
 
     void reload(Time const& now);
-    bool has_expired(Time const& now) const;
+};
+
+// A hierarchical timer wheel with millisecond ticks. Level L slots each span
+// 64^L ticks, so four levels cover about 4.6 hours; timers due further out
+// park in the top level and simply cascade again once the cursor reaches
+// them. Insertion and cancellation are O(1), and finding the next deadline
+// only looks at slots instead of every registered timer.
+class TimerWheel {
+    AK_MAKE_NONCOPYABLE(TimerWheel);
+    AK_MAKE_NONMOVABLE(TimerWheel);
+
+public:
+    static constexpr size_t level_count = 4;
+    static constexpr size_t slot_bits = 6;
+    static constexpr size_t slots_per_level = 1 << slot_bits;
+    static constexpr u64 slot_mask = slots_per_level - 1;
+
+    TimerWheel()
+        : m_current_tick(tick_for(Time::now_monotonic_coarse()))
+    {
+    }
+
+    ~TimerWheel()
+    {
+        clear();
+    }
+
+    static u64 tick_for(Time time)
+    {
+        return static_cast<u64>(time.to_milliseconds());
+    }
+
+    void schedule(EventLoopTimer& timer)
+    {
+        VERIFY(!timer.wheel_node.is_in_list());
+        u64 due_tick = max(tick_for(timer.fire_time), m_current_tick + 1);
+        u64 delta = due_tick - m_current_tick;
+        size_t level = 0;
+        while (level < level_count - 1 && delta >= (1ull << (slot_bits * (level + 1))))
+            ++level;
+        u64 max_delta = (1ull << (slot_bits * level_count)) - 1;
+        u64 target_tick = m_current_tick + min(delta, max_delta);
+        m_slots[level][(target_tick >> (slot_bits * level)) & slot_mask].append(timer);
+    }
+
+    static void remove(EventLoopTimer& timer)
+    {
+        if (timer.wheel_node.is_in_list())
+            timer.wheel_node.remove();
+    }
+
+    // Parks an expired timer whose owner is currently not visible; it stays
+    // out of deadline computation and is retried on every advance().
+    void suspend(EventLoopTimer& timer)
+    {
+        m_suspended.append(timer);
+    }
+
+    size_t suspended_count_slow() const
+    {
+        return m_suspended.size_slow();
+    }
+
+    // Collects every timer that is due at now_tick (batched per slot, not per
+    // tick) and invokes the callback on it. Timers swept out of a coarse slot
+    // before their deadline are cascaded back in at a finer level.
+    template<typename Callback>
+    void advance(u64 now_tick, Callback&& fire)
+    {
+        IntrusiveList<&EventLoopTimer::wheel_node> due;
+        while (auto* timer = m_suspended.take_first())
+            due.append(*timer);
+
+        if (now_tick > m_current_tick) {
+            for (size_t level = 0; level < level_count; ++level) {
+                u64 old_index = m_current_tick >> (slot_bits * level);
+                u64 new_index = now_tick >> (slot_bits * level);
+                u64 steps = min(new_index - old_index, static_cast<u64>(slots_per_level));
+                for (u64 i = 1; i <= steps; ++i) {
+                    auto& slot = m_slots[level][(old_index + i) & slot_mask];
+                    while (auto* timer = slot.take_first())
+                        due.append(*timer);
+                }
+            }
+            m_current_tick = now_tick;
+        }
+
+        while (auto* timer = due.take_first()) {
+            if (tick_for(timer->fire_time) <= m_current_tick)
+                fire(*timer);
+            else
+                schedule(*timer);
+        }
+    }
+
+    Optional<Time> next_expiration() const
+    {
+        Optional<u64> soonest_tick;
+        for (size_t level = 0; level < level_count; ++level) {
+            u64 cursor_index = m_current_tick >> (slot_bits * level);
+            for (u64 i = 1; i <= slots_per_level; ++i) {
+                if (m_slots[level][(cursor_index + i) & slot_mask].is_empty())
+                    continue;
+                // The slot's start tick is a safe lower bound for everything
+                // in it; waking early merely cascades the slot's timers down
+                // to a finer level.
+                u64 bound = max((cursor_index + i) << (slot_bits * level), m_current_tick + 1);
+                if (!soonest_tick.has_value() || bound < *soonest_tick)
+                    soonest_tick = bound;
+                break;
+            }
+        }
+        if (!soonest_tick.has_value())
+            return {};
+        return Time::from_milliseconds(static_cast<i64>(*soonest_tick));
+    }
+
+    void clear()
+    {
+        for (auto& level : m_slots) {
+            for (auto& slot : level)
+                slot.clear();
+        }
+        m_suspended.clear();
+        m_current_tick = tick_for(Time::now_monotonic_coarse());
+    }
+
+private:
+    u64 m_current_tick { 0 };
+    Array<Array<IntrusiveList<&EventLoopTimer::wheel_node>, slots_per_level>, level_count> m_slots;
+    IntrusiveList<&EventLoopTimer::wheel_node> m_suspended;
 };
 
 struct EventLoop::Private {
@@ -70,7 +203,18 @@ static Threading::MutexProtected<RefPtr<InspectorServerConnection>> s_inspector_
 // Each thread has its own event loop stack, its own timers, notifiers and a wake pipe.
 static thread_local Vector<EventLoop&>* s_event_loop_stack;
 static thread_local HashMap<int, NonnullOwnPtr<EventLoopTimer>>* s_timers;
+// The wheel indexes the timers in s_timers by deadline; s_timers owns them.
+static thread_local TimerWheel* s_timer_wheel;
+static thread_local u64 s_timers_scheduled_count { 0 };
+static thread_local u64 s_timers_fired_count { 0 };
 static thread_local HashTable<Notifier*>* s_notifiers;
+// The pollfd interest list persists between wait_for_event() iterations and
+// is only rebuilt when a notifier is registered, unregistered or changes its
+// event mask. s_poll_notifiers runs parallel to s_poll_fds; entry 0 is the
+// wake pipe and has no notifier.
+static thread_local Vector<struct pollfd>* s_poll_fds;
+static thread_local Vector<Notifier*>* s_poll_notifiers;
+static thread_local bool s_poll_fds_need_rebuild { true };
 // The wake pipe is both responsible for notifying us when someone calls wake(), as well as POSIX signals.
 // While wake() pushes zero into the pipe, signal numbers (by defintion nonzero, see signal_numbers.h) are pushed into the pipe verbatim.
 thread_local int EventLoop::s_wake_pipe_fds[2];
@@ -329,7 +473,10 @@ EventLoop::EventLoop([[maybe_unused]] MakeInspectable make_inspectable)
     if (!s_event_loop_stack) {
         s_event_loop_stack = new Vector<EventLoop&>;
         s_timers = new HashMap<int, NonnullOwnPtr<EventLoopTimer>>;
+        s_timer_wheel = new TimerWheel;
         s_notifiers = new HashTable<Notifier*>;
+        s_poll_fds = new Vector<struct pollfd>;
+        s_poll_notifiers = new Vector<Notifier*>;
     }
 
     if (s_event_loop_stack->is_empty()) {
@@ -663,8 +810,15 @@ void EventLoop::notify_forked(ForkEvent event)
     switch (event) {
     case ForkEvent::Child:
         s_event_loop_stack->clear();
+        if (s_timer_wheel)
+            s_timer_wheel->clear();
         s_timers->clear();
         s_notifiers->clear();
+        if (s_poll_fds)
+            s_poll_fds->clear();
+        if (s_poll_notifiers)
+            s_poll_notifiers->clear();
+        s_poll_fds_need_rebuild = true;
         s_wake_pipe_initialized = false;
         initialize_wake_pipes();
         if (auto* info = signals_info<false>()) {
@@ -680,34 +834,35 @@ void EventLoop::notify_forked(ForkEvent event)
 
 void EventLoop::wait_for_event(WaitMode mode)
 {
-    fd_set rfds;
-    fd_set wfds;
 retry:
 
-    // Set up the file descriptors for select().
-    // Basically, we translate high-level event information into low-level selectable file descriptors.
-    FD_ZERO(&rfds);
-    FD_ZERO(&wfds);
-
-    int max_fd = 0;
-    auto add_fd_to_set = [&max_fd](int fd, fd_set& set) {
-        FD_SET(fd, &set);
-        if (fd > max_fd)
-            max_fd = fd;
-    };
-
-    int max_fd_added = -1;
-    // The wake pipe informs us of POSIX signals as well as manual calls to wake()
-    add_fd_to_set(s_wake_pipe_fds[0], rfds);
-    max_fd = max(max_fd, max_fd_added);
-
-    for (auto& notifier : *s_notifiers) {
-        if (notifier->event_mask() & Notifier::Read)
-            add_fd_to_set(notifier->fd(), rfds);
-        if (notifier->event_mask() & Notifier::Write)
-            add_fd_to_set(notifier->fd(), wfds);
-        if (notifier->event_mask() & Notifier::Exceptional)
-            VERIFY_NOT_REACHED();
+    // Rebuild the pollfd interest list if the notifier set changed; otherwise
+    // just reset the result fields. This translates high-level event
+    // information into low-level pollable file descriptors once, instead of
+    // re-registering every single tick.
+    if (s_poll_fds_need_rebuild) {
+        s_poll_fds->clear_with_capacity();
+        s_poll_notifiers->clear_with_capacity();
+
+        // The wake pipe informs us of POSIX signals as well as manual calls to wake()
+        s_poll_fds->append({ s_wake_pipe_fds[0], POLLIN, 0 });
+        s_poll_notifiers->append(nullptr);
+
+        for (auto& notifier : *s_notifiers) {
+            short events = 0;
+            if (notifier->event_mask() & Notifier::Read)
+                events |= POLLIN;
+            if (notifier->event_mask() & Notifier::Write)
+                events |= POLLOUT;
+            if (notifier->event_mask() & Notifier::Exceptional)
+                VERIFY_NOT_REACHED();
+            s_poll_fds->append({ notifier->fd(), events, 0 });
+            s_poll_notifiers->append(notifier);
+        }
+        s_poll_fds_need_rebuild = false;
+    } else {
+        for (auto& poll_fd : *s_poll_fds)
+            poll_fd.revents = 0;
     }
 
     bool queued_events_is_empty;
@@ -719,7 +874,7 @@ retry:
     // Figure out how long to wait at maximum.
     // This mainly depends on the WaitMode and whether we have pending events, but also the next expiring timer.
     Time now;
-    struct timeval timeout = { 0, 0 };
+    int timeout_in_milliseconds = 0;
     bool should_wait_forever = false;
     if (mode == WaitMode::WaitForEvents && queued_events_is_empty) {
         auto next_timer_expiration = get_next_timer_expiration();
@@ -728,22 +883,26 @@ retry:
             auto computed_timeout = next_timer_expiration.value() - now;
             if (computed_timeout.is_negative())
                 computed_timeout = Time::zero();
-            timeout = computed_timeout.to_timeval();
+            // Round sub-millisecond remainders up so we don't spin on a
+            // timer that expires between poll() granules.
+            timeout_in_milliseconds = static_cast<int>(computed_timeout.to_milliseconds());
+            if (Time::from_milliseconds(timeout_in_milliseconds) < computed_timeout)
+                ++timeout_in_milliseconds;
         } else {
             should_wait_forever = true;
         }
     }
 
-try_select_again:
-    // select() and wait for file system events, calls to wake(), POSIX signals, or timer expirations.
-    int marked_fd_count = select(max_fd + 1, &rfds, &wfds, nullptr, should_wait_forever ? nullptr : &timeout);
-    // Because POSIX, we might spuriously return from select() with EINTR; just select again.
+try_poll_again:
+    // poll() and wait for file system events, calls to wake(), POSIX signals, or timer expirations.
+    int marked_fd_count = poll(s_poll_fds->data(), s_poll_fds->size(), should_wait_forever ? -1 : timeout_in_milliseconds);
+    // Because POSIX, we might spuriously return from poll() with EINTR; just poll again.
     if (marked_fd_count < 0) {
         int saved_errno = errno;
         if (saved_errno == EINTR) {
             if (m_exit_requested)
                 return;
-            goto try_select_again;
+            goto try_poll_again;
         }
         dbgln("Core::EventLoop::wait_for_event: {} ({}: {})", marked_fd_count, saved_errno, strerror(saved_errno));
         VERIFY_NOT_REACHED();
@@ -751,7 +910,7 @@ try_select_again:
 
     // We woke up due to a call to wake() or a POSIX signal.
     // Handle signals and see whether we need to handle events as well.
-    if (FD_ISSET(s_wake_pipe_fds[0], &rfds)) {
+    if ((*s_poll_fds)[0].revents & POLLIN) {
         int wake_events[8];
         ssize_t nread;
         // We might receive another signal while read()ing here. The signal will go to the handle_signal properly,
@@ -782,52 +941,61 @@ try_select_again:
 
     if (!s_timers->is_empty()) {
         now = Time::now_monotonic_coarse();
-    }
 
-    // Handle expired timers.
-    for (auto& it : *s_timers) {
-        auto& timer = *it.value;
-        if (!timer.has_expired(now))
-            continue;
-        auto owner = timer.owner.strong_ref();
-        if (timer.fire_when_not_visible == TimerShouldFireWhenNotVisible::No
-            && owner && !owner->is_visible_for_timer_purposes()) {
-            continue;
-        }
+        // Handle expired timers, batched per wheel slot instead of scanning
+        // every registered timer.
+        s_timer_wheel->advance(TimerWheel::tick_for(now), [&](EventLoopTimer& timer) {
+            auto owner = timer.owner.strong_ref();
+            if (timer.fire_when_not_visible == TimerShouldFireWhenNotVisible::No
+                && owner && !owner->is_visible_for_timer_purposes()) {
+                s_timer_wheel->suspend(timer);
+                return;
+            }
 
-        dbgln_if(EVENTLOOP_DEBUG, "Core::EventLoop: Timer {} has expired, sending Core::TimerEvent to {}", timer.timer_id, *owner);
+            dbgln_if(EVENTLOOP_DEBUG, "Core::EventLoop: Timer {} has expired, sending Core::TimerEvent to {}", timer.timer_id, *owner);
 
-        if (owner)
-            post_event(*owner, make<TimerEvent>(timer.timer_id));
-        if (timer.should_reload) {
-            timer.reload(now);
-        } else {
-            // FIXME: Support removing expired timers that don't want to reload.
-            VERIFY_NOT_REACHED();
-        }
+            if (owner)
+                post_event(*owner, make<TimerEvent>(timer.timer_id));
+            ++s_timers_fired_count;
+            if (timer.should_reload) {
+                timer.reload(now);
+                s_timer_wheel->schedule(timer);
+            } else {
+                // FIXME: Support removing expired timers that don't want to reload.
+                VERIFY_NOT_REACHED();
+            }
+        });
     }
 
     if (!marked_fd_count)
         return;
 
     // Handle file system notifiers by making them normal events.
-    for (auto& notifier : *s_notifiers) {
-        if (FD_ISSET(notifier->fd(), &rfds)) {
+    for (size_t i = 1; i < s_poll_fds->size(); ++i) {
+        auto& poll_fd = (*s_poll_fds)[i];
+        if (!poll_fd.revents)
+            continue;
+        // A notifier for a closed fd is a bug in the caller; fail loudly
+        // like the old select()-based implementation did with EBADF.
+        VERIFY(!(poll_fd.revents & POLLNVAL));
+        auto* notifier = (*s_poll_notifiers)[i];
+        // A signal handler dispatched above may have unregistered this
+        // notifier (or destroyed it); skip anything no longer registered.
+        if (!s_notifiers->contains(notifier))
+            continue;
+        // Like select(), report hangups and errors to whoever is interested
+        // in reading; the handler will observe them on the actual I/O call.
+        if (poll_fd.revents & (POLLIN | POLLHUP | POLLERR)) {
             if (notifier->event_mask() & Notifier::Event::Read)
                 post_event(*notifier, make<NotifierReadEvent>(notifier->fd()));
         }
-        if (FD_ISSET(notifier->fd(), &wfds)) {
+        if (poll_fd.revents & (POLLOUT | POLLERR)) {
             if (notifier->event_mask() & Notifier::Event::Write)
                 post_event(*notifier, make<NotifierWriteEvent>(notifier->fd()));
         }
     }
 }
 
-bool EventLoopTimer::has_expired(Time const& now) const
-{
-    return now > fire_time;
-}
-
 void EventLoopTimer::reload(Time const& now)
 {
     fire_time = now + interval;
@@ -835,23 +1003,9 @@ void EventLoopTimer::reload(Time const& now)
 
 Optional<Time> EventLoop::get_next_timer_expiration()
 {
-    auto now = Time::now_monotonic_coarse();
-    Optional<Time> soonest {};
-    for (auto& it : *s_timers) {
-        auto& fire_time = it.value->fire_time;
-        auto owner = it.value->owner.strong_ref();
-        if (it.value->fire_when_not_visible == TimerShouldFireWhenNotVisible::No
-            && owner && !owner->is_visible_for_timer_purposes()) {
-            continue;
-        }
-        // OPTIMIZATION: If we have a timer that needs to fire right away, we can stop looking here.
-        // FIXME: This whole operation could be O(1) with a better data structure.
-        if (fire_time < now)
-            return now;
-        if (!soonest.has_value() || fire_time < soonest.value())
-            soonest = fire_time;
-    }
-    return soonest;
+    // Suspended (expired-but-invisible) timers are deliberately excluded;
+    // they are retried whenever the wheel advances for another reason.
+    return s_timer_wheel->next_expiration();
 }
 
 int EventLoop::register_timer(Object& object, int milliseconds, bool should_reload, TimerShouldFireWhenNotVisible fire_when_not_visible)
@@ -866,6 +1020,8 @@ int EventLoop::register_timer(Object& object, int milliseconds, bool should_relo
     timer->fire_when_not_visible = fire_when_not_visible;
     int timer_id = s_id_allocator.with_locked([](auto& allocator) { return allocator->allocate(); });
     timer->timer_id = timer_id;
+    s_timer_wheel->schedule(*timer);
+    ++s_timers_scheduled_count;
     s_timers->set(timer_id, move(timer));
     return timer_id;
 }
@@ -877,20 +1033,40 @@ bool EventLoop::unregister_timer(int timer_id)
     auto it = s_timers->find(timer_id);
     if (it == s_timers->end())
         return false;
+    TimerWheel::remove(*it->value);
     s_timers->remove(it);
     return true;
 }
 
+EventLoop::TimerStatistics EventLoop::timer_statistics()
+{
+    VERIFY_EVENT_LOOP_INITIALIZED();
+    return {
+        .active_count = s_timers->size(),
+        .suspended_count = s_timer_wheel->suspended_count_slow(),
+        .total_scheduled = s_timers_scheduled_count,
+        .total_fired = s_timers_fired_count,
+    };
+}
+
 void EventLoop::register_notifier(Badge<Notifier>, Notifier& notifier)
 {
     VERIFY_EVENT_LOOP_INITIALIZED();
     s_notifiers->set(&notifier);
+    s_poll_fds_need_rebuild = true;
 }
 
 void EventLoop::unregister_notifier(Badge<Notifier>, Notifier& notifier)
 {
     VERIFY_EVENT_LOOP_INITIALIZED();
     s_notifiers->remove(&notifier);
+    s_poll_fds_need_rebuild = true;
+}
+
+void EventLoop::notifier_event_mask_was_changed(Badge<Notifier>)
+{
+    VERIFY_EVENT_LOOP_INITIALIZED();
+    s_poll_fds_need_rebuild = true;
 }
 
 void EventLoop::wake_current()
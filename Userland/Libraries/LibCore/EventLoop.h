@@ -100,8 +100,19 @@ public:
     static int register_timer(Object&, int milliseconds, bool should_reload, TimerShouldFireWhenNotVisible);
     static bool unregister_timer(int timer_id);
 
+    // Diagnostic counters for this thread's timers; applications that create
+    // very large numbers of timers can use these to account for them.
+    struct TimerStatistics {
+        size_t active_count { 0 };
+        size_t suspended_count { 0 };
+        u64 total_scheduled { 0 };
+        u64 total_fired { 0 };
+    };
+    static TimerStatistics timer_statistics();
+
     static void register_notifier(Badge<Notifier>, Notifier&);
     static void unregister_notifier(Badge<Notifier>, Notifier&);
+    static void notifier_event_mask_was_changed(Badge<Notifier>);
 
     static int register_signal(int signo, Function<void(int)> handler);
     static void unregister_signal(int handler_id);
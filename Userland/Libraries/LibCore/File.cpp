@@ -559,7 +559,15 @@ ErrorOr<void> File::remove(StringView path, RecursionMode mode)
             return Error::from_errno(di.error());
 
         while (di.has_next()) {
-            TRY(remove(di.next_full_path(), RecursionMode::Allowed));
+            // The directory entry already carries the child's type, so anything
+            // that is known not to be a directory can be unlinked without
+            // spending an lstat() on it first.
+            auto entry_type = di.next_entry_type();
+            auto entry_path = di.next_full_path();
+            if (entry_type != DT_DIR && entry_type != DT_UNKNOWN)
+                TRY(Core::System::unlink(entry_path));
+            else
+                TRY(remove(entry_path, RecursionMode::Allowed));
         }
 
         TRY(Core::System::rmdir(path));
@@ -13,6 +13,7 @@
 #include <AK/Noncopyable.h>
 #include <AK/NonnullRefPtr.h>
 #include <AK/RefCounted.h>
+#include <AK/Vector.h>
 #include <LibCore/Notifier.h>
 
 namespace Core {
@@ -67,6 +68,10 @@ public:
     ~BlockingFileWatcher();
 
     Optional<FileWatcherEvent> wait_for_event();
+
+private:
+    // Events already read from the watcher but not yet handed out by wait_for_event().
+    Vector<FileWatcherEvent> m_queued_events;
 };
 
 class FileWatcher : public FileWatcherBase
@@ -36,58 +36,67 @@ static constexpr unsigned file_watcher_flags_to_inode_watcher_flags(FileWatcherF
     return static_cast<unsigned>(result);
 }
 
-static Optional<FileWatcherEvent> get_event_from_fd(int fd, HashMap<unsigned, DeprecatedString> const& wd_to_path)
+static Vector<FileWatcherEvent> read_events_from_fd(int fd, HashMap<unsigned, DeprecatedString> const& wd_to_path)
 {
-    u8 buffer[MAXIMUM_EVENT_SIZE];
-    int rc = read(fd, &buffer, MAXIMUM_EVENT_SIZE);
+    // The kernel batches as many queued events as fit into our buffer, so read
+    // with room for several of them at once.
+    u8 buffer[4 * MAXIMUM_EVENT_SIZE];
+    int rc = read(fd, &buffer, sizeof(buffer));
     if (rc == 0) {
         return {};
     } else if (rc < 0) {
-        dbgln_if(FILE_WATCHER_DEBUG, "get_event_from_fd: Reading from wd {} failed: {}", fd, strerror(errno));
+        dbgln_if(FILE_WATCHER_DEBUG, "read_events_from_fd: Reading from wd {} failed: {}", fd, strerror(errno));
         return {};
     }
 
-    InodeWatcherEvent* event = reinterpret_cast<InodeWatcherEvent*>(buffer);
-    FileWatcherEvent result;
+    Vector<FileWatcherEvent> events;
+    size_t offset = 0;
+    while (offset + sizeof(InodeWatcherEvent) <= static_cast<size_t>(rc)) {
+        auto const* event = reinterpret_cast<InodeWatcherEvent const*>(buffer + offset);
+        offset += sizeof(InodeWatcherEvent) + event->name_length;
 
-    auto it = wd_to_path.find(event->watch_descriptor);
-    if (it == wd_to_path.end()) {
-        dbgln_if(FILE_WATCHER_DEBUG, "get_event_from_fd: Got an event for a non-existent wd {}?!", event->watch_descriptor);
-        return {};
-    }
-    DeprecatedString const& path = it->value;
-
-    switch (event->type) {
-    case InodeWatcherEvent::Type::ChildCreated:
-        result.type = FileWatcherEvent::Type::ChildCreated;
-        break;
-    case InodeWatcherEvent::Type::ChildDeleted:
-        result.type = FileWatcherEvent::Type::ChildDeleted;
-        break;
-    case InodeWatcherEvent::Type::Deleted:
-        result.type = FileWatcherEvent::Type::Deleted;
-        break;
-    case InodeWatcherEvent::Type::ContentModified:
-        result.type = FileWatcherEvent::Type::ContentModified;
-        break;
-    case InodeWatcherEvent::Type::MetadataModified:
-        result.type = FileWatcherEvent::Type::MetadataModified;
-        break;
-    default:
-        warnln("Unknown event type {} returned by the watch_file descriptor for {}", static_cast<unsigned>(event->type), path);
-        return {};
-    }
+        auto it = wd_to_path.find(event->watch_descriptor);
+        if (it == wd_to_path.end()) {
+            dbgln_if(FILE_WATCHER_DEBUG, "read_events_from_fd: Got an event for a non-existent wd {}?!", event->watch_descriptor);
+            continue;
+        }
+        DeprecatedString const& path = it->value;
+
+        FileWatcherEvent result;
+        switch (event->type) {
+        case InodeWatcherEvent::Type::ChildCreated:
+            result.type = FileWatcherEvent::Type::ChildCreated;
+            break;
+        case InodeWatcherEvent::Type::ChildDeleted:
+            result.type = FileWatcherEvent::Type::ChildDeleted;
+            break;
+        case InodeWatcherEvent::Type::Deleted:
+            result.type = FileWatcherEvent::Type::Deleted;
+            break;
+        case InodeWatcherEvent::Type::ContentModified:
+            result.type = FileWatcherEvent::Type::ContentModified;
+            break;
+        case InodeWatcherEvent::Type::MetadataModified:
+            result.type = FileWatcherEvent::Type::MetadataModified;
+            break;
+        default:
+            warnln("Unknown event type {} returned by the watch_file descriptor for {}", static_cast<unsigned>(event->type), path);
+            continue;
+        }
+
+        // We trust that the kernel only sends the name when appropriate.
+        if (event->name_length > 0) {
+            DeprecatedString child_name { event->name, event->name_length - 1 };
+            result.event_path = LexicalPath::join(path, child_name).string();
+        } else {
+            result.event_path = path;
+        }
 
-    // We trust that the kernel only sends the name when appropriate.
-    if (event->name_length > 0) {
-        DeprecatedString child_name { event->name, event->name_length - 1 };
-        result.event_path = LexicalPath::join(path, child_name).string();
-    } else {
-        result.event_path = path;
+        dbgln_if(FILE_WATCHER_DEBUG, "read_events_from_fd: got event from wd {} on '{}' type {}", fd, result.event_path, result.type);
+        events.append(move(result));
     }
 
-    dbgln_if(FILE_WATCHER_DEBUG, "get_event_from_fd: got event from wd {} on '{}' type {}", fd, result.event_path, result.type);
-    return result;
+    return events;
 }
 
 static DeprecatedString canonicalize_path(DeprecatedString path)
@@ -167,11 +176,13 @@ Optional<FileWatcherEvent> BlockingFileWatcher::wait_for_event()
 {
     dbgln_if(FILE_WATCHER_DEBUG, "BlockingFileWatcher::wait_for_event()");
 
-    auto maybe_event = get_event_from_fd(m_watcher_fd, m_wd_to_path);
-    if (!maybe_event.has_value())
-        return maybe_event;
+    if (m_queued_events.is_empty()) {
+        m_queued_events = read_events_from_fd(m_watcher_fd, m_wd_to_path);
+        if (m_queued_events.is_empty())
+            return {};
+    }
 
-    auto event = maybe_event.release_value();
+    auto event = m_queued_events.take_first();
     if (event.type == FileWatcherEvent::Type::Deleted) {
         auto result = remove_watch(event.event_path);
         if (result.is_error()) {
@@ -197,9 +208,7 @@ FileWatcher::FileWatcher(int watcher_fd, NonnullRefPtr<Notifier> notifier)
     , m_notifier(move(notifier))
 {
     m_notifier->on_ready_to_read = [this] {
-        auto maybe_event = get_event_from_fd(m_notifier->fd(), m_wd_to_path);
-        if (maybe_event.has_value()) {
-            auto event = maybe_event.value();
+        for (auto const& event : read_events_from_fd(m_notifier->fd(), m_wd_to_path)) {
             on_change(event);
 
             if (event.type == FileWatcherEvent::Type::Deleted) {
@@ -14,13 +14,13 @@
 
 namespace Core {
 
-ErrorOr<NonnullRefPtr<MappedFile>> MappedFile::map(StringView path)
+ErrorOr<NonnullRefPtr<MappedFile>> MappedFile::map(StringView path, AccessPattern access_pattern)
 {
     auto fd = TRY(Core::System::open(path, O_RDONLY | O_CLOEXEC, 0));
-    return map_from_fd_and_close(fd, path);
+    return map_from_fd_and_close(fd, path, access_pattern);
 }
 
-ErrorOr<NonnullRefPtr<MappedFile>> MappedFile::map_from_fd_and_close(int fd, [[maybe_unused]] StringView path)
+ErrorOr<NonnullRefPtr<MappedFile>> MappedFile::map_from_fd_and_close(int fd, [[maybe_unused]] StringView path, AccessPattern access_pattern)
 {
     TRY(Core::System::fcntl(fd, F_SETFD, FD_CLOEXEC));
 
@@ -33,6 +33,12 @@ ErrorOr<NonnullRefPtr<MappedFile>> MappedFile::map_from_fd_and_close(int fd, [[m
 
     auto* ptr = TRY(Core::System::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0, 0, path));
 
+    // Purely advisory; don't let a kernel that ignores the hint fail the map.
+    if (access_pattern == AccessPattern::Sequential)
+        (void)Core::System::madvise(ptr, size, MADV_SEQUENTIAL);
+    else if (access_pattern == AccessPattern::Random)
+        (void)Core::System::madvise(ptr, size, MADV_RANDOM);
+
     return adopt_ref(*new MappedFile(ptr, size));
 }
 
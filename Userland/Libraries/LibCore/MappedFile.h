@@ -19,8 +19,16 @@ class MappedFile : public RefCounted<MappedFile> {
     AK_MAKE_NONMOVABLE(MappedFile);
 
 public:
-    static ErrorOr<NonnullRefPtr<MappedFile>> map(StringView path);
-    static ErrorOr<NonnullRefPtr<MappedFile>> map_from_fd_and_close(int fd, StringView path);
+    // An access pattern hint is forwarded to the kernel via madvise(), letting
+    // it read ahead for consumers that lex straight through the mapping.
+    enum class AccessPattern {
+        Default,
+        Sequential,
+        Random,
+    };
+
+    static ErrorOr<NonnullRefPtr<MappedFile>> map(StringView path, AccessPattern = AccessPattern::Default);
+    static ErrorOr<NonnullRefPtr<MappedFile>> map_from_fd_and_close(int fd, StringView path, AccessPattern = AccessPattern::Default);
     ~MappedFile();
 
     void* data() { return m_data; }
@@ -29,6 +37,7 @@ public:
     size_t size() const { return m_size; }
 
     ReadonlyBytes bytes() const { return { m_data, m_size }; }
+    StringView string_view() const { return bytes(); }
 
 private:
     explicit MappedFile(void*, size_t);
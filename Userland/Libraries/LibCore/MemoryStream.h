@@ -22,6 +22,11 @@ public:
     static ErrorOr<NonnullOwnPtr<FixedMemoryStream>> construct(Bytes bytes);
     static ErrorOr<NonnullOwnPtr<FixedMemoryStream>> construct(ReadonlyBytes bytes);
 
+    // The constructors cannot fail, so short-lived streams can also live on
+    // the stack instead of going through construct().
+    explicit FixedMemoryStream(Bytes bytes);
+    explicit FixedMemoryStream(ReadonlyBytes bytes);
+
     virtual bool is_eof() const override;
     virtual bool is_open() const override;
     virtual void close() override;
@@ -39,9 +44,6 @@ public:
     size_t remaining() const;
 
 private:
-    explicit FixedMemoryStream(Bytes bytes);
-    explicit FixedMemoryStream(ReadonlyBytes bytes);
-
     Bytes m_bytes;
     size_t m_offset { 0 };
     bool m_writing_enabled { true };
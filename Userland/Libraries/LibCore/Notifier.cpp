@@ -33,6 +33,15 @@ void Notifier::set_enabled(bool enabled)
         Core::EventLoop::unregister_notifier({}, *this);
 }
 
+void Notifier::set_event_mask(unsigned event_mask)
+{
+    if (m_event_mask == event_mask)
+        return;
+    m_event_mask = event_mask;
+    // The event loop caches its pollfd interest list; tell it to pick up the new mask.
+    Core::EventLoop::notifier_event_mask_was_changed({});
+}
+
 void Notifier::close()
 {
     if (m_fd < 0)
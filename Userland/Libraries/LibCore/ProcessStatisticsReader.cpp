@@ -64,6 +64,9 @@ ErrorOr<AllProcessesStatistics> ProcessStatisticsReader::get_all(Core::Stream::S
             thread.cpu = thread_object.get_deprecated("cpu"sv).to_u32();
             thread.priority = thread_object.get_deprecated("priority"sv).to_u32();
             thread.syscall_count = thread_object.get_deprecated("syscall_count"sv).to_u32();
+            thread.cpu_cycles = thread_object.get_deprecated("cpu_cycles"sv).to_u64();
+            thread.instructions_retired = thread_object.get_deprecated("instructions_retired"sv).to_u64();
+            thread.cache_misses = thread_object.get_deprecated("cache_misses"sv).to_u64();
             thread.inode_faults = thread_object.get_deprecated("inode_faults"sv).to_u32();
             thread.zero_faults = thread_object.get_deprecated("zero_faults"sv).to_u32();
             thread.cow_faults = thread_object.get_deprecated("cow_faults"sv).to_u32();
@@ -18,6 +18,9 @@ struct ThreadStatistics {
     u64 time_user;
     u64 time_kernel;
     unsigned syscall_count;
+    u64 cpu_cycles;
+    u64 instructions_retired;
+    u64 cache_misses;
     unsigned inode_faults;
     unsigned zero_faults;
     unsigned cow_faults;
@@ -610,6 +610,16 @@ concept SeekableStreamLike = IsBaseOf<SeekableStream, T>;
 template<typename T>
 concept SocketLike = IsBaseOf<Socket, T>;
 
+// Data returned by a buffered stream's peek_until(): `bytes` is a view into
+// the stream's internal buffer up to (not including) the delimiter, and
+// `total_size` additionally covers the delimiter itself. The view stays valid
+// until the stream is read from or populated again; pass `total_size` to
+// discard_bytes() once the data has been used.
+struct PeekedData {
+    ReadonlyBytes bytes;
+    size_t total_size { 0 };
+};
+
 template<typename T>
 class BufferedHelper {
     AK_MAKE_NONCOPYABLE(BufferedHelper);
@@ -779,6 +789,38 @@ public:
         return Optional<Match> {};
     }
 
+    // Returns everything currently buffered as one contiguous span without
+    // consuming it, populating the buffer from the stream if it has run dry.
+    // The internal ring is only compacted when the data actually wraps around
+    // it; pair this with discard_bytes() to consume what was used.
+    ErrorOr<ReadonlyBytes> peek_buffered_data()
+    {
+        if (!stream().is_open())
+            return Error::from_errno(ENOTCONN);
+
+        if (m_buffer.used_space() == 0)
+            TRY(populate_read_buffer());
+
+        return m_buffer.flattened_read_span();
+    }
+
+    // Like read_until(), but returns a view into the internal buffer instead
+    // of copying into a caller-provided one, so protocol parsers can consume
+    // lines without an intermediate copy. Returns an empty Optional if the
+    // delimiter was not found within max_offset (or the buffer capacity).
+    ErrorOr<Optional<PeekedData>> peek_until(StringView candidate, Optional<size_t> max_offset = {})
+    {
+        if (!stream().is_open())
+            return Error::from_errno(ENOTCONN);
+
+        auto const match = TRY(find_and_populate_until_any_of(Array { candidate }, max_offset));
+        if (!match.has_value())
+            return Optional<PeekedData> {};
+
+        auto const span = TRY(m_buffer.flattened_read_span());
+        return PeekedData { span.trim(match->offset), match->offset + match->size };
+    }
+
     // Returns whether a line can be read, populating the buffer in the process.
     ErrorOr<bool> can_read_line()
     {
@@ -898,6 +940,9 @@ public:
     template<size_t N>
     ErrorOr<Bytes> read_until_any_of(Bytes buffer, Array<StringView, N> candidates) { return m_helper.read_until_any_of(move(buffer), move(candidates)); }
     ErrorOr<bool> can_read_line() { return m_helper.can_read_line(); }
+    ErrorOr<ReadonlyBytes> peek_buffered_data() { return m_helper.peek_buffered_data(); }
+    ErrorOr<Optional<PeekedData>> peek_until(StringView candidate, Optional<size_t> max_offset = {}) { return m_helper.peek_until(move(candidate), max_offset); }
+    ErrorOr<void> discard_bytes(size_t count) { return m_helper.discard_bytes(count); }
 
     size_t buffer_size() const { return m_helper.buffer_size(); }
 
@@ -917,6 +962,9 @@ public:
     virtual ErrorOr<StringView> read_line(Bytes buffer) = 0;
     virtual ErrorOr<Bytes> read_until(Bytes buffer, StringView candidate) = 0;
     virtual ErrorOr<bool> can_read_line() = 0;
+    virtual ErrorOr<ReadonlyBytes> peek_buffered_data() = 0;
+    virtual ErrorOr<Optional<PeekedData>> peek_until(StringView candidate, Optional<size_t> max_offset = {}) = 0;
+    virtual ErrorOr<void> discard_bytes(size_t count) = 0;
     virtual size_t buffer_size() const = 0;
 };
 
@@ -965,6 +1013,9 @@ public:
     template<size_t N>
     ErrorOr<Bytes> read_until_any_of(Bytes buffer, Array<StringView, N> candidates) { return m_helper.read_until_any_of(move(buffer), move(candidates)); }
     virtual ErrorOr<bool> can_read_line() override { return m_helper.can_read_line(); }
+    virtual ErrorOr<ReadonlyBytes> peek_buffered_data() override { return m_helper.peek_buffered_data(); }
+    virtual ErrorOr<Optional<PeekedData>> peek_until(StringView candidate, Optional<size_t> max_offset = {}) override { return m_helper.peek_until(move(candidate), max_offset); }
+    virtual ErrorOr<void> discard_bytes(size_t count) override { return m_helper.discard_bytes(count); }
 
     virtual size_t buffer_size() const override { return m_helper.buffer_size(); }
 
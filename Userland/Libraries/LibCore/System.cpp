@@ -387,6 +387,13 @@ ErrorOr<void> munmap(void* address, size_t size)
     return {};
 }
 
+ErrorOr<void> madvise(void* address, size_t size, int advice)
+{
+    if (::madvise(address, size, advice) < 0)
+        return Error::from_syscall("madvise"sv, -errno);
+    return {};
+}
+
 ErrorOr<int> anon_create([[maybe_unused]] size_t size, [[maybe_unused]] int options)
 {
     int fd = -1;
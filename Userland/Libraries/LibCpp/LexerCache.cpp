@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include "LexerCache.h"
+#include <LibCpp/Lexer.h>
+
+namespace Cpp {
+
+LexerCache& LexerCache::the()
+{
+    static LexerCache s_the;
+    return s_the;
+}
+
+NonnullRefPtr<LexerCache::Entry const> LexerCache::get_or_lex(DeprecatedString const& filename, StringView text)
+{
+    if (auto it = m_entries.find(filename); it != m_entries.end() && it->value->text() == text)
+        return *it->value;
+
+    DeprecatedString owned_text = text;
+    Lexer lexer { owned_text.view() };
+    lexer.set_ignore_whitespace(true);
+    auto tokens = lexer.lex();
+
+    auto entry = adopt_ref(*new Entry(move(owned_text), move(tokens)));
+    m_entries.set(filename, entry);
+    return entry;
+}
+
+}
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/DeprecatedString.h>
+#include <AK/HashMap.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/RefCounted.h>
+#include <LibCpp/Token.h>
+
+namespace Cpp {
+
+// A process-wide cache of raw lexed token streams, so that analyzing many
+// documents doesn't re-lex the same headers over and over. The raw token
+// stream of a file depends only on its text - macro substitution happens
+// later, in the Preprocessor - so entries are keyed by filename and verified
+// against the text. Streams are lexed with whitespace tokens ignored, which
+// is what the Preprocessor wants.
+//
+// Entries are reference-counted and own the text their tokens' views point
+// into, so a stream stays valid for as long as anyone holds on to it, even
+// after the cached copy has been replaced by a newer version of the file.
+class LexerCache {
+public:
+    static LexerCache& the();
+
+    class Entry : public RefCounted<Entry> {
+    public:
+        Entry(DeprecatedString text, Vector<Token> tokens)
+            : m_text(move(text))
+            , m_tokens(move(tokens))
+        {
+        }
+
+        DeprecatedString const& text() const { return m_text; }
+        Vector<Token> const& tokens() const { return m_tokens; }
+
+    private:
+        DeprecatedString m_text;
+        Vector<Token> m_tokens;
+    };
+
+    NonnullRefPtr<Entry const> get_or_lex(DeprecatedString const& filename, StringView text);
+
+private:
+    HashMap<DeprecatedString, NonnullRefPtr<Entry>> m_entries;
+};
+
+}
@@ -20,9 +20,9 @@ Preprocessor::Preprocessor(DeprecatedString const& filename, StringView program)
 
 Vector<Token> Preprocessor::process_and_lex()
 {
-    Lexer lexer { m_program };
-    lexer.set_ignore_whitespace(true);
-    auto tokens = lexer.lex();
+    auto lexed_file = LexerCache::the().get_or_lex(m_filename, m_program);
+    m_lexed_file = lexed_file;
+    auto const& tokens = lexed_file->tokens();
 
     m_unprocessed_tokens = tokens;
 
@@ -11,8 +11,10 @@
 #include <AK/Function.h>
 #include <AK/HashMap.h>
 #include <AK/Optional.h>
+#include <AK/RefPtr.h>
 #include <AK/StringView.h>
 #include <AK/Vector.h>
+#include <LibCpp/LexerCache.h>
 #include <LibCpp/Token.h>
 
 namespace Cpp {
@@ -74,6 +76,8 @@ private:
     DeprecatedString m_filename;
     DeprecatedString m_program;
 
+    // Keeps the text that the cached token stream's views point into alive.
+    RefPtr<LexerCache::Entry const> m_lexed_file;
     Vector<Token> m_unprocessed_tokens;
     Vector<Token> m_processed_tokens;
     Definitions m_definitions;
@@ -26,7 +26,7 @@ void UnsignedBigIntegerAlgorithms::destructive_modular_power_without_allocation(
     while (!(ep < 1)) {
         if (ep.words()[0] % 2 == 1) {
             // exp = (exp * base) % m;
-            multiply_without_allocation(exp, base, temp_1, temp_2, temp_3, temp_multiply);
+            multiply_without_allocation(exp, base, temp_1, temp_multiply);
             divide_without_allocation(temp_multiply, m, temp_1, temp_2, temp_3, temp_4, temp_quotient, temp_remainder);
             exp.set_to(temp_remainder);
         }
@@ -36,7 +36,7 @@ void UnsignedBigIntegerAlgorithms::destructive_modular_power_without_allocation(
         ep.set_to(temp_quotient);
 
         // base = (base * base) % m;
-        multiply_without_allocation(base, base, temp_1, temp_2, temp_3, temp_multiply);
+        multiply_without_allocation(base, base, temp_1, temp_multiply);
         divide_without_allocation(temp_multiply, m, temp_1, temp_2, temp_3, temp_4, temp_quotient, temp_remainder);
         base.set_to(temp_remainder);
 
@@ -244,8 +244,19 @@ void UnsignedBigIntegerAlgorithms::montgomery_modular_power_with_minimal_allocat
                 almost_montgomery_multiplication_without_allocation(zz, zz, modulo, temp_z, k, num_words, z);
             }
             auto power_index = exponent_word >> (UnsignedBigInteger::BITS_IN_WORD - window_size);
-            auto& power = powers[power_index];
-            almost_montgomery_multiplication_without_allocation(z, power, modulo, temp_z, k, num_words, zz);
+
+            // Select the power by scanning the whole table with a branchless mask
+            // instead of indexing into it, so private exponent bits don't leak
+            // through the data cache. x is no longer needed at this point.
+            x.set_to(0);
+            x.resize_with_leading_zeros(num_words);
+            for (size_t i = 0; i < (1 << window_size); ++i) {
+                UnsignedBigInteger::Word const is_match = (static_cast<UnsignedBigInteger::Word>(i ^ power_index) - 1) >> (UnsignedBigInteger::BITS_IN_WORD - 1);
+                UnsignedBigInteger::Word const mask = 0 - is_match;
+                for (size_t word = 0; word < num_words; ++word)
+                    x.m_words[word] |= powers[i].m_words[word] & mask;
+            }
+            almost_montgomery_multiplication_without_allocation(z, x, modulo, temp_z, k, num_words, zz);
 
             swap(z, zz);
 
@@ -9,38 +9,177 @@
 
 namespace Crypto {
 
+using Word = UnsignedBigInteger::Word;
+
+// Operands with fewer words than this are multiplied with the plain schoolbook
+// loop; above it, Karatsuba's algorithm pays for its extra additions.
+constexpr size_t KARATSUBA_THRESHOLD_WORDS = 32;
+
+ALWAYS_INLINE static size_t trimmed_word_count(Word const* words, size_t length)
+{
+    while (length > 0 && words[length - 1] == 0)
+        --length;
+    return length;
+}
+
+/**
+ * Computes out = x + y. out must have space for max(x_length, y_length) + 1 words,
+ * and that is also the length written (the top word may be zero).
+ */
+static size_t add_words(Word const* x, size_t x_length, Word const* y, size_t y_length, Word* out)
+{
+    if (x_length < y_length) {
+        swap(x, y);
+        swap(x_length, y_length);
+    }
+    u64 carry = 0;
+    size_t i = 0;
+    for (; i < y_length; ++i) {
+        u64 sum = static_cast<u64>(x[i]) + y[i] + carry;
+        out[i] = static_cast<Word>(sum);
+        carry = sum >> UnsignedBigInteger::BITS_IN_WORD;
+    }
+    for (; i < x_length; ++i) {
+        u64 sum = static_cast<u64>(x[i]) + carry;
+        out[i] = static_cast<Word>(sum);
+        carry = sum >> UnsignedBigInteger::BITS_IN_WORD;
+    }
+    out[x_length] = static_cast<Word>(carry);
+    return x_length + 1;
+}
+
 /**
- * Complexity: O(N^2) where N is the number of words in the larger number
- * Multiplication method:
- * An integer is equal to the sum of the powers of two
- * according to the indices of its 'on' bits.
- * So to multiple x*y, we go over each '1' bit in x (say the i'th bit),
- * and add y<<i to the result.
+ * Computes x -= y in place; x must be at least as large as y.
+ */
+static void subtract_words_in_place(Word* x, size_t x_length, Word const* y, size_t y_length)
+{
+    u64 borrow = 0;
+    for (size_t i = 0; i < y_length; ++i) {
+        u64 difference = static_cast<u64>(x[i]) - y[i] - borrow;
+        x[i] = static_cast<Word>(difference);
+        borrow = (difference >> UnsignedBigInteger::BITS_IN_WORD) & 1;
+    }
+    for (size_t i = y_length; borrow && i < x_length; ++i) {
+        u64 difference = static_cast<u64>(x[i]) - borrow;
+        x[i] = static_cast<Word>(difference);
+        borrow = (difference >> UnsignedBigInteger::BITS_IN_WORD) & 1;
+    }
+}
+
+/**
+ * Adds src into dest, rippling the carry through the rest of dest.
+ * The sum must fit into dest_length words.
+ */
+static void add_words_into(Word* dest, size_t dest_length, Word const* src, size_t src_length)
+{
+    u64 carry = 0;
+    size_t i = 0;
+    for (; i < src_length; ++i) {
+        u64 sum = static_cast<u64>(dest[i]) + src[i] + carry;
+        dest[i] = static_cast<Word>(sum);
+        carry = sum >> UnsignedBigInteger::BITS_IN_WORD;
+    }
+    for (; carry && i < dest_length; ++i) {
+        u64 sum = static_cast<u64>(dest[i]) + carry;
+        dest[i] = static_cast<Word>(sum);
+        carry = sum >> UnsignedBigInteger::BITS_IN_WORD;
+    }
+}
+
+/**
+ * Computes z += x * y with the O(N^2) schoolbook method, one whole word of x
+ * per inner loop using double-word intermediate products.
+ * z must be zeroed and have x_length + y_length words.
+ * Note that the loop structure is deliberately free of data-dependent branches,
+ * so private-key operations don't leak operand bits through their timing.
+ */
+static void multiply_words_schoolbook(Word const* x, size_t x_length, Word const* y, size_t y_length, Word* z)
+{
+    for (size_t i = 0; i < x_length; ++i) {
+        Word carry = 0;
+        for (size_t j = 0; j < y_length; ++j) {
+            u64 result = static_cast<u64>(x[i]) * y[j] + z[i + j] + carry;
+            z[i + j] = static_cast<Word>(result);
+            carry = static_cast<Word>(result >> UnsignedBigInteger::BITS_IN_WORD);
+        }
+        z[i + y_length] = carry;
+    }
+}
+
+/**
+ * Computes z = x * y, splitting large operands with Karatsuba's algorithm:
+ *   x * y = z2 * B^2m + ((x0 + x1)(y0 + y1) - z2 - z0) * B^m + z0
+ * with z0 = x0 * y0 and z2 = x1 * y1, costing three half-size multiplications
+ * instead of four.
+ * z must be zeroed and have x_length + y_length words.
+ */
+static void multiply_words(Word const* x, size_t x_length, Word const* y, size_t y_length, Word* z, Word* scratch)
+{
+    x_length = trimmed_word_count(x, x_length);
+    y_length = trimmed_word_count(y, y_length);
+    if (x_length == 0 || y_length == 0)
+        return;
+
+    if (min(x_length, y_length) < KARATSUBA_THRESHOLD_WORDS) {
+        multiply_words_schoolbook(x, x_length, y, y_length, z);
+        return;
+    }
+
+    size_t const m = (max(x_length, y_length) + 1) / 2;
+    size_t const x0_length = min(x_length, m);
+    size_t const y0_length = min(y_length, m);
+    size_t const x1_length = x_length - x0_length;
+    size_t const y1_length = y_length - y0_length;
+
+    Word* const sum_x = scratch;
+    Word* const sum_y = scratch + m + 1;
+    Word* const middle = scratch + 2 * (m + 1);
+
+    size_t sum_x_length = trimmed_word_count(sum_x, add_words(x, x0_length, x + x0_length, x1_length, sum_x));
+    size_t sum_y_length = trimmed_word_count(sum_y, add_words(y, y0_length, y + y0_length, y1_length, sum_y));
+    size_t const middle_length = sum_x_length + sum_y_length;
+    Word* const recursion_scratch = middle + middle_length;
+
+    // z0 and z2 go straight into their final word ranges of z.
+    multiply_words(x, x0_length, y, y0_length, z, recursion_scratch);
+    if (x1_length != 0 && y1_length != 0)
+        multiply_words(x + m, x1_length, y + m, y1_length, z + 2 * m, recursion_scratch);
+
+    __builtin_memset(middle, 0, middle_length * sizeof(Word));
+    multiply_words(sum_x, sum_x_length, sum_y, sum_y_length, middle, recursion_scratch);
+    subtract_words_in_place(middle, middle_length, z, trimmed_word_count(z, x0_length + y0_length));
+    if (x1_length != 0 && y1_length != 0)
+        subtract_words_in_place(middle, middle_length, z + 2 * m, trimmed_word_count(z + 2 * m, x1_length + y1_length));
+
+    add_words_into(z + m, x_length + y_length - m, middle, trimmed_word_count(middle, middle_length));
+}
+
+/**
+ * Complexity: O(N^2) word operations below KARATSUBA_THRESHOLD_WORDS, and
+ * O(N^1.585) above it. output must not alias left or right.
  */
 FLATTEN void UnsignedBigIntegerAlgorithms::multiply_without_allocation(
     UnsignedBigInteger const& left,
     UnsignedBigInteger const& right,
-    UnsignedBigInteger& temp_shift_result,
-    UnsignedBigInteger& temp_shift_plus,
-    UnsignedBigInteger& temp_shift,
+    UnsignedBigInteger& temp_scratch,
     UnsignedBigInteger& output)
 {
-    output.set_to_0();
+    size_t const left_length = left.trimmed_length();
+    size_t const right_length = right.trimmed_length();
 
-    // iterate all bits
-    for (size_t word_index = 0; word_index < left.length(); ++word_index) {
-        for (size_t bit_index = 0; bit_index < UnsignedBigInteger::BITS_IN_WORD; ++bit_index) {
-            // If the bit is off - skip over it
-            if (!(left.m_words[word_index] & (1 << bit_index)))
-                continue;
+    output.set_to_0();
+    if (left_length == 0 || right_length == 0)
+        return;
+    output.resize_with_leading_zeros(left_length + right_length);
 
-            size_t shift_amount = word_index * UnsignedBigInteger::BITS_IN_WORD + bit_index;
+    // Karatsuba needs roughly 4 * m words of scratch across all recursion
+    // levels for a split size of m; over-reserve so nested splits of uneven
+    // halves can never run out.
+    if (min(left_length, right_length) >= KARATSUBA_THRESHOLD_WORDS)
+        temp_scratch.resize_with_leading_zeros(4 * (left_length + right_length) + 64);
 
-            // output += (right << shift_amount);
-            shift_left_without_allocation(right, shift_amount, temp_shift_result, temp_shift_plus, temp_shift);
-            add_into_accumulator_without_allocation(output, temp_shift);
-        }
-    }
+    multiply_words(left.words().data(), left_length, right.words().data(), right_length, output.m_words.data(), temp_scratch.m_words.data());
+    output.clamp_to_trimmed_length();
 }
 
 }
@@ -4,9 +4,14 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Platform.h>
 #include <AK/Types.h>
 #include <LibCrypto/Hash/SHA2.h>
 
+#if ARCH(X86_64) && !defined(KERNEL)
+#    include <immintrin.h>
+#endif
+
 namespace Crypto::Hash {
 constexpr static auto ROTRIGHT(u32 a, size_t b) { return (a >> b) | (a << (32 - b)); }
 constexpr static auto CH(u32 x, u32 y, u32 z) { return (x & y) ^ (z & ~x); }
@@ -24,6 +29,119 @@ constexpr static auto EP1(u64 x) { return ROTRIGHT(x, 14) ^ ROTRIGHT(x, 18) ^ RO
 constexpr static auto SIGN0(u64 x) { return ROTRIGHT(x, 1) ^ ROTRIGHT(x, 8) ^ (x >> 7); }
 constexpr static auto SIGN1(u64 x) { return ROTRIGHT(x, 19) ^ ROTRIGHT(x, 61) ^ (x >> 6); }
 
+#if ARCH(X86_64) && !defined(KERNEL)
+// Hardware SHA (SHA-NI) fast path for the SHA-256 compression function, processing any
+// number of consecutive blocks per call; the scalar rounds below remain the fallback.
+// There is no corresponding instruction for SHA-384/512.
+// FIXME: Add an ARMv8 sha2 extension path for aarch64 once userland runs there.
+static bool detect_sha_ni()
+{
+    u32 eax = 7, ebx, ecx = 0, edx;
+    asm volatile("cpuid"
+                 : "+a"(eax), "=b"(ebx), "+c"(ecx), "=d"(edx));
+    return (ebx & (1 << 29)) != 0;
+}
+
+static bool const s_has_sha_ni = detect_sha_ni();
+
+[[gnu::target("sha,sse4.1")]] static void sha256_ni_transform(u32* state, u8 const* data, size_t block_count)
+{
+    __m128i const shuffle_mask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+    auto round_constants = [](size_t i) {
+        return _mm_loadu_si128(reinterpret_cast<__m128i const*>(&SHA256Constants::RoundConstants[i]));
+    };
+
+    // The SHA instructions expect the state words packed as (ABEF, CDGH).
+    auto tmp = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const*>(&state[0])), 0xb1); // CDAB
+    auto state1 = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const*>(&state[4])), 0x1b); // EFGH
+    auto state0 = _mm_alignr_epi8(tmp, state1, 8);  // ABEF
+    state1 = _mm_blend_epi16(state1, tmp, 0xf0);    // CDGH
+
+    while (block_count-- > 0) {
+        auto const abef_save = state0;
+        auto const cdgh_save = state1;
+
+        auto msg0 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(data + 0)), shuffle_mask);
+        auto msg1 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(data + 16)), shuffle_mask);
+        auto msg2 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(data + 32)), shuffle_mask);
+        auto msg3 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(data + 48)), shuffle_mask);
+
+        __m128i msg;
+
+        // Rounds 0-15, before the message schedule kicks in.
+        msg = _mm_add_epi32(msg0, round_constants(0));
+        state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+        state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(msg, 0x0e));
+
+        msg = _mm_add_epi32(msg1, round_constants(4));
+        state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+        state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(msg, 0x0e));
+        msg0 = _mm_sha256msg1_epu32(msg0, msg1);
+
+        msg = _mm_add_epi32(msg2, round_constants(8));
+        state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+        state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(msg, 0x0e));
+        msg1 = _mm_sha256msg1_epu32(msg1, msg2);
+
+        msg = _mm_add_epi32(msg3, round_constants(12));
+        state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+        msg0 = _mm_add_epi32(msg0, _mm_alignr_epi8(msg3, msg2, 4));
+        msg0 = _mm_sha256msg2_epu32(msg0, msg3);
+        state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(msg, 0x0e));
+        msg2 = _mm_sha256msg1_epu32(msg2, msg3);
+
+        // Rounds 16-51: four rounds per iteration with the schedule computed on the fly,
+        // rotating through the four message registers.
+        for (size_t i = 16; i < 52; i += 4) {
+            msg = _mm_add_epi32(msg0, round_constants(i));
+            state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+            msg1 = _mm_add_epi32(msg1, _mm_alignr_epi8(msg0, msg3, 4));
+            msg1 = _mm_sha256msg2_epu32(msg1, msg0);
+            state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(msg, 0x0e));
+            msg3 = _mm_sha256msg1_epu32(msg3, msg0);
+
+            auto const rotate = msg0;
+            msg0 = msg1;
+            msg1 = msg2;
+            msg2 = msg3;
+            msg3 = rotate;
+        }
+
+        // Rounds 52-63, with the message schedule winding down.
+        msg = _mm_add_epi32(msg0, round_constants(52));
+        state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+        msg1 = _mm_add_epi32(msg1, _mm_alignr_epi8(msg0, msg3, 4));
+        msg1 = _mm_sha256msg2_epu32(msg1, msg0);
+        state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(msg, 0x0e));
+
+        msg = _mm_add_epi32(msg1, round_constants(56));
+        state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+        msg2 = _mm_add_epi32(msg2, _mm_alignr_epi8(msg1, msg0, 4));
+        msg2 = _mm_sha256msg2_epu32(msg2, msg1);
+        state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(msg, 0x0e));
+
+        msg = _mm_add_epi32(msg2, round_constants(60));
+        state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+        state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(msg, 0x0e));
+
+        state0 = _mm_add_epi32(state0, abef_save);
+        state1 = _mm_add_epi32(state1, cdgh_save);
+
+        data += 64;
+    }
+
+    // Unpack (ABEF, CDGH) back into a..h order.
+    tmp = _mm_shuffle_epi32(state0, 0x1b);       // FEBA
+    state1 = _mm_shuffle_epi32(state1, 0xb1);    // DCHG
+    state0 = _mm_blend_epi16(tmp, state1, 0xf0); // DCBA
+    state1 = _mm_alignr_epi8(state1, tmp, 8);    // HGFE
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[0]), state0);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[4]), state1);
+}
+#endif
+
 inline void SHA256::transform(u8 const* data)
 {
     u32 m[64];
@@ -65,15 +183,45 @@ inline void SHA256::transform(u8 const* data)
     m_state[7] += h;
 }
 
+inline void SHA256::transform_blocks(u8 const* data, size_t block_count)
+{
+#if ARCH(X86_64) && !defined(KERNEL)
+    if (s_has_sha_ni)
+        return sha256_ni_transform(m_state, data, block_count);
+#endif
+    for (size_t i = 0; i < block_count; ++i)
+        transform(data + i * BlockSize);
+}
+
 void SHA256::update(u8 const* message, size_t length)
 {
-    for (size_t i = 0; i < length; ++i) {
+    size_t offset = 0;
+
+    // Finish any partially filled block first.
+    if (m_data_length > 0) {
+        auto to_copy = min<size_t>(BlockSize - m_data_length, length);
+        __builtin_memcpy(m_data_buffer + m_data_length, message, to_copy);
+        m_data_length += to_copy;
+        offset += to_copy;
         if (m_data_length == BlockSize) {
-            transform(m_data_buffer);
-            m_bit_length += 512;
+            transform_blocks(m_data_buffer, 1);
+            m_bit_length += BlockSize * 8;
             m_data_length = 0;
         }
-        m_data_buffer[m_data_length++] = message[i];
+    }
+
+    // Compress whole blocks straight from the message, so hashing a chain of buffers
+    // with repeated update() calls never stages more than a block-sized tail.
+    auto const block_count = (length - offset) / BlockSize;
+    if (block_count > 0) {
+        transform_blocks(message + offset, block_count);
+        m_bit_length += block_count * BlockSize * 8;
+        offset += block_count * BlockSize;
+    }
+
+    if (offset < length) {
+        __builtin_memcpy(m_data_buffer, message + offset, length - offset);
+        m_data_length = length - offset;
     }
 }
 
@@ -90,7 +238,7 @@ SHA256::DigestType SHA256::peek()
     size_t i = m_data_length;
 
     if (BlockSize == m_data_length) {
-        transform(m_data_buffer);
+        transform_blocks(m_data_buffer, 1);
         m_bit_length += BlockSize * 8;
         m_data_length = 0;
         i = 0;
@@ -106,7 +254,7 @@ SHA256::DigestType SHA256::peek()
         m_data_buffer[i++] = 0x80;
         while (i < BlockSize)
             m_data_buffer[i++] = 0x00;
-        transform(m_data_buffer);
+        transform_blocks(m_data_buffer, 1);
 
         // Then start another block with BlockSize - 8 bytes of zeros
         __builtin_memset(m_data_buffer, 0, FinalBlockDataSize);
@@ -123,7 +271,7 @@ SHA256::DigestType SHA256::peek()
     m_data_buffer[BlockSize - 7] = m_bit_length >> 48;
     m_data_buffer[BlockSize - 8] = m_bit_length >> 56;
 
-    transform(m_data_buffer);
+    transform_blocks(m_data_buffer, 1);
 
     // SHA uses big-endian and we assume little-endian
     // FIXME: looks like a thing for AK::NetworkOrdered,
@@ -185,13 +333,31 @@ inline void SHA384::transform(u8 const* data)
 
 void SHA384::update(u8 const* message, size_t length)
 {
-    for (size_t i = 0; i < length; ++i) {
+    size_t offset = 0;
+
+    // Finish any partially filled block first.
+    if (m_data_length > 0) {
+        auto to_copy = min<size_t>(BlockSize - m_data_length, length);
+        __builtin_memcpy(m_data_buffer + m_data_length, message, to_copy);
+        m_data_length += to_copy;
+        offset += to_copy;
         if (m_data_length == BlockSize) {
             transform(m_data_buffer);
-            m_bit_length += 1024;
+            m_bit_length += BlockSize * 8;
             m_data_length = 0;
         }
-        m_data_buffer[m_data_length++] = message[i];
+    }
+
+    // Compress whole blocks straight from the message.
+    while (length - offset >= BlockSize) {
+        transform(message + offset);
+        m_bit_length += BlockSize * 8;
+        offset += BlockSize;
+    }
+
+    if (offset < length) {
+        __builtin_memcpy(m_data_buffer, message + offset, length - offset);
+        m_data_length = length - offset;
     }
 }
 
@@ -309,13 +475,31 @@ inline void SHA512::transform(u8 const* data)
 
 void SHA512::update(u8 const* message, size_t length)
 {
-    for (size_t i = 0; i < length; ++i) {
+    size_t offset = 0;
+
+    // Finish any partially filled block first.
+    if (m_data_length > 0) {
+        auto to_copy = min<size_t>(BlockSize - m_data_length, length);
+        __builtin_memcpy(m_data_buffer + m_data_length, message, to_copy);
+        m_data_length += to_copy;
+        offset += to_copy;
         if (m_data_length == BlockSize) {
             transform(m_data_buffer);
-            m_bit_length += 1024;
+            m_bit_length += BlockSize * 8;
             m_data_length = 0;
         }
-        m_data_buffer[m_data_length++] = message[i];
+    }
+
+    // Compress whole blocks straight from the message.
+    while (length - offset >= BlockSize) {
+        transform(message + offset);
+        m_bit_length += BlockSize * 8;
+        offset += BlockSize;
+    }
+
+    if (offset < length) {
+        __builtin_memcpy(m_data_buffer, message + offset, length - offset);
+        m_data_length = length - offset;
     }
 }
 
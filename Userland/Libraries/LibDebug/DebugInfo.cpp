@@ -113,20 +113,45 @@ void DebugInfo::prepare_lines()
     });
 }
 
-Optional<DebugInfo::SourcePosition> DebugInfo::get_source_position(FlatPtr target_address) const
+void DebugInfo::build_scope_index() const
 {
-    if (m_sorted_lines.is_empty())
-        return {};
-    if (target_address < m_sorted_lines[0].address)
-        return {};
+    m_scopes_by_address.ensure_capacity(m_scopes.size());
+    for (size_t i = 0; i < m_scopes.size(); ++i)
+        m_scopes_by_address.unchecked_append({ i, 0 });
+
+    quick_sort(m_scopes_by_address, [this](auto& a, auto& b) {
+        auto const& scope_a = m_scopes[a.scope_index];
+        auto const& scope_b = m_scopes[b.scope_index];
+        if (scope_a.address_low != scope_b.address_low)
+            return scope_a.address_low < scope_b.address_low;
+        return a.scope_index < b.scope_index;
+    });
 
-    // TODO: We can do a binary search here
-    for (size_t i = 0; i < m_sorted_lines.size() - 1; ++i) {
-        if (m_sorted_lines[i + 1].address > target_address) {
-            return SourcePosition::from_line_info(m_sorted_lines[i]);
-        }
+    FlatPtr max_address_high = 0;
+    for (auto& entry : m_scopes_by_address) {
+        max_address_high = max(max_address_high, m_scopes[entry.scope_index].address_high);
+        entry.max_address_high = max_address_high;
     }
-    return {};
+
+    m_built_scope_index = true;
+}
+
+Optional<DebugInfo::SourcePosition> DebugInfo::get_source_position(FlatPtr target_address) const
+{
+    // Binary search for the last line entry whose address is not above the target.
+    size_t low = 0;
+    size_t high = m_sorted_lines.size();
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (m_sorted_lines[mid].address <= target_address)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+
+    if (low == 0 || low == m_sorted_lines.size())
+        return {};
+    return SourcePosition::from_line_info(m_sorted_lines[low - 1]);
 }
 
 Optional<DebugInfo::SourcePositionAndAddress> DebugInfo::get_address_from_source_position(DeprecatedString const& file, size_t line) const
@@ -164,26 +189,23 @@ NonnullOwnPtrVector<DebugInfo::VariableInfo> DebugInfo::get_variables_in_current
 {
     NonnullOwnPtrVector<DebugInfo::VariableInfo> variables;
 
-    // TODO: We can store the scopes in a better data structure
-    for (auto const& scope : m_scopes) {
-        FlatPtr ip;
+    FlatPtr ip;
 #if ARCH(X86_64)
-        ip = regs.rip;
+    ip = regs.rip;
 #elif ARCH(AARCH64)
-        TODO_AARCH64();
+    TODO_AARCH64();
 #else
 #    error Unknown architecture
 #endif
-        if (ip - m_base_address < scope.address_low || ip - m_base_address >= scope.address_high)
-            continue;
 
+    for_each_scope_containing(ip - m_base_address, [&](VariablesScope const& scope) {
         for (auto const& die_entry : scope.dies_of_variables) {
             auto variable_info = create_variable_info(die_entry, regs);
             if (!variable_info)
                 continue;
             variables.append(variable_info.release_nonnull());
         }
-    }
+    });
     return variables;
 }
 
@@ -360,21 +382,31 @@ DeprecatedString DebugInfo::name_of_containing_function(FlatPtr address) const
 
 Optional<DebugInfo::VariablesScope> DebugInfo::get_containing_function(FlatPtr address) const
 {
-    for (auto const& scope : m_scopes) {
-        if (!scope.is_function || address < scope.address_low || address >= scope.address_high)
-            continue;
-        return scope;
-    }
-    return {};
+    Optional<VariablesScope> result;
+    for_each_scope_containing(address, [&](VariablesScope const& scope) {
+        if (scope.is_function && !result.has_value())
+            result = scope;
+    });
+    return result;
 }
 
 Vector<DebugInfo::SourcePosition> DebugInfo::source_lines_in_scope(VariablesScope const& scope) const
 {
     Vector<DebugInfo::SourcePosition> source_lines;
-    for (auto const& line : m_sorted_lines) {
-        if (line.address < scope.address_low)
-            continue;
 
+    // Binary search for the first line entry inside the scope.
+    size_t low = 0;
+    size_t high = m_sorted_lines.size();
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (m_sorted_lines[mid].address < scope.address_low)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+
+    for (size_t i = low; i < m_sorted_lines.size(); ++i) {
+        auto const& line = m_sorted_lines[i];
         if (line.address >= scope.address_high)
             break;
         source_lines.append(SourcePosition::from_line_info(line));
@@ -10,6 +10,7 @@
 #include <AK/NonnullRefPtr.h>
 #include <AK/Optional.h>
 #include <AK/OwnPtr.h>
+#include <AK/QuickSort.h>
 #include <AK/Vector.h>
 #include <LibDebug/Dwarf/DIE.h>
 #include <LibDebug/Dwarf/DwarfInfo.h>
@@ -116,6 +117,11 @@ private:
     void prepare_variable_scopes();
     void prepare_lines();
     void parse_scopes_impl(Dwarf::DIE const& die);
+    void build_scope_index() const;
+    // Invokes the callback for every scope that contains the given address,
+    // in the order the scopes were parsed in (so outer scopes come first).
+    template<typename Callback>
+    void for_each_scope_containing(FlatPtr address, Callback) const;
     OwnPtr<VariableInfo> create_variable_info(Dwarf::DIE const& variable_die, PtraceRegisters const&, u32 address_offset = 0) const;
     static bool is_variable_tag_supported(Dwarf::EntryTag const& tag);
     void add_type_info_to_variable(Dwarf::DIE const& type_die, PtraceRegisters const& regs, DebugInfo::VariableInfo* parent_variable) const;
@@ -130,6 +136,51 @@ private:
 
     Vector<VariablesScope> m_scopes;
     Vector<Dwarf::LineProgram::LineInfo> m_sorted_lines;
+
+    struct ScopeIndexEntry {
+        size_t scope_index { 0 };
+        // Highest address_high of this scope and every scope that starts
+        // before it; lets address queries know when to stop walking back.
+        FlatPtr max_address_high { 0 };
+    };
+    // Indices into m_scopes, sorted by address_low. Built lazily on the first
+    // address query and retained for the lifetime of the DebugInfo.
+    mutable Vector<ScopeIndexEntry> m_scopes_by_address;
+    mutable bool m_built_scope_index { false };
 };
 
+template<typename Callback>
+void DebugInfo::for_each_scope_containing(FlatPtr address, Callback callback) const
+{
+    if (!m_built_scope_index)
+        build_scope_index();
+
+    // Find the first scope that starts after the address, then walk backwards
+    // until the running maximum of address_high tells us that no earlier
+    // scope can reach this address either.
+    size_t low = 0;
+    size_t high = m_scopes_by_address.size();
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (m_scopes[m_scopes_by_address[mid].scope_index].address_low <= address)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+
+    Vector<size_t> containing_scopes;
+    for (size_t i = low; i > 0; --i) {
+        auto const& entry = m_scopes_by_address[i - 1];
+        if (entry.max_address_high <= address)
+            break;
+        auto const& scope = m_scopes[entry.scope_index];
+        if (address >= scope.address_low && address < scope.address_high)
+            containing_scopes.append(entry.scope_index);
+    }
+
+    quick_sort(containing_scopes);
+    for (auto scope_index : containing_scopes)
+        callback(m_scopes[scope_index]);
+}
+
 }
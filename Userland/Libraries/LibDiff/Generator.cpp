@@ -5,77 +5,279 @@
  */
 
 #include "Generator.h"
+#include <AK/CharacterTypes.h>
+#include <AK/HashMap.h>
+#include <AK/Vector.h>
 
 namespace Diff {
 
-Vector<Hunk> from_text(StringView old_text, StringView new_text)
-{
-    auto old_lines = old_text.lines();
-    auto new_lines = new_text.lines();
-
-    /**
-     * This is a simple implementation of the Longest Common Subsequence algorithm (over
-     * the lines of the text as opposed to the characters). A Dynamic programming approach
-     * is used here.
-     */
-
-    enum class Direction {
-        Down,     // Added a new line
-        Right,    // Removed a line
-        Diagonal, // Line remained the same
-    };
+// Finds a common subsequence of two id sequences and marks its members in
+// m_old_matched/m_new_matched.
+//
+// Ranges are first anchored on elements that are unique on both sides
+// (patience diff): the longest increasing subsequence of those anchors splits
+// the problem into small independent pieces, which works very well on source
+// code and stays fast when almost everything changed. Pieces without unique
+// elements fall back to Myers' divide-and-conquer algorithm, which only keeps
+// two diagonal vectors alive, so memory stays linear instead of the quadratic
+// DP matrix this used to build.
+class SubsequenceFinder {
+public:
+    SubsequenceFinder(Span<u32 const> old_ids, Span<u32 const> new_ids)
+        : m_old(old_ids)
+        , m_new(new_ids)
+    {
+        m_old_matched.resize(m_old.size());
+        m_new_matched.resize(m_new.size());
+        find_subsequence(0, m_old.size(), 0, m_new.size());
+    }
 
-    // A single cell in the DP-matrix. Cell (i, j) represents the longest common
-    // sub-sequence of lines between old_lines[0 : i] and new_lines[0 : j].
-    struct Cell {
-        size_t length;
-        Direction direction;
-    };
+    Vector<bool> const& old_matched() const { return m_old_matched; }
+    Vector<bool> const& new_matched() const { return m_new_matched; }
 
-    auto dp_matrix = Vector<Cell>();
-    dp_matrix.resize((old_lines.size() + 1) * (new_lines.size() + 1));
+private:
+    void match(size_t old_index, size_t new_index)
+    {
+        m_old_matched[old_index] = true;
+        m_new_matched[new_index] = true;
+    }
 
-    auto dp = [&dp_matrix, width = old_lines.size() + 1](size_t i, size_t j) -> Cell& {
-        return dp_matrix[i + width * j];
-    };
+    void find_subsequence(size_t old_start, size_t old_end, size_t new_start, size_t new_end)
+    {
+        while (old_start < old_end && new_start < new_end && m_old[old_start] == m_new[new_start])
+            match(old_start++, new_start++);
+        while (old_start < old_end && new_start < new_end && m_old[old_end - 1] == m_new[new_end - 1])
+            match(--old_end, --new_end);
+
+        if (old_start == old_end || new_start == new_end)
+            return;
+
+        if (try_patience_anchors(old_start, old_end, new_start, new_end))
+            return;
+
+        if (old_end - old_start == 1 || new_end - new_start == 1) {
+            find_single_match(old_start, old_end, new_start, new_end);
+            return;
+        }
+
+        auto split = find_middle_snake(old_start, old_end, new_start, new_end);
+        find_subsequence(old_start, split.old_index, new_start, split.new_index);
+        find_subsequence(split.old_index, old_end, split.new_index, new_end);
+    }
+
+    // Anchors the ranges on elements that occur exactly once on both sides and
+    // recurses between consecutive anchors.
+    bool try_patience_anchors(size_t old_start, size_t old_end, size_t new_start, size_t new_end)
+    {
+        struct Occurrence {
+            size_t count { 0 };
+            size_t index { 0 };
+        };
+        HashMap<u32, Occurrence> old_occurrences;
+        for (size_t i = old_start; i < old_end; ++i) {
+            auto& occurrence = old_occurrences.ensure(m_old[i]);
+            ++occurrence.count;
+            occurrence.index = i;
+        }
+
+        // Candidate anchors in new-side order; the longest increasing
+        // subsequence over their old positions is the set of anchors that can
+        // all be kept in order.
+        struct Anchor {
+            size_t old_index;
+            size_t new_index;
+        };
+        Vector<Anchor> candidates;
+        HashMap<u32, size_t> new_counts;
+        for (size_t j = new_start; j < new_end; ++j)
+            ++new_counts.ensure(m_new[j]);
+        for (size_t j = new_start; j < new_end; ++j) {
+            if (new_counts.get(m_new[j]).value() != 1)
+                continue;
+            auto occurrence = old_occurrences.get(m_new[j]);
+            if (!occurrence.has_value() || occurrence->count != 1)
+                continue;
+            candidates.append({ occurrence->index, j });
+        }
+        if (candidates.is_empty())
+            return false;
 
-    // Initialize the first row and column
-    for (size_t i = 0; i <= old_lines.size(); ++i)
-        dp(i, new_lines.size()) = { 0, Direction::Right };
-
-    for (size_t j = 0; j <= new_lines.size(); ++j)
-        dp(old_lines.size(), 0) = { 0, Direction::Down };
-
-    // Fill in the rest of the DP table
-    for (int i = old_lines.size() - 1; i >= 0; --i) {
-        for (int j = new_lines.size() - 1; j >= 0; --j) {
-            if (old_lines[i] == new_lines[j]) {
-                dp(i, j) = { dp(i + 1, j + 1).length + 1, Direction::Diagonal };
-            } else {
-                auto down = dp(i, j + 1).length;
-                auto right = dp(i + 1, j).length;
-                if (down > right)
-                    dp(i, j) = { down, Direction::Down };
+        // Longest increasing subsequence via patience sorting.
+        Vector<size_t> pile_tops; // Index of the candidate on top of each pile.
+        Vector<size_t> previous;  // Predecessor of each candidate in its chain.
+        previous.resize(candidates.size());
+        for (size_t i = 0; i < candidates.size(); ++i) {
+            size_t low = 0;
+            size_t high = pile_tops.size();
+            while (low < high) {
+                size_t mid = low + (high - low) / 2;
+                if (candidates[pile_tops[mid]].old_index < candidates[i].old_index)
+                    low = mid + 1;
                 else
-                    dp(i, j) = { right, Direction::Right };
+                    high = mid;
             }
+            previous[i] = low > 0 ? pile_tops[low - 1] : NumericLimits<size_t>::max();
+            if (low == pile_tops.size())
+                pile_tops.append(i);
+            else
+                pile_tops[low] = i;
+        }
+
+        Vector<Anchor> anchors;
+        anchors.resize(pile_tops.size());
+        size_t candidate_index = pile_tops.last();
+        for (size_t position = pile_tops.size(); position-- > 0; candidate_index = previous[candidate_index])
+            anchors[position] = candidates[candidate_index];
+
+        size_t previous_old = old_start;
+        size_t previous_new = new_start;
+        for (auto const& anchor : anchors) {
+            find_subsequence(previous_old, anchor.old_index, previous_new, anchor.new_index);
+            match(anchor.old_index, anchor.new_index);
+            previous_old = anchor.old_index + 1;
+            previous_new = anchor.new_index + 1;
         }
+        find_subsequence(previous_old, old_end, previous_new, new_end);
+        return true;
     }
 
+    // When one side is a single element, the common subsequence is just its
+    // first occurrence on the other side (if any).
+    void find_single_match(size_t old_start, size_t old_end, size_t new_start, size_t new_end)
+    {
+        if (old_end - old_start == 1) {
+            for (size_t j = new_start; j < new_end; ++j) {
+                if (m_new[j] == m_old[old_start]) {
+                    match(old_start, j);
+                    return;
+                }
+            }
+            return;
+        }
+        for (size_t i = old_start; i < old_end; ++i) {
+            if (m_old[i] == m_new[new_start]) {
+                match(i, new_start);
+                return;
+            }
+        }
+    }
+
+    struct SplitPoint {
+        size_t old_index;
+        size_t new_index;
+    };
+
+    // Finds a point on some shortest edit path where the given ranges can be
+    // split in two, by searching forwards and backwards simultaneously until
+    // the two frontiers overlap ("finding a middle snake", Myers 1986).
+    SplitPoint find_middle_snake(size_t old_start, size_t old_end, size_t new_start, size_t new_end)
+    {
+        int n = static_cast<int>(old_end - old_start);
+        int m = static_cast<int>(new_end - new_start);
+        int delta = n - m;
+        bool odd_delta = (delta & 1) != 0;
+        int max_depth = (n + m + 1) / 2;
+
+        m_forward.clear_with_capacity();
+        m_backward.clear_with_capacity();
+        m_forward.resize(2 * max_depth + 3);
+        m_backward.resize(2 * max_depth + 3);
+        auto forward = [&](int k) -> int& { return m_forward[k + max_depth + 1]; };
+        auto backward = [&](int k) -> int& { return m_backward[k + max_depth + 1]; };
+
+        auto old_at = [&](int x) { return m_old[old_start + x]; };
+        auto new_at = [&](int y) { return m_new[new_start + y]; };
+
+        for (int d = 0; d <= max_depth; ++d) {
+            for (int k = -d; k <= d; k += 2) {
+                int x = (k == -d || (k != d && forward(k - 1) < forward(k + 1))) ? forward(k + 1) : forward(k - 1) + 1;
+                int y = x - k;
+                while (x < n && y < m && old_at(x) == new_at(y)) {
+                    ++x;
+                    ++y;
+                }
+                forward(k) = x;
+                if (odd_delta && k - delta >= -(d - 1) && k - delta <= d - 1 && x + backward(delta - k) >= n)
+                    return { old_start + x, new_start + y };
+            }
+            for (int k = -d; k <= d; k += 2) {
+                // The backward search walks the reversed sequences.
+                int x = (k == -d || (k != d && backward(k - 1) < backward(k + 1))) ? backward(k + 1) : backward(k - 1) + 1;
+                int y = x - k;
+                while (x < n && y < m && old_at(n - 1 - x) == new_at(m - 1 - y)) {
+                    ++x;
+                    ++y;
+                }
+                backward(k) = x;
+                if (!odd_delta && k - delta >= -d && k - delta <= d && x + forward(delta - k) >= n)
+                    return { old_start + (n - x), new_start + (m - y) };
+            }
+        }
+        VERIFY_NOT_REACHED();
+    }
+
+    Span<u32 const> m_old;
+    Span<u32 const> m_new;
+    Vector<bool> m_old_matched;
+    Vector<bool> m_new_matched;
+    Vector<int> m_forward;
+    Vector<int> m_backward;
+};
+
+// Maps equal pieces of text to equal small integers, so the diff core
+// compares ids instead of re-comparing strings at every step.
+static Vector<u32> intern_sequence(Vector<StringView> const& pieces, HashMap<StringView, u32>& interned)
+{
+    Vector<u32> ids;
+    ids.ensure_capacity(pieces.size());
+    for (auto piece : pieces)
+        ids.unchecked_append(interned.ensure(piece, [&] { return static_cast<u32>(interned.size()); }));
+    return ids;
+}
+
+static Vector<StringView> split_into_tokens(StringView text)
+{
+    Vector<StringView> tokens;
+    size_t token_start = 0;
+    bool in_token = false;
+    for (size_t i = 0; i < text.length(); ++i) {
+        if (is_ascii_space(text[i])) {
+            if (in_token) {
+                tokens.append(text.substring_view(token_start, i - token_start));
+                in_token = false;
+            }
+        } else if (!in_token) {
+            token_start = i;
+            in_token = true;
+        }
+    }
+    if (in_token)
+        tokens.append(text.substring_view(token_start));
+    return tokens;
+}
+
+Vector<Hunk> from_text(StringView old_text, StringView new_text, Granularity granularity)
+{
+    auto old_pieces = granularity == Granularity::Line ? old_text.lines() : split_into_tokens(old_text);
+    auto new_pieces = granularity == Granularity::Line ? new_text.lines() : split_into_tokens(new_text);
+
+    HashMap<StringView, u32> interned;
+    auto old_ids = intern_sequence(old_pieces, interned);
+    auto new_ids = intern_sequence(new_pieces, interned);
+
+    SubsequenceFinder finder { old_ids, new_ids };
+    auto const& old_matched = finder.old_matched();
+    auto const& new_matched = finder.new_matched();
+
     Vector<Hunk> hunks;
     Hunk cur_hunk;
     bool in_hunk = false;
 
-    auto update_hunk = [&](size_t i, size_t j, Direction direction) {
+    auto start_hunk_if_needed = [&](size_t i, size_t j) {
         if (!in_hunk) {
             in_hunk = true;
             cur_hunk = { i, j, {}, {} };
         }
-        if (direction == Direction::Down) {
-            cur_hunk.added_lines.append(new_lines[j]);
-        } else if (direction == Direction::Right) {
-            cur_hunk.removed_lines.append(old_lines[i]);
-        }
     };
 
     auto flush_hunk = [&]() {
@@ -91,31 +293,21 @@ Vector<Hunk> from_text(StringView old_text, StringView new_text)
 
     size_t i = 0;
     size_t j = 0;
-
-    while (i < old_lines.size() && j < new_lines.size()) {
-        auto& cell = dp(i, j);
-        if (cell.direction == Direction::Down) {
-            update_hunk(i, j, cell.direction);
-            ++j;
-        } else if (cell.direction == Direction::Right) {
-            update_hunk(i, j, cell.direction);
+    while (i < old_pieces.size() || j < new_pieces.size()) {
+        if (i < old_pieces.size() && !old_matched[i]) {
+            start_hunk_if_needed(i, j);
+            cur_hunk.removed_lines.append(old_pieces[i]);
             ++i;
+        } else if (j < new_pieces.size() && !new_matched[j]) {
+            start_hunk_if_needed(i, j);
+            cur_hunk.added_lines.append(new_pieces[j]);
+            ++j;
         } else {
+            flush_hunk();
             ++i;
             ++j;
-            flush_hunk();
         }
     }
-
-    while (i < old_lines.size()) {
-        update_hunk(i, new_lines.is_empty() ? 0 : new_lines.size() - 1, Direction::Right); // Remove a line
-        ++i;
-    }
-    while (j < new_lines.size()) {
-        update_hunk(old_lines.is_empty() ? 0 : old_lines.size() - 1, j, Direction::Down); // Add a line
-        ++j;
-    }
-
     flush_hunk();
 
     return hunks;
@@ -10,6 +10,14 @@
 
 namespace Diff {
 
-Vector<Hunk> from_text(StringView old_text, StringView new_text);
+enum class Granularity {
+    Line,
+    // Diffs whitespace-separated tokens instead of lines, which gives tighter
+    // hunks for prose and for long lines with small edits. Hunk "lines" and
+    // line numbers are then tokens and token indices.
+    Token,
+};
+
+Vector<Hunk> from_text(StringView old_text, StringView new_text, Granularity = Granularity::Line);
 
 }
@@ -437,30 +437,58 @@ void DynamicLoader::load_program_headers()
         auto* data_segment_address = (u8*)reservation + ph_data_base - ph_load_base;
         size_t data_segment_size = ph_data_end - ph_data_base;
 
-        // Finally, we make an anonymous mapping for the data segment. Contents are then copied from the file.
-        auto* data_segment = (u8*)mmap_with_name(
-            data_segment_address,
-            data_segment_size,
-            PROT_READ | PROT_WRITE,
-            MAP_ANONYMOUS | MAP_PRIVATE | MAP_FIXED,
-            0,
-            0,
-            DeprecatedString::formatted("{}: .data", m_filepath).characters());
-
-        if (MAP_FAILED == data_segment) {
-            perror("mmap writable");
-            VERIFY_NOT_REACHED();
-        }
-
         VirtualAddress data_segment_start;
         if (image().is_dynamic())
             data_segment_start = VirtualAddress { (u8*)reservation + region.desired_load_address().get() };
         else
             data_segment_start = region.desired_load_address();
 
-        VERIFY(data_segment_start.as_ptr() + region.size_in_memory() <= data_segment + data_segment_size);
+        // Finally, we map the data segment copy-on-write from the file instead of copying it
+        // eagerly into anonymous pages: clean pages stay shared with the page cache (and with
+        // every other process that loaded this library), and only pages that relocations or
+        // the program actually write to get copied.
+        FlatPtr file_backed_size = round_up_to_power_of_two(region.desired_load_address().get() + region.size_in_image() - ph_data_base, PAGE_SIZE);
+        if (file_backed_size > 0) {
+            auto* data_segment = (u8*)mmap_with_name(
+                data_segment_address,
+                file_backed_size,
+                PROT_READ | PROT_WRITE,
+                MAP_FILE | MAP_PRIVATE | MAP_FIXED,
+                m_image_fd,
+                VirtualAddress { region.offset() }.page_base().get(),
+                DeprecatedString::formatted("{}: .data", m_filepath).characters());
+
+            if (MAP_FAILED == data_segment) {
+                perror("mmap writable");
+                VERIFY_NOT_REACHED();
+            }
+        }
+
+        // The remainder of the segment is .bss, for which the file provides no bytes.
+        if (data_segment_size > file_backed_size) {
+            auto* bss_segment = (u8*)mmap_with_name(
+                data_segment_address + file_backed_size,
+                data_segment_size - file_backed_size,
+                PROT_READ | PROT_WRITE,
+                MAP_ANONYMOUS | MAP_PRIVATE | MAP_FIXED,
+                0,
+                0,
+                DeprecatedString::formatted("{}: .bss", m_filepath).characters());
+
+            if (MAP_FAILED == bss_segment) {
+                perror("mmap bss");
+                VERIFY_NOT_REACHED();
+            }
+        }
+
+        VERIFY(data_segment_start.as_ptr() + region.size_in_memory() <= data_segment_address + data_segment_size);
 
-        memcpy(data_segment_start.as_ptr(), (u8*)m_file_data + region.offset(), region.size_in_image());
+        // Where .bss starts in the middle of the last file-backed page, the file contains
+        // unrelated bytes, but the ELF spec requires zeros.
+        auto* in_page_bss_start = data_segment_start.as_ptr() + region.size_in_image();
+        auto* file_backed_end = data_segment_address + file_backed_size;
+        if (file_backed_end > in_page_bss_start)
+            memset(in_page_bss_start, 0, file_backed_end - in_page_bss_start);
     }
 }
 
@@ -388,7 +388,8 @@ private:
 template<IteratorFunction<DynamicObject::Relocation&> F>
 inline void DynamicObject::RelocationSection::for_each_relocation(F func) const
 {
-    for (unsigned i = 0; i < relocation_count(); ++i) {
+    auto const count = relocation_count();
+    for (unsigned i = 0; i < count; ++i) {
         auto const reloc = relocation(i);
         if (reloc.type() == 0)
             continue;
@@ -196,6 +196,15 @@ void GLContext::gl_draw_elements(GLenum mode, GLsizei count, GLenum type, void c
         index_data = m_element_array_buffer->offset_data(data_offset);
     }
 
+    // The vertex assembled for a given index is identical for the duration of the draw call:
+    // the arrays cannot change mid-draw, and attributes whose array is disabled keep their
+    // current value throughout. So assemble each unique index only once and reuse the result
+    // for repeated indices, which models with shared vertices hit constantly.
+    // While recording a display list, every attribute call has to be recorded individually,
+    // so the cache is bypassed there.
+    HashMap<int, GPU::Vertex> assembled_vertices;
+    bool const reuse_assembled_vertices = !should_append_to_listing() && m_client_side_vertex_array_enabled;
+
     gl_begin(mode);
     for (int index = 0; index < count; index++) {
         int i = 0;
@@ -211,6 +220,13 @@ void GLContext::gl_draw_elements(GLenum mode, GLsizei count, GLenum type, void c
             break;
         }
 
+        if (reuse_assembled_vertices) {
+            if (auto assembled_vertex = assembled_vertices.get(i); assembled_vertex.has_value()) {
+                m_vertex_list.append(assembled_vertex.release_value());
+                continue;
+            }
+        }
+
         if (m_client_side_color_array_enabled) {
             float color[4] { 0.f, 0.f, 0.f, 1.f };
             read_from_vertex_attribute_pointer(m_client_color_pointer, i, color);
@@ -235,6 +251,9 @@ void GLContext::gl_draw_elements(GLenum mode, GLsizei count, GLenum type, void c
             float vertex[4] { 0.f, 0.f, 0.f, 1.f };
             read_from_vertex_attribute_pointer(m_client_vertex_pointer, i, vertex);
             gl_vertex(vertex[0], vertex[1], vertex[2], vertex[3]);
+
+            if (reuse_assembled_vertices)
+                assembled_vertices.set(i, m_vertex_list.last());
         }
     }
     gl_end();
@@ -94,6 +94,20 @@ void AbstractTableView::update_column_sizes()
     int column_count = model.column_count();
     int row_count = model.row_count();
 
+    // Only measure the rows in and around the visible range. Measuring a cell
+    // materializes and formats its data, so walking the whole model here made
+    // every model update scale with the total row count. Column widths only
+    // ever grow (see the max() below), so rows scrolled into view that need
+    // more space get it on the next model update.
+    constexpr int measurement_margin_rows = 50;
+    int first_row = 0;
+    int last_row = row_count - 1;
+    if (row_height() > 0) {
+        auto visible_rect = visible_content_rect();
+        first_row = max(0, visible_rect.top() / row_height() - measurement_margin_rows);
+        last_row = min(row_count - 1, visible_rect.bottom() / row_height() + measurement_margin_rows);
+    }
+
     for (int column = 0; column < column_count; ++column) {
         if (!column_header().is_section_visible(column))
             continue;
@@ -101,7 +115,7 @@ void AbstractTableView::update_column_sizes()
         if (column == m_key_column && model.is_column_sortable(column))
             header_width += HeaderView::sorting_arrow_width + HeaderView::sorting_arrow_offset;
         int column_width = header_width;
-        for (int row = 0; row < row_count; ++row) {
+        for (int row = first_row; row <= last_row; ++row) {
             auto cell_data = model.index(row, column).data();
             int cell_width = 0;
             if (cell_data.is_icon()) {
@@ -123,6 +137,10 @@ void AbstractTableView::update_row_sizes()
     if (!model())
         return;
 
+    // No point in sizing sections of a header nobody can see.
+    if (!row_header().is_visible())
+        return;
+
     auto& model = *this->model();
     int row_count = model.row_count();
 
@@ -399,6 +417,9 @@ void AbstractTableView::did_scroll()
 {
     AbstractView::did_scroll();
     layout_headers();
+    // Since update_column_sizes() only measures rows near the visible range,
+    // re-measure here so rows scrolled into view can widen their columns.
+    update_column_sizes();
 }
 
 void AbstractTableView::layout_headers()
@@ -68,6 +68,15 @@ Clipboard::DataAndType Clipboard::fetch_data_and_type() const
     return { data.release_value(), type, metadata };
 }
 
+DeprecatedString Clipboard::fetch_mime_type() const
+{
+    // Ask for just the mime type instead of fetch_data_and_type(), which would
+    // transfer and copy the whole payload only to throw it away. This runs on
+    // every "can we paste?" menu update, and the clipboard may well hold a
+    // large image.
+    return connection().get_clipboard_mime_type();
+}
+
 RefPtr<Gfx::Bitmap> Clipboard::DataAndType::as_bitmap() const
 {
     if (mime_type != "image/x-serenityos")
@@ -40,7 +40,7 @@ public:
     static Clipboard& the();
 
     DataAndType fetch_data_and_type() const;
-    DeprecatedString fetch_mime_type() const { return fetch_data_and_type().mime_type; }
+    DeprecatedString fetch_mime_type() const;
 
     void set_data(ReadonlyBytes data, DeprecatedString const& mime_type = "text/plain", HashMap<DeprecatedString, DeprecatedString> const& metadata = {});
     void set_plain_text(DeprecatedString const& text) { set_data(text.bytes()); }
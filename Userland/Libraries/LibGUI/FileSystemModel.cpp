@@ -10,14 +10,19 @@
 #include <AK/NumberFormat.h>
 #include <AK/QuickSort.h>
 #include <AK/StringBuilder.h>
+#include <AK/StringHash.h>
 #include <LibCore/DirIterator.h>
+#include <LibCore/Directory.h>
 #include <LibCore/File.h>
 #include <LibCore/StandardPaths.h>
+#include <LibCore/Stream.h>
+#include <LibCore/System.h>
 #include <LibGUI/AbstractView.h>
 #include <LibGUI/FileIconProvider.h>
 #include <LibGUI/FileSystemModel.h>
 #include <LibGUI/Painter.h>
 #include <LibGfx/Bitmap.h>
+#include <LibGfx/QOIWriter.h>
 #include <LibThreading/BackgroundAction.h>
 #include <grp.h>
 #include <pwd.h>
@@ -631,8 +636,34 @@ Icon FileSystemModel::icon_for(Node const& node) const
 
 static HashMap<DeprecatedString, RefPtr<Gfx::Bitmap>> s_thumbnail_cache;
 
+static ErrorOr<DeprecatedString> thumbnail_cache_path_for(StringView path)
+{
+    auto stat = TRY(Core::System::stat(path));
+    // Two independently seeded hashes of the path keep the file name short while
+    // making collisions unlikely enough for a thumbnail cache; mtime and size
+    // in the name invalidate the entry when the image changes.
+    auto path_hash_hi = string_hash(path.characters_without_null_termination(), path.length(), 0x9e3779b9);
+    auto path_hash_lo = string_hash(path.characters_without_null_termination(), path.length(), 0x85ebca6b);
+    return DeprecatedString::formatted("{}/thumbnails/{:08x}{:08x}-{}-{}.qoi", Core::StandardPaths::cache_directory(), path_hash_hi, path_hash_lo, stat.st_mtime, stat.st_size);
+}
+
+static ErrorOr<void> save_thumbnail(DeprecatedString const& cache_path, Gfx::Bitmap const& thumbnail)
+{
+    TRY(Core::Directory::create(LexicalPath(cache_path).parent(), Core::Directory::CreateDirectories::Yes));
+    auto encoded = Gfx::QOIWriter::encode(thumbnail);
+    auto file = TRY(Core::Stream::File::open(cache_path, Core::Stream::OpenMode::Write));
+    TRY(file->write_entire_buffer(encoded));
+    return {};
+}
+
 static ErrorOr<NonnullRefPtr<Gfx::Bitmap>> render_thumbnail(StringView path)
 {
+    auto cache_path_or_error = thumbnail_cache_path_for(path);
+    if (!cache_path_or_error.is_error()) {
+        if (auto cached = Gfx::Bitmap::try_load_from_file(cache_path_or_error.value()); !cached.is_error())
+            return cached.release_value();
+    }
+
     auto bitmap = TRY(Gfx::Bitmap::try_load_from_file(path));
     auto thumbnail = TRY(Gfx::Bitmap::try_create(Gfx::BitmapFormat::BGRA8888, { 32, 32 }));
 
@@ -641,6 +672,13 @@ static ErrorOr<NonnullRefPtr<Gfx::Bitmap>> render_thumbnail(StringView path)
 
     Painter painter(thumbnail);
     painter.draw_scaled_bitmap(destination, *bitmap, bitmap->rect());
+
+    // Failing to persist the thumbnail just means we re-render it next time.
+    if (!cache_path_or_error.is_error()) {
+        if (auto result = save_thumbnail(cache_path_or_error.value(), *thumbnail); result.is_error())
+            dbgln("Failed to cache thumbnail for {}: {}", path, result.error());
+    }
+
     return thumbnail;
 }
 
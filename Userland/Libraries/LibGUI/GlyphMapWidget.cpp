@@ -66,6 +66,8 @@ void GlyphMapWidget::set_active_glyph(int glyph, ShouldResetSelection should_res
 {
     if (m_active_glyph == glyph && should_reset_selection == ShouldResetSelection::No)
         return;
+    auto old_selection = m_selection.normalized();
+    int old_active_glyph = m_active_glyph;
     m_active_glyph = glyph;
     if (should_reset_selection == ShouldResetSelection::Yes) {
         m_selection.set_start(glyph);
@@ -73,7 +75,14 @@ void GlyphMapWidget::set_active_glyph(int glyph, ShouldResetSelection should_res
     }
     if (on_active_glyph_changed)
         on_active_glyph_changed(glyph);
-    update();
+
+    // Only cells between the old and new active glyph (and within the old
+    // selection, in case it was reset or extended before we were called) can
+    // have changed appearance; repainting the whole map here would redraw
+    // megapixels on every arrow key with large fonts.
+    int first_changed = min(min(old_active_glyph, glyph), old_selection.start());
+    int last_changed = max(max(old_active_glyph, glyph), old_selection.start() + old_selection.size() - 1);
+    update_glyph_range(first_changed, last_changed);
 }
 
 void GlyphMapWidget::set_selection(int start, int size, Optional<u32> active_glyph)
@@ -115,6 +124,26 @@ void GlyphMapWidget::update_glyph(int glyph)
     update(get_outer_rect(glyph));
 }
 
+void GlyphMapWidget::update_glyph_range(int first_glyph, int last_glyph)
+{
+    first_glyph = clamp(first_glyph, static_cast<int>(m_active_range.first), static_cast<int>(m_active_range.last));
+    last_glyph = clamp(last_glyph, static_cast<int>(m_active_range.first), static_cast<int>(m_active_range.last));
+
+    auto first_rect = get_outer_rect(first_glyph);
+    auto last_rect = get_outer_rect(last_glyph);
+    if (first_rect.y() == last_rect.y()) {
+        update(first_rect.united(last_rect));
+        return;
+    }
+
+    // The range spans multiple rows, so it wraps around the row ends;
+    // invalidate the affected rows edge to edge.
+    update({ widget_inner_rect().x(),
+        first_rect.y(),
+        widget_inner_rect().width(),
+        last_rect.bottom() - first_rect.y() + 1 });
+}
+
 void GlyphMapWidget::paint_event(PaintEvent& event)
 {
     Frame::paint_event(event);
@@ -132,6 +161,10 @@ void GlyphMapWidget::paint_event(PaintEvent& event)
 
     for (u32 glyph = first_glyph; glyph <= first_glyph + m_visible_glyphs && glyph <= last_glyph; ++glyph) {
         Gfx::IntRect outer_rect = get_outer_rect(glyph);
+        // Cells outside the damage rect would be clipped away anyway; skip
+        // them early so a single-glyph update only repaints that one cell.
+        if (!outer_rect.intersects(event.rect()))
+            continue;
         Gfx::IntRect inner_rect(
             outer_rect.x() + m_horizontal_spacing / 2,
             outer_rect.y() + m_vertical_spacing / 2,
@@ -249,7 +282,6 @@ void GlyphMapWidget::mousemove_event(GUI::MouseEvent& event)
         m_selection.extend_to(glyph);
         set_active_glyph(glyph, ShouldResetSelection::No);
         scroll_to_glyph(glyph);
-        update();
     }
 }
 
@@ -263,7 +295,6 @@ void GlyphMapWidget::automatic_scrolling_timer_did_fire()
     m_selection.extend_to(glyph);
     set_active_glyph(glyph, ShouldResetSelection::No);
     scroll_to_glyph(glyph);
-    update();
 }
 
 void GlyphMapWidget::doubleclick_event(MouseEvent& event)
@@ -62,6 +62,7 @@ public:
 
     void scroll_to_glyph(int);
     void update_glyph(int);
+    void update_glyph_range(int first_glyph, int last_glyph);
 
     void set_highlight_modifications(bool);
     void set_show_system_emoji(bool);
@@ -39,12 +39,13 @@ bool IniSyntaxHighlighter::is_identifier(u64 token) const
 
 void IniSyntaxHighlighter::rehighlight(Palette const& palette)
 {
-    auto text = m_client->get_text();
-    IniLexer lexer(text);
-    auto tokens = lexer.lex();
+    rehighlight_using_line_checkpoints(palette);
+}
 
-    Vector<GUI::TextDocumentSpan> spans;
-    for (auto& token : tokens) {
+Syntax::Highlighter::LexerState IniSyntaxHighlighter::lex_line(StringView line, LexerState, Palette const& palette, Vector<GUI::TextDocumentSpan>& spans)
+{
+    IniLexer lexer(line);
+    for (auto& token : lexer.lex()) {
         GUI::TextDocumentSpan span;
         span.range.set_start({ token.m_start.line, token.m_start.column });
         span.range.set_end({ token.m_end.line, token.m_end.column });
@@ -55,12 +56,8 @@ void IniSyntaxHighlighter::rehighlight(Palette const& palette)
         span.data = static_cast<u64>(token.m_type);
         spans.append(span);
     }
-    m_client->do_set_spans(move(spans));
-
-    m_has_brace_buddies = false;
-    highlight_matching_token_pair();
-
-    m_client->do_update();
+    // No INI construct continues across a newline.
+    return initial_lexer_state;
 }
 
 Vector<IniSyntaxHighlighter::MatchingTokenPair> IniSyntaxHighlighter::matching_token_pairs_impl() const
@@ -24,6 +24,7 @@ public:
     virtual void rehighlight(Palette const&) override;
 
 protected:
+    virtual LexerState lex_line(StringView, LexerState, Palette const&, Vector<GUI::TextDocumentSpan>&) override;
     virtual Vector<MatchingTokenPair> matching_token_pairs_impl() const override;
     virtual bool token_types_equal(u64, u64) const override;
 };
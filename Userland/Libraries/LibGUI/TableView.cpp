@@ -62,38 +62,72 @@ void TableView::paint_event(PaintEvent& event)
 
     int painted_item_index = first_visible_row;
 
+    auto row_colors = [&](int row_index, int item_index) {
+        struct {
+            Color background;
+            Color key_column;
+        } colors;
+        if (selection().contains_row(row_index) && highlight_selected_rows()) {
+            colors.background = selection_color;
+            colors.key_column = selection_color;
+        } else if (alternating_row_colors() && (item_index % 2)) {
+            colors.background = widget_background_color.darkened(0.8f);
+            colors.key_column = widget_background_color.darkened(0.7f);
+        } else {
+            colors.background = widget_background_color;
+            colors.key_column = widget_background_color.darkened(0.9f);
+        }
+        return colors;
+    };
+
+    // OPTIMIZATION: Batch all row and key-column background fills into a single
+    //               fill_rects() call. They are disjoint per row and always painted
+    //               beneath that row's own cells, so hoisting them before the cell
+    //               loop doesn't change the output, and large tables avoid re-doing
+    //               the per-call Painter setup for every row.
+    int key_column_fill_x = -1;
+    int key_column_fill_width = 0;
+    if (is_key_column_highlighted() && m_key_column != -1) {
+        int x = x_offset;
+        for (int column_index = 0; column_index < model()->column_count(); ++column_index) {
+            if (!column_header().is_section_visible(column_index))
+                continue;
+            int column_width = this->column_width(column_index);
+            if (column_index == m_key_column) {
+                key_column_fill_x = horizontal_padding() + x;
+                key_column_fill_width = column_width;
+                break;
+            }
+            x += column_width + horizontal_padding() * 2;
+        }
+    }
+
+    Vector<Gfx::Painter::FillRectSpec, 128> background_fills;
+    for (int row_index = first_visible_row, item_index = first_visible_row; row_index <= last_visible_row; ++row_index, ++item_index) {
+        auto colors = row_colors(row_index, item_index);
+        background_fills.append({ this->row_rect(item_index), colors.background });
+        if (key_column_fill_x != -1) {
+            Gfx::IntRect key_column_cell_rect(key_column_fill_x, y_offset + item_index * row_height(), key_column_fill_width, row_height());
+            background_fills.append({ key_column_cell_rect.inflated(horizontal_padding() * 2, 0), colors.key_column });
+        }
+    }
+    painter.fill_rects(background_fills.span());
+
     for (int row_index = first_visible_row; row_index <= last_visible_row; ++row_index) {
         bool is_selected_row = selection().contains_row(row_index);
         int y = y_offset + painted_item_index * row_height();
 
-        Color background_color;
-        Color key_column_background_color;
-        if (is_selected_row && highlight_selected_rows()) {
-            background_color = selection_color;
-            key_column_background_color = selection_color;
-        } else {
-            if (alternating_row_colors() && (painted_item_index % 2)) {
-                background_color = widget_background_color.darkened(0.8f);
-                key_column_background_color = widget_background_color.darkened(0.7f);
-            } else {
-                background_color = widget_background_color;
-                key_column_background_color = widget_background_color.darkened(0.9f);
-            }
-        }
+        Color background_color = row_colors(row_index, painted_item_index).background;
 
         auto row_rect = this->row_rect(painted_item_index);
-        painter.fill_rect(row_rect, background_color);
 
         int x = x_offset;
         for (int column_index = 0; column_index < model()->column_count(); ++column_index) {
             if (!column_header().is_section_visible(column_index))
                 continue;
             int column_width = this->column_width(column_index);
-            bool is_key_column = m_key_column == column_index;
             Gfx::IntRect cell_rect(horizontal_padding() + x, y, column_width, row_height());
             auto cell_rect_for_fill = cell_rect.inflated(horizontal_padding() * 2, 0);
-            if (is_key_column && is_key_column_highlighted())
-                painter.fill_rect(cell_rect_for_fill, key_column_background_color);
             auto cell_index = model()->index(row_index, column_index);
 
             auto* delegate = column_painting_delegate(column_index);
@@ -2157,6 +2157,14 @@ void TextEditor::force_rehighlight()
     m_needs_rehighlight = false;
 }
 
+Optional<TextRange> TextEditor::highlighter_did_request_visible_range() const
+{
+    auto rect = visible_content_rect();
+    auto first_position = text_position_at_content_position(rect.top_left());
+    auto last_position = text_position_at_content_position({ rect.left(), rect.bottom() });
+    return TextRange { first_position, last_position };
+}
+
 Syntax::Highlighter const* TextEditor::syntax_highlighter() const
 {
     return m_highlighter.ptr();
@@ -298,6 +298,7 @@ private:
     virtual DeprecatedString highlighter_did_request_text() const final { return text(); }
     virtual GUI::TextDocument& highlighter_did_request_document() final { return document(); }
     virtual GUI::TextPosition highlighter_did_request_cursor() const final { return m_cursor; }
+    virtual Optional<TextRange> highlighter_did_request_visible_range() const final;
 
     // ^Clipboard::ClipboardClient
     virtual void clipboard_content_did_change(DeprecatedString const& mime_type) override;
@@ -422,7 +422,10 @@ void Widget::set_layout(NonnullRefPtr<Layout> layout)
     if (m_layout) {
         add_child(*m_layout);
         m_layout->notify_adopted({}, *this);
-        do_layout();
+        // Note: Don't run the layout synchronously here; building a dialog
+        // sets a layout on every container, and a recursive pass per call adds
+        // up fast. layout_relevant_change_occurred() below schedules a single
+        // deferred pass instead, and windows lay out on show() anyway.
     } else {
         update();
     }
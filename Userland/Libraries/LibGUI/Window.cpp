@@ -777,6 +777,16 @@ void Window::update(Gfx::IntRect const& a_rect)
         }
     }
 
+    // Conversely, pending rects covered by the new rect are now redundant.
+    // This keeps the list small when a parent widget invalidates itself after
+    // its children already queued their own smaller rects.
+    m_pending_paint_event_rects.remove_all_matching([&](auto& pending_rect) {
+        if (!a_rect.contains(pending_rect))
+            return false;
+        dbgln_if(UPDATE_COALESCING_DEBUG, "Dropping pending rect {} since it's contained by {}", pending_rect, a_rect);
+        return true;
+    });
+
     if (m_pending_paint_event_rects.is_empty()) {
         deferred_invoke([this] {
             auto rects = move(m_pending_paint_event_rects);
@@ -920,7 +930,10 @@ void Window::set_hovered_widget(Widget* widget)
 void Window::set_current_backing_store(WindowBackingStore& backing_store, bool flush_immediately) const
 {
     auto& bitmap = backing_store.bitmap();
-    ConnectionToWindowServer::the().set_window_backing_store(
+    // NOTE: This is asynchronous on purpose: WindowServer already holds a reference to
+    //       the previous backing store and swaps by serial, so there is nothing to wait
+    //       for here, and blocking would stall the client for a frame on every flip.
+    ConnectionToWindowServer::the().async_set_window_backing_store(
         m_window_id,
         32,
         bitmap.pitch(),
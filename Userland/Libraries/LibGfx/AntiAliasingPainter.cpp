@@ -215,6 +215,33 @@ void AntiAliasingPainter::draw_line(FloatPoint actual_from, FloatPoint actual_to
 
 void AntiAliasingPainter::fill_path(Path& path, Color color, Painter::WindingRule rule)
 {
+    // OPTIMIZATION: Tall fills are split into horizontal bands, each rasterized on its own
+    //               thread by a painter clipped to that band. The AA painter's transform
+    //               maps the path into device space, so the bands are computed there.
+    if (m_underlying_painter.scale() == 1 && m_underlying_painter.draw_op() == Painter::DrawOp::Copy) {
+        auto device_bounding_box = m_transform.map(path.bounding_box()).translated(m_underlying_painter.translation().to_type<float>());
+        auto bands = Detail::compute_fill_path_bands(m_underlying_painter.clip_rect(), path, device_bounding_box);
+        if (!bands.is_empty()) {
+            Vector<Painter, 8> band_painters;
+            band_painters.ensure_capacity(bands.size());
+            Vector<AntiAliasingPainter, 8> band_aa_painters;
+            band_aa_painters.ensure_capacity(bands.size());
+            for (auto const& band : bands) {
+                band_painters.append(m_underlying_painter);
+                auto& band_painter = band_painters.last();
+                band_painter.add_clip_rect(band.translated(-band_painter.translation()));
+                band_aa_painters.append(AntiAliasingPainter { band_painter });
+                band_aa_painters.last().m_transform = m_transform;
+            }
+            Threading::parallel_for_each_range(
+                band_aa_painters.size(), [&](size_t i) {
+                    Detail::fill_path<Detail::FillPathMode::AllowFloatingPoints>(band_aa_painters[i], path, color, rule);
+                },
+                1);
+            return;
+        }
+    }
+
     Detail::fill_path<Detail::FillPathMode::AllowFloatingPoints>(*this, path, color, rule);
 }
 
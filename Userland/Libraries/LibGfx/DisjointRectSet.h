@@ -221,6 +221,53 @@ public:
         return IterationDecision::Continue;
     }
 
+    // Tries to reduce the number of rects in this set without shrinking the covered
+    // area: exactly tiling neighbors (such as the shards that shatter() leaves behind
+    // when nearby rects get punched out of each other) are merged outright. If the set
+    // is still badly fragmented but covers most of its bounding box anyway, it is
+    // collapsed into the bounding box: at that point the per-rect bookkeeping costs
+    // more than processing the few extra pixels.
+    void coalesce()
+    {
+        if (m_rects.size() < 2)
+            return;
+
+        bool merged_any;
+        do {
+            merged_any = false;
+            for (size_t i = 0; i < m_rects.size() && !merged_any; ++i) {
+                for (size_t j = i + 1; j < m_rects.size(); ++j) {
+                    auto& r1 = m_rects[i];
+                    auto& r2 = m_rects[j];
+                    bool tile_horizontally = r1.top() == r2.top() && r1.height() == r2.height() && (r1.right() + 1 == r2.left() || r2.right() + 1 == r1.left());
+                    bool tile_vertically = r1.left() == r2.left() && r1.width() == r2.width() && (r1.bottom() + 1 == r2.top() || r2.bottom() + 1 == r1.top());
+                    if (!tile_horizontally && !tile_vertically)
+                        continue;
+                    r1 = r1.united(r2);
+                    m_rects.remove(j);
+                    merged_any = true;
+                    break;
+                }
+            }
+        } while (merged_any);
+
+        constexpr size_t maximum_rects_before_collapsing = 16;
+        if (m_rects.size() < maximum_rects_before_collapsing)
+            return;
+
+        Rect<T> bounding_rect;
+        T covered_area = 0;
+        for (auto& rect : m_rects) {
+            bounding_rect = bounding_rect.united(rect);
+            covered_area += rect.width() * rect.height();
+        }
+        auto bounding_area = bounding_rect.width() * bounding_rect.height();
+        if (bounding_area > 0 && covered_area >= bounding_area / 4 * 3) {
+            m_rects.clear_with_capacity();
+            m_rects.append(bounding_rect);
+        }
+    }
+
     bool is_empty() const { return m_rects.is_empty(); }
     size_t size() const { return m_rects.size(); }
 
@@ -11,9 +11,40 @@
 #include <LibGfx/Color.h>
 #include <LibGfx/Painter.h>
 #include <LibGfx/Path.h>
+#include <LibThreading/ThreadPool.h>
 
 namespace Gfx::Detail {
 
+// Decides whether a path fill is worth rasterizing in parallel, and if so, splits the
+// fill's device-space rect into horizontal bands, one per worker. Each band is then
+// rasterized by a painter whose clip is restricted to that band; since bands cover
+// disjoint scanline ranges, the workers never write to the same pixels.
+//
+// Materializing the path's lazily-computed segment list and bounding box here, while
+// still single-threaded, is what makes sharing the path between band workers safe.
+inline Vector<IntRect, 8> compute_fill_path_bands(IntRect const& physical_clip_rect, Path const& path, FloatRect const& device_bounding_box)
+{
+    constexpr int minimum_band_height = 64;
+
+    auto worker_count = Threading::ThreadPool::the().worker_count();
+    if (worker_count == 0)
+        return {};
+
+    if (path.split_lines().is_empty())
+        return {};
+
+    auto fill_rect = enclosing_int_rect(device_bounding_box).intersected(physical_clip_rect);
+    auto band_count = min(worker_count + 1, static_cast<size_t>(fill_rect.height() / minimum_band_height));
+    if (band_count < 2)
+        return {};
+
+    Vector<IntRect, 8> bands;
+    int const band_height = ceil_div(fill_rect.height(), static_cast<int>(band_count));
+    for (int y = fill_rect.top(); y <= fill_rect.bottom(); y += band_height)
+        bands.append({ fill_rect.x(), y, fill_rect.width(), min(band_height, fill_rect.bottom() - y + 1) });
+    return bands;
+}
+
 [[maybe_unused]] inline void approximately_place_on_int_grid(FloatPoint ffrom, FloatPoint fto, IntPoint& from, IntPoint& to, Optional<IntPoint> previous_to)
 {
     auto diffs = fto - ffrom;
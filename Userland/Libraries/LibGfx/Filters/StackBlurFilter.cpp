@@ -12,6 +12,7 @@
 #include <AK/Array.h>
 #include <AK/IntegralMath.h>
 #include <AK/Math.h>
+#include <AK/SIMD.h>
 #include <AK/Vector.h>
 #include <LibGfx/Filters/StackBlurFilter.h>
 
@@ -95,6 +96,19 @@ private:
     Vector<Color, 512> m_data;
 };
 
+// OPTIMIZATION: The blur runs the exact same running-sum arithmetic on all four color
+//               channels, so each (red, green, blue, alpha) quadruple is kept in one
+//               4-lane vector and updated with a single vector operation.
+ALWAYS_INLINE static AK::SIMD::u32x4 expand_color(Color color)
+{
+    return AK::SIMD::u32x4 { color.red(), color.green(), color.blue(), color.alpha() };
+}
+
+ALWAYS_INLINE static Color shrink_color(AK::SIMD::u32x4 color)
+{
+    return Color(color[0], color[1], color[2], color[3]);
+}
+
 // This is an implementation of StackBlur by Mario Klingemann (https://observablehq.com/@jobleonard/mario-klingemans-stackblur)
 // (Link is to a secondary source as the original site is now down)
 FLATTEN void StackBlurFilter::process_rgba(u8 radius, Color fill_color)
@@ -140,34 +154,18 @@ FLATTEN void StackBlurFilter::process_rgba(u8 radius, Color fill_color)
             *(stack_iterator++) = color;
 
         // All the sums here work to approximate a gaussian.
-        // Note: Only about 17 bits are actually used in each sum.
-        uint red_in_sum = 0;
-        uint green_in_sum = 0;
-        uint blue_in_sum = 0;
-        uint alpha_in_sum = 0;
-        uint red_out_sum = radius_plus_1 * color.red();
-        uint green_out_sum = radius_plus_1 * color.green();
-        uint blue_out_sum = radius_plus_1 * color.blue();
-        uint alpha_out_sum = radius_plus_1 * color.alpha();
-        uint red_sum = sum_factor * color.red();
-        uint green_sum = sum_factor * color.green();
-        uint blue_sum = sum_factor * color.blue();
-        uint alpha_sum = sum_factor * color.alpha();
+        // Note: Only about 17 bits are actually used in each sum (lane).
+        AK::SIMD::u32x4 in_sum {};
+        auto out_sum = radius_plus_1 * expand_color(color);
+        auto sum = sum_factor * expand_color(color);
 
         for (uint i = 1; i <= radius; i++) {
             auto color = get_pixel(min(i, width - 1), y);
+            auto channels = expand_color(color);
 
-            auto bias = radius_plus_1 - i;
             *stack_iterator = color;
-            red_sum += color.red() * bias;
-            green_sum += color.green() * bias;
-            blue_sum += color.blue() * bias;
-            alpha_sum += color.alpha() * bias;
-
-            red_in_sum += color.red();
-            green_in_sum += color.green();
-            blue_in_sum += color.blue();
-            alpha_in_sum += color.alpha();
+            sum += channels * (radius_plus_1 - i);
+            in_sum += channels;
 
             ++stack_iterator;
         }
@@ -176,46 +174,25 @@ FLATTEN void StackBlurFilter::process_rgba(u8 radius, Color fill_color)
         auto stack_out_iterator = stack_end;
 
         for (uint x = 0; x < width; x++) {
-            auto alpha = (alpha_sum * sum_mult) >> sum_shift;
-            if (alpha != 0)
-                set_pixel(x, y, Color((red_sum * sum_mult) >> sum_shift, (green_sum * sum_mult) >> sum_shift, (blue_sum * sum_mult) >> sum_shift, alpha));
+            auto blurred = (sum * sum_mult) >> sum_shift;
+            if (blurred[3] != 0)
+                set_pixel(x, y, shrink_color(blurred));
             else
                 set_pixel(x, y, fill_color);
 
-            red_sum -= red_out_sum;
-            green_sum -= green_out_sum;
-            blue_sum -= blue_out_sum;
-            alpha_sum -= alpha_out_sum;
-
-            red_out_sum -= stack_in_iterator->red();
-            green_out_sum -= stack_in_iterator->green();
-            blue_out_sum -= stack_in_iterator->blue();
-            alpha_out_sum -= stack_in_iterator->alpha();
+            sum -= out_sum;
+            out_sum -= expand_color(*stack_in_iterator);
 
             auto color = get_pixel(min(x + radius_plus_1, width - 1), y);
             *stack_in_iterator = color;
-            red_in_sum += color.red();
-            green_in_sum += color.green();
-            blue_in_sum += color.blue();
-            alpha_in_sum += color.alpha();
-
-            red_sum += red_in_sum;
-            green_sum += green_in_sum;
-            blue_sum += blue_in_sum;
-            alpha_sum += alpha_in_sum;
+            in_sum += expand_color(color);
+            sum += in_sum;
 
             ++stack_in_iterator;
 
-            color = *stack_out_iterator;
-            red_out_sum += color.red();
-            green_out_sum += color.green();
-            blue_out_sum += color.blue();
-            alpha_out_sum += color.alpha();
-
-            red_in_sum -= color.red();
-            green_in_sum -= color.green();
-            blue_in_sum -= color.blue();
-            alpha_in_sum -= color.alpha();
+            auto channels = expand_color(*stack_out_iterator);
+            out_sum += channels;
+            in_sum -= channels;
 
             ++stack_out_iterator;
         }
@@ -228,33 +205,17 @@ FLATTEN void StackBlurFilter::process_rgba(u8 radius, Color fill_color)
         for (uint i = 0; i < radius_plus_1; i++)
             *(stack_iterator++) = color;
 
-        uint red_in_sum = 0;
-        uint green_in_sum = 0;
-        uint blue_in_sum = 0;
-        uint alpha_in_sum = 0;
-        uint red_out_sum = radius_plus_1 * color.red();
-        uint green_out_sum = radius_plus_1 * color.green();
-        uint blue_out_sum = radius_plus_1 * color.blue();
-        uint alpha_out_sum = radius_plus_1 * color.alpha();
-        uint red_sum = sum_factor * color.red();
-        uint green_sum = sum_factor * color.green();
-        uint blue_sum = sum_factor * color.blue();
-        uint alpha_sum = sum_factor * color.alpha();
+        AK::SIMD::u32x4 in_sum {};
+        auto out_sum = radius_plus_1 * expand_color(color);
+        auto sum = sum_factor * expand_color(color);
 
         for (uint i = 1; i <= radius; i++) {
             auto color = get_pixel(x, min(i, height - 1));
+            auto channels = expand_color(color);
 
-            auto bias = radius_plus_1 - i;
             *stack_iterator = color;
-            red_sum += color.red() * bias;
-            green_sum += color.green() * bias;
-            blue_sum += color.blue() * bias;
-            alpha_sum += color.alpha() * bias;
-
-            red_in_sum += color.red();
-            green_in_sum += color.green();
-            blue_in_sum += color.blue();
-            alpha_in_sum += color.alpha();
+            sum += channels * (radius_plus_1 - i);
+            in_sum += channels;
 
             ++stack_iterator;
         }
@@ -263,46 +224,25 @@ FLATTEN void StackBlurFilter::process_rgba(u8 radius, Color fill_color)
         auto stack_out_iterator = stack_end;
 
         for (uint y = 0; y < height; y++) {
-            auto alpha = (alpha_sum * sum_mult) >> sum_shift;
-            if (alpha != 0)
-                set_pixel(x, y, Color((red_sum * sum_mult) >> sum_shift, (green_sum * sum_mult) >> sum_shift, (blue_sum * sum_mult) >> sum_shift, alpha));
+            auto blurred = (sum * sum_mult) >> sum_shift;
+            if (blurred[3] != 0)
+                set_pixel(x, y, shrink_color(blurred));
             else
                 set_pixel(x, y, fill_color);
 
-            red_sum -= red_out_sum;
-            green_sum -= green_out_sum;
-            blue_sum -= blue_out_sum;
-            alpha_sum -= alpha_out_sum;
-
-            red_out_sum -= stack_in_iterator->red();
-            green_out_sum -= stack_in_iterator->green();
-            blue_out_sum -= stack_in_iterator->blue();
-            alpha_out_sum -= stack_in_iterator->alpha();
+            sum -= out_sum;
+            out_sum -= expand_color(*stack_in_iterator);
 
             auto color = get_pixel(x, min(y + radius_plus_1, height - 1));
             *stack_in_iterator = color;
-            red_in_sum += color.red();
-            green_in_sum += color.green();
-            blue_in_sum += color.blue();
-            alpha_in_sum += color.alpha();
-
-            red_sum += red_in_sum;
-            green_sum += green_in_sum;
-            blue_sum += blue_in_sum;
-            alpha_sum += alpha_in_sum;
+            in_sum += expand_color(color);
+            sum += in_sum;
 
             ++stack_in_iterator;
 
-            color = *stack_out_iterator;
-            red_out_sum += color.red();
-            green_out_sum += color.green();
-            blue_out_sum += color.blue();
-            alpha_out_sum += color.alpha();
-
-            red_in_sum -= color.red();
-            green_in_sum -= color.green();
-            blue_in_sum -= color.blue();
-            alpha_in_sum -= color.alpha();
+            auto channels = expand_color(*stack_out_iterator);
+            out_sum += channels;
+            in_sum -= channels;
 
             ++stack_out_iterator;
         }
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibGfx/Font/GlyphBitmapCache.h>
+
+namespace Gfx {
+
+GlyphBitmapCache& GlyphBitmapCache::the()
+{
+    static GlyphBitmapCache s_the;
+    return s_the;
+}
+
+Optional<RefPtr<Bitmap>> GlyphBitmapCache::get(GlyphBitmapCacheKey const& key)
+{
+    if (auto it = m_current_generation.find(key); it != m_current_generation.end())
+        return it->value;
+
+    if (auto it = m_previous_generation.find(key); it != m_previous_generation.end()) {
+        // Promote the entry so it survives the previous generation being dropped.
+        auto bitmap = it->value;
+        if (bitmap)
+            m_current_generation_bytes += bitmap->size_in_bytes();
+        m_current_generation.set(key, bitmap);
+        return bitmap;
+    }
+
+    return {};
+}
+
+void GlyphBitmapCache::set(GlyphBitmapCacheKey const& key, RefPtr<Bitmap> bitmap)
+{
+    if (bitmap)
+        m_current_generation_bytes += bitmap->size_in_bytes();
+    m_current_generation.set(key, move(bitmap));
+
+    if (m_current_generation_bytes > maximum_bytes_per_generation) {
+        m_previous_generation = move(m_current_generation);
+        m_current_generation.clear();
+        m_current_generation_bytes = 0;
+    }
+}
+
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <LibGfx/Bitmap.h>
+#include <LibGfx/Font/Font.h>
+#include <LibGfx/Font/VectorFont.h>
+
+namespace Gfx {
+
+struct GlyphBitmapCacheKey {
+    RefPtr<VectorFont const> font;
+    float x_scale { 0 };
+    float y_scale { 0 };
+    u32 glyph_id { 0 };
+    GlyphSubpixelOffset subpixel_offset { 0, 0 };
+
+    bool operator==(GlyphBitmapCacheKey const&) const = default;
+};
+
+// Process-wide cache of rasterized vector glyphs. Typeface::get_font() creates a fresh
+// ScaledFont for every request, so a cache that lives inside ScaledFont gets thrown away
+// all the time; keying on the underlying VectorFont (plus scale, glyph and subpixel
+// offset) keeps rasterizations alive across ScaledFont and Painter lifetimes.
+//
+// Eviction is generational: once the newest generation exceeds its byte budget it
+// becomes the previous generation, and whatever was in the old previous generation (the
+// entries that have not been touched for a whole generation) is dropped.
+class GlyphBitmapCache {
+public:
+    static GlyphBitmapCache& the();
+
+    // NOTE: Glyphs that fail to rasterize are cached as null bitmaps, so "not cached"
+    //       and "cached as null" are distinct results here.
+    Optional<RefPtr<Bitmap>> get(GlyphBitmapCacheKey const&);
+    void set(GlyphBitmapCacheKey const&, RefPtr<Bitmap>);
+
+private:
+    static constexpr size_t maximum_bytes_per_generation = 4 * MiB;
+
+    HashMap<GlyphBitmapCacheKey, RefPtr<Bitmap>> m_current_generation;
+    HashMap<GlyphBitmapCacheKey, RefPtr<Bitmap>> m_previous_generation;
+    size_t m_current_generation_bytes { 0 };
+};
+
+}
+
+namespace AK {
+
+template<>
+struct Traits<Gfx::GlyphBitmapCacheKey> : public GenericTraits<Gfx::GlyphBitmapCacheKey> {
+    static unsigned hash(Gfx::GlyphBitmapCacheKey const& key)
+    {
+        auto hash = ptr_hash(key.font.ptr());
+        hash = pair_int_hash(hash, bit_cast<u32>(key.x_scale));
+        hash = pair_int_hash(hash, bit_cast<u32>(key.y_scale));
+        hash = pair_int_hash(hash, key.glyph_id);
+        return pair_int_hash(hash, (key.subpixel_offset.x << 8) | key.subpixel_offset.y);
+    }
+};
+
+}
@@ -6,6 +6,7 @@
 
 #include <AK/Utf32View.h>
 #include <AK/Utf8View.h>
+#include <LibGfx/Font/GlyphBitmapCache.h>
 #include <LibGfx/Font/ScaledFont.h>
 
 namespace Gfx {
@@ -45,8 +46,18 @@ RefPtr<Gfx::Bitmap> ScaledFont::rasterize_glyph(u32 glyph_id, GlyphSubpixelOffse
     if (glyph_iterator != m_cached_glyph_bitmaps.end())
         return glyph_iterator->value;
 
+    // On an instance miss, consult the process-wide cache before rasterizing: other
+    // (possibly already destroyed) ScaledFont instances for the same face and size
+    // share their rasterizations through it.
+    GlyphBitmapCacheKey shared_key { m_font, m_x_scale, m_y_scale, glyph_id, subpixel_offset };
+    if (auto cached_bitmap = GlyphBitmapCache::the().get(shared_key); cached_bitmap.has_value()) {
+        m_cached_glyph_bitmaps.set(index, cached_bitmap.value());
+        return cached_bitmap.value();
+    }
+
     auto glyph_bitmap = m_font->rasterize_glyph(glyph_id, m_x_scale, m_y_scale, subpixel_offset);
     m_cached_glyph_bitmaps.set(index, glyph_bitmap);
+    GlyphBitmapCache::the().set(shared_key, glyph_bitmap);
     return glyph_bitmap;
 }
 
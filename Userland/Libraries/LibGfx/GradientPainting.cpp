@@ -108,6 +108,47 @@ public:
         }
     }
 
+    // OPTIMIZATION: A linear gradient's location varies linearly across a scanline, so
+    //               rather than evaluating a transform for every pixel we advance a
+    //               16.16 fixed-point cursor along the gradient line and write straight
+    //               into the target scanlines. The gradient line colors themselves are
+    //               computed exactly as for the generic path above.
+    void paint_linear_into_physical_rect(Painter& painter, IntRect rect, float loc_at_origin, float dloc_dx, float dloc_dy)
+    {
+        auto clipped_rect = rect.intersected(painter.clip_rect() * painter.scale());
+        if (clipped_rect.is_empty())
+            return;
+        auto start_offset = clipped_rect.location() - rect.location();
+
+        constexpr float fixed_point_scale = 65536.0f;
+        i64 const dx_fixed = static_cast<i64>(dloc_dx * m_sample_scale * fixed_point_scale);
+
+        auto repeat_wrap_if_required = [&](i64 loc) {
+            if (m_repeating)
+                return (loc + m_start_offset) % static_cast<i64>(m_gradient_line_colors.size());
+            return loc;
+        };
+
+        auto& target = *painter.target();
+        for (int y = 0; y < clipped_rect.height(); y++) {
+            float const row_loc = (loc_at_origin + dloc_dx * start_offset.x() + dloc_dy * (y + start_offset.y())) * m_sample_scale;
+            i64 loc_fixed = static_cast<i64>(row_loc * fixed_point_scale);
+            ARGB32* pixel = target.scanline(clipped_rect.top() + y) + clipped_rect.left();
+            for (int x = 0; x < clipped_rect.width(); x++, loc_fixed += dx_fixed, ++pixel) {
+                i64 const int_loc = loc_fixed >> 16;
+                float const blend = static_cast<float>(loc_fixed & 0xffff) / fixed_point_scale;
+                auto color = get_color(repeat_wrap_if_required(int_loc));
+                // Blend between the two neighbouring colors (this fixes some nasty aliasing issues at small angles)
+                if (blend >= 0.004f)
+                    color = color.mixed_with(get_color(repeat_wrap_if_required(int_loc + 1)), blend);
+                if (!m_requires_blending || color.alpha() == 255)
+                    *pixel = color.value();
+                else if (color.alpha())
+                    *pixel = Color::from_argb(*pixel).blend(color).value();
+            }
+        }
+    }
+
 private:
     bool m_repeating;
     int m_start_offset;
@@ -136,9 +177,10 @@ void Painter::fill_rect_with_linear_gradient(IntRect const& rect, Span<ColorStop
     auto rotated_start_point_x = start_point.x() * cos_angle - start_point.y() * -sin_angle;
 
     GradientLine gradient_line(gradient_length, color_stops, repeat_length);
-    gradient_line.paint_into_physical_rect(*this, a_rect, [&](int x, int y) {
-        return (x * cos_angle - (a_rect.height() - y) * -sin_angle) - rotated_start_point_x;
-    });
+    // The gradient location is (x * cos_angle + (height - y) * sin_angle - rotated_start_point_x),
+    // which is linear in x and y, so the scanline fast path applies.
+    gradient_line.paint_linear_into_physical_rect(*this, a_rect,
+        a_rect.height() * sin_angle - rotated_start_point_x, cos_angle, -sin_angle);
 }
 
 void Painter::fill_rect_with_conic_gradient(IntRect const& rect, Span<ColorStop const> const& color_stops, IntPoint center, float start_angle, Optional<float> repeat_length)
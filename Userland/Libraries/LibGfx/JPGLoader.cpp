@@ -9,6 +9,7 @@
 #include <AK/HashMap.h>
 #include <AK/Math.h>
 #include <AK/MemoryStream.h>
+#include <AK/SIMD.h>
 #include <AK/Try.h>
 #include <AK/Vector.h>
 #include <LibGfx/JPGLoader.h>
@@ -825,6 +826,78 @@ static void inverse_dct(JPGLoadingContext const& context, Vector<Macroblock>& ma
     static float const s6 = AK::cos(6.0f / 16.0f * AK::Pi<float>) / 2.0f;
     static float const s7 = AK::cos(7.0f / 16.0f * AK::Pi<float>) / 2.0f;
 
+    // OPTIMIZATION: The exact same butterfly is applied to each of the 8 columns of a block,
+    //               and then to each of its 8 rows. Instead of running it 16 times per block
+    //               we run it twice, with every operand being an 8-lane vector that holds one
+    //               value per column (respectively per row).
+    auto idct_1d = [](AK::SIMD::f32x8 const (&input)[8], AK::SIMD::f32x8 (&output)[8]) {
+        auto const g0 = input[0] * s0;
+        auto const g1 = input[4] * s4;
+        auto const g2 = input[2] * s2;
+        auto const g3 = input[6] * s6;
+        auto const g4 = input[5] * s5;
+        auto const g5 = input[1] * s1;
+        auto const g6 = input[7] * s7;
+        auto const g7 = input[3] * s3;
+
+        auto const f0 = g0;
+        auto const f1 = g1;
+        auto const f2 = g2;
+        auto const f3 = g3;
+        auto const f4 = g4 - g7;
+        auto const f5 = g5 + g6;
+        auto const f6 = g5 - g6;
+        auto const f7 = g4 + g7;
+
+        auto const e0 = f0;
+        auto const e1 = f1;
+        auto const e2 = f2 - f3;
+        auto const e3 = f2 + f3;
+        auto const e4 = f4;
+        auto const e5 = f5 - f7;
+        auto const e6 = f6;
+        auto const e7 = f5 + f7;
+        auto const e8 = f4 + f6;
+
+        auto const d0 = e0;
+        auto const d1 = e1;
+        auto const d2 = e2 * m1;
+        auto const d3 = e3;
+        auto const d4 = e4 * m2;
+        auto const d5 = e5 * m3;
+        auto const d6 = e6 * m4;
+        auto const d7 = e7;
+        auto const d8 = e8 * m5;
+
+        auto const c0 = d0 + d1;
+        auto const c1 = d0 - d1;
+        auto const c2 = d2 - d3;
+        auto const c3 = d3;
+        auto const c4 = d4 + d8;
+        auto const c5 = d5 + d7;
+        auto const c6 = d6 - d8;
+        auto const c7 = d7;
+        auto const c8 = c5 - c6;
+
+        auto const b0 = c0 + c3;
+        auto const b1 = c1 + c2;
+        auto const b2 = c1 - c2;
+        auto const b3 = c0 - c3;
+        auto const b4 = c4 - c8;
+        auto const b5 = c8;
+        auto const b6 = c6 - c7;
+        auto const b7 = c7;
+
+        output[0] = b0 + b7;
+        output[1] = b1 + b6;
+        output[2] = b2 + b5;
+        output[3] = b3 + b4;
+        output[4] = b3 - b4;
+        output[5] = b2 - b5;
+        output[6] = b1 - b6;
+        output[7] = b0 - b7;
+    };
+
     for (u32 vcursor = 0; vcursor < context.mblock_meta.vcount; vcursor += context.vsample_factor) {
         for (u32 hcursor = 0; hcursor < context.mblock_meta.hcount; hcursor += context.hsample_factor) {
             for (u32 component_i = 0; component_i < context.component_count; component_i++) {
@@ -834,139 +907,32 @@ static void inverse_dct(JPGLoadingContext const& context, Vector<Macroblock>& ma
                         u32 mb_index = (vcursor + vfactor_i) * context.mblock_meta.hpadded_count + (hfactor_i + hcursor);
                         Macroblock& block = macroblocks[mb_index];
                         i32* block_component = get_component(block, component_i);
-                        for (u32 k = 0; k < 8; ++k) {
-                            float const g0 = block_component[0 * 8 + k] * s0;
-                            float const g1 = block_component[4 * 8 + k] * s4;
-                            float const g2 = block_component[2 * 8 + k] * s2;
-                            float const g3 = block_component[6 * 8 + k] * s6;
-                            float const g4 = block_component[5 * 8 + k] * s5;
-                            float const g5 = block_component[1 * 8 + k] * s1;
-                            float const g6 = block_component[7 * 8 + k] * s7;
-                            float const g7 = block_component[3 * 8 + k] * s3;
-
-                            float const f0 = g0;
-                            float const f1 = g1;
-                            float const f2 = g2;
-                            float const f3 = g3;
-                            float const f4 = g4 - g7;
-                            float const f5 = g5 + g6;
-                            float const f6 = g5 - g6;
-                            float const f7 = g4 + g7;
-
-                            float const e0 = f0;
-                            float const e1 = f1;
-                            float const e2 = f2 - f3;
-                            float const e3 = f2 + f3;
-                            float const e4 = f4;
-                            float const e5 = f5 - f7;
-                            float const e6 = f6;
-                            float const e7 = f5 + f7;
-                            float const e8 = f4 + f6;
-
-                            float const d0 = e0;
-                            float const d1 = e1;
-                            float const d2 = e2 * m1;
-                            float const d3 = e3;
-                            float const d4 = e4 * m2;
-                            float const d5 = e5 * m3;
-                            float const d6 = e6 * m4;
-                            float const d7 = e7;
-                            float const d8 = e8 * m5;
-
-                            float const c0 = d0 + d1;
-                            float const c1 = d0 - d1;
-                            float const c2 = d2 - d3;
-                            float const c3 = d3;
-                            float const c4 = d4 + d8;
-                            float const c5 = d5 + d7;
-                            float const c6 = d6 - d8;
-                            float const c7 = d7;
-                            float const c8 = c5 - c6;
-
-                            float const b0 = c0 + c3;
-                            float const b1 = c1 + c2;
-                            float const b2 = c1 - c2;
-                            float const b3 = c0 - c3;
-                            float const b4 = c4 - c8;
-                            float const b5 = c8;
-                            float const b6 = c6 - c7;
-                            float const b7 = c7;
-
-                            block_component[0 * 8 + k] = b0 + b7;
-                            block_component[1 * 8 + k] = b1 + b6;
-                            block_component[2 * 8 + k] = b2 + b5;
-                            block_component[3 * 8 + k] = b3 + b4;
-                            block_component[4 * 8 + k] = b3 - b4;
-                            block_component[5 * 8 + k] = b2 - b5;
-                            block_component[6 * 8 + k] = b1 - b6;
-                            block_component[7 * 8 + k] = b0 - b7;
+
+                        // Column pass: lane k of each vector is column k, so input[n] is row n.
+                        AK::SIMD::f32x8 rows[8];
+                        AK::SIMD::f32x8 transformed_rows[8];
+                        for (u32 row = 0; row < 8; ++row) {
+                            AK::SIMD::i32x8 row_values;
+                            __builtin_memcpy(&row_values, &block_component[row * 8], sizeof(row_values));
+                            rows[row] = __builtin_convertvector(row_values, AK::SIMD::f32x8);
                         }
-                        for (u32 l = 0; l < 8; ++l) {
-                            float const g0 = block_component[l * 8 + 0] * s0;
-                            float const g1 = block_component[l * 8 + 4] * s4;
-                            float const g2 = block_component[l * 8 + 2] * s2;
-                            float const g3 = block_component[l * 8 + 6] * s6;
-                            float const g4 = block_component[l * 8 + 5] * s5;
-                            float const g5 = block_component[l * 8 + 1] * s1;
-                            float const g6 = block_component[l * 8 + 7] * s7;
-                            float const g7 = block_component[l * 8 + 3] * s3;
-
-                            float const f0 = g0;
-                            float const f1 = g1;
-                            float const f2 = g2;
-                            float const f3 = g3;
-                            float const f4 = g4 - g7;
-                            float const f5 = g5 + g6;
-                            float const f6 = g5 - g6;
-                            float const f7 = g4 + g7;
-
-                            float const e0 = f0;
-                            float const e1 = f1;
-                            float const e2 = f2 - f3;
-                            float const e3 = f2 + f3;
-                            float const e4 = f4;
-                            float const e5 = f5 - f7;
-                            float const e6 = f6;
-                            float const e7 = f5 + f7;
-                            float const e8 = f4 + f6;
-
-                            float const d0 = e0;
-                            float const d1 = e1;
-                            float const d2 = e2 * m1;
-                            float const d3 = e3;
-                            float const d4 = e4 * m2;
-                            float const d5 = e5 * m3;
-                            float const d6 = e6 * m4;
-                            float const d7 = e7;
-                            float const d8 = e8 * m5;
-
-                            float const c0 = d0 + d1;
-                            float const c1 = d0 - d1;
-                            float const c2 = d2 - d3;
-                            float const c3 = d3;
-                            float const c4 = d4 + d8;
-                            float const c5 = d5 + d7;
-                            float const c6 = d6 - d8;
-                            float const c7 = d7;
-                            float const c8 = c5 - c6;
-
-                            float const b0 = c0 + c3;
-                            float const b1 = c1 + c2;
-                            float const b2 = c1 - c2;
-                            float const b3 = c0 - c3;
-                            float const b4 = c4 - c8;
-                            float const b5 = c8;
-                            float const b6 = c6 - c7;
-                            float const b7 = c7;
-
-                            block_component[l * 8 + 0] = b0 + b7;
-                            block_component[l * 8 + 1] = b1 + b6;
-                            block_component[l * 8 + 2] = b2 + b5;
-                            block_component[l * 8 + 3] = b3 + b4;
-                            block_component[l * 8 + 4] = b3 - b4;
-                            block_component[l * 8 + 5] = b2 - b5;
-                            block_component[l * 8 + 6] = b1 - b6;
-                            block_component[l * 8 + 7] = b0 - b7;
+                        idct_1d(rows, transformed_rows);
+                        for (u32 row = 0; row < 8; ++row) {
+                            auto row_values = __builtin_convertvector(transformed_rows[row], AK::SIMD::i32x8);
+                            __builtin_memcpy(&block_component[row * 8], &row_values, sizeof(row_values));
+                        }
+
+                        // Row pass: lane l of each vector is row l, so input[n] is column n.
+                        AK::SIMD::f32x8 columns[8];
+                        AK::SIMD::f32x8 transformed_columns[8];
+                        for (u32 column = 0; column < 8; ++column) {
+                            for (u32 row = 0; row < 8; ++row)
+                                columns[column][row] = static_cast<float>(block_component[row * 8 + column]);
+                        }
+                        idct_1d(columns, transformed_columns);
+                        for (u32 column = 0; column < 8; ++column) {
+                            for (u32 row = 0; row < 8; ++row)
+                                block_component[row * 8 + column] = static_cast<i32>(transformed_columns[column][row]);
                         }
                     }
                 }
@@ -988,19 +954,42 @@ static void ycbcr_to_rgb(JPGLoadingContext const& context, Vector<Macroblock>& m
                     i32* y = macroblocks[mb_index].y;
                     i32* cb = macroblocks[mb_index].cb;
                     i32* cr = macroblocks[mb_index].cr;
+                    // OPTIMIZATION: Each row of 8 pixels is converted in one go; only the
+                    //               subsampled chroma values have to be gathered lane by lane.
+                    //               Gathering them before storing the row keeps this correct
+                    //               even when the chroma block aliases the block being written.
                     for (u8 i = 7; i < 8; --i) {
-                        for (u8 j = 7; j < 8; --j) {
-                            const u8 pixel = i * 8 + j;
-                            const u32 chroma_pxrow = (i / context.vsample_factor) + 4 * vfactor_i;
+                        const u32 chroma_pxrow = (i / context.vsample_factor) + 4 * vfactor_i;
+                        AK::SIMD::f32x8 cb_values;
+                        AK::SIMD::f32x8 cr_values;
+                        for (u8 j = 0; j < 8; ++j) {
                             const u32 chroma_pxcol = (j / context.hsample_factor) + 4 * hfactor_i;
                             const u32 chroma_pixel = chroma_pxrow * 8 + chroma_pxcol;
-                            int r = y[pixel] + 1.402f * chroma.cr[chroma_pixel] + 128;
-                            int g = y[pixel] - 0.344f * chroma.cb[chroma_pixel] - 0.714f * chroma.cr[chroma_pixel] + 128;
-                            int b = y[pixel] + 1.772f * chroma.cb[chroma_pixel] + 128;
-                            y[pixel] = r < 0 ? 0 : (r > 255 ? 255 : r);
-                            cb[pixel] = g < 0 ? 0 : (g > 255 ? 255 : g);
-                            cr[pixel] = b < 0 ? 0 : (b > 255 ? 255 : b);
+                            cb_values[j] = static_cast<float>(chroma.cb[chroma_pixel]);
+                            cr_values[j] = static_cast<float>(chroma.cr[chroma_pixel]);
                         }
+
+                        AK::SIMD::i32x8 y_values;
+                        __builtin_memcpy(&y_values, &y[i * 8], sizeof(y_values));
+                        auto const y_floats = __builtin_convertvector(y_values, AK::SIMD::f32x8);
+
+                        auto r = __builtin_convertvector(y_floats + 1.402f * cr_values + 128.0f, AK::SIMD::i32x8);
+                        auto g = __builtin_convertvector(y_floats - 0.344f * cb_values - 0.714f * cr_values + 128.0f, AK::SIMD::i32x8);
+                        auto b = __builtin_convertvector(y_floats + 1.772f * cb_values + 128.0f, AK::SIMD::i32x8);
+
+                        auto clamp_to_u8 = [](AK::SIMD::i32x8 value) {
+                            AK::SIMD::i32x8 const min_value = { 0, 0, 0, 0, 0, 0, 0, 0 };
+                            AK::SIMD::i32x8 const max_value = { 255, 255, 255, 255, 255, 255, 255, 255 };
+                            value = value < min_value ? min_value : value;
+                            return value > max_value ? max_value : value;
+                        };
+                        r = clamp_to_u8(r);
+                        g = clamp_to_u8(g);
+                        b = clamp_to_u8(b);
+
+                        __builtin_memcpy(&y[i * 8], &r, sizeof(r));
+                        __builtin_memcpy(&cb[i * 8], &g, sizeof(g));
+                        __builtin_memcpy(&cr[i * 8], &b, sizeof(b));
                     }
                 }
             }
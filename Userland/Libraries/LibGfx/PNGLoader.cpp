@@ -7,6 +7,7 @@
 
 #include <AK/Debug.h>
 #include <AK/Endian.h>
+#include <AK/SIMD.h>
 #include <AK/Vector.h>
 #include <LibCompress/Zlib.h>
 #include <LibGfx/PNGLoader.h>
@@ -172,12 +173,75 @@ union [[gnu::packed]] Pixel {
 };
 static_assert(AssertSize<Pixel, 4>());
 
+// OPTIMIZATION: The Sub and Paeth filters only have a serial dependency on the previous
+//               pixel, so for the common 3- and 4-byte pixel formats all channels of a
+//               pixel can be unfiltered at once, with the previous pixel carried between
+//               iterations in a vector register.
+template<size_t bytes_per_complete_pixel>
+ALWAYS_INLINE static void unfilter_sub_scanline(Bytes scanline_data)
+{
+    static_assert(bytes_per_complete_pixel == 3 || bytes_per_complete_pixel == 4);
+
+    AK::SIMD::u8x4 left = { 0, 0, 0, 0 };
+    for (size_t i = 0; i + bytes_per_complete_pixel <= scanline_data.size(); i += bytes_per_complete_pixel) {
+        AK::SIMD::u8x4 current = { scanline_data[i], scanline_data[i + 1], scanline_data[i + 2], 0 };
+        if constexpr (bytes_per_complete_pixel == 4)
+            current[3] = scanline_data[i + 3];
+        current += left;
+        for (size_t j = 0; j < bytes_per_complete_pixel; ++j)
+            scanline_data[i + j] = current[j];
+        left = current;
+    }
+}
+
+template<size_t bytes_per_complete_pixel>
+ALWAYS_INLINE static void unfilter_paeth_scanline(Bytes scanline_data, ReadonlyBytes previous_scanlines_data)
+{
+    static_assert(bytes_per_complete_pixel == 3 || bytes_per_complete_pixel == 4);
+
+    auto load_pixel = [](u8 const* data) {
+        AK::SIMD::i32x4 pixel = { data[0], data[1], data[2], 0 };
+        if constexpr (bytes_per_complete_pixel == 4)
+            pixel[3] = data[3];
+        return pixel;
+    };
+    auto absolute_values = [](AK::SIMD::i32x4 value) {
+        AK::SIMD::i32x4 const zero = { 0, 0, 0, 0 };
+        return value < zero ? -value : value;
+    };
+
+    AK::SIMD::i32x4 left = { 0, 0, 0, 0 };
+    AK::SIMD::i32x4 upper_left = { 0, 0, 0, 0 };
+    for (size_t i = 0; i + bytes_per_complete_pixel <= scanline_data.size(); i += bytes_per_complete_pixel) {
+        auto above = load_pixel(&previous_scanlines_data[i]);
+        auto predictor = left + above - upper_left;
+        auto predictor_left = absolute_values(predictor - left);
+        auto predictor_above = absolute_values(predictor - above);
+        auto predictor_upper_left = absolute_values(predictor - upper_left);
+        auto nearest = (predictor_above <= predictor_upper_left) ? above : upper_left;
+        nearest = ((predictor_left <= predictor_above) & (predictor_left <= predictor_upper_left)) ? left : nearest;
+        auto current = (load_pixel(&scanline_data[i]) + nearest) & 255;
+        for (size_t j = 0; j < bytes_per_complete_pixel; ++j)
+            scanline_data[i + j] = static_cast<u8>(current[j]);
+        upper_left = above;
+        left = current;
+    }
+}
+
 static void unfilter_scanline(PNG::FilterType filter, Bytes scanline_data, ReadonlyBytes previous_scanlines_data, u8 bytes_per_complete_pixel)
 {
     VERIFY(filter != PNG::FilterType::None);
 
     switch (filter) {
     case PNG::FilterType::Sub:
+        if (bytes_per_complete_pixel == 4 && scanline_data.size() % 4 == 0) {
+            unfilter_sub_scanline<4>(scanline_data);
+            break;
+        }
+        if (bytes_per_complete_pixel == 3 && scanline_data.size() % 3 == 0) {
+            unfilter_sub_scanline<3>(scanline_data);
+            break;
+        }
         // This loop starts at bytes_per_complete_pixel because all bytes before that are
         // guaranteed to have no valid byte at index (i - bytes_per_complete pixel).
         // All such invalid byte indexes should be treated as 0, and adding 0 to the current
@@ -188,12 +252,24 @@ static void unfilter_scanline(PNG::FilterType filter, Bytes scanline_data, Reado
             scanline_data[i] += left;
         }
         break;
-    case PNG::FilterType::Up:
-        for (size_t i = 0; i < scanline_data.size(); ++i) {
+    case PNG::FilterType::Up: {
+        // The Up filter has no dependency within the scanline at all, so it can run 16
+        // bytes at a time (u8 vector adds wrap just like the scalar ones).
+        size_t i = 0;
+        for (; i + 16 <= scanline_data.size(); i += 16) {
+            AK::SIMD::u8x16 current;
+            AK::SIMD::u8x16 above;
+            __builtin_memcpy(&current, &scanline_data[i], sizeof(current));
+            __builtin_memcpy(&above, &previous_scanlines_data[i], sizeof(above));
+            current += above;
+            __builtin_memcpy(&scanline_data[i], &current, sizeof(current));
+        }
+        for (; i < scanline_data.size(); ++i) {
             u8 above = previous_scanlines_data[i];
             scanline_data[i] += above;
         }
         break;
+    }
     case PNG::FilterType::Average:
         for (size_t i = 0; i < scanline_data.size(); ++i) {
             u32 left = (i < bytes_per_complete_pixel) ? 0 : scanline_data[i - bytes_per_complete_pixel];
@@ -203,6 +279,14 @@ static void unfilter_scanline(PNG::FilterType filter, Bytes scanline_data, Reado
         }
         break;
     case PNG::FilterType::Paeth:
+        if (bytes_per_complete_pixel == 4 && scanline_data.size() % 4 == 0) {
+            unfilter_paeth_scanline<4>(scanline_data, previous_scanlines_data);
+            break;
+        }
+        if (bytes_per_complete_pixel == 3 && scanline_data.size() % 3 == 0) {
+            unfilter_paeth_scanline<3>(scanline_data, previous_scanlines_data);
+            break;
+        }
         for (size_t i = 0; i < scanline_data.size(); ++i) {
             u8 left = (i < bytes_per_complete_pixel) ? 0 : scanline_data[i - bytes_per_complete_pixel];
             u8 above = previous_scanlines_data[i];
@@ -46,6 +46,13 @@ public:
 
     void clear_rect(IntRect const&, Color);
     void fill_rect(IntRect const&, Color);
+    struct FillRectSpec {
+        IntRect rect;
+        Color color;
+    };
+    // Batched variant of fill_rect(): translation and clip state are loaded once for
+    // the whole span instead of being re-fetched and re-validated for every rect.
+    void fill_rects(Span<FillRectSpec const>);
     void fill_rect_with_dither_pattern(IntRect const&, Color, Color);
     void fill_rect_with_checkerboard(IntRect const&, IntSize, Color color_dark, Color color_light);
     void fill_rect_with_gradient(Orientation, IntRect const&, Color gradient_start, Color gradient_end);
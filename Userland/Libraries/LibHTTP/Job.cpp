@@ -26,9 +26,8 @@ static ErrorOr<ByteBuffer> handle_content_encoding(ByteBuffer const& buf, Deprec
     dbgln_if(JOB_DEBUG, "Job::handle_content_encoding: buf has content_encoding={}", content_encoding);
 
     // FIXME: Actually do the decompression of the data using streams, instead of all at once when everything has been
-    //        received. This will require that some of the decompression algorithms are implemented in a streaming way.
-    //        Gzip and Deflate are implemented using AK::Stream, while Brotli uses the newer Core::Stream. The Gzip and
-    //        Deflate implementations will likely need to be changed to LibCore::Stream for this to work easily.
+    //        received. The decompressors all speak Core::Stream now, so this is only blocked on restructuring Job's
+    //        body handling to feed received chunks through a long-lived decompressor stream.
 
     if (content_encoding == "gzip") {
         if (!Compress::GzipDecompressor::is_likely_compressed(buf)) {
@@ -171,9 +170,21 @@ void Job::register_on_ready_to_read(Function<void()> callback)
 
 ErrorOr<DeprecatedString> Job::read_line(size_t size)
 {
-    auto buffer = TRY(ByteBuffer::create_uninitialized(size));
-    auto bytes_read = TRY(m_socket->read_until(buffer, "\r\n"sv));
-    return DeprecatedString::copy(bytes_read);
+    // Peek at the socket's internal buffer directly instead of draining it
+    // into a scratch buffer first; the line only gets copied once, into the
+    // returned string.
+    if (auto peeked = TRY(m_socket->peek_until("\r\n"sv, size)); peeked.has_value()) {
+        auto line = DeprecatedString::copy(peeked->bytes);
+        TRY(m_socket->discard_bytes(peeked->total_size));
+        return line;
+    }
+
+    // No delimiter in sight; hand out whatever is buffered, like read_until() would.
+    auto buffered = TRY(m_socket->peek_buffered_data());
+    buffered = buffered.trim(size);
+    auto line = DeprecatedString::copy(buffered);
+    TRY(m_socket->discard_bytes(buffered.size()));
+    return line;
 }
 
 ErrorOr<ByteBuffer> Job::receive(size_t size)
@@ -181,16 +192,22 @@ ErrorOr<ByteBuffer> Job::receive(size_t size)
     if (size == 0)
         return ByteBuffer {};
 
-    auto buffer = TRY(ByteBuffer::create_uninitialized(size));
+    // Read through a scratch buffer that is reused between calls, so draining
+    // a chunked response doesn't allocate a full read-sized buffer per chunk
+    // only to throw it away again moments later. The payload handed out is
+    // sized to what actually arrived.
+    if (m_scratch_buffer.is_empty())
+        m_scratch_buffer = TRY(ByteBuffer::create_uninitialized(64 * KiB));
+    auto read_buffer = m_scratch_buffer.bytes().trim(size);
     size_t nread;
     do {
-        auto result = m_socket->read(buffer);
+        auto result = m_socket->read(read_buffer);
         if (result.is_error() && result.error().is_errno() && result.error().code() == EINTR)
             continue;
         nread = TRY(result).size();
         break;
     } while (true);
-    return buffer.slice(0, nread);
+    return ByteBuffer::copy(read_buffer.trim(nread));
 }
 
 void Job::on_socket_connected()
@@ -510,9 +527,10 @@ void Job::on_socket_connected()
                 }
             }
 
-            m_received_buffers.append(make<ReceivedBuffer>(payload));
-            m_buffered_size += payload.size();
-            m_received_size += payload.size();
+            auto payload_size = payload.size();
+            m_received_buffers.append(make<ReceivedBuffer>(move(payload)));
+            m_buffered_size += payload_size;
+            m_received_size += payload_size;
             flush_received_buffers();
 
             deferred_invoke([this] { did_progress(m_content_length, m_received_size); });
@@ -532,7 +550,7 @@ void Job::on_socket_connected()
             }
 
             if (m_current_chunk_remaining_size.has_value()) {
-                auto size = m_current_chunk_remaining_size.value() - payload.size();
+                auto size = m_current_chunk_remaining_size.value() - payload_size;
 
                 dbgln_if(JOB_DEBUG, "Job: We have {} bytes left over in this chunk", size);
                 if (size == 0) {
@@ -72,6 +72,9 @@ protected:
 
     NonnullOwnPtrVector<ReceivedBuffer> m_received_buffers;
 
+    // Scratch space for receive(), reused between reads.
+    ByteBuffer m_scratch_buffer;
+
     size_t m_buffered_size { 0 };
     size_t m_received_size { 0 };
     Optional<u32> m_content_length;
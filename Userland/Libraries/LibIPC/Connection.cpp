@@ -30,6 +30,13 @@ ConnectionBase::ConnectionBase(IPC::Stub& local_stub, NonnullOwnPtr<Core::Stream
     m_responsiveness_timer = Core::Timer::create_single_shot(3000, [this] { may_have_become_unresponsive(); }).release_value_but_fixme_should_propagate_errors();
 }
 
+ConnectionBase::~ConnectionBase()
+{
+    // Best effort: don't lose messages queued by a peer that tears the
+    // connection down without returning to the event loop.
+    (void)flush_pending_messages();
+}
+
 void ConnectionBase::set_deferred_invoker(NonnullOwnPtr<DeferredInvoker> deferred_invoker)
 {
     m_deferred_invoker = move(deferred_invoker);
@@ -52,6 +59,10 @@ ErrorOr<void> ConnectionBase::post_message(Message const& message)
     return post_message(TRY(message.encode()));
 }
 
+// Flush eagerly once this much data has been queued, so a tick that produces
+// a lot of traffic doesn't buffer it all in memory first.
+static constexpr size_t max_unsent_bytes_before_flush = 64 * KiB;
+
 ErrorOr<void> ConnectionBase::post_message(MessageBuffer buffer)
 {
     // NOTE: If this connection is being shut down, but has not yet been destroyed,
@@ -59,10 +70,8 @@ ErrorOr<void> ConnectionBase::post_message(MessageBuffer buffer)
     if (!m_socket->is_open())
         return Error::from_string_literal("Trying to post_message during IPC shutdown");
 
-    // Prepend the message size.
-    uint32_t message_size = buffer.data.size();
-    TRY(buffer.data.try_prepend(reinterpret_cast<u8 const*>(&message_size), sizeof(message_size)));
-
+    // Pass the fds as soon as the message is queued. They travel out of band,
+    // so the peer pairs them with messages in queueing order either way.
     for (auto& fd : buffer.fds) {
         if (auto result = fd_passing_socket().send_fd(fd.value()); result.is_error()) {
             shutdown_with_error(result.error());
@@ -70,7 +79,35 @@ ErrorOr<void> ConnectionBase::post_message(MessageBuffer buffer)
         }
     }
 
-    ReadonlyBytes bytes_to_write { buffer.data.span() };
+    // Queue the size-prefixed message. Everything queued during the current
+    // event-loop tick is coalesced into a single write by the deferred flush,
+    // instead of paying one syscall per message.
+    uint32_t message_size = buffer.data.size();
+    TRY(m_unsent_bytes.try_append(reinterpret_cast<u8 const*>(&message_size), sizeof(message_size)));
+    TRY(m_unsent_bytes.try_append(buffer.data.data(), buffer.data.size()));
+
+    if (m_unsent_bytes.size() >= max_unsent_bytes_before_flush)
+        return flush_pending_messages();
+
+    if (!m_flush_scheduled) {
+        m_flush_scheduled = true;
+        m_deferred_invoker->schedule([strong_this = NonnullRefPtr(*this)] {
+            if (auto result = strong_this->flush_pending_messages(); result.is_error())
+                dbgln("IPC::ConnectionBase: Failed to flush messages: {}", result.error());
+        });
+    }
+    return {};
+}
+
+ErrorOr<void> ConnectionBase::flush_pending_messages()
+{
+    m_flush_scheduled = false;
+    if (m_unsent_bytes.is_empty())
+        return {};
+    if (!m_socket->is_open())
+        return Error::from_string_literal("Trying to flush messages during IPC shutdown");
+
+    ReadonlyBytes bytes_to_write { m_unsent_bytes.span() };
     int writes_done = 0;
     size_t initial_size = bytes_to_write.size();
     while (!bytes_to_write.is_empty()) {
@@ -85,14 +122,18 @@ ErrorOr<void> ConnectionBase::post_message(MessageBuffer buffer)
                     sched_yield();
                     continue;
                 }
+                // Drop the unsendable bytes before shutting down, so the
+                // flush attempts in shutdown() and the destructor don't try
+                // the dead socket again.
+                m_unsent_bytes.clear_with_capacity();
                 shutdown_with_error(error);
                 switch (error.code()) {
                 case EPIPE:
-                    return Error::from_string_literal("IPC::Connection::post_message: Disconnected from peer");
+                    return Error::from_string_literal("IPC::Connection::flush_pending_messages: Disconnected from peer");
                 case EAGAIN:
-                    return Error::from_string_literal("IPC::Connection::post_message: Peer buffer overflowed");
+                    return Error::from_string_literal("IPC::Connection::flush_pending_messages: Peer buffer overflowed");
                 default:
-                    return Error::from_syscall("IPC::Connection::post_message write"sv, -error.code());
+                    return Error::from_syscall("IPC::Connection::flush_pending_messages write"sv, -error.code());
                 }
             } else {
                 return error;
@@ -101,8 +142,9 @@ ErrorOr<void> ConnectionBase::post_message(MessageBuffer buffer)
 
         bytes_to_write = bytes_to_write.slice(maybe_nwritten.value());
     }
+    m_unsent_bytes.clear_with_capacity();
     if (writes_done > 1) {
-        dbgln("LibIPC::Connection FIXME Warning, needed {} writes needed to send message of size {}B, this is pretty bad, as it spins on the EventLoop", writes_done, initial_size);
+        dbgln("LibIPC::Connection FIXME Warning, needed {} writes needed to send batch of size {}B, this is pretty bad, as it spins on the EventLoop", writes_done, initial_size);
     }
 
     // Note: This disables responsiveness detection when an event loop is absent.
@@ -114,6 +156,7 @@ ErrorOr<void> ConnectionBase::post_message(MessageBuffer buffer)
 
 void ConnectionBase::shutdown()
 {
+    (void)flush_pending_messages();
     m_socket->close();
     die();
 }
@@ -165,7 +208,11 @@ ErrorOr<Vector<u8>> ConnectionBase::read_as_much_as_possible_from_socket_without
         m_unprocessed_bytes.clear();
     }
 
-    u8 buffer[4096];
+    // Read straight into the result vector in large chunks; a busy connection
+    // (WindowServer <-> WebContent) can easily have more than a page's worth
+    // of messages queued, and a small bounce buffer costs a syscall plus a
+    // copy per chunk.
+    static constexpr size_t read_chunk_size = 64 * KiB;
 
     bool should_shut_down = false;
     auto schedule_shutdown = [this, &should_shut_down]() {
@@ -176,8 +223,11 @@ ErrorOr<Vector<u8>> ConnectionBase::read_as_much_as_possible_from_socket_without
     };
 
     while (m_socket->is_open()) {
-        auto maybe_bytes_read = m_socket->read_without_waiting({ buffer, 4096 });
+        size_t used_size = bytes.size();
+        TRY(bytes.try_resize(used_size + read_chunk_size));
+        auto maybe_bytes_read = m_socket->read_without_waiting(bytes.span().slice(used_size));
         if (maybe_bytes_read.is_error()) {
+            bytes.resize(used_size);
             auto error = maybe_bytes_read.release_error();
             if (error.is_syscall() && error.code() == EAGAIN) {
                 break;
@@ -194,12 +244,11 @@ ErrorOr<Vector<u8>> ConnectionBase::read_as_much_as_possible_from_socket_without
         }
 
         auto bytes_read = maybe_bytes_read.release_value();
+        bytes.resize(used_size + bytes_read.size());
         if (bytes_read.is_empty()) {
             schedule_shutdown();
             break;
         }
-
-        bytes.append(bytes_read.data(), bytes_read.size());
     }
 
     if (!bytes.is_empty()) {
@@ -255,6 +304,11 @@ OwnPtr<IPC::Message> ConnectionBase::wait_for_specific_endpoint_message_impl(u32
         if (!m_socket->is_open())
             break;
 
+        // Make sure our own request is actually on the wire before blocking
+        // on the response.
+        if (flush_pending_messages().is_error())
+            break;
+
         wait_for_socket_to_become_readable();
         if (drain_messages_from_peer().is_error())
             break;
@@ -37,7 +37,7 @@ class ConnectionBase : public Core::Object {
     C_OBJECT_ABSTRACT(ConnectionBase);
 
 public:
-    virtual ~ConnectionBase() override = default;
+    virtual ~ConnectionBase() override;
 
     void set_fd_passing_socket(NonnullOwnPtr<Core::Stream::LocalSocket>);
     void set_deferred_invoker(NonnullOwnPtr<DeferredInvoker>);
@@ -45,6 +45,7 @@ public:
 
     bool is_open() const { return m_socket->is_open(); }
     ErrorOr<void> post_message(Message const&);
+    ErrorOr<void> flush_pending_messages();
 
     void shutdown();
     virtual void die() { }
@@ -78,6 +79,12 @@ protected:
     NonnullOwnPtrVector<Message> m_unprocessed_messages;
     ByteBuffer m_unprocessed_bytes;
 
+    // Outbound messages queued during the current event-loop tick; flushed
+    // with a single write. The vector keeps its capacity across flushes so
+    // steady-state sends don't allocate.
+    Vector<u8> m_unsent_bytes;
+    bool m_flush_scheduled { false };
+
     u32 m_local_endpoint_magic { 0 };
 
     NonnullOwnPtr<DeferredInvoker> m_deferred_invoker;
@@ -139,22 +146,25 @@ protected:
             index += sizeof(message_size);
             auto remaining_bytes = ReadonlyBytes { bytes.data() + index, message_size };
 
-            auto local_message = LocalEndpoint::decode_message(remaining_bytes, fd_passing_socket());
-            if (!local_message.is_error()) {
-                m_unprocessed_messages.append(local_message.release_value());
-                continue;
-            }
-
-            auto peer_message = PeerEndpoint::decode_message(remaining_bytes, fd_passing_socket());
-            if (!peer_message.is_error()) {
-                m_unprocessed_messages.append(peer_message.release_value());
-                continue;
+            // Validate the frame header here and hand the message straight to
+            // the endpoint it belongs to, instead of letting the other
+            // endpoint attempt (and fail) a decode first.
+            u32 message_magic = 0;
+            if (message_size >= sizeof(message_magic))
+                memcpy(&message_magic, remaining_bytes.data(), sizeof(message_magic));
+
+            ErrorOr<NonnullOwnPtr<IPC::Message>> message = Error::from_string_literal("Message endpoint magic matches neither endpoint");
+            if (message_magic == LocalEndpoint::static_magic())
+                message = LocalEndpoint::decode_message(remaining_bytes, fd_passing_socket());
+            else if (message_magic == PeerEndpoint::static_magic())
+                message = PeerEndpoint::decode_message(remaining_bytes, fd_passing_socket());
+
+            if (message.is_error()) {
+                dbgln("Failed to parse a message: {}", message.error());
+                break;
             }
 
-            dbgln("Failed to parse a message");
-            dbgln("Local endpoint error: {}", local_message.error());
-            dbgln("Peer endpoint error: {}", peer_message.error());
-            break;
+            m_unprocessed_messages.append(message.release_value());
         }
     }
 };
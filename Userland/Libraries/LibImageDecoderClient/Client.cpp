@@ -25,15 +25,20 @@ Optional<DecodedImage> Client::decode_image(ReadonlyBytes encoded_data, Optional
     if (encoded_data.is_empty())
         return {};
 
-    auto encoded_buffer_or_error = Core::AnonymousBuffer::create_with_size(encoded_data.size());
-    if (encoded_buffer_or_error.is_error()) {
-        dbgln("Could not allocate encoded buffer");
-        return {};
+    // Reuse the pooled transfer buffer whenever it is big enough; growing it
+    // in 16 KiB granules means a long-lived connection quickly stops paying
+    // an anon_create + mmap + munmap round trip for every image.
+    if (!m_encoded_buffer_pool.is_valid() || m_encoded_buffer_pool.size() < encoded_data.size()) {
+        auto encoded_buffer_or_error = Core::AnonymousBuffer::create_with_size(round_up_to_power_of_two(encoded_data.size(), 16 * KiB));
+        if (encoded_buffer_or_error.is_error()) {
+            dbgln("Could not allocate encoded buffer");
+            return {};
+        }
+        m_encoded_buffer_pool = encoded_buffer_or_error.release_value();
     }
-    auto encoded_buffer = encoded_buffer_or_error.release_value();
 
-    memcpy(encoded_buffer.data<void>(), encoded_data.data(), encoded_data.size());
-    auto response_or_error = try_decode_image(move(encoded_buffer), mime_type);
+    memcpy(m_encoded_buffer_pool.data<void>(), encoded_data.data(), encoded_data.size());
+    auto response_or_error = try_decode_image(m_encoded_buffer_pool, encoded_data.size(), mime_type);
 
     if (response_or_error.is_error()) {
         dbgln("ImageDecoder died heroically");
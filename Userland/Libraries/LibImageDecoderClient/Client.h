@@ -9,6 +9,7 @@
 #include <AK/HashMap.h>
 #include <ImageDecoder/ImageDecoderClientEndpoint.h>
 #include <ImageDecoder/ImageDecoderServerEndpoint.h>
+#include <LibCore/AnonymousBuffer.h>
 #include <LibIPC/ConnectionToServer.h>
 
 namespace ImageDecoderClient {
@@ -38,6 +39,10 @@ private:
     Client(NonnullOwnPtr<Core::Stream::LocalSocket>);
 
     virtual void die() override;
+
+    // Reused across decode_image() calls; safe because the call is
+    // synchronous and the server drops the buffer before responding.
+    Core::AnonymousBuffer m_encoded_buffer_pool;
 };
 
 }
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Optional.h>
+#include <AK/Platform.h>
+#include <AK/Vector.h>
+
+namespace JIT {
+
+// A small x86-64 assembler, just big enough for the baseline JIT tiers built
+// on top of it. Instructions are appended to a caller-provided byte buffer;
+// the caller is responsible for copying the result into executable memory.
+class Assembler {
+public:
+    explicit Assembler(Vector<u8>& output)
+        : m_output(output)
+    {
+    }
+
+    enum class Reg : u8 {
+        RAX = 0,
+        RCX = 1,
+        RDX = 2,
+        RBX = 3,
+        RSP = 4,
+        RBP = 5,
+        RSI = 6,
+        RDI = 7,
+        R8 = 8,
+        R9 = 9,
+        R10 = 10,
+        R11 = 11,
+        R12 = 12,
+        R13 = 13,
+        R14 = 14,
+        R15 = 15,
+    };
+
+    struct Label {
+        Optional<size_t> offset_in_instruction_stream;
+        Vector<size_t> jump_slot_offsets;
+
+        void add_jump(Assembler& assembler, size_t offset_of_slot)
+        {
+            if (offset_in_instruction_stream.has_value()) {
+                patch_jump(assembler, offset_of_slot);
+                return;
+            }
+            jump_slot_offsets.append(offset_of_slot);
+        }
+
+        void link(Assembler& assembler)
+        {
+            VERIFY(!offset_in_instruction_stream.has_value());
+            offset_in_instruction_stream = assembler.m_output.size();
+            for (auto offset_of_slot : jump_slot_offsets)
+                patch_jump(assembler, offset_of_slot);
+            jump_slot_offsets.clear();
+        }
+
+    private:
+        void patch_jump(Assembler& assembler, size_t offset_of_slot)
+        {
+            auto relative_offset = static_cast<i32>(*offset_in_instruction_stream - (offset_of_slot + sizeof(i32)));
+            __builtin_memcpy(assembler.m_output.data() + offset_of_slot, &relative_offset, sizeof(relative_offset));
+        }
+    };
+
+    void push(Reg reg)
+    {
+        if (to_underlying(reg) >= 8)
+            emit8(0x41);
+        emit8(0x50 + encoding(reg));
+    }
+
+    void pop(Reg reg)
+    {
+        if (to_underlying(reg) >= 8)
+            emit8(0x41);
+        emit8(0x58 + encoding(reg));
+    }
+
+    void ret()
+    {
+        emit8(0xc3);
+    }
+
+    // dst <- src
+    void mov(Reg dst, Reg src)
+    {
+        emit_rex(src, dst);
+        emit8(0x89);
+        emit8(0xc0 | (encoding(src) << 3) | encoding(dst));
+    }
+
+    // dst <- immediate
+    void mov(Reg dst, u64 immediate)
+    {
+        emit8(0x48 | ((to_underlying(dst) >= 8) ? 1 << 0 : 0));
+        emit8(0xb8 | encoding(dst));
+        emit64(immediate);
+    }
+
+    // dst <- [base + displacement]
+    void load(Reg dst, Reg base, i32 displacement)
+    {
+        emit_rex(dst, base);
+        emit8(0x8b);
+        emit_modrm_mem(dst, base, displacement);
+    }
+
+    // [base + displacement] <- src
+    void store(Reg base, i32 displacement, Reg src)
+    {
+        emit_rex(src, base);
+        emit8(0x89);
+        emit_modrm_mem(src, base, displacement);
+    }
+
+    void test(Reg lhs, Reg rhs)
+    {
+        emit_rex(rhs, lhs);
+        emit8(0x85);
+        emit8(0xc0 | (encoding(rhs) << 3) | encoding(lhs));
+    }
+
+    void call(Reg reg)
+    {
+        if (to_underlying(reg) >= 8)
+            emit8(0x41);
+        emit8(0xff);
+        emit8(0xd0 | encoding(reg));
+    }
+
+    void jump(Label& label)
+    {
+        emit8(0xe9);
+        emit32(0);
+        label.add_jump(*this, m_output.size() - sizeof(i32));
+    }
+
+    void jump_if_not_zero(Label& label)
+    {
+        emit8(0x0f);
+        emit8(0x85);
+        emit32(0);
+        label.add_jump(*this, m_output.size() - sizeof(i32));
+    }
+
+private:
+    static u8 encoding(Reg reg)
+    {
+        return to_underlying(reg) & 0x7;
+    }
+
+    // REX.W prefix for a 64-bit operation with a register operand and a
+    // register or base operand in the r/m field.
+    void emit_rex(Reg reg, Reg rm)
+    {
+        u8 rex = 0x48;
+        if (to_underlying(reg) >= 8)
+            rex |= 1 << 2;
+        if (to_underlying(rm) >= 8)
+            rex |= 1 << 0;
+        emit8(rex);
+    }
+
+    void emit_modrm_mem(Reg reg, Reg base, i32 displacement)
+    {
+        // mod=0b10: [base + disp32]
+        emit8(0x80 | (encoding(reg) << 3) | encoding(base));
+        // RSP/R12 as base require a SIB byte.
+        if (encoding(base) == 4)
+            emit8(0x24);
+        emit32(static_cast<u32>(displacement));
+    }
+
+    void emit8(u8 value)
+    {
+        m_output.append(value);
+    }
+
+    void emit32(u32 value)
+    {
+        m_output.append((value >> 0) & 0xff);
+        m_output.append((value >> 8) & 0xff);
+        m_output.append((value >> 16) & 0xff);
+        m_output.append((value >> 24) & 0xff);
+    }
+
+    void emit64(u64 value)
+    {
+        emit32(value & 0xffffffff);
+        emit32(value >> 32);
+    }
+
+    Vector<u8>& m_output;
+};
+
+}
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/OwnPtr.h>
+#include <LibJIT/NativeExecutable.h>
+#include <errno.h>
+#include <string.h>
+#include <sys/mman.h>
+
+namespace JIT {
+
+ErrorOr<NonnullOwnPtr<NativeExecutable>> NativeExecutable::create(ReadonlyBytes code)
+{
+    auto* memory = mmap(nullptr, code.size(), PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+    if (memory == MAP_FAILED)
+        return Error::from_errno(errno);
+
+    memcpy(memory, code.data(), code.size());
+
+    if (mprotect(memory, code.size(), PROT_READ | PROT_EXEC) < 0) {
+        auto error = Error::from_errno(errno);
+        (void)munmap(memory, code.size());
+        return error;
+    }
+
+    return adopt_nonnull_own_or_enomem(new (nothrow) NativeExecutable(memory, code.size()));
+}
+
+NativeExecutable::NativeExecutable(void* code, size_t size)
+    : m_code(code)
+    , m_size(size)
+{
+}
+
+NativeExecutable::~NativeExecutable()
+{
+    (void)munmap(m_code, m_size);
+}
+
+}
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Error.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Span.h>
+#include <AK/Types.h>
+
+namespace JIT {
+
+// A chunk of generated machine code, copied into its own read+execute-only
+// memory mapping.
+class NativeExecutable {
+    AK_MAKE_NONCOPYABLE(NativeExecutable);
+    AK_MAKE_NONMOVABLE(NativeExecutable);
+
+public:
+    static ErrorOr<NonnullOwnPtr<NativeExecutable>> create(ReadonlyBytes code);
+    ~NativeExecutable();
+
+    void* entry_point() const { return m_code; }
+    size_t size() const { return m_size; }
+
+private:
+    NativeExecutable(void* code, size_t size);
+
+    void* m_code { nullptr };
+    size_t m_size { 0 };
+};
+
+}
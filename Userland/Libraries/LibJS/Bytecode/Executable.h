@@ -6,14 +6,32 @@
 
 #pragma once
 
+#include <AK/Array.h>
 #include <AK/DeprecatedFlyString.h>
 #include <AK/NonnullOwnPtrVector.h>
+#include <AK/OwnPtr.h>
+#include <AK/WeakPtr.h>
+#include <LibJIT/NativeExecutable.h>
 #include <LibJS/Bytecode/BasicBlock.h>
 #include <LibJS/Bytecode/IdentifierTable.h>
 #include <LibJS/Bytecode/StringTable.h>
+#include <LibJS/Forward.h>
 
 namespace JS::Bytecode {
 
+// An inline cache for property access by identifier (GetById/PutById).
+// Each entry remembers a shape and the storage offset the property had in
+// that shape, so repeated accesses on same-shaped objects skip the lookup.
+struct PropertyLookupCache {
+    static constexpr size_t max_number_of_shapes = 4;
+    struct Entry {
+        WeakPtr<Shape> shape;
+        u32 property_offset { 0 };
+        bool is_writable { false };
+    };
+    Array<Entry, max_number_of_shapes> entries;
+};
+
 struct Executable {
     DeprecatedFlyString name;
     NonnullOwnPtrVector<BasicBlock> basic_blocks;
@@ -21,6 +39,16 @@ struct Executable {
     NonnullOwnPtr<IdentifierTable> identifier_table;
     size_t number_of_registers { 0 };
     bool is_strict_mode { false };
+    // Mutated while executing; logically not part of the compiled program,
+    // which is why instructions may update it through a const Executable.
+    mutable Vector<PropertyLookupCache> property_lookup_caches;
+
+    // Baseline JIT tier state, likewise mutated while executing: the
+    // interpreter bumps the invocation count and swaps in a native executable
+    // once this unit gets hot (and the JIT is enabled).
+    mutable size_t number_of_invocations { 0 };
+    mutable bool native_compilation_failed { false };
+    mutable OwnPtr<::JIT::NativeExecutable> native_executable;
 
     DeprecatedString const& get_string(StringTableIndex index) const { return string_table->get(index); }
     DeprecatedFlyString const& get_identifier(IdentifierTableIndex index) const { return identifier_table->get(index); }
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/BitCast.h>
 #include <AK/Debug.h>
 #include <AK/TemporaryChange.h>
 #include <LibJS/Bytecode/BasicBlock.h>
@@ -11,6 +12,7 @@
 #include <LibJS/Bytecode/Interpreter.h>
 #include <LibJS/Bytecode/Op.h>
 #include <LibJS/Interpreter.h>
+#include <LibJS/JIT/Compiler.h>
 #include <LibJS/Runtime/GlobalEnvironment.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/Realm.h>
@@ -19,6 +21,7 @@ namespace JS::Bytecode {
 
 static Interpreter* s_current;
 bool g_dump_bytecode = false;
+bool g_enable_bytecode_jit = false;
 
 Interpreter* Interpreter::current()
 {
@@ -70,75 +73,90 @@ Interpreter::ValueAndFrame Interpreter::run_and_return_frame(Executable const& e
 
     registers().resize(executable.number_of_registers);
 
-    for (;;) {
-        Bytecode::InstructionStreamIterator pc(m_current_block->instruction_stream());
-        TemporaryChange temp_change { m_pc, &pc };
-
-        bool will_jump = false;
-        bool will_return = false;
-        while (!pc.at_end()) {
-            auto& instruction = *pc;
-            auto ran_or_error = instruction.execute(*this);
-            if (ran_or_error.is_error()) {
-                auto exception_value = *ran_or_error.throw_completion().value();
-                m_saved_exception = make_handle(exception_value);
-                if (unwind_contexts().is_empty())
-                    break;
-                auto& unwind_context = unwind_contexts().last();
-                if (unwind_context.executable != m_current_executable)
-                    break;
-                if (unwind_context.handler) {
-                    m_current_block = unwind_context.handler;
-                    unwind_context.handler = nullptr;
+    // Hot executables get handed to the baseline JIT tier. Generators resume
+    // at arbitrary blocks in a foreign frame, so they stay on the interpreter.
+    bool may_run_as_native_code = !entry_point && !in_frame;
+    if (g_enable_bytecode_jit && may_run_as_native_code && !executable.native_executable && !executable.native_compilation_failed
+        && ++executable.number_of_invocations >= JIT::Compiler::invocation_threshold) {
+        executable.native_executable = JIT::Compiler::compile(executable);
+        if (!executable.native_executable)
+            executable.native_compilation_failed = true;
+    }
 
-                    accumulator() = exception_value;
-                    m_saved_exception = {};
+    if (may_run_as_native_code && executable.native_executable) {
+        auto native_entry = bit_cast<JIT::NativeEntry>(executable.native_executable->entry_point());
+        native_entry(*this, registers().data());
+    } else {
+        for (;;) {
+            Bytecode::InstructionStreamIterator pc(m_current_block->instruction_stream());
+            TemporaryChange temp_change { m_pc, &pc };
+
+            bool will_jump = false;
+            bool will_return = false;
+            while (!pc.at_end()) {
+                auto& instruction = *pc;
+                auto ran_or_error = instruction.execute(*this);
+                if (ran_or_error.is_error()) {
+                    auto exception_value = *ran_or_error.throw_completion().value();
+                    m_saved_exception = make_handle(exception_value);
+                    if (unwind_contexts().is_empty())
+                        break;
+                    auto& unwind_context = unwind_contexts().last();
+                    if (unwind_context.executable != m_current_executable)
+                        break;
+                    if (unwind_context.handler) {
+                        m_current_block = unwind_context.handler;
+                        unwind_context.handler = nullptr;
+
+                        accumulator() = exception_value;
+                        m_saved_exception = {};
+                        will_jump = true;
+                        break;
+                    }
+                    if (unwind_context.finalizer) {
+                        m_current_block = unwind_context.finalizer;
+                        will_jump = true;
+                        break;
+                    }
+                    // An unwind context with no handler or finalizer? We have nowhere to jump, and continuing on will make us crash on the next `Call` to a non-native function if there's an exception! So let's crash here instead.
+                    // If you run into this, you probably forgot to remove the current unwind_context somewhere.
+                    VERIFY_NOT_REACHED();
+                }
+                if (m_pending_jump.has_value()) {
+                    m_current_block = m_pending_jump.release_value();
                     will_jump = true;
                     break;
                 }
-                if (unwind_context.finalizer) {
-                    m_current_block = unwind_context.finalizer;
-                    will_jump = true;
+                if (!m_return_value.is_empty()) {
+                    will_return = true;
                     break;
                 }
-                // An unwind context with no handler or finalizer? We have nowhere to jump, and continuing on will make us crash on the next `Call` to a non-native function if there's an exception! So let's crash here instead.
-                // If you run into this, you probably forgot to remove the current unwind_context somewhere.
-                VERIFY_NOT_REACHED();
-            }
-            if (m_pending_jump.has_value()) {
-                m_current_block = m_pending_jump.release_value();
-                will_jump = true;
-                break;
-            }
-            if (!m_return_value.is_empty()) {
-                will_return = true;
-                break;
+                ++pc;
             }
-            ++pc;
-        }
-
-        if (will_jump)
-            continue;
 
-        if (!unwind_contexts().is_empty()) {
-            auto& unwind_context = unwind_contexts().last();
-            if (unwind_context.executable == m_current_executable && unwind_context.finalizer) {
-                m_saved_return_value = make_handle(m_return_value);
-                m_return_value = {};
-                m_current_block = unwind_context.finalizer;
-                // the unwind_context will be pop'ed when entering the finally block
+            if (will_jump)
                 continue;
+
+            if (!unwind_contexts().is_empty()) {
+                auto& unwind_context = unwind_contexts().last();
+                if (unwind_context.executable == m_current_executable && unwind_context.finalizer) {
+                    m_saved_return_value = make_handle(m_return_value);
+                    m_return_value = {};
+                    m_current_block = unwind_context.finalizer;
+                    // the unwind_context will be pop'ed when entering the finally block
+                    continue;
+                }
             }
-        }
 
-        if (pc.at_end())
-            break;
+            if (pc.at_end())
+                break;
 
-        if (!m_saved_exception.is_null())
-            break;
+            if (!m_saved_exception.is_null())
+                break;
 
-        if (will_return)
-            break;
+            if (will_return)
+                break;
+        }
     }
 
     dbgln_if(JS_BYTECODE_DEBUG, "Bytecode::Interpreter did run unit {:p}", &executable);
@@ -244,6 +262,9 @@ Bytecode::PassManager& Interpreter::optimization_pipeline(Interpreter::Optimizat
     if (level == OptimizationLevel::None) {
         // No optimization.
     } else if (level == OptimizationLevel::Optimize) {
+        // NOTE: FoldConstants runs first so that jumps threaded on constant
+        //       conditions can be exploited by the block merging passes below.
+        pm->add<Passes::FoldConstants>();
         pm->add<Passes::GenerateCFG>();
         pm->add<Passes::UnifySameBlocks>();
         pm->add<Passes::GenerateCFG>();
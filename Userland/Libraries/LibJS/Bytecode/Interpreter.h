@@ -61,6 +61,10 @@ public:
     }
     void do_return(Value return_value) { m_return_value = return_value; }
 
+    // Used by JIT-compiled code to park an exception for the caller, since it
+    // has no unwind contexts of its own.
+    void save_exception(Value value) { m_saved_exception = make_handle(value); }
+
     void enter_unwind_context(Optional<Label> handler_target, Optional<Label> finalizer_target);
     void leave_unwind_context();
     ThrowCompletionOr<void> continue_pending_unwind(Label const& resume_label);
@@ -112,5 +116,6 @@ private:
 };
 
 extern bool g_dump_bytecode;
+extern bool g_enable_bytecode_jit;
 
 }
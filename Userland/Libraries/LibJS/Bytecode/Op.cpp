@@ -25,6 +25,7 @@
 #include <LibJS/Runtime/ObjectEnvironment.h>
 #include <LibJS/Runtime/Reference.h>
 #include <LibJS/Runtime/RegExpObject.h>
+#include <LibJS/Runtime/TypedArray.h>
 #include <LibJS/Runtime/Value.h>
 
 namespace JS::Bytecode {
@@ -489,21 +490,95 @@ ThrowCompletionOr<void> SetVariable::execute_impl(Bytecode::Interpreter& interpr
     return {};
 }
 
+// Inserts a shape into an inline cache, evicting the least recently used
+// entry if the cache is full.
+static void update_property_lookup_cache(PropertyLookupCache& cache, Shape& shape, u32 property_offset, bool is_writable)
+{
+    auto& entries = cache.entries;
+    size_t insertion_index = entries.size() - 1;
+    for (size_t i = 0; i < entries.size(); ++i) {
+        if (entries[i].shape.ptr() == &shape) {
+            insertion_index = i;
+            break;
+        }
+    }
+    for (size_t i = insertion_index; i >= 1; --i)
+        entries[i] = entries[i - 1];
+    entries[0] = { shape, property_offset, is_writable };
+}
+
 ThrowCompletionOr<void> GetById::execute_impl(Bytecode::Interpreter& interpreter) const
 {
     auto& vm = interpreter.vm();
-    auto* object = TRY(interpreter.accumulator().to_object(vm));
-    interpreter.accumulator() = TRY(object->get(interpreter.current_executable().get_identifier(m_property)));
+    auto& executable = interpreter.current_executable();
+    auto base_value = interpreter.accumulator();
+    auto& cache = executable.property_lookup_caches[m_cache_index];
+
+    if (base_value.is_object()) {
+        auto& object = base_value.as_object();
+        auto& shape = object.shape();
+        for (auto const& entry : cache.entries) {
+            if (entry.shape.ptr() != &shape)
+                continue;
+            auto value = object.get_direct(entry.property_offset);
+            // Accessors and not-yet-materialized intrinsics still need the
+            // full lookup machinery.
+            if (value.is_empty() || value.is_accessor())
+                break;
+            interpreter.accumulator() = value;
+            return {};
+        }
+    }
+
+    auto* object = TRY(base_value.to_object(vm));
+    PropertyKey property_key = executable.get_identifier(m_property);
+    interpreter.accumulator() = TRY(object->get(property_key));
+
+    // Cache hits on the base object's own shape-resident properties. Unique
+    // shapes mutate in place, so their offsets can't be trusted later.
+    if (base_value.is_object() && property_key.is_string() && !object->shape().is_unique()) {
+        auto& shape = object->shape();
+        if (auto metadata = shape.lookup(property_key.to_string_or_symbol()); metadata.has_value())
+            update_property_lookup_cache(cache, shape, metadata->offset, metadata->attributes.is_writable());
+    }
     return {};
 }
 
 ThrowCompletionOr<void> PutById::execute_impl(Bytecode::Interpreter& interpreter) const
 {
     auto& vm = interpreter.vm();
-    auto* object = TRY(interpreter.reg(m_base).to_object(vm));
-    PropertyKey name = interpreter.current_executable().get_identifier(m_property);
+    auto& executable = interpreter.current_executable();
+    auto base_value = interpreter.reg(m_base);
     auto value = interpreter.accumulator();
-    return put_by_property_key(object, value, name, interpreter, m_kind);
+    auto& cache = executable.property_lookup_caches[m_cache_index];
+
+    // Fast path: overwrite an existing writable data property on the base
+    // object itself. Everything else (accessors, new properties, exotic
+    // objects) takes the ordinary [[Set]] path below.
+    if (m_kind == PropertyKind::KeyValue && base_value.is_object()) {
+        auto& object = base_value.as_object();
+        auto& shape = object.shape();
+        for (auto const& entry : cache.entries) {
+            if (entry.shape.ptr() != &shape)
+                continue;
+            auto existing_value = object.get_direct(entry.property_offset);
+            if (existing_value.is_empty() || existing_value.is_accessor() || !entry.is_writable)
+                break;
+            object.put_direct(entry.property_offset, value);
+            return {};
+        }
+    }
+
+    auto* object = TRY(base_value.to_object(vm));
+    PropertyKey name = executable.get_identifier(m_property);
+    TRY(put_by_property_key(object, value, name, interpreter, m_kind));
+
+    if (m_kind == PropertyKind::KeyValue && base_value.is_object() && name.is_string() && !object->shape().is_unique()) {
+        auto& shape = object->shape();
+        if (auto metadata = shape.lookup(name.to_string_or_symbol()); metadata.has_value())
+            update_property_lookup_cache(cache, shape, metadata->offset, metadata->attributes.is_writable());
+    }
+    return {};
 }
 
 ThrowCompletionOr<void> DeleteById::execute_impl(Bytecode::Interpreter& interpreter) const
@@ -841,10 +916,46 @@ void Yield::replace_references_impl(BasicBlock const& from, BasicBlock const& to
         m_continuation_label = Label { to };
 }
 
+static Value typed_array_get_element(TypedArrayBase& typed_array, CanonicalIndex index)
+{
+    switch (typed_array.kind()) {
+#define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, Type) \
+    case TypedArrayBase::Kind::ClassName:                                           \
+        return integer_indexed_element_get<Type>(typed_array, index);
+        JS_ENUMERATE_TYPED_ARRAYS
+#undef __JS_ENUMERATE
+    }
+    VERIFY_NOT_REACHED();
+}
+
+static ThrowCompletionOr<void> typed_array_set_element(TypedArrayBase& typed_array, CanonicalIndex index, Value value)
+{
+    switch (typed_array.kind()) {
+#define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, Type) \
+    case TypedArrayBase::Kind::ClassName:                                           \
+        return integer_indexed_element_set<Type>(typed_array, index, value);
+        JS_ENUMERATE_TYPED_ARRAYS
+#undef __JS_ENUMERATE
+    }
+    VERIFY_NOT_REACHED();
+}
+
 ThrowCompletionOr<void> GetByValue::execute_impl(Bytecode::Interpreter& interpreter) const
 {
     auto& vm = interpreter.vm();
-    auto* object = TRY(interpreter.reg(m_base).to_object(vm));
+    auto base_value = interpreter.reg(m_base);
+
+    // Fast path: indexed access to a typed array. This skips the generic
+    // ToPropertyKey / CanonicalNumericIndexString machinery; the element
+    // accessor still performs the detach and bounds checks itself.
+    if (base_value.is_object() && base_value.as_object().is_typed_array() && interpreter.accumulator().is_int32() && interpreter.accumulator().as_i32() >= 0) {
+        auto& typed_array = static_cast<TypedArrayBase&>(base_value.as_object());
+        auto index = static_cast<u32>(interpreter.accumulator().as_i32());
+        interpreter.accumulator() = typed_array_get_element(typed_array, CanonicalIndex { CanonicalIndex::Type::Index, index });
+        return {};
+    }
+
+    auto* object = TRY(base_value.to_object(vm));
 
     auto property_key = TRY(interpreter.accumulator().to_property_key(vm));
 
@@ -855,9 +966,21 @@ ThrowCompletionOr<void> GetByValue::execute_impl(Bytecode::Interpreter& interpre
 ThrowCompletionOr<void> PutByValue::execute_impl(Bytecode::Interpreter& interpreter) const
 {
     auto& vm = interpreter.vm();
-    auto* object = TRY(interpreter.reg(m_base).to_object(vm));
+    auto base_value = interpreter.reg(m_base);
+    auto property_value = interpreter.reg(m_property);
+
+    // Fast path: indexed store to a typed array, analogous to the one in
+    // GetByValue::execute_impl() above.
+    if (m_kind == PropertyKind::KeyValue && base_value.is_object() && base_value.as_object().is_typed_array() && property_value.is_int32() && property_value.as_i32() >= 0) {
+        auto& typed_array = static_cast<TypedArrayBase&>(base_value.as_object());
+        auto index = static_cast<u32>(property_value.as_i32());
+        TRY(typed_array_set_element(typed_array, CanonicalIndex { CanonicalIndex::Type::Index, index }, interpreter.accumulator()));
+        return {};
+    }
+
+    auto* object = TRY(base_value.to_object(vm));
 
-    auto property_key = TRY(interpreter.reg(m_property).to_property_key(vm));
+    auto property_key = TRY(property_value.to_property_key(vm));
     return put_by_property_key(object, interpreter.accumulator(), property_key, interpreter, m_kind);
 }
 
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/HashMap.h>
+#include <LibJS/Bytecode/Op.h>
+#include <LibJS/Bytecode/PassManager.h>
+
+namespace JS::Bytecode::Passes {
+
+static NonnullOwnPtr<BasicBlock> fold_constants(BasicBlock const& block)
+{
+    // NOTE: Replacing a Load with a LoadImmediate can make an instruction a few
+    //       bytes longer, so give the new block a bit of headroom.
+    auto new_block = BasicBlock::create(block.name(), block.size() * 2);
+
+    // The constant (if any) we know the accumulator holds at this point.
+    Optional<Value> accumulator;
+    // The constants we know individual registers hold at this point.
+    HashMap<u32, Value> register_constants;
+    // The register (if any) that holds a copy of the current accumulator, so
+    // that `Store $reg; Load $reg` shuffles can drop the redundant Load.
+    Optional<u32> register_mirroring_accumulator;
+
+    for (auto it = InstructionStreamIterator(block.instruction_stream()); !it.at_end();) {
+        using enum Instruction::Type;
+
+        switch ((*it).type()) {
+        case LoadImmediate:
+            accumulator = static_cast<Op::LoadImmediate const&>(*it).value();
+            register_mirroring_accumulator.clear();
+            break;
+        case Store: {
+            auto const& store = static_cast<Op::Store const&>(*it);
+            if (accumulator.has_value())
+                register_constants.set(store.dst().index(), *accumulator);
+            else
+                register_constants.remove(store.dst().index());
+            register_mirroring_accumulator = store.dst().index();
+            break;
+        }
+        case Load: {
+            auto const& load = static_cast<Op::Load const&>(*it);
+
+            // The accumulator already holds this register's value, so the Load
+            // is a no-op and can be dropped entirely.
+            if (register_mirroring_accumulator.has_value() && *register_mirroring_accumulator == load.src().index()) {
+                ++it;
+                continue;
+            }
+
+            // If the register is known to hold a constant, load the constant
+            // directly instead of going through the register.
+            if (auto constant = register_constants.get(load.src().index()); constant.has_value()) {
+                new (new_block->next_slot()) Op::LoadImmediate(*constant);
+                new_block->grow(sizeof(Op::LoadImmediate));
+                accumulator = *constant;
+                register_mirroring_accumulator = load.src().index();
+                ++it;
+                continue;
+            }
+
+            accumulator.clear();
+            register_mirroring_accumulator = load.src().index();
+            break;
+        }
+        case JumpConditional:
+        case JumpNullish:
+        case JumpUndefined: {
+            // If the branch condition is a known constant, thread the jump:
+            // replace the conditional terminator with an unconditional Jump to
+            // whichever target would have been taken.
+            if (accumulator.has_value()) {
+                auto const& jump = static_cast<Op::Jump const&>(*it);
+                bool is_taken = false;
+                if ((*it).type() == JumpConditional)
+                    is_taken = accumulator->to_boolean();
+                else if ((*it).type() == JumpNullish)
+                    is_taken = accumulator->is_nullish();
+                else
+                    is_taken = accumulator->is_undefined();
+                auto target = is_taken ? jump.true_target() : jump.false_target();
+                VERIFY(target.has_value());
+                new (new_block->next_slot()) Op::Jump(*target);
+                reinterpret_cast<Instruction*>(new_block->next_slot())->replace_references(block, *new_block);
+                new_block->grow(sizeof(Op::Jump));
+                ++it;
+                continue;
+            }
+            break;
+        }
+        case NewBigInt:
+            // The only non-trivially-copyable instruction, so it needs to be
+            // copied via its copy constructor (see LoadElimination.cpp).
+            new (new_block->next_slot()) Op::NewBigInt(static_cast<Op::NewBigInt const&>(*it));
+            new_block->grow(sizeof(Op::NewBigInt));
+            accumulator.clear();
+            register_constants.clear();
+            register_mirroring_accumulator.clear();
+            ++it;
+            continue;
+        default:
+            // Anything else may clobber the accumulator or have side effects
+            // we can't see through, so forget everything we know.
+            accumulator.clear();
+            register_constants.clear();
+            register_mirroring_accumulator.clear();
+            break;
+        }
+
+        memcpy(new_block->next_slot(), &*it, (*it).length());
+        // Because we are replacing the current block, we need to replace
+        // references to ourselves here.
+        reinterpret_cast<Instruction*>(new_block->next_slot())->replace_references(block, *new_block);
+        new_block->grow((*it).length());
+
+        ++it;
+    }
+
+    return new_block;
+}
+
+void FoldConstants::perform(PassPipelineExecutable& executable)
+{
+    started();
+
+    for (auto it = executable.executable.basic_blocks.begin(); it != executable.executable.basic_blocks.end(); ++it) {
+        auto const& old_block = *it;
+        auto new_block = fold_constants(old_block);
+
+        // We will replace the old block with a new one, so we need to replace
+        // all references to the old one with the new one.
+        for (auto& block : executable.executable.basic_blocks) {
+            InstructionStreamIterator it { block.instruction_stream() };
+            while (!it.at_end()) {
+                auto& instruction = *it;
+                ++it;
+                const_cast<Instruction&>(instruction).replace_references(old_block, *new_block);
+            }
+        }
+
+        executable.executable.basic_blocks.ptr_at(it.index()) = move(new_block);
+    }
+
+    finished();
+}
+
+}
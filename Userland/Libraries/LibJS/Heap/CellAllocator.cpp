@@ -20,11 +20,15 @@ CellAllocator::CellAllocator(size_t cell_size)
 Cell* CellAllocator::allocate_cell(Heap& heap)
 {
     if (m_usable_blocks.is_empty()) {
-        auto block = HeapBlock::create_with_cell_size(heap, m_cell_size);
+        auto block = HeapBlock::create_with_cell_size(heap, *this, m_cell_size);
         m_usable_blocks.append(*block.leak_ptr());
     }
 
     auto& block = *m_usable_blocks.last();
+    // Reclaim any dead cells the last collection left behind, so we never
+    // hand out a cell that a deferred sweep would consider garbage.
+    if (block.is_pending_sweep())
+        heap.sweep_block({}, block);
     auto* cell = block.allocate();
     VERIFY(cell);
     if (block.is_full())
@@ -41,18 +41,7 @@ Heap::Heap(VM& vm)
     gc_perf_string_id = perf_register_string(gc_signpost_string.characters_without_null_termination(), gc_signpost_string.length());
 #endif
 
-    if constexpr (HeapBlock::min_possible_cell_size <= 16) {
-        m_allocators.append(make<CellAllocator>(16));
-    }
     static_assert(HeapBlock::min_possible_cell_size <= 24, "Heap Cell tracking uses too much data!");
-    m_allocators.append(make<CellAllocator>(32));
-    m_allocators.append(make<CellAllocator>(64));
-    m_allocators.append(make<CellAllocator>(96));
-    m_allocators.append(make<CellAllocator>(128));
-    m_allocators.append(make<CellAllocator>(256));
-    m_allocators.append(make<CellAllocator>(512));
-    m_allocators.append(make<CellAllocator>(1024));
-    m_allocators.append(make<CellAllocator>(3072));
 }
 
 Heap::~Heap()
@@ -62,29 +51,41 @@ Heap::~Heap()
     collect_garbage(CollectionType::CollectEverything);
 }
 
-ALWAYS_INLINE CellAllocator& Heap::allocator_for_size(size_t cell_size)
+size_t Heap::assign_cell_type_index()
 {
-    for (auto& allocator : m_allocators) {
-        if (allocator->cell_size() >= cell_size)
-            return *allocator;
-    }
-    dbgln("Cannot get CellAllocator for cell size {}, largest available is {}!", cell_size, m_allocators.last()->cell_size());
-    VERIFY_NOT_REACHED();
+    static size_t s_next_cell_type_index = 0;
+    return s_next_cell_type_index++;
 }
 
-Cell* Heap::allocate_cell(size_t size)
+Cell* Heap::allocate_cell(size_t size, size_t type_index)
 {
     if (should_collect_on_every_allocation()) {
         collect_garbage();
-    } else if (m_allocations_since_last_gc > m_max_allocations_between_gc) {
-        m_allocations_since_last_gc = 0;
+    } else if (m_bytes_allocated_since_last_gc > max(minimum_bytes_allocated_between_gcs, m_live_bytes_after_last_gc)) {
         collect_garbage();
-    } else {
-        ++m_allocations_since_last_gc;
     }
 
-    auto& allocator = allocator_for_size(size);
-    return allocator.allocate_cell(*this);
+    // Take a small slice of any sweeping work deferred by the last collection.
+    for (size_t i = 0; i < 2 && !m_blocks_pending_sweep.is_empty(); ++i) {
+        auto* block = m_blocks_pending_sweep.take_last();
+        if (block->is_pending_sweep())
+            sweep_block(*block, ReclaimEmptyBlock::Yes);
+    }
+
+    if (type_index >= m_allocator_for_type_index.size())
+        m_allocator_for_type_index.resize(type_index + 1);
+    auto*& allocator = m_allocator_for_type_index[type_index];
+    if (!allocator) {
+        // Cells are sized exactly for the type (rounded up for the cell
+        // bookkeeping at the front) rather than to a shared size class.
+        auto cell_size = align_up_to(max(size, HeapBlock::min_possible_cell_size), 16);
+        VERIFY(cell_size + sizeof(HeapBlock) <= HeapBlock::block_size);
+        m_allocators.append(make<CellAllocator>(cell_size));
+        allocator = m_allocators.last().ptr();
+    }
+
+    m_bytes_allocated_since_last_gc += allocator->cell_size();
+    return allocator->allocate_cell(*this);
 }
 
 void Heap::collect_garbage(CollectionType collection_type, bool print_report)
@@ -101,17 +102,70 @@ void Heap::collect_garbage(CollectionType collection_type, bool print_report)
     if (print_report)
         collection_measurement_timer.start();
 
+    if (collection_type == CollectionType::CollectGarbage && m_gc_deferrals) {
+        m_should_gc_when_deferral_ends = true;
+        return;
+    }
+
+    // Unswept blocks still carry the previous cycle's mark bits, so reclaim
+    // them before marking anew.
+    finish_pending_sweeps();
+
     if (collection_type == CollectionType::CollectGarbage) {
-        if (m_gc_deferrals) {
-            m_should_gc_when_deferral_ends = true;
-            return;
-        }
         HashTable<Cell*> roots;
         gather_roots(roots);
         mark_live_cells(roots);
     }
     finalize_unmarked_cells();
-    sweep_dead_cells(print_report, collection_measurement_timer);
+
+    // Weak containers are pruned before sweeping, since the sweep may be
+    // deferred past the point where the mutator resumes.
+    for (auto& weak_container : m_weak_containers)
+        weak_container.remove_dead_cells({});
+
+    if (collection_type == CollectionType::CollectGarbage && !print_report && !should_collect_on_every_allocation())
+        defer_sweeping();
+    else
+        sweep_dead_cells(print_report, collection_measurement_timer);
+}
+
+void Heap::defer_sweeping()
+{
+    VERIFY(m_blocks_pending_sweep.is_empty());
+    for_each_block([&](auto& block) {
+        block.set_pending_sweep(true);
+        m_blocks_pending_sweep.append(&block);
+        return IterationDecision::Continue;
+    });
+}
+
+void Heap::finish_pending_sweeps()
+{
+    while (!m_blocks_pending_sweep.is_empty()) {
+        auto* block = m_blocks_pending_sweep.take_last();
+        if (block->is_pending_sweep())
+            sweep_block(*block, ReclaimEmptyBlock::Yes);
+    }
+}
+
+void Heap::sweep_block(HeapBlock& block, ReclaimEmptyBlock reclaim)
+{
+    block.set_pending_sweep(false);
+    bool block_has_live_cells = false;
+    bool block_was_full = block.is_full();
+    block.for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
+        if (!cell->is_marked() && !cell_must_survive_garbage_collection(*cell)) {
+            dbgln_if(HEAP_DEBUG, "  ~ {}", cell);
+            block.deallocate(cell);
+        } else {
+            cell->set_marked(false);
+            block_has_live_cells = true;
+        }
+    });
+    if (reclaim == ReclaimEmptyBlock::Yes && !block_has_live_cells)
+        block.allocator().block_did_become_empty({}, block);
+    else if (block_was_full && !block.is_full())
+        block.allocator().block_did_become_usable({}, block);
 }
 
 void Heap::gather_roots(HashTable<Cell*>& roots)
@@ -259,13 +313,25 @@ bool Heap::cell_must_survive_garbage_collection(Cell const& cell)
 
 void Heap::finalize_unmarked_cells()
 {
+    size_t live_cell_bytes = 0;
     for_each_block([&](auto& block) {
-        block.template for_each_cell_in_state<Cell::State::Live>([](Cell* cell) {
+        block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
             if (!cell->is_marked() && !cell_must_survive_garbage_collection(*cell))
                 cell->finalize();
+            else
+                live_cell_bytes += block.cell_size();
         });
         return IterationDecision::Continue;
     });
+    m_live_bytes_after_last_gc = live_cell_bytes;
+    m_bytes_allocated_since_last_gc = 0;
+}
+
+bool Heap::cell_survived_garbage_collection(Cell const& cell)
+{
+    if (cell.state() != Cell::State::Live)
+        return false;
+    return cell.is_marked() || cell_must_survive_garbage_collection(cell);
 }
 
 void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measurement_timer)
@@ -302,17 +368,14 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
         return IterationDecision::Continue;
     });
 
-    for (auto& weak_container : m_weak_containers)
-        weak_container.remove_dead_cells({});
-
     for (auto* block : empty_blocks) {
         dbgln_if(HEAP_DEBUG, " - HeapBlock empty @ {}: cell_size={}", block, block->cell_size());
-        allocator_for_size(block->cell_size()).block_did_become_empty({}, *block);
+        block->allocator().block_did_become_empty({}, *block);
     }
 
     for (auto* block : full_blocks_that_became_usable) {
         dbgln_if(HEAP_DEBUG, " - HeapBlock usable again @ {}: cell_size={}", block, block->cell_size());
-        allocator_for_size(block->cell_size()).block_did_become_usable({}, *block);
+        block->allocator().block_did_become_usable({}, *block);
     }
 
     if constexpr (HEAP_DEBUG) {
@@ -35,7 +35,7 @@ public:
     template<typename T, typename... Args>
     NonnullGCPtr<T> allocate_without_realm(Args&&... args)
     {
-        auto* memory = allocate_cell(sizeof(T));
+        auto* memory = allocate_cell(sizeof(T), cell_type_index<T>());
         new (memory) T(forward<Args>(args)...);
         return *static_cast<T*>(memory);
     }
@@ -43,7 +43,7 @@ public:
     template<typename T, typename... Args>
     NonnullGCPtr<T> allocate(Realm& realm, Args&&... args)
     {
-        auto* memory = allocate_cell(sizeof(T));
+        auto* memory = allocate_cell(sizeof(T), cell_type_index<T>());
         new (memory) T(forward<Args>(args)...);
         auto* cell = static_cast<T*>(memory);
         memory->initialize(realm);
@@ -78,10 +78,42 @@ public:
 
     void uproot_cell(Cell* cell);
 
+    // Reclaims the dead cells in one block. Sweeping may be deferred past the
+    // end of a collection cycle, in which case blocks are swept a few at a
+    // time as the mutator allocates; an allocator must sweep a pending block
+    // before handing out cells from it.
+    enum class ReclaimEmptyBlock {
+        No,
+        Yes,
+    };
+    void sweep_block(Badge<CellAllocator>, HeapBlock& block) { sweep_block(block, ReclaimEmptyBlock::No); }
+
+    // Tells whether a cell survived the current collection cycle. Only
+    // meaningful while weak containers are pruned, which happens after
+    // marking but before dead cells are swept.
+    static bool cell_survived_garbage_collection(Cell const&);
+
 private:
     static bool cell_must_survive_garbage_collection(Cell const&);
 
-    Cell* allocate_cell(size_t);
+    Cell* allocate_cell(size_t size, size_t type_index);
+
+    // Every cell type allocates from its own pool of blocks, so instances of
+    // one type sit densely together (a big deal for tree traversals over DOM
+    // and layout nodes) instead of interleaving with whatever else happens to
+    // share a size class. Type indices are handed out process-wide on first
+    // allocation; each heap creates the matching allocator lazily.
+    static size_t assign_cell_type_index();
+    template<typename T>
+    static size_t cell_type_index()
+    {
+        static size_t index = assign_cell_type_index();
+        return index;
+    }
+
+    void sweep_block(HeapBlock&, ReclaimEmptyBlock);
+    void defer_sweeping();
+    void finish_pending_sweeps();
 
     void gather_roots(HashTable<Cell*>&);
     void gather_conservative_roots(HashTable<Cell*>&);
@@ -89,8 +121,6 @@ private:
     void finalize_unmarked_cells();
     void sweep_dead_cells(bool print_report, Core::ElapsedTimer const&);
 
-    CellAllocator& allocator_for_size(size_t);
-
     template<typename Callback>
     void for_each_block(Callback callback)
     {
@@ -100,14 +130,20 @@ private:
         }
     }
 
-    size_t m_max_allocations_between_gc { 100000 };
-    size_t m_allocations_since_last_gc { 0 };
+    // GC scheduling: we collect when the heap has grown by at least as many
+    // bytes as were live after the previous collection (with a floor for
+    // small heaps), so mark+sweep work stays proportional to allocation
+    // volume instead of firing full collections at a fixed allocation count.
+    static constexpr size_t minimum_bytes_allocated_between_gcs = 4 * MiB;
+    size_t m_bytes_allocated_since_last_gc { 0 };
+    size_t m_live_bytes_after_last_gc { 0 };
 
     bool m_should_collect_on_every_allocation { false };
 
     VM& m_vm;
 
     Vector<NonnullOwnPtr<CellAllocator>> m_allocators;
+    Vector<CellAllocator*> m_allocator_for_type_index;
 
     HandleImpl::List m_handles;
     MarkedVectorBase::List m_marked_vectors;
@@ -115,6 +151,10 @@ private:
 
     Vector<Cell*> m_uprooted_cells;
 
+    // Blocks from the last collection cycle that still have dead cells to
+    // reclaim; drained incrementally to keep collection pauses short.
+    Vector<HeapBlock*> m_blocks_pending_sweep;
+
     BlockAllocator m_block_allocator;
 
     size_t m_gc_deferrals { 0 };
@@ -25,7 +25,11 @@ class HeapBlock {
 
 public:
     static constexpr size_t block_size = 16 * KiB;
-    static NonnullOwnPtr<HeapBlock> create_with_cell_size(Heap&, size_t);
+    static NonnullOwnPtr<HeapBlock> create_with_cell_size(Heap&, CellAllocator&, size_t);
+
+    // The allocator this block belongs to. Allocators are per cell type, so
+    // the block's cell size alone no longer identifies it.
+    CellAllocator& allocator() const { return m_allocator; }
 
     size_t cell_size() const { return m_cell_size; }
     size_t cell_count() const { return (block_size - sizeof(HeapBlock)) / m_cell_size; }
@@ -68,6 +72,11 @@ public:
 
     Heap& heap() { return m_heap; }
 
+    // Set while the block has dead cells from the last collection cycle that
+    // have not been reclaimed yet; see Heap::sweep_block().
+    bool is_pending_sweep() const { return m_pending_sweep; }
+    void set_pending_sweep(bool pending_sweep) { m_pending_sweep = pending_sweep; }
+
     static HeapBlock* from_cell(Cell const* cell)
     {
         return reinterpret_cast<HeapBlock*>((FlatPtr)cell & ~(block_size - 1));
@@ -92,7 +101,7 @@ public:
     IntrusiveListNode<HeapBlock> m_list_node;
 
 private:
-    HeapBlock(Heap&, size_t cell_size);
+    HeapBlock(Heap&, CellAllocator&, size_t cell_size);
 
     bool has_lazy_freelist() const { return m_next_lazy_freelist_index < cell_count(); }
 
@@ -108,7 +117,9 @@ private:
     }
 
     Heap& m_heap;
+    CellAllocator& m_allocator;
     size_t m_cell_size { 0 };
+    bool m_pending_sweep { false };
     size_t m_next_lazy_freelist_index { 0 };
     FreelistEntry* m_freelist { nullptr };
     alignas(Cell) u8 m_storage[];
@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/BitCast.h>
+#include <AK/HashMap.h>
+#include <AK/Platform.h>
+#include <LibJS/JIT/Compiler.h>
+
+#if ARCH(X86_64)
+
+#include <LibJIT/Assembler.h>
+#include <LibJS/Bytecode/Instruction.h>
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Bytecode/Op.h>
+
+namespace JS::JIT {
+
+using Assembler = ::JIT::Assembler;
+using Reg = Assembler::Reg;
+
+// Callee-saved registers that hold the interpreter and the register file for
+// the duration of the generated code.
+static constexpr auto interpreter_reg = Reg::RBX;
+static constexpr auto register_file_reg = Reg::R12;
+
+// Runs one instruction through the interpreter's regular dispatch. Returns
+// nonzero if the instruction threw; the exception is parked in the
+// interpreter for the caller of the generated code to pick up.
+static u64 cxx_execute_instruction(Bytecode::Interpreter& interpreter, Bytecode::Instruction const& instruction)
+{
+    auto result = instruction.execute(interpreter);
+    if (result.is_error()) {
+        interpreter.save_exception(*result.throw_completion().value());
+        return 1;
+    }
+    return 0;
+}
+
+static u64 cxx_accumulator_to_boolean(Bytecode::Interpreter& interpreter)
+{
+    return interpreter.accumulator().to_boolean();
+}
+
+static u64 cxx_accumulator_is_nullish(Bytecode::Interpreter& interpreter)
+{
+    return interpreter.accumulator().is_nullish();
+}
+
+static u64 cxx_accumulator_is_undefined(Bytecode::Interpreter& interpreter)
+{
+    return interpreter.accumulator().is_undefined();
+}
+
+static void emit_execute_instruction_call(Assembler& assembler, Bytecode::Instruction const& instruction)
+{
+    assembler.mov(Reg::RDI, interpreter_reg);
+    assembler.mov(Reg::RSI, bit_cast<u64>(&instruction));
+    assembler.mov(Reg::RAX, bit_cast<u64>(&cxx_execute_instruction));
+    assembler.call(Reg::RAX);
+}
+
+static void emit_accumulator_predicate_call(Assembler& assembler, u64 predicate)
+{
+    assembler.mov(Reg::RDI, interpreter_reg);
+    assembler.mov(Reg::RAX, predicate);
+    assembler.call(Reg::RAX);
+}
+
+OwnPtr<::JIT::NativeExecutable> Compiler::compile(Bytecode::Executable const& executable)
+{
+    static_assert(sizeof(Value) == sizeof(u64));
+
+    // First pass: bail on anything the baseline tier cannot express natively.
+    // Unwind contexts need the interpreter's exception dispatch, and yields
+    // need re-entry at arbitrary blocks.
+    for (auto& block : executable.basic_blocks) {
+        Bytecode::InstructionStreamIterator it { block.instruction_stream() };
+        while (!it.at_end()) {
+            switch ((*it).type()) {
+            case Bytecode::Instruction::Type::ContinuePendingUnwind:
+            case Bytecode::Instruction::Type::EnterUnwindContext:
+            case Bytecode::Instruction::Type::LeaveUnwindContext:
+            case Bytecode::Instruction::Type::Yield:
+                return nullptr;
+            default:
+                break;
+            }
+            ++it;
+        }
+    }
+
+    Vector<u8> code;
+    Assembler assembler { code };
+
+    Vector<Assembler::Label> block_labels;
+    block_labels.resize(executable.basic_blocks.size());
+    HashMap<Bytecode::BasicBlock const*, size_t> block_indices;
+    for (size_t i = 0; i < executable.basic_blocks.size(); ++i)
+        block_indices.set(&executable.basic_blocks[i], i);
+
+    auto label_for = [&](Bytecode::BasicBlock const& block) -> Assembler::Label& {
+        return block_labels[*block_indices.get(&block)];
+    };
+
+    Assembler::Label exit_label;
+
+    assembler.push(Reg::RBP);
+    assembler.mov(Reg::RBP, Reg::RSP);
+    assembler.push(interpreter_reg);
+    assembler.push(register_file_reg);
+    assembler.mov(interpreter_reg, Reg::RDI);
+    assembler.mov(register_file_reg, Reg::RSI);
+
+    auto accumulator_offset = static_cast<i32>(Bytecode::Register::accumulator_index * sizeof(Value));
+
+    for (size_t i = 0; i < executable.basic_blocks.size(); ++i) {
+        auto& block = executable.basic_blocks[i];
+        block_labels[i].link(assembler);
+
+        bool block_is_terminated = false;
+        Bytecode::InstructionStreamIterator it { block.instruction_stream() };
+        while (!it.at_end()) {
+            auto& instruction = *it;
+            switch (instruction.type()) {
+            case Bytecode::Instruction::Type::Load: {
+                auto& op = static_cast<Bytecode::Op::Load const&>(instruction);
+                assembler.load(Reg::RAX, register_file_reg, static_cast<i32>(op.src().index() * sizeof(Value)));
+                assembler.store(register_file_reg, accumulator_offset, Reg::RAX);
+                break;
+            }
+            case Bytecode::Instruction::Type::Store: {
+                auto& op = static_cast<Bytecode::Op::Store const&>(instruction);
+                assembler.load(Reg::RAX, register_file_reg, accumulator_offset);
+                assembler.store(register_file_reg, static_cast<i32>(op.dst().index() * sizeof(Value)), Reg::RAX);
+                break;
+            }
+            case Bytecode::Instruction::Type::LoadImmediate: {
+                auto& op = static_cast<Bytecode::Op::LoadImmediate const&>(instruction);
+                assembler.mov(Reg::RAX, bit_cast<u64>(op.value()));
+                assembler.store(register_file_reg, accumulator_offset, Reg::RAX);
+                break;
+            }
+            case Bytecode::Instruction::Type::Jump: {
+                auto& op = static_cast<Bytecode::Op::Jump const&>(instruction);
+                assembler.jump(label_for(op.true_target()->block()));
+                break;
+            }
+            case Bytecode::Instruction::Type::JumpConditional:
+            case Bytecode::Instruction::Type::JumpNullish:
+            case Bytecode::Instruction::Type::JumpUndefined: {
+                auto& op = static_cast<Bytecode::Op::Jump const&>(instruction);
+                u64 predicate = 0;
+                if (instruction.type() == Bytecode::Instruction::Type::JumpConditional)
+                    predicate = bit_cast<u64>(&cxx_accumulator_to_boolean);
+                else if (instruction.type() == Bytecode::Instruction::Type::JumpNullish)
+                    predicate = bit_cast<u64>(&cxx_accumulator_is_nullish);
+                else
+                    predicate = bit_cast<u64>(&cxx_accumulator_is_undefined);
+                emit_accumulator_predicate_call(assembler, predicate);
+                assembler.test(Reg::RAX, Reg::RAX);
+                assembler.jump_if_not_zero(label_for(op.true_target()->block()));
+                assembler.jump(label_for(op.false_target()->block()));
+                break;
+            }
+            case Bytecode::Instruction::Type::Return:
+            case Bytecode::Instruction::Type::Throw:
+                // Both park their result in the interpreter; the caller of
+                // the generated code sorts out which one it was.
+                emit_execute_instruction_call(assembler, instruction);
+                assembler.jump(exit_label);
+                break;
+            default:
+                emit_execute_instruction_call(assembler, instruction);
+                assembler.test(Reg::RAX, Reg::RAX);
+                assembler.jump_if_not_zero(exit_label);
+                break;
+            }
+            block_is_terminated = instruction.is_terminator();
+            ++it;
+        }
+
+        // A block may end without a terminator; the interpreter treats that
+        // as falling off the end of the program.
+        if (!block_is_terminated)
+            assembler.jump(exit_label);
+    }
+
+    exit_label.link(assembler);
+    assembler.pop(register_file_reg);
+    assembler.pop(interpreter_reg);
+    assembler.pop(Reg::RBP);
+    assembler.ret();
+
+    auto executable_memory = ::JIT::NativeExecutable::create(code);
+    if (executable_memory.is_error())
+        return nullptr;
+    return executable_memory.release_value();
+}
+
+}
+
+#else
+
+namespace JS::JIT {
+
+OwnPtr<::JIT::NativeExecutable> Compiler::compile(Bytecode::Executable const&)
+{
+    return nullptr;
+}
+
+}
+
+#endif
@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/OwnPtr.h>
+#include <LibJIT/NativeExecutable.h>
+#include <LibJS/Forward.h>
+
+namespace JS::JIT {
+
+// Signature of the generated code: it runs the whole executable against the
+// given interpreter and register file, leaving the result in the
+// interpreter's return value / saved exception slots.
+using NativeEntry = void (*)(Bytecode::Interpreter&, Value* register_file);
+
+class Compiler {
+public:
+    static constexpr size_t invocation_threshold = 100;
+
+    // Compiles an executable to native code, or returns nullptr if it uses
+    // bytecode the baseline tier doesn't understand (unwind contexts and
+    // generators stay on the interpreter).
+    static OwnPtr<::JIT::NativeExecutable> compile(Bytecode::Executable const&);
+};
+
+}
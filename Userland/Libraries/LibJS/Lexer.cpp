@@ -10,13 +10,58 @@
 #include <AK/Debug.h>
 #include <AK/GenericLexer.h>
 #include <AK/HashMap.h>
+#include <AK/StringSwitch.h>
 #include <AK/Utf8View.h>
 #include <LibUnicode/CharacterTypes.h>
 #include <stdio.h>
 
 namespace JS {
 
-HashMap<DeprecatedFlyString, TokenType> Lexer::s_keywords;
+// Keyword dispatch is a compile-time perfect hash: one hash of the candidate
+// identifier and one comparison against the only keyword it could be.
+static constexpr auto s_keywords = StringSwitch {
+    StringSwitchCase { "async"sv, TokenType::Async },
+    StringSwitchCase { "await"sv, TokenType::Await },
+    StringSwitchCase { "break"sv, TokenType::Break },
+    StringSwitchCase { "case"sv, TokenType::Case },
+    StringSwitchCase { "catch"sv, TokenType::Catch },
+    StringSwitchCase { "class"sv, TokenType::Class },
+    StringSwitchCase { "const"sv, TokenType::Const },
+    StringSwitchCase { "continue"sv, TokenType::Continue },
+    StringSwitchCase { "debugger"sv, TokenType::Debugger },
+    StringSwitchCase { "default"sv, TokenType::Default },
+    StringSwitchCase { "delete"sv, TokenType::Delete },
+    StringSwitchCase { "do"sv, TokenType::Do },
+    StringSwitchCase { "else"sv, TokenType::Else },
+    StringSwitchCase { "enum"sv, TokenType::Enum },
+    StringSwitchCase { "export"sv, TokenType::Export },
+    StringSwitchCase { "extends"sv, TokenType::Extends },
+    StringSwitchCase { "false"sv, TokenType::BoolLiteral },
+    StringSwitchCase { "finally"sv, TokenType::Finally },
+    StringSwitchCase { "for"sv, TokenType::For },
+    StringSwitchCase { "function"sv, TokenType::Function },
+    StringSwitchCase { "if"sv, TokenType::If },
+    StringSwitchCase { "import"sv, TokenType::Import },
+    StringSwitchCase { "in"sv, TokenType::In },
+    StringSwitchCase { "instanceof"sv, TokenType::Instanceof },
+    StringSwitchCase { "let"sv, TokenType::Let },
+    StringSwitchCase { "new"sv, TokenType::New },
+    StringSwitchCase { "null"sv, TokenType::NullLiteral },
+    StringSwitchCase { "return"sv, TokenType::Return },
+    StringSwitchCase { "super"sv, TokenType::Super },
+    StringSwitchCase { "switch"sv, TokenType::Switch },
+    StringSwitchCase { "this"sv, TokenType::This },
+    StringSwitchCase { "throw"sv, TokenType::Throw },
+    StringSwitchCase { "true"sv, TokenType::BoolLiteral },
+    StringSwitchCase { "try"sv, TokenType::Try },
+    StringSwitchCase { "typeof"sv, TokenType::Typeof },
+    StringSwitchCase { "var"sv, TokenType::Var },
+    StringSwitchCase { "void"sv, TokenType::Void },
+    StringSwitchCase { "while"sv, TokenType::While },
+    StringSwitchCase { "with"sv, TokenType::With },
+    StringSwitchCase { "yield"sv, TokenType::Yield },
+};
+
 HashMap<DeprecatedString, TokenType> Lexer::s_three_char_tokens;
 HashMap<DeprecatedString, TokenType> Lexer::s_two_char_tokens;
 HashMap<char, TokenType> Lexer::s_single_char_tokens;
@@ -29,49 +74,6 @@ Lexer::Lexer(StringView source, StringView filename, size_t line_number, size_t
     , m_line_column(line_column)
     , m_parsed_identifiers(adopt_ref(*new ParsedIdentifiers))
 {
-    if (s_keywords.is_empty()) {
-        s_keywords.set("async", TokenType::Async);
-        s_keywords.set("await", TokenType::Await);
-        s_keywords.set("break", TokenType::Break);
-        s_keywords.set("case", TokenType::Case);
-        s_keywords.set("catch", TokenType::Catch);
-        s_keywords.set("class", TokenType::Class);
-        s_keywords.set("const", TokenType::Const);
-        s_keywords.set("continue", TokenType::Continue);
-        s_keywords.set("debugger", TokenType::Debugger);
-        s_keywords.set("default", TokenType::Default);
-        s_keywords.set("delete", TokenType::Delete);
-        s_keywords.set("do", TokenType::Do);
-        s_keywords.set("else", TokenType::Else);
-        s_keywords.set("enum", TokenType::Enum);
-        s_keywords.set("export", TokenType::Export);
-        s_keywords.set("extends", TokenType::Extends);
-        s_keywords.set("false", TokenType::BoolLiteral);
-        s_keywords.set("finally", TokenType::Finally);
-        s_keywords.set("for", TokenType::For);
-        s_keywords.set("function", TokenType::Function);
-        s_keywords.set("if", TokenType::If);
-        s_keywords.set("import", TokenType::Import);
-        s_keywords.set("in", TokenType::In);
-        s_keywords.set("instanceof", TokenType::Instanceof);
-        s_keywords.set("let", TokenType::Let);
-        s_keywords.set("new", TokenType::New);
-        s_keywords.set("null", TokenType::NullLiteral);
-        s_keywords.set("return", TokenType::Return);
-        s_keywords.set("super", TokenType::Super);
-        s_keywords.set("switch", TokenType::Switch);
-        s_keywords.set("this", TokenType::This);
-        s_keywords.set("throw", TokenType::Throw);
-        s_keywords.set("true", TokenType::BoolLiteral);
-        s_keywords.set("try", TokenType::Try);
-        s_keywords.set("typeof", TokenType::Typeof);
-        s_keywords.set("var", TokenType::Var);
-        s_keywords.set("void", TokenType::Void);
-        s_keywords.set("while", TokenType::While);
-        s_keywords.set("with", TokenType::With);
-        s_keywords.set("yield", TokenType::Yield);
-    }
-
     if (s_three_char_tokens.is_empty()) {
         s_three_char_tokens.set("===", TokenType::EqualsEqualsEquals);
         s_three_char_tokens.set("!==", TokenType::ExclamationMarkEqualsEquals);
@@ -667,11 +669,11 @@ Token Lexer::next()
         identifier = builder.string_view();
         m_parsed_identifiers->identifiers.set(*identifier);
 
-        auto it = s_keywords.find(identifier->hash(), [&](auto& entry) { return entry.key == identifier; });
-        if (it == s_keywords.end())
+        auto keyword_token_type = s_keywords.get(identifier->view());
+        if (!keyword_token_type.has_value())
             token_type = TokenType::Identifier;
         else
-            token_type = has_escaped_character ? TokenType::EscapedKeyword : it->value;
+            token_type = has_escaped_character ? TokenType::EscapedKeyword : keyword_token_type.value();
     } else if (is_numeric_literal_start()) {
         token_type = TokenType::NumericLiteral;
         bool is_invalid_numeric_literal = false;
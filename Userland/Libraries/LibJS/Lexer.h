@@ -79,7 +79,6 @@ private:
 
     Optional<size_t> m_hit_invalid_unicode;
 
-    static HashMap<DeprecatedFlyString, TokenType> s_keywords;
     static HashMap<DeprecatedString, TokenType> s_three_char_tokens;
     static HashMap<DeprecatedString, TokenType> s_two_char_tokens;
     static HashMap<char, TokenType> s_single_char_tokens;
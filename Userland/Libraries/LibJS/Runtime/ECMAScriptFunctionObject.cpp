@@ -85,6 +85,28 @@ ECMAScriptFunctionObject::ECMAScriptFunctionObject(DeprecatedFlyString name, Dep
     // 15. Set F.[[ScriptOrModule]] to GetActiveScriptOrModule().
     m_script_or_module = vm().get_active_script_or_module();
 
+    // NOTE: An arrow function that takes no parameters, declares no bindings of its own, and
+    //       contains no direct eval() can never observe or mutate a FunctionEnvironment:
+    //       `this`, `arguments`, `new.target` and `super` all resolve through the outer scope,
+    //       and FunctionDeclarationInstantiation has nothing to bind. Detecting that here lets
+    //       prepare_for_ordinary_call() skip one GC allocation per call.
+    if (m_this_mode == ThisMode::Lexical
+        && m_kind == FunctionKind::Normal
+        && !m_contains_direct_call_to_eval
+        && m_formal_parameters.is_empty()
+        && m_class_field_initializer_name.has<Empty>()
+        && m_environment) {
+        bool has_declarations = false;
+        if (is<ScopeNode>(*m_ecmascript_code)) {
+            auto const& scope_body = static_cast<ScopeNode const&>(*m_ecmascript_code);
+            has_declarations = scope_body.has_lexical_declarations()
+                || scope_body.has_var_declarations()
+                || scope_body.has_functions_hoistable_with_annexB_extension();
+        }
+        if (!has_declarations)
+            m_function_environment_needed = false;
+    }
+
     // 15.1.3 Static Semantics: IsSimpleParameterList, https://tc39.es/ecma262/#sec-static-semantics-issimpleparameterlist
     m_has_simple_parameter_list = all_of(m_formal_parameters, [&](auto& parameter) {
         if (parameter.is_rest)
@@ -622,7 +644,14 @@ ThrowCompletionOr<void> ECMAScriptFunctionObject::prepare_for_ordinary_call(Exec
     callee_context.script_or_module = m_script_or_module;
 
     // 7. Let localEnv be NewFunctionEnvironment(F, newTarget).
-    auto local_environment = new_function_environment(*this, new_target);
+    // NOTE: If the constructor determined that this function can never use or mutate a
+    //       FunctionEnvironment, we let the callee run directly in [[Environment]] instead
+    //       of allocating an empty environment record on every call.
+    Environment* local_environment = nullptr;
+    if (m_function_environment_needed)
+        local_environment = new_function_environment(*this, new_target);
+    else
+        local_environment = m_environment;
 
     // 8. Set the LexicalEnvironment of calleeContext to localEnv.
     callee_context.lexical_environment = local_environment;
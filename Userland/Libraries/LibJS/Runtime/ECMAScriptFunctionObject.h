@@ -131,6 +131,7 @@ private:
     bool m_contains_direct_call_to_eval : 1 { true };
     bool m_is_arrow_function : 1 { false };
     bool m_has_simple_parameter_list : 1 { false };
+    bool m_function_environment_needed : 1 { true };
     FunctionKind m_kind : 3 { FunctionKind::Normal };
 };
 
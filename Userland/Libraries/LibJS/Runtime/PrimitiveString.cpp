@@ -273,8 +273,21 @@ ThrowCompletionOr<void> PrimitiveString::resolve_rope_if_needed() const
         TRY_OR_THROW_OOM(vm, pieces.try_append(current));
     }
 
+    // We know the byte length of every piece that already has a UTF-8 or byte
+    // string representation, so reserve that much up front; for big
+    // concatenations this saves the builder a series of grow-and-copy cycles.
+    size_t capacity_estimate = 0;
+    for (auto const* current : pieces) {
+        if (current->has_utf8_string())
+            capacity_estimate += current->m_utf8_string->bytes_as_string_view().length();
+        else if (current->has_deprecated_string())
+            capacity_estimate += current->m_deprecated_string->length();
+        else if (current->has_utf16_string())
+            capacity_estimate += current->m_utf16_string->length_in_code_units();
+    }
+
     // Now that we have all the pieces, we can concatenate them using a StringBuilder.
-    ThrowableStringBuilder builder(vm);
+    ThrowableStringBuilder builder(vm, capacity_estimate);
 
     // We keep track of the previous piece in order to handle surrogate pairs spread across two pieces.
     PrimitiveString const* previous = nullptr;
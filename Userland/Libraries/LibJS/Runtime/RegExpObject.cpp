@@ -5,6 +5,7 @@
  */
 
 #include <AK/Function.h>
+#include <AK/HashMap.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/PrimitiveString.h>
@@ -16,6 +17,39 @@
 
 namespace JS {
 
+// Pages tend to construct the same regex over and over (often in a loop), and
+// running the LibRegex parser and bytecode generator each time is expensive.
+// We keep the parse results of recently constructed regexes in a process-wide
+// cache keyed by (pattern, flags); on a hit, only the compiled bytecode needs
+// to be copied into the new Regex.
+struct CachedRegexKey {
+    DeprecatedString pattern;
+    DeprecatedString flags;
+    bool operator==(CachedRegexKey const&) const = default;
+};
+
+struct CachedRegex {
+    DeprecatedString parsed_pattern;
+    regex::Parser::Result parser_result;
+};
+
+}
+
+template<>
+struct AK::Traits<JS::CachedRegexKey> : public AK::GenericTraits<JS::CachedRegexKey> {
+    static unsigned hash(JS::CachedRegexKey const& key) { return pair_int_hash(key.pattern.hash(), key.flags.hash()); }
+};
+
+namespace JS {
+
+static constexpr size_t max_cached_regex_count = 1024;
+
+static HashMap<CachedRegexKey, CachedRegex>& regex_cache()
+{
+    static HashMap<CachedRegexKey, CachedRegex> s_regex_cache;
+    return s_regex_cache;
+}
+
 Result<regex::RegexOptions<ECMAScriptFlags>, DeprecatedString> regex_flags_from_string(StringView flags)
 {
     bool d = false, g = false, i = false, m = false, s = false, u = false, y = false, v = false;
@@ -188,26 +222,38 @@ ThrowCompletionOr<NonnullGCPtr<RegExpObject>> RegExpObject::regexp_initialize(VM
         return vm.throw_completion<SyntaxError>(parsed_flags_or_error.release_error());
     auto parsed_flags = parsed_flags_or_error.release_value();
 
-    auto parsed_pattern = DeprecatedString::empty();
-    if (!pattern.is_empty()) {
-        bool unicode = parsed_flags.has_flag_set(regex::ECMAScriptFlags::Unicode);
-        bool unicode_sets = parsed_flags.has_flag_set(regex::ECMAScriptFlags::UnicodeSets);
-
-        // 11. If u is true, then
-        //     a. Let patternText be StringToCodePoints(P).
-        // 12. Else,
-        //     a. Let patternText be the result of interpreting each of P's 16-bit elements as a Unicode BMP code point. UTF-16 decoding is not applied to the elements.
-        // 13. Let parseResult be ParsePattern(patternText, u, v).
-        parsed_pattern = TRY(parse_regex_pattern(vm, pattern, unicode, unicode_sets));
-    }
+    auto cache_key = CachedRegexKey { pattern, flags };
+    Optional<Regex<ECMA262>> regex;
+    if (auto it = regex_cache().find(cache_key); it != regex_cache().end()) {
+        // We have compiled this (pattern, flags) pair before, so we can reuse
+        // its parse result instead of running the parser again.
+        regex = Regex<ECMA262>(it->value.parser_result, it->value.parsed_pattern, parsed_flags);
+    } else {
+        auto parsed_pattern = DeprecatedString::empty();
+        if (!pattern.is_empty()) {
+            bool unicode = parsed_flags.has_flag_set(regex::ECMAScriptFlags::Unicode);
+            bool unicode_sets = parsed_flags.has_flag_set(regex::ECMAScriptFlags::UnicodeSets);
+
+            // 11. If u is true, then
+            //     a. Let patternText be StringToCodePoints(P).
+            // 12. Else,
+            //     a. Let patternText be the result of interpreting each of P's 16-bit elements as a Unicode BMP code point. UTF-16 decoding is not applied to the elements.
+            // 13. Let parseResult be ParsePattern(patternText, u, v).
+            parsed_pattern = TRY(parse_regex_pattern(vm, pattern, unicode, unicode_sets));
+        }
+
+        // 14. If parseResult is a non-empty List of SyntaxError objects, throw a SyntaxError exception.
+        regex = Regex<ECMA262>(move(parsed_pattern), parsed_flags);
+        if (regex->parser_result.error != regex::Error::NoError)
+            return vm.throw_completion<SyntaxError>(ErrorType::RegExpCompileError, regex->error_string());
 
-    // 14. If parseResult is a non-empty List of SyntaxError objects, throw a SyntaxError exception.
-    Regex<ECMA262> regex(move(parsed_pattern), parsed_flags);
-    if (regex.parser_result.error != regex::Error::NoError)
-        return vm.throw_completion<SyntaxError>(ErrorType::RegExpCompileError, regex.error_string());
+        if (regex_cache().size() >= max_cached_regex_count)
+            regex_cache().remove(regex_cache().begin());
+        regex_cache().set(move(cache_key), { regex->pattern_value, regex->parser_result });
+    }
 
     // 15. Assert: parseResult is a Pattern Parse Node.
-    VERIFY(regex.parser_result.error == regex::Error::NoError);
+    VERIFY(regex->parser_result.error == regex::Error::NoError);
 
     // 16. Set obj.[[OriginalSource]] to P.
     m_pattern = move(pattern);
@@ -219,7 +265,7 @@ ThrowCompletionOr<NonnullGCPtr<RegExpObject>> RegExpObject::regexp_initialize(VM
     // 19. Let rer be the RegExp Record { [[IgnoreCase]]: i, [[Multiline]]: m, [[DotAll]]: s, [[Unicode]]: u, [[CapturingGroupsCount]]: capturingGroupsCount }.
     // 20. Set obj.[[RegExpRecord]] to rer.
     // 21. Set obj.[[RegExpMatcher]] to CompilePattern of parseResult with argument rer.
-    m_regex = move(regex);
+    m_regex = regex.release_value();
 
     // 22. Perform ? Set(obj, "lastIndex", +0𝔽, true).
     TRY(set(vm.names.lastIndex, Value(0), Object::ShouldThrowExceptions::Yes));
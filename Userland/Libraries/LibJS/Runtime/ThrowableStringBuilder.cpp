@@ -14,6 +14,12 @@ ThrowableStringBuilder::ThrowableStringBuilder(VM& vm)
 {
 }
 
+ThrowableStringBuilder::ThrowableStringBuilder(VM& vm, size_t initial_capacity)
+    : StringBuilder(initial_capacity)
+    , m_vm(vm)
+{
+}
+
 ThrowCompletionOr<void> ThrowableStringBuilder::append(char ch)
 {
     if (try_append(ch).is_error())
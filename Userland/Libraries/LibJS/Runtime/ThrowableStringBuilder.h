@@ -18,6 +18,7 @@ namespace JS {
 class ThrowableStringBuilder : public AK::StringBuilder {
 public:
     explicit ThrowableStringBuilder(VM&);
+    ThrowableStringBuilder(VM&, size_t initial_capacity);
 
     ThrowCompletionOr<void> append(char);
     ThrowCompletionOr<void> append(StringView);
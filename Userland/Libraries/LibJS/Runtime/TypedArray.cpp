@@ -440,7 +440,7 @@ void TypedArrayBase::visit_edges(Visitor& visitor)
     }                                                                                                                            \
                                                                                                                                  \
     ClassName::ClassName(Object& prototype, u32 length, ArrayBuffer& array_buffer)                                               \
-        : TypedArray(prototype,                                                                                                  \
+        : TypedArray(prototype, Kind::ClassName,                                                                                 \
             reinterpret_cast<TypedArrayBase::IntrinsicConstructor>(&Intrinsics::snake_name##_constructor), length, array_buffer) \
     {                                                                                                                            \
         if constexpr (#ClassName##sv.is_one_of("BigInt64Array", "BigUint64Array"))                                               \
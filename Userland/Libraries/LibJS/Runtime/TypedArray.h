@@ -32,12 +32,20 @@ public:
         Number,
     };
 
+    enum class Kind {
+#define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, Type) \
+    ClassName,
+        JS_ENUMERATE_TYPED_ARRAYS
+#undef __JS_ENUMERATE
+    };
+
     using IntrinsicConstructor = TypedArrayConstructor* (Intrinsics::*)();
 
     u32 array_length() const { return m_array_length; }
     u32 byte_length() const { return m_byte_length; }
     u32 byte_offset() const { return m_byte_offset; }
     ContentType content_type() const { return m_content_type; }
+    Kind kind() const { return m_kind; }
     ArrayBuffer* viewed_array_buffer() const { return m_viewed_array_buffer; }
     IntrinsicConstructor intrinsic_constructor() const { return m_intrinsic_constructor; }
 
@@ -61,8 +69,9 @@ public:
     virtual Value get_modify_set_value_in_buffer(size_t byte_index, Value value, ReadWriteModifyFunction operation, bool is_little_endian = true) = 0;
 
 protected:
-    TypedArrayBase(Object& prototype, IntrinsicConstructor intrinsic_constructor)
+    TypedArrayBase(Object& prototype, Kind kind, IntrinsicConstructor intrinsic_constructor)
         : Object(ConstructWithPrototypeTag::Tag, prototype)
+        , m_kind(kind)
         , m_intrinsic_constructor(intrinsic_constructor)
     {
     }
@@ -71,6 +80,7 @@ protected:
     u32 m_byte_length { 0 };
     u32 m_byte_offset { 0 };
     ContentType m_content_type { ContentType::Number };
+    Kind m_kind;
     ArrayBuffer* m_viewed_array_buffer { nullptr };
     IntrinsicConstructor m_intrinsic_constructor { nullptr };
 
@@ -442,8 +452,8 @@ public:
     Value get_modify_set_value_in_buffer(size_t byte_index, Value value, ReadWriteModifyFunction operation, bool is_little_endian = true) override { return viewed_array_buffer()->template get_modify_set_value<T>(byte_index, value, move(operation), is_little_endian); }
 
 protected:
-    TypedArray(Object& prototype, IntrinsicConstructor intrinsic_constructor, u32 array_length, ArrayBuffer& array_buffer)
-        : TypedArrayBase(prototype, intrinsic_constructor)
+    TypedArray(Object& prototype, Kind kind, IntrinsicConstructor intrinsic_constructor, u32 array_length, ArrayBuffer& array_buffer)
+        : TypedArrayBase(prototype, kind, intrinsic_constructor)
     {
         VERIFY(!Checked<u32>::multiplication_would_overflow(array_length, sizeof(UnderlyingBufferDataType)));
         m_viewed_array_buffer = &array_buffer;
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/HashMap.h>
 #include <LibJS/AST.h>
 #include <LibJS/Lexer.h>
 #include <LibJS/Parser.h>
@@ -12,9 +13,36 @@
 
 namespace JS {
 
+// Identical script sources come up again and again within one process: pages
+// share framework scripts, and back-forward navigation re-parses everything
+// the page already ran. The parse tree is realm-independent (it holds its own
+// SourceCode), so successful parses of larger sources are memoized by content
+// hash and shared between Script records. Small sources aren't worth keeping
+// around for the collision check.
+struct CachedProgram {
+    DeprecatedString source;
+    DeprecatedString filename;
+    size_t line_number_offset { 1 };
+    NonnullRefPtr<Program> program;
+};
+static HashMap<unsigned, CachedProgram> s_program_cache;
+static constexpr size_t minimum_cacheable_source_size = 4 * KiB;
+static constexpr size_t maximum_cached_program_count = 64;
+
 // 16.1.5 ParseScript ( sourceText, realm, hostDefined ), https://tc39.es/ecma262/#sec-parse-script
 Result<NonnullGCPtr<Script>, Vector<ParserError>> Script::parse(StringView source_text, Realm& realm, StringView filename, HostDefined* host_defined, size_t line_number_offset)
 {
+    unsigned source_hash = 0;
+    if (source_text.length() >= minimum_cacheable_source_size) {
+        source_hash = source_text.hash();
+        if (auto it = s_program_cache.find(source_hash); it != s_program_cache.end()
+            && it->value.line_number_offset == line_number_offset
+            && it->value.filename == filename
+            && it->value.source == source_text) {
+            return realm.heap().allocate_without_realm<Script>(realm, filename, it->value.program, host_defined);
+        }
+    }
+
     // 1. Let script be ParseText(sourceText, Script).
     auto parser = Parser(Lexer(source_text, filename, line_number_offset));
     auto script = parser.parse_program();
@@ -23,6 +51,12 @@ Result<NonnullGCPtr<Script>, Vector<ParserError>> Script::parse(StringView sourc
     if (parser.has_errors())
         return parser.errors();
 
+    if (source_text.length() >= minimum_cacheable_source_size) {
+        if (s_program_cache.size() >= maximum_cached_program_count)
+            s_program_cache.clear();
+        s_program_cache.set(source_hash, { source_text, filename, line_number_offset, script });
+    }
+
     // 3. Return Script Record { [[Realm]]: realm, [[ECMAScriptCode]]: script, [[HostDefined]]: hostDefined }.
     return realm.heap().allocate_without_realm<Script>(realm, filename, move(script), host_defined);
 }
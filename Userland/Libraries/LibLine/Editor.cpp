@@ -1398,6 +1398,8 @@ ErrorOr<void> Editor::refresh_display()
             m_drawn_end_of_line_offset = m_buffer.size();
             m_cached_buffer_metrics = actual_rendered_string_metrics(buffer_view(), m_current_masks);
             m_drawn_spans = m_current_spans;
+            m_drawn_buffer = m_buffer;
+            m_drawn_without_masks = m_current_masks.is_empty();
             return {};
         }
     }
@@ -1505,6 +1507,8 @@ ErrorOr<void> Editor::refresh_display()
         m_chars_touched_in_the_middle = 0;
         m_drawn_cursor = m_cursor;
         m_drawn_end_of_line_offset = m_buffer.size();
+        m_drawn_buffer = m_buffer;
+        m_drawn_without_masks = m_current_masks.is_empty();
 
         // No need to reposition the cursor, the cursor is already where it needs to be.
         return {};
@@ -1530,6 +1534,54 @@ ErrorOr<void> Editor::refresh_display()
         }
     }
 
+    // If the prompt is unchanged and neither the drawn nor the current contents
+    // involve masks, it's enough to find the first cell at which the screen and
+    // the buffer disagree and redraw from there, instead of reflowing everything.
+    if (!m_always_refresh && m_cached_prompt_valid && !has_cleaned_up && m_current_masks.is_empty() && m_drawn_without_masks) {
+        size_t first_difference = 0;
+        auto common_length = min(m_drawn_buffer.size(), m_buffer.size());
+        for (; first_difference < common_length; ++first_difference) {
+            if (m_drawn_buffer[first_difference] != m_buffer[first_difference])
+                break;
+        }
+
+        if (m_drawn_spans.contains_up_to_offset(m_current_spans, first_difference)) {
+            auto old_lines = current_prompt_metrics().lines_with_addition(m_cached_buffer_metrics, m_num_columns);
+            m_cached_buffer_metrics = actual_rendered_string_metrics(buffer_view(), m_current_masks);
+            auto new_lines = current_prompt_metrics().lines_with_addition(m_cached_buffer_metrics, m_num_columns);
+
+            {
+                auto saved_cursor = m_cursor;
+                m_cursor = first_difference;
+                TRY(reposition_cursor(output_stream));
+                m_cursor = saved_cursor;
+            }
+
+            auto initial_style = find_applicable_style(first_difference);
+            TRY(VT::apply_style(initial_style, output_stream));
+            for (size_t i = first_difference; i < m_buffer.size(); ++i) {
+                TRY(apply_styles(i));
+                print_character_at(i);
+            }
+            TRY(VT::apply_style(Style::reset_style(), output_stream));
+
+            // Clear whatever the old contents occupied past the new end of the buffer.
+            TRY(VT::clear_to_end_of_line(output_stream));
+            if (old_lines > new_lines)
+                TRY(VT::clear_lines(0, old_lines - new_lines, output_stream));
+
+            m_pending_chars.clear();
+            m_refresh_needed = false;
+            m_chars_touched_in_the_middle = 0;
+            m_drawn_spans = m_current_spans;
+            m_drawn_end_of_line_offset = m_buffer.size();
+            m_drawn_buffer = m_buffer;
+
+            TRY(reposition_cursor(output_stream));
+            return {};
+        }
+    }
+
     // Ouch, reflow entire line.
     if (!has_cleaned_up) {
         TRY(cleanup());
@@ -1553,6 +1605,8 @@ ErrorOr<void> Editor::refresh_display()
     m_chars_touched_in_the_middle = 0;
     m_drawn_spans = m_current_spans;
     m_drawn_end_of_line_offset = m_buffer.size();
+    m_drawn_buffer = m_buffer;
+    m_drawn_without_masks = m_current_masks.is_empty();
     m_cached_prompt_valid = true;
 
     TRY(reposition_cursor(output_stream));
@@ -323,6 +323,8 @@ private:
         m_chars_touched_in_the_middle = 0;
         m_drawn_end_of_line_offset = 0;
         m_drawn_spans = {};
+        m_drawn_buffer.clear_with_capacity();
+        m_drawn_without_masks = true;
         m_paste_buffer.clear_with_capacity();
     }
 
@@ -426,6 +428,8 @@ private:
     size_t m_cursor { 0 };
     size_t m_drawn_cursor { 0 };
     size_t m_drawn_end_of_line_offset { 0 };
+    Vector<u32, 1024> m_drawn_buffer;
+    bool m_drawn_without_masks { true };
     size_t m_inline_search_cursor { 0 };
     size_t m_chars_touched_in_the_middle { 0 };
     size_t m_times_tab_pressed { 0 };
@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include "SearchIndex.h"
+#include "Node.h"
+#include "SectionNode.h"
+#include <AK/BinarySearch.h>
+#include <AK/CharacterTypes.h>
+#include <AK/Function.h>
+#include <AK/HashMap.h>
+#include <AK/QuickSort.h>
+#include <AK/StringBuilder.h>
+#include <LibCore/Stream.h>
+
+namespace Manual {
+
+// Tokens shorter than this match so many pages that indexing them only bloats
+// the postings lists.
+static constexpr size_t minimum_token_length = 2;
+
+// Splits the text into runs of ASCII alphanumerics, lowercased so queries are
+// case-insensitive. Both build() and search() use this, so a page and the
+// query that should find it always tokenize the same way.
+template<typename Callback>
+static ErrorOr<void> for_each_token(StringView text, Callback callback)
+{
+    StringBuilder token;
+    auto flush_token = [&]() -> ErrorOr<void> {
+        if (token.length() >= minimum_token_length)
+            TRY(callback(token.string_view()));
+        token.clear();
+        return {};
+    };
+    for (auto character : text) {
+        if (is_ascii_alphanumeric(character))
+            TRY(token.try_append(to_ascii_lowercase(character)));
+        else
+            TRY(flush_token());
+    }
+    return flush_token();
+}
+
+static int compare_tokens(StringView a, StringView b)
+{
+    auto common_length = min(a.length(), b.length());
+    if (auto result = __builtin_memcmp(a.characters_without_null_termination(), b.characters_without_null_termination(), common_length); result != 0)
+        return result;
+    if (a.length() < b.length())
+        return -1;
+    return a.length() > b.length() ? 1 : 0;
+}
+
+ErrorOr<SearchIndex> SearchIndex::open(StringView path)
+{
+    auto file = TRY(Core::MappedFile::map(path));
+    if (file->size() < sizeof(Header))
+        return Error::from_string_literal("Manual search index is truncated");
+
+    auto const& header = *reinterpret_cast<Header const*>(file->data());
+    if (header.magic != index_magic || header.version != index_version)
+        return Error::from_string_literal("Not a manual search index");
+
+    auto tables_end = sizeof(Header) + header.page_count * sizeof(u32) + header.token_count * sizeof(TokenEntry);
+    if (header.string_pool_offset != tables_end
+        || header.postings_pool_offset < header.string_pool_offset
+        || header.postings_pool_offset % sizeof(u32) != 0
+        || header.postings_pool_offset > file->size())
+        return Error::from_string_literal("Manual search index is corrupted");
+
+    auto string_pool_size = header.postings_pool_offset - header.string_pool_offset;
+    auto postings_count = (file->size() - header.postings_pool_offset) / sizeof(u32);
+    SearchIndex index { move(file) };
+    for (auto offset : index.page_path_offsets()) {
+        if (offset >= string_pool_size)
+            return Error::from_string_literal("Manual search index is corrupted");
+    }
+    for (auto const& entry : index.token_entries()) {
+        if (entry.string_offset >= string_pool_size
+            || entry.postings_start + entry.postings_count > postings_count)
+            return Error::from_string_literal("Manual search index is corrupted");
+    }
+    return index;
+}
+
+Span<u32 const> SearchIndex::page_path_offsets() const
+{
+    auto const* base = reinterpret_cast<u8 const*>(m_file->data());
+    return { reinterpret_cast<u32 const*>(base + sizeof(Header)), header().page_count };
+}
+
+Span<SearchIndex::TokenEntry const> SearchIndex::token_entries() const
+{
+    auto const* base = reinterpret_cast<u8 const*>(m_file->data());
+    return { reinterpret_cast<TokenEntry const*>(base + sizeof(Header) + header().page_count * sizeof(u32)), header().token_count };
+}
+
+StringView SearchIndex::string_at(u32 offset) const
+{
+    auto const* base = reinterpret_cast<u8 const*>(m_file->data());
+    auto const* string = reinterpret_cast<char const*>(base + header().string_pool_offset + offset);
+    return { string, __builtin_strlen(string) };
+}
+
+Span<u32 const> SearchIndex::postings_for(TokenEntry const& entry) const
+{
+    auto const* base = reinterpret_cast<u8 const*>(m_file->data());
+    auto const* postings = reinterpret_cast<u32 const*>(base + header().postings_pool_offset);
+    return { postings + entry.postings_start, entry.postings_count };
+}
+
+ErrorOr<Vector<String>> SearchIndex::search(StringView query) const
+{
+    Vector<u32> matching_pages;
+    bool is_first_token = true;
+    bool token_without_matches = false;
+
+    TRY(for_each_token(query, [&](StringView token) -> ErrorOr<void> {
+        if (token_without_matches)
+            return {};
+        auto const* entry = binary_search(token_entries(), token, nullptr, [&](StringView const& needle, TokenEntry const& candidate) {
+            return compare_tokens(needle, string_at(candidate.string_offset));
+        });
+        if (entry == nullptr) {
+            token_without_matches = true;
+            return {};
+        }
+        auto pages = postings_for(*entry);
+        if (is_first_token) {
+            is_first_token = false;
+            TRY(matching_pages.try_append(pages.data(), pages.size()));
+            return {};
+        }
+        // Both lists are ascending, so the intersection is a single merge pass.
+        Vector<u32> intersection;
+        for (size_t i = 0, j = 0; i < matching_pages.size() && j < pages.size();) {
+            if (matching_pages[i] < pages[j]) {
+                ++i;
+            } else if (matching_pages[i] > pages[j]) {
+                ++j;
+            } else {
+                TRY(intersection.try_append(matching_pages[i]));
+                ++i;
+                ++j;
+            }
+        }
+        matching_pages = move(intersection);
+        return {};
+    }));
+
+    Vector<String> results;
+    if (token_without_matches)
+        return results;
+    auto path_offsets = page_path_offsets();
+    for (auto page_index : matching_pages)
+        TRY(results.try_append(TRY(String::from_utf8(string_at(path_offsets[page_index])))));
+    return results;
+}
+
+ErrorOr<void> SearchIndex::build(StringView output_path)
+{
+    Vector<String> page_paths;
+    HashMap<DeprecatedString, Vector<u32>> postings;
+
+    Function<ErrorOr<void>(Node const&)> index_node = [&](Node const& node) -> ErrorOr<void> {
+        if (!node.is_page()) {
+            for (auto const& child : TRY(node.children()))
+                TRY(index_node(child));
+            return {};
+        }
+
+        auto path = TRY(node.path());
+        auto page_index = static_cast<u32>(page_paths.size());
+        TRY(page_paths.try_append(path));
+
+        auto file = TRY(Core::Stream::File::open(path, Core::Stream::OpenMode::Read));
+        auto contents = TRY(file->read_until_eof());
+
+        auto index_token = [&](StringView token) -> ErrorOr<void> {
+            auto& pages = postings.ensure(token);
+            // Tokens from the same page arrive back-to-back, so deduplicating
+            // only needs to look at the last posting.
+            if (pages.is_empty() || pages.last() != page_index)
+                TRY(pages.try_append(page_index));
+            return {};
+        };
+        TRY(for_each_token(TRY(node.name()).bytes_as_string_view(), index_token));
+        TRY(for_each_token(StringView { contents }, index_token));
+        return {};
+    };
+    for (auto const& section : sections)
+        TRY(index_node(*section));
+
+    struct TokenPostings {
+        DeprecatedString token;
+        Vector<u32> pages;
+    };
+    Vector<TokenPostings> tokens;
+    TRY(tokens.try_ensure_capacity(postings.size()));
+    for (auto& entry : postings)
+        tokens.unchecked_append({ entry.key, move(entry.value) });
+    quick_sort(tokens, [](auto const& a, auto const& b) { return a.token < b.token; });
+
+    StringBuilder string_pool;
+    auto intern = [&](StringView string) -> ErrorOr<u32> {
+        auto offset = static_cast<u32>(string_pool.length());
+        TRY(string_pool.try_append(string));
+        TRY(string_pool.try_append('\0'));
+        return offset;
+    };
+
+    Vector<u32> page_path_offsets;
+    for (auto const& path : page_paths)
+        TRY(page_path_offsets.try_append(TRY(intern(path.bytes_as_string_view()))));
+
+    Vector<TokenEntry> token_entries;
+    Vector<u32> postings_pool;
+    for (auto const& token : tokens) {
+        TRY(token_entries.try_append({ TRY(intern(token.token)), static_cast<u32>(postings_pool.size()), static_cast<u32>(token.pages.size()) }));
+        TRY(postings_pool.try_extend(token.pages));
+    }
+
+    // The postings pool holds u32s and is accessed in place, so pad the string
+    // pool out to keep it aligned.
+    while (string_pool.length() % sizeof(u32) != 0)
+        TRY(string_pool.try_append('\0'));
+
+    Header header {
+        .magic = index_magic,
+        .version = index_version,
+        .page_count = static_cast<u32>(page_paths.size()),
+        .token_count = static_cast<u32>(token_entries.size()),
+        .string_pool_offset = static_cast<u32>(sizeof(Header) + page_path_offsets.size() * sizeof(u32) + token_entries.size() * sizeof(TokenEntry)),
+        .postings_pool_offset = 0,
+    };
+    header.postings_pool_offset = header.string_pool_offset + static_cast<u32>(string_pool.length());
+
+    ByteBuffer buffer;
+    TRY(buffer.try_append(&header, sizeof(header)));
+    TRY(buffer.try_append(page_path_offsets.data(), page_path_offsets.size() * sizeof(u32)));
+    TRY(buffer.try_append(token_entries.data(), token_entries.size() * sizeof(TokenEntry)));
+    TRY(buffer.try_append(string_pool.string_view().bytes()));
+    TRY(buffer.try_append(postings_pool.data(), postings_pool.size() * sizeof(u32)));
+
+    auto output = TRY(Core::Stream::File::open(output_path, Core::Stream::OpenMode::Write));
+    TRY(output->write_entire_buffer(buffer));
+    return {};
+}
+
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/NonnullRefPtr.h>
+#include <AK/String.h>
+#include <AK/StringView.h>
+#include <AK/Vector.h>
+#include <LibCore/MappedFile.h>
+
+namespace Manual {
+
+// A pre-tokenized inverted index over all manual pages, mapping each token to
+// the list of pages that contain it. The index is a single file that gets
+// mapped read-only, so a keyword query is a couple of binary searches instead
+// of reading every page off disk.
+//
+// File layout (all integers are native-endian u32):
+//   header:       magic, version, page count, token count,
+//                 string pool offset, postings pool offset
+//   page table:   one string pool offset per page (the page's path)
+//   token table:  string pool offset, postings start, postings count per token,
+//                 sorted by token so lookups can binary search
+//   string pool:  NUL-terminated strings
+//   postings:     page indices, ascending within each token's run
+class SearchIndex {
+public:
+    static constexpr StringView default_path = "/usr/share/man/search-index"sv;
+
+    static ErrorOr<SearchIndex> open(StringView path = default_path);
+
+    // Returns the paths of all pages containing every token of the query.
+    ErrorOr<Vector<String>> search(StringView query) const;
+
+    // Walks every page under the manual base path, tokenizes it, and writes
+    // the resulting index to the given path.
+    static ErrorOr<void> build(StringView output_path = default_path);
+
+private:
+    struct Header {
+        u32 magic;
+        u32 version;
+        u32 page_count;
+        u32 token_count;
+        u32 string_pool_offset;
+        u32 postings_pool_offset;
+    };
+
+    struct TokenEntry {
+        u32 string_offset;
+        u32 postings_start;
+        u32 postings_count;
+    };
+
+    static constexpr u32 index_magic = 0x584E414D; // "MANX"
+    static constexpr u32 index_version = 1;
+
+    explicit SearchIndex(NonnullRefPtr<Core::MappedFile> file)
+        : m_file(move(file))
+    {
+    }
+
+    Header const& header() const { return *reinterpret_cast<Header const*>(m_file->data()); }
+    Span<u32 const> page_path_offsets() const;
+    Span<TokenEntry const> token_entries() const;
+    StringView string_at(u32 offset) const;
+    Span<u32 const> postings_for(TokenEntry const&) const;
+
+    NonnullRefPtr<Core::MappedFile> m_file;
+};
+
+}
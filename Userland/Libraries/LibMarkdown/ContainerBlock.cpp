@@ -97,7 +97,7 @@ OwnPtr<ContainerBlock> ContainerBlock::parse(LineIterator& lines)
     auto flush_paragraph = [&] {
         if (paragraph_text.is_empty())
             return;
-        auto paragraph = make<Paragraph>(Text::parse(paragraph_text.build()));
+        auto paragraph = make<Paragraph>(paragraph_text.build());
         blocks.append(move(paragraph));
         paragraph_text.clear();
     };
@@ -11,6 +11,13 @@
 
 namespace Markdown {
 
+Text const& Paragraph::text() const
+{
+    if (!m_text.has_value())
+        m_text = Text::parse(m_raw_text);
+    return *m_text;
+}
+
 DeprecatedString Paragraph::render_to_html(bool tight) const
 {
     StringBuilder builder;
@@ -18,7 +25,7 @@ DeprecatedString Paragraph::render_to_html(bool tight) const
     if (!tight)
         builder.append("<p>"sv);
 
-    builder.append(m_text.render_to_html());
+    builder.append(text().render_to_html());
 
     if (!tight)
         builder.append("</p>"sv);
@@ -30,7 +37,7 @@ DeprecatedString Paragraph::render_to_html(bool tight) const
 
 Vector<DeprecatedString> Paragraph::render_lines_for_terminal(size_t) const
 {
-    return Vector<DeprecatedString> { DeprecatedString::formatted("  {}", m_text.render_for_terminal()), "" };
+    return Vector<DeprecatedString> { DeprecatedString::formatted("  {}", text().render_for_terminal()), "" };
 }
 
 RecursionDecision Paragraph::walk(Visitor& visitor) const
@@ -39,7 +46,7 @@ RecursionDecision Paragraph::walk(Visitor& visitor) const
     if (rd != RecursionDecision::Recurse)
         return rd;
 
-    return m_text.walk(visitor);
+    return text().walk(visitor);
 }
 
 }
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AK/NonnullOwnPtrVector.h>
+#include <AK/Optional.h>
 #include <AK/OwnPtr.h>
 #include <LibMarkdown/Block.h>
 #include <LibMarkdown/Text.h>
@@ -16,8 +17,8 @@ namespace Markdown {
 
 class Paragraph final : public Block {
 public:
-    Paragraph(Text text)
-        : m_text(move(text))
+    explicit Paragraph(DeprecatedString text)
+        : m_raw_text(move(text))
     {
     }
 
@@ -28,7 +29,13 @@ public:
     virtual RecursionDecision walk(Visitor&) const override;
 
 private:
-    Text m_text;
+    Text const& text() const;
+
+    // Inline markup is parsed lazily, the first time the paragraph is rendered
+    // or its text is walked. Paragraphs make up the bulk of most documents, so
+    // visitors that don't recurse into them never pay for inline parsing.
+    DeprecatedString m_raw_text;
+    mutable Optional<Text> m_text;
 };
 
 }
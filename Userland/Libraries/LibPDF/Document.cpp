@@ -4,8 +4,11 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/BitCast.h>
+#include <LibGfx/Bitmap.h>
 #include <LibPDF/CommonNames.h>
 #include <LibPDF/Document.h>
+#include <LibPDF/Fonts/PDFFont.h>
 #include <LibPDF/Parser.h>
 
 namespace PDF {
@@ -63,6 +66,37 @@ Document::Document(NonnullRefPtr<DocumentParser> const& parser)
     m_parser->set_document(this);
 }
 
+// Out of line because the resource caches hold types that are only
+// forward-declared in the header.
+Document::~Document() = default;
+
+RefPtr<Gfx::Bitmap> Document::get_cached_image_bitmap(Object const& image) const
+{
+    if (auto it = m_image_bitmap_cache.find(&image); it != m_image_bitmap_cache.end())
+        return it->value;
+    return nullptr;
+}
+
+void Document::cache_image_bitmap(Object const& image, NonnullRefPtr<Gfx::Bitmap> bitmap)
+{
+    m_image_bitmap_cache.set(&image, move(bitmap));
+}
+
+RefPtr<PDFFont> Document::get_cached_font(Object const& font_dictionary, float font_size) const
+{
+    auto it = m_font_cache.find(&font_dictionary);
+    if (it == m_font_cache.end())
+        return nullptr;
+    if (auto font_it = it->value.find(bit_cast<u32>(font_size)); font_it != it->value.end())
+        return font_it->value;
+    return nullptr;
+}
+
+void Document::cache_font(Object const& font_dictionary, float font_size, NonnullRefPtr<PDFFont> font)
+{
+    m_font_cache.ensure(&font_dictionary).set(bit_cast<u32>(font_size), move(font));
+}
+
 PDFErrorOr<void> Document::initialize()
 {
     if (m_security_handler)
@@ -11,6 +11,7 @@
 #include <AK/RefCounted.h>
 #include <AK/Weakable.h>
 #include <LibGfx/Color.h>
+#include <LibGfx/Forward.h>
 #include <LibPDF/DocumentParser.h>
 #include <LibPDF/Encryption.h>
 #include <LibPDF/Error.h>
@@ -18,6 +19,8 @@
 
 namespace PDF {
 
+class PDFFont;
+
 struct Rectangle {
     float lower_left_x;
     float lower_left_y;
@@ -82,6 +85,8 @@ class Document final
 public:
     static PDFErrorOr<NonnullRefPtr<Document>> create(ReadonlyBytes bytes);
 
+    ~Document();
+
     // If a security handler is present, it is the caller's responsibility to ensure
     // this document is unencrypted before calling this function. The user does not
     // need to handle the case where the user password is the empty string.
@@ -119,6 +124,17 @@ public:
         return cast_to<T>(TRY(resolve(value)));
     }
 
+    // Decoded-resource caches, shared by every Renderer on this document, so
+    // flipping between pages doesn't re-decode fonts and images that pages
+    // have in common. Indirect objects are parsed once and then reused out of
+    // m_values, so an Object pointer identifies a PDF object for the lifetime
+    // of the document and works as the cache key for what was decoded from it.
+    RefPtr<Gfx::Bitmap> get_cached_image_bitmap(Object const& image) const;
+    void cache_image_bitmap(Object const& image, NonnullRefPtr<Gfx::Bitmap>);
+
+    RefPtr<PDFFont> get_cached_font(Object const& font_dictionary, float font_size) const;
+    void cache_font(Object const& font_dictionary, float font_size, NonnullRefPtr<PDFFont>);
+
 private:
     explicit Document(NonnullRefPtr<DocumentParser> const& parser);
 
@@ -152,6 +168,10 @@ private:
     HashMap<u32, Value> m_values;
     RefPtr<OutlineDict> m_outline;
     RefPtr<SecurityHandler> m_security_handler;
+    HashMap<Object const*, NonnullRefPtr<Gfx::Bitmap>> m_image_bitmap_cache;
+    // Fonts are sized at creation, so each font dictionary keeps one decoded
+    // font per requested size (keyed by the size's bit pattern).
+    HashMap<Object const*, HashMap<u32, NonnullRefPtr<PDFFont>>> m_font_cache;
 };
 
 }
@@ -52,6 +52,11 @@ PDFErrorOr<void> DocumentParser::initialize()
 
 PDFErrorOr<Value> DocumentParser::parse_object_with_index(u32 index)
 {
+    if (m_has_pending_main_xref_table
+        && (!m_xref_table->has_object(index) || m_xref_table->byte_offset_for_object(index) == invalid_byte_offset)) {
+        TRY(finish_deferred_xref_indexing());
+    }
+
     VERIFY(m_xref_table->has_object(index));
 
     if (m_xref_table->is_object_compressed(index))
@@ -189,12 +194,26 @@ PDFErrorOr<void> DocumentParser::initialize_linearized_xref_table()
     if (!m_trailer)
         m_trailer = TRY(parse_file_trailer());
 
-    // Also parse the main xref table and merge into the first-page xref table. Note
-    // that we don't use the main xref table offset from the linearization dict because
+    // The main xref table lives at the end of the file, so parsing it now would
+    // defeat the point of linearization. Record where it is and defer parsing it
+    // until an object lookup misses the first-page xref section. Note that we
+    // don't use the main xref table offset from the linearization dict because
     // for some reason, it specified the offset of the whitespace after the object
-    // index start and length? So it's much easier to do it this way.
-    auto main_xref_table_offset = m_trailer->get_value(CommonNames::Prev).to_int();
-    m_reader.move_to(main_xref_table_offset);
+    // index start and length? So it's much easier to use the trailer's Prev entry.
+    //
+    // Validation is also deferred until then; running it on the first-page table
+    // alone would discard leading entries which are merely not filled in yet.
+    m_main_xref_table_offset = m_trailer->get_value(CommonNames::Prev).to_int();
+    m_has_pending_main_xref_table = true;
+
+    return {};
+}
+
+PDFErrorOr<void> DocumentParser::finish_deferred_xref_indexing()
+{
+    m_has_pending_main_xref_table = false;
+
+    m_reader.move_to(m_main_xref_table_offset);
     auto main_xref_table = TRY(parse_xref_table());
     TRY(m_xref_table->merge(move(*main_xref_table)));
 
@@ -504,33 +523,42 @@ PDFErrorOr<NonnullRefPtr<DictObject>> DocumentParser::parse_file_trailer()
 PDFErrorOr<Value> DocumentParser::parse_compressed_object_with_index(u32 index)
 {
     auto object_stream_index = m_xref_table->object_stream_for_object(index);
-    auto stream_offset = m_xref_table->byte_offset_for_object(object_stream_index);
 
-    m_reader.move_to(stream_offset);
+    RefPtr<StreamObject> stream;
+    if (auto it = m_object_stream_cache.find(object_stream_index); it != m_object_stream_cache.end()) {
+        stream = it->value;
+    } else {
+        auto stream_offset = m_xref_table->byte_offset_for_object(object_stream_index);
 
-    auto first_number = TRY(parse_number());
-    auto second_number = TRY(parse_number());
+        m_reader.move_to(stream_offset);
 
-    if (first_number.get<int>() != object_stream_index)
-        return error("Mismatching object stream index");
-    if (second_number.get<int>() != 0)
-        return error("Non-zero object stream generation number");
+        auto first_number = TRY(parse_number());
+        auto second_number = TRY(parse_number());
 
-    if (!m_reader.matches("obj"))
-        return error("Malformed object stream");
-    m_reader.move_by(3);
-    if (m_reader.matches_eol())
-        m_reader.consume_eol();
+        if (first_number.get<int>() != object_stream_index)
+            return error("Mismatching object stream index");
+        if (second_number.get<int>() != 0)
+            return error("Non-zero object stream generation number");
 
-    auto dict = TRY(parse_dict());
-    auto type = TRY(dict->get_name(m_document, CommonNames::Type))->name();
-    if (type != "ObjStm")
-        return error("Invalid object stream type");
+        if (!m_reader.matches("obj"))
+            return error("Malformed object stream");
+        m_reader.move_by(3);
+        if (m_reader.matches_eol())
+            m_reader.consume_eol();
 
-    auto object_count = dict->get_value("N").get_u32();
-    auto first_object_offset = dict->get_value("First").get_u32();
+        auto dict = TRY(parse_dict());
+        auto type = TRY(dict->get_name(m_document, CommonNames::Type))->name();
+        if (type != "ObjStm")
+            return error("Invalid object stream type");
+
+        stream = TRY(parse_stream(dict));
+        m_object_stream_cache.set(object_stream_index, *stream);
+    }
+
+    auto stream_dict = stream->dict();
+    auto object_count = stream_dict->get_value("N").get_u32();
+    auto first_object_offset = stream_dict->get_value("First").get_u32();
 
-    auto stream = TRY(parse_stream(dict));
     Parser stream_parser(m_document, stream->bytes());
 
     for (u32 i = 0; i < object_count; ++i) {
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
 #include <LibPDF/Parser.h>
 
 namespace PDF {
@@ -87,6 +88,7 @@ private:
     PDFErrorOr<NonnullRefPtr<XRefTable>> parse_xref_table();
     PDFErrorOr<NonnullRefPtr<DictObject>> parse_file_trailer();
     PDFErrorOr<Value> parse_compressed_object_with_index(u32 index);
+    PDFErrorOr<void> finish_deferred_xref_indexing();
 
     bool navigate_to_before_eof_marker();
     bool navigate_to_after_startxref();
@@ -94,6 +96,17 @@ private:
     RefPtr<XRefTable> m_xref_table;
     RefPtr<DictObject> m_trailer;
     Optional<LinearizationDictionary> m_linearization_dictionary;
+
+    // For linearized documents, parsing the main xref table (which lives at the end
+    // of the file) is deferred until an object lookup misses the first-page xref
+    // section, so the first page can be shown after reading only the front of the file.
+    long m_main_xref_table_offset { 0 };
+    bool m_has_pending_main_xref_table { false };
+
+    // Object streams are compressed as a single unit, so the whole stream has to be
+    // decoded to extract any one of its objects. The decoded stream is kept around
+    // for the next object fetched from the same stream.
+    HashMap<u32, NonnullRefPtr<StreamObject>> m_object_stream_cache;
 };
 
 }
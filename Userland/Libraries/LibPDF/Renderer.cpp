@@ -431,7 +431,11 @@ RENDERER_HANDLER(text_set_font)
 
     auto& text_rendering_matrix = calculate_text_rendering_matrix();
     auto font_size = text_rendering_matrix.x_scale() * text_state().font_size;
-    auto font = TRY(PDFFont::create(m_document, font_dictionary, font_size));
+    auto font = m_document->get_cached_font(*font_dictionary, font_size);
+    if (!font) {
+        font = TRY(PDFFont::create(m_document, font_dictionary, font_size));
+        m_document->cache_font(*font_dictionary, font_size, *font);
+    }
     text_state().font = font;
 
     m_text_rendering_matrix_is_dirty = true;
@@ -873,23 +877,30 @@ PDFErrorOr<void> Renderer::show_image(NonnullRefPtr<StreamObject> image)
         show_empty_image(width, height);
         return {};
     }
-    auto image_bitmap = TRY(load_image(image));
-    if (image_dict->contains(CommonNames::SMask)) {
-        auto smask_bitmap = TRY(load_image(TRY(image_dict->get_stream(m_document, CommonNames::SMask))));
-        VERIFY(smask_bitmap->rect() == image_bitmap->rect());
-        for (int j = 0; j < image_bitmap->height(); ++j) {
-            for (int i = 0; i < image_bitmap->width(); ++i) {
-                auto image_color = image_bitmap->get_pixel(i, j);
-                auto smask_color = smask_bitmap->get_pixel(i, j);
-                image_color = image_color.with_alpha(smask_color.luminosity());
-                image_bitmap->set_pixel(i, j, image_color);
+    // The fully decoded (and SMask-composited) bitmap is cached on the
+    // document, so other pages using the same image don't redo this work.
+    auto image_bitmap = m_document->get_cached_image_bitmap(*image);
+    if (!image_bitmap) {
+        auto decoded_bitmap = TRY(load_image(image));
+        if (image_dict->contains(CommonNames::SMask)) {
+            auto smask_bitmap = TRY(load_image(TRY(image_dict->get_stream(m_document, CommonNames::SMask))));
+            VERIFY(smask_bitmap->rect() == decoded_bitmap->rect());
+            for (int j = 0; j < decoded_bitmap->height(); ++j) {
+                for (int i = 0; i < decoded_bitmap->width(); ++i) {
+                    auto image_color = decoded_bitmap->get_pixel(i, j);
+                    auto smask_color = smask_bitmap->get_pixel(i, j);
+                    image_color = image_color.with_alpha(smask_color.luminosity());
+                    decoded_bitmap->set_pixel(i, j, image_color);
+                }
             }
         }
+        m_document->cache_image_bitmap(*image, decoded_bitmap);
+        image_bitmap = move(decoded_bitmap);
     }
 
     auto image_space = calculate_image_space_transformation(width, height);
     auto image_rect = Gfx::FloatRect { 0, 0, width, height };
-    m_painter.draw_scaled_bitmap_with_transform(image_bitmap->rect(), image_bitmap, image_rect, image_space);
+    m_painter.draw_scaled_bitmap_with_transform(image_bitmap->rect(), *image_bitmap, image_rect, image_space);
     return {};
 }
 
@@ -24,7 +24,10 @@ void Request::stream_into(Core::Stream::Stream& stream)
 {
     VERIFY(!m_internal_stream_data);
 
-    m_internal_stream_data = make<InternalStreamData>(MUST(Core::Stream::File::adopt_fd(fd(), Core::Stream::OpenMode::Read)));
+    // With a shared response buffer, the fd only carries chunk frames (and our
+    // consumption acknowledgements back), so it has to be open for writing too.
+    auto open_mode = m_response_buffer.is_valid() ? Core::Stream::OpenMode::ReadWrite : Core::Stream::OpenMode::Read;
+    m_internal_stream_data = make<InternalStreamData>(MUST(Core::Stream::File::adopt_fd(fd(), open_mode)));
     m_internal_stream_data->read_notifier = Core::Notifier::construct(fd(), Core::Notifier::Read);
 
     auto user_on_finish = move(on_finish);
@@ -41,6 +44,45 @@ void Request::stream_into(Core::Stream::Stream& stream)
             user_on_finish(m_internal_stream_data->success, m_internal_stream_data->total_size);
         }
     };
+    if (m_response_buffer.is_valid()) {
+        m_internal_stream_data->read_notifier->on_ready_to_read = [this, &stream] {
+            // The body bytes live in the shared buffer; the fd carries frames
+            // telling us which span of the ring each chunk occupies. Every
+            // consumed chunk is acknowledged back with its byte count so the
+            // server knows when it may reuse that span.
+            auto& stream_data = *m_internal_stream_data;
+            u8 frames[4 * KiB];
+            memcpy(frames, stream_data.partial_frame, stream_data.partial_frame_size);
+            do {
+                auto result = stream_data.read_stream->read(Bytes { frames, sizeof(frames) }.slice(stream_data.partial_frame_size));
+                if (result.is_error() && (!result.error().is_errno() || (result.error().is_errno() && result.error().code() != EINTR)))
+                    break;
+                if (result.is_error())
+                    continue;
+                size_t total_size = stream_data.partial_frame_size + result.value().size();
+                size_t offset = 0;
+                for (; offset + sizeof(RequestServer::ResponseChunkHeader) <= total_size; offset += sizeof(RequestServer::ResponseChunkHeader)) {
+                    RequestServer::ResponseChunkHeader header;
+                    memcpy(&header, frames + offset, sizeof(header));
+                    // FIXME: What do we do if this fails?
+                    stream.write_entire_buffer({ m_response_buffer.data<u8>() + header.offset, header.length }).release_value_but_fixme_should_propagate_errors();
+                    u32 consumed_bytes = header.length;
+                    stream_data.read_stream->write_entire_buffer({ &consumed_bytes, sizeof(consumed_bytes) }).release_value_but_fixme_should_propagate_errors();
+                }
+                stream_data.partial_frame_size = total_size - offset;
+                memcpy(stream_data.partial_frame, frames + offset, stream_data.partial_frame_size);
+                break;
+            } while (true);
+
+            if (stream_data.read_stream->is_eof())
+                stream_data.read_notifier->close();
+
+            if (stream_data.request_done)
+                stream_data.on_finish();
+        };
+        return;
+    }
+
     m_internal_stream_data->read_notifier->on_ready_to_read = [this, &stream] {
         constexpr size_t buffer_size = 256 * KiB;
         static char buf[buffer_size];
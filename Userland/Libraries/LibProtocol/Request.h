@@ -13,10 +13,12 @@
 #include <AK/MemoryStream.h>
 #include <AK/RefCounted.h>
 #include <AK/WeakPtr.h>
+#include <LibCore/AnonymousBuffer.h>
 #include <LibCore/MemoryStream.h>
 #include <LibCore/Notifier.h>
 #include <LibCore/Stream.h>
 #include <LibIPC/Forward.h>
+#include <RequestServer/ResponseStream.h>
 
 namespace Protocol {
 
@@ -58,6 +60,7 @@ public:
 
     RefPtr<Core::Notifier>& write_notifier(Badge<RequestClient>) { return m_write_notifier; }
     void set_request_fd(Badge<RequestClient>, int fd) { m_fd = fd; }
+    void set_response_buffer(Badge<RequestClient>, Core::AnonymousBuffer buffer) { m_response_buffer = move(buffer); }
 
 private:
     explicit Request(RequestClient&, i32 request_id);
@@ -66,6 +69,7 @@ private:
     int m_request_id { -1 };
     RefPtr<Core::Notifier> m_write_notifier;
     int m_fd { -1 };
+    Core::AnonymousBuffer m_response_buffer;
     bool m_should_buffer_all_input { false };
 
     struct InternalBufferedData {
@@ -82,6 +86,8 @@ private:
 
         NonnullOwnPtr<Core::Stream::Stream> read_stream;
         RefPtr<Core::Notifier> read_notifier;
+        u8 partial_frame[sizeof(RequestServer::ResponseChunkHeader)] {};
+        size_t partial_frame_size { 0 };
         bool success;
         u32 total_size { 0 };
         bool request_done { false };
@@ -37,6 +37,7 @@ RefPtr<Request> RequestClient::start_request(DeprecatedString const& method, URL
     auto response_fd = response.response_fd().value().take_fd();
     auto request = Request::create_from_id({}, *this, request_id);
     request->set_request_fd({}, response_fd);
+    request->set_response_buffer({}, response.response_buffer());
     m_requests.set(request_id, request);
     return request;
 }
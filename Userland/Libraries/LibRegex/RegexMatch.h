@@ -9,6 +9,7 @@
 #include "Forward.h"
 #include "RegexOptions.h"
 
+#include <AK/CharacterTypes.h>
 #include <AK/DeprecatedFlyString.h>
 #include <AK/DeprecatedString.h>
 #include <AK/HashMap.h>
@@ -256,6 +257,62 @@ public:
             });
     }
 
+    // Returns the next index (in the same units as length()) at or after the given
+    // one where the given code point may occur, or an empty Optional if it provably
+    // occurs nowhere in the rest of the view. Only the plain byte-backed view has a
+    // fast scan; the other encodings conservatively report every index as a candidate.
+    Optional<size_t> find_next_code_point_candidate(u32 code_point, size_t index, bool insensitive) const
+    {
+        return m_view.visit(
+            [&](StringView view) -> Optional<size_t> {
+                if (index >= view.length())
+                    return {};
+                // A byte-backed view cannot contain a code point outside latin1.
+                if (code_point > 0xff)
+                    return {};
+                if (insensitive && is_ascii_alpha(code_point)) {
+                    auto lowercase_index = view.find(static_cast<char>(to_ascii_lowercase(code_point)), index);
+                    // Only look for the other case before the first hit of this one,
+                    // otherwise a rare case variant makes every scan walk to the end.
+                    auto limit = lowercase_index.value_or(view.length());
+                    auto uppercase_index = view.substring_view(index, limit - index).find(static_cast<char>(to_ascii_uppercase(code_point)));
+                    if (uppercase_index.has_value())
+                        return index + *uppercase_index;
+                    return lowercase_index;
+                }
+                return view.find(static_cast<char>(code_point), index);
+            },
+            [&](auto const&) -> Optional<size_t> {
+                return index;
+            });
+    }
+
+    // Shift-Or scan over the given per-byte masks: returns the next index at or
+    // after the given one where all masked positions can match, or an empty
+    // Optional if no such index exists. Like find_next_code_point_candidate(),
+    // only the plain byte-backed view scans; the other encodings conservatively
+    // report every index as a candidate.
+    Optional<size_t> find_next_prefix_candidate(Span<u64 const> byte_masks, size_t mask_count, size_t index) const
+    {
+        return m_view.visit(
+            [&](StringView view) -> Optional<size_t> {
+                if (view.length() < mask_count || index > view.length() - mask_count)
+                    return {};
+                u64 const accept_bit = 1ull << (mask_count - 1);
+                u64 state = 0;
+                auto const* bytes = reinterpret_cast<u8 const*>(view.characters_without_null_termination());
+                for (size_t i = index; i < view.length(); ++i) {
+                    state = ((state << 1) | 1) & byte_masks[bytes[i]];
+                    if (state & accept_bit)
+                        return i + 1 - mask_count;
+                }
+                return {};
+            },
+            [&](auto const&) -> Optional<size_t> {
+                return index;
+            });
+    }
+
     RegexStringView typed_null_view()
     {
         auto view = m_view.visit(
@@ -185,6 +185,18 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
 
     auto single_match_only = input.regex_options.has_flag_set(AllFlags::SingleMatch);
 
+    // When every match has to start with a known literal, scanning for that
+    // literal is much cheaper than running the bytecode at every position.
+    // Skipping positions is only sound while we'd keep searching past failed
+    // attempts anyway, i.e. when continue_search is set.
+    auto const& optimization_data = m_pattern->parser_result.optimization_data;
+    auto const& starting_literal = optimization_data.starting_literal;
+    bool can_skip_to_starting_literal = starting_literal.has_value() && continue_search;
+    bool insensitive = input.regex_options.has_flag_set(AllFlags::Insensitive);
+    // The prefix masks were built for case-sensitive matching, so the wider
+    // scan only applies then; the starting literal covers the insensitive case.
+    bool can_skip_to_prefix_candidate = optimization_data.prefix_mask_count != 0 && continue_search && !insensitive;
+
     for (auto const& view : views) {
         if (lines_to_skip != 0) {
             ++input.line;
@@ -235,6 +247,18 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
             if (view_index == view_length && input.regex_options.has_flag_set(AllFlags::Multiline))
                 break;
 
+            if (can_skip_to_prefix_candidate && view_index < view_length) {
+                auto candidate_index = view.find_next_prefix_candidate(optimization_data.prefix_byte_masks.span(), optimization_data.prefix_mask_count, view_index);
+                if (!candidate_index.has_value())
+                    break;
+                view_index = *candidate_index;
+            } else if (can_skip_to_starting_literal && view_index < view_length) {
+                auto candidate_index = view.find_next_code_point_candidate(*starting_literal, view_index, insensitive);
+                if (!candidate_index.has_value())
+                    break;
+                view_index = *candidate_index;
+            }
+
             auto& match_length_minimum = m_pattern->parser_result.match_length_minimum;
             // FIXME: More performant would be to know the remaining minimum string
             //        length needed to match from the current position onwards within
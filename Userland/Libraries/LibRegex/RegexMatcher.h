@@ -233,6 +233,8 @@ public:
 private:
     void run_optimization_passes();
     void attempt_rewrite_loops_as_atomic_groups(BasicBlockList const&);
+    void extract_starting_literal();
+    void extract_prefix_byte_masks();
 };
 
 // free standing functions for match, search and has_match
@@ -29,6 +29,208 @@ void Regex<Parser>::run_optimization_passes()
     attempt_rewrite_loops_as_atomic_groups(split_basic_blocks(parser_result.bytecode));
 
     parser_result.bytecode.flatten();
+
+    extract_starting_literal();
+    extract_prefix_byte_masks();
+}
+
+template<typename Parser>
+void Regex<Parser>::extract_starting_literal()
+{
+    auto& bytecode = parser_result.bytecode;
+    parser_result.optimization_data.starting_literal.clear();
+
+    MatchState state;
+    state.instruction_position = 0;
+    while (state.instruction_position < bytecode.size()) {
+        auto& opcode = bytecode.get_opcode(state);
+        switch (opcode.opcode_id()) {
+        // These never consume input, so whatever follows them still has to
+        // match at the starting position; the assertions among them can only
+        // make the position fail outright, which skipping is fine with.
+        case OpCodeId::SaveLeftCaptureGroup:
+        case OpCodeId::ClearCaptureGroup:
+        case OpCodeId::Checkpoint:
+        case OpCodeId::CheckBegin:
+        case OpCodeId::CheckBoundary:
+            state.instruction_position += opcode.size();
+            continue;
+        case OpCodeId::Compare: {
+            auto flat_compares = static_cast<OpCode_Compare const&>(opcode).flat_compares();
+            // A lone Char (or String, whose first code point is required just the
+            // same) is an unconditional demand on the first input position; any
+            // other shape (alternatives, classes, inversions) is not.
+            if (flat_compares.size() != 1)
+                return;
+            auto const& compare = flat_compares.first();
+            if (compare.type == CharacterCompareType::Char || compare.type == CharacterCompareType::String)
+                parser_result.optimization_data.starting_literal = static_cast<u32>(compare.value);
+            return;
+        }
+        default:
+            return;
+        }
+    }
+}
+
+// Compiles the pattern's leading fixed-width positions into a Shift-Or scan
+// table, one 256-entry byte mask per state bit. Each position's byte set is a
+// superset of what the bytecode VM would accept there (unmodellable compares
+// degrade to "any byte"), so a scan mismatch proves the VM cannot match and
+// the matcher may skip the position outright.
+template<typename Parser>
+void Regex<Parser>::extract_prefix_byte_masks()
+{
+    static constexpr size_t maximum_prefix_length = 64; // One Shift-Or state bit per position.
+
+    auto& bytecode = parser_result.bytecode;
+    auto& optimization_data = parser_result.optimization_data;
+    optimization_data.prefix_mask_count = 0;
+    optimization_data.prefix_byte_masks.clear();
+
+    Array<u64, 256> masks {};
+    size_t position_count = 0;
+    bool done = false;
+
+    MatchState state;
+    state.instruction_position = 0;
+    while (!done && state.instruction_position < bytecode.size() && position_count < maximum_prefix_length) {
+        auto& opcode = bytecode.get_opcode(state);
+        switch (opcode.opcode_id()) {
+        // Same reasoning as in extract_starting_literal(): these never consume
+        // input, so the compares after them still apply at the same positions.
+        case OpCodeId::SaveLeftCaptureGroup:
+        case OpCodeId::ClearCaptureGroup:
+        case OpCodeId::Checkpoint:
+        case OpCodeId::CheckBegin:
+        case OpCodeId::CheckBoundary:
+            break;
+        case OpCodeId::Compare: {
+            auto& compare = static_cast<OpCode_Compare const&>(opcode);
+            size_t offset = state.instruction_position + 3;
+            bool invert = false;
+            bool exact = true;
+            bool any_byte = false;
+            Array<bool, 256> matching_bytes {};
+            Vector<u32, 8> string_value;
+
+            auto add_range = [&](CharRange range) {
+                for (u32 ch = range.from; ch <= min(range.to, 255u); ++ch)
+                    matching_bytes[ch] = true;
+            };
+
+            for (size_t i = 0; i < compare.arguments_count() && !done; ++i) {
+                auto compare_type = (CharacterCompareType)bytecode.at(offset++);
+                switch (compare_type) {
+                case CharacterCompareType::Inverse:
+                    invert = true;
+                    break;
+                case CharacterCompareType::Char: {
+                    auto ch = bytecode.at(offset++);
+                    if (ch < 256)
+                        matching_bytes[ch] = true;
+                    break;
+                }
+                case CharacterCompareType::String: {
+                    auto length = bytecode.at(offset++);
+                    // A string mixed with alternatives makes the position count ambiguous.
+                    if (compare.arguments_count() != 1 || length == 0) {
+                        done = true;
+                        break;
+                    }
+                    for (size_t j = 0; j < length; ++j)
+                        string_value.append(bytecode.at(offset++));
+                    break;
+                }
+                case CharacterCompareType::CharRange:
+                    add_range(CharRange { bytecode.at(offset++) });
+                    break;
+                case CharacterCompareType::LookupTable: {
+                    auto count = bytecode.at(offset++);
+                    for (size_t j = 0; j < count; ++j)
+                        add_range(CharRange { bytecode.at(offset++) });
+                    break;
+                }
+                case CharacterCompareType::CharClass: {
+                    auto character_class = (CharClass)bytecode.at(offset++);
+                    for (size_t byte = 0; byte < 256; ++byte) {
+                        if (OpCode_Compare::matches_character_class(character_class, byte, false))
+                            matching_bytes[byte] = true;
+                    }
+                    break;
+                }
+                case CharacterCompareType::GeneralCategory:
+                case CharacterCompareType::Property:
+                case CharacterCompareType::Script:
+                case CharacterCompareType::ScriptExtension:
+                    ++offset;
+                    [[fallthrough]];
+                case CharacterCompareType::AnyChar:
+                case CharacterCompareType::TemporaryInverse:
+                case CharacterCompareType::And:
+                case CharacterCompareType::Or:
+                case CharacterCompareType::EndAndOr:
+                    // Too involved to model exactly; over-approximate with "any byte".
+                    any_byte = true;
+                    exact = false;
+                    break;
+                default:
+                    // References and anything unknown may consume a variable amount.
+                    done = true;
+                    break;
+                }
+            }
+            if (done)
+                break;
+
+            if (!string_value.is_empty()) {
+                for (auto code_point : string_value) {
+                    if (position_count >= maximum_prefix_length)
+                        break;
+                    // A code point beyond latin1 can never equal a byte; leaving its
+                    // mask empty is exact, since the VM could not match it either.
+                    if (code_point < 256)
+                        masks[code_point] |= 1ull << position_count;
+                    ++position_count;
+                }
+            } else {
+                if (invert) {
+                    // Complementing an over-approximated set would under-approximate
+                    // and make the scan skip over genuine matches.
+                    if (!exact) {
+                        done = true;
+                        break;
+                    }
+                    for (auto& matches : matching_bytes)
+                        matches = !matches;
+                } else if (any_byte) {
+                    matching_bytes.fill(true);
+                }
+                for (size_t byte = 0; byte < 256; ++byte) {
+                    if (matching_bytes[byte])
+                        masks[byte] |= 1ull << position_count;
+                }
+                ++position_count;
+            }
+            break;
+        }
+        default:
+            done = true;
+            break;
+        }
+        if (!done)
+            state.instruction_position += opcode.size();
+    }
+
+    // A single position is already covered by the starting literal, which also
+    // handles case-insensitive matching.
+    if (position_count < 2)
+        return;
+
+    optimization_data.prefix_mask_count = position_count;
+    optimization_data.prefix_byte_masks.ensure_capacity(masks.size());
+    for (auto mask : masks)
+        optimization_data.prefix_byte_masks.unchecked_append(mask);
 }
 
 template<typename Parser>
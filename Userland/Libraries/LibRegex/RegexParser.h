@@ -55,6 +55,20 @@ public:
         Token error_token;
         Vector<DeprecatedFlyString> capture_groups;
         AllOptions options;
+
+        struct {
+            // If set, every match has to start with this code point; the matcher
+            // uses it to skip ahead over positions that cannot possibly match
+            // instead of running the bytecode there.
+            Optional<u32> starting_literal;
+            // Shift-Or scan table over the pattern's leading fixed-width positions:
+            // bit j of byte_masks[byte] is set when the byte may appear at position j
+            // of a match (conservatively over-approximated). The matcher uses it to
+            // locate candidate positions in byte-backed views in linear time before
+            // handing them to the bytecode VM. Empty when no usable prefix exists.
+            size_t prefix_mask_count { 0 };
+            Vector<u64> prefix_byte_masks;
+        } optimization_data {};
     };
 
     explicit Parser(Lexer& lexer)
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/QuickSort.h>
 #include <LibSQL/BTree.h>
 #include <LibSQL/Meta.h>
 
@@ -69,6 +70,111 @@ bool BTree::insert(Key const& key)
     return m_root->insert(key);
 }
 
+bool BTree::bulk_load(Vector<Key> keys)
+{
+    if (!m_root)
+        initialize_root();
+    VERIFY(m_root);
+
+    // Bulk loading builds the tree bottom-up from scratch; if the tree
+    // already holds keys, fall back to inserting one at a time.
+    if (m_root->size() != 0) {
+        auto result = true;
+        for (auto& key : keys)
+            result = m_root->insert(key) && result;
+        return result;
+    }
+
+    quick_sort(keys, [](Key const& left, Key const& right) { return left < right; });
+
+    auto result = true;
+    if (!duplicates_allowed()) {
+        size_t kept = 0;
+        for (size_t ix = 0; ix < keys.size(); ix++) {
+            if (kept > 0 && keys[kept - 1] == keys[ix]) {
+                result = false;
+                continue;
+            }
+            if (kept != ix)
+                keys[kept] = move(keys[ix]);
+            kept++;
+        }
+        keys.resize(kept);
+    }
+
+    if (keys.is_empty())
+        return result;
+
+    // Build one level at a time, filling each node left to right. A key that
+    // would overflow the node it is headed for becomes the separator between
+    // that node and the next one, and is carried up to the level above -
+    // mirroring where repeated splits would have put it, but without
+    // rewriting any node. A node only gets a heap block once it is hooked up
+    // to its parent (or becomes the root, which reuses the tree's own block),
+    // so every allocated block is backed by exactly one write and the heap
+    // stays free of holes.
+    Vector<TreeNode*> children;
+    Vector<Key> level_keys = move(keys);
+    TreeNode* root_node = nullptr;
+    while (root_node == nullptr) {
+        Vector<TreeNode*> nodes;
+        Vector<Key> promoted;
+        size_t child_index = 0;
+
+        auto adopt_child = [&]() -> TreeNode* {
+            auto* child = children[child_index++];
+            child->set_pointer(new_record_pointer());
+            serializer().serialize_and_write(*child);
+            return child;
+        };
+        auto open_node = [&]() -> TreeNode* {
+            if (children.is_empty())
+                return new TreeNode(*this, nullptr, 0u);
+            auto* child = adopt_child();
+            auto* node = new TreeNode(*this, nullptr, child, 0u);
+            child->m_up = node;
+            return node;
+        };
+
+        // Fill nodes to three quarters of a block, so that keys inserted
+        // after the bulk load don't immediately split every node they land in.
+        constexpr size_t fill_size = BLOCKSIZE - BLOCKSIZE / 4;
+
+        auto* current = open_node();
+        for (size_t ix = 0; ix < level_keys.size(); ix++) {
+            auto& key = level_keys[ix];
+            auto length_with_key = (current->size() ? current->length() : sizeof(u32)) + sizeof(u32) + key.length();
+            if (length_with_key > fill_size && current->size() > 0 && ix + 1 < level_keys.size()) {
+                nodes.append(current);
+                promoted.append(move(key));
+                current = open_node();
+                continue;
+            }
+            current->m_entries.append(move(key));
+            if (children.is_empty()) {
+                current->m_down.empend(current, nullptr);
+            } else {
+                auto* child = adopt_child();
+                child->m_up = current;
+                current->m_down.empend(current, child);
+            }
+        }
+        nodes.append(current);
+
+        if (nodes.size() == 1) {
+            root_node = nodes.first();
+        } else {
+            children = move(nodes);
+            level_keys = move(promoted);
+        }
+    }
+
+    root_node->set_pointer(pointer());
+    serializer().serialize_and_write(*root_node);
+    m_root = adopt_own(*root_node);
+    return result;
+}
+
 bool BTree::update_key_pointer(Key const& key)
 {
     if (!m_root)
@@ -82,6 +82,12 @@ ErrorOr<ByteBuffer> Heap::read_block(u32 block)
     if (auto buffer = m_write_ahead_log.get(block); buffer.has_value())
         return TRY(ByteBuffer::copy(*buffer));
 
+    if (auto cached = m_block_cache.find(block); cached != m_block_cache.end()) {
+        dbgln_if(SQL_DEBUG, "Read heap block {} from cache", block);
+        cached->value.last_used = ++m_block_cache_counter;
+        return TRY(ByteBuffer::copy(cached->value.data));
+    }
+
     if (block >= m_next_block) {
         warnln("Heap({})::read_block({}): block # out of range (>= {})"sv, name(), block, m_next_block);
         return Error::from_string_literal("Heap()::read_block(): block # out of range");
@@ -96,9 +102,24 @@ ErrorOr<ByteBuffer> Heap::read_block(u32 block)
     dbgln_if(SQL_DEBUG, "{:hex-dump}", bytes.trim(8));
     TRY(buffer.try_resize(bytes.size()));
 
+    cache_block(block, TRY(ByteBuffer::copy(buffer)));
     return buffer;
 }
 
+void Heap::cache_block(u32 block, ByteBuffer data)
+{
+    if (m_block_cache.size() >= block_cache_capacity && !m_block_cache.contains(block)) {
+        auto least_recently_used = m_block_cache.begin();
+        for (auto it = m_block_cache.begin(); it != m_block_cache.end(); ++it) {
+            if (it->value.last_used < least_recently_used->value.last_used)
+                least_recently_used = it;
+        }
+        dbgln_if(SQL_DEBUG, "Evicting heap block {} from cache", least_recently_used->key);
+        m_block_cache.remove(least_recently_used);
+    }
+    m_block_cache.set(block, { move(data), ++m_block_cache_counter });
+}
+
 ErrorOr<void> Heap::write_block(u32 block, ByteBuffer& buffer)
 {
     if (!m_file) {
@@ -179,6 +200,7 @@ ErrorOr<void> Heap::flush()
         VERIFY(buffer_it != m_write_ahead_log.end());
         dbgln_if(SQL_DEBUG, "Flushing block {} to {}", block, name());
         TRY(write_block(block, buffer_it->value));
+        cache_block(block, move(buffer_it->value));
     }
     m_write_ahead_log.clear();
     dbgln_if(SQL_DEBUG, "WAL flushed. Heap size = {}", size());
@@ -98,6 +98,12 @@ private:
     ErrorOr<void> read_zero_block();
     void initialize_zero_block();
     void update_zero_block();
+    void cache_block(u32, ByteBuffer);
+
+    struct BlockCacheEntry {
+        ByteBuffer data;
+        u64 last_used { 0 };
+    };
 
     OwnPtr<Core::Stream::BufferedFile> m_file;
     u32 m_free_list { 0 };
@@ -109,6 +115,12 @@ private:
     u32 m_version { current_version };
     Array<u32, 16> m_user_values { 0 };
     HashMap<u32, ByteBuffer> m_write_ahead_log;
+    // Clean copies of recently accessed blocks, so hot pages don't go back
+    // to the file on every read. Dirty blocks live in the write-ahead log
+    // until they are flushed; the log is checked before the cache.
+    static constexpr size_t block_cache_capacity = 64;
+    HashMap<u32, BlockCacheEntry> m_block_cache;
+    u64 m_block_cache_counter { 0 };
 };
 
 }
@@ -107,6 +107,11 @@ void TreeNode::deserialize(Serializer& serializer)
     auto nodes = serializer.deserialize<u32>();
     dbgln_if(SQL_DEBUG, "Deserializing node. Size {}", nodes);
     if (nodes > 0) {
+        // The constructor may have set this node up as an empty leaf with a
+        // null down pointer; the serialized data decides what the node
+        // actually is.
+        m_entries.clear();
+        m_down.clear();
         for (u32 i = 0; i < nodes; i++) {
             auto left = serializer.deserialize<u32>();
             dbgln_if(SQL_DEBUG, "Down[{}] {}", i, left);
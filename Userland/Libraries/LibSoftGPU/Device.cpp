@@ -24,6 +24,7 @@
 #include <LibSoftGPU/SIMD.h>
 #include <LibSoftGPU/Shader.h>
 #include <LibSoftGPU/ShaderCompiler.h>
+#include <LibThreading/ThreadPool.h>
 #include <math.h>
 
 namespace SoftGPU {
@@ -272,6 +273,8 @@ ALWAYS_INLINE void Device::rasterize(Gfx::IntRect& render_bounds, CB1 set_covera
     render_bounds.intersect(m_frame_buffer->rect());
     if (m_options.scissor_enabled)
         render_bounds.intersect(m_options.scissor_box);
+    if (render_bounds.is_empty())
+        return;
 
     // Quad bounds
     auto const render_bounds_left = render_bounds.left();
@@ -283,9 +286,9 @@ ALWAYS_INLINE void Device::rasterize(Gfx::IntRect& render_bounds, CB1 set_covera
     auto const qy0 = render_bounds_top & ~1;
     auto const qy1 = render_bounds_bottom & ~1;
 
-    // Rasterize all quads
-    // FIXME: this could be embarrassingly parallel
-    for (int qy = qy0; qy <= qy1; qy += 2) {
+    // Rasterize all quads, row by row
+    auto rasterize_quad_row = [&](size_t quad_row) {
+        auto const qy = qy0 + static_cast<int>(quad_row) * 2;
         for (int qx = qx0; qx <= qx1; qx += 2) {
             PixelQuad quad;
             quad.screen_coordinates = {
@@ -496,6 +499,19 @@ ALWAYS_INLINE void Device::rasterize(Gfx::IntRect& render_bounds, CB1 set_covera
             else
                 store4_masked((argb32_color & m_options.color_mask) | (dst_u32 & ~m_options.color_mask), color_ptrs[0], color_ptrs[1], color_ptrs[2], color_ptrs[3], quad.mask);
         }
+    };
+
+    // Each row of quads covers its own scanlines of the color, depth and stencil buffers,
+    // so rows can be distributed across the thread pool without synchronizing on the
+    // buffers themselves.
+    auto const quad_row_count = static_cast<size_t>(qy1 - qy0) / 2 + 1;
+    if (m_current_fragment_shader) {
+        // A bound fragment shader program executes on the device's single shader
+        // processor, whose register file cannot be shared between threads.
+        for (size_t quad_row = 0; quad_row < quad_row_count; ++quad_row)
+            rasterize_quad_row(quad_row);
+    } else {
+        Threading::parallel_for_each_range(quad_row_count, rasterize_quad_row);
     }
 }
 
@@ -1010,26 +1026,31 @@ void Device::draw_primitives(GPU::PrimitiveType primitive_type, FloatMatrix4x4 c
     // See section 2.11.3 of the OpenGL 1.5 spec
     auto const normal_transform = model_view_transform.submatrix_from_topleft<3>().transpose().inverse();
 
-    // First, transform all vertices
-    for (auto& vertex : vertices) {
-        vertex.eye_coordinates = model_view_transform * vertex.position;
+    // First, transform and light all vertices. Each vertex is independent of the others,
+    // so larger draws are batched across the thread pool.
+    Threading::parallel_for_each_range(
+        vertices.size(),
+        [&](size_t vertex_index) {
+            auto& vertex = vertices[vertex_index];
+            vertex.eye_coordinates = model_view_transform * vertex.position;
 
-        vertex.normal = normal_transform * vertex.normal;
-        if (m_options.normalization_enabled)
-            vertex.normal.normalize();
+            vertex.normal = normal_transform * vertex.normal;
+            if (m_options.normalization_enabled)
+                vertex.normal.normalize();
 
-        calculate_vertex_lighting(vertex);
+            calculate_vertex_lighting(vertex);
 
-        vertex.clip_coordinates = projection_transform * vertex.eye_coordinates;
+            vertex.clip_coordinates = projection_transform * vertex.eye_coordinates;
 
-        for (GPU::TextureUnitIndex i = 0; i < GPU::NUM_TEXTURE_UNITS; ++i) {
-            auto const& texture_unit_configuration = m_texture_unit_configuration[i];
-            if (!texture_unit_configuration.enabled)
-                continue;
-            generate_texture_coordinates(vertex, vertex.tex_coords[i], texture_unit_configuration);
-            vertex.tex_coords[i] = texture_unit_configuration.transformation_matrix * vertex.tex_coords[i];
-        }
-    }
+            for (GPU::TextureUnitIndex i = 0; i < GPU::NUM_TEXTURE_UNITS; ++i) {
+                auto const& texture_unit_configuration = m_texture_unit_configuration[i];
+                if (!texture_unit_configuration.enabled)
+                    continue;
+                generate_texture_coordinates(vertex, vertex.tex_coords[i], texture_unit_configuration);
+                vertex.tex_coords[i] = texture_unit_configuration.transformation_matrix * vertex.tex_coords[i];
+            }
+        },
+        64);
 
     // Window coordinate calculation
     auto const viewport = m_options.viewport;
@@ -10,13 +10,50 @@
 #include <AK/JsonObject.h>
 #include <AK/JsonValue.h>
 #include <AK/LexicalPath.h>
+#include <LibCore/EventLoop.h>
 #include <LibCore/File.h>
 #include <LibCore/MappedFile.h>
 #include <LibDebug/DebugInfo.h>
+#include <LibIPC/ConnectionToServer.h>
 #include <LibSymbolication/Symbolication.h>
+#include <SymbolServer/SymbolClientEndpoint.h>
+#include <SymbolServer/SymbolServerEndpoint.h>
 
 namespace Symbolication {
 
+class Client final
+    : public IPC::ConnectionToServer<SymbolClientEndpoint, SymbolServerEndpoint>
+    , public SymbolClientEndpoint {
+    IPC_CLIENT_CONNECTION(Client, "/tmp/session/%sid/portal/symbol"sv)
+
+private:
+    explicit Client(NonnullOwnPtr<Core::Stream::LocalSocket> socket)
+        : IPC::ConnectionToServer<SymbolClientEndpoint, SymbolServerEndpoint>(*this, move(socket))
+    {
+    }
+};
+
+static RefPtr<Client> s_client;
+static bool s_tried_to_connect_to_server = false;
+
+static Client* client()
+{
+    // Connecting needs an event loop for the IPC socket notifier, and a
+    // failed attempt is remembered so processes without a running
+    // SymbolServer don't retry the portal for every stack frame.
+    if (!s_tried_to_connect_to_server && !s_client && Core::EventLoop::has_been_instantiated()) {
+        s_tried_to_connect_to_server = true;
+        auto client_or_error = Client::try_create();
+        if (client_or_error.is_error())
+            dbgln("Failed to connect to SymbolServer: {}", client_or_error.error());
+        else
+            s_client = client_or_error.release_value();
+    }
+    if (s_client && !s_client->is_open())
+        s_client = nullptr;
+    return s_client.ptr();
+}
+
 struct CachedELF {
     NonnullRefPtr<Core::MappedFile> mapped_file;
     NonnullOwnPtr<Debug::DebugInfo> debug_info;
@@ -58,6 +95,30 @@ Optional<FlatPtr> kernel_base()
 }
 
 Optional<Symbol> symbolicate(DeprecatedString const& path, FlatPtr address, IncludeSourcePosition include_source_positions)
+{
+    if (auto* symbol_client = client()) {
+        auto response = symbol_client->symbolicate(path, address, include_source_positions == IncludeSourcePosition::Yes);
+        if (response.found()) {
+            Vector<Debug::DebugInfo::SourcePosition> positions;
+            auto const& files = response.source_position_files();
+            auto const& lines = response.source_position_lines();
+            for (size_t i = 0; i < files.size(); ++i)
+                positions.append({ files[i], lines[i] });
+            return Symbol {
+                .address = address,
+                .name = response.name(),
+                .object = LexicalPath::basename(path),
+                .offset = response.offset(),
+                .source_positions = move(positions),
+            };
+        }
+        // The server may simply not have access to this binary, so fall
+        // through to trying in-process.
+    }
+    return symbolicate_locally(path, address, include_source_positions);
+}
+
+Optional<Symbol> symbolicate_locally(DeprecatedString const& path, FlatPtr address, IncludeSourcePosition include_source_positions)
 {
     DeprecatedString full_path = path;
     if (!path.starts_with('/')) {
@@ -27,6 +27,13 @@ enum class IncludeSourcePosition {
 
 Optional<FlatPtr> kernel_base();
 Vector<Symbol> symbolicate_thread(pid_t pid, pid_t tid, IncludeSourcePosition = IncludeSourcePosition::Yes);
+
+// Asks SymbolServer when one is reachable, so the parsed binaries are shared
+// between all symbolicating processes, and falls back to parsing in-process.
 Optional<Symbol> symbolicate(DeprecatedString const& path, FlatPtr address, IncludeSourcePosition = IncludeSourcePosition::Yes);
 
+// Always parses in-process, with a per-process cache of parsed binaries.
+// This is what SymbolServer itself uses.
+Optional<Symbol> symbolicate_locally(DeprecatedString const& path, FlatPtr address, IncludeSourcePosition = IncludeSourcePosition::Yes);
+
 }
@@ -74,8 +74,20 @@ void Highlighter::highlight_matching_token_pair()
 
     auto pairs = matching_token_pairs();
 
+    // Only look for the cursor's span inside the visible region (when the
+    // client knows it): scanning every span of a huge document on each cursor
+    // move is too slow, and a cursor outside the viewport has no visible
+    // buddies to highlight anyway.
+    auto visible_range = m_client->get_visible_range();
+
     for (size_t i = 0; i < document.spans().size(); ++i) {
         auto& span = const_cast<GUI::TextDocumentSpan&>(document.spans().at(i));
+        if (visible_range.has_value()) {
+            if (span.range.start().line() > visible_range->end().line())
+                break;
+            if (span.range.end().line() < visible_range->start().line())
+                continue;
+        }
         auto token_type = span.data;
 
         for (auto& pair : pairs) {
@@ -102,6 +114,75 @@ void Highlighter::attach(HighlighterClient& client)
 {
     VERIFY(!m_client);
     m_client = &client;
+    invalidate_line_checkpoints();
+}
+
+void Highlighter::rehighlight_using_line_checkpoints(Palette const& palette)
+{
+    auto text = m_client->get_text();
+    auto lines = StringView { text }.lines();
+
+    if (m_line_checkpoint_palette.ptr() != &palette.impl()) {
+        invalidate_line_checkpoints();
+        m_line_checkpoint_palette = &palette.impl();
+    }
+
+    Vector<LineCheckpoint> checkpoints;
+    checkpoints.ensure_capacity(lines.size());
+
+    LexerState state = initial_lexer_state;
+    size_t line_index = 0;
+
+    // Unchanged leading lines keep their checkpoints as-is.
+    while (line_index < lines.size() && line_index < m_line_checkpoints.size()) {
+        auto& old_checkpoint = m_line_checkpoints[line_index];
+        if (old_checkpoint.entry_state != state || old_checkpoint.text != lines[line_index])
+            break;
+        state = old_checkpoint.exit_state;
+        checkpoints.unchecked_append(old_checkpoint);
+        ++line_index;
+    }
+
+    // Relex from there on, but resynchronize with the old checkpoints as soon
+    // as a line (matched up from the back, so inserted or deleted lines just
+    // shift the correspondence) has the same text and entry state as before.
+    ssize_t old_line_offset = static_cast<ssize_t>(lines.size()) - static_cast<ssize_t>(m_line_checkpoints.size());
+    while (line_index < lines.size()) {
+        auto old_index = static_cast<ssize_t>(line_index) - old_line_offset;
+        if (old_index >= 0 && old_index < static_cast<ssize_t>(m_line_checkpoints.size())) {
+            auto& old_checkpoint = m_line_checkpoints[old_index];
+            if (old_checkpoint.entry_state == state && old_checkpoint.text == lines[line_index]) {
+                state = old_checkpoint.exit_state;
+                checkpoints.append(old_checkpoint);
+                ++line_index;
+                continue;
+            }
+        }
+        LineCheckpoint checkpoint;
+        checkpoint.text = lines[line_index];
+        checkpoint.entry_state = state;
+        state = lex_line(lines[line_index], state, palette, checkpoint.spans);
+        checkpoint.exit_state = state;
+        checkpoints.append(move(checkpoint));
+        ++line_index;
+    }
+
+    m_line_checkpoints = move(checkpoints);
+
+    Vector<GUI::TextDocumentSpan> spans;
+    for (size_t i = 0; i < m_line_checkpoints.size(); ++i) {
+        for (auto span : m_line_checkpoints[i].spans) {
+            span.range.set_start({ i, span.range.start().column() });
+            span.range.set_end({ i, span.range.end().column() });
+            spans.append(move(span));
+        }
+    }
+    m_client->do_set_spans(move(spans));
+
+    m_has_brace_buddies = false;
+    highlight_matching_token_pair();
+
+    m_client->do_update();
 }
 
 void Highlighter::detach()
@@ -70,6 +70,29 @@ public:
 protected:
     Highlighter() = default;
 
+    // Incremental rehighlighting for line-oriented lexers.
+    //
+    // A highlighter whose lexer can be restarted at line boundaries opts in
+    // by implementing lex_line() and calling
+    // rehighlight_using_line_checkpoints() from its rehighlight(). The base
+    // class remembers each line's text, the lexer state at its start, and the
+    // spans it produced, so an edit only relexes from the nearest line whose
+    // entry state is still valid until the lexer resynchronizes with the
+    // cached lines, instead of relexing the whole document.
+    using LexerState = u64;
+    static constexpr LexerState initial_lexer_state = 0;
+
+    // Lexes a single line (without its newline) that starts in the given
+    // state, appends spans with line-local ranges, and returns the state in
+    // effect at the start of the next line.
+    virtual LexerState lex_line(StringView, LexerState, Palette const&, Vector<GUI::TextDocumentSpan>&)
+    {
+        VERIFY_NOT_REACHED();
+    }
+
+    void rehighlight_using_line_checkpoints(Palette const&);
+    void invalidate_line_checkpoints() { m_line_checkpoints.clear(); }
+
     // FIXME: This should be WeakPtr somehow
     HighlighterClient* m_client { nullptr };
 
@@ -87,6 +110,17 @@ protected:
     bool m_has_brace_buddies { false };
     BuddySpan m_brace_buddies[2];
     HashTable<MatchingTokenPair> m_nested_token_pairs;
+
+private:
+    struct LineCheckpoint {
+        DeprecatedString text;
+        LexerState entry_state { initial_lexer_state };
+        LexerState exit_state { initial_lexer_state };
+        Vector<GUI::TextDocumentSpan> spans; // Ranges are line-local.
+    };
+    Vector<LineCheckpoint> m_line_checkpoints;
+    // Cached spans carry palette colors, so they have to go when the palette does.
+    RefPtr<Gfx::PaletteImpl const> m_line_checkpoint_palette;
 };
 
 class ProxyHighlighterClient final : public Syntax::HighlighterClient {
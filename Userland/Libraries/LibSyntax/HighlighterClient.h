@@ -26,11 +26,15 @@ public:
     virtual GUI::TextDocument& highlighter_did_request_document() = 0;
     virtual GUI::TextPosition highlighter_did_request_cursor() const = 0;
     virtual void highlighter_did_set_spans(Vector<GUI::TextDocumentSpan>) = 0;
+    // The range of the document the user can currently see, if the client
+    // knows it; highlighters may use it to skip work for off-screen spans.
+    virtual Optional<GUI::TextRange> highlighter_did_request_visible_range() const { return {}; }
 
     void do_set_spans(Vector<GUI::TextDocumentSpan> spans) { highlighter_did_set_spans(move(spans)); }
     void do_update() { highlighter_did_request_update(); }
 
     DeprecatedString get_text() const { return highlighter_did_request_text(); }
+    Optional<GUI::TextRange> get_visible_range() const { return highlighter_did_request_visible_range(); }
     GUI::TextDocument& get_document() { return highlighter_did_request_document(); }
     GUI::TextPosition get_cursor() const { return highlighter_did_request_cursor(); }
 
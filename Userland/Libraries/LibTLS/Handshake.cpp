@@ -35,6 +35,8 @@ ByteBuffer TLSv12::build_hello()
     builder.append(version);
     builder.append(m_context.local_random, sizeof(m_context.local_random));
 
+    // Offer to resume a cached session for this host, if we have one.
+    offer_cached_session();
     builder.append(m_context.session_id_size);
     if (m_context.session_id_size)
         builder.append(m_context.session_id, m_context.session_id_size);
@@ -220,6 +222,14 @@ ssize_t TLSv12::handle_handshake_finished(ReadonlyBytes buffer, WritePacketStage
     dbgln_if(TLS_DEBUG, "FIXME: handle_handshake_finished :: Check message validity");
     m_context.connection_status = ConnectionStatus::Established;
 
+    // Remember the session so later connections to this host can resume it.
+    cache_session();
+
+    // When resuming, the server's Finished comes first and we still owe it our
+    // ChangeCipherSpec + Finished in response.
+    if (m_context.is_resuming)
+        write_packets = WritePacketStage::Finished;
+
     if (m_handshake_timeout_timer) {
         // Disable the handshake timeout timer as handshake has been established.
         m_handshake_timeout_timer->stop();
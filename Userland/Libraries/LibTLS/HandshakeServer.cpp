@@ -104,6 +104,14 @@ ssize_t TLSv12::handle_server_hello(ReadonlyBytes buffer, WritePacketStage& writ
         write_packets = WritePacketStage::ServerHandshake;
     }
 
+    // If the server echoed a session ID that's still in our cache, it accepted our
+    // offer to resume: re-derive the keys from the cached master secret and expect
+    // an immediate ChangeCipherSpec + Finished instead of a key exchange.
+    if (m_context.connection_status == ConnectionStatus::Negotiating && m_context.session_id_size != 0
+        && resume_cached_session(ReadonlyBytes { m_context.session_id, m_context.session_id_size })) {
+        m_context.connection_status = ConnectionStatus::KeyExchange;
+    }
+
     // Presence of extensions is determined by availability of bytes after compression_method
     if (buffer.size() - res >= 2) {
         auto extensions_bytes_total = AK::convert_between_host_and_network_endian(ByteReader::load16(buffer.offset_pointer(res += 2)));
@@ -97,6 +97,91 @@ void TLSv12::consume(ReadonlyBytes record)
     }
 }
 
+// Sessions are remembered per SNI host so that later connections to the same origin
+// can resume them with an abbreviated handshake instead of a full key exchange.
+// RFC 5246 appendix F.1.4 sets an upper bound of 24 hours on session lifetimes.
+struct CachedSession {
+    u8 session_id[32] {};
+    u8 session_id_size { 0 };
+    ByteBuffer master_key;
+    CipherSuite cipher { CipherSuite::Invalid };
+    time_t established_at { 0 };
+};
+
+constexpr static time_t MaximumSessionCacheTimeInSeconds = 24 * 60 * 60;
+static HashMap<DeprecatedString, CachedSession> s_session_cache;
+
+void TLSv12::offer_cached_session()
+{
+    m_context.session_id_size = 0;
+    if (m_context.is_server || m_context.extensions.SNI.is_empty())
+        return;
+
+    auto it = s_session_cache.find(m_context.extensions.SNI);
+    if (it == s_session_cache.end())
+        return;
+
+    if (Core::DateTime::now().timestamp() - it->value.established_at > MaximumSessionCacheTimeInSeconds) {
+        s_session_cache.remove(it);
+        return;
+    }
+
+    memcpy(m_context.session_id, it->value.session_id, it->value.session_id_size);
+    m_context.session_id_size = it->value.session_id_size;
+    dbgln_if(TLS_DEBUG, "Offering cached session for {}", m_context.extensions.SNI);
+}
+
+bool TLSv12::resume_cached_session(ReadonlyBytes session_id)
+{
+    if (m_context.is_server)
+        return false;
+
+    auto it = s_session_cache.find(m_context.extensions.SNI);
+    if (it == s_session_cache.end())
+        return false;
+
+    auto& session = it->value;
+    if (session.session_id_size == 0 || session.session_id_size != session_id.size())
+        return false;
+    if (memcmp(session.session_id, session_id.data(), session_id.size()) != 0)
+        return false;
+    if (session.cipher != m_context.cipher)
+        return false;
+
+    auto master_key_result = ByteBuffer::copy(session.master_key);
+    if (master_key_result.is_error())
+        return false;
+    m_context.master_key = master_key_result.release_value();
+    if (!expand_key())
+        return false;
+
+    m_context.is_resuming = true;
+    dbgln_if(TLS_DEBUG, "Resuming cached session for {}", m_context.extensions.SNI);
+    return true;
+}
+
+void TLSv12::cache_session()
+{
+    // A resumed session keeps its original cache entry (and timestamp), so the
+    // 24-hour bound counts from the full handshake that negotiated it.
+    if (m_context.is_server || m_context.is_resuming)
+        return;
+    if (m_context.extensions.SNI.is_empty() || m_context.session_id_size == 0 || m_context.master_key.is_empty())
+        return;
+
+    auto master_key_result = ByteBuffer::copy(m_context.master_key);
+    if (master_key_result.is_error())
+        return;
+
+    CachedSession session;
+    memcpy(session.session_id, m_context.session_id, m_context.session_id_size);
+    session.session_id_size = m_context.session_id_size;
+    session.master_key = master_key_result.release_value();
+    session.cipher = m_context.cipher;
+    session.established_at = Core::DateTime::now().timestamp();
+    s_session_cache.set(m_context.extensions.SNI, move(session));
+}
+
 bool Certificate::is_valid() const
 {
     auto now = Core::DateTime::now();
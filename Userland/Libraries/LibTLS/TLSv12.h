@@ -322,6 +322,7 @@ struct Context {
     bool connection_finished { false };
     bool close_notify { false };
     bool has_invoked_finish_or_error_callback { false };
+    bool is_resuming { false };
 
     // message flags
     u8 handshake_messages[11] { 0 };
@@ -488,6 +489,10 @@ private:
     ssize_t handle_message(ReadonlyBytes);
     ssize_t handle_random(ReadonlyBytes);
 
+    void offer_cached_session();
+    bool resume_cached_session(ReadonlyBytes session_id);
+    void cache_session();
+
     void pseudorandom_function(Bytes output, ReadonlyBytes secret, u8 const* label, size_t label_length, ReadonlyBytes seed, ReadonlyBytes seed_b);
 
     ssize_t verify_rsa_server_key_exchange(ReadonlyBytes server_key_info_buffer, ReadonlyBytes signature_buffer);
@@ -8,10 +8,14 @@
 #include <LibTest/Macros.h> // intentionally first -- we redefine VERIFY and friends in here
 
 #include <AK/Function.h>
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/QuickSort.h>
 #include <LibCore/ArgsParser.h>
+#include <LibCore/Stream.h>
 #include <LibTest/TestSuite.h>
 #include <stdlib.h>
-#include <sys/time.h>
+#include <time.h>
 
 namespace Test {
 
@@ -21,21 +25,23 @@ class TestElapsedTimer {
 public:
     TestElapsedTimer() { restart(); }
 
-    void restart() { gettimeofday(&m_started, nullptr); }
+    void restart() { clock_gettime(CLOCK_MONOTONIC, &m_started); }
 
     u64 elapsed_milliseconds()
     {
-        struct timeval now = {};
-        gettimeofday(&now, nullptr);
+        return elapsed_nanoseconds() / 1'000'000;
+    }
 
-        struct timeval delta = {};
-        timersub(&now, &m_started, &delta);
+    u64 elapsed_nanoseconds()
+    {
+        struct timespec now = {};
+        clock_gettime(CLOCK_MONOTONIC, &now);
 
-        return delta.tv_sec * 1000 + delta.tv_usec / 1000;
+        return (now.tv_sec - m_started.tv_sec) * 1'000'000'000ull + (now.tv_nsec - m_started.tv_nsec);
     }
 
 private:
-    struct timeval m_started = {};
+    struct timespec m_started = {};
 };
 
 // Declared in Macros.h
@@ -66,13 +72,19 @@ int TestSuite::main(DeprecatedString const& suite_name, int argc, char** argv)
     bool do_benchmarks_only = false;
     bool do_list_cases = false;
     char const* search_string = "*";
+    DeprecatedString benchmark_json_path;
 
     args_parser.add_option(do_tests_only, "Only run tests.", "tests", 0);
     args_parser.add_option(do_benchmarks_only, "Only run benchmarks.", "bench", 0);
+    args_parser.add_option(m_benchmark_repetitions, "Number of times to repeat each benchmark (default 1)", "bench-repeat", 0, "N");
+    args_parser.add_option(benchmark_json_path, "Write benchmark results to a JSON file", "bench-json", 0, "path");
     args_parser.add_option(do_list_cases, "List available test cases.", "list", 0);
     args_parser.add_positional_argument(search_string, "Only run matching cases.", "pattern", Core::ArgsParser::Required::No);
     args_parser.parse(argc, argv);
 
+    if (m_benchmark_repetitions == 0)
+        m_benchmark_repetitions = 1;
+
     if (m_setup)
         m_setup();
 
@@ -88,7 +100,39 @@ int TestSuite::main(DeprecatedString const& suite_name, int argc, char** argv)
 
     outln("Running {} cases out of {}.", matching_tests.size(), m_cases.size());
 
-    return run(matching_tests);
+    int result = run(matching_tests);
+
+    if (!benchmark_json_path.is_empty()) {
+        if (auto write_result = write_benchmark_results(benchmark_json_path); write_result.is_error()) {
+            warnln("Failed to write benchmark results to {}: {}", benchmark_json_path, write_result.error());
+            return 1;
+        }
+    }
+
+    return result;
+}
+
+ErrorOr<void> TestSuite::write_benchmark_results(DeprecatedString const& path)
+{
+    JsonArray benchmarks;
+    for (auto const& result : m_benchmark_results) {
+        JsonObject benchmark;
+        benchmark.set("name", result.name);
+        benchmark.set("iterations", result.iterations);
+        benchmark.set("min_ns", result.min_nanoseconds);
+        benchmark.set("median_ns", result.median_nanoseconds);
+        benchmark.set("average_ns", result.average_nanoseconds);
+        benchmark.set("total_ns", result.total_nanoseconds);
+        benchmarks.append(move(benchmark));
+    }
+
+    JsonObject root;
+    root.set("suite", m_suite_name);
+    root.set("benchmarks", move(benchmarks));
+
+    auto file = TRY(Core::Stream::File::open(path, Core::Stream::OpenMode::Write));
+    TRY(file->write_entire_buffer(root.to_deprecated_string().bytes()));
+    return {};
 }
 
 NonnullRefPtrVector<TestCase> TestSuite::find_cases(DeprecatedString const& search, bool find_tests, bool find_benchmarks)
@@ -120,21 +164,58 @@ int TestSuite::run(NonnullRefPtrVector<TestCase> const& tests)
 
     for (auto const& t : tests) {
         auto const test_type = t.is_benchmark() ? "benchmark" : "test";
+        auto const repetitions = t.is_benchmark() ? m_benchmark_repetitions : 1;
 
         warnln("Running {} '{}'.", test_type, t.name());
         m_current_test_case_passed = true;
 
-        TestElapsedTimer timer;
-        t.func()();
-        auto const time = timer.elapsed_milliseconds();
+        // Benchmarks with repetition get an untimed warmup run, so that
+        // cold caches and lazy initialization don't pollute the samples.
+        if (t.is_benchmark() && repetitions > 1)
+            t.func()();
+
+        u64 total_time = 0;
+        u64 sum_of_nanoseconds = 0;
+        Vector<u64> nanoseconds_samples;
+
+        if (m_current_test_case_passed) {
+            for (u64 i = 0; i < repetitions; ++i) {
+                TestElapsedTimer timer;
+                t.func()();
+                auto const iteration_nanoseconds = timer.elapsed_nanoseconds();
+
+                if (!m_current_test_case_passed)
+                    break;
+
+                sum_of_nanoseconds += iteration_nanoseconds;
+                nanoseconds_samples.append(iteration_nanoseconds);
+            }
+            total_time = sum_of_nanoseconds / 1'000'000;
+        }
+
+        if (t.is_benchmark() && m_current_test_case_passed) {
+            quick_sort(nanoseconds_samples);
+            m_benchmark_results.append({
+                .name = t.name(),
+                .iterations = nanoseconds_samples.size(),
+                .min_nanoseconds = nanoseconds_samples.first(),
+                .median_nanoseconds = nanoseconds_samples[nanoseconds_samples.size() / 2],
+                .average_nanoseconds = sum_of_nanoseconds / nanoseconds_samples.size(),
+                .total_nanoseconds = sum_of_nanoseconds,
+            });
+            if (repetitions > 1) {
+                auto const& result = m_benchmark_results.last();
+                dbgln("Benchmark '{}': {} iterations, min={}ns, median={}ns, average={}ns", t.name(), result.iterations, result.min_nanoseconds, result.median_nanoseconds, result.average_nanoseconds);
+            }
+        }
 
-        dbgln("{} {} '{}' in {}ms", m_current_test_case_passed ? "Completed" : "Failed", test_type, t.name(), time);
+        dbgln("{} {} '{}' in {}ms", m_current_test_case_passed ? "Completed" : "Failed", test_type, t.name(), total_time);
 
         if (t.is_benchmark()) {
-            m_benchtime += time;
+            m_benchtime += total_time;
             benchmark_count++;
         } else {
-            m_testtime += time;
+            m_testtime += total_time;
             test_count++;
         }
 
@@ -10,12 +10,23 @@
 #include <LibTest/Macros.h> // intentionally first -- we redefine VERIFY and friends in here
 
 #include <AK/DeprecatedString.h>
+#include <AK/Error.h>
 #include <AK/Function.h>
 #include <AK/NonnullRefPtrVector.h>
+#include <AK/Vector.h>
 #include <LibTest/TestCase.h>
 
 namespace Test {
 
+struct BenchmarkResult {
+    DeprecatedString name;
+    u64 iterations { 0 };
+    u64 min_nanoseconds { 0 };
+    u64 median_nanoseconds { 0 };
+    u64 average_nanoseconds { 0 };
+    u64 total_nanoseconds { 0 };
+};
+
 class TestSuite {
 public:
     static TestSuite& the()
@@ -45,11 +56,15 @@ public:
     void set_suite_setup(Function<void()> setup) { m_setup = move(setup); }
 
 private:
+    ErrorOr<void> write_benchmark_results(DeprecatedString const& path);
+
     static TestSuite* s_global;
     NonnullRefPtrVector<TestCase> m_cases;
     u64 m_testtime = 0;
     u64 m_benchtime = 0;
     DeprecatedString m_suite_name;
+    u64 m_benchmark_repetitions = 1;
+    Vector<BenchmarkResult> m_benchmark_results;
     bool m_current_test_case_passed = true;
     Function<void()> m_setup;
 };
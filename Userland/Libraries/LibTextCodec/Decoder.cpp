@@ -207,13 +207,76 @@ DeprecatedString convert_input_to_utf8_using_given_decoder_unless_there_is_a_byt
     return actual_decoder->to_utf8(input);
 }
 
+namespace {
+
+// Returns the length of the longest ASCII-only prefix of the input, scanning
+// a word at a time for a byte with the high bit set.
+size_t length_of_ascii_prefix(StringView input)
+{
+    auto const* data = reinterpret_cast<u8 const*>(input.characters_without_null_termination());
+    size_t length = 0;
+
+    constexpr size_t bytes_per_word = sizeof(size_t);
+    constexpr size_t high_bit_of_each_byte = static_cast<size_t>(0x8080808080808080ull);
+
+    while (length + bytes_per_word <= input.length()) {
+        size_t word;
+        __builtin_memcpy(&word, data + length, bytes_per_word);
+        if ((word & high_bit_of_each_byte) != 0)
+            break;
+        length += bytes_per_word;
+    }
+
+    while (length < input.length() && data[length] < 0x80)
+        ++length;
+
+    return length;
+}
+
+size_t length_of_non_ascii_prefix(StringView input)
+{
+    auto const* data = reinterpret_cast<u8 const*>(input.characters_without_null_termination());
+    size_t length = 0;
+
+    while (length < input.length() && data[length] >= 0x80)
+        ++length;
+
+    return length;
+}
+
+}
+
 DeprecatedString Decoder::to_utf8(StringView input)
 {
     StringBuilder builder(input.length());
-    process(input, [&builder](u32 c) { builder.append_code_point(c); });
+    to_utf8(builder, input);
     return builder.to_deprecated_string();
 }
 
+void Decoder::to_utf8(StringBuilder& builder, StringView input)
+{
+    if (!is_ascii_compatible()) {
+        process(input, [&builder](u32 c) { builder.append_code_point(c); });
+        return;
+    }
+
+    // ASCII spans are identical in the source encoding and in UTF-8, so they
+    // are copied over wholesale; the decoder proper only sees the non-ASCII
+    // spans in between.
+    while (!input.is_empty()) {
+        auto ascii_length = length_of_ascii_prefix(input);
+        if (ascii_length > 0) {
+            builder.append(input.substring_view(0, ascii_length));
+            input = input.substring_view(ascii_length);
+            continue;
+        }
+
+        auto non_ascii_length = length_of_non_ascii_prefix(input);
+        process(input.substring_view(0, non_ascii_length), [&builder](u32 c) { builder.append_code_point(c); });
+        input = input.substring_view(non_ascii_length);
+    }
+}
+
 void UTF8Decoder::process(StringView input, Function<void(u32)> on_code_point)
 {
     for (auto c : Utf8View(input)) {
@@ -232,6 +295,15 @@ DeprecatedString UTF8Decoder::to_utf8(StringView input)
     return bomless_input;
 }
 
+void UTF8Decoder::to_utf8(StringBuilder& builder, StringView input)
+{
+    // Discard the BOM, but only at the very start of the stream.
+    if (auto bytes = input.bytes(); builder.is_empty() && bytes.size() >= 3 && bytes[0] == 0xEF && bytes[1] == 0xBB && bytes[2] == 0xBF)
+        input = input.substring_view(3);
+
+    builder.append(input);
+}
+
 void UTF16BEDecoder::process(StringView input, Function<void(u32)> on_code_point)
 {
     size_t utf16_length = input.length() - (input.length() % 2);
@@ -243,16 +315,20 @@ void UTF16BEDecoder::process(StringView input, Function<void(u32)> on_code_point
 
 DeprecatedString UTF16BEDecoder::to_utf8(StringView input)
 {
-    // Discard the BOM
-    auto bomless_input = input;
-    if (auto bytes = input.bytes(); bytes.size() >= 2 && bytes[0] == 0xFE && bytes[1] == 0xFF)
-        bomless_input = input.substring_view(2);
-
-    StringBuilder builder(bomless_input.length() / 2);
-    process(bomless_input, [&builder](u32 c) { builder.append_code_point(c); });
+    StringBuilder builder(input.length() / 2);
+    to_utf8(builder, input);
     return builder.to_deprecated_string();
 }
 
+void UTF16BEDecoder::to_utf8(StringBuilder& builder, StringView input)
+{
+    // Discard the BOM, but only at the very start of the stream.
+    if (auto bytes = input.bytes(); builder.is_empty() && bytes.size() >= 2 && bytes[0] == 0xFE && bytes[1] == 0xFF)
+        input = input.substring_view(2);
+
+    process(input, [&builder](u32 c) { builder.append_code_point(c); });
+}
+
 void UTF16LEDecoder::process(StringView input, Function<void(u32)> on_code_point)
 {
     size_t utf16_length = input.length() - (input.length() % 2);
@@ -264,16 +340,20 @@ void UTF16LEDecoder::process(StringView input, Function<void(u32)> on_code_point
 
 DeprecatedString UTF16LEDecoder::to_utf8(StringView input)
 {
-    // Discard the BOM
-    auto bomless_input = input;
-    if (auto bytes = input.bytes(); bytes.size() >= 2 && bytes[0] == 0xFF && bytes[1] == 0xFE)
-        bomless_input = input.substring_view(2);
-
-    StringBuilder builder(bomless_input.length() / 2);
-    process(bomless_input, [&builder](u32 c) { builder.append_code_point(c); });
+    StringBuilder builder(input.length() / 2);
+    to_utf8(builder, input);
     return builder.to_deprecated_string();
 }
 
+void UTF16LEDecoder::to_utf8(StringBuilder& builder, StringView input)
+{
+    // Discard the BOM, but only at the very start of the stream.
+    if (auto bytes = input.bytes(); builder.is_empty() && bytes.size() >= 2 && bytes[0] == 0xFF && bytes[1] == 0xFE)
+        input = input.substring_view(2);
+
+    process(input, [&builder](u32 c) { builder.append_code_point(c); });
+}
+
 void Latin1Decoder::process(StringView input, Function<void(u32)> on_code_point)
 {
     for (size_t i = 0; i < input.length(); ++i) {
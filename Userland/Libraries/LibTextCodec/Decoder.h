@@ -17,6 +17,16 @@ public:
     virtual void process(StringView, Function<void(u32)> on_code_point) = 0;
     virtual DeprecatedString to_utf8(StringView);
 
+    // Appends the decoded input to the builder as UTF-8. Callers converting a
+    // document in chunks can call this repeatedly with consecutive chunks
+    // instead of paying a per-code-point callback through process().
+    virtual void to_utf8(StringBuilder&, StringView);
+
+    // Whether bytes 0x00-0x7F decode to the same code points as ASCII and
+    // never occur as part of a multi-byte sequence, meaning ASCII spans can be
+    // copied into UTF-8 output wholesale.
+    virtual bool is_ascii_compatible() const { return true; }
+
 protected:
     virtual ~Decoder() = default;
 };
@@ -25,18 +35,23 @@ class UTF8Decoder final : public Decoder {
 public:
     virtual void process(StringView, Function<void(u32)> on_code_point) override;
     virtual DeprecatedString to_utf8(StringView) override;
+    virtual void to_utf8(StringBuilder&, StringView) override;
 };
 
 class UTF16BEDecoder final : public Decoder {
 public:
     virtual void process(StringView, Function<void(u32)> on_code_point) override;
     virtual DeprecatedString to_utf8(StringView) override;
+    virtual void to_utf8(StringBuilder&, StringView) override;
+    virtual bool is_ascii_compatible() const override { return false; }
 };
 
 class UTF16LEDecoder final : public Decoder {
 public:
     virtual void process(StringView, Function<void(u32)> on_code_point) override;
     virtual DeprecatedString to_utf8(StringView) override;
+    virtual void to_utf8(StringBuilder&, StringView) override;
+    virtual bool is_ascii_compatible() const override { return false; }
 };
 
 class Latin1Decoder final : public Decoder {
@@ -5,42 +5,39 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
-#include <AK/Queue.h>
+#include <AK/MPMCQueue.h>
 #include <LibThreading/BackgroundAction.h>
 #include <LibThreading/Mutex.h>
 #include <LibThreading/Thread.h>
+#include <sched.h>
 #include <unistd.h>
 
+// Producers and the background thread exchange work through a lock-free
+// queue, so enqueueing never contends with a running action. The mutex and
+// condition only guard going to sleep and waking up; neither is held while
+// touching the queue.
 static pthread_mutex_t s_mutex = PTHREAD_MUTEX_INITIALIZER;
 static pthread_cond_t s_condition = PTHREAD_COND_INITIALIZER;
-static Queue<Function<void()>>* s_all_actions;
+static MPMCQueue<Function<void()>>* s_all_actions;
 static Threading::Thread* s_background_thread;
 
 static intptr_t background_thread_func()
 {
-    Vector<Function<void()>> actions;
     while (true) {
-
         pthread_mutex_lock(&s_mutex);
-
-        while (s_all_actions->is_empty())
+        while (s_all_actions->weak_is_empty())
             pthread_cond_wait(&s_condition, &s_mutex);
-
-        while (!s_all_actions->is_empty())
-            actions.append(s_all_actions->dequeue());
-
         pthread_mutex_unlock(&s_mutex);
 
-        for (auto& action : actions)
-            action();
-
-        actions.clear();
+        // Only this thread dequeues, so the single-consumer fast path is fine.
+        for (auto action = s_all_actions->try_dequeue_single_consumer(); action.has_value(); action = s_all_actions->try_dequeue_single_consumer())
+            action.value()();
     }
 }
 
 static void init()
 {
-    s_all_actions = new Queue<Function<void()>>;
+    s_all_actions = new MPMCQueue<Function<void()>>;
     s_background_thread = &Threading::Thread::construct(background_thread_func, "Background Thread"sv).leak_ref();
     s_background_thread->start();
 }
@@ -57,8 +54,12 @@ void Threading::BackgroundActionBase::enqueue_work(Function<void()> work)
     if (s_all_actions == nullptr)
         init();
 
+    // The queue is bounded; if the background thread has fallen that far
+    // behind, yield until it has drained a slot.
+    while (!s_all_actions->try_enqueue(move(work)))
+        sched_yield();
+
     pthread_mutex_lock(&s_mutex);
-    s_all_actions->enqueue(move(work));
     pthread_cond_broadcast(&s_condition);
     pthread_mutex_unlock(&s_mutex);
 }
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibThreading/ThreadPool.h>
+#include <unistd.h>
+
+namespace Threading {
+
+// Index of the pool worker the current thread is, or -1 on any other thread.
+static thread_local ssize_t s_worker_index { -1 };
+
+ThreadPool& ThreadPool::the()
+{
+    // Deliberately leaked: the detached workers reference the pool until
+    // process exit, so it must never be destroyed.
+    static ThreadPool* s_the = new ThreadPool;
+    return *s_the;
+}
+
+ThreadPool::ThreadPool()
+{
+    auto const processor_count = sysconf(_SC_NPROCESSORS_ONLN);
+    auto const worker_count = processor_count > 1 ? static_cast<size_t>(processor_count) : 1;
+
+    for (size_t i = 0; i < worker_count; ++i)
+        m_workers.append(make<Worker>());
+
+    for (size_t i = 0; i < worker_count; ++i) {
+        auto name = DeprecatedString::formatted("ThreadPool worker {}", i);
+        auto thread = Thread::construct([this, i]() -> intptr_t {
+            worker_loop(i);
+            return 0;
+        },
+            name);
+        thread->start();
+        thread->detach();
+        m_threads.append(move(thread));
+    }
+}
+
+void ThreadPool::submit(Function<void()> job)
+{
+    size_t target_index;
+    if (s_worker_index >= 0)
+        target_index = static_cast<size_t>(s_worker_index);
+    else
+        target_index = m_round_robin_index.fetch_add(1, AK::MemoryOrder::memory_order_relaxed) % m_workers.size();
+
+    // The count is bumped before the job becomes visible so that the matching
+    // decrement in worker_loop() can never underflow; at worst a worker spins
+    // once on a count that is ahead of the queues.
+    m_queued_job_count.fetch_add(1, AK::MemoryOrder::memory_order_release);
+    {
+        auto& worker = *m_workers[target_index];
+        MutexLocker locker(worker.mutex);
+        worker.jobs.append(move(job));
+    }
+
+    MutexLocker locker(m_sleep_mutex);
+    m_work_available.signal();
+}
+
+Function<void()> ThreadPool::take_job(size_t worker_index)
+{
+    // Newest-first from our own queue keeps recently submitted (and likely
+    // still cache-warm) work on the thread it was submitted from...
+    {
+        auto& worker = *m_workers[worker_index];
+        MutexLocker locker(worker.mutex);
+        if (!worker.jobs.is_empty())
+            return worker.jobs.take_last();
+    }
+
+    // ...while stealing takes the oldest job, the one its owner would only
+    // have gotten around to last.
+    for (size_t offset = 1; offset < m_workers.size(); ++offset) {
+        auto& victim = *m_workers[(worker_index + offset) % m_workers.size()];
+        MutexLocker locker(victim.mutex);
+        if (!victim.jobs.is_empty())
+            return victim.jobs.take_first();
+    }
+
+    return nullptr;
+}
+
+void ThreadPool::worker_loop(size_t worker_index)
+{
+    s_worker_index = static_cast<ssize_t>(worker_index);
+
+    for (;;) {
+        if (auto job = take_job(worker_index)) {
+            m_queued_job_count.fetch_sub(1, AK::MemoryOrder::memory_order_acquire);
+            job();
+            continue;
+        }
+
+        MutexLocker locker(m_sleep_mutex);
+        m_work_available.wait_while([this] {
+            return m_queued_job_count.load(AK::MemoryOrder::memory_order_acquire) == 0;
+        });
+    }
+}
+
+}
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/AtomicRefCounted.h>
+#include <AK/Function.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/Vector.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibThreading/Mutex.h>
+#include <LibThreading/Thread.h>
+
+namespace Threading {
+
+// A process-global pool of worker threads for data-parallel work, so that
+// callers amortize thread creation instead of spawning a thread per task.
+//
+// Each worker owns a job queue: jobs submitted from a worker thread land on
+// that worker's own queue (an affinity hint that keeps related work and its
+// cache-warm data together) and run newest-first, while idle workers steal
+// the oldest job from another worker's queue.
+//
+// Jobs must not block indefinitely; a job that waits forever starves one
+// worker for the rest of the process lifetime.
+class ThreadPool {
+    AK_MAKE_NONCOPYABLE(ThreadPool);
+    AK_MAKE_NONMOVABLE(ThreadPool);
+
+public:
+    static ThreadPool& the();
+
+    size_t worker_count() const { return m_workers.size(); }
+
+    void submit(Function<void()> job);
+
+private:
+    ThreadPool();
+
+    struct Worker {
+        Mutex mutex;
+        Vector<Function<void()>> jobs;
+    };
+
+    Function<void()> take_job(size_t worker_index);
+    void worker_loop(size_t worker_index);
+
+    Vector<NonnullOwnPtr<Worker>> m_workers;
+    Vector<NonnullRefPtr<Thread>> m_threads;
+
+    // Only guards going to sleep and waking up; never held while running jobs.
+    Mutex m_sleep_mutex;
+    ConditionVariable m_work_available { m_sleep_mutex };
+    Atomic<size_t> m_queued_job_count { 0 };
+    Atomic<size_t> m_round_robin_index { 0 };
+};
+
+namespace Detail {
+
+// Shared between the caller of a parallel loop and its helper jobs. The
+// process_range function refers to state on the caller's stack; this is safe
+// because every chunk is claimed and processed before chunks_remaining can
+// reach zero, and the caller only returns once it has.
+struct ParallelRangeState final : public AtomicRefCounted<ParallelRangeState> {
+    ParallelRangeState(size_t a_count, size_t a_chunk_size, size_t a_chunk_count, Function<void(size_t, size_t)> a_process_range)
+        : count(a_count)
+        , chunk_size(a_chunk_size)
+        , chunk_count(a_chunk_count)
+        , chunks_remaining(a_chunk_count)
+        , process_range(move(a_process_range))
+    {
+    }
+
+    size_t count { 0 };
+    size_t chunk_size { 0 };
+    size_t chunk_count { 0 };
+    Atomic<size_t> next_chunk { 0 };
+    Atomic<size_t> chunks_remaining { 0 };
+    Function<void(size_t, size_t)> process_range;
+    Mutex mutex;
+    ConditionVariable completion { mutex };
+};
+
+// Claims and processes chunks until none are left. Helper jobs that only get
+// scheduled after all chunks have been claimed exit through the atomic
+// counter without touching process_range, so they may safely run (and drop
+// their state reference) after the originating call has returned.
+inline void process_parallel_range(ParallelRangeState& state)
+{
+    for (;;) {
+        auto const chunk = state.next_chunk.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+        if (chunk >= state.chunk_count)
+            return;
+
+        auto const begin = chunk * state.chunk_size;
+        auto const end = min(begin + state.chunk_size, state.count);
+        state.process_range(begin, end);
+
+        if (state.chunks_remaining.fetch_sub(1, AK::MemoryOrder::memory_order_acq_rel) == 1) {
+            MutexLocker locker(state.mutex);
+            state.completion.broadcast();
+        }
+    }
+}
+
+}
+
+// Runs `per_index` for every index in [0, count), distributing chunks of
+// `chunk_size` indices dynamically across the pool workers and the calling
+// thread. Returns once every index has been processed. A chunk_size of zero
+// picks one that gives each worker a handful of chunks to balance over.
+template<typename Callback>
+void parallel_for_each_range(size_t count, Callback per_index, size_t chunk_size = 0)
+{
+    if (count == 0)
+        return;
+
+    auto& pool = ThreadPool::the();
+    if (chunk_size == 0)
+        chunk_size = max(static_cast<size_t>(1), count / (pool.worker_count() * 4));
+
+    auto const chunk_count = (count + chunk_size - 1) / chunk_size;
+    if (chunk_count == 1) {
+        for (size_t index = 0; index < count; ++index)
+            per_index(index);
+        return;
+    }
+
+    auto state = adopt_ref(*new Detail::ParallelRangeState(count, chunk_size, chunk_count, [&per_index](size_t begin, size_t end) {
+        for (size_t index = begin; index < end; ++index)
+            per_index(index);
+    }));
+
+    auto const helper_count = min(pool.worker_count(), chunk_count - 1);
+    for (size_t i = 0; i < helper_count; ++i) {
+        pool.submit([state] {
+            Detail::process_parallel_range(*state);
+        });
+    }
+
+    // The calling thread participates instead of just waiting.
+    Detail::process_parallel_range(*state);
+
+    MutexLocker locker(state->mutex);
+    state->completion.wait_while([&] {
+        return state->chunks_remaining.load(AK::MemoryOrder::memory_order_acquire) != 0;
+    });
+}
+
+// Runs `callback` for every element of `collection`; see
+// parallel_for_each_range() for the scheduling behavior.
+template<typename Collection, typename Callback>
+void parallel_for_each(Collection&& collection, Callback callback, size_t chunk_size = 0)
+{
+    parallel_for_each_range(
+        collection.size(),
+        [&](size_t index) { callback(collection[index]); },
+        chunk_size);
+}
+
+// Maps `callback` over `collection` in parallel, returning the results in
+// order. The result type has to be default-constructible so that the result
+// vector can be allocated up front and each slot written independently.
+template<typename Collection, typename Callback>
+auto parallel_map(Collection&& collection, Callback callback, size_t chunk_size = 0) -> ErrorOr<Vector<decltype(callback(collection[0]))>>
+{
+    Vector<decltype(callback(collection[0]))> results;
+    TRY(results.try_resize(collection.size()));
+    parallel_for_each_range(
+        collection.size(),
+        [&](size_t index) { results[index] = callback(collection[index]); },
+        chunk_size);
+    return results;
+}
+
+}
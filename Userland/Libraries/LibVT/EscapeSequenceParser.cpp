@@ -32,6 +32,26 @@ Vector<EscapeSequenceParser::OscParameter> EscapeSequenceParser::osc_parameters(
     return params;
 }
 
+void EscapeSequenceParser::on_input(ReadonlyBytes bytes)
+{
+    size_t i = 0;
+    while (i < bytes.size()) {
+        // While the state machine sits in its ground state, runs of plain
+        // printable ASCII (the bulk of typical program output) print their
+        // bytes verbatim and can bypass the state machine entirely.
+        if (m_state_machine.in_initial_state()) {
+            size_t run_start = i;
+            while (i < bytes.size() && bytes[i] >= 0x20 && bytes[i] <= 0x7f)
+                ++i;
+            for (size_t j = run_start; j < i; ++j)
+                m_executor.emit_code_point(bytes[j]);
+            if (i == bytes.size())
+                break;
+        }
+        on_input(bytes[i++]);
+    }
+}
+
 void EscapeSequenceParser::perform_action(EscapeSequenceStateMachine::Action action, u8 byte)
 {
     auto advance_utf8 = [&](u8 byte) {
@@ -45,6 +45,8 @@ public:
         m_state_machine.advance(byte);
     }
 
+    void on_input(ReadonlyBytes);
+
 private:
     static constexpr size_t MAX_INTERMEDIATES = 2;
     static constexpr size_t MAX_PARAMETERS = 16;
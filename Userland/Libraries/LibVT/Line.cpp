@@ -40,6 +40,20 @@ void Line::set_length(size_t new_length)
         m_terminated_at = min(*m_terminated_at, new_length);
 }
 
+void Line::compact()
+{
+    // A line with a uniform background color renders identically when its trailing
+    // blank cells are dropped, so once the line becomes immutable those cells
+    // (usually most of the line) don't need to be kept around.
+    if (!has_only_one_background_color())
+        return;
+    size_t used_length = m_cells.size();
+    while (used_length > 1 && !(m_cells[used_length - 1] != Cell()))
+        --used_length;
+    set_length(used_length);
+    m_cells.shrink_to_fit();
+}
+
 void Line::push_cells_into_next_line(size_t new_length, Line* next_line, bool cursor_is_on_next_line, CursorPosition* cursor)
 {
     if (is_empty())
@@ -772,8 +772,10 @@ void Terminal::scroll_up(u16 region_top, u16 region_bottom, size_t count)
     // Clear 'new' lines at the bottom.
     if (should_move_to_scrollback) {
         // Since we moved the previous lines into history, we can't just clear them.
-        for (u16 row = region_bottom + 1 - count; row <= region_bottom; ++row)
+        for (u16 row = region_bottom + 1 - count; row <= region_bottom; ++row) {
             active_buffer().ptr_at(row) = make<Line>(columns());
+            active_buffer()[row].set_dirty(true);
+        }
     } else {
         // The new lines haven't been moved and we don't want to leak memory.
         for (u16 row = region_bottom + 1 - count; row <= region_bottom; ++row)
@@ -981,6 +983,11 @@ void Terminal::on_input(u8 byte)
     m_parser.on_input(byte);
 }
 
+void Terminal::on_input(ReadonlyBytes bytes)
+{
+    m_parser.on_input(bytes);
+}
+
 void Terminal::emit_code_point(u32 code_point)
 {
     auto working_set = m_working_sets[m_active_working_set_index];
@@ -76,6 +76,7 @@ public:
 #endif
 
     void on_input(u8);
+    void on_input(ReadonlyBytes);
 
     void set_cursor(unsigned row, unsigned column, bool skip_debug = false);
 
@@ -387,6 +388,10 @@ protected:
         if (max_history_size() == 0)
             return;
 
+        // Scrollback lines are never written to again, so they can shed the
+        // storage for their unused trailing cells.
+        line->compact();
+
         // If m_history can expand, add the new line to the end of the list.
         // If there is an overflow wrap, the end is at the index before the start.
         if (m_history.size() < max_history_size()) {
@@ -50,26 +50,36 @@ void TerminalWidget::set_pty_master_fd(int fd)
     m_notifier = Core::Notifier::construct(m_ptm_fd, Core::Notifier::Read);
     m_notifier->on_ready_to_read = [this] {
         u8 buffer[BUFSIZ];
-        ssize_t nread = read(m_ptm_fd, buffer, sizeof(buffer));
-        if (nread < 0) {
-            dbgln("Terminal read error: {}", strerror(errno));
-            perror("read(ptm)");
-            GUI::Application::the()->quit(1);
-            return;
-        }
-        if (nread == 0) {
-            dbgln("TerminalWidget: EOF on master pty, firing on_command_exit hook.");
-            if (on_command_exit)
-                on_command_exit();
-            int rc = close(m_ptm_fd);
-            if (rc < 0) {
-                perror("close");
+        // Drain the pty in bulk instead of one read per event loop iteration,
+        // but cap how much we process per wakeup so a flooding client can't
+        // starve the rest of the UI.
+        static constexpr size_t max_drain_per_wakeup = 128 * KiB;
+        size_t drained = 0;
+        do {
+            ssize_t nread = read(m_ptm_fd, buffer, sizeof(buffer));
+            if (nread < 0) {
+                dbgln("Terminal read error: {}", strerror(errno));
+                perror("read(ptm)");
+                GUI::Application::the()->quit(1);
+                return;
             }
-            set_pty_master_fd(-1);
-            return;
-        }
-        for (ssize_t i = 0; i < nread; ++i)
-            m_terminal.on_input(buffer[i]);
+            if (nread == 0) {
+                dbgln("TerminalWidget: EOF on master pty, firing on_command_exit hook.");
+                if (on_command_exit)
+                    on_command_exit();
+                int rc = close(m_ptm_fd);
+                if (rc < 0) {
+                    perror("close");
+                }
+                set_pty_master_fd(-1);
+                return;
+            }
+            m_terminal.on_input({ buffer, static_cast<size_t>(nread) });
+            drained += nread;
+            int pending = 0;
+            if (ioctl(m_ptm_fd, FIONREAD, &pending) < 0 || pending == 0)
+                break;
+        } while (drained < max_drain_per_wakeup);
         flush_dirty_lines();
     };
 }
@@ -315,7 +325,7 @@ void TerminalWidget::paint_event(GUI::PaintEvent& event)
     // Pass: Paint background & text decorations.
     for (u16 visual_row = 0; visual_row < m_terminal.rows(); ++visual_row) {
         auto row_rect = this->row_rect(visual_row);
-        if (!event.rect().contains(row_rect))
+        if (!event.rect().intersects(row_rect))
             continue;
         auto& line = m_terminal.line(first_row_from_history + visual_row);
         bool has_only_one_background_color = line.has_only_one_background_color();
@@ -394,7 +404,7 @@ void TerminalWidget::paint_event(GUI::PaintEvent& event)
     // Pass: Paint foreground (text).
     for (u16 visual_row = 0; visual_row < m_terminal.rows(); ++visual_row) {
         auto row_rect = this->row_rect(visual_row);
-        if (!event.rect().contains(row_rect))
+        if (!event.rect().intersects(row_rect))
             continue;
         auto& line = m_terminal.line(first_row_from_history + visual_row);
         for (size_t column = 0; column < line.length(); ++column) {
@@ -482,20 +492,23 @@ void TerminalWidget::invalidate_cursor()
 
 void TerminalWidget::flush_dirty_lines()
 {
-    // FIXME: Update smarter when scrolled
-    if (m_terminal.m_need_full_flush || m_scrollbar->value() != m_scrollbar->max()) {
+    if (m_terminal.m_need_full_flush) {
         update();
         m_terminal.m_need_full_flush = false;
         return;
     }
-    Gfx::IntRect rect;
+    // When scrolled back, the history lines shown above the screen buffer never
+    // change, and the visible screen lines are simply shifted down by the number
+    // of history lines on display.
+    int visual_row_offset = m_scrollbar->max() - m_scrollbar->value();
     for (int i = 0; i < m_terminal.rows(); ++i) {
-        if (m_terminal.visible_line(i).is_dirty()) {
-            rect = rect.united(row_rect(i));
-            m_terminal.visible_line(i).set_dirty(false);
-        }
+        if (!m_terminal.visible_line(i).is_dirty())
+            continue;
+        m_terminal.visible_line(i).set_dirty(false);
+        int visual_row = i + visual_row_offset;
+        if (visual_row < m_terminal.rows())
+            update(row_rect(visual_row));
     }
-    update(rect);
 }
 
 void TerminalWidget::resize_event(GUI::ResizeEvent& event)
@@ -1001,8 +1014,15 @@ void TerminalWidget::terminal_history_changed(int delta)
 {
     bool was_max = m_scrollbar->value() == m_scrollbar->max();
     m_scrollbar->set_max(m_terminal.history_size());
-    if (was_max)
-        m_scrollbar->set_value(m_scrollbar->max());
+    if (was_max) {
+        // The dirty lines already cover everything that changed on screen, so
+        // don't let the scrollbar's callback force a full repaint.
+        m_scrollbar->set_value(m_scrollbar->max(), GUI::AllowCallback::No);
+    } else if (delta < 0) {
+        // The history ring wrapped around, shifting the content under our
+        // scrolled-back view, so everything needs a repaint after all.
+        update();
+    }
     m_scrollbar->update();
     // If the history buffer wrapped around, the selection needs to be offset accordingly.
     if (m_selection.is_valid() && delta < 0)
@@ -150,6 +150,21 @@ ErrorOr<i8> BitStream::read_s(size_t n)
     return sign ? -value : value;
 }
 
+ErrorOr<ReadonlyBytes> BitStream::read_byte_aligned_bytes(size_t size)
+{
+    if ((m_reservoir_bits_remaining % 8) != 0 || (m_bits_read % 8) != 0)
+        return Error::from_string_literal("Stream is not byte-aligned");
+    if (size > bytes_remaining())
+        return Error::from_string_literal("Stream is out of data");
+    // The data pointer may have advanced past bytes that are still buffered
+    // in the reservoir, so step back to the true read position first.
+    auto const* start = m_data_ptr - (m_reservoir_bits_remaining / 8);
+    m_data_ptr = start + size;
+    m_reservoir_bits_remaining = 0;
+    m_bits_read += size * 8;
+    return ReadonlyBytes { start, size };
+}
+
 u64 BitStream::get_position()
 {
     return m_bits_read;
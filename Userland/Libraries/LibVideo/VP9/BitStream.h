@@ -9,6 +9,7 @@
 
 #include <AK/Error.h>
 #include <AK/Optional.h>
+#include <AK/Span.h>
 #include <AK/Types.h>
 
 namespace Video::VP9 {
@@ -38,6 +39,10 @@ public:
     /* (4.9.2) */
     ErrorOr<i8> read_s(size_t n);
 
+    /* Returns a view of the next `size` bytes and skips past them.
+     * May only be called while the stream is byte-aligned. */
+    ErrorOr<ReadonlyBytes> read_byte_aligned_bytes(size_t size);
+
     u64 get_position();
     size_t bytes_remaining();
     size_t bits_remaining();
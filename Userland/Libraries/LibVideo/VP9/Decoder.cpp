@@ -6,6 +6,7 @@
  */
 
 #include <AK/IntegralMath.h>
+#include <AK/SIMD.h>
 #include <LibGfx/Size.h>
 #include <LibVideo/Color/CodingIndependentCodePoints.h>
 
@@ -901,31 +902,82 @@ DecoderErrorOr<void> Decoder::predict_inter_block(u8 plane, BlockContext const&
         return intermediate_buffer[row * width + column];
     };
 
-    for (auto row = 0u; row < intermediate_height; row++) {
-        for (auto column = 0u; column < width; column++) {
-            auto samples_start = offset_scaled_block_x + static_cast<i32>(scaled_step_x * column);
-
-            i32 accumulated_samples = 0;
-            for (auto t = 0u; t < 8u; t++) {
-                auto sample = reference_frame_buffer_at(
-                    clip_3(0, scaled_bottom, (offset_scaled_block_y >> 4) + static_cast<i32>(row) - 3),
-                    clip_3(0, scaled_right, (samples_start >> 4) + static_cast<i32>(t) - 3));
-                accumulated_samples += subpel_filters[block_context.interpolation_filter][samples_start & 15][t] * sample;
+    auto bit_depth = block_context.frame_context.color_config.bit_depth;
+    auto const& filter = subpel_filters[block_context.interpolation_filter];
+
+    // When the reference frame is unscaled, the horizontal filter advances one full sample per
+    // output column and uses a single filter phase, so as long as all the taps land inside the
+    // reference plane the per-sample clipping can be dropped and the filter can be applied to
+    // four columns at a time.
+    auto reference_start_x = offset_scaled_block_x >> 4;
+    bool can_vectorize_horizontally = scaled_step_x == 16
+        && reference_start_x - 3 >= 0
+        && reference_start_x + static_cast<i32>(width) + 3 <= scaled_right;
+
+    if (can_vectorize_horizontally) {
+        auto const* coefficients = filter[offset_scaled_block_x & 15];
+        for (auto row = 0u; row < intermediate_height; row++) {
+            auto reference_row = clip_3(0, scaled_bottom, (offset_scaled_block_y >> 4) + static_cast<i32>(row) - 3);
+            auto const* samples = &reference_frame_buffer_at(reference_row, reference_start_x - 3);
+            u32 column = 0;
+            for (; column + 4 <= width; column += 4) {
+                AK::SIMD::i32x4 accumulated_samples {};
+                for (auto t = 0u; t < 8u; t++) {
+                    auto const* sample = samples + column + t;
+                    accumulated_samples += coefficients[t] * AK::SIMD::i32x4 { sample[0], sample[1], sample[2], sample[3] };
+                }
+                accumulated_samples = (accumulated_samples + 64) >> 7;
+                for (auto lane = 0u; lane < 4u; lane++)
+                    intermediate_buffer_at(row, column + lane) = clip_1(bit_depth, accumulated_samples[lane]);
+            }
+            for (; column < width; column++) {
+                i32 accumulated_samples = 0;
+                for (auto t = 0u; t < 8u; t++)
+                    accumulated_samples += coefficients[t] * samples[column + t];
+                intermediate_buffer_at(row, column) = clip_1(bit_depth, round_2(accumulated_samples, 7));
+            }
+        }
+    } else {
+        for (auto row = 0u; row < intermediate_height; row++) {
+            for (auto column = 0u; column < width; column++) {
+                auto samples_start = offset_scaled_block_x + static_cast<i32>(scaled_step_x * column);
+
+                i32 accumulated_samples = 0;
+                for (auto t = 0u; t < 8u; t++) {
+                    auto sample = reference_frame_buffer_at(
+                        clip_3(0, scaled_bottom, (offset_scaled_block_y >> 4) + static_cast<i32>(row) - 3),
+                        clip_3(0, scaled_right, (samples_start >> 4) + static_cast<i32>(t) - 3));
+                    accumulated_samples += filter[samples_start & 15][t] * sample;
+                }
+                intermediate_buffer_at(row, column) = clip_1(bit_depth, round_2(accumulated_samples, 7));
             }
-            intermediate_buffer_at(row, column) = clip_1(block_context.frame_context.color_config.bit_depth, round_2(accumulated_samples, 7));
         }
     }
 
+    // The vertical filter always reads from the intermediate array, which is sized to contain
+    // every tap, so it can be applied four columns at a time unconditionally. Each tap's samples
+    // for adjacent columns are adjacent in the intermediate row.
     for (auto row = 0u; row < height; row++) {
-        for (auto column = 0u; column < width; column++) {
-            auto samples_start = (offset_scaled_block_y & 15) + static_cast<i32>(scaled_step_y * row);
+        auto samples_start = (offset_scaled_block_y & 15) + static_cast<i32>(scaled_step_y * row);
+        auto const* coefficients = filter[samples_start & 15];
+        auto first_tap_row = samples_start >> 4;
 
-            i32 accumulated_samples = 0;
+        u32 column = 0;
+        for (; column + 4 <= width; column += 4) {
+            AK::SIMD::i32x4 accumulated_samples {};
             for (auto t = 0u; t < 8u; t++) {
-                auto sample = intermediate_buffer_at((samples_start >> 4) + t, column);
-                accumulated_samples += subpel_filters[block_context.interpolation_filter][samples_start & 15][t] * sample;
+                auto const* sample = &intermediate_buffer_at(first_tap_row + t, column);
+                accumulated_samples += coefficients[t] * AK::SIMD::i32x4 { sample[0], sample[1], sample[2], sample[3] };
             }
-            block_buffer_at(row, column) = clip_1(block_context.frame_context.color_config.bit_depth, round_2(accumulated_samples, 7));
+            accumulated_samples = (accumulated_samples + 64) >> 7;
+            for (auto lane = 0u; lane < 4u; lane++)
+                block_buffer_at(row, column + lane) = clip_1(bit_depth, accumulated_samples[lane]);
+        }
+        for (; column < width; column++) {
+            i32 accumulated_samples = 0;
+            for (auto t = 0u; t < 8u; t++)
+                accumulated_samples += coefficients[t] * intermediate_buffer_at(first_tap_row + t, column);
+            block_buffer_at(row, column) = clip_1(bit_depth, round_2(accumulated_samples, 7));
         }
     }
 
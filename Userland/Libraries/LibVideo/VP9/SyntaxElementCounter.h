@@ -16,6 +16,10 @@ public:
     /* (8.3) Clear Counts Process */
     void clear_counts();
 
+    // Accumulates the counts from another counter, so that tiles can count
+    // syntax elements independently and be merged once they are all decoded.
+    void add_counts_from(SyntaxElementCounter const&);
+
     u8 m_counts_intra_mode[BLOCK_SIZE_GROUPS][INTRA_MODES];
     u8 m_counts_uv_mode[INTRA_MODES][INTRA_MODES];
     u8 m_counts_partition[PARTITION_CONTEXTS][PARTITION_TYPES];
@@ -140,11 +140,22 @@ ErrorOr<void, ValidationError> AbstractMachine::validate(Module& module)
 
 InstantiationResult AbstractMachine::instantiate(Module const& module, Vector<ExternValue> externs)
 {
-    if (auto result = validate(const_cast<Module&>(module)); result.is_error())
+    OwnPtr<Validator> deferred_body_validator;
+    if (m_should_defer_function_body_validation && module.validation_status() == Module::ValidationStatus::Unchecked) {
+        // Check the module structure now, but let each function body be
+        // validated on its first call; the validator keeps the module-level
+        // context the deferred checks will run against.
+        deferred_body_validator = make<Validator>();
+        if (auto result = deferred_body_validator->validate(const_cast<Module&>(module), Validator::FunctionBodyValidationMode::Deferred); result.is_error())
+            return InstantiationError { DeprecatedString::formatted("Validation failed: {}", result.error()) };
+    } else if (auto result = validate(const_cast<Module&>(module)); result.is_error()) {
         return InstantiationError { DeprecatedString::formatted("Validation failed: {}", result.error()) };
+    }
 
     auto main_module_instance_pointer = make<ModuleInstance>();
     auto& main_module_instance = *main_module_instance_pointer;
+    if (deferred_body_validator)
+        main_module_instance.set_deferred_function_body_validator(deferred_body_validator.release_nonnull());
     Optional<InstantiationResult> instantiation_result;
 
     module.for_each_section_of_type<TypeSection>([&](TypeSection const& section) {
@@ -323,6 +334,7 @@ InstantiationResult AbstractMachine::instantiate(Module const& module, Vector<Ex
                     size_t offset = 0;
                     result.values().first().value().visit(
                         [&](auto const& value) { offset = value; },
+                        [&](u128 const&) { instantiation_result = InstantiationError { "Data segment offset returned a vector type"sv }; },
                         [&](Reference const&) { instantiation_result = InstantiationError { "Data segment offset returned a reference"sv }; });
                     if (instantiation_result.has_value() && instantiation_result->is_error())
                         return;
@@ -11,6 +11,7 @@
 #include <AK/HashTable.h>
 #include <AK/OwnPtr.h>
 #include <AK/Result.h>
+#include <LibWasm/AbstractMachine/Validator.h>
 #include <LibWasm/Types.h>
 
 namespace Wasm {
@@ -70,7 +71,7 @@ public:
     {
     }
 
-    using AnyValueType = Variant<i32, i64, float, double, Reference>;
+    using AnyValueType = Variant<i32, i64, float, double, u128, Reference>;
     explicit Value(AnyValueType value)
         : m_value(move(value))
     {
@@ -99,6 +100,10 @@ public:
         case ValueType::Kind::F64:
             m_value = bit_cast<double>(raw_value);
             break;
+        case ValueType::Kind::V128:
+            VERIFY(raw_value == 0);
+            m_value = u128(0ull, 0ull);
+            break;
         case ValueType::Kind::NullFunctionReference:
             VERIFY(raw_value == 0);
             m_value = Reference { Reference::Null { ValueType(ValueType::Kind::FunctionReference) } };
@@ -152,6 +157,7 @@ public:
             [](i64) { return ValueType::Kind::I64; },
             [](float) { return ValueType::Kind::F32; },
             [](double) { return ValueType::Kind::F64; },
+            [](u128) { return ValueType::Kind::V128; },
             [&](Reference const& type) {
                 return type.ref().visit(
                     [](Reference::Func const&) { return ValueType::Kind::FunctionReference; },
@@ -247,7 +253,13 @@ public:
     auto& datas() { return m_datas; }
     auto& exports() { return m_exports; }
 
+    // Set when the module was instantiated with deferred function body
+    // validation; bodies are then checked against this on their first call.
+    Validator const* deferred_function_body_validator() const { return m_deferred_function_body_validator.ptr(); }
+    void set_deferred_function_body_validator(NonnullOwnPtr<Validator> validator) { m_deferred_function_body_validator = move(validator); }
+
 private:
+    OwnPtr<Validator> m_deferred_function_body_validator;
     Vector<FunctionType> m_types;
     Vector<FunctionAddress> m_functions;
     Vector<TableAddress> m_tables;
@@ -536,11 +548,16 @@ public:
 
     void enable_instruction_count_limit() { m_should_limit_instruction_count = true; }
 
+    // Make instantiate() check only module-level structure up front and defer
+    // each function body's validation to that function's first call.
+    void enable_deferred_function_body_validation() { m_should_defer_function_body_validation = true; }
+
 private:
     Optional<InstantiationError> allocate_all_initial_phase(Module const&, ModuleInstance&, Vector<ExternValue>&, Vector<Value>& global_values);
     Optional<InstantiationError> allocate_all_final_phase(Module const&, ModuleInstance&, Vector<Vector<Reference>>& elements);
     Store m_store;
     bool m_should_limit_instruction_count { false };
+    bool m_should_defer_function_body_validation { false };
 };
 
 class Linker {
@@ -14,6 +14,8 @@
 
 namespace Wasm {
 
+using namespace AK::SIMD;
+
 #define TRAP_IF_NOT(x)                                                                         \
     do {                                                                                       \
         if (trap_if_not(x, #x##sv)) {                                                          \
@@ -30,6 +32,12 @@ namespace Wasm {
     } while (false)
 
 void BytecodeInterpreter::interpret(Configuration& configuration)
+{
+    interpret_loop<BytecodeInterpreter>(configuration);
+}
+
+template<typename InterpreterT>
+void BytecodeInterpreter::interpret_loop(Configuration& configuration)
 {
     m_trap.clear();
     auto& instructions = configuration.frame().expression().instructions();
@@ -47,7 +55,7 @@ void BytecodeInterpreter::interpret(Configuration& configuration)
         }
         auto& instruction = instructions[current_ip_value.value()];
         auto old_ip = current_ip_value;
-        interpret(configuration, current_ip_value, instruction);
+        static_cast<InterpreterT&>(*this).InterpreterT::interpret(configuration, current_ip_value, instruction);
         if (m_trap.has_value())
             return;
         if (current_ip_value == old_ip) // If no jump occurred
@@ -187,6 +195,41 @@ void BytecodeInterpreter::unary_operation(Configuration& configuration)
     entry = Value(result);
 }
 
+template<typename Operator>
+void BytecodeInterpreter::vector_shift_operation(Configuration& configuration)
+{
+    auto shift_entry = configuration.stack().pop();
+    auto& entry = configuration.stack().peek();
+    auto shift = shift_entry.get<Value>().to<i32>();
+    auto value = entry.get<Value>().to<u128>();
+    auto result = Operator {}(value.value(), shift.value());
+    dbgln_if(WASM_TRACE_DEBUG, "{} {} {} = {}", value.value(), Operator::name(), shift.value(), result);
+    entry = Value(result);
+}
+
+template<typename VectorType, typename PushType>
+void BytecodeInterpreter::vector_extract_lane(Configuration& configuration, Instruction const& instruction)
+{
+    auto lane = instruction.arguments().get<Instruction::LaneIndex>().lane;
+    auto& entry = configuration.stack().peek();
+    auto vector = bit_cast<VectorType>(*entry.get<Value>().to<u128>());
+    dbgln_if(WASM_TRACE_DEBUG, "vec[{}] -> stack", lane);
+    entry = Value(static_cast<PushType>(vector[lane]));
+}
+
+template<typename VectorType, typename PopType>
+void BytecodeInterpreter::vector_replace_lane(Configuration& configuration, Instruction const& instruction)
+{
+    auto lane = instruction.arguments().get<Instruction::LaneIndex>().lane;
+    auto scalar_entry = configuration.stack().pop();
+    auto& entry = configuration.stack().peek();
+    auto vector = bit_cast<VectorType>(*entry.get<Value>().to<u128>());
+    using Element = RemoveCVReference<decltype(vector[0])>;
+    vector[lane] = static_cast<Element>(*scalar_entry.get<Value>().to<PopType>());
+    dbgln_if(WASM_TRACE_DEBUG, "stack -> vec[{}]", lane);
+    entry = Value(bit_cast<u128>(vector));
+}
+
 template<typename T>
 struct ConvertToRaw {
     T operator()(T value)
@@ -221,6 +264,16 @@ struct ConvertToRaw<double> {
     }
 };
 
+template<>
+struct ConvertToRaw<u128> {
+    u128 operator()(u128 value)
+    {
+        // The memory representation is little-endian, same as every host we
+        // support.
+        return value;
+    }
+};
+
 template<typename PopT, typename StoreT>
 void BytecodeInterpreter::pop_and_store(Configuration& configuration, Instruction const& instruction)
 {
@@ -284,6 +337,16 @@ double BytecodeInterpreter::read_value<double>(ReadonlyBytes data)
     return bit_cast<double>(static_cast<u64>(raw_value));
 }
 
+template<>
+u128 BytecodeInterpreter::read_value<u128>(ReadonlyBytes data)
+{
+    // The bytes are little-endian, same as every host we support.
+    u128 value;
+    VERIFY(data.size() == sizeof(value));
+    data.copy_to(value.bytes());
+    return value;
+}
+
 template<typename V, typename T>
 MakeSigned<T> BytecodeInterpreter::checked_signed_truncate(V value)
 {
@@ -949,6 +1012,331 @@ void BytecodeInterpreter::interpret(Configuration& configuration, InstructionPoi
         }
         return;
     }
+    case Instructions::v128_load.value():
+        return load_and_push<u128, u128>(configuration, instruction);
+    case Instructions::v128_store.value():
+        return pop_and_store<u128, u128>(configuration, instruction);
+    case Instructions::v128_const.value():
+        configuration.stack().push(Value(instruction.arguments().get<u128>()));
+        return;
+    case Instructions::i8x16_shuffle.value(): {
+        auto& lanes = instruction.arguments().get<Instruction::ShuffleArgument>().lanes;
+        auto rhs_entry = configuration.stack().pop();
+        auto& lhs_entry = configuration.stack().peek();
+        auto rhs = bit_cast<u8x16>(*rhs_entry.get<Value>().to<u128>());
+        auto lhs = bit_cast<u8x16>(*lhs_entry.get<Value>().to<u128>());
+        u8x16 result;
+        for (size_t lane = 0; lane < 16; ++lane)
+            result[lane] = lanes[lane] < 16 ? lhs[lanes[lane]] : rhs[lanes[lane] - 16];
+        lhs_entry = Value(bit_cast<u128>(result));
+        return;
+    }
+    case Instructions::i8x16_swizzle.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorSwizzle>(configuration);
+    case Instructions::i8x16_splat.value():
+        return unary_operation<i32, u128, Operators::VectorSplat<u8x16>>(configuration);
+    case Instructions::i16x8_splat.value():
+        return unary_operation<i32, u128, Operators::VectorSplat<u16x8>>(configuration);
+    case Instructions::i32x4_splat.value():
+        return unary_operation<i32, u128, Operators::VectorSplat<u32x4>>(configuration);
+    case Instructions::i64x2_splat.value():
+        return unary_operation<i64, u128, Operators::VectorSplat<u64x2>>(configuration);
+    case Instructions::f32x4_splat.value():
+        return unary_operation<float, u128, Operators::VectorSplat<f32x4>>(configuration);
+    case Instructions::f64x2_splat.value():
+        return unary_operation<double, u128, Operators::VectorSplat<f64x2>>(configuration);
+    case Instructions::i8x16_extract_lane_s.value():
+        return vector_extract_lane<i8x16, i32>(configuration, instruction);
+    case Instructions::i8x16_extract_lane_u.value():
+        return vector_extract_lane<u8x16, i32>(configuration, instruction);
+    case Instructions::i16x8_extract_lane_s.value():
+        return vector_extract_lane<i16x8, i32>(configuration, instruction);
+    case Instructions::i16x8_extract_lane_u.value():
+        return vector_extract_lane<u16x8, i32>(configuration, instruction);
+    case Instructions::i32x4_extract_lane.value():
+        return vector_extract_lane<i32x4, i32>(configuration, instruction);
+    case Instructions::i64x2_extract_lane.value():
+        return vector_extract_lane<i64x2, i64>(configuration, instruction);
+    case Instructions::f32x4_extract_lane.value():
+        return vector_extract_lane<f32x4, float>(configuration, instruction);
+    case Instructions::f64x2_extract_lane.value():
+        return vector_extract_lane<f64x2, double>(configuration, instruction);
+    case Instructions::i8x16_replace_lane.value():
+        return vector_replace_lane<u8x16, i32>(configuration, instruction);
+    case Instructions::i16x8_replace_lane.value():
+        return vector_replace_lane<u16x8, i32>(configuration, instruction);
+    case Instructions::i32x4_replace_lane.value():
+        return vector_replace_lane<u32x4, i32>(configuration, instruction);
+    case Instructions::i64x2_replace_lane.value():
+        return vector_replace_lane<u64x2, i64>(configuration, instruction);
+    case Instructions::f32x4_replace_lane.value():
+        return vector_replace_lane<f32x4, float>(configuration, instruction);
+    case Instructions::f64x2_replace_lane.value():
+        return vector_replace_lane<f64x2, double>(configuration, instruction);
+    case Instructions::i8x16_eq.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<i8x16, Operators::Equals>>(configuration);
+    case Instructions::i8x16_ne.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<i8x16, Operators::NotEquals>>(configuration);
+    case Instructions::i8x16_lt_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<i8x16, Operators::LessThan>>(configuration);
+    case Instructions::i8x16_lt_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<u8x16, Operators::LessThan>>(configuration);
+    case Instructions::i8x16_gt_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<i8x16, Operators::GreaterThan>>(configuration);
+    case Instructions::i8x16_gt_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<u8x16, Operators::GreaterThan>>(configuration);
+    case Instructions::i8x16_le_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<i8x16, Operators::LessThanOrEquals>>(configuration);
+    case Instructions::i8x16_le_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<u8x16, Operators::LessThanOrEquals>>(configuration);
+    case Instructions::i8x16_ge_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<i8x16, Operators::GreaterThanOrEquals>>(configuration);
+    case Instructions::i8x16_ge_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<u8x16, Operators::GreaterThanOrEquals>>(configuration);
+    case Instructions::i16x8_eq.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<i16x8, Operators::Equals>>(configuration);
+    case Instructions::i16x8_ne.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<i16x8, Operators::NotEquals>>(configuration);
+    case Instructions::i16x8_lt_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<i16x8, Operators::LessThan>>(configuration);
+    case Instructions::i16x8_lt_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<u16x8, Operators::LessThan>>(configuration);
+    case Instructions::i16x8_gt_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<i16x8, Operators::GreaterThan>>(configuration);
+    case Instructions::i16x8_gt_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<u16x8, Operators::GreaterThan>>(configuration);
+    case Instructions::i16x8_le_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<i16x8, Operators::LessThanOrEquals>>(configuration);
+    case Instructions::i16x8_le_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<u16x8, Operators::LessThanOrEquals>>(configuration);
+    case Instructions::i16x8_ge_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<i16x8, Operators::GreaterThanOrEquals>>(configuration);
+    case Instructions::i16x8_ge_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<u16x8, Operators::GreaterThanOrEquals>>(configuration);
+    case Instructions::i32x4_eq.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<i32x4, Operators::Equals>>(configuration);
+    case Instructions::i32x4_ne.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<i32x4, Operators::NotEquals>>(configuration);
+    case Instructions::i32x4_lt_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<i32x4, Operators::LessThan>>(configuration);
+    case Instructions::i32x4_lt_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<u32x4, Operators::LessThan>>(configuration);
+    case Instructions::i32x4_gt_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<i32x4, Operators::GreaterThan>>(configuration);
+    case Instructions::i32x4_gt_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<u32x4, Operators::GreaterThan>>(configuration);
+    case Instructions::i32x4_le_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<i32x4, Operators::LessThanOrEquals>>(configuration);
+    case Instructions::i32x4_le_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<u32x4, Operators::LessThanOrEquals>>(configuration);
+    case Instructions::i32x4_ge_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<i32x4, Operators::GreaterThanOrEquals>>(configuration);
+    case Instructions::i32x4_ge_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<u32x4, Operators::GreaterThanOrEquals>>(configuration);
+    case Instructions::f32x4_eq.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<f32x4, Operators::Equals>>(configuration);
+    case Instructions::f32x4_ne.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<f32x4, Operators::NotEquals>>(configuration);
+    case Instructions::f32x4_lt.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<f32x4, Operators::LessThan>>(configuration);
+    case Instructions::f32x4_gt.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<f32x4, Operators::GreaterThan>>(configuration);
+    case Instructions::f32x4_le.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<f32x4, Operators::LessThanOrEquals>>(configuration);
+    case Instructions::f32x4_ge.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<f32x4, Operators::GreaterThanOrEquals>>(configuration);
+    case Instructions::f64x2_eq.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<f64x2, Operators::Equals>>(configuration);
+    case Instructions::f64x2_ne.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<f64x2, Operators::NotEquals>>(configuration);
+    case Instructions::f64x2_lt.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<f64x2, Operators::LessThan>>(configuration);
+    case Instructions::f64x2_gt.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<f64x2, Operators::GreaterThan>>(configuration);
+    case Instructions::f64x2_le.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<f64x2, Operators::LessThanOrEquals>>(configuration);
+    case Instructions::f64x2_ge.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<f64x2, Operators::GreaterThanOrEquals>>(configuration);
+    case Instructions::i64x2_eq.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<i64x2, Operators::Equals>>(configuration);
+    case Instructions::i64x2_ne.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<i64x2, Operators::NotEquals>>(configuration);
+    case Instructions::i64x2_lt_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<i64x2, Operators::LessThan>>(configuration);
+    case Instructions::i64x2_gt_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<i64x2, Operators::GreaterThan>>(configuration);
+    case Instructions::i64x2_le_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<i64x2, Operators::LessThanOrEquals>>(configuration);
+    case Instructions::i64x2_ge_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<i64x2, Operators::GreaterThanOrEquals>>(configuration);
+    case Instructions::v128_not.value():
+        return unary_operation<u128, u128, Operators::VectorUnaryOperation<u64x2, Operators::BitNot>>(configuration);
+    case Instructions::v128_and.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<u64x2, Operators::BitAnd>>(configuration);
+    case Instructions::v128_andnot.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<u64x2, Operators::BitAndNot>>(configuration);
+    case Instructions::v128_or.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<u64x2, Operators::BitOr>>(configuration);
+    case Instructions::v128_xor.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<u64x2, Operators::BitXor>>(configuration);
+    case Instructions::v128_bitselect.value(): {
+        auto mask_entry = configuration.stack().pop();
+        auto rhs_entry = configuration.stack().pop();
+        auto& lhs_entry = configuration.stack().peek();
+        auto mask = bit_cast<u64x2>(*mask_entry.get<Value>().to<u128>());
+        auto rhs = bit_cast<u64x2>(*rhs_entry.get<Value>().to<u128>());
+        auto lhs = bit_cast<u64x2>(*lhs_entry.get<Value>().to<u128>());
+        lhs_entry = Value(bit_cast<u128>((lhs & mask) | (rhs & ~mask)));
+        return;
+    }
+    case Instructions::v128_any_true.value():
+        return unary_operation<u128, i32, Operators::VectorAnyTrue>(configuration);
+    case Instructions::i8x16_abs.value():
+        return unary_operation<u128, u128, Operators::VectorLaneWiseUnaryOperation<i8x16, Operators::WrappingAbsolute>>(configuration);
+    case Instructions::i8x16_neg.value():
+        return unary_operation<u128, u128, Operators::VectorUnaryOperation<u8x16, Operators::Negate>>(configuration);
+    case Instructions::i8x16_all_true.value():
+        return unary_operation<u128, i32, Operators::VectorAllTrue<i8x16>>(configuration);
+    case Instructions::i8x16_bitmask.value():
+        return unary_operation<u128, i32, Operators::VectorBitmask<i8x16>>(configuration);
+    case Instructions::i8x16_shl.value():
+        return vector_shift_operation<Operators::VectorShiftLeft<u8x16>>(configuration);
+    case Instructions::i8x16_shr_s.value():
+        return vector_shift_operation<Operators::VectorShiftRight<i8x16>>(configuration);
+    case Instructions::i8x16_shr_u.value():
+        return vector_shift_operation<Operators::VectorShiftRight<u8x16>>(configuration);
+    case Instructions::i8x16_add.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<u8x16, Operators::Add>>(configuration);
+    case Instructions::i8x16_sub.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<u8x16, Operators::Subtract>>(configuration);
+    case Instructions::i8x16_min_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWiseBinaryOperation<i8x16, Operators::Minimum>>(configuration);
+    case Instructions::i8x16_min_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWiseBinaryOperation<u8x16, Operators::Minimum>>(configuration);
+    case Instructions::i8x16_max_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWiseBinaryOperation<i8x16, Operators::Maximum>>(configuration);
+    case Instructions::i8x16_max_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWiseBinaryOperation<u8x16, Operators::Maximum>>(configuration);
+    case Instructions::i16x8_abs.value():
+        return unary_operation<u128, u128, Operators::VectorLaneWiseUnaryOperation<i16x8, Operators::WrappingAbsolute>>(configuration);
+    case Instructions::i16x8_neg.value():
+        return unary_operation<u128, u128, Operators::VectorUnaryOperation<u16x8, Operators::Negate>>(configuration);
+    case Instructions::i16x8_all_true.value():
+        return unary_operation<u128, i32, Operators::VectorAllTrue<i16x8>>(configuration);
+    case Instructions::i16x8_bitmask.value():
+        return unary_operation<u128, i32, Operators::VectorBitmask<i16x8>>(configuration);
+    case Instructions::i16x8_shl.value():
+        return vector_shift_operation<Operators::VectorShiftLeft<u16x8>>(configuration);
+    case Instructions::i16x8_shr_s.value():
+        return vector_shift_operation<Operators::VectorShiftRight<i16x8>>(configuration);
+    case Instructions::i16x8_shr_u.value():
+        return vector_shift_operation<Operators::VectorShiftRight<u16x8>>(configuration);
+    case Instructions::i16x8_add.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<u16x8, Operators::Add>>(configuration);
+    case Instructions::i16x8_sub.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<u16x8, Operators::Subtract>>(configuration);
+    case Instructions::i16x8_mul.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<u16x8, Operators::Multiply>>(configuration);
+    case Instructions::i16x8_min_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWiseBinaryOperation<i16x8, Operators::Minimum>>(configuration);
+    case Instructions::i16x8_min_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWiseBinaryOperation<u16x8, Operators::Minimum>>(configuration);
+    case Instructions::i16x8_max_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWiseBinaryOperation<i16x8, Operators::Maximum>>(configuration);
+    case Instructions::i16x8_max_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWiseBinaryOperation<u16x8, Operators::Maximum>>(configuration);
+    case Instructions::i32x4_abs.value():
+        return unary_operation<u128, u128, Operators::VectorLaneWiseUnaryOperation<i32x4, Operators::WrappingAbsolute>>(configuration);
+    case Instructions::i32x4_neg.value():
+        return unary_operation<u128, u128, Operators::VectorUnaryOperation<u32x4, Operators::Negate>>(configuration);
+    case Instructions::i32x4_all_true.value():
+        return unary_operation<u128, i32, Operators::VectorAllTrue<i32x4>>(configuration);
+    case Instructions::i32x4_bitmask.value():
+        return unary_operation<u128, i32, Operators::VectorBitmask<i32x4>>(configuration);
+    case Instructions::i32x4_shl.value():
+        return vector_shift_operation<Operators::VectorShiftLeft<u32x4>>(configuration);
+    case Instructions::i32x4_shr_s.value():
+        return vector_shift_operation<Operators::VectorShiftRight<i32x4>>(configuration);
+    case Instructions::i32x4_shr_u.value():
+        return vector_shift_operation<Operators::VectorShiftRight<u32x4>>(configuration);
+    case Instructions::i32x4_add.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<u32x4, Operators::Add>>(configuration);
+    case Instructions::i32x4_sub.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<u32x4, Operators::Subtract>>(configuration);
+    case Instructions::i32x4_mul.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<u32x4, Operators::Multiply>>(configuration);
+    case Instructions::i32x4_min_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWiseBinaryOperation<i32x4, Operators::Minimum>>(configuration);
+    case Instructions::i32x4_min_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWiseBinaryOperation<u32x4, Operators::Minimum>>(configuration);
+    case Instructions::i32x4_max_s.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWiseBinaryOperation<i32x4, Operators::Maximum>>(configuration);
+    case Instructions::i32x4_max_u.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWiseBinaryOperation<u32x4, Operators::Maximum>>(configuration);
+    case Instructions::i64x2_abs.value():
+        return unary_operation<u128, u128, Operators::VectorLaneWiseUnaryOperation<i64x2, Operators::WrappingAbsolute>>(configuration);
+    case Instructions::i64x2_neg.value():
+        return unary_operation<u128, u128, Operators::VectorUnaryOperation<u64x2, Operators::Negate>>(configuration);
+    case Instructions::i64x2_all_true.value():
+        return unary_operation<u128, i32, Operators::VectorAllTrue<i64x2>>(configuration);
+    case Instructions::i64x2_bitmask.value():
+        return unary_operation<u128, i32, Operators::VectorBitmask<i64x2>>(configuration);
+    case Instructions::i64x2_shl.value():
+        return vector_shift_operation<Operators::VectorShiftLeft<u64x2>>(configuration);
+    case Instructions::i64x2_shr_s.value():
+        return vector_shift_operation<Operators::VectorShiftRight<i64x2>>(configuration);
+    case Instructions::i64x2_shr_u.value():
+        return vector_shift_operation<Operators::VectorShiftRight<u64x2>>(configuration);
+    case Instructions::i64x2_add.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<u64x2, Operators::Add>>(configuration);
+    case Instructions::i64x2_sub.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<u64x2, Operators::Subtract>>(configuration);
+    case Instructions::i64x2_mul.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<u64x2, Operators::Multiply>>(configuration);
+    case Instructions::f32x4_abs.value():
+        return unary_operation<u128, u128, Operators::VectorLaneWiseUnaryOperation<f32x4, Operators::Absolute>>(configuration);
+    case Instructions::f32x4_neg.value():
+        return unary_operation<u128, u128, Operators::VectorUnaryOperation<f32x4, Operators::Negate>>(configuration);
+    case Instructions::f32x4_sqrt.value():
+        return unary_operation<u128, u128, Operators::VectorLaneWiseUnaryOperation<f32x4, Operators::SquareRoot>>(configuration);
+    case Instructions::f32x4_add.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<f32x4, Operators::Add>>(configuration);
+    case Instructions::f32x4_sub.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<f32x4, Operators::Subtract>>(configuration);
+    case Instructions::f32x4_mul.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<f32x4, Operators::Multiply>>(configuration);
+    case Instructions::f32x4_div.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWiseBinaryOperation<f32x4, Operators::Divide>>(configuration);
+    case Instructions::f32x4_min.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWiseBinaryOperation<f32x4, Operators::Minimum>>(configuration);
+    case Instructions::f32x4_max.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWiseBinaryOperation<f32x4, Operators::Maximum>>(configuration);
+    case Instructions::f32x4_pmin.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWiseBinaryOperation<f32x4, Operators::PseudoMinimum>>(configuration);
+    case Instructions::f32x4_pmax.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWiseBinaryOperation<f32x4, Operators::PseudoMaximum>>(configuration);
+    case Instructions::f64x2_abs.value():
+        return unary_operation<u128, u128, Operators::VectorLaneWiseUnaryOperation<f64x2, Operators::Absolute>>(configuration);
+    case Instructions::f64x2_neg.value():
+        return unary_operation<u128, u128, Operators::VectorUnaryOperation<f64x2, Operators::Negate>>(configuration);
+    case Instructions::f64x2_sqrt.value():
+        return unary_operation<u128, u128, Operators::VectorLaneWiseUnaryOperation<f64x2, Operators::SquareRoot>>(configuration);
+    case Instructions::f64x2_add.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<f64x2, Operators::Add>>(configuration);
+    case Instructions::f64x2_sub.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<f64x2, Operators::Subtract>>(configuration);
+    case Instructions::f64x2_mul.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorBinaryOperation<f64x2, Operators::Multiply>>(configuration);
+    case Instructions::f64x2_div.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWiseBinaryOperation<f64x2, Operators::Divide>>(configuration);
+    case Instructions::f64x2_min.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWiseBinaryOperation<f64x2, Operators::Minimum>>(configuration);
+    case Instructions::f64x2_max.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWiseBinaryOperation<f64x2, Operators::Maximum>>(configuration);
+    case Instructions::f64x2_pmin.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWiseBinaryOperation<f64x2, Operators::PseudoMinimum>>(configuration);
+    case Instructions::f64x2_pmax.value():
+        return binary_numeric_operation<u128, u128, Operators::VectorLaneWiseBinaryOperation<f64x2, Operators::PseudoMaximum>>(configuration);
     case Instructions::data_drop.value():
     case Instructions::memory_copy.value():
     case Instructions::memory_fill.value():
@@ -966,6 +1354,11 @@ void BytecodeInterpreter::interpret(Configuration& configuration, InstructionPoi
     }
 }
 
+void DebuggerBytecodeInterpreter::interpret(Configuration& configuration)
+{
+    interpret_loop<DebuggerBytecodeInterpreter>(configuration);
+}
+
 void DebuggerBytecodeInterpreter::interpret(Configuration& configuration, InstructionPointer& ip, Instruction const& instruction)
 {
     if (pre_interpret_hook) {
@@ -14,6 +14,7 @@ namespace Wasm {
 
 struct BytecodeInterpreter : public Interpreter {
     virtual void interpret(Configuration&) override;
+    virtual void interpret(Configuration&, InstructionPointer&, Instruction const&);
     virtual ~BytecodeInterpreter() override = default;
     virtual bool did_trap() const override { return m_trap.has_value(); }
     virtual DeprecatedString trap_reason() const override { return m_trap.value().reason; }
@@ -33,7 +34,13 @@ struct BytecodeInterpreter : public Interpreter {
     };
 
 protected:
-    virtual void interpret(Configuration&, InstructionPointer&, Instruction const&);
+    // Dispatch loop shared by the plain and debugger interpreters. Calling
+    // the instruction handler through InterpreterT instead of the vtable
+    // makes it a direct call the compiler can inline into the loop, so the
+    // per-instruction cost is a single indirect branch on the opcode.
+    template<typename InterpreterT>
+    void interpret_loop(Configuration&);
+
     void branch_to_label(Configuration&, LabelIndex);
     template<typename ReadT, typename PushT>
     void load_and_push(Configuration&, Instruction const&);
@@ -48,6 +55,15 @@ protected:
     template<typename PopType, typename PushType, typename Operator>
     void unary_operation(Configuration&);
 
+    template<typename Operator>
+    void vector_shift_operation(Configuration&);
+
+    template<typename VectorType, typename PushType>
+    void vector_extract_lane(Configuration&, Instruction const&);
+
+    template<typename VectorType, typename PopType>
+    void vector_replace_lane(Configuration&, Instruction const&);
+
     template<typename V, typename T>
     MakeUnsigned<T> checked_unsigned_truncate(V);
 
@@ -70,13 +86,12 @@ protected:
 };
 
 struct DebuggerBytecodeInterpreter : public BytecodeInterpreter {
+    virtual void interpret(Configuration&) override;
+    virtual void interpret(Configuration&, InstructionPointer&, Instruction const&) override;
     virtual ~DebuggerBytecodeInterpreter() override = default;
 
     Function<bool(Configuration&, InstructionPointer&, Instruction const&)> pre_interpret_hook;
     Function<bool(Configuration&, InstructionPointer&, Instruction const&, Interpreter const&)> post_interpret_hook;
-
-private:
-    virtual void interpret(Configuration&, InstructionPointer&, Instruction const&) override;
 };
 
 }
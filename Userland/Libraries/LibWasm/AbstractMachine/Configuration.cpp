@@ -43,6 +43,15 @@ Result Configuration::call(Interpreter& interpreter, FunctionAddress address, Ve
     if (!function)
         return Trap {};
     if (auto* wasm_function = function->get_pointer<WasmFunction>()) {
+        // If the module was instantiated with deferred function body
+        // validation, the body is checked here on the function's first call.
+        if (wasm_function->code().body_validation_status() != Module::Function::BodyValidationStatus::Valid) {
+            if (auto* validator = wasm_function->module().deferred_function_body_validator()) {
+                if (auto result = validator->validate_function_body(wasm_function->type(), wasm_function->code()); result.is_error())
+                    return Trap { DeprecatedString::formatted("Function body validation failed: {}", result.error().error_string) };
+            }
+        }
+
         Vector<Value> locals = move(arguments);
         locals.ensure_capacity(locals.size() + wasm_function->code().locals().size());
         for (auto& type : wasm_function->code().locals())
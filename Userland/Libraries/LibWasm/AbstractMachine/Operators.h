@@ -9,8 +9,10 @@
 #include <AK/BitCast.h>
 #include <AK/BuiltinWrappers.h>
 #include <AK/Result.h>
+#include <AK/SIMD.h>
 #include <AK/StringView.h>
 #include <AK/Types.h>
+#include <AK/UFixedBigInt.h>
 #include <limits.h>
 #include <math.h>
 
@@ -453,4 +455,195 @@ struct SaturatingTruncate {
     static StringView name() { return "truncate.saturating"sv; }
 };
 
+// Vector (v128)
+// The wrappers below apply a scalar operator either to whole 16-byte vectors,
+// where the generic vector extensions already have the right semantics, or
+// lane by lane; the compiler turns the lane loops back into vector
+// instructions wherever the target supports them.
+
+struct BitNot {
+    template<typename Lhs>
+    auto operator()(Lhs lhs) const { return ~lhs; }
+
+    static StringView name() { return "~"sv; }
+};
+
+struct BitAndNot {
+    template<typename Lhs, typename Rhs>
+    auto operator()(Lhs lhs, Rhs rhs) const { return lhs & ~rhs; }
+
+    static StringView name() { return "andnot"sv; }
+};
+
+struct PseudoMinimum {
+    template<typename Lhs, typename Rhs>
+    auto operator()(Lhs lhs, Rhs rhs) const { return rhs < lhs ? rhs : lhs; }
+
+    static StringView name() { return "pseudo_minimum"sv; }
+};
+
+struct PseudoMaximum {
+    template<typename Lhs, typename Rhs>
+    auto operator()(Lhs lhs, Rhs rhs) const { return lhs < rhs ? rhs : lhs; }
+
+    static StringView name() { return "pseudo_maximum"sv; }
+};
+
+struct WrappingAbsolute {
+    template<typename Lhs>
+    Lhs operator()(Lhs lhs) const
+    {
+        if constexpr (IsSigned<Lhs>)
+            return lhs < 0 ? static_cast<Lhs>(0 - static_cast<MakeUnsigned<Lhs>>(lhs)) : lhs;
+        else
+            return AK::abs(lhs);
+    }
+
+    static StringView name() { return "abs"sv; }
+};
+
+template<typename VectorType, typename Op>
+struct VectorBinaryOperation {
+    u128 operator()(u128 lhs, u128 rhs) const
+    {
+        auto result = Op {}(bit_cast<VectorType>(lhs), bit_cast<VectorType>(rhs));
+        static_assert(sizeof(result) == sizeof(u128));
+        return bit_cast<u128>(result);
+    }
+
+    static StringView name() { return Op::name(); }
+};
+
+template<typename VectorType, typename Op>
+struct VectorUnaryOperation {
+    u128 operator()(u128 lhs) const
+    {
+        auto result = Op {}(bit_cast<VectorType>(lhs));
+        static_assert(sizeof(result) == sizeof(u128));
+        return bit_cast<u128>(result);
+    }
+
+    static StringView name() { return Op::name(); }
+};
+
+template<typename VectorType, typename Op>
+struct VectorLaneWiseBinaryOperation {
+    u128 operator()(u128 lhs, u128 rhs) const
+    {
+        auto first = bit_cast<VectorType>(lhs);
+        auto second = bit_cast<VectorType>(rhs);
+        constexpr auto lane_count = sizeof(VectorType) / sizeof(first[0]);
+        for (size_t lane = 0; lane < lane_count; ++lane)
+            first[lane] = Op {}(first[lane], second[lane]);
+        return bit_cast<u128>(first);
+    }
+
+    static StringView name() { return Op::name(); }
+};
+
+template<typename VectorType, typename Op>
+struct VectorLaneWiseUnaryOperation {
+    u128 operator()(u128 lhs) const
+    {
+        auto vector = bit_cast<VectorType>(lhs);
+        constexpr auto lane_count = sizeof(VectorType) / sizeof(vector[0]);
+        for (size_t lane = 0; lane < lane_count; ++lane)
+            vector[lane] = Op {}(vector[lane]);
+        return bit_cast<u128>(vector);
+    }
+
+    static StringView name() { return Op::name(); }
+};
+
+template<typename VectorType>
+struct VectorShiftLeft {
+    u128 operator()(u128 lhs, i32 rhs) const
+    {
+        auto vector = bit_cast<VectorType>(lhs);
+        vector = vector << (static_cast<u32>(rhs) % (sizeof(vector[0]) * 8));
+        return bit_cast<u128>(vector);
+    }
+
+    static StringView name() { return "vec(<<)"sv; }
+};
+
+template<typename VectorType>
+struct VectorShiftRight {
+    u128 operator()(u128 lhs, i32 rhs) const
+    {
+        auto vector = bit_cast<VectorType>(lhs);
+        vector = vector >> (static_cast<u32>(rhs) % (sizeof(vector[0]) * 8));
+        return bit_cast<u128>(vector);
+    }
+
+    static StringView name() { return "vec(>>)"sv; }
+};
+
+template<typename VectorType>
+struct VectorSplat {
+    template<typename Lhs>
+    u128 operator()(Lhs lhs) const
+    {
+        VectorType result = {};
+        using Element = RemoveCVReference<decltype(result[0])>;
+        constexpr auto lane_count = sizeof(VectorType) / sizeof(Element);
+        for (size_t lane = 0; lane < lane_count; ++lane)
+            result[lane] = static_cast<Element>(lhs);
+        return bit_cast<u128>(result);
+    }
+
+    static StringView name() { return "splat"sv; }
+};
+
+struct VectorSwizzle {
+    u128 operator()(u128 lhs, u128 rhs) const
+    {
+        auto vector = bit_cast<AK::SIMD::u8x16>(lhs);
+        auto indices = bit_cast<AK::SIMD::u8x16>(rhs);
+        AK::SIMD::u8x16 result = {};
+        for (size_t lane = 0; lane < 16; ++lane)
+            result[lane] = indices[lane] < 16 ? vector[indices[lane]] : 0;
+        return bit_cast<u128>(result);
+    }
+
+    static StringView name() { return "swizzle"sv; }
+};
+
+struct VectorAnyTrue {
+    i32 operator()(u128 lhs) const { return !lhs ? 0 : 1; }
+
+    static StringView name() { return "any_true"sv; }
+};
+
+template<typename VectorType>
+struct VectorAllTrue {
+    i32 operator()(u128 lhs) const
+    {
+        auto vector = bit_cast<VectorType>(lhs);
+        constexpr auto lane_count = sizeof(VectorType) / sizeof(vector[0]);
+        for (size_t lane = 0; lane < lane_count; ++lane) {
+            if (vector[lane] == 0)
+                return 0;
+        }
+        return 1;
+    }
+
+    static StringView name() { return "all_true"sv; }
+};
+
+template<typename VectorType>
+struct VectorBitmask {
+    i32 operator()(u128 lhs) const
+    {
+        auto vector = bit_cast<VectorType>(lhs);
+        constexpr auto lane_count = sizeof(VectorType) / sizeof(vector[0]);
+        i32 result = 0;
+        for (size_t lane = 0; lane < lane_count; ++lane)
+            result |= (vector[lane] < 0 ? 1 : 0) << lane;
+        return result;
+    }
+
+    static StringView name() { return "bitmask"sv; }
+};
+
 }
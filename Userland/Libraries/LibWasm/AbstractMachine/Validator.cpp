@@ -13,8 +13,9 @@
 
 namespace Wasm {
 
-ErrorOr<void, ValidationError> Validator::validate(Module& module)
+ErrorOr<void, ValidationError> Validator::validate(Module& module, FunctionBodyValidationMode mode)
 {
+    m_function_body_validation_mode = mode;
     ErrorOr<void, ValidationError> result {};
 
     // Note: The spec performs this after populating the context, but there's no real reason to do so,
@@ -148,6 +149,19 @@ ErrorOr<void, ValidationError> Validator::validate(Module& module)
         return Errors::out_of_bounds("memory section count"sv, m_context.memories.size(), 1, 1);
     }
 
+    // A module with deferred function bodies is not known to be valid until
+    // every body has been checked, so leave its status untouched in that case.
+    if (mode == FunctionBodyValidationMode::Deferred)
+        return {};
+
+    size_t function_index = m_context.imported_function_count;
+    for (auto& function : module.functions()) {
+        if (auto function_result = validate_function_body(m_context.functions[function_index++], function); function_result.is_error()) {
+            module.set_validation_status(Module::ValidationStatus::Invalid, {});
+            return function_result.release_error();
+        }
+    }
+
     module.set_validation_status(Module::ValidationStatus::Valid, {});
     return {};
 }
@@ -248,27 +262,31 @@ ErrorOr<void, ValidationError> Validator::validate(TableSection const& section)
 
 ErrorOr<void, ValidationError> Validator::validate(CodeSection const& section)
 {
+    // Note: The bodies themselves are validated through validate_function_body(),
+    //       either from validate(Module&) or lazily on a function's first call.
     size_t index = m_context.imported_function_count;
-    for (auto& entry : section.functions()) {
-        auto function_index = index++;
-        TRY(validate(FunctionIndex { function_index }));
-        auto& function_type = m_context.functions[function_index];
-        auto& function = entry.func();
-
-        auto function_validator = fork();
-        function_validator.m_context.locals = {};
-        function_validator.m_context.locals.extend(function_type.parameters());
-        for (auto& local : function.locals()) {
-            for (size_t i = 0; i < local.n(); ++i)
-                function_validator.m_context.locals.append(local.type());
-        }
+    for ([[maybe_unused]] auto& entry : section.functions())
+        TRY(validate(FunctionIndex { index++ }));
 
-        function_validator.m_context.labels = { ResultType { function_type.results() } };
-        function_validator.m_context.return_ = ResultType { function_type.results() };
+    return {};
+}
 
-        TRY(function_validator.validate(function.body(), function_type.results()));
+ErrorOr<void, ValidationError> Validator::validate_function_body(FunctionType const& function_type, Module::Function const& function) const
+{
+    auto function_validator = fork();
+    function_validator.m_context.locals = {};
+    function_validator.m_context.locals.extend(function_type.parameters());
+    function_validator.m_context.locals.extend(function.locals());
+
+    function_validator.m_context.labels = { ResultType { function_type.results() } };
+    function_validator.m_context.return_ = ResultType { function_type.results() };
+
+    if (auto result = function_validator.validate(function.body(), function_type.results()); result.is_error()) {
+        function.set_body_validation_status(Module::Function::BodyValidationStatus::Invalid, {});
+        return result.release_error();
     }
 
+    function.set_body_validation_status(Module::Function::BodyValidationStatus::Valid, {});
     return {};
 }
 
@@ -2166,6 +2184,293 @@ VALIDATE_INSTRUCTION(call_indirect)
     return {};
 }
 
+// -- The vector instructions. The shape prefixes only affect the lane
+//    arithmetic in the interpreter; as far as typing is concerned everything
+//    here operates on v128.
+
+VALIDATE_INSTRUCTION(v128_const)
+{
+    is_constant = true;
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(v128_load)
+{
+    TRY(validate(MemoryIndex { 0 }));
+
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    if ((1ull << arg.align) > sizeof(u128))
+        return Errors::out_of_bounds("memory op alignment"sv, 1ull << arg.align, 0, sizeof(u128));
+
+    TRY((stack.take<ValueType::I32>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(v128_store)
+{
+    TRY(validate(MemoryIndex { 0 }));
+
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    if ((1ull << arg.align) > sizeof(u128))
+        return Errors::out_of_bounds("memory op alignment"sv, 1ull << arg.align, 0, sizeof(u128));
+
+    TRY((stack.take<ValueType::V128, ValueType::I32>()));
+
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i8x16_shuffle)
+{
+    auto& argument = instruction.arguments().get<Instruction::ShuffleArgument>();
+    for (auto lane : argument.lanes) {
+        if (lane >= 32)
+            return Errors::out_of_bounds("shuffle lane index"sv, lane, 0, 32);
+    }
+
+    TRY((stack.take<ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(v128_bitselect)
+{
+    TRY((stack.take<ValueType::V128, ValueType::V128, ValueType::V128>()));
+    stack.append(ValueType(ValueType::V128));
+    return {};
+}
+
+#define VALIDATE_VECTOR_BINARY_OPERATION(name)                 \
+    VALIDATE_INSTRUCTION(name)                                 \
+    {                                                          \
+        TRY((stack.take<ValueType::V128, ValueType::V128>())); \
+        stack.append(ValueType(ValueType::V128));              \
+        return {};                                             \
+    }
+
+VALIDATE_VECTOR_BINARY_OPERATION(i8x16_swizzle)
+VALIDATE_VECTOR_BINARY_OPERATION(i8x16_eq)
+VALIDATE_VECTOR_BINARY_OPERATION(i8x16_ne)
+VALIDATE_VECTOR_BINARY_OPERATION(i8x16_lt_s)
+VALIDATE_VECTOR_BINARY_OPERATION(i8x16_lt_u)
+VALIDATE_VECTOR_BINARY_OPERATION(i8x16_gt_s)
+VALIDATE_VECTOR_BINARY_OPERATION(i8x16_gt_u)
+VALIDATE_VECTOR_BINARY_OPERATION(i8x16_le_s)
+VALIDATE_VECTOR_BINARY_OPERATION(i8x16_le_u)
+VALIDATE_VECTOR_BINARY_OPERATION(i8x16_ge_s)
+VALIDATE_VECTOR_BINARY_OPERATION(i8x16_ge_u)
+VALIDATE_VECTOR_BINARY_OPERATION(i16x8_eq)
+VALIDATE_VECTOR_BINARY_OPERATION(i16x8_ne)
+VALIDATE_VECTOR_BINARY_OPERATION(i16x8_lt_s)
+VALIDATE_VECTOR_BINARY_OPERATION(i16x8_lt_u)
+VALIDATE_VECTOR_BINARY_OPERATION(i16x8_gt_s)
+VALIDATE_VECTOR_BINARY_OPERATION(i16x8_gt_u)
+VALIDATE_VECTOR_BINARY_OPERATION(i16x8_le_s)
+VALIDATE_VECTOR_BINARY_OPERATION(i16x8_le_u)
+VALIDATE_VECTOR_BINARY_OPERATION(i16x8_ge_s)
+VALIDATE_VECTOR_BINARY_OPERATION(i16x8_ge_u)
+VALIDATE_VECTOR_BINARY_OPERATION(i32x4_eq)
+VALIDATE_VECTOR_BINARY_OPERATION(i32x4_ne)
+VALIDATE_VECTOR_BINARY_OPERATION(i32x4_lt_s)
+VALIDATE_VECTOR_BINARY_OPERATION(i32x4_lt_u)
+VALIDATE_VECTOR_BINARY_OPERATION(i32x4_gt_s)
+VALIDATE_VECTOR_BINARY_OPERATION(i32x4_gt_u)
+VALIDATE_VECTOR_BINARY_OPERATION(i32x4_le_s)
+VALIDATE_VECTOR_BINARY_OPERATION(i32x4_le_u)
+VALIDATE_VECTOR_BINARY_OPERATION(i32x4_ge_s)
+VALIDATE_VECTOR_BINARY_OPERATION(i32x4_ge_u)
+VALIDATE_VECTOR_BINARY_OPERATION(f32x4_eq)
+VALIDATE_VECTOR_BINARY_OPERATION(f32x4_ne)
+VALIDATE_VECTOR_BINARY_OPERATION(f32x4_lt)
+VALIDATE_VECTOR_BINARY_OPERATION(f32x4_gt)
+VALIDATE_VECTOR_BINARY_OPERATION(f32x4_le)
+VALIDATE_VECTOR_BINARY_OPERATION(f32x4_ge)
+VALIDATE_VECTOR_BINARY_OPERATION(f64x2_eq)
+VALIDATE_VECTOR_BINARY_OPERATION(f64x2_ne)
+VALIDATE_VECTOR_BINARY_OPERATION(f64x2_lt)
+VALIDATE_VECTOR_BINARY_OPERATION(f64x2_gt)
+VALIDATE_VECTOR_BINARY_OPERATION(f64x2_le)
+VALIDATE_VECTOR_BINARY_OPERATION(f64x2_ge)
+VALIDATE_VECTOR_BINARY_OPERATION(v128_and)
+VALIDATE_VECTOR_BINARY_OPERATION(v128_andnot)
+VALIDATE_VECTOR_BINARY_OPERATION(v128_or)
+VALIDATE_VECTOR_BINARY_OPERATION(v128_xor)
+VALIDATE_VECTOR_BINARY_OPERATION(i8x16_add)
+VALIDATE_VECTOR_BINARY_OPERATION(i8x16_sub)
+VALIDATE_VECTOR_BINARY_OPERATION(i8x16_min_s)
+VALIDATE_VECTOR_BINARY_OPERATION(i8x16_min_u)
+VALIDATE_VECTOR_BINARY_OPERATION(i8x16_max_s)
+VALIDATE_VECTOR_BINARY_OPERATION(i8x16_max_u)
+VALIDATE_VECTOR_BINARY_OPERATION(i16x8_add)
+VALIDATE_VECTOR_BINARY_OPERATION(i16x8_sub)
+VALIDATE_VECTOR_BINARY_OPERATION(i16x8_mul)
+VALIDATE_VECTOR_BINARY_OPERATION(i16x8_min_s)
+VALIDATE_VECTOR_BINARY_OPERATION(i16x8_min_u)
+VALIDATE_VECTOR_BINARY_OPERATION(i16x8_max_s)
+VALIDATE_VECTOR_BINARY_OPERATION(i16x8_max_u)
+VALIDATE_VECTOR_BINARY_OPERATION(i32x4_add)
+VALIDATE_VECTOR_BINARY_OPERATION(i32x4_sub)
+VALIDATE_VECTOR_BINARY_OPERATION(i32x4_mul)
+VALIDATE_VECTOR_BINARY_OPERATION(i32x4_min_s)
+VALIDATE_VECTOR_BINARY_OPERATION(i32x4_min_u)
+VALIDATE_VECTOR_BINARY_OPERATION(i32x4_max_s)
+VALIDATE_VECTOR_BINARY_OPERATION(i32x4_max_u)
+VALIDATE_VECTOR_BINARY_OPERATION(i64x2_add)
+VALIDATE_VECTOR_BINARY_OPERATION(i64x2_sub)
+VALIDATE_VECTOR_BINARY_OPERATION(i64x2_mul)
+VALIDATE_VECTOR_BINARY_OPERATION(i64x2_eq)
+VALIDATE_VECTOR_BINARY_OPERATION(i64x2_ne)
+VALIDATE_VECTOR_BINARY_OPERATION(i64x2_lt_s)
+VALIDATE_VECTOR_BINARY_OPERATION(i64x2_gt_s)
+VALIDATE_VECTOR_BINARY_OPERATION(i64x2_le_s)
+VALIDATE_VECTOR_BINARY_OPERATION(i64x2_ge_s)
+VALIDATE_VECTOR_BINARY_OPERATION(f32x4_add)
+VALIDATE_VECTOR_BINARY_OPERATION(f32x4_sub)
+VALIDATE_VECTOR_BINARY_OPERATION(f32x4_mul)
+VALIDATE_VECTOR_BINARY_OPERATION(f32x4_div)
+VALIDATE_VECTOR_BINARY_OPERATION(f32x4_min)
+VALIDATE_VECTOR_BINARY_OPERATION(f32x4_max)
+VALIDATE_VECTOR_BINARY_OPERATION(f32x4_pmin)
+VALIDATE_VECTOR_BINARY_OPERATION(f32x4_pmax)
+VALIDATE_VECTOR_BINARY_OPERATION(f64x2_add)
+VALIDATE_VECTOR_BINARY_OPERATION(f64x2_sub)
+VALIDATE_VECTOR_BINARY_OPERATION(f64x2_mul)
+VALIDATE_VECTOR_BINARY_OPERATION(f64x2_div)
+VALIDATE_VECTOR_BINARY_OPERATION(f64x2_min)
+VALIDATE_VECTOR_BINARY_OPERATION(f64x2_max)
+VALIDATE_VECTOR_BINARY_OPERATION(f64x2_pmin)
+VALIDATE_VECTOR_BINARY_OPERATION(f64x2_pmax)
+
+#undef VALIDATE_VECTOR_BINARY_OPERATION
+
+#define VALIDATE_VECTOR_UNARY_OPERATION(name)     \
+    VALIDATE_INSTRUCTION(name)                    \
+    {                                             \
+        TRY((stack.take<ValueType::V128>()));     \
+        stack.append(ValueType(ValueType::V128)); \
+        return {};                                \
+    }
+
+VALIDATE_VECTOR_UNARY_OPERATION(v128_not)
+VALIDATE_VECTOR_UNARY_OPERATION(i8x16_abs)
+VALIDATE_VECTOR_UNARY_OPERATION(i8x16_neg)
+VALIDATE_VECTOR_UNARY_OPERATION(i16x8_abs)
+VALIDATE_VECTOR_UNARY_OPERATION(i16x8_neg)
+VALIDATE_VECTOR_UNARY_OPERATION(i32x4_abs)
+VALIDATE_VECTOR_UNARY_OPERATION(i32x4_neg)
+VALIDATE_VECTOR_UNARY_OPERATION(i64x2_abs)
+VALIDATE_VECTOR_UNARY_OPERATION(i64x2_neg)
+VALIDATE_VECTOR_UNARY_OPERATION(f32x4_abs)
+VALIDATE_VECTOR_UNARY_OPERATION(f32x4_neg)
+VALIDATE_VECTOR_UNARY_OPERATION(f32x4_sqrt)
+VALIDATE_VECTOR_UNARY_OPERATION(f64x2_abs)
+VALIDATE_VECTOR_UNARY_OPERATION(f64x2_neg)
+VALIDATE_VECTOR_UNARY_OPERATION(f64x2_sqrt)
+
+#undef VALIDATE_VECTOR_UNARY_OPERATION
+
+#define VALIDATE_VECTOR_TEST_OPERATION(name)     \
+    VALIDATE_INSTRUCTION(name)                   \
+    {                                            \
+        TRY((stack.take<ValueType::V128>()));    \
+        stack.append(ValueType(ValueType::I32)); \
+        return {};                               \
+    }
+
+VALIDATE_VECTOR_TEST_OPERATION(v128_any_true)
+VALIDATE_VECTOR_TEST_OPERATION(i8x16_all_true)
+VALIDATE_VECTOR_TEST_OPERATION(i8x16_bitmask)
+VALIDATE_VECTOR_TEST_OPERATION(i16x8_all_true)
+VALIDATE_VECTOR_TEST_OPERATION(i16x8_bitmask)
+VALIDATE_VECTOR_TEST_OPERATION(i32x4_all_true)
+VALIDATE_VECTOR_TEST_OPERATION(i32x4_bitmask)
+VALIDATE_VECTOR_TEST_OPERATION(i64x2_all_true)
+VALIDATE_VECTOR_TEST_OPERATION(i64x2_bitmask)
+
+#undef VALIDATE_VECTOR_TEST_OPERATION
+
+#define VALIDATE_VECTOR_SHIFT_OPERATION(name)                 \
+    VALIDATE_INSTRUCTION(name)                                \
+    {                                                         \
+        TRY((stack.take<ValueType::I32, ValueType::V128>())); \
+        stack.append(ValueType(ValueType::V128));             \
+        return {};                                            \
+    }
+
+VALIDATE_VECTOR_SHIFT_OPERATION(i8x16_shl)
+VALIDATE_VECTOR_SHIFT_OPERATION(i8x16_shr_s)
+VALIDATE_VECTOR_SHIFT_OPERATION(i8x16_shr_u)
+VALIDATE_VECTOR_SHIFT_OPERATION(i16x8_shl)
+VALIDATE_VECTOR_SHIFT_OPERATION(i16x8_shr_s)
+VALIDATE_VECTOR_SHIFT_OPERATION(i16x8_shr_u)
+VALIDATE_VECTOR_SHIFT_OPERATION(i32x4_shl)
+VALIDATE_VECTOR_SHIFT_OPERATION(i32x4_shr_s)
+VALIDATE_VECTOR_SHIFT_OPERATION(i32x4_shr_u)
+VALIDATE_VECTOR_SHIFT_OPERATION(i64x2_shl)
+VALIDATE_VECTOR_SHIFT_OPERATION(i64x2_shr_s)
+VALIDATE_VECTOR_SHIFT_OPERATION(i64x2_shr_u)
+
+#undef VALIDATE_VECTOR_SHIFT_OPERATION
+
+#define VALIDATE_VECTOR_SPLAT_OPERATION(name, value_kind)  \
+    VALIDATE_INSTRUCTION(name)                             \
+    {                                                      \
+        TRY((stack.take<ValueType::value_kind>()));        \
+        stack.append(ValueType(ValueType::V128));          \
+        return {};                                         \
+    }
+
+VALIDATE_VECTOR_SPLAT_OPERATION(i8x16_splat, I32)
+VALIDATE_VECTOR_SPLAT_OPERATION(i16x8_splat, I32)
+VALIDATE_VECTOR_SPLAT_OPERATION(i32x4_splat, I32)
+VALIDATE_VECTOR_SPLAT_OPERATION(i64x2_splat, I64)
+VALIDATE_VECTOR_SPLAT_OPERATION(f32x4_splat, F32)
+VALIDATE_VECTOR_SPLAT_OPERATION(f64x2_splat, F64)
+
+#undef VALIDATE_VECTOR_SPLAT_OPERATION
+
+#define VALIDATE_VECTOR_EXTRACT_LANE(name, lane_count, result_kind)            \
+    VALIDATE_INSTRUCTION(name)                                                 \
+    {                                                                          \
+        auto lane = instruction.arguments().get<Instruction::LaneIndex>().lane; \
+        if (lane >= (lane_count))                                              \
+            return Errors::out_of_bounds("lane index"sv, lane, 0, lane_count); \
+        TRY((stack.take<ValueType::V128>()));                                  \
+        stack.append(ValueType(ValueType::result_kind));                       \
+        return {};                                                             \
+    }
+
+VALIDATE_VECTOR_EXTRACT_LANE(i8x16_extract_lane_s, 16, I32)
+VALIDATE_VECTOR_EXTRACT_LANE(i8x16_extract_lane_u, 16, I32)
+VALIDATE_VECTOR_EXTRACT_LANE(i16x8_extract_lane_s, 8, I32)
+VALIDATE_VECTOR_EXTRACT_LANE(i16x8_extract_lane_u, 8, I32)
+VALIDATE_VECTOR_EXTRACT_LANE(i32x4_extract_lane, 4, I32)
+VALIDATE_VECTOR_EXTRACT_LANE(i64x2_extract_lane, 2, I64)
+VALIDATE_VECTOR_EXTRACT_LANE(f32x4_extract_lane, 4, F32)
+VALIDATE_VECTOR_EXTRACT_LANE(f64x2_extract_lane, 2, F64)
+
+#undef VALIDATE_VECTOR_EXTRACT_LANE
+
+#define VALIDATE_VECTOR_REPLACE_LANE(name, lane_count, value_kind)             \
+    VALIDATE_INSTRUCTION(name)                                                 \
+    {                                                                          \
+        auto lane = instruction.arguments().get<Instruction::LaneIndex>().lane; \
+        if (lane >= (lane_count))                                              \
+            return Errors::out_of_bounds("lane index"sv, lane, 0, lane_count); \
+        TRY((stack.take<ValueType::value_kind, ValueType::V128>()));           \
+        stack.append(ValueType(ValueType::V128));                              \
+        return {};                                                             \
+    }
+
+VALIDATE_VECTOR_REPLACE_LANE(i8x16_replace_lane, 16, I32)
+VALIDATE_VECTOR_REPLACE_LANE(i16x8_replace_lane, 8, I32)
+VALIDATE_VECTOR_REPLACE_LANE(i32x4_replace_lane, 4, I32)
+VALIDATE_VECTOR_REPLACE_LANE(i64x2_replace_lane, 2, I64)
+VALIDATE_VECTOR_REPLACE_LANE(f32x4_replace_lane, 4, F32)
+VALIDATE_VECTOR_REPLACE_LANE(f64x2_replace_lane, 2, F64)
+
+#undef VALIDATE_VECTOR_REPLACE_LANE
 ErrorOr<void, ValidationError> Validator::validate(Instruction const& instruction, Stack& stack, bool& is_constant)
 {
     switch (instruction.opcode().value()) {
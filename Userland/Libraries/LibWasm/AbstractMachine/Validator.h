@@ -45,6 +45,11 @@ class Validator {
     AK_MAKE_NONMOVABLE(Validator);
 
 public:
+    enum class FunctionBodyValidationMode {
+        Eager,
+        Deferred,
+    };
+
     Validator() = default;
 
     [[nodiscard]] Validator fork() const
@@ -53,7 +58,7 @@ public:
     }
 
     // Module
-    ErrorOr<void, ValidationError> validate(Module&);
+    ErrorOr<void, ValidationError> validate(Module&, FunctionBodyValidationMode = FunctionBodyValidationMode::Eager);
     ErrorOr<void, ValidationError> validate(ImportSection const&);
     ErrorOr<void, ValidationError> validate(ExportSection const&);
     ErrorOr<void, ValidationError> validate(StartSection const&);
@@ -68,6 +73,11 @@ public:
     ErrorOr<void, ValidationError> validate(TypeSection const&) { return {}; }
     ErrorOr<void, ValidationError> validate(CustomSection const&) { return {}; }
 
+    // Validates a single function body against this validator's module-level
+    // context, and caches the verdict on the function. Used to finish off
+    // modules validated with FunctionBodyValidationMode::Deferred.
+    ErrorOr<void, ValidationError> validate_function_body(FunctionType const&, Module::Function const&) const;
+
     ErrorOr<void, ValidationError> validate(TypeIndex index) const
     {
         if (index.value() < m_context.types.size())
@@ -330,6 +340,7 @@ private:
     };
 
     Context m_context;
+    FunctionBodyValidationMode m_function_body_validation_mode { FunctionBodyValidationMode::Eager };
     Vector<Context> m_parent_contexts;
     Vector<ChildScopeKind> m_entered_scopes;
     Vector<BlockDetails> m_block_details;
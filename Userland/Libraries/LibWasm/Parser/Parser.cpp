@@ -133,6 +133,8 @@ ParseResult<ValueType> ValueType::parse(InputStream& stream)
         return ValueType(F32);
     case Constants::f64_tag:
         return ValueType(F64);
+    case Constants::v128_tag:
+        return ValueType(V128);
     case Constants::function_reference_tag:
         return ValueType(FunctionReference);
     case Constants::extern_reference_tag:
@@ -762,6 +764,210 @@ ParseResult<Vector<Instruction>> Instruction::parse(InputStream& stream, Instruc
             default:
                 return ParseError::UnknownInstruction;
             }
+            break;
+        }
+        case 0xfd: {
+            // These are the vector instructions, selected by a LEB128 immediate.
+            u32 selector;
+            if (!LEB128::read_unsigned(stream, selector))
+                return with_eof_check(stream, ParseError::InvalidInput);
+            auto opcode = OpCode { 0xfd00 | selector };
+            switch (opcode.value()) {
+            case Instructions::v128_load.value():
+            case Instructions::v128_store.value(): {
+                // op (align offset)
+                size_t align;
+                if (!LEB128::read_unsigned(stream, align))
+                    return with_eof_check(stream, ParseError::InvalidInput);
+
+                size_t offset;
+                if (!LEB128::read_unsigned(stream, offset))
+                    return with_eof_check(stream, ParseError::InvalidInput);
+
+                resulting_instructions.append(Instruction { opcode, MemoryArgument { static_cast<u32>(align), static_cast<u32>(offset) } });
+                break;
+            }
+            case Instructions::v128_const.value(): {
+                // op literal
+                u128 value;
+                if (!stream.read_or_error(value.bytes()))
+                    return with_eof_check(stream, ParseError::InvalidImmediate);
+
+                resulting_instructions.append(Instruction { opcode, value });
+                break;
+            }
+            case Instructions::i8x16_shuffle.value(): {
+                // op 16x laneidx
+                Instruction::ShuffleArgument argument;
+                if (!stream.read_or_error(argument.lanes.span()))
+                    return with_eof_check(stream, ParseError::InvalidImmediate);
+
+                resulting_instructions.append(Instruction { opcode, argument });
+                break;
+            }
+            case Instructions::i8x16_extract_lane_s.value():
+            case Instructions::i8x16_extract_lane_u.value():
+            case Instructions::i8x16_replace_lane.value():
+            case Instructions::i16x8_extract_lane_s.value():
+            case Instructions::i16x8_extract_lane_u.value():
+            case Instructions::i16x8_replace_lane.value():
+            case Instructions::i32x4_extract_lane.value():
+            case Instructions::i32x4_replace_lane.value():
+            case Instructions::i64x2_extract_lane.value():
+            case Instructions::i64x2_replace_lane.value():
+            case Instructions::f32x4_extract_lane.value():
+            case Instructions::f32x4_replace_lane.value():
+            case Instructions::f64x2_extract_lane.value():
+            case Instructions::f64x2_replace_lane.value(): {
+                // op laneidx
+                u8 lane;
+                stream >> lane;
+                if (stream.has_any_error())
+                    return with_eof_check(stream, ParseError::InvalidImmediate);
+
+                resulting_instructions.append(Instruction { opcode, Instruction::LaneIndex { lane } });
+                break;
+            }
+            case Instructions::i8x16_swizzle.value():
+            case Instructions::i8x16_splat.value():
+            case Instructions::i16x8_splat.value():
+            case Instructions::i32x4_splat.value():
+            case Instructions::i64x2_splat.value():
+            case Instructions::f32x4_splat.value():
+            case Instructions::f64x2_splat.value():
+            case Instructions::i8x16_eq.value():
+            case Instructions::i8x16_ne.value():
+            case Instructions::i8x16_lt_s.value():
+            case Instructions::i8x16_lt_u.value():
+            case Instructions::i8x16_gt_s.value():
+            case Instructions::i8x16_gt_u.value():
+            case Instructions::i8x16_le_s.value():
+            case Instructions::i8x16_le_u.value():
+            case Instructions::i8x16_ge_s.value():
+            case Instructions::i8x16_ge_u.value():
+            case Instructions::i16x8_eq.value():
+            case Instructions::i16x8_ne.value():
+            case Instructions::i16x8_lt_s.value():
+            case Instructions::i16x8_lt_u.value():
+            case Instructions::i16x8_gt_s.value():
+            case Instructions::i16x8_gt_u.value():
+            case Instructions::i16x8_le_s.value():
+            case Instructions::i16x8_le_u.value():
+            case Instructions::i16x8_ge_s.value():
+            case Instructions::i16x8_ge_u.value():
+            case Instructions::i32x4_eq.value():
+            case Instructions::i32x4_ne.value():
+            case Instructions::i32x4_lt_s.value():
+            case Instructions::i32x4_lt_u.value():
+            case Instructions::i32x4_gt_s.value():
+            case Instructions::i32x4_gt_u.value():
+            case Instructions::i32x4_le_s.value():
+            case Instructions::i32x4_le_u.value():
+            case Instructions::i32x4_ge_s.value():
+            case Instructions::i32x4_ge_u.value():
+            case Instructions::f32x4_eq.value():
+            case Instructions::f32x4_ne.value():
+            case Instructions::f32x4_lt.value():
+            case Instructions::f32x4_gt.value():
+            case Instructions::f32x4_le.value():
+            case Instructions::f32x4_ge.value():
+            case Instructions::f64x2_eq.value():
+            case Instructions::f64x2_ne.value():
+            case Instructions::f64x2_lt.value():
+            case Instructions::f64x2_gt.value():
+            case Instructions::f64x2_le.value():
+            case Instructions::f64x2_ge.value():
+            case Instructions::v128_not.value():
+            case Instructions::v128_and.value():
+            case Instructions::v128_andnot.value():
+            case Instructions::v128_or.value():
+            case Instructions::v128_xor.value():
+            case Instructions::v128_bitselect.value():
+            case Instructions::v128_any_true.value():
+            case Instructions::i8x16_abs.value():
+            case Instructions::i8x16_neg.value():
+            case Instructions::i8x16_all_true.value():
+            case Instructions::i8x16_bitmask.value():
+            case Instructions::i8x16_shl.value():
+            case Instructions::i8x16_shr_s.value():
+            case Instructions::i8x16_shr_u.value():
+            case Instructions::i8x16_add.value():
+            case Instructions::i8x16_sub.value():
+            case Instructions::i8x16_min_s.value():
+            case Instructions::i8x16_min_u.value():
+            case Instructions::i8x16_max_s.value():
+            case Instructions::i8x16_max_u.value():
+            case Instructions::i16x8_abs.value():
+            case Instructions::i16x8_neg.value():
+            case Instructions::i16x8_all_true.value():
+            case Instructions::i16x8_bitmask.value():
+            case Instructions::i16x8_shl.value():
+            case Instructions::i16x8_shr_s.value():
+            case Instructions::i16x8_shr_u.value():
+            case Instructions::i16x8_add.value():
+            case Instructions::i16x8_sub.value():
+            case Instructions::i16x8_mul.value():
+            case Instructions::i16x8_min_s.value():
+            case Instructions::i16x8_min_u.value():
+            case Instructions::i16x8_max_s.value():
+            case Instructions::i16x8_max_u.value():
+            case Instructions::i32x4_abs.value():
+            case Instructions::i32x4_neg.value():
+            case Instructions::i32x4_all_true.value():
+            case Instructions::i32x4_bitmask.value():
+            case Instructions::i32x4_shl.value():
+            case Instructions::i32x4_shr_s.value():
+            case Instructions::i32x4_shr_u.value():
+            case Instructions::i32x4_add.value():
+            case Instructions::i32x4_sub.value():
+            case Instructions::i32x4_mul.value():
+            case Instructions::i32x4_min_s.value():
+            case Instructions::i32x4_min_u.value():
+            case Instructions::i32x4_max_s.value():
+            case Instructions::i32x4_max_u.value():
+            case Instructions::i64x2_abs.value():
+            case Instructions::i64x2_neg.value():
+            case Instructions::i64x2_all_true.value():
+            case Instructions::i64x2_bitmask.value():
+            case Instructions::i64x2_shl.value():
+            case Instructions::i64x2_shr_s.value():
+            case Instructions::i64x2_shr_u.value():
+            case Instructions::i64x2_add.value():
+            case Instructions::i64x2_sub.value():
+            case Instructions::i64x2_mul.value():
+            case Instructions::i64x2_eq.value():
+            case Instructions::i64x2_ne.value():
+            case Instructions::i64x2_lt_s.value():
+            case Instructions::i64x2_gt_s.value():
+            case Instructions::i64x2_le_s.value():
+            case Instructions::i64x2_ge_s.value():
+            case Instructions::f32x4_abs.value():
+            case Instructions::f32x4_neg.value():
+            case Instructions::f32x4_sqrt.value():
+            case Instructions::f32x4_add.value():
+            case Instructions::f32x4_sub.value():
+            case Instructions::f32x4_mul.value():
+            case Instructions::f32x4_div.value():
+            case Instructions::f32x4_min.value():
+            case Instructions::f32x4_max.value():
+            case Instructions::f32x4_pmin.value():
+            case Instructions::f32x4_pmax.value():
+            case Instructions::f64x2_abs.value():
+            case Instructions::f64x2_neg.value():
+            case Instructions::f64x2_sqrt.value():
+            case Instructions::f64x2_add.value():
+            case Instructions::f64x2_sub.value():
+            case Instructions::f64x2_mul.value():
+            case Instructions::f64x2_div.value():
+            case Instructions::f64x2_min.value():
+            case Instructions::f64x2_max.value():
+            case Instructions::f64x2_pmin.value():
+            case Instructions::f64x2_pmax.value():
+                resulting_instructions.append(Instruction { opcode });
+                break;
+            default:
+                return ParseError::UnknownInstruction;
+            }
         }
         }
     } while (!nested_instructions.is_empty());
@@ -6,12 +6,14 @@
 
 #pragma once
 
+#include <AK/Array.h>
 #include <AK/Badge.h>
 #include <AK/DeprecatedString.h>
 #include <AK/DistinctNumeric.h>
 #include <AK/MemoryStream.h>
 #include <AK/NonnullOwnPtrVector.h>
 #include <AK/Result.h>
+#include <AK/UFixedBigInt.h>
 #include <AK/Variant.h>
 #include <LibWasm/Constants.h>
 #include <LibWasm/Forward.h>
@@ -170,6 +172,7 @@ public:
         I64,
         F32,
         F64,
+        V128,
         FunctionReference,
         ExternReference,
         NullFunctionReference,
@@ -200,6 +203,8 @@ public:
             return "f32";
         case F64:
             return "f64";
+        case V128:
+            return "v128";
         case FunctionReference:
             return "funcref";
         case ExternReference:
@@ -421,6 +426,14 @@ public:
         u32 offset;
     };
 
+    struct LaneIndex {
+        u8 lane;
+    };
+
+    struct ShuffleArgument {
+        Array<u8, 16> lanes;
+    };
+
     template<typename T>
     explicit Instruction(OpCode opcode, T argument)
         : m_opcode(opcode)
@@ -444,8 +457,10 @@ private:
         GlobalIndex,
         IndirectCallArgs,
         LabelIndex,
+        LaneIndex,
         LocalIndex,
         MemoryArgument,
+        ShuffleArgument,
         StructuredInstructionArgs,
         TableBranchArgs,
         TableElementArgs,
@@ -457,6 +472,7 @@ private:
         float,
         i32,
         i64,
+        u128,
         u8 // Empty state
     > m_arguments;
     // clang-format on
@@ -964,6 +980,12 @@ public:
 
     class Function {
     public:
+        enum class BodyValidationStatus : u8 {
+            Unchecked,
+            Invalid,
+            Valid,
+        };
+
         explicit Function(TypeIndex type, Vector<ValueType> local_types, Expression body)
             : m_type(type)
             , m_local_types(move(local_types))
@@ -974,11 +996,16 @@ public:
         auto& type() const { return m_type; }
         auto& locals() const { return m_local_types; }
         auto& body() const { return m_body; }
+        BodyValidationStatus body_validation_status() const { return m_body_validation_status; }
+        void set_body_validation_status(BodyValidationStatus status, Badge<Validator>) const { m_body_validation_status = status; }
 
     private:
         TypeIndex m_type;
         Vector<ValueType> m_local_types;
         Expression m_body;
+        // Bodies may be validated lazily on a function's first call, so this is
+        // cached validity state rather than part of the function itself.
+        mutable BodyValidationStatus m_body_validation_status { BodyValidationStatus::Unchecked };
     };
 
     using AnySection = Variant<
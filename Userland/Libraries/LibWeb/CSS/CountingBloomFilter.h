@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Assertions.h>
+#include <AK/Types.h>
+
+namespace Web::CSS {
+
+// A counting bloom filter with 2 hash functions taken from the low and high
+// halves of the key. may_contain() can return false positives, but never
+// false negatives, which makes the filter suitable for quickly rejecting
+// selectors that require an ancestor we know isn't there.
+template<typename CounterType, size_t key_bits>
+class CountingBloomFilter {
+public:
+    CountingBloomFilter() = default;
+
+    void increment(u32 key)
+    {
+        ++m_buckets[bucket1(key)];
+        ++m_buckets[bucket2(key)];
+    }
+
+    void decrement(u32 key)
+    {
+        VERIFY(m_buckets[bucket1(key)] > 0);
+        VERIFY(m_buckets[bucket2(key)] > 0);
+        --m_buckets[bucket1(key)];
+        --m_buckets[bucket2(key)];
+    }
+
+    [[nodiscard]] bool may_contain(u32 key) const
+    {
+        return m_buckets[bucket1(key)] && m_buckets[bucket2(key)];
+    }
+
+private:
+    static constexpr u32 bucket_count = 1 << key_bits;
+    static constexpr u32 key_mask = bucket_count - 1;
+
+    [[nodiscard]] static u32 bucket1(u32 key) { return key & key_mask; }
+    [[nodiscard]] static u32 bucket2(u32 key) { return (key >> 16) & key_mask; }
+
+    CounterType m_buckets[bucket_count] {};
+};
+
+}
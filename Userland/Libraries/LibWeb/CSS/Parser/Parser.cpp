@@ -11,6 +11,7 @@
 #include <AK/CharacterTypes.h>
 #include <AK/Debug.h>
 #include <AK/GenericLexer.h>
+#include <AK/HashMap.h>
 #include <AK/NonnullRefPtrVector.h>
 #include <AK/SourceLocation.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
@@ -119,8 +120,18 @@ CSSStyleSheet* Parser::parse_as_css_stylesheet(Optional<AK::URL> location)
     auto style_sheet = parse_a_stylesheet(m_token_stream, {});
 
     // Interpret all of the resulting top-level qualified rules as style rules, defined below.
+    return convert_rules_to_css_stylesheet(move(style_sheet.rules), move(location));
+}
+
+NonnullRefPtrVector<Rule> Parser::parse_as_stylesheet_rules()
+{
+    return parse_a_stylesheet(m_token_stream, {}).rules;
+}
+
+CSSStyleSheet* Parser::convert_rules_to_css_stylesheet(NonnullRefPtrVector<Rule> raw_rules, Optional<AK::URL> location)
+{
     JS::MarkedVector<CSSRule*> rules(m_context.realm().heap());
-    for (auto& raw_rule : style_sheet.rules) {
+    for (auto& raw_rule : raw_rules) {
         auto* rule = convert_to_rule(raw_rule);
         // If any style rule is invalid, or any at-rule is not recognized or is invalid according to its grammar or context, it’s a parse error. Discard that rule.
         if (rule)
@@ -7386,10 +7397,44 @@ TimePercentage Parser::Dimension::time_percentage() const
 
 namespace Web {
 
+// Tokenizing a stylesheet and consuming its rule tree don't depend on the
+// realm or document, so that half of the work is memoized process-wide by
+// content hash: documents that share a large framework stylesheet only pay
+// for the realm-bound CSSRule wrappers on each navigation. Small sheets stay
+// out of the cache; re-parsing them is cheaper than keeping their source
+// around for collision checks.
+struct CachedParsedStyleSheet {
+    DeprecatedString source;
+    NonnullRefPtrVector<CSS::Parser::Rule> rules;
+};
+static constexpr size_t minimum_stylesheet_size_for_caching = 16 * KiB;
+static constexpr size_t maximum_cached_stylesheet_count = 32;
+
 CSS::CSSStyleSheet* parse_css_stylesheet(CSS::Parser::ParsingContext const& context, StringView css, Optional<AK::URL> location)
 {
     if (css.is_empty())
         return CSS::CSSStyleSheet::create(context.realm(), *CSS::CSSRuleList::create_empty(context.realm()), *CSS::MediaList::create(context.realm(), {}), location);
+
+    if (css.length() >= minimum_stylesheet_size_for_caching) {
+        static HashMap<u32, CachedParsedStyleSheet> s_stylesheet_cache;
+
+        auto hash = css.hash();
+        auto it = s_stylesheet_cache.find(hash);
+        if (it != s_stylesheet_cache.end() && it->value.source == css) {
+            CSS::Parser::Parser parser(context, ""sv);
+            return parser.convert_rules_to_css_stylesheet(it->value.rules, move(location));
+        }
+
+        CSS::Parser::Parser parser(context, css);
+        auto rules = parser.parse_as_stylesheet_rules();
+        if (it == s_stylesheet_cache.end()) {
+            if (s_stylesheet_cache.size() >= maximum_cached_stylesheet_count)
+                s_stylesheet_cache.clear();
+            s_stylesheet_cache.set(hash, { css, rules });
+        }
+        return parser.convert_rules_to_css_stylesheet(move(rules), move(location));
+    }
+
     CSS::Parser::Parser parser(context, css);
     return parser.parse_as_css_stylesheet(location);
 }
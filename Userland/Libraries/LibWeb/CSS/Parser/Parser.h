@@ -63,6 +63,12 @@ public:
     ~Parser() = default;
 
     CSSStyleSheet* parse_as_css_stylesheet(Optional<AK::URL> location);
+
+    // The two halves of parse_as_css_stylesheet(), split so that the
+    // realm-independent rule tree can be memoized across documents.
+    NonnullRefPtrVector<Rule> parse_as_stylesheet_rules();
+    CSSStyleSheet* convert_rules_to_css_stylesheet(NonnullRefPtrVector<Rule>, Optional<AK::URL> location);
+
     ElementInlineCSSStyleDeclaration* parse_as_style_attribute(DOM::Element&);
     CSSRule* parse_as_css_rule();
     Optional<StyleProperty> parse_as_supports_condition();
@@ -148,6 +148,67 @@ void StyleComputer::for_each_stylesheet(CascadeOrigin cascade_origin, Callback c
     }
 }
 
+void StyleComputer::push_ancestor(DOM::Element const& element)
+{
+    m_ancestor_filter.increment(element.local_name().hash());
+    if (auto id = element.get_attribute(HTML::AttributeNames::id); !id.is_null())
+        m_ancestor_filter.increment(id.hash());
+    for (auto const& class_name : element.class_names())
+        m_ancestor_filter.increment(class_name.hash());
+    ++m_ancestor_filter_depth;
+}
+
+void StyleComputer::pop_ancestor(DOM::Element const& element)
+{
+    m_ancestor_filter.decrement(element.local_name().hash());
+    if (auto id = element.get_attribute(HTML::AttributeNames::id); !id.is_null())
+        m_ancestor_filter.decrement(id.hash());
+    for (auto const& class_name : element.class_names())
+        m_ancestor_filter.decrement(class_name.hash());
+    --m_ancestor_filter_depth;
+}
+
+bool StyleComputer::should_reject_with_ancestor_filter(Selector const& selector) const
+{
+    // The filter is only valid while the style update traversal is pushing
+    // and popping ancestors around us.
+    if (m_ancestor_filter_depth == 0)
+        return false;
+
+    auto const& compound_selectors = selector.compound_selectors();
+
+    // Walk leftwards from the rightmost compound selector for as long as every
+    // crossed combinator guarantees the compound matches an ancestor of the
+    // current element. If any of those compounds needs an id/class/tag that no
+    // ancestor has, the selector can't possibly match.
+    for (size_t i = compound_selectors.size() - 1; i > 0; --i) {
+        auto combinator = compound_selectors[i].combinator;
+        if (combinator != Selector::Combinator::Descendant && combinator != Selector::Combinator::ImmediateChild)
+            break;
+        for (auto const& simple_selector : compound_selectors[i - 1].simple_selectors) {
+            switch (simple_selector.type) {
+            case Selector::SimpleSelector::Type::Id:
+            case Selector::SimpleSelector::Type::Class:
+                if (!m_ancestor_filter.may_contain(simple_selector.name().hash()))
+                    return true;
+                break;
+            case Selector::SimpleSelector::Type::TagName:
+                // NOTE: Tag names in non-HTML documents match case-insensitively,
+                //       so their hashes can't be compared.
+                if (document().document_type() != DOM::Document::Type::HTML)
+                    break;
+                if (!m_ancestor_filter.may_contain(simple_selector.lowercase_name().hash()))
+                    return true;
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
+    return false;
+}
+
 Vector<MatchingRule> StyleComputer::collect_matching_rules(DOM::Element const& element, CascadeOrigin cascade_origin, Optional<CSS::Selector::PseudoElement> pseudo_element) const
 {
     if (cascade_origin == CascadeOrigin::Author) {
@@ -173,6 +234,8 @@ Vector<MatchingRule> StyleComputer::collect_matching_rules(DOM::Element const& e
         matching_rules.ensure_capacity(rules_to_run.size());
         for (auto const& rule_to_run : rules_to_run) {
             auto const& selector = rule_to_run.rule->selectors()[rule_to_run.selector_index];
+            if (should_reject_with_ancestor_filter(selector))
+                continue;
             if (SelectorEngine::matches(selector, element, pseudo_element))
                 matching_rules.append(rule_to_run);
         }
@@ -186,6 +249,10 @@ Vector<MatchingRule> StyleComputer::collect_matching_rules(DOM::Element const& e
         sheet.for_each_effective_style_rule([&](auto const& rule) {
             size_t selector_index = 0;
             for (auto& selector : rule.selectors()) {
+                if (should_reject_with_ancestor_filter(selector)) {
+                    ++selector_index;
+                    continue;
+                }
                 if (SelectorEngine::matches(selector, element, pseudo_element)) {
                     matching_rules.append({ &rule, style_sheet_index, rule_index, selector_index, selector.specificity() });
                     break;
@@ -1376,6 +1443,26 @@ void StyleComputer::build_rule_cache_if_needed() const
     const_cast<StyleComputer&>(*this).build_rule_cache();
 }
 
+static void collect_class_names_used_in_selector(Selector const& selector, HashTable<DeprecatedFlyString>& class_names)
+{
+    for (auto const& compound_selector : selector.compound_selectors()) {
+        for (auto const& simple_selector : compound_selector.simple_selectors) {
+            if (simple_selector.type == Selector::SimpleSelector::Type::Class)
+                class_names.set(simple_selector.name());
+            else if (simple_selector.type == Selector::SimpleSelector::Type::PseudoClass) {
+                for (auto const& child_selector : simple_selector.pseudo_class().argument_selector_list)
+                    collect_class_names_used_in_selector(child_selector, class_names);
+            }
+        }
+    }
+}
+
+bool StyleComputer::has_style_rules_with_class_name(DeprecatedFlyString const& class_name) const
+{
+    build_rule_cache_if_needed();
+    return m_rule_cache->class_names_used_in_selectors.contains(class_name);
+}
+
 void StyleComputer::build_rule_cache()
 {
     // FIXME: Make a rule cache for UA style as well.
@@ -1396,6 +1483,8 @@ void StyleComputer::build_rule_cache()
             for (CSS::Selector const& selector : rule.selectors()) {
                 MatchingRule matching_rule { &rule, style_sheet_index, rule_index, selector_index, selector.specificity() };
 
+                collect_class_names_used_in_selector(selector, m_rule_cache->class_names_used_in_selectors);
+
                 bool added_to_bucket = false;
                 for (auto const& simple_selector : selector.compound_selectors().last().simple_selectors) {
                     if (simple_selector.type == CSS::Selector::SimpleSelector::Type::PseudoElement) {
@@ -1437,6 +1526,15 @@ void StyleComputer::build_rule_cache()
         ++style_sheet_index;
     });
 
+    // NOTE: Style invalidation consults the set of class names used in selectors,
+    //       so it has to cover every origin, not just author sheets.
+    for_each_stylesheet(CascadeOrigin::UserAgent, [&](auto& sheet) {
+        sheet.for_each_effective_style_rule([&](auto const& rule) {
+            for (CSS::Selector const& selector : rule.selectors())
+                collect_class_names_used_in_selector(selector, m_rule_cache->class_names_used_in_selectors);
+        });
+    });
+
     if constexpr (LIBWEB_CSS_DEBUG) {
         dbgln("Built rule cache!");
         dbgln("           ID: {}", num_id_rules);
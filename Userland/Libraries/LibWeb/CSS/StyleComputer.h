@@ -13,6 +13,7 @@
 #include <AK/OwnPtr.h>
 #include <LibWeb/CSS/CSSFontFaceRule.h>
 #include <LibWeb/CSS/CSSStyleDeclaration.h>
+#include <LibWeb/CSS/CountingBloomFilter.h>
 #include <LibWeb/CSS/Parser/ComponentValue.h>
 #include <LibWeb/CSS/Parser/TokenStream.h>
 #include <LibWeb/CSS/Selector.h>
@@ -69,6 +70,8 @@ public:
 
     Vector<MatchingRule> collect_matching_rules(DOM::Element const&, CascadeOrigin, Optional<CSS::Selector::PseudoElement>) const;
 
+    bool has_style_rules_with_class_name(DeprecatedFlyString const&) const;
+
     void invalidate_rule_cache();
 
     Gfx::Font const& initial_font() const;
@@ -77,7 +80,16 @@ public:
 
     void load_fonts_from_sheet(CSSStyleSheet const&);
 
+    // The ancestor filter is maintained by the style update traversal in
+    // DOM::Document; while it's active, it lets us reject rules that require
+    // an ancestor id/class/tag the current element doesn't have, without
+    // walking the DOM.
+    void push_ancestor(DOM::Element const&);
+    void pop_ancestor(DOM::Element const&);
+
 private:
+    bool should_reject_with_ancestor_filter(Selector const&) const;
+
     ErrorOr<void> compute_cascaded_values(StyleProperties&, DOM::Element&, Optional<CSS::Selector::PseudoElement>) const;
     void compute_font(StyleProperties&, DOM::Element const*, Optional<CSS::Selector::PseudoElement>) const;
     void compute_defaulted_values(StyleProperties&, DOM::Element const*, Optional<CSS::Selector::PseudoElement>) const;
@@ -114,9 +126,13 @@ private:
         HashMap<DeprecatedFlyString, Vector<MatchingRule>> rules_by_tag_name;
         HashMap<Selector::PseudoElement, Vector<MatchingRule>> rules_by_pseudo_element;
         Vector<MatchingRule> other_rules;
+        HashTable<DeprecatedFlyString> class_names_used_in_selectors;
     };
     OwnPtr<RuleCache> m_rule_cache;
 
+    CountingBloomFilter<u8, 14> m_ancestor_filter;
+    size_t m_ancestor_filter_depth { 0 };
+
     class FontLoader;
     HashMap<DeprecatedString, NonnullOwnPtr<FontLoader>> m_loaded_fonts;
 };
@@ -327,6 +327,7 @@ void Document::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_style_sheets.ptr());
     visitor.visit(m_hovered_node.ptr());
     visitor.visit(m_inspected_node.ptr());
+    visitor.visit(m_layout_dirty_node.ptr());
     visitor.visit(m_active_favicon.ptr());
     visitor.visit(m_focused_element.ptr());
     visitor.visit(m_active_element.ptr());
@@ -799,8 +800,22 @@ AK::URL Document::parse_url(DeprecatedString const& url) const
     return base_url().complete_url(url);
 }
 
-void Document::set_needs_layout()
+static Node* find_common_ancestor(Node* a, Node* b);
+
+void Document::set_needs_layout(Node* dirty_node)
 {
+    // NOTE: We keep track of a subtree that contains all the layout mutations since
+    //       the last layout, so update_layout() can attempt a partial relayout.
+    //       Callers that can't point at a specific node dirty the whole document.
+    if (!dirty_node || m_layout_dirty_node.ptr() == this)
+        m_layout_dirty_node = this;
+    else if (!m_layout_dirty_node)
+        m_layout_dirty_node = dirty_node;
+    else if (auto* common_ancestor = find_common_ancestor(m_layout_dirty_node.ptr(), dirty_node))
+        m_layout_dirty_node = common_ancestor;
+    else
+        m_layout_dirty_node = this;
+
     if (m_needs_layout)
         return;
     m_needs_layout = true;
@@ -819,6 +834,119 @@ void Document::invalidate_layout()
     schedule_layout_update();
 }
 
+// A box can serve as a layout boundary if layout inside it can never affect layout
+// outside it: it has a fixed size that doesn't depend on its contents, it establishes
+// its own block formatting context, and overflowing content is clipped.
+static bool is_layout_boundary(Layout::BlockContainer const& box)
+{
+    if (box.is_initial_containing_block_box())
+        return false;
+    if (!box.paint_box())
+        return false;
+    if (!Layout::FormattingContext::creates_block_formatting_context(box))
+        return false;
+    // NOTE: Inline-level boxes contribute a baseline to the line they're on,
+    //       and that depends on their contents.
+    if (!box.display().is_block_outside())
+        return false;
+    auto const& computed_values = box.computed_values();
+    if (computed_values.overflow_x() == CSS::Overflow::Visible || computed_values.overflow_y() == CSS::Overflow::Visible)
+        return false;
+    auto is_fixed_size = [](CSS::Size const& size) {
+        return size.is_length() && !size.contains_percentage();
+    };
+    if (!is_fixed_size(computed_values.width()) || !is_fixed_size(computed_values.height()))
+        return false;
+    if (!computed_values.max_width().is_none() || !computed_values.max_height().is_none())
+        return false;
+    if (!computed_values.min_width().is_auto() || !computed_values.min_height().is_auto())
+        return false;
+    return true;
+}
+
+static Layout::BlockContainer* find_layout_boundary(Node& dirty_node)
+{
+    Layout::Node* dirty_layout_node = nullptr;
+    for (auto* node = &dirty_node; node && !dirty_layout_node; node = node->parent_or_shadow_host())
+        dirty_layout_node = node->layout_node();
+    if (!dirty_layout_node)
+        return nullptr;
+
+    for (auto* ancestor = dirty_layout_node->containing_block(); ancestor; ancestor = ancestor->containing_block()) {
+        if (is_layout_boundary(*ancestor))
+            return ancestor;
+    }
+    return nullptr;
+}
+
+static bool attempt_partial_layout(Document& document, Layout::BlockContainer& boundary)
+{
+    // Bail if anything in the boundary's subtree has its containing block outside the
+    // boundary (e.g. position:fixed) — such boxes are laid out by an ancestor
+    // formatting context.
+    bool subtree_is_self_contained = true;
+    boundary.for_each_in_subtree([&](Layout::Node const& descendant) {
+        auto const* containing_block = descendant.containing_block();
+        if (containing_block && containing_block != &boundary && !boundary.is_ancestor_of(*containing_block)) {
+            subtree_is_self_contained = false;
+            return IterationDecision::Break;
+        }
+        return IterationDecision::Continue;
+    });
+    if (!subtree_is_self_contained)
+        return false;
+
+    Layout::LayoutState layout_state;
+    layout_state.used_values_per_layout_node.resize(document.layout_node_count());
+
+    auto const& paint_box = *boundary.paint_box();
+    auto const& box_model = boundary.box_model();
+
+    // Seed the boundary's state from the previous layout, so committing it again
+    // is a no-op for everything outside its subtree.
+    auto& boundary_state = layout_state.get_mutable(boundary);
+    boundary_state.offset = paint_box.offset();
+    boundary_state.set_content_width(paint_box.content_width());
+    boundary_state.set_content_height(paint_box.content_height());
+    boundary_state.margin_top = box_model.margin.top;
+    boundary_state.margin_right = box_model.margin.right;
+    boundary_state.margin_bottom = box_model.margin.bottom;
+    boundary_state.margin_left = box_model.margin.left;
+    boundary_state.border_top = box_model.border.top;
+    boundary_state.border_right = box_model.border.right;
+    boundary_state.border_bottom = box_model.border.bottom;
+    boundary_state.border_left = box_model.border.left;
+    boundary_state.padding_top = box_model.padding.top;
+    boundary_state.padding_right = box_model.padding.right;
+    boundary_state.padding_bottom = box_model.padding.bottom;
+    boundary_state.padding_left = box_model.padding.left;
+    boundary_state.inset_top = box_model.inset.top;
+    boundary_state.inset_right = box_model.inset.right;
+    boundary_state.inset_bottom = box_model.inset.bottom;
+    boundary_state.inset_left = box_model.inset.left;
+
+    Layout::BlockFormattingContext formatting_context(layout_state, boundary, nullptr);
+    formatting_context.run(
+        boundary,
+        Layout::LayoutMode::Normal,
+        Layout::AvailableSpace(
+            Layout::AvailableSize::make_definite(paint_box.content_width()),
+            Layout::AvailableSize::make_definite(paint_box.content_height())));
+
+    // NOTE: get_mutable() created state for ancestors of the boundary along the way.
+    //       Throw that away so commit() doesn't clobber their still-valid geometry.
+    for (auto& used_values : layout_state.used_values_per_layout_node) {
+        if (!used_values)
+            continue;
+        auto const& node = used_values->node();
+        if (&node != &boundary && !boundary.is_ancestor_of(node))
+            used_values = nullptr;
+    }
+
+    layout_state.commit();
+    return true;
+}
+
 void Document::update_layout()
 {
     // NOTE: If our parent document needs a relayout, we must do that *first*.
@@ -840,6 +968,39 @@ void Document::update_layout()
 
     auto viewport_rect = browsing_context()->viewport_rect();
 
+    // NOTE: Boxes in the dirty subtree may have changed contents, so their cached
+    //       intrinsic sizes (and those of their ancestors, which depend on them)
+    //       can no longer be trusted. Boxes outside the subtree keep theirs.
+    if (m_layout_root && m_layout_dirty_node) {
+        Layout::Node* dirty_layout_node = nullptr;
+        for (auto* node = m_layout_dirty_node.ptr(); node && !dirty_layout_node; node = node->parent_or_shadow_host())
+            dirty_layout_node = node->layout_node();
+        if (!dirty_layout_node)
+            dirty_layout_node = m_layout_root;
+        for (auto* ancestor = dirty_layout_node; ancestor; ancestor = ancestor->parent()) {
+            if (is<Layout::Box>(*ancestor))
+                static_cast<Layout::Box&>(*ancestor).clear_cached_intrinsic_sizes();
+        }
+        dirty_layout_node->for_each_in_subtree_of_type<Layout::Box>([](auto& box) {
+            box.clear_cached_intrinsic_sizes();
+            return IterationDecision::Continue;
+        });
+    }
+
+    // OPTIMIZATION: If all the layout mutations since the last layout are contained
+    //               within a layout boundary, we only need to lay out that subtree.
+    if (m_layout_root && m_layout_dirty_node && m_layout_dirty_node.ptr() != this) {
+        if (auto* boundary = find_layout_boundary(*m_layout_dirty_node); boundary && attempt_partial_layout(*this, *boundary)) {
+            browsing_context()->set_needs_display();
+            m_layout_root->recompute_selection_states();
+            m_needs_layout = false;
+            m_layout_dirty_node = nullptr;
+            m_layout_update_timer->stop();
+            return;
+        }
+    }
+    m_layout_dirty_node = nullptr;
+
     if (!m_layout_root) {
         m_next_layout_node_serial_id = 0;
         Layout::TreeBuilder tree_builder;
@@ -892,6 +1053,9 @@ void Document::update_layout()
 
     if (needs_full_style_update || node.child_needs_style_update()) {
         if (node.is_element()) {
+            // NOTE: While we descend, this node is an ancestor of everything styled
+            //       below it, so it contributes to the style computer's ancestor filter.
+            node.document().style_computer().push_ancestor(static_cast<Element const&>(node));
             if (auto* shadow_root = static_cast<DOM::Element&>(node).shadow_root()) {
                 if (needs_full_style_update || shadow_root->needs_style_update() || shadow_root->child_needs_style_update())
                     needs_relayout |= update_style_recursively(*shadow_root);
@@ -902,6 +1066,8 @@ void Document::update_layout()
                 needs_relayout |= update_style_recursively(child);
             return IterationDecision::Continue;
         });
+        if (node.is_element())
+            node.document().style_computer().pop_ancestor(static_cast<Element const&>(node));
     }
 
     node.set_child_needs_style_update(false);
@@ -189,7 +189,7 @@ public:
     void update_style();
     void update_layout();
 
-    void set_needs_layout();
+    void set_needs_layout(Node* dirty_node = nullptr);
 
     void invalidate_layout();
     void invalidate_stacking_context_tree();
@@ -561,6 +561,11 @@ private:
 
     bool m_needs_layout { false };
 
+    // The common ancestor of everything dirtied since the last layout, if known.
+    // When this is inside a layout boundary, update_layout() can relayout just
+    // that subtree instead of the whole document.
+    JS::GCPtr<Node> m_layout_dirty_node;
+
     bool m_needs_full_style_update { false };
 
     HashTable<NodeIterator*> m_node_iterators;
@@ -115,6 +115,7 @@ WebIDL::ExceptionOr<void> Element::set_attribute(DeprecatedFlyString const& name
 
     // 3. Let attribute be the first attribute in this’s attribute list whose qualified name is qualifiedName, and null otherwise.
     auto* attribute = m_attributes->get_attribute(name);
+    auto old_value = attribute ? attribute->value() : DeprecatedString {};
 
     // 4. If attribute is null, create an attribute whose local name is qualifiedName, value is value, and node document is this’s node document, then append this attribute to this, and then return.
     if (!attribute) {
@@ -131,7 +132,7 @@ WebIDL::ExceptionOr<void> Element::set_attribute(DeprecatedFlyString const& name
 
     parse_attribute(attribute->local_name(), value);
 
-    invalidate_style_after_attribute_change(name);
+    invalidate_style_after_attribute_change(name, old_value, value);
 
     return {};
 }
@@ -194,11 +195,13 @@ WebIDL::ExceptionOr<void> Element::set_attribute_ns(DeprecatedFlyString const& n
 // https://dom.spec.whatwg.org/#dom-element-removeattribute
 void Element::remove_attribute(DeprecatedFlyString const& name)
 {
+    auto old_value = get_attribute(name);
+
     m_attributes->remove_attribute(name);
 
     did_remove_attribute(name);
 
-    invalidate_style_after_attribute_change(name);
+    invalidate_style_after_attribute_change(name, old_value, {});
 }
 
 // https://dom.spec.whatwg.org/#dom-element-hasattribute
@@ -231,7 +234,7 @@ WebIDL::ExceptionOr<bool> Element::toggle_attribute(DeprecatedFlyString const& n
 
             parse_attribute(new_attribute->local_name(), "");
 
-            invalidate_style_after_attribute_change(name);
+            invalidate_style_after_attribute_change(name, {}, "");
 
             return true;
         }
@@ -242,11 +245,13 @@ WebIDL::ExceptionOr<bool> Element::toggle_attribute(DeprecatedFlyString const& n
 
     // 5. Otherwise, if force is not given or is false, remove an attribute given qualifiedName and this, and then return false.
     if (!force.has_value() || !force.value()) {
+        auto old_value = attribute->value();
+
         m_attributes->remove_attribute(name);
 
         did_remove_attribute(name);
 
-        invalidate_style_after_attribute_change(name);
+        invalidate_style_after_attribute_change(name, old_value, {});
     }
 
     // 6. Return true.
@@ -1259,10 +1264,42 @@ ErrorOr<void> Element::scroll_into_view(Optional<Variant<bool, ScrollIntoViewOpt
     // FIXME: 8. Optionally perform some other action that brings the element to the user’s attention.
 }
 
-void Element::invalidate_style_after_attribute_change(DeprecatedFlyString const& attribute_name)
+void Element::invalidate_style_after_attribute_change(DeprecatedFlyString const& attribute_name, DeprecatedString const& old_value, DeprecatedString const& new_value)
 {
     // FIXME: Only invalidate if the attribute can actually affect style.
-    (void)attribute_name;
+
+    // OPTIMIZATION: When the class attribute changes, we only need to invalidate
+    //               style if one of the added or removed classes is actually
+    //               mentioned by a selector in an active style sheet. In quirks
+    //               mode class matching can be case-insensitive, so we don't try
+    //               to be clever there.
+    if (attribute_name == HTML::AttributeNames::class_ && !document().in_quirks_mode()) {
+        auto old_classes = old_value.split_view(Infra::is_ascii_whitespace);
+        auto new_classes = new_value.split_view(Infra::is_ascii_whitespace);
+        auto& style_computer = document().style_computer();
+        auto changed_class_affects_style = [&](StringView class_name, Vector<StringView> const& other_classes) {
+            if (other_classes.contains_slow(class_name))
+                return false;
+            return style_computer.has_style_rules_with_class_name(class_name);
+        };
+        bool needs_invalidation = false;
+        for (auto const& class_name : old_classes) {
+            if (changed_class_affects_style(class_name, new_classes)) {
+                needs_invalidation = true;
+                break;
+            }
+        }
+        for (auto const& class_name : new_classes) {
+            if (needs_invalidation)
+                break;
+            if (changed_class_affects_style(class_name, old_classes)) {
+                needs_invalidation = true;
+                break;
+            }
+        }
+        if (!needs_invalidation)
+            return;
+    }
 
     // FIXME: This will need to become smarter when we implement the :has() selector.
     invalidate_style();
@@ -25,3 +25,24 @@ void FontCache::set(FontSelector const& font_selector, NonnullRefPtr<Gfx::Font>
 {
     m_fonts.set(font_selector, move(font));
 }
+
+float FontCache::text_width(Gfx::Font const& font, Utf8View const& text)
+{
+    if (m_cached_text_width_count >= max_cached_text_widths) {
+        m_text_widths.clear();
+        m_cached_text_width_count = 0;
+    }
+
+    // NOTE: Keying on a strong font reference makes sure a dead font's address can't
+    //       be reused for a different font while the cache still refers to it.
+    auto& widths_for_font = m_text_widths.ensure(font);
+
+    auto key = DeprecatedString { text.as_string() };
+    if (auto width = widths_for_font.get(key); width.has_value())
+        return *width;
+
+    auto width = font.width(text);
+    widths_for_font.set(move(key), width);
+    ++m_cached_text_width_count;
+    return width;
+}
@@ -9,6 +9,7 @@
 #include <AK/DeprecatedFlyString.h>
 #include <AK/DeprecatedString.h>
 #include <AK/HashMap.h>
+#include <AK/Utf8View.h>
 #include <LibGfx/Font/Font.h>
 #include <LibGfx/Forward.h>
 
@@ -37,7 +38,16 @@ public:
     RefPtr<Gfx::Font> get(FontSelector const&) const;
     void set(FontSelector const&, NonnullRefPtr<Gfx::Font>);
 
+    // Measuring a text run walks every glyph and its kerning pairs, and layout
+    // re-measures the same words on every reflow, so we cache widths keyed by
+    // (font, text) across all documents in the process.
+    float text_width(Gfx::Font const&, Utf8View const&);
+
 private:
     FontCache() = default;
     mutable HashMap<FontSelector, NonnullRefPtr<Gfx::Font>> m_fonts;
+
+    static constexpr size_t max_cached_text_widths = 8192;
+    HashMap<NonnullRefPtr<Gfx::Font const>, HashMap<DeprecatedString, float>> m_text_widths;
+    size_t m_cached_text_width_count { 0 };
 };
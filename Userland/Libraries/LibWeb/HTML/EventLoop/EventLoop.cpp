@@ -35,8 +35,11 @@ void EventLoop::schedule()
         });
     }
 
+    // NOTE: If the timer is already armed for the next frame (because the last
+    //       round exhausted its budget), newly queued tasks wait for that
+    //       deadline instead of pulling processing forward.
     if (!m_system_event_loop_timer->is_active())
-        m_system_event_loop_timer->restart();
+        m_system_event_loop_timer->restart(0);
 }
 
 void EventLoop::set_vm(JS::VM& vm)
@@ -100,10 +103,29 @@ void EventLoop::process()
     //    If there is no such task queue, then jump to the microtasks step below.
     auto& task_queue = m_task_queue;
 
-    // 4. Set oldestTask to the first runnable task in taskQueue, and remove it from taskQueue.
-    oldest_task = task_queue.take_first_runnable();
+    // NOTE: Instead of processing one task per wakeup, we drain tasks against this frame's budget:
+    //       a single timer tick runs as many tasks as fit before the rendering update has to start,
+    //       and once the low-priority share of the budget is spent, DOM timers and idle callbacks
+    //       wait for the next frame. This is what keeps animation frame callbacks, style and layout
+    //       on a steady cadence when the task queue is busy.
+    bool frame_budget_exhausted = false;
+    for (;;) {
+        double elapsed_ms = HighResolutionTime::unsafe_shared_current_time() - task_start_time;
+        if (elapsed_ms >= frame_interval_ms) {
+            frame_budget_exhausted = true;
+            break;
+        }
+        bool defer_low_priority_tasks = elapsed_ms >= low_priority_task_budget_ms;
+
+        // 4. Set oldestTask to the first runnable task in taskQueue, and remove it from taskQueue.
+        oldest_task = task_queue.take_first_runnable_matching([&](auto& task) {
+            if (!defer_low_priority_tasks)
+                return true;
+            return task.source() != Task::Source::TimerTask && task.source() != Task::Source::IdleTask;
+        });
+        if (!oldest_task)
+            break;
 
-    if (oldest_task) {
         // 5. Set the event loop's currently running task to oldestTask.
         m_currently_running_task = oldest_task.ptr();
 
@@ -112,9 +134,12 @@ void EventLoop::process()
 
         // 7. Set the event loop's currently running task back to null.
         m_currently_running_task = nullptr;
+
+        // 8. Microtasks: Perform a microtask checkpoint.
+        perform_a_microtask_checkpoint();
     }
 
-    // 8. Microtasks: Perform a microtask checkpoint.
+    // NOTE: Even when no task ran, microtasks queued from outside a task still have to drain.
     perform_a_microtask_checkpoint();
 
     // 9. Let hasARenderingOpportunity be false.
@@ -132,70 +157,80 @@ void EventLoop::process()
 
     // FIXME: 12. Update the rendering: if this is a window event loop, then:
 
-    // FIXME:     1. Let docs be all Document objects whose relevant agent's event loop is this event loop, sorted arbitrarily except that the following conditions must be met:
-    //               - Any Document B whose browsing context's container document is A must be listed after A in the list.
-    //               - If there are two documents A and B whose browsing contexts are both child browsing contexts whose container documents are another Document C, then the order of A and B in the list must match the shadow-including tree order of their respective browsing context containers in C's node tree.
-    // FIXME: NOTE: The sort order specified above is missing here!
-    Vector<JS::Handle<DOM::Document>> docs = documents_in_this_event_loop();
+    // NOTE: Rendering updates are aligned to the frame interval: if we updated the rendering less
+    //       than a frame ago, we skip the update on this wakeup instead of re-running animation
+    //       frame callbacks, style and layout for every task that happens to come in. The timer
+    //       re-arm at the end of this function brings us back exactly when the next frame is due.
+    double now = HighResolutionTime::unsafe_shared_current_time();
+    bool rendering_update_is_due = now - m_last_rendering_update_time >= frame_interval_ms;
+    if (rendering_update_is_due) {
+        m_last_rendering_update_time = now;
+
+        // FIXME:     1. Let docs be all Document objects whose relevant agent's event loop is this event loop, sorted arbitrarily except that the following conditions must be met:
+        //               - Any Document B whose browsing context's container document is A must be listed after A in the list.
+        //               - If there are two documents A and B whose browsing contexts are both child browsing contexts whose container documents are another Document C, then the order of A and B in the list must match the shadow-including tree order of their respective browsing context containers in C's node tree.
+        // FIXME: NOTE: The sort order specified above is missing here!
+        Vector<JS::Handle<DOM::Document>> docs = documents_in_this_event_loop();
+
+        auto for_each_fully_active_document_in_docs = [&](auto&& callback) {
+            for (auto& document : docs) {
+                if (document->is_fully_active())
+                    callback(*document);
+            }
+        };
+
+        // 2. Rendering opportunities: Remove from docs all Document objects whose browsing context do not have a rendering opportunity.
+        docs.remove_all_matching([&](auto& document) {
+            return document->browsing_context() && !document->browsing_context()->has_a_rendering_opportunity();
+        });
 
-    auto for_each_fully_active_document_in_docs = [&](auto&& callback) {
-        for (auto& document : docs) {
-            if (document->is_fully_active())
-                callback(*document);
+        // 3. If docs is not empty, then set hasARenderingOpportunity to true
+        //    and set this event loop's last render opportunity time to taskStartTime.
+        if (!docs.is_empty()) {
+            has_a_rendering_opportunity = true;
+            m_last_render_opportunity_time = task_start_time;
         }
-    };
-
-    // 2. Rendering opportunities: Remove from docs all Document objects whose browsing context do not have a rendering opportunity.
-    docs.remove_all_matching([&](auto& document) {
-        return document->browsing_context() && !document->browsing_context()->has_a_rendering_opportunity();
-    });
-
-    // 3. If docs is not empty, then set hasARenderingOpportunity to true
-    //    and set this event loop's last render opportunity time to taskStartTime.
-    if (!docs.is_empty()) {
-        has_a_rendering_opportunity = true;
-        m_last_render_opportunity_time = task_start_time;
-    }
 
-    // FIXME:     4. Unnecessary rendering: Remove from docs all Document objects which meet both of the following conditions:
-    //               - The user agent believes that updating the rendering of the Document's browsing context would have no visible effect, and
-    //               - The Document's map of animation frame callbacks is empty.
+        // FIXME:     4. Unnecessary rendering: Remove from docs all Document objects which meet both of the following conditions:
+        //               - The user agent believes that updating the rendering of the Document's browsing context would have no visible effect, and
+        //               - The Document's map of animation frame callbacks is empty.
 
-    // FIXME:     5. Remove from docs all Document objects for which the user agent believes that it's preferable to skip updating the rendering for other reasons.
+        // FIXME:     5. Remove from docs all Document objects for which the user agent believes that it's preferable to skip updating the rendering for other reasons.
 
-    // FIXME:     6. For each fully active Document in docs, flush autofocus candidates for that Document if its browsing context is a top-level browsing context.
+        // FIXME:     6. For each fully active Document in docs, flush autofocus candidates for that Document if its browsing context is a top-level browsing context.
 
-    // 7. For each fully active Document in docs, run the resize steps for that Document, passing in now as the timestamp. [CSSOMVIEW]
-    for_each_fully_active_document_in_docs([&](DOM::Document& document) {
-        document.run_the_resize_steps();
-    });
+        // 7. For each fully active Document in docs, run the resize steps for that Document, passing in now as the timestamp. [CSSOMVIEW]
+        for_each_fully_active_document_in_docs([&](DOM::Document& document) {
+            document.run_the_resize_steps();
+        });
 
-    // 8. For each fully active Document in docs, run the scroll steps for that Document, passing in now as the timestamp. [CSSOMVIEW]
-    for_each_fully_active_document_in_docs([&](DOM::Document& document) {
-        document.run_the_scroll_steps();
-    });
+        // 8. For each fully active Document in docs, run the scroll steps for that Document, passing in now as the timestamp. [CSSOMVIEW]
+        for_each_fully_active_document_in_docs([&](DOM::Document& document) {
+            document.run_the_scroll_steps();
+        });
 
-    // 9. For each fully active Document in docs, evaluate media queries and report changes for that Document, passing in now as the timestamp. [CSSOMVIEW]
-    for_each_fully_active_document_in_docs([&](DOM::Document& document) {
-        document.evaluate_media_queries_and_report_changes();
-    });
+        // 9. For each fully active Document in docs, evaluate media queries and report changes for that Document, passing in now as the timestamp. [CSSOMVIEW]
+        for_each_fully_active_document_in_docs([&](DOM::Document& document) {
+            document.evaluate_media_queries_and_report_changes();
+        });
 
-    // FIXME:     10. For each fully active Document in docs, update animations and send events for that Document, passing in now as the timestamp. [WEBANIMATIONS]
+        // FIXME:     10. For each fully active Document in docs, update animations and send events for that Document, passing in now as the timestamp. [WEBANIMATIONS]
 
-    // FIXME:     11. For each fully active Document in docs, run the fullscreen steps for that Document, passing in now as the timestamp. [FULLSCREEN]
+        // FIXME:     11. For each fully active Document in docs, run the fullscreen steps for that Document, passing in now as the timestamp. [FULLSCREEN]
 
-    // FIXME:     12. For each fully active Document in docs, if the user agent detects that the backing storage associated with a CanvasRenderingContext2D or an OffscreenCanvasRenderingContext2D, context, has been lost, then it must run the context lost steps for each such context:
+        // FIXME:     12. For each fully active Document in docs, if the user agent detects that the backing storage associated with a CanvasRenderingContext2D or an OffscreenCanvasRenderingContext2D, context, has been lost, then it must run the context lost steps for each such context:
 
-    // FIXME:     13. For each fully active Document in docs, run the animation frame callbacks for that Document, passing in now as the timestamp.
-    for_each_fully_active_document_in_docs([&](DOM::Document& document) {
-        run_animation_frame_callbacks(document, document.window().performance().now());
-    });
+        // FIXME:     13. For each fully active Document in docs, run the animation frame callbacks for that Document, passing in now as the timestamp.
+        for_each_fully_active_document_in_docs([&](DOM::Document& document) {
+            run_animation_frame_callbacks(document, document.window().performance().now());
+        });
 
-    // FIXME:     14. For each fully active Document in docs, run the update intersection observations steps for that Document, passing in now as the timestamp. [INTERSECTIONOBSERVER]
+        // FIXME:     14. For each fully active Document in docs, run the update intersection observations steps for that Document, passing in now as the timestamp. [INTERSECTIONOBSERVER]
 
-    // FIXME:     15. Invoke the mark paint timing algorithm for each Document object in docs.
+        // FIXME:     15. Invoke the mark paint timing algorithm for each Document object in docs.
 
-    // FIXME:     16. For each fully active Document in docs, update the rendering or user interface of that Document and its browsing context to reflect the current state.
+        // FIXME:     16. For each fully active Document in docs, update the rendering or user interface of that Document and its browsing context to reflect the current state.
+    }
 
     // 13. If all of the following are true
     // - this is a window event loop
@@ -226,8 +261,14 @@ void EventLoop::process()
     // FIXME:     2. If there are no tasks in the event loop's task queues and the WorkerGlobalScope object's closing flag is true, then destroy the event loop, aborting these steps, resuming the run a worker steps described in the Web workers section below.
 
     // If there are tasks in the queue, schedule a new round of processing. :^)
-    if (m_task_queue.has_runnable_tasks() || !m_microtask_queue.is_empty())
+    if (frame_budget_exhausted && m_system_event_loop_timer) {
+        // The leftover tasks wait until the next frame is due, so one overloaded
+        // frame can't also eat into the following one.
+        double next_frame_due_in_ms = frame_interval_ms - (HighResolutionTime::unsafe_shared_current_time() - m_last_rendering_update_time);
+        m_system_event_loop_timer->restart(max(1, static_cast<int>(next_frame_due_in_ms)));
+    } else if (m_task_queue.has_runnable_tasks() || !m_microtask_queue.is_empty()) {
         schedule();
+    }
 }
 
 // FIXME: This is here to paper over an issue in the HTML parser where it'll create new interpreters (and thus ESOs) on temporary documents created for innerHTML if it uses Document::realm() to get the global object.
@@ -78,6 +78,14 @@ public:
     bool execution_paused() const { return m_execution_paused; }
 
 private:
+    // Frame scheduling: one wakeup of the system event loop timer runs tasks
+    // against a 60 Hz frame budget. Low-priority work (DOM timers and idle
+    // callbacks) is only taken while its share of the budget remains, so the
+    // tail of the frame stays reserved for the rendering update (animation
+    // frame callbacks, style and layout).
+    static constexpr double frame_interval_ms = 1000.0 / 60.0;
+    static constexpr double low_priority_task_budget_ms = frame_interval_ms / 2;
+
     Type m_type { Type::Window };
 
     TaskQueue m_task_queue;
@@ -88,6 +96,9 @@ private:
 
     // https://html.spec.whatwg.org/multipage/webappapis.html#last-render-opportunity-time
     double m_last_render_opportunity_time { 0 };
+    // When we last ran the "update the rendering" steps; used to throttle them
+    // to one run per frame interval.
+    double m_last_rendering_update_time { 0 };
     // https://html.spec.whatwg.org/multipage/webappapis.html#last-idle-period-start-time
     double m_last_idle_period_start_time { 0 };
 
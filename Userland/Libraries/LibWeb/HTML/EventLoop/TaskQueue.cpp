@@ -34,6 +34,18 @@ OwnPtr<Task> TaskQueue::take_first_runnable()
     return nullptr;
 }
 
+OwnPtr<Task> TaskQueue::take_first_runnable_matching(Function<bool(Task const&)> filter)
+{
+    if (m_event_loop.execution_paused())
+        return nullptr;
+
+    for (size_t i = 0; i < m_tasks.size(); ++i) {
+        if (m_tasks[i]->is_runnable() && filter(*m_tasks[i]))
+            return m_tasks.take(i);
+    }
+    return nullptr;
+}
+
 bool TaskQueue::has_runnable_tasks() const
 {
     if (m_event_loop.execution_paused())
@@ -22,6 +22,7 @@ public:
 
     void add(NonnullOwnPtr<HTML::Task>);
     OwnPtr<HTML::Task> take_first_runnable();
+    OwnPtr<HTML::Task> take_first_runnable_matching(Function<bool(HTML::Task const&)>);
 
     void enqueue(NonnullOwnPtr<HTML::Task> task) { add(move(task)); }
     OwnPtr<HTML::Task> dequeue()
@@ -25,7 +25,7 @@ HTMLImageElement::HTMLImageElement(DOM::Document& document, DOM::QualifiedName q
 {
     m_image_loader.on_load = [this] {
         set_needs_style_update(true);
-        this->document().set_needs_layout();
+        this->document().set_needs_layout(this);
         queue_an_element_task(HTML::Task::Source::DOMManipulation, [this] {
             dispatch_event(*DOM::Event::create(this->realm(), EventNames::load));
         });
@@ -34,7 +34,7 @@ HTMLImageElement::HTMLImageElement(DOM::Document& document, DOM::QualifiedName q
     m_image_loader.on_fail = [this] {
         dbgln("HTMLImageElement: Resource did fail: {}", src());
         set_needs_style_update(true);
-        this->document().set_needs_layout();
+        this->document().set_needs_layout(this);
         queue_an_element_task(HTML::Task::Source::DOMManipulation, [this] {
             dispatch_event(*DOM::Event::create(this->realm(), EventNames::error));
         });
@@ -338,7 +338,7 @@ void HTMLObjectElement::update_layout_and_child_objects(Representation represent
 
     m_representation = representation;
     set_needs_style_update(true);
-    document().set_needs_layout();
+    document().set_needs_layout(this);
 }
 
 // https://html.spec.whatwg.org/multipage/interaction.html#dom-tabindex
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/HTML/AttributeNames.h>
+#include <LibWeb/HTML/Parser/HTMLPreloadScanner.h>
+#include <LibWeb/HTML/Parser/HTMLTokenizer.h>
+#include <LibWeb/Infra/CharacterTypes.h>
+#include <LibWeb/Loader/ResourceLoader.h>
+
+namespace Web::HTML {
+
+void HTMLPreloadScanner::scan(DOM::Document& document, StringView remaining_input)
+{
+    HTMLTokenizer tokenizer { remaining_input, "utf-8" };
+
+    while (auto token = tokenizer.next_token()) {
+        if (token->is_end_of_file())
+            break;
+        if (!token->is_start_tag())
+            continue;
+
+        auto const& tag_name = token->tag_name();
+
+        // NOTE: Without a tree builder driving it, the tokenizer doesn't know that these
+        //       elements have raw text content, so we have to switch its state ourselves.
+        if (tag_name == TagNames::script)
+            tokenizer.switch_to(HTMLTokenizer::State::ScriptData);
+        else if (tag_name.is_one_of(TagNames::style, TagNames::xmp, TagNames::iframe, TagNames::noembed, TagNames::noframes, TagNames::noscript))
+            tokenizer.switch_to(HTMLTokenizer::State::RAWTEXT);
+        else if (tag_name.is_one_of(TagNames::title, TagNames::textarea))
+            tokenizer.switch_to(HTMLTokenizer::State::RCDATA);
+
+        if (tag_name.is_one_of(TagNames::script, TagNames::img)) {
+            auto src = token->attribute(AttributeNames::src);
+            if (!src.is_empty())
+                preload_url(document, document.parse_url(src), tag_name == TagNames::img ? Resource::Type::Image : Resource::Type::Generic);
+        } else if (tag_name == TagNames::link) {
+            // NOTE: Only relations that unconditionally cause a fetch are worth speculating on.
+            bool is_preloadable_relation = false;
+            for (auto const& keyword : token->attribute(AttributeNames::rel).split_view_if([](char ch) { return Infra::is_ascii_whitespace(ch); })) {
+                if (keyword.equals_ignoring_case("stylesheet"sv) || keyword.equals_ignoring_case("preload"sv)) {
+                    is_preloadable_relation = true;
+                    break;
+                }
+            }
+            if (is_preloadable_relation) {
+                auto href = token->attribute(AttributeNames::href);
+                if (!href.is_empty())
+                    preload_url(document, document.parse_url(href), Resource::Type::Generic);
+            }
+        }
+    }
+}
+
+void HTMLPreloadScanner::preload_url(DOM::Document& document, AK::URL const& url, Resource::Type type)
+{
+    if (!url.is_valid())
+        return;
+    if (m_already_preloaded_urls.set(url.to_deprecated_string()) != AK::HashSetResult::InsertedNewEntry)
+        return;
+    auto request = LoadRequest::create_for_url_on_page(url, document.page());
+    if (auto resource = ResourceLoader::the().load_resource(type, request))
+        m_preloaded_resources.append(resource.release_nonnull());
+}
+
+}
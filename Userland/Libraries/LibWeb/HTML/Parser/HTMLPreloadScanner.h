@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashTable.h>
+#include <AK/Vector.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/Loader/Resource.h>
+
+namespace Web::HTML {
+
+// A poor man's speculative HTML parser: while the parser is blocked on a script,
+// this tokenizes the not-yet-parsed remainder of the input and starts fetching
+// any subresources it finds, so the network is kept busy in the meantime.
+class HTMLPreloadScanner {
+public:
+    HTMLPreloadScanner() = default;
+
+    void scan(DOM::Document&, StringView remaining_input);
+
+private:
+    void preload_url(DOM::Document&, AK::URL const&, Resource::Type);
+
+    HashTable<DeprecatedString> m_already_preloaded_urls;
+    Vector<NonnullRefPtr<Resource>> m_preloaded_resources;
+};
+
+}
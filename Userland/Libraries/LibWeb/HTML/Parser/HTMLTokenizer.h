@@ -125,6 +125,9 @@ public:
 
     DeprecatedString source() const { return m_decoded_input; }
 
+    // Everything after the tokenizer's current position in the input stream.
+    StringView remaining_source() const { return m_decoded_input.substring_view(m_utf8_view.iterator_offset(m_utf8_iterator)); }
+
     void insert_input_at_insertion_point(DeprecatedString const& input);
     void insert_eof();
     bool is_eof_inserted();
@@ -46,6 +46,10 @@ JS::NonnullGCPtr<ClassicScript> ClassicScript::create(DeprecatedString filename,
     // NOTE: Error to rethrow was set to null in the construction of ClassicScript. We do not have parse error as it would currently go unused.
 
     // 10. Let result be ParseScript(source, settings's Realm, script).
+    // NOTE: It would be nice to move this parse off the main thread for large bundles, but that
+    //       is currently not possible: JS::Script::parse() allocates cells in the realm's heap,
+    //       the AST uses non-atomic RefPtrs, and identifiers are interned through the global
+    //       DeprecatedFlyString table, all of which the main thread uses concurrently.
     auto parse_timer = Core::ElapsedTimer::start_new();
     auto result = JS::Script::parse(source, environment_settings_object.realm(), script->filename(), script, source_line_number);
     dbgln_if(HTML_SCRIPT_DEBUG, "ClassicScript: Parsed {} in {}ms", script->filename(), parse_timer.elapsed());
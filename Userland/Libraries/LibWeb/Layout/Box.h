@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
 #include <AK/OwnPtr.h>
 #include <LibGfx/Rect.h>
 #include <LibWeb/Layout/Node.h>
@@ -41,12 +42,41 @@ public:
 
     virtual JS::GCPtr<Painting::Paintable> create_paintable() const override;
 
+    // We cache intrinsic (min-content/max-content) sizes once determined, since computing
+    // them runs a whole throwaway layout of this box's subtree. They only depend on the
+    // box's style and contents: style changes rebuild the layout tree, and content changes
+    // clear the dirty subtree's caches before the next layout, so cached values stay valid
+    // both within a layout pass and across passes.
+    struct CachedIntrinsicSizes {
+        Optional<CSSPixels> min_content_width;
+        Optional<CSSPixels> max_content_width;
+
+        // NOTE: Since intrinsic heights depend on the amount of available width, we have to cache
+        //       three separate kinds of results, depending on the available width at the time of calculation.
+        HashMap<CSSPixels, Optional<CSSPixels>> min_content_height_with_definite_available_width;
+        HashMap<CSSPixels, Optional<CSSPixels>> max_content_height_with_definite_available_width;
+        Optional<CSSPixels> min_content_height_with_min_content_available_width;
+        Optional<CSSPixels> max_content_height_with_min_content_available_width;
+        Optional<CSSPixels> min_content_height_with_max_content_available_width;
+        Optional<CSSPixels> max_content_height_with_max_content_available_width;
+    };
+
+    CachedIntrinsicSizes& cached_intrinsic_sizes() const
+    {
+        if (!m_cached_intrinsic_sizes)
+            m_cached_intrinsic_sizes = make<CachedIntrinsicSizes>();
+        return *m_cached_intrinsic_sizes;
+    }
+    void clear_cached_intrinsic_sizes() const { m_cached_intrinsic_sizes = nullptr; }
+
 protected:
     Box(DOM::Document&, DOM::Node*, NonnullRefPtr<CSS::StyleProperties>);
     Box(DOM::Document&, DOM::Node*, CSS::ComputedValues);
 
 private:
     virtual bool is_box() const final { return true; }
+
+    OwnPtr<CachedIntrinsicSizes> mutable m_cached_intrinsic_sizes;
 };
 
 template<>
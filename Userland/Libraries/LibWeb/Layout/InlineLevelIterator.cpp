@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibWeb/FontCache.h>
 #include <LibWeb/Layout/BreakNode.h>
 #include <LibWeb/Layout/InlineFormattingContext.h>
 #include <LibWeb/Layout/InlineLevelIterator.h>
@@ -144,7 +145,7 @@ Optional<InlineLevelIterator::Item> InlineLevelIterator::next(CSSPixels availabl
             m_text_node_context->is_last_chunk = true;
 
         auto& chunk = chunk_opt.value();
-        CSSPixels chunk_width = text_node.font().width(chunk.view) + text_node.font().glyph_spacing();
+        CSSPixels chunk_width = FontCache::the().text_width(text_node.font(), chunk.view) + text_node.font().glyph_spacing();
 
         if (m_text_node_context->do_respect_linebreaks && chunk.has_breaking_newline) {
             return Item {
@@ -323,6 +323,63 @@ void FrameLoader::load_html(StringView html, const AK::URL& url)
     parser->run(url);
 }
 
+void FrameLoader::cache_outgoing_document()
+{
+    auto* document = browsing_context().active_document();
+    if (!document)
+        return;
+    // Only fully loaded documents are worth restoring; a half-parsed document
+    // would come back in whatever state the aborted load left it in.
+    if (document->ready_state() != "complete"sv)
+        return;
+    if (!document->url().is_valid() || document->url().scheme() == "about")
+        return;
+
+    m_cached_documents.remove_all_matching([&](auto& entry) {
+        return entry.url == document->url();
+    });
+    if (m_cached_documents.size() >= max_cached_documents)
+        m_cached_documents.take_first();
+    m_cached_documents.append({ document->url(), JS::make_handle(*document), browsing_context().viewport_rect().size() });
+}
+
+bool FrameLoader::load_cached_document(const AK::URL& url)
+{
+    for (size_t i = 0; i < m_cached_documents.size(); ++i) {
+        if (m_cached_documents[i].url != url)
+            continue;
+
+        auto cached = m_cached_documents.take(i);
+        JS::NonnullGCPtr<DOM::Document> document = *cached.document.cell();
+
+        // Cache the document we're leaving so traversing back here is instant too.
+        cache_outgoing_document();
+
+        browsing_context().set_active_document(document);
+        if (auto* page = browsing_context().page())
+            page->client().page_did_create_main_document();
+
+        // If the view was resized while the document sat in the cache, its
+        // layout is for the old viewport and has to be redone after all.
+        if (browsing_context().viewport_rect().size() != cached.viewport_size) {
+            document->invalidate_style();
+            document->invalidate_layout();
+        }
+
+        if (!url.fragment().is_empty())
+            browsing_context().scroll_to_anchor(url.fragment());
+        else
+            browsing_context().scroll_to({ 0, 0 });
+
+        browsing_context().set_needs_display();
+
+        if (auto* page = browsing_context().page())
+            page->client().page_did_finish_loading(url);
+        return true;
+    }
+    return false;
+}
+
 static DeprecatedString s_error_page_url = "file:///res/html/error.html";
 
 void FrameLoader::set_error_page_url(DeprecatedString error_page_url)
@@ -422,6 +479,7 @@ void FrameLoader::resource_did_load()
     document->set_encoding(resource()->encoding());
     document->set_content_type(resource()->mime_type());
 
+    cache_outgoing_document();
     browsing_context().set_active_document(document);
     if (auto* page = browsing_context().page())
         page->client().page_did_create_main_document();
@@ -7,8 +7,11 @@
 #pragma once
 
 #include <AK/Forward.h>
+#include <AK/Vector.h>
+#include <LibJS/Heap/Handle.h>
 #include <LibWeb/Forward.h>
 #include <LibWeb/Loader/Resource.h>
+#include <LibWeb/PixelUnits.h>
 
 namespace Web {
 
@@ -35,6 +38,11 @@ public:
 
     void load_html(StringView, const AK::URL&);
 
+    // Reinstalls a previously shown document for this URL from the
+    // back/forward cache, skipping fetch, parse, style and layout entirely.
+    // Returns false if we don't have one and the caller has to do a real load.
+    bool load_cached_document(const AK::URL&);
+
     HTML::BrowsingContext& browsing_context() { return m_browsing_context; }
     HTML::BrowsingContext const& browsing_context() const { return m_browsing_context; }
 
@@ -47,7 +55,21 @@ private:
     void load_favicon(RefPtr<Gfx::Bitmap> bitmap = nullptr);
     bool parse_document(DOM::Document&, ByteBuffer const& data);
 
+    void cache_outgoing_document();
+
+    // Back/forward cache: the last few documents we navigated away from, kept
+    // alive (DOM, JS realm and layout tree included) so history traversal can
+    // bring them back instantly. The handle also keeps the document's heap
+    // cells from being garbage collected while it's cached.
+    struct CachedDocument {
+        AK::URL url;
+        JS::Handle<DOM::Document> document;
+        CSSPixelSize viewport_size;
+    };
+    static constexpr size_t max_cached_documents = 3;
+
     HTML::BrowsingContext& m_browsing_context;
+    Vector<CachedDocument, max_cached_documents> m_cached_documents;
     size_t m_redirects_count { 0 };
 };
 
@@ -162,4 +162,11 @@ Gfx::Bitmap const* ImageLoader::bitmap(size_t frame_index) const
     return resource()->bitmap(frame_index);
 }
 
+Gfx::Bitmap const* ImageLoader::scaled_bitmap(size_t frame_index, Gfx::IntSize target_size) const
+{
+    if (!resource())
+        return nullptr;
+    return resource()->scaled_bitmap(frame_index, target_size);
+}
+
 }
@@ -21,6 +21,7 @@ public:
     void load(const AK::URL&);
 
     Gfx::Bitmap const* bitmap(size_t index) const;
+    Gfx::Bitmap const* scaled_bitmap(size_t index, Gfx::IntSize target_size) const;
     size_t current_frame_index() const { return m_current_frame_index; }
 
     bool has_image() const;
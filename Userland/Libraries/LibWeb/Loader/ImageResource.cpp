@@ -73,6 +73,42 @@ Gfx::Bitmap const* ImageResource::bitmap(size_t frame_index) const
     return m_decoded_frames[frame_index].bitmap;
 }
 
+Gfx::Bitmap const* ImageResource::scaled_bitmap(size_t frame_index, Gfx::IntSize target_size) const
+{
+    auto const* natural_bitmap = bitmap(frame_index);
+    if (!natural_bitmap)
+        return nullptr;
+
+    // NOTE: Animations cycle through their frames too quickly for cached downscales to pay off.
+    if (m_animated || target_size.is_empty())
+        return natural_bitmap;
+
+    // Pick the smallest power-of-two downscale that still covers the target size.
+    int level = 0;
+    auto level_size = natural_bitmap->size();
+    while (level_size.width() / 2 >= target_size.width() && level_size.height() / 2 >= target_size.height()) {
+        level_size = { level_size.width() / 2, level_size.height() / 2 };
+        ++level;
+    }
+    if (level == 0)
+        return natural_bitmap;
+
+    auto cache_key = (static_cast<u64>(frame_index) << 32) | static_cast<u32>(level);
+    if (auto it = m_scaled_bitmap_cache.find(cache_key); it != m_scaled_bitmap_cache.end())
+        return it->value;
+
+    auto scaled_or_error = natural_bitmap->scaled(
+        static_cast<float>(level_size.width()) / natural_bitmap->width(),
+        static_cast<float>(level_size.height()) / natural_bitmap->height());
+    if (scaled_or_error.is_error())
+        return natural_bitmap;
+
+    auto scaled = scaled_or_error.release_value();
+    auto const* scaled_ptr = scaled.ptr();
+    m_scaled_bitmap_cache.set(cache_key, move(scaled));
+    return scaled_ptr;
+}
+
 void ImageResource::update_volatility()
 {
     bool visible_in_viewport = false;
@@ -82,6 +118,9 @@ void ImageResource::update_volatility()
     });
 
     if (!visible_in_viewport) {
+        // NOTE: Downscales are cheap to rebuild from the natural-size bitmap, so we
+        //       drop them outright instead of just marking them volatile.
+        m_scaled_bitmap_cache.clear();
         for (auto& frame : m_decoded_frames) {
             if (frame.bitmap)
                 frame.bitmap->set_volatile();
@@ -104,6 +143,7 @@ void ImageResource::update_volatility()
         return;
 
     m_decoded_frames.clear();
+    m_scaled_bitmap_cache.clear();
     m_has_attempted_decode = false;
 }
 
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <LibGfx/Size.h>
 #include <LibWeb/Loader/Resource.h>
 
 namespace Web {
@@ -24,6 +25,13 @@ public:
     };
 
     Gfx::Bitmap const* bitmap(size_t frame_index = 0) const;
+
+    // Returns a cached downscale of the given frame suitable for painting at target_size.
+    // Downscales are kept per power-of-two level, mipmap-style, so nearby paint sizes
+    // share one bitmap. Falls back to the natural-size bitmap when no downscale is
+    // worthwhile (upscales, animations).
+    Gfx::Bitmap const* scaled_bitmap(size_t frame_index, Gfx::IntSize target_size) const;
+
     int frame_duration(size_t frame_index) const;
     size_t frame_count() const
     {
@@ -53,6 +61,7 @@ private:
     mutable int m_loop_count { 0 };
     mutable Vector<Frame> m_decoded_frames;
     mutable bool m_has_attempted_decode { false };
+    mutable HashMap<u64, NonnullRefPtr<Gfx::Bitmap>> m_scaled_bitmap_cache;
 };
 
 class ImageResourceClient : public ResourceClient {
@@ -10,6 +10,7 @@
 #include <AK/JsonObject.h>
 #include <LibCore/ElapsedTimer.h>
 #include <LibCore/File.h>
+#include <LibCore/Stream.h>
 #include <LibWeb/Cookie/Cookie.h>
 #include <LibWeb/Cookie/ParsedCookie.h>
 #include <LibWeb/Loader/ContentFilter.h>
@@ -356,6 +357,138 @@ void ResourceLoader::load(LoadRequest& request, Function<void(ReadonlyBytes, Has
         error_callback(not_implemented_error, {});
 }
 
+// The connector delivers streamed payloads by writing into a Core::Stream. This sink
+// forwards every write straight to a callback, so data reaches the consumer as soon as
+// it arrives instead of accumulating in memory first. The connector reads from the
+// request server in bounded chunks, so the pipe between the two processes is what
+// provides the backpressure.
+class UnbufferedRequestStreamSink final : public Core::Stream::Stream {
+public:
+    explicit UnbufferedRequestStreamSink(Function<void(ReadonlyBytes)> on_data_received)
+        : m_on_data_received(move(on_data_received))
+    {
+    }
+
+    virtual ErrorOr<Bytes> read(Bytes) override { return Error::from_errno(EBADF); }
+
+    virtual ErrorOr<size_t> write(ReadonlyBytes bytes) override
+    {
+        if (m_on_data_received)
+            m_on_data_received(bytes);
+        return bytes.size();
+    }
+
+    virtual bool is_eof() const override { return false; }
+    virtual bool is_open() const override { return true; }
+    virtual void close() override { }
+
+private:
+    Function<void(ReadonlyBytes)> m_on_data_received;
+};
+
+void ResourceLoader::load_unbuffered(LoadRequest& request, Function<void(HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> const& response_headers, Optional<u32> status_code)> on_headers_received, Function<void(ReadonlyBytes chunk)> on_data_received, Function<void(bool success, Optional<DeprecatedString> error_message)> on_complete)
+{
+    auto& url = request.url();
+    request.start_timer();
+
+    auto id = resource_id++;
+    auto url_for_logging = sanitized_url_for_logging(url);
+    emit_signpost(DeprecatedString::formatted("Starting unbuffered load: {}", url_for_logging), id);
+    dbgln("ResourceLoader: Starting unbuffered load of: \"{}\"", url_for_logging);
+
+    auto const log_success = [url_for_logging, id](auto const& request) {
+        auto load_time_ms = request.load_time().to_milliseconds();
+        emit_signpost(DeprecatedString::formatted("Finished unbuffered load: {}", url_for_logging), id);
+        dbgln("ResourceLoader: Finished unbuffered load of: \"{}\", Duration: {}ms", url_for_logging, load_time_ms);
+    };
+
+    auto const log_failure = [url_for_logging, id](auto const& request, auto const error_message) {
+        auto load_time_ms = request.load_time().to_milliseconds();
+        emit_signpost(DeprecatedString::formatted("Failed unbuffered load: {}", url_for_logging), id);
+        dbgln("ResourceLoader: Failed unbuffered load of: \"{}\", \033[31;1mError: {}\033[0m, Duration: {}ms", url_for_logging, error_message, load_time_ms);
+    };
+
+    if (is_port_blocked(url.port_or_default())) {
+        auto error_message = DeprecatedString::formatted("The port #{} is blocked", url.port_or_default());
+        log_failure(request, error_message);
+        on_complete(false, error_message);
+        return;
+    }
+
+    if (ContentFilter::the().is_filtered(url)) {
+        auto filter_message = "URL was filtered"sv;
+        log_failure(request, filter_message);
+        on_complete(false, filter_message);
+        return;
+    }
+
+    if (url.scheme() != "http" && url.scheme() != "https" && url.scheme() != "gemini") {
+        auto not_implemented_error = DeprecatedString::formatted("Unbuffered loading not implemented for protocol: {}", url.scheme());
+        log_failure(request, not_implemented_error);
+        on_complete(false, not_implemented_error);
+        return;
+    }
+
+    auto proxy = ProxyMappings::the().proxy_for_url(url);
+
+    HashMap<DeprecatedString, DeprecatedString> headers;
+    headers.set("User-Agent", m_user_agent);
+    headers.set("Accept-Encoding", "gzip, deflate, br");
+
+    for (auto& it : request.headers())
+        headers.set(it.key, it.value);
+
+    auto protocol_request = m_connector->start_request(request.method(), url, headers, request.body(), proxy);
+    if (!protocol_request) {
+        auto start_request_failure_msg = "Failed to initiate load"sv;
+        log_failure(request, start_request_failure_msg);
+        on_complete(false, start_request_failure_msg);
+        return;
+    }
+
+    m_active_requests.set(*protocol_request);
+
+    protocol_request->on_headers_received = [on_headers_received = move(on_headers_received), request](auto& response_headers, auto status_code) {
+        if (request.page().has_value()) {
+            if (auto set_cookie = response_headers.get("Set-Cookie"); set_cookie.has_value())
+                store_response_cookies(request.page().value(), request.url(), *set_cookie);
+        }
+        on_headers_received(response_headers, status_code);
+    };
+
+    auto chunk_sink = make<UnbufferedRequestStreamSink>(move(on_data_received));
+    protocol_request->stream_into(*chunk_sink);
+
+    // NOTE: The sink is kept alive by the on_finish callback, which the request holds on
+    //       to until it's removed from m_active_requests.
+    protocol_request->on_finish = [this, on_complete = move(on_complete), log_success, log_failure, request, chunk_sink = move(chunk_sink), &protocol_request = *protocol_request](bool success, auto) mutable {
+        --m_pending_loads;
+        if (on_load_counter_change)
+            on_load_counter_change();
+
+        if (success) {
+            log_success(request);
+            on_complete(true, {});
+        } else {
+            auto error_message = "Load failed"sv;
+            log_failure(request, error_message);
+            on_complete(false, error_message);
+        }
+
+        Platform::EventLoopPlugin::the().deferred_invoke([this, &protocol_request] {
+            m_active_requests.remove(protocol_request);
+        });
+    };
+
+    protocol_request->on_certificate_requested = []() -> ResourceLoaderConnectorRequest::CertificateAndKey {
+        return {};
+    };
+
+    ++m_pending_loads;
+    if (on_load_counter_change)
+        on_load_counter_change();
+}
+
 void ResourceLoader::load(const AK::URL& url, Function<void(ReadonlyBytes, HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> const& response_headers, Optional<u32> status_code)> success_callback, Function<void(DeprecatedString const&, Optional<u32> status_code)> error_callback, Optional<u32> timeout, Function<void()> timeout_callback)
 {
     LoadRequest request;
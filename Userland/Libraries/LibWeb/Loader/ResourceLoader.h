@@ -66,6 +66,7 @@ public:
     Function<void(bool success, u32 total_size, HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> const& response_headers, Optional<u32> response_code, ReadonlyBytes payload)> on_buffered_request_finish;
     Function<void(bool success, u32 total_size)> on_finish;
     Function<void(Optional<u32> total_size, u32 downloaded_size)> on_progress;
+    Function<void(HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> const& response_headers, Optional<u32> response_code)> on_headers_received;
     Function<CertificateAndKey()> on_certificate_requested;
 
 protected:
@@ -96,6 +97,12 @@ public:
     void load(LoadRequest&, Function<void(ReadonlyBytes, HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> const& response_headers, Optional<u32> status_code)> success_callback, Function<void(DeprecatedString const&, Optional<u32> status_code)> error_callback = nullptr, Optional<u32> timeout = {}, Function<void()> timeout_callback = nullptr);
     void load(const AK::URL&, Function<void(ReadonlyBytes, HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> const& response_headers, Optional<u32> status_code)> success_callback, Function<void(DeprecatedString const&, Optional<u32> status_code)> error_callback = nullptr, Optional<u32> timeout = {}, Function<void()> timeout_callback = nullptr);
 
+    // Streaming variant of load(): headers are delivered as soon as they arrive, and the
+    // payload is handed over chunk by chunk instead of being buffered whole. Only requests
+    // that go through the connector (http/https/gemini) support this; for other schemes
+    // the entire payload is available up front anyway.
+    void load_unbuffered(LoadRequest&, Function<void(HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> const& response_headers, Optional<u32> status_code)> on_headers_received, Function<void(ReadonlyBytes chunk)> on_data_received, Function<void(bool success, Optional<DeprecatedString> error_message)> on_complete);
+
     ResourceLoaderConnector& connector() { return *m_connector; }
 
     void prefetch_dns(AK::URL const&);
@@ -45,6 +45,13 @@ void Page::load(LoadRequest& request)
     top_level_browsing_context().loader().load(request, FrameLoader::Type::Navigation);
 }
 
+void Page::load_history_entry(const AK::URL& url)
+{
+    if (top_level_browsing_context().loader().load_cached_document(url))
+        return;
+    load(url);
+}
+
 void Page::load_html(StringView html, const AK::URL& url)
 {
     top_level_browsing_context().loader().load_html(html, url);
@@ -56,6 +56,10 @@ public:
 
     void load_html(StringView, const AK::URL&);
 
+    // Like load(), but for history traversal: restores the document from the
+    // back/forward cache when possible instead of loading from scratch.
+    void load_history_entry(const AK::URL&);
+
     CSSPixelPoint device_to_css_point(DevicePixelPoint) const;
     DevicePixelPoint css_to_device_point(CSSPixelPoint) const;
     CSSPixelRect device_to_css_rect(DevicePixelRect) const;
@@ -163,12 +163,18 @@ void PaintableBox::paint(PaintContext& context, PaintPhase phase) const
             auto border_box = absolute_border_box_rect();
             context.painter().add_clip_rect(context.rounded_device_rect(clip_rect.to_rect().resolved(Paintable::layout_node(), border_box.to_type<float>()).to_type<CSSPixels>()).to_type<int>());
         }
-        paint_backdrop_filter(context);
-        paint_background(context);
-        paint_box_shadow(context);
+        // OPTIMIZATION: Skip painting anything that lies entirely outside the painter's
+        //               clip rect (the damage rect during partial repaints).
+        // NOTE: The root element's background covers the entire canvas, so it can't be
+        //       culled by its own border box.
+        if (layout_box().is_root_element() || !is_out_of_view(context)) {
+            paint_backdrop_filter(context);
+            paint_background(context);
+            paint_box_shadow(context);
+        }
     }
 
-    if (phase == PaintPhase::Border) {
+    if (phase == PaintPhase::Border && !is_out_of_view(context)) {
         paint_border(context);
     }
 
@@ -600,6 +606,12 @@ void PaintableWithLines::paint(PaintContext& context, PaintPhase phase) const
 
     for (auto& line_box : m_line_boxes) {
         for (auto& fragment : line_box.fragments()) {
+            // OPTIMIZATION: Skip fragments that lie entirely outside the painter's clip rect.
+            if (!context.enclosing_device_rect(fragment.absolute_rect())
+                     .to_type<int>()
+                     .translated(context.painter().translation())
+                     .intersects(context.painter().clip_rect()))
+                continue;
             if (context.should_show_line_box_borders()) {
                 auto fragment_absolute_rect = fragment.absolute_rect();
                 context.painter().draw_rect(context.enclosing_device_rect(fragment_absolute_rect).to_type<int>(), Color::Green);
@@ -35,6 +35,7 @@ public:
     };
 
     CSSPixelRect absolute_rect() const;
+    CSSPixelPoint offset() const { return m_offset; }
     CSSPixelPoint effective_offset() const;
 
     void set_offset(CSSPixelPoint);
@@ -78,6 +78,16 @@ void StackingContext::paint_descendants(PaintContext& context, Layout::Node cons
         // If `child` establishes its own stacking context, skip over it.
         if (is<Layout::Box>(child) && child.paintable() && static_cast<Layout::Box const&>(child).paint_box()->stacking_context())
             return;
+        // OPTIMIZATION: If `child` clips its descendants to itself and lies entirely
+        //               outside the painter's clip rect (the damage rect during partial
+        //               repaints), nothing in its subtree can produce any pixels.
+        if (is<Layout::Box>(child) && child.paintable()) {
+            auto const& child_paint_box = *static_cast<Layout::Box const&>(child).paint_box();
+            bool clips_descendants = child.computed_values().overflow_x() == CSS::Overflow::Hidden
+                && child.computed_values().overflow_y() == CSS::Overflow::Hidden;
+            if (clips_descendants && child_paint_box.is_out_of_view(context))
+                return;
+        }
         // If `child` is positioned with a z-index of `0` or `auto`, skip over it.
         if (child.is_positioned()) {
             auto const& z_index = child.computed_values().z_index();
@@ -12,6 +12,7 @@
 #include "WebAssemblyTableObject.h"
 #include "WebAssemblyTablePrototype.h"
 #include <AK/ScopeGuard.h>
+#include <LibCrypto/Hash/SHA2.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/ArrayBuffer.h>
 #include <LibJS/Runtime/BigInt.h>
@@ -29,6 +30,9 @@ WebAssemblyObject::WebAssemblyObject(JS::Realm& realm)
     : Object(ConstructWithPrototypeTag::Tag, *realm.intrinsics().object_prototype())
 {
     s_abstract_machine.enable_instruction_count_limit();
+    // Large modules otherwise stall the WebContent process on load; bodies
+    // are checked on their first call instead.
+    s_abstract_machine.enable_deferred_function_body_validation();
 }
 
 void WebAssemblyObject::initialize(JS::Realm& realm)
@@ -57,6 +61,7 @@ NonnullOwnPtrVector<WebAssemblyObject::CompiledWebAssemblyModule> WebAssemblyObj
 NonnullOwnPtrVector<Wasm::ModuleInstance> WebAssemblyObject::s_instantiated_modules;
 Vector<WebAssemblyObject::ModuleCache> WebAssemblyObject::s_module_caches;
 WebAssemblyObject::GlobalModuleCache WebAssemblyObject::s_global_cache;
+HashMap<DeprecatedString, size_t> WebAssemblyObject::s_compiled_module_cache;
 Wasm::AbstractMachine WebAssemblyObject::s_abstract_machine;
 
 void WebAssemblyObject::visit_edges(Visitor& visitor)
@@ -118,6 +123,13 @@ JS::ThrowCompletionOr<size_t> parse_module(JS::VM& vm, JS::Object* buffer_object
     } else {
         return vm.throw_completion<JS::TypeError>("Not a BufferSource");
     }
+    // Identical binaries parse to identical modules, so share the compiled
+    // module between instantiations instead of re-parsing it every time.
+    auto digest = ::Crypto::Hash::SHA256::hash(data.data(), data.size());
+    DeprecatedString cache_key { StringView { digest.immutable_data(), digest.data_length() } };
+    if (auto cached_module = WebAssemblyObject::s_compiled_module_cache.get(cache_key); cached_module.has_value())
+        return cached_module.value();
+
     InputMemoryStream stream { data };
     auto module_result = Wasm::Module::parse(stream);
     ScopeGuard drain_errors {
@@ -130,13 +142,17 @@ JS::ThrowCompletionOr<size_t> parse_module(JS::VM& vm, JS::Object* buffer_object
         return vm.throw_completion<JS::TypeError>(Wasm::parse_error_to_deprecated_string(module_result.error()));
     }
 
-    if (auto validation_result = WebAssemblyObject::s_abstract_machine.validate(module_result.value()); validation_result.is_error()) {
+    // Check the module structure up front to reject obviously broken binaries
+    // early; function bodies are validated lazily, on their first call.
+    if (auto validation_result = Wasm::Validator {}.validate(module_result.value(), Wasm::Validator::FunctionBodyValidationMode::Deferred); validation_result.is_error()) {
         // FIXME: Throw CompileError instead.
         return vm.throw_completion<JS::TypeError>(validation_result.error().error_string);
     }
 
     WebAssemblyObject::s_compiled_modules.append(make<WebAssemblyObject::CompiledWebAssemblyModule>(module_result.release_value()));
-    return WebAssemblyObject::s_compiled_modules.size() - 1;
+    auto module_index = WebAssemblyObject::s_compiled_modules.size() - 1;
+    WebAssemblyObject::s_compiled_module_cache.set(move(cache_key), module_index);
+    return module_index;
 }
 
 JS_DEFINE_NATIVE_FUNCTION(WebAssemblyObject::compile)
@@ -369,6 +385,7 @@ JS::Value to_js_value(JS::VM& vm, Wasm::Value& wasm_value)
         return create_native_function(vm, wasm_value.to<Wasm::Reference::Func>().value().address, "FIXME_IHaveNoIdeaWhatThisShouldBeCalled");
     case Wasm::ValueType::NullFunctionReference:
         return JS::js_null();
+    case Wasm::ValueType::V128:
     case Wasm::ValueType::ExternReference:
     case Wasm::ValueType::NullExternReference:
         TODO();
@@ -417,6 +434,8 @@ JS::ThrowCompletionOr<Wasm::Value> to_webassembly_value(JS::VM& vm, JS::Value va
 
         return vm.throw_completion<JS::TypeError>(JS::ErrorType::NotAnObjectOfType, "Exported function");
     }
+    case Wasm::ValueType::V128:
+        return vm.throw_completion<JS::TypeError>("Cannot convert a JS value to a v128");
     case Wasm::ValueType::ExternReference:
     case Wasm::ValueType::NullExternReference:
         TODO();
@@ -58,6 +58,9 @@ public:
     static NonnullOwnPtrVector<Wasm::ModuleInstance> s_instantiated_modules;
     static Vector<ModuleCache> s_module_caches;
     static GlobalModuleCache s_global_cache;
+    // Maps a binary's SHA-256 digest to its index in s_compiled_modules, so
+    // compiling the same binary twice reuses the parsed module.
+    static HashMap<DeprecatedString, size_t> s_compiled_module_cache;
 
     static Wasm::AbstractMachine s_abstract_machine;
 
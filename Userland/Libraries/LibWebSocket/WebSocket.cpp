@@ -10,6 +10,7 @@
 #include <LibCrypto/Hash/HashManager.h>
 #include <LibWebSocket/Impl/WebSocketImplSerenity.h>
 #include <LibWebSocket/WebSocket.h>
+#include <string.h>
 #include <unistd.h>
 
 namespace WebSocket {
@@ -379,6 +380,25 @@ void WebSocket::read_server_handshake()
     // If needed, we will keep reading the header on the next drain_read call
 }
 
+// Applies the XOR masking from section 5.3 in place, a word at a time.
+static void apply_mask(Bytes bytes, u8 const (&masking_key)[4])
+{
+    // The mask repeats every four bytes, so as long as we start on a payload
+    // offset that is a multiple of four, the same 32-bit word can be XORed
+    // over the whole payload.
+    u32 mask_word;
+    memcpy(&mask_word, masking_key, sizeof(mask_word));
+    size_t i = 0;
+    for (; i + sizeof(u32) <= bytes.size(); i += sizeof(u32)) {
+        u32 word;
+        memcpy(&word, bytes.data() + i, sizeof(word));
+        word ^= mask_word;
+        memcpy(bytes.data() + i, &word, sizeof(word));
+    }
+    for (; i < bytes.size(); ++i)
+        bytes[i] ^= masking_key[i % 4];
+}
+
 void WebSocket::read_frame()
 {
     VERIFY(m_impl);
@@ -393,182 +413,181 @@ void WebSocket::read_frame()
         return bytes;
     };
 
-    auto head_bytes = get_buffered_bytes(2);
-    if (head_bytes.is_null() || head_bytes.is_empty()) {
-        // The connection got closed.
-        m_state = WebSocket::InternalState::Closed;
-        notify_close(m_last_close_code, m_last_close_message, true);
-        discard_connection();
-        return;
-    }
+    enum class ParseResult {
+        NeedMoreData,
+        FrameProcessed,
+        Stop,
+    };
 
-    bool is_final_frame = head_bytes[0] & 0x80;
-    if (!is_final_frame) {
-        // FIXME: Support fragmented frames
-        TODO();
-    }
+    auto parse_frame = [&]() -> ParseResult {
+        auto frame_start = cursor;
+        auto rewind_and_wait = [&]() {
+            cursor = frame_start;
+            return ParseResult::NeedMoreData;
+        };
 
-    auto op_code = (WebSocket::OpCode)(head_bytes[0] & 0x0f);
-    bool is_masked = head_bytes[1] & 0x80;
+        auto head_bytes = get_buffered_bytes(2);
+        if (head_bytes.is_null() || head_bytes.is_empty()) {
+            if (frame_start != 0)
+                return rewind_and_wait();
+            // The connection got closed.
+            m_state = WebSocket::InternalState::Closed;
+            notify_close(m_last_close_code, m_last_close_message, true);
+            discard_connection();
+            return ParseResult::Stop;
+        }
 
-    // Parse the payload length.
-    size_t payload_length;
-    auto payload_length_bits = head_bytes[1] & 0x7f;
-    if (payload_length_bits == 127) {
-        // A code of 127 means that the next 8 bytes contains the payload length
-        auto actual_bytes = get_buffered_bytes(8);
-        if (actual_bytes.is_null())
-            return;
-        u64 full_payload_length = (u64)((u64)(actual_bytes[0] & 0xff) << 56)
-            | (u64)((u64)(actual_bytes[1] & 0xff) << 48)
-            | (u64)((u64)(actual_bytes[2] & 0xff) << 40)
-            | (u64)((u64)(actual_bytes[3] & 0xff) << 32)
-            | (u64)((u64)(actual_bytes[4] & 0xff) << 24)
-            | (u64)((u64)(actual_bytes[5] & 0xff) << 16)
-            | (u64)((u64)(actual_bytes[6] & 0xff) << 8)
-            | (u64)((u64)(actual_bytes[7] & 0xff) << 0);
-        VERIFY(full_payload_length <= NumericLimits<size_t>::max());
-        payload_length = (size_t)full_payload_length;
-    } else if (payload_length_bits == 126) {
-        // A code of 126 means that the next 2 bytes contains the payload length
-        auto actual_bytes = get_buffered_bytes(2);
-        if (actual_bytes.is_null())
-            return;
-        payload_length = (size_t)((size_t)(actual_bytes[0] & 0xff) << 8)
-            | (size_t)((size_t)(actual_bytes[1] & 0xff) << 0);
-    } else {
-        payload_length = (size_t)payload_length_bits;
-    }
+        bool is_final_frame = head_bytes[0] & 0x80;
+        if (!is_final_frame) {
+            // FIXME: Support fragmented frames
+            TODO();
+        }
 
-    // Parse the mask, if it exists.
-    // Note : this is technically non-conformant with Section 5.1 :
-    // > A server MUST NOT mask any frames that it sends to the client.
-    // > A client MUST close a connection if it detects a masked frame.
-    // > (These rules might be relaxed in a future specification.)
-    // But because it doesn't cost much, we can support receiving masked frames anyways.
-    u8 masking_key[4];
-    if (is_masked) {
-        auto masking_key_data = get_buffered_bytes(4);
-        if (masking_key_data.is_null())
-            return;
-        masking_key[0] = masking_key_data[0];
-        masking_key[1] = masking_key_data[1];
-        masking_key[2] = masking_key_data[2];
-        masking_key[3] = masking_key_data[3];
-    }
+        auto op_code = (WebSocket::OpCode)(head_bytes[0] & 0x0f);
+        bool is_masked = head_bytes[1] & 0x80;
+
+        // Parse the payload length.
+        size_t payload_length;
+        auto payload_length_bits = head_bytes[1] & 0x7f;
+        if (payload_length_bits == 127) {
+            // A code of 127 means that the next 8 bytes contains the payload length
+            auto actual_bytes = get_buffered_bytes(8);
+            if (actual_bytes.is_null())
+                return rewind_and_wait();
+            u64 full_payload_length = (u64)((u64)(actual_bytes[0] & 0xff) << 56)
+                | (u64)((u64)(actual_bytes[1] & 0xff) << 48)
+                | (u64)((u64)(actual_bytes[2] & 0xff) << 40)
+                | (u64)((u64)(actual_bytes[3] & 0xff) << 32)
+                | (u64)((u64)(actual_bytes[4] & 0xff) << 24)
+                | (u64)((u64)(actual_bytes[5] & 0xff) << 16)
+                | (u64)((u64)(actual_bytes[6] & 0xff) << 8)
+                | (u64)((u64)(actual_bytes[7] & 0xff) << 0);
+            VERIFY(full_payload_length <= NumericLimits<size_t>::max());
+            payload_length = (size_t)full_payload_length;
+        } else if (payload_length_bits == 126) {
+            // A code of 126 means that the next 2 bytes contains the payload length
+            auto actual_bytes = get_buffered_bytes(2);
+            if (actual_bytes.is_null())
+                return rewind_and_wait();
+            payload_length = (size_t)((size_t)(actual_bytes[0] & 0xff) << 8)
+                | (size_t)((size_t)(actual_bytes[1] & 0xff) << 0);
+        } else {
+            payload_length = (size_t)payload_length_bits;
+        }
+
+        // Parse the mask, if it exists.
+        // Note : this is technically non-conformant with Section 5.1 :
+        // > A server MUST NOT mask any frames that it sends to the client.
+        // > A client MUST close a connection if it detects a masked frame.
+        // > (These rules might be relaxed in a future specification.)
+        // But because it doesn't cost much, we can support receiving masked frames anyways.
+        u8 masking_key[4];
+        if (is_masked) {
+            auto masking_key_data = get_buffered_bytes(4);
+            if (masking_key_data.is_null())
+                return rewind_and_wait();
+            masking_key[0] = masking_key_data[0];
+            masking_key[1] = masking_key_data[1];
+            masking_key[2] = masking_key_data[2];
+            masking_key[3] = masking_key_data[3];
+        }
+
+        auto payload_bytes = get_buffered_bytes(payload_length);
+        if (payload_length != 0 && payload_bytes.is_null())
+            return rewind_and_wait();
+        auto payload = ByteBuffer::copy(payload_bytes).release_value_but_fixme_should_propagate_errors(); // FIXME: Handle possible OOM situation.
+
+        if (is_masked) {
+            // Unmask the payload
+            apply_mask(payload, masking_key);
+        }
 
-    auto payload = ByteBuffer::create_uninitialized(payload_length).release_value_but_fixme_should_propagate_errors(); // FIXME: Handle possible OOM situation.
-    u64 read_length = 0;
-    while (read_length < payload_length) {
-        auto payload_part = get_buffered_bytes(payload_length - read_length);
-        if (payload_part.is_null())
+        if (op_code == WebSocket::OpCode::ConnectionClose) {
+            if (payload.size() > 1) {
+                m_last_close_code = (((u16)(payload[0] & 0xff) << 8) | ((u16)(payload[1] & 0xff)));
+                m_last_close_message = DeprecatedString(ReadonlyBytes(payload.offset_pointer(2), payload.size() - 2));
+            }
+            m_state = WebSocket::InternalState::Closing;
+            return ParseResult::Stop;
+        }
+        if (op_code == WebSocket::OpCode::Ping) {
+            // Immediately send a pong frame as a reply, with the given payload.
+            send_frame(WebSocket::OpCode::Pong, payload, true);
+            return ParseResult::FrameProcessed;
+        }
+        if (op_code == WebSocket::OpCode::Pong) {
+            // We can safely ignore the pong
+            return ParseResult::FrameProcessed;
+        }
+        if (op_code == WebSocket::OpCode::Continuation) {
+            // FIXME: Support fragmented frames
+            TODO();
+        }
+        if (op_code == WebSocket::OpCode::Text) {
+            notify_message(Message(payload, true));
+            return ParseResult::FrameProcessed;
+        }
+        if (op_code == WebSocket::OpCode::Binary) {
+            notify_message(Message(payload, false));
+            return ParseResult::FrameProcessed;
+        }
+        dbgln("Websocket: Found unknown opcode {}", (u8)op_code);
+        return ParseResult::FrameProcessed;
+    };
+
+    // Process as many complete frames as the buffer holds; small messages
+    // often arrive several to a single read, and the ones we leave buffered
+    // wouldn't get another look until the next socket event.
+    for (;;) {
+        auto result = parse_frame();
+        if (result == ParseResult::Stop)
             return;
-        // We read at most "actual_length - read" bytes, so this is safe to do.
-        payload.overwrite(read_length, payload_part.data(), payload_part.size());
-        read_length += payload_part.size();
+        if (result == ParseResult::NeedMoreData)
+            break;
     }
 
     if (cursor == m_buffered_data.size()) {
         m_buffered_data.clear();
-    } else {
+    } else if (cursor > 0) {
         Vector<u8> new_buffered_data;
         new_buffered_data.append(m_buffered_data.data() + cursor, m_buffered_data.size() - cursor);
         m_buffered_data = move(new_buffered_data);
     }
-
-    if (is_masked) {
-        // Unmask the payload
-        for (size_t i = 0; i < payload.size(); ++i) {
-            payload[i] = payload[i] ^ (masking_key[i % 4]);
-        }
-    }
-
-    if (op_code == WebSocket::OpCode::ConnectionClose) {
-        if (payload.size() > 1) {
-            m_last_close_code = (((u16)(payload[0] & 0xff) << 8) | ((u16)(payload[1] & 0xff)));
-            m_last_close_message = DeprecatedString(ReadonlyBytes(payload.offset_pointer(2), payload.size() - 2));
-        }
-        m_state = WebSocket::InternalState::Closing;
-        return;
-    }
-    if (op_code == WebSocket::OpCode::Ping) {
-        // Immediately send a pong frame as a reply, with the given payload.
-        send_frame(WebSocket::OpCode::Pong, payload, true);
-        return;
-    }
-    if (op_code == WebSocket::OpCode::Pong) {
-        // We can safely ignore the pong
-        return;
-    }
-    if (op_code == WebSocket::OpCode::Continuation) {
-        // FIXME: Support fragmented frames
-        TODO();
-    }
-    if (op_code == WebSocket::OpCode::Text) {
-        notify_message(Message(payload, true));
-        return;
-    }
-    if (op_code == WebSocket::OpCode::Binary) {
-        notify_message(Message(payload, false));
-        return;
-    }
-    dbgln("Websocket: Found unknown opcode {}", (u8)op_code);
 }
 
 void WebSocket::send_frame(WebSocket::OpCode op_code, ReadonlyBytes payload, bool is_final)
 {
     VERIFY(m_impl);
     VERIFY(m_state == WebSocket::InternalState::Open);
-    u8 frame_head[1] = { (u8)((is_final ? 0x80 : 0x00) | ((u8)(op_code)&0xf)) };
-    m_impl->send(ReadonlyBytes(frame_head, 1));
     // Section 5.1 : a client MUST mask all frames that it sends to the server
     bool has_mask = true;
+
+    // Assemble the whole frame (head, length, masking key and masked payload)
+    // in one buffer, so it reaches the socket as a single write instead of
+    // four.
+    auto frame_result = ByteBuffer::create_uninitialized(2 + 8 + 4 + payload.size());
+    if (frame_result.is_error())
+        return;
+    auto& frame = frame_result.value();
+    size_t offset = 0;
+
+    frame[offset++] = (u8)((is_final ? 0x80 : 0x00) | ((u8)(op_code)&0xf));
     // FIXME: If the payload has a size > size_t max on a 32-bit platform, we could
     //     technically stream it via non-final packets. However, the size was already
     //     truncated earlier in the call stack when stuffing into a ReadonlyBytes
     if (payload.size() > NumericLimits<u16>::max()) {
-        // Send (the 'mask' flag + 127) + the 8-byte payload length
-        if constexpr (sizeof(size_t) >= 8) {
-            u8 payload_length[9] = {
-                (u8)((has_mask ? 0x80 : 0x00) | 127),
-                (u8)((payload.size() >> 56) & 0xff),
-                (u8)((payload.size() >> 48) & 0xff),
-                (u8)((payload.size() >> 40) & 0xff),
-                (u8)((payload.size() >> 32) & 0xff),
-                (u8)((payload.size() >> 24) & 0xff),
-                (u8)((payload.size() >> 16) & 0xff),
-                (u8)((payload.size() >> 8) & 0xff),
-                (u8)((payload.size() >> 0) & 0xff),
-            };
-            m_impl->send(ReadonlyBytes(payload_length, 9));
-        } else {
-            u8 payload_length[9] = {
-                (u8)((has_mask ? 0x80 : 0x00) | 127),
-                0,
-                0,
-                0,
-                0,
-                (u8)((payload.size() >> 24) & 0xff),
-                (u8)((payload.size() >> 16) & 0xff),
-                (u8)((payload.size() >> 8) & 0xff),
-                (u8)((payload.size() >> 0) & 0xff),
-            };
-            m_impl->send(ReadonlyBytes(payload_length, 9));
-        }
+        // The 'mask' flag + 127, then the 8-byte payload length
+        frame[offset++] = (u8)((has_mask ? 0x80 : 0x00) | 127);
+        for (int shift = 56; shift >= 0; shift -= 8)
+            frame[offset++] = (u8)(((u64)payload.size() >> shift) & 0xff);
     } else if (payload.size() >= 126) {
-        // Send (the 'mask' flag + 126) + the 2-byte payload length
-        u8 payload_length[3] = {
-            (u8)((has_mask ? 0x80 : 0x00) | 126),
-            (u8)((payload.size() >> 8) & 0xff),
-            (u8)((payload.size() >> 0) & 0xff),
-        };
-        m_impl->send(ReadonlyBytes(payload_length, 3));
+        // The 'mask' flag + 126, then the 2-byte payload length
+        frame[offset++] = (u8)((has_mask ? 0x80 : 0x00) | 126);
+        frame[offset++] = (u8)((payload.size() >> 8) & 0xff);
+        frame[offset++] = (u8)((payload.size() >> 0) & 0xff);
     } else {
-        // Send the mask flag + the payload in a single byte
-        u8 payload_length[1] = {
-            (u8)((has_mask ? 0x80 : 0x00) | (u8)(payload.size() & 0x7f)),
-        };
-        m_impl->send(ReadonlyBytes(payload_length, 1));
+        // The mask flag + the payload length in a single byte
+        frame[offset++] = (u8)((has_mask ? 0x80 : 0x00) | (u8)(payload.size() & 0x7f));
     }
     if (has_mask) {
         // Section 10.3 :
@@ -576,22 +595,20 @@ void WebSocket::send_frame(WebSocket::OpCode op_code, ReadonlyBytes payload, boo
         // > that cannot be predicted by end applications that provide data
         u8 masking_key[4];
         fill_with_random(masking_key, 4);
-        m_impl->send(ReadonlyBytes(masking_key, 4));
-        // don't try to send empty payload
-        if (payload.size() == 0)
-            return;
-        // Mask the payload
-        auto buffer_result = ByteBuffer::create_uninitialized(payload.size());
-        if (!buffer_result.is_error()) {
-            auto& masked_payload = buffer_result.value();
-            for (size_t i = 0; i < payload.size(); ++i) {
-                masked_payload[i] = payload[i] ^ (masking_key[i % 4]);
-            }
-            m_impl->send(masked_payload);
+        frame.overwrite(offset, masking_key, 4);
+        offset += 4;
+        if (payload.size() > 0) {
+            // Mask the payload
+            frame.overwrite(offset, payload.data(), payload.size());
+            apply_mask(frame.bytes().slice(offset, payload.size()), masking_key);
+            offset += payload.size();
         }
     } else if (payload.size() > 0) {
-        m_impl->send(payload);
+        frame.overwrite(offset, payload.data(), payload.size());
+        offset += payload.size();
     }
+
+    m_impl->send(frame.bytes().trim(offset));
 }
 
 void WebSocket::fatal_error(WebSocket::Error error)
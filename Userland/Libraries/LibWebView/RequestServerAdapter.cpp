@@ -37,6 +37,12 @@ RequestServerRequestAdapter::RequestServerRequestAdapter(NonnullRefPtr<Protocol:
                 strong_this->on_progress(total_size, downloaded_size);
     };
 
+    request->on_headers_received = [weak_this = make_weak_ptr()](auto const& response_headers, auto response_code) {
+        if (auto strong_this = weak_this.strong_ref())
+            if (strong_this->on_headers_received)
+                strong_this->on_headers_received(response_headers, response_code);
+    };
+
     request->on_certificate_requested = [weak_this = make_weak_ptr()]() {
         if (auto strong_this = weak_this.strong_ref()) {
             if (strong_this->on_certificate_requested) {
@@ -28,6 +28,12 @@ void ViewImplementation::load(AK::URL const& url)
     client().async_load_url(url);
 }
 
+void ViewImplementation::load_history_entry(AK::URL const& url)
+{
+    m_url = url;
+    client().async_load_history_entry(url);
+}
+
 void ViewImplementation::load_html(StringView html, AK::URL const& url)
 {
     m_url = url;
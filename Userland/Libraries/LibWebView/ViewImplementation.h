@@ -34,6 +34,10 @@ public:
     void load_html(StringView, AK::URL const&);
     void load_empty_document();
 
+    // For back/forward navigation: lets WebContent restore the document from
+    // its back/forward cache instead of loading it from scratch.
+    void load_history_entry(AK::URL const&);
+
     void zoom_in();
     void zoom_out();
     void reset_zoom();
@@ -80,6 +80,11 @@ void Parser::append_node(NonnullOwnPtr<Node> node)
 
 void Parser::append_text(StringView text)
 {
+    if (m_streaming_listener) {
+        m_streaming_listener->text(text);
+        return;
+    }
+
     if (m_listener) {
         m_listener->text(text);
         return;
@@ -113,6 +118,11 @@ void Parser::append_text(StringView text)
 
 void Parser::append_comment(StringView text)
 {
+    if (m_streaming_listener) {
+        m_streaming_listener->comment(text);
+        return;
+    }
+
     if (m_listener) {
         m_listener->comment(text);
         return;
@@ -184,6 +194,18 @@ ErrorOr<void, ParseError> Parser::parse_with_listener(Listener& listener)
     return result;
 }
 
+ErrorOr<void, ParseError> Parser::parse_with_streaming_listener(StreamingListener& listener)
+{
+    m_streaming_listener = &listener;
+    ScopeGuard unset_listener { [this] { m_streaming_listener = nullptr; } };
+    m_streaming_listener->document_start();
+    auto result = parse_internal();
+    if (result.is_error())
+        m_streaming_listener->error(result.error());
+    m_streaming_listener->document_end();
+    return result;
+}
+
 // 2.3.3. S, https://www.w3.org/TR/2006/REC-xml11-20060816/#NT-S
 ErrorOr<void, ParseError> Parser::skip_whitespace(Required required)
 {
@@ -533,6 +555,13 @@ constexpr static auto s_name_characters = s_name_start_characters.with<Range('-'
 
 // 2.3.5. Name, https://www.w3.org/TR/2006/REC-xml11-20060816/#NT-Name
 ErrorOr<Name, ParseError> Parser::parse_name()
+{
+    return Name { TRY(parse_name_view()) };
+}
+
+// Like parse_name(), but the name is returned as a view into the source
+// instead of being copied out.
+ErrorOr<StringView, ParseError> Parser::parse_name_view()
 {
     auto rollback = rollback_point();
     auto rule = enter_rule();
@@ -542,12 +571,10 @@ ErrorOr<Name, ParseError> Parser::parse_name()
     auto accept = accept_rule();
 
     auto rest = m_lexer.consume_while(s_name_characters);
-    StringBuilder builder;
-    builder.append(start);
-    builder.append(rest);
 
     rollback.disarm();
-    return builder.to_deprecated_string();
+    // The start character and the rest are adjacent views into the source.
+    return StringView { start.characters_without_null_termination(), start.length() + rest.length() };
 }
 
 // 2.8.28. doctypedecl, https://www.w3.org/TR/2006/REC-xml11-20060816/#NT-doctypedecl
@@ -605,6 +632,9 @@ ErrorOr<void, ParseError> Parser::parse_doctype_decl()
 // 3.39. element, https://www.w3.org/TR/2006/REC-xml11-20060816/#NT-element
 ErrorOr<void, ParseError> Parser::parse_element()
 {
+    if (m_streaming_listener)
+        return parse_element_streaming();
+
     auto rollback = rollback_point();
     auto rule = enter_rule();
 
@@ -640,6 +670,95 @@ ErrorOr<void, ParseError> Parser::parse_element()
     return {};
 }
 
+ErrorOr<void, ParseError> Parser::parse_element_streaming()
+{
+    auto rollback = rollback_point();
+    auto rule = enter_rule();
+
+    // element ::= EmptyElemTag
+    //           | STag content ETag
+    Vector<StreamingAttribute> attributes;
+    Vector<DeprecatedString> expanded_attribute_values;
+    bool is_empty_element = false;
+    auto name = TRY(parse_tag_streaming(attributes, expanded_attribute_values, is_empty_element));
+
+    m_streaming_listener->element_start(name, attributes);
+
+    if (is_empty_element) {
+        m_streaming_listener->element_end(name);
+        rollback.disarm();
+        return {};
+    }
+
+    TRY(parse_content());
+
+    auto tag_location = m_lexer.tell();
+    auto closing_name = TRY(parse_end_tag());
+
+    // Well-formedness constraint: The Name in an element's end-tag MUST match the element type in the start-tag.
+    if (m_options.treat_errors_as_fatal && closing_name != name)
+        return parse_error(tag_location, "Invalid closing tag");
+
+    m_streaming_listener->element_end(name);
+    rollback.disarm();
+    return {};
+}
+
+// Parses an STag or EmptyElemTag without constructing a Node: the names are
+// views into the source, and attribute values are only copied (into
+// expanded_attribute_values, which must outlive the use of the attributes)
+// when they contain references that need expanding.
+ErrorOr<StringView, ParseError> Parser::parse_tag_streaming(Vector<StreamingAttribute>& attributes, Vector<DeprecatedString>& expanded_attribute_values, bool& is_empty_element)
+{
+    auto rollback = rollback_point();
+    auto rule = enter_rule();
+
+    // STag ::= '<' Name (S Attribute)* S? '>'
+    // EmptyElemTag ::= '<' Name (S Attribute)* S? '/>'
+    TRY(expect("<"sv));
+    auto accept = accept_rule();
+
+    auto name = TRY(parse_name_view());
+
+    while (true) {
+        if (auto result = skip_whitespace(Required::Yes); result.is_error())
+            break;
+
+        auto attribute_name_result = parse_name_view();
+        if (attribute_name_result.is_error())
+            break;
+        auto attribute_name = attribute_name_result.release_value();
+
+        TRY(parse_eq());
+        auto quote = TRY(expect(is_any_of("'\""sv), "one of ' or \""sv));
+
+        // If the value contains no references, it can be passed along as-is.
+        auto rest = m_lexer.remaining();
+        size_t plain_length = 0;
+        while (plain_length < rest.length() && rest[plain_length] != quote[0] && rest[plain_length] != '&' && rest[plain_length] != '<')
+            ++plain_length;
+
+        StringView value;
+        if (plain_length < rest.length() && rest[plain_length] == quote[0]) {
+            value = rest.substring_view(0, plain_length);
+            m_lexer.ignore(plain_length);
+        } else {
+            expanded_attribute_values.append(TRY(parse_attribute_value_inner(quote)));
+            value = expanded_attribute_values.last().view();
+        }
+        TRY(expect(quote));
+
+        attributes.append({ attribute_name, value });
+    }
+
+    TRY(skip_whitespace());
+    is_empty_element = m_lexer.consume_specific('/');
+    TRY(expect(">"sv));
+
+    rollback.disarm();
+    return name;
+}
+
 // 3.1.44. EmptyElemTag, https://www.w3.org/TR/2006/REC-xml11-20060816/#NT-EmptyElemTag
 ErrorOr<NonnullOwnPtr<Node>, ParseError> Parser::parse_empty_element_tag()
 {
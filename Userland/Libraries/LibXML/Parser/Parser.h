@@ -39,6 +39,27 @@ struct Listener {
     virtual void error(ParseError const&) { }
 };
 
+// Like Listener, but no DOM nodes are constructed and every payload is a view
+// into the parser's source buffer (or into storage that only lives for the
+// duration of the callback), so parsing does not allocate per node. Suitable
+// for streaming through documents too large to keep around as a tree.
+struct StreamingAttribute {
+    StringView name;
+    StringView value;
+};
+
+struct StreamingListener {
+    virtual ~StreamingListener() { }
+
+    virtual void document_start() { }
+    virtual void document_end() { }
+    virtual void element_start(StringView, Vector<StreamingAttribute> const&) { }
+    virtual void element_end(StringView) { }
+    virtual void text(StringView) { }
+    virtual void comment(StringView) { }
+    virtual void error(ParseError const&) { }
+};
+
 class Parser {
 public:
     struct Options {
@@ -63,6 +84,7 @@ public:
 
     ErrorOr<Document, ParseError> parse();
     ErrorOr<void, ParseError> parse_with_listener(Listener&);
+    ErrorOr<void, ParseError> parse_with_streaming_listener(StreamingListener&);
 
     Vector<ParseError> const& parse_error_causes() const { return m_parse_errors; }
 
@@ -104,6 +126,9 @@ private:
     ErrorOr<void, ParseError> parse_processing_instruction();
     ErrorOr<Name, ParseError> parse_processing_instruction_target();
     ErrorOr<Name, ParseError> parse_name();
+    ErrorOr<StringView, ParseError> parse_name_view();
+    ErrorOr<void, ParseError> parse_element_streaming();
+    ErrorOr<StringView, ParseError> parse_tag_streaming(Vector<StreamingAttribute>&, Vector<DeprecatedString>& expanded_attribute_values, bool& is_empty_element);
     ErrorOr<NonnullOwnPtr<Node>, ParseError> parse_empty_element_tag();
     ErrorOr<NonnullOwnPtr<Node>, ParseError> parse_start_tag();
     ErrorOr<Name, ParseError> parse_end_tag();
@@ -196,6 +221,7 @@ private:
     GenericLexer m_lexer;
     Options m_options;
     Listener* m_listener { nullptr };
+    StreamingListener* m_streaming_listener { nullptr };
 
     OwnPtr<Node> m_root_node;
     Node* m_entered_node { nullptr };
@@ -111,6 +111,22 @@ void ConnectionFromClient::clear_buffer()
         m_queue->clear();
 }
 
+Messages::AudioServer::GetBufferedSampleCountResponse ConnectionFromClient::get_buffered_sample_count()
+{
+    if (m_queue)
+        return static_cast<u32>(m_queue->buffered_sample_count());
+
+    return static_cast<u32>(0);
+}
+
+Messages::AudioServer::GetUnderrunCountResponse ConnectionFromClient::get_underrun_count()
+{
+    if (m_queue)
+        return m_queue->underrun_count();
+
+    return static_cast<u32>(0);
+}
+
 Messages::AudioServer::IsMainMixMutedResponse ConnectionFromClient::is_main_mix_muted()
 {
     return m_mixer.is_muted();
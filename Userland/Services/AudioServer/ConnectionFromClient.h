@@ -42,6 +42,8 @@ private:
     virtual void clear_buffer() override;
     virtual void start_playback() override;
     virtual void pause_playback() override;
+    virtual Messages::AudioServer::GetBufferedSampleCountResponse get_buffered_sample_count() override;
+    virtual Messages::AudioServer::GetUnderrunCountResponse get_underrun_count() override;
     virtual Messages::AudioServer::IsMainMixMutedResponse is_main_mix_muted() override;
     virtual void set_main_mix_muted(bool) override;
     virtual Messages::AudioServer::IsSelfMutedResponse is_self_muted() override;
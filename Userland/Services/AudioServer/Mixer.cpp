@@ -10,6 +10,9 @@
 #include <AK/Format.h>
 #include <AK/MemoryStream.h>
 #include <AK/NumericLimits.h>
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
+#include <AK/SIMDMath.h>
 #include <AudioServer/ConnectionFromClient.h>
 #include <AudioServer/Mixer.h>
 #include <LibCore/ConfigFile.h>
@@ -83,15 +86,18 @@ void Mixer::mix()
             }
             queue->volume().advance_time();
 
+            // The volume only changes in between buffers, so the expensive logarithmic volume
+            // curve needs to be evaluated once per buffer instead of once per sample.
+            float const gain = Audio::Sample::linear_to_log(static_cast<float>(SAMPLE_HEADROOM))
+                * Audio::Sample::linear_to_log(static_cast<float>(queue->volume()));
+
             for (auto& mixed_sample : mixed_buffer) {
                 Audio::Sample sample;
                 if (!queue->get_next_sample(sample))
                     break;
                 if (queue->is_muted())
                     continue;
-                sample.log_multiply(SAMPLE_HEADROOM);
-                sample.log_multiply(static_cast<float>(queue->volume()));
-                mixed_sample += sample;
+                mixed_sample += sample * gain;
             }
         }
 
@@ -101,16 +107,24 @@ void Mixer::mix()
         } else {
             OutputMemoryStream stream { m_stream_buffer };
 
-            for (auto& mixed_sample : mixed_buffer) {
-                mixed_sample.log_multiply(static_cast<float>(m_main_volume));
-                mixed_sample.clip();
-
-                LittleEndian<i16> out_sample;
-                out_sample = static_cast<i16>(mixed_sample.left * NumericLimits<i16>::max());
-                stream << out_sample;
-
-                out_sample = static_cast<i16>(mixed_sample.right * NumericLimits<i16>::max());
-                stream << out_sample;
+            auto const main_gain = AK::SIMD::expand4(Audio::Sample::linear_to_log(static_cast<float>(m_main_volume)));
+            auto const sample_limit = AK::SIMD::expand4(static_cast<float>(NumericLimits<i16>::max()));
+
+            // Stereo samples are interleaved in memory exactly like the device expects them,
+            // so each vector scales, clips and converts two of them at once.
+            static_assert(HARDWARE_BUFFER_SIZE % 2 == 0);
+            for (size_t i = 0; i < mixed_buffer.size(); i += 2) {
+                auto samples = AK::SIMD::f32x4 {
+                    mixed_buffer[i].left, mixed_buffer[i].right,
+                    mixed_buffer[i + 1].left, mixed_buffer[i + 1].right
+                } * main_gain;
+                samples = AK::SIMD::clamp(samples, -1.f, 1.f);
+                auto const device_samples = AK::SIMD::to_i32x4(samples * sample_limit);
+
+                for (auto lane = 0u; lane < 4u; lane++) {
+                    LittleEndian<i16> out_sample = static_cast<i16>(device_samples[lane]);
+                    stream << out_sample;
+                }
             }
 
             VERIFY(stream.is_end());
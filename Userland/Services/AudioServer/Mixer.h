@@ -50,6 +50,7 @@ public:
             auto result = m_buffer->try_dequeue();
             if (result.is_error()) {
                 if (result.error() == Audio::AudioQueue::QueueStatus::Empty) {
+                    m_underrun_count++;
                     dbgln("Audio client {} can't keep up!", m_client->client_id());
                     // Note: Even though we only check client state here, we will probably close the client much earlier.
                     if (!m_client->is_open()) {
@@ -85,6 +86,17 @@ public:
 
     void set_paused(bool paused) { m_paused = paused; }
 
+    // How often the mixer needed samples while the client's queue was empty.
+    u32 underrun_count() const { return m_underrun_count; }
+    // How many samples the client has queued up but the mixer hasn't consumed yet,
+    // i.e. the client's current worst-case playback latency.
+    size_t buffered_sample_count() const
+    {
+        if (!m_buffer)
+            return 0;
+        return m_buffer->weak_used() * Audio::AUDIO_BUFFER_SIZE + (m_current_audio_chunk.size() - min(m_current_audio_chunk.size(), m_in_chunk_location));
+    }
+
     FadingProperty<double>& volume() { return m_volume; }
     double volume() const { return m_volume; }
     void set_volume(double const volume) { m_volume = volume; }
@@ -94,7 +106,10 @@ public:
 private:
     OwnPtr<Audio::AudioQueue> m_buffer;
     Array<Audio::Sample, Audio::AUDIO_BUFFER_SIZE> m_current_audio_chunk;
-    size_t m_in_chunk_location;
+    // Start with the current (zero-initialized) chunk fully consumed, so that the
+    // first sample comes from the client's queue instead.
+    size_t m_in_chunk_location { Audio::AUDIO_BUFFER_SIZE };
+    u32 m_underrun_count { 0 };
 
     bool m_paused { true };
     bool m_muted { false };
@@ -31,11 +31,29 @@ void ChessEngine::handle_position(PositionCommand const& command)
 void ChessEngine::handle_go(GoCommand const& command)
 {
     // FIXME: A better algorithm than naive mcts.
-    // FIXME: Add different ways to terminate search.
-    VERIFY(command.movetime.has_value());
-
     srand(get_random<u32>());
 
+    // MCTS is an anytime algorithm, so "searching deeper" simply means running
+    // more rounds; all we need is a time budget for this move.
+    auto time_budget_ms = [&]() -> int {
+        if (command.movetime.has_value())
+            return command.movetime.value();
+
+        auto remaining_time = (m_board.turn() == Chess::Color::White) ? command.wtime : command.btime;
+        auto increment = (m_board.turn() == Chess::Color::White) ? command.winc : command.binc;
+        if (remaining_time.has_value()) {
+            // Under tournament time controls, spread the remaining clock over
+            // the expected number of remaining moves and spend most of the
+            // increment on top, but never more than half the clock on one move.
+            int expected_moves_left = max(command.movestogo.value_or(30), 1);
+            int budget = remaining_time.value() / expected_moves_left + increment.value_or(0) / 2;
+            return max(min(budget, remaining_time.value() / 2), 1);
+        }
+
+        // FIXME: Support "go infinite" properly by searching until a stop command arrives.
+        return 5'000;
+    }();
+
     auto elapsed_time = Core::ElapsedTimer::start_new();
 
     auto mcts = [this]() -> MCTSTree {
@@ -48,7 +66,7 @@ void ChessEngine::handle_go(GoCommand const& command)
     }();
 
     int rounds = 0;
-    while (elapsed_time.elapsed() <= command.movetime.value()) {
+    while (elapsed_time.elapsed() <= time_budget_ms) {
         mcts.do_round();
         ++rounds;
     }
@@ -6,8 +6,15 @@
 
 #include "MCTSTree.h"
 #include <AK/DeprecatedString.h>
+#include <AK/HashMap.h>
 #include <stdlib.h>
 
+// Transposition table: positions reached through different move orders share a
+// single cached evaluation. Keyed by the board's Zobrist hash; as with
+// repetition detection in LibChess, we trust that collisions won't happen.
+static HashMap<u64, MCTSTree::Evaluation> s_transposition_table;
+static constexpr size_t s_transposition_table_size_limit = 256 * 1024;
+
 MCTSTree::MCTSTree(Chess::Board const& board, MCTSTree* parent)
     : m_parent(parent)
     , m_board(make<Chess::Board>(board))
@@ -86,10 +93,27 @@ int MCTSTree::simulate_game() const
 
 int MCTSTree::heuristic() const
 {
-    if (m_board->game_finished())
-        return m_board->game_score();
+    Evaluation evaluation;
+    if (auto cached = s_transposition_table.get(m_board->hash()); cached.has_value()) {
+        evaluation = cached.value();
+    } else {
+        bool game_finished = m_board->game_finished();
+        evaluation = {
+            game_finished,
+            game_finished ? m_board->game_score() : m_board->material_imbalance(),
+        };
+        // Game results and material counts are properties of the position, so
+        // stale entries never become incorrect; clearing the table when it
+        // grows too large only costs us some recomputation.
+        if (s_transposition_table.size() >= s_transposition_table_size_limit)
+            s_transposition_table.clear();
+        s_transposition_table.set(m_board->hash(), evaluation);
+    }
+
+    if (evaluation.game_finished)
+        return evaluation.score;
 
-    double winchance = max(min(double(m_board->material_imbalance()) / 6, 1.0), -1.0);
+    double winchance = max(min(double(evaluation.score) / 6, 1.0), -1.0);
 
     double random = double(rand()) / RAND_MAX;
     if (winchance >= random)
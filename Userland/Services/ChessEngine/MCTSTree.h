@@ -19,6 +19,12 @@ public:
         Heuristic,
     };
 
+    struct Evaluation {
+        bool game_finished;
+        // The game score when the game is finished, the material imbalance otherwise.
+        int score;
+    };
+
     MCTSTree(Chess::Board const& board, MCTSTree* parent = nullptr);
     MCTSTree(MCTSTree&&);
 
@@ -41,6 +41,11 @@ Messages::ClipboardServer::GetClipboardDataResponse ConnectionFromClient::get_cl
     return { storage.buffer(), storage.mime_type(), storage.metadata() };
 }
 
+Messages::ClipboardServer::GetClipboardMimeTypeResponse ConnectionFromClient::get_clipboard_mime_type()
+{
+    return { Storage::the().mime_type() };
+}
+
 void ConnectionFromClient::notify_about_clipboard_change()
 {
     async_clipboard_data_changed(Storage::the().mime_type());
@@ -16,8 +16,8 @@ Storage& Storage::the()
 
 void Storage::set_data(Core::AnonymousBuffer data, DeprecatedString const& mime_type, HashMap<DeprecatedString, DeprecatedString> const& metadata)
 {
-    m_buffer = move(data);
     m_data_size = data.size();
+    m_buffer = move(data);
     m_mime_type = mime_type;
     m_metadata = metadata;
 
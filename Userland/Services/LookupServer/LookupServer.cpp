@@ -11,7 +11,9 @@
 #include <AK/HashMap.h>
 #include <AK/Random.h>
 #include <AK/StringBuilder.h>
+#include <AK/Time.h>
 #include <LibCore/ConfigFile.h>
+#include <LibCore/EventLoop.h>
 #include <LibCore/File.h>
 #include <LibCore/LocalServer.h>
 #include <LibCore/Stream.h>
@@ -171,15 +173,27 @@ ErrorOr<Vector<Answer>> LookupServer::lookup(Name const& name, RecordType record
 
     // Third, try our cache.
     if (auto cached_answers = m_lookup_cache.find(name); cached_answers != m_lookup_cache.end()) {
+        cached_answers->value.remove_all_matching([](Answer const& answer) { return answer.has_expired(); });
+        bool has_answer_close_to_expiry = false;
+        auto now = time(nullptr);
         for (auto& answer : cached_answers->value) {
-            // TODO: Actually remove expired answers from the cache.
-            if (answer.type() == record_type && !answer.has_expired()) {
+            if (answer.type() == record_type) {
                 dbgln_if(LOOKUPSERVER_DEBUG, "Cache hit: {} -> {}", name.as_string(), answer.record_data());
                 add_answer(answer);
+                if (answer.received_time() + answer.ttl() - now <= answer.ttl() / 10)
+                    has_answer_close_to_expiry = true;
             }
         }
-        if (!answers.is_empty())
+        bool cache_entry_is_empty = cached_answers->value.is_empty();
+        if (cache_entry_is_empty)
+            m_lookup_cache.remove(name);
+        if (!answers.is_empty()) {
+            // If the records we just served are about to expire, refresh them in
+            // the background so the next lookup doesn't have to wait for upstream.
+            if (has_answer_close_to_expiry)
+                maybe_refresh_in_background(name, record_type);
             return answers;
+        }
     }
 
     // Fourth, look up .local names using mDNS instead of DNS nameservers.
@@ -191,30 +205,9 @@ ErrorOr<Vector<Answer>> LookupServer::lookup(Name const& name, RecordType record
     }
 
     // Fifth, ask the upstream nameservers.
-    for (auto& nameserver : m_nameservers) {
-        dbgln_if(LOOKUPSERVER_DEBUG, "Doing lookup using nameserver '{}'", nameserver);
-        bool did_get_response = false;
-        int retries = 3;
-        Vector<Answer> upstream_answers;
-        do {
-            auto upstream_answers_or_error = lookup(name, nameserver, did_get_response, record_type);
-            if (upstream_answers_or_error.is_error())
-                continue;
-            upstream_answers = upstream_answers_or_error.release_value();
-            if (did_get_response)
-                break;
-        } while (--retries);
-        if (!upstream_answers.is_empty()) {
-            for (auto& answer : upstream_answers)
-                add_answer(answer);
-            break;
-        } else {
-            if (!did_get_response)
-                dbgln("Never got a response from '{}', trying next nameserver", nameserver);
-            else
-                dbgln("Received response from '{}' but no result(s), trying next nameserver", nameserver);
-        }
-    }
+    auto upstream_answers = TRY(lookup_upstream(name, record_type));
+    for (auto& answer : upstream_answers)
+        add_answer(answer);
 
     // Sixth, fail.
     if (answers.is_empty()) {
@@ -225,7 +218,7 @@ ErrorOr<Vector<Answer>> LookupServer::lookup(Name const& name, RecordType record
     return answers;
 }
 
-ErrorOr<Vector<Answer>> LookupServer::lookup(Name const& name, DeprecatedString const& nameserver, bool& did_get_response, RecordType record_type, ShouldRandomizeCase should_randomize_case)
+ErrorOr<Vector<Answer>> LookupServer::lookup_upstream(Name const& name, RecordType record_type, ShouldRandomizeCase should_randomize_case)
 {
     Packet request;
     request.set_is_query();
@@ -237,71 +230,149 @@ ErrorOr<Vector<Answer>> LookupServer::lookup(Name const& name, DeprecatedString
 
     auto buffer = TRY(request.to_byte_buffer());
 
-    auto udp_socket = TRY(Core::Stream::UDPSocket::connect(nameserver, 53, Time::from_seconds(1)));
-    TRY(udp_socket->set_blocking(true));
+    // Send the query to all nameservers at once and take the first usable
+    // response, instead of giving each one a full timeout (plus retries)
+    // before even trying the next one.
+    struct UpstreamQuery {
+        DeprecatedString nameserver;
+        NonnullOwnPtr<Core::Stream::UDPSocket> socket;
+    };
+    Vector<UpstreamQuery> queries;
+    for (auto& nameserver : m_nameservers) {
+        dbgln_if(LOOKUPSERVER_DEBUG, "Doing lookup using nameserver '{}'", nameserver);
+        auto socket_or_error = Core::Stream::UDPSocket::connect(nameserver, 53, Time::from_seconds(1));
+        if (socket_or_error.is_error()) {
+            dbgln("Failed to connect to nameserver '{}': {}", nameserver, socket_or_error.error());
+            continue;
+        }
+        auto socket = socket_or_error.release_value();
+        TRY(socket->set_blocking(true));
+        if (auto result = socket->write(buffer); result.is_error()) {
+            dbgln("Failed to send query to nameserver '{}': {}", nameserver, result.error());
+            continue;
+        }
+        queries.append({ nameserver, move(socket) });
+    }
 
-    TRY(udp_socket->write(buffer));
+    constexpr int poll_interval_in_ms = 50;
+    int retransmissions_left = 2;
+    auto deadline = Time::now_monotonic() + Time::from_seconds(1);
+    while (!queries.is_empty()) {
+        for (size_t i = 0; i < queries.size();) {
+            auto& query = queries[i];
+            auto can_read_or_error = query.socket->can_read_without_blocking(poll_interval_in_ms);
+            if (can_read_or_error.is_error() || !can_read_or_error.value()) {
+                ++i;
+                continue;
+            }
 
-    u8 response_buffer[4096];
-    int nrecv = TRY(udp_socket->read({ response_buffer, sizeof(response_buffer) })).size();
-    if (udp_socket->is_eof())
-        return Vector<Answer> {};
+            u8 response_buffer[4096];
+            auto nrecv_or_error = query.socket->read({ response_buffer, sizeof(response_buffer) });
+            if (nrecv_or_error.is_error()) {
+                queries.remove(i);
+                continue;
+            }
 
-    did_get_response = true;
+            auto o_response = Packet::from_raw_packet(response_buffer, nrecv_or_error.value().size());
+            if (!o_response.has_value()) {
+                queries.remove(i);
+                continue;
+            }
 
-    auto o_response = Packet::from_raw_packet(response_buffer, nrecv);
-    if (!o_response.has_value())
-        return Vector<Answer> {};
+            auto& response = o_response.value();
 
-    auto& response = o_response.value();
+            if (response.id() != request.id()) {
+                dbgln("LookupServer: ID mismatch ({} vs {}) :(", response.id(), request.id());
+                queries.remove(i);
+                continue;
+            }
 
-    if (response.id() != request.id()) {
-        dbgln("LookupServer: ID mismatch ({} vs {}) :(", response.id(), request.id());
-        return Vector<Answer> {};
-    }
+            if (response.code() == Packet::Code::REFUSED) {
+                if (should_randomize_case == ShouldRandomizeCase::Yes) {
+                    // Retry with 0x20 case randomization turned off.
+                    return lookup_upstream(name, record_type, ShouldRandomizeCase::No);
+                }
+                queries.remove(i);
+                continue;
+            }
 
-    if (response.code() == Packet::Code::REFUSED) {
-        if (should_randomize_case == ShouldRandomizeCase::Yes) {
-            // Retry with 0x20 case randomization turned off.
-            return lookup(name, nameserver, did_get_response, record_type, ShouldRandomizeCase::No);
-        }
-        return Vector<Answer> {};
-    }
+            if (response.question_count() != request.question_count()) {
+                dbgln("LookupServer: Question count ({} vs {}) :(", response.question_count(), request.question_count());
+                queries.remove(i);
+                continue;
+            }
 
-    if (response.question_count() != request.question_count()) {
-        dbgln("LookupServer: Question count ({} vs {}) :(", response.question_count(), request.question_count());
-        return Vector<Answer> {};
-    }
+            // Verify the questions in our request and in their response match, ignoring case.
+            bool questions_match = true;
+            for (size_t question_index = 0; question_index < request.question_count(); ++question_index) {
+                auto& request_question = request.questions()[question_index];
+                auto& response_question = response.questions()[question_index];
+                bool match = request_question.class_code() == response_question.class_code()
+                    && request_question.record_type() == response_question.record_type()
+                    && request_question.name().as_string().equals_ignoring_case(response_question.name().as_string());
+                if (!match) {
+                    dbgln("Request and response questions do not match");
+                    dbgln("   Request: name=_{}_, type={}, class={}", request_question.name().as_string(), response_question.record_type(), response_question.class_code());
+                    dbgln("  Response: name=_{}_, type={}, class={}", response_question.name().as_string(), response_question.record_type(), response_question.class_code());
+                    questions_match = false;
+                    break;
+                }
+            }
+            if (!questions_match) {
+                queries.remove(i);
+                continue;
+            }
+
+            if (response.answer_count() < 1) {
+                dbgln("Received response from '{}' but no result(s), waiting for the other nameservers", query.nameserver);
+                queries.remove(i);
+                continue;
+            }
+
+            Vector<Answer> answers;
+            for (auto& answer : response.answers()) {
+                put_in_cache(answer);
+                if (answer.type() != record_type)
+                    continue;
+                answers.append(answer);
+            }
+            return answers;
+        }
 
-    // Verify the questions in our request and in their response match, ignoring case.
-    for (size_t i = 0; i < request.question_count(); ++i) {
-        auto& request_question = request.questions()[i];
-        auto& response_question = response.questions()[i];
-        bool match = request_question.class_code() == response_question.class_code()
-            && request_question.record_type() == response_question.record_type()
-            && request_question.name().as_string().equals_ignoring_case(response_question.name().as_string());
-        if (!match) {
-            dbgln("Request and response questions do not match");
-            dbgln("   Request: name=_{}_, type={}, class={}", request_question.name().as_string(), response_question.record_type(), response_question.class_code());
-            dbgln("  Response: name=_{}_, type={}, class={}", response_question.name().as_string(), response_question.record_type(), response_question.class_code());
-            return Vector<Answer> {};
+        if (Time::now_monotonic() >= deadline) {
+            if (retransmissions_left-- == 0)
+                break;
+            // The queries may have been lost on the way; send them again.
+            for (auto& query : queries) {
+                if (auto result = query.socket->write(buffer); result.is_error())
+                    dbgln("Failed to resend query to nameserver '{}': {}", query.nameserver, result.error());
+            }
+            deadline = Time::now_monotonic() + Time::from_seconds(1);
         }
     }
 
-    if (response.answer_count() < 1) {
-        dbgln("LookupServer: No answers :(");
-        return Vector<Answer> {};
-    }
+    return Vector<Answer> {};
+}
 
-    Vector<Answer, 8> answers;
-    for (auto& answer : response.answers()) {
-        put_in_cache(answer);
-        if (answer.type() != record_type)
-            continue;
-        answers.append(answer);
-    }
+void LookupServer::maybe_refresh_in_background(Name const& name, RecordType record_type)
+{
+    // mDNS records don't come from the upstream nameservers, so don't refresh
+    // them there.
+    if (name.as_string().ends_with(".local"sv))
+        return;
 
-    return answers;
+    // Schedule at most one refresh per name at a time, so a burst of lookups
+    // for the same almost-expired name coalesces into a single upstream query.
+    if (m_names_being_refreshed.contains(name))
+        return;
+    m_names_being_refreshed.set(name);
+
+    Core::deferred_invoke([this, name, record_type] {
+        dbgln_if(LOOKUPSERVER_DEBUG, "Refreshing almost-expired records for '{}'", name.as_string());
+        if (auto result = lookup_upstream(name, record_type); result.is_error())
+            dbgln_if(LOOKUPSERVER_DEBUG, "Failed to refresh '{}': {}", name.as_string(), result.error());
+        m_names_being_refreshed.remove(name);
+    });
 }
 
 void LookupServer::put_in_cache(Answer const& answer)
@@ -331,6 +402,14 @@ void LookupServer::put_in_cache(Answer const& answer)
                 dbgln_if(LOOKUPSERVER_DEBUG, "Removing cache entry: {}", other_answer.name());
                 return true;
             });
+        } else {
+            // Replace any record with the same data, so refreshing an entry
+            // extends its lifetime instead of duplicating it.
+            it->value.remove_all_matching([&](Answer const& other_answer) {
+                return other_answer.type() == answer.type()
+                    && other_answer.class_code() == answer.class_code()
+                    && other_answer.record_data() == answer.record_data();
+            });
         }
         it->value.append(answer);
     }
@@ -9,6 +9,7 @@
 #include "ConnectionFromClient.h"
 #include "DNSServer.h"
 #include "MulticastDNS.h"
+#include <AK/HashTable.h>
 #include <LibCore/FileWatcher.h>
 #include <LibCore/Object.h>
 #include <LibDNS/Name.h>
@@ -31,8 +32,9 @@ private:
 
     void load_etc_hosts();
     void put_in_cache(Answer const&);
+    void maybe_refresh_in_background(Name const&, RecordType);
 
-    ErrorOr<Vector<Answer>> lookup(Name const& hostname, DeprecatedString const& nameserver, bool& did_get_response, RecordType record_type, ShouldRandomizeCase = ShouldRandomizeCase::Yes);
+    ErrorOr<Vector<Answer>> lookup_upstream(Name const& hostname, RecordType record_type, ShouldRandomizeCase = ShouldRandomizeCase::Yes);
 
     OwnPtr<IPC::MultiServer<ConnectionFromClient>> m_server;
     RefPtr<DNSServer> m_dns_server;
@@ -41,6 +43,7 @@ private:
     RefPtr<Core::FileWatcher> m_file_watcher;
     HashMap<Name, Vector<Answer>, Name::Traits> m_etc_hosts;
     HashMap<Name, Vector<Answer>, Name::Traits> m_lookup_cache;
+    HashTable<Name, Name::Traits> m_names_being_refreshed;
 };
 
 }
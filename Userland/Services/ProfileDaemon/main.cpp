@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/DeprecatedString.h>
+#include <LibCore/DateTime.h>
+#include <LibCore/EventLoop.h>
+#include <LibCore/Stream.h>
+#include <LibCore/System.h>
+#include <LibMain/Main.h>
+#include <serenity.h>
+#include <signal.h>
+
+static constexpr auto snapshot_directory = "/tmp/profiles"sv;
+
+static constexpr u64 event_mask = PERF_EVENT_SAMPLE | PERF_EVENT_MMAP | PERF_EVENT_MUNMAP | PERF_EVENT_PROCESS_CREATE
+    | PERF_EVENT_PROCESS_EXEC | PERF_EVENT_PROCESS_EXIT | PERF_EVENT_THREAD_CREATE | PERF_EVENT_THREAD_EXIT
+    | PERF_EVENT_SIGNPOST;
+
+static ErrorOr<void> write_snapshot()
+{
+    // Stop the profile timer while we serialize so the snapshot doesn't race
+    // new events. The global ring buffer (and its contents) stays alive.
+    TRY(Core::System::profiling_disable(-1));
+
+    auto profile_file = TRY(Core::Stream::File::open("/sys/kernel/profile"sv, Core::Stream::OpenMode::Read));
+    auto profile_data = TRY(profile_file->read_until_eof());
+
+    auto snapshot_path = DeprecatedString::formatted("{}/{}.profile", snapshot_directory, Core::DateTime::now().to_deprecated_string("%Y%m%d-%H%M%S"sv));
+    auto snapshot_file = TRY(Core::Stream::File::open(snapshot_path, Core::Stream::OpenMode::Write));
+    TRY(snapshot_file->write_entire_buffer(profile_data));
+
+    dbgln("ProfileDaemon: Wrote {} bytes to {}", profile_data.size(), snapshot_path);
+    return {};
+}
+
+ErrorOr<int> serenity_main(Main::Arguments)
+{
+    // NOTE: We can't pledge anything: the profiling syscalls require that no
+    //       promises have been made.
+
+    auto maybe_mkdir_error = Core::System::mkdir(snapshot_directory, 0755);
+    if (maybe_mkdir_error.is_error() && maybe_mkdir_error.error().code() != EEXIST)
+        return maybe_mkdir_error.release_error();
+
+    Core::EventLoop event_loop;
+
+    TRY(Core::System::profiling_enable(-1, event_mask));
+
+    // Anything that notices an incident (a watchdog, an OOM handler, or just
+    // a curious user) can ask for a snapshot of the recent past:
+    //
+    //     $ pls killall -USR1 ProfileDaemon
+    event_loop.register_signal(SIGUSR1, [](int) {
+        if (auto result = write_snapshot(); result.is_error())
+            dbgln("ProfileDaemon: Failed to write snapshot: {}", result.error());
+        if (auto result = Core::System::profiling_enable(-1, event_mask); result.is_error())
+            dbgln("ProfileDaemon: Failed to re-enable profiling: {}", result.error());
+    });
+
+    return event_loop.exec();
+}
@@ -14,6 +14,8 @@ namespace RequestServer::ConnectionCache {
 HashMap<ConnectionKey, NonnullOwnPtr<NonnullOwnPtrVector<Connection<Core::Stream::TCPSocket, Core::Stream::Socket>>>> g_tcp_connection_cache {};
 HashMap<ConnectionKey, NonnullOwnPtr<NonnullOwnPtrVector<Connection<TLS::TLSv12>>>> g_tls_connection_cache {};
 
+size_t g_max_connections_per_host = 4;
+
 void request_did_finish(URL const& url, Core::Stream::Socket const* socket)
 {
     if (!socket) {
@@ -37,7 +39,23 @@ void request_did_finish(URL const& url, Core::Stream::Socket const* socket)
         }
 
         auto& connection = *connection_it;
-        if (connection->request_queue.is_empty()) {
+        auto* queue_to_pull_from = &connection->request_queue;
+        if (queue_to_pull_from->is_empty()) {
+            // This connection has nothing queued, but a sibling connection to the same
+            // host might have requests backed up behind a slow response; pull the
+            // oldest one over instead of letting it wait while we go idle.
+            size_t longest_queue_size = 0;
+            for (auto& other_connection : *it->value) {
+                if (&other_connection == connection.ptr())
+                    continue;
+                if (other_connection.request_queue.size() > longest_queue_size) {
+                    queue_to_pull_from = &other_connection.request_queue;
+                    longest_queue_size = other_connection.request_queue.size();
+                }
+            }
+        }
+
+        if (queue_to_pull_from->is_empty()) {
             Core::deferred_invoke([&connection, &cache_entry = *it->value, key = it->key, &cache] {
                 connection->socket->set_notifications_enabled(false);
                 connection->has_started = false;
@@ -60,11 +78,12 @@ void request_did_finish(URL const& url, Core::Stream::Socket const* socket)
                 connection->job_data.fail(Core::NetworkJob::Error::ConnectionFailed);
                 return;
             }
-            Core::deferred_invoke([&, url] {
+            Core::deferred_invoke([&, url, job_data = queue_to_pull_from->take_first()]() mutable {
                 dbgln_if(REQUESTSERVER_DEBUG, "Running next job in queue for connection {} @{}", &connection, connection->socket);
                 connection->timer.start();
                 connection->current_url = url;
-                connection->job_data = connection->request_queue.take_first();
+                connection->requests_served++;
+                connection->job_data = move(job_data);
                 connection->socket->set_notifications_enabled(true);
                 connection->job_data.start(*connection->socket);
             });
@@ -85,7 +104,7 @@ void dump_jobs()
     for (auto& connection : g_tls_connection_cache) {
         dbgln(" - {}:{}", connection.key.hostname, connection.key.port);
         for (auto& entry : *connection.value) {
-            dbgln("  - Connection {} (started={}) (socket={})", &entry, entry.has_started, entry.socket);
+            dbgln("  - Connection {} (started={}) (socket={}) ({} requests served)", &entry, entry.has_started, entry.socket, entry.requests_served);
             dbgln("    Currently loading {} ({} elapsed)", entry.current_url, entry.timer.is_valid() ? entry.timer.elapsed() : 0);
             dbgln("    Request Queue:");
             for (auto& job : entry.request_queue)
@@ -96,7 +115,7 @@ void dump_jobs()
     for (auto& connection : g_tcp_connection_cache) {
         dbgln(" - {}:{}", connection.key.hostname, connection.key.port);
         for (auto& entry : *connection.value) {
-            dbgln("  - Connection {} (started={}) (socket={})", &entry, entry.has_started, entry.socket);
+            dbgln("  - Connection {} (started={}) (socket={}) ({} requests served)", &entry, entry.has_started, entry.socket, entry.requests_served);
             dbgln("    Currently loading {} ({} elapsed)", entry.current_url, entry.timer.is_valid() ? entry.timer.elapsed() : 0);
             dbgln("    Request Queue:");
             for (auto& job : entry.request_queue)
@@ -99,6 +99,7 @@ struct Connection {
     Core::ElapsedTimer timer {};
     JobData job_data {};
     Proxy proxy {};
+    size_t requests_served { 0 };
 };
 
 struct ConnectionKey {
@@ -127,7 +128,9 @@ extern HashMap<ConnectionKey, NonnullOwnPtr<NonnullOwnPtrVector<Connection<TLS::
 void request_did_finish(URL const&, Core::Stream::Socket const*);
 void dump_jobs();
 
-constexpr static size_t MaxConcurrentConnectionsPerURL = 4;
+// Overridable via the REQUEST_SERVER_CONNECTIONS_PER_HOST environment variable.
+extern size_t g_max_connections_per_host;
+
 constexpr static size_t ConnectionKeepAliveTimeMilliseconds = 10'000;
 
 template<typename T>
@@ -182,7 +185,7 @@ decltype(auto) get_or_create_connection(auto& cache, URL const& url, auto& job,
     auto it = sockets_for_url.find_if([](auto& connection) { return connection->request_queue.is_empty(); });
     auto did_add_new_connection = false;
     auto failed_to_find_a_socket = it.is_end();
-    if (failed_to_find_a_socket && sockets_for_url.size() < ConnectionCache::MaxConcurrentConnectionsPerURL) {
+    if (failed_to_find_a_socket && sockets_for_url.size() < ConnectionCache::g_max_connections_per_host) {
         using ConnectionType = RemoveCVReference<decltype(cache.begin()->value->at(0))>;
         auto connection_result = proxy.tunnel<typename ConnectionType::SocketType, typename ConnectionType::StorageType>(url);
         if (connection_result.is_error()) {
@@ -246,6 +249,7 @@ decltype(auto) get_or_create_connection(auto& cache, URL const& url, auto& job,
         connection.removal_timer->stop();
         connection.timer.start();
         connection.current_url = url;
+        connection.requests_served++;
         connection.job_data = decltype(connection.job_data)::create(job);
         connection.socket->set_notifications_enabled(true);
         connection.job_data.start(*connection.socket);
@@ -40,22 +40,23 @@ Messages::RequestServer::StartRequestResponse ConnectionFromClient::start_reques
 {
     if (!url.is_valid()) {
         dbgln("StartRequest: Invalid URL requested: '{}'", url);
-        return { -1, Optional<IPC::File> {} };
+        return { -1, Optional<IPC::File> {}, Core::AnonymousBuffer {} };
     }
     auto* protocol = Protocol::find_by_name(url.scheme());
     if (!protocol) {
         dbgln("StartRequest: No protocol handler for URL: '{}'", url);
-        return { -1, Optional<IPC::File> {} };
+        return { -1, Optional<IPC::File> {}, Core::AnonymousBuffer {} };
     }
     auto request = protocol->start_request(*this, method, url, request_headers.entries(), request_body, proxy_data);
     if (!request) {
         dbgln("StartRequest: Protocol handler failed to start request: '{}'", url);
-        return { -1, Optional<IPC::File> {} };
+        return { -1, Optional<IPC::File> {}, Core::AnonymousBuffer {} };
     }
     auto id = request->id();
     auto fd = request->request_fd();
+    auto response_buffer = request->response_buffer();
     m_requests.set(id, move(request));
-    return { id, IPC::File(fd, IPC::File::CloseAfterSending) };
+    return { id, IPC::File(fd, IPC::File::CloseAfterSending), move(response_buffer) };
 }
 
 Messages::RequestServer::StopRequestResponse ConnectionFromClient::stop_request(i32 request_id)
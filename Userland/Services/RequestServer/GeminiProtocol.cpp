@@ -9,6 +9,7 @@
 #include <LibGemini/Job.h>
 #include <RequestServer/GeminiProtocol.h>
 #include <RequestServer/GeminiRequest.h>
+#include <RequestServer/ResponseStream.h>
 
 namespace RequestServer {
 
@@ -22,14 +23,15 @@ OwnPtr<Request> GeminiProtocol::start_request(ConnectionFromClient& client, Depr
     Gemini::GeminiRequest request;
     request.set_url(url);
 
-    auto pipe_result = get_pipe_for_request();
-    if (pipe_result.is_error())
+    auto output_stream_result = ResponseStream::create();
+    if (output_stream_result.is_error())
         return {};
 
-    auto output_stream = MUST(Core::Stream::File::adopt_fd(pipe_result.value().write_fd, Core::Stream::OpenMode::Write));
+    auto output_stream = output_stream_result.release_value();
+    auto client_fd = output_stream->release_client_fd();
     auto job = Gemini::Job::construct(request, *output_stream);
     auto protocol_request = GeminiRequest::create_with_job({}, client, *job, move(output_stream));
-    protocol_request->set_request_fd(pipe_result.value().read_fd);
+    protocol_request->set_request_fd(client_fd);
 
     ConnectionCache::get_or_create_connection(ConnectionCache::g_tls_connection_cache, url, *job, proxy_data);
 
@@ -17,6 +17,7 @@
 #include <RequestServer/ConnectionCache.h>
 #include <RequestServer/ConnectionFromClient.h>
 #include <RequestServer/Request.h>
+#include <RequestServer/ResponseStream.h>
 
 namespace RequestServer::Detail {
 
@@ -60,13 +61,13 @@ void init(TSelf* self, TJob job)
     }
 }
 
-template<typename TBadgedProtocol, typename TPipeResult>
-OwnPtr<Request> start_request(TBadgedProtocol&& protocol, ConnectionFromClient& client, DeprecatedString const& method, const URL& url, HashMap<DeprecatedString, DeprecatedString> const& headers, ReadonlyBytes body, TPipeResult&& pipe_result, Core::ProxyData proxy_data = {})
+template<typename TBadgedProtocol>
+OwnPtr<Request> start_request(TBadgedProtocol&& protocol, ConnectionFromClient& client, DeprecatedString const& method, const URL& url, HashMap<DeprecatedString, DeprecatedString> const& headers, ReadonlyBytes body, ErrorOr<NonnullOwnPtr<ResponseStream>> output_stream_result, Core::ProxyData proxy_data = {})
 {
     using TJob = typename TBadgedProtocol::Type::JobType;
     using TRequest = typename TBadgedProtocol::Type::RequestType;
 
-    if (pipe_result.is_error()) {
+    if (output_stream_result.is_error()) {
         return {};
     }
 
@@ -97,10 +98,11 @@ OwnPtr<Request> start_request(TBadgedProtocol&& protocol, ConnectionFromClient&
         return {};
     request.set_body(allocated_body_result.release_value());
 
-    auto output_stream = MUST(Core::Stream::File::adopt_fd(pipe_result.value().write_fd, Core::Stream::OpenMode::Write));
+    auto output_stream = output_stream_result.release_value();
+    auto client_fd = output_stream->release_client_fd();
     auto job = TJob::construct(move(request), *output_stream);
     auto protocol_request = TRequest::create_with_job(forward<TBadgedProtocol>(protocol), client, (TJob&)*job, move(output_stream));
-    protocol_request->set_request_fd(pipe_result.value().read_fd);
+    protocol_request->set_request_fd(client_fd);
 
     if constexpr (IsSame<typename TBadgedProtocol::Type, HttpsProtocol>)
         ConnectionCache::get_or_create_connection(ConnectionCache::g_tls_connection_cache, url, *job, proxy_data);
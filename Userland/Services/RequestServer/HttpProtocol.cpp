@@ -14,6 +14,7 @@
 #include <RequestServer/HttpCommon.h>
 #include <RequestServer/HttpProtocol.h>
 #include <RequestServer/Request.h>
+#include <RequestServer/ResponseStream.h>
 
 namespace RequestServer {
 
@@ -24,7 +25,7 @@ HttpProtocol::HttpProtocol()
 
 OwnPtr<Request> HttpProtocol::start_request(ConnectionFromClient& client, DeprecatedString const& method, const URL& url, HashMap<DeprecatedString, DeprecatedString> const& headers, ReadonlyBytes body, Core::ProxyData proxy_data)
 {
-    return Detail::start_request(Badge<HttpProtocol> {}, client, method, url, headers, body, get_pipe_for_request(), proxy_data);
+    return Detail::start_request(Badge<HttpProtocol> {}, client, method, url, headers, body, ResponseStream::create(), proxy_data);
 }
 
 }
@@ -6,10 +6,6 @@
 
 #include <AK/HashMap.h>
 #include <RequestServer/Protocol.h>
-#include <errno.h>
-#include <fcntl.h>
-#include <string.h>
-#include <unistd.h>
 
 namespace RequestServer {
 
@@ -35,16 +31,4 @@ Protocol::~Protocol()
     VERIFY_NOT_REACHED();
 }
 
-ErrorOr<Protocol::Pipe> Protocol::get_pipe_for_request()
-{
-    int fd_pair[2] { 0 };
-    if (pipe(fd_pair) != 0) {
-        auto saved_errno = errno;
-        dbgln("Protocol: pipe() failed: {}", strerror(saved_errno));
-        return Error::from_errno(saved_errno);
-    }
-    fcntl(fd_pair[1], F_SETFL, fcntl(fd_pair[1], F_GETFL) | O_NONBLOCK);
-    return Pipe { fd_pair[0], fd_pair[1] };
-}
-
 }
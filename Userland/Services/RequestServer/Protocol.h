@@ -24,11 +24,6 @@ public:
 
 protected:
     explicit Protocol(DeprecatedString const& name);
-    struct Pipe {
-        int read_fd { -1 };
-        int write_fd { -1 };
-    };
-    static ErrorOr<Pipe> get_pipe_for_request();
 
 private:
     DeprecatedString m_name;
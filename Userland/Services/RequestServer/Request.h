@@ -12,6 +12,7 @@
 #include <AK/RefCounted.h>
 #include <AK/URL.h>
 #include <RequestServer/Forward.h>
+#include <RequestServer/ResponseStream.h>
 
 namespace RequestServer {
 
@@ -33,6 +34,7 @@ public:
     // FIXME: Want Badge<Protocol>, but can't make one from HttpProtocol, etc.
     void set_request_fd(int fd) { m_request_fd = fd; }
     int request_fd() const { return m_request_fd; }
+    Core::AnonymousBuffer const& response_buffer() const { return m_output_stream->buffer(); }
 
     void did_finish(bool success);
     void did_progress(Optional<u32> total_size, u32 downloaded_size);
@@ -40,10 +42,10 @@ public:
     void did_request_certificates();
     void set_response_headers(HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> const&);
     void set_downloaded_size(size_t size) { m_downloaded_size = size; }
-    Core::Stream::File const& output_stream() const { return *m_output_stream; }
+    ResponseStream const& output_stream() const { return *m_output_stream; }
 
 protected:
-    explicit Request(ConnectionFromClient&, NonnullOwnPtr<Core::Stream::File>&&);
+    explicit Request(ConnectionFromClient&, NonnullOwnPtr<ResponseStream>&&);
 
 private:
     ConnectionFromClient& m_client;
@@ -52,7 +54,7 @@ private:
     Optional<u32> m_status_code;
     Optional<u32> m_total_size {};
     size_t m_downloaded_size { 0 };
-    NonnullOwnPtr<Core::Stream::File> m_output_stream;
+    NonnullOwnPtr<ResponseStream> m_output_stream;
     HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> m_response_headers;
 };
 
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <RequestServer/ResponseStream.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace RequestServer {
+
+ErrorOr<NonnullOwnPtr<ResponseStream>> ResponseStream::create()
+{
+    auto buffer = TRY(Core::AnonymousBuffer::create_with_size(ResponseBufferSize));
+
+    int fd_pair[2] { -1, -1 };
+    if (socketpair(AF_LOCAL, SOCK_STREAM, 0, fd_pair) != 0)
+        return Error::from_errno(errno);
+    // Frame writes and acknowledgement reads must never block the event loop.
+    fcntl(fd_pair[1], F_SETFL, fcntl(fd_pair[1], F_GETFL) | O_NONBLOCK);
+
+    return adopt_own(*new ResponseStream(move(buffer), fd_pair[1], fd_pair[0]));
+}
+
+ResponseStream::ResponseStream(Core::AnonymousBuffer buffer, int server_fd, int client_fd)
+    : m_buffer(move(buffer))
+    , m_server_fd(server_fd)
+    , m_client_fd(client_fd)
+    , m_free_space(ResponseBufferSize)
+{
+}
+
+ResponseStream::~ResponseStream()
+{
+    close();
+}
+
+int ResponseStream::release_client_fd()
+{
+    return exchange(m_client_fd, -1);
+}
+
+void ResponseStream::drain_acknowledgements()
+{
+    for (;;) {
+        u8 buffer[256];
+        memcpy(buffer, m_partial_acknowledgement, m_partial_acknowledgement_size);
+        auto nread = ::read(m_server_fd, buffer + m_partial_acknowledgement_size, sizeof(buffer) - m_partial_acknowledgement_size);
+        if (nread <= 0)
+            return;
+        size_t total_size = m_partial_acknowledgement_size + nread;
+        size_t offset = 0;
+        for (; offset + sizeof(u32) <= total_size; offset += sizeof(u32)) {
+            u32 consumed_bytes = 0;
+            memcpy(&consumed_bytes, buffer + offset, sizeof(consumed_bytes));
+            m_free_space = min(m_free_space + consumed_bytes, ResponseBufferSize);
+        }
+        m_partial_acknowledgement_size = total_size - offset;
+        memcpy(m_partial_acknowledgement, buffer + offset, m_partial_acknowledgement_size);
+    }
+}
+
+bool ResponseStream::flush_pending_frame()
+{
+    if (m_pending_frame_size == 0)
+        return true;
+    auto nwritten = ::write(m_server_fd, m_pending_frame, m_pending_frame_size);
+    if (nwritten <= 0)
+        return false;
+    m_pending_frame_size -= nwritten;
+    memmove(m_pending_frame, m_pending_frame + nwritten, m_pending_frame_size);
+    return m_pending_frame_size == 0;
+}
+
+ErrorOr<Bytes> ResponseStream::read(Bytes)
+{
+    return Error::from_errno(EBADF);
+}
+
+ErrorOr<size_t> ResponseStream::write(ReadonlyBytes bytes)
+{
+    if (m_server_fd < 0)
+        return Error::from_errno(EBADF);
+
+    drain_acknowledgements();
+
+    // The NetworkJob machinery treats EAGAIN like a full pipe: it keeps the
+    // data buffered and retries the flush later.
+    if (!flush_pending_frame())
+        return Error::from_errno(EAGAIN);
+    if (m_free_space == 0)
+        return Error::from_errno(EAGAIN);
+
+    auto contiguous_space = min(m_free_space, ResponseBufferSize - m_write_offset);
+    auto length = min(bytes.size(), contiguous_space);
+    memcpy(m_buffer.data<u8>() + m_write_offset, bytes.data(), length);
+
+    ResponseChunkHeader header { static_cast<u32>(m_write_offset), static_cast<u32>(length) };
+    memcpy(m_pending_frame, &header, sizeof(header));
+    m_pending_frame_size = sizeof(header);
+    // The client only learns about ring contents through frames, so if the
+    // frame can't go out at all nothing has been committed yet.
+    if (!flush_pending_frame() && m_pending_frame_size == sizeof(header)) {
+        m_pending_frame_size = 0;
+        return Error::from_errno(EAGAIN);
+    }
+
+    m_write_offset = (m_write_offset + length) % ResponseBufferSize;
+    m_free_space -= length;
+    return length;
+}
+
+bool ResponseStream::is_eof() const
+{
+    return false;
+}
+
+bool ResponseStream::is_open() const
+{
+    return m_server_fd >= 0;
+}
+
+void ResponseStream::close()
+{
+    if (m_server_fd >= 0)
+        ::close(exchange(m_server_fd, -1));
+    if (m_client_fd >= 0)
+        ::close(exchange(m_client_fd, -1));
+}
+
+}
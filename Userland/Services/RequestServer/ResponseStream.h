@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Types.h>
+#include <LibCore/AnonymousBuffer.h>
+#include <LibCore/Stream.h>
+
+namespace RequestServer {
+
+// Response bodies are handed to the client through a shared memory ring
+// (a Core::AnonymousBuffer) instead of being copied through a pipe: the
+// server writes each chunk into the ring exactly once, and the client
+// reads it out exactly once. The socketpair that replaced the pipe only
+// carries ResponseChunkHeader frames describing ring contents one way,
+// and consumed-byte counts (plain u32s) back the other way so the server
+// knows when ring space may be reused.
+
+static constexpr size_t ResponseBufferSize = 1 * MiB;
+
+struct [[gnu::packed]] ResponseChunkHeader {
+    u32 offset;
+    u32 length;
+};
+
+class ResponseStream final : public Core::Stream::Stream {
+public:
+    static ErrorOr<NonnullOwnPtr<ResponseStream>> create();
+    virtual ~ResponseStream() override;
+
+    Core::AnonymousBuffer const& buffer() const { return m_buffer; }
+    // The returned fd is to be handed to the client; the caller takes ownership.
+    int release_client_fd();
+
+    virtual ErrorOr<Bytes> read(Bytes) override;
+    virtual ErrorOr<size_t> write(ReadonlyBytes) override;
+    virtual bool is_eof() const override;
+    virtual bool is_open() const override;
+    virtual void close() override;
+
+private:
+    ResponseStream(Core::AnonymousBuffer, int server_fd, int client_fd);
+
+    void drain_acknowledgements();
+    bool flush_pending_frame();
+
+    Core::AnonymousBuffer m_buffer;
+    int m_server_fd { -1 };
+    int m_client_fd { -1 };
+    size_t m_write_offset { 0 };
+    size_t m_free_space { 0 };
+
+    // Frames and acknowledgements travel over a stream socket, so either
+    // can get cut short when a buffer fills up; stash the leftover bytes.
+    u8 m_pending_frame[sizeof(ResponseChunkHeader)] {};
+    size_t m_pending_frame_size { 0 };
+    u8 m_partial_acknowledgement[sizeof(u32)] {};
+    size_t m_partial_acknowledgement_size { 0 };
+};
+
+}
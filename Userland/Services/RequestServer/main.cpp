@@ -16,6 +16,8 @@
 #include <RequestServer/HttpProtocol.h>
 #include <RequestServer/HttpsProtocol.h>
 #include <signal.h>
+#include <stdlib.h>
+#include <string.h>
 
 ErrorOr<int> serenity_main(Main::Arguments)
 {
@@ -36,6 +38,12 @@ ErrorOr<int> serenity_main(Main::Arguments)
     // Ensure the certificates are read out here.
     [[maybe_unused]] auto& certs = DefaultRootCACertificates::the();
 
+    if (auto* maximum_connections = getenv("REQUEST_SERVER_CONNECTIONS_PER_HOST")) {
+        auto maximum = StringView { maximum_connections, strlen(maximum_connections) }.to_uint();
+        if (maximum.has_value() && maximum.value() > 0)
+            RequestServer::ConnectionCache::g_max_connections_per_host = maximum.value();
+    }
+
     Core::EventLoop event_loop;
     // FIXME: Establish a connection to LookupServer and then drop "unix"?
     TRY(Core::System::unveil("/tmp/portal/lookup", "rw"));
@@ -68,7 +68,19 @@ SQL::ResultOr<SQL::StatementID> DatabaseConnection::prepare_statement(StringView
 {
     dbgln_if(SQLSERVER_DEBUG, "DatabaseConnection::prepare_statement(connection_id {}, database '{}', sql '{}'", connection_id(), m_database_name, sql);
 
+    // Preparing the same text again reuses the already-parsed statement, so
+    // clients that re-prepare a fixed query per execution don't pay for
+    // parsing every time.
+    auto statement_text = DeprecatedString { sql };
+    if (auto cached_statement_id = m_prepared_statements.get(statement_text); cached_statement_id.has_value()) {
+        // The cached statement may have removed itself after a failed execution.
+        if (SQLStatement::statement_for(*cached_statement_id))
+            return *cached_statement_id;
+        m_prepared_statements.remove(statement_text);
+    }
+
     auto statement = TRY(SQLStatement::create(*this, sql));
+    m_prepared_statements.set(move(statement_text), statement->statement_id());
     return statement->statement_id();
 }
 
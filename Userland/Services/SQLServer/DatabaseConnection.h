@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
 #include <AK/NonnullRefPtr.h>
 #include <LibCore/Object.h>
 #include <LibSQL/Database.h>
@@ -34,6 +35,9 @@ private:
     DatabaseConnection(NonnullRefPtr<SQL::Database> database, DeprecatedString database_name, int client_id);
 
     NonnullRefPtr<SQL::Database> m_database;
+    // Maps already-prepared statement text to its statement, so repeated
+    // prepares of the same query skip the parser.
+    HashMap<DeprecatedString, SQL::StatementID> m_prepared_statements;
     DeprecatedString m_database_name;
     SQL::ConnectionID m_connection_id { 0 };
     int m_client_id { 0 };
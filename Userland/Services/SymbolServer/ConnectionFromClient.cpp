@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include "ConnectionFromClient.h"
+#include <AK/HashMap.h>
+#include <LibSymbolication/Symbolication.h>
+
+namespace SymbolServer {
+
+static HashMap<int, RefPtr<ConnectionFromClient>> s_connections;
+
+ConnectionFromClient::ConnectionFromClient(NonnullOwnPtr<Core::Stream::LocalSocket> client_socket, int client_id)
+    : IPC::ConnectionFromClient<SymbolClientEndpoint, SymbolServerEndpoint>(*this, move(client_socket), client_id)
+{
+    s_connections.set(client_id, *this);
+}
+
+void ConnectionFromClient::die()
+{
+    s_connections.remove(client_id());
+}
+
+Messages::SymbolServer::SymbolicateResponse ConnectionFromClient::symbolicate(DeprecatedString const& path, u64 address, bool include_source_positions)
+{
+    // symbolicate_locally() keeps a process-wide cache of parsed binaries, so
+    // every client connection shares the work of parsing each binary once.
+    auto result = Symbolication::symbolicate_locally(path, address,
+        include_source_positions ? Symbolication::IncludeSourcePosition::Yes : Symbolication::IncludeSourcePosition::No);
+    if (!result.has_value())
+        return { false, {}, 0, {}, {} };
+
+    Vector<DeprecatedString> source_position_files;
+    Vector<u32> source_position_lines;
+    for (auto const& position : result->source_positions) {
+        source_position_files.append(position.file_path);
+        source_position_lines.append(position.line_number);
+    }
+    return { true, result->name, result->offset, move(source_position_files), move(source_position_lines) };
+}
+
+}
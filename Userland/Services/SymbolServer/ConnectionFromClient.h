@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibIPC/ConnectionFromClient.h>
+#include <SymbolServer/SymbolClientEndpoint.h>
+#include <SymbolServer/SymbolServerEndpoint.h>
+
+namespace SymbolServer {
+
+class ConnectionFromClient final : public IPC::ConnectionFromClient<SymbolClientEndpoint, SymbolServerEndpoint> {
+    C_OBJECT(ConnectionFromClient)
+public:
+    ~ConnectionFromClient() override = default;
+
+    virtual void die() override;
+
+private:
+    explicit ConnectionFromClient(NonnullOwnPtr<Core::Stream::LocalSocket>, int client_id);
+
+    virtual Messages::SymbolServer::SymbolicateResponse symbolicate(DeprecatedString const& path, u64 address, bool include_source_positions) override;
+};
+
+}
@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include "ConnectionFromClient.h"
+#include <LibCore/EventLoop.h>
+#include <LibCore/System.h>
+#include <LibIPC/MultiServer.h>
+#include <LibMain/Main.h>
+
+ErrorOr<int> serenity_main(Main::Arguments)
+{
+    TRY(Core::System::pledge("stdio rpath accept"));
+    TRY(Core::System::unveil("/bin"sv, "r"sv));
+    TRY(Core::System::unveil("/usr/bin"sv, "r"sv));
+    TRY(Core::System::unveil("/usr/lib"sv, "r"sv));
+    TRY(Core::System::unveil("/usr/local"sv, "r"sv));
+    TRY(Core::System::unveil("/boot/Kernel.debug"sv, "r"sv));
+    TRY(Core::System::unveil(nullptr, nullptr));
+
+    Core::EventLoop event_loop;
+
+    auto server = TRY(IPC::MultiServer<SymbolServer::ConnectionFromClient>::try_create());
+    return event_loop.exec();
+}
@@ -103,6 +103,13 @@ void ConnectionFromClient::load_url(const URL& url)
     page().load(url);
 }
 
+void ConnectionFromClient::load_history_entry(const URL& url)
+{
+    dbgln_if(SPAM_DEBUG, "handle: WebContentServer::LoadHistoryEntry: url={}", url);
+
+    page().load_history_entry(url);
+}
+
 void ConnectionFromClient::load_html(DeprecatedString const& html, const URL& url)
 {
     dbgln_if(SPAM_DEBUG, "handle: WebContentServer::LoadHTML: html={}, url={}", html, url);
@@ -104,9 +104,32 @@ Web::Layout::InitialContainingBlock* PageHost::layout_root()
     return document->layout_node();
 }
 
+// Content that's positioned relative to the viewport rather than the document
+// (position:fixed boxes, background-attachment:fixed layers) must be repainted
+// on every scroll, so its presence disables blitting from the previous frame.
+static bool has_viewport_attached_content(Web::Layout::InitialContainingBlock const& layout_root)
+{
+    bool result = false;
+    layout_root.for_each_in_subtree([&](auto const& node) {
+        if (node.is_fixed_position()) {
+            result = true;
+            return IterationDecision::Break;
+        }
+        if (is<Web::Layout::NodeWithStyle>(node)) {
+            for (auto const& layer : static_cast<Web::Layout::NodeWithStyle const&>(node).computed_values().background_layers()) {
+                if (layer.attachment == Web::CSS::BackgroundAttachment::Fixed) {
+                    result = true;
+                    return IterationDecision::Break;
+                }
+            }
+        }
+        return IterationDecision::Continue;
+    });
+    return result;
+}
+
 void PageHost::paint(Web::DevicePixelRect const& content_rect, Gfx::Bitmap& target)
 {
-    Gfx::Painter painter(target);
     Gfx::IntRect bitmap_rect { {}, content_rect.size().to_type<int>() };
 
     if (auto* document = page().top_level_browsing_context().active_document())
@@ -114,15 +137,57 @@ void PageHost::paint(Web::DevicePixelRect const& content_rect, Gfx::Bitmap& targ
 
     auto* layout_root = this->layout_root();
     if (!layout_root) {
+        Gfx::Painter painter(target);
         painter.fill_rect(bitmap_rect, palette().base());
         return;
     }
 
-    Web::PaintContext context(painter, palette(), device_pixels_per_css_pixel());
-    context.set_should_show_line_box_borders(m_should_show_line_box_borders);
-    context.set_device_viewport_rect(content_rect);
-    context.set_has_focus(m_has_focus);
-    layout_root->paint_all_phases(context);
+    auto paint_into = [&](Optional<Gfx::IntRect> const& clip_rect) {
+        Gfx::Painter painter(target);
+        if (clip_rect.has_value())
+            painter.add_clip_rect(*clip_rect);
+        Web::PaintContext context(painter, palette(), device_pixels_per_css_pixel());
+        context.set_should_show_line_box_borders(m_should_show_line_box_borders);
+        context.set_device_viewport_rect(content_rect);
+        context.set_has_focus(m_has_focus);
+        layout_root->paint_all_phases(context);
+    };
+
+    // OPTIMIZATION: When scrolling a page that hasn't otherwise changed, the previous
+    //               frame already contains most of the pixels we need. Blit the overlap
+    //               from the cached frame and repaint only the newly exposed strips.
+    bool can_blit_from_cached_frame = m_cached_frame
+        && m_cached_frame_dirty_rect.is_empty()
+        && m_cached_frame_scale == device_pixels_per_css_pixel()
+        && m_cached_frame_rect.size() == content_rect.size()
+        && m_cached_frame->size() == target.size()
+        && m_cached_frame_rect.intersects(content_rect)
+        && !has_viewport_attached_content(*layout_root);
+
+    if (can_blit_from_cached_frame) {
+        auto overlap = m_cached_frame_rect.intersected(content_rect);
+        auto source_rect = overlap.translated(-m_cached_frame_rect.location()).to_type<int>();
+        auto destination_rect = overlap.translated(-content_rect.location()).to_type<int>();
+        Gfx::Painter painter(target);
+        painter.blit(destination_rect.location(), *m_cached_frame, source_rect);
+        for (auto const& exposed_rect : bitmap_rect.shatter(destination_rect))
+            paint_into(exposed_rect);
+    } else {
+        paint_into({});
+    }
+
+    // Retain this frame so the next scroll step can blit from it.
+    if (m_cached_frame && m_cached_frame->size() == target.size()) {
+        Gfx::Painter cache_painter(*m_cached_frame);
+        cache_painter.blit({}, target, target.rect());
+    } else if (auto cached_frame_or_error = target.clone(); !cached_frame_or_error.is_error()) {
+        m_cached_frame = cached_frame_or_error.release_value();
+    } else {
+        m_cached_frame = nullptr;
+    }
+    m_cached_frame_rect = content_rect;
+    m_cached_frame_dirty_rect = {};
+    m_cached_frame_scale = device_pixels_per_css_pixel();
 }
 
 void PageHost::set_viewport_rect(Web::DevicePixelRect const& rect)
@@ -133,6 +198,7 @@ void PageHost::set_viewport_rect(Web::DevicePixelRect const& rect)
 void PageHost::page_did_invalidate(Web::CSSPixelRect const& content_rect)
 {
     m_invalidation_rect = m_invalidation_rect.united(page().enclosing_device_rect(content_rect));
+    m_cached_frame_dirty_rect = m_cached_frame_dirty_rect.united(page().enclosing_device_rect(content_rect));
     if (!m_invalidation_coalescing_timer->is_active())
         m_invalidation_coalescing_timer->start();
 }
@@ -115,6 +115,13 @@ private:
 
     RefPtr<Web::Platform::Timer> m_invalidation_coalescing_timer;
     Web::DevicePixelRect m_invalidation_rect;
+
+    // The previous frame is retained so scrolling can blit the overlapping pixels
+    // from it instead of repainting them; see PageHost::paint().
+    RefPtr<Gfx::Bitmap> m_cached_frame;
+    Web::DevicePixelRect m_cached_frame_rect;
+    Web::DevicePixelRect m_cached_frame_dirty_rect;
+    float m_cached_frame_scale { 0 };
     Web::CSS::PreferredColorScheme m_preferred_color_scheme { Web::CSS::PreferredColorScheme::Auto };
 
     RefPtr<WebDriverConnection> m_webdriver;
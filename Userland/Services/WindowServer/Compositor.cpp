@@ -87,6 +87,25 @@ Gfx::Color Compositor::color_at_position(Badge<ConnectionFromClient>, Screen& sc
     return screen.compositor_screen_data().m_front_bitmap->get_pixel(position);
 }
 
+Gfx::IntRect Compositor::take_screen_capture_damage(Badge<ConnectionFromClient>, Screen& screen)
+{
+    // The first call starts damage tracking and reports the whole screen as
+    // damaged, giving the client a complete frame to apply future deltas to.
+    if (!m_screen_capture_damage_tracking) {
+        m_screen_capture_damage_tracking = true;
+        m_screen_capture_damage.clear_with_capacity();
+        return { {}, screen.rect().size() };
+    }
+
+    auto screen_damage = m_screen_capture_damage.intersected(screen.rect());
+    m_screen_capture_damage = m_screen_capture_damage.shatter(screen.rect());
+
+    Gfx::IntRect bounding_rect;
+    for (auto& rect : screen_damage.rects())
+        bounding_rect = bounding_rect.is_empty() ? rect : bounding_rect.united(rect);
+    return bounding_rect.translated(-screen.rect().location());
+}
+
 void CompositorScreenData::init_bitmaps(Compositor& compositor, Screen& screen)
 {
     // Recreate the screen-number overlay as the Screen instances may have changed, or get rid of it if we no longer need it
@@ -189,6 +208,9 @@ void Compositor::compose()
     VERIFY(!m_overlay_rects_changed);
 
     auto dirty_screen_rects = move(m_dirty_screen_rects);
+    // Repeated invalidations can leave the damage badly fragmented, and every rect
+    // below is intersected with every window; merge what we can before that.
+    dirty_screen_rects.coalesce();
 
     bool window_stack_transition_in_progress = m_transitioning_to_window_stack != nullptr;
 
@@ -287,6 +309,8 @@ void Compositor::compose()
         VERIFY(!screen_data.m_flush_transparent_rects.intersects(rect));
         screen_data.m_have_flush_rects = true;
         screen_data.m_flush_rects.add(rect);
+        if (m_screen_capture_damage_tracking)
+            m_screen_capture_damage.add(rect);
         check_restore_cursor_back(screen, rect);
     };
 
@@ -301,6 +325,8 @@ void Compositor::compose()
 
         screen_data.m_have_flush_rects = true;
         screen_data.m_flush_transparent_rects.add(rect);
+        if (m_screen_capture_damage_tracking)
+            m_screen_capture_damage.add(rect);
         check_restore_cursor_back(screen, rect);
     };
 
@@ -743,6 +769,8 @@ void Compositor::invalidate_screen()
 void Compositor::invalidate_screen(Gfx::IntRect const& screen_rect)
 {
     m_dirty_screen_rects.add(screen_rect.intersected(Screen::bounding_rect()));
+    if (m_screen_capture_damage_tracking)
+        m_screen_capture_damage.add(screen_rect.intersected(Screen::bounding_rect()));
 
     if (m_invalidated_any)
         return;
@@ -755,6 +783,8 @@ void Compositor::invalidate_screen(Gfx::IntRect const& screen_rect)
 void Compositor::invalidate_screen(Gfx::DisjointIntRectSet const& rects)
 {
     m_dirty_screen_rects.add(rects.intersected(Screen::bounding_rect()));
+    if (m_screen_capture_damage_tracking)
+        m_screen_capture_damage.add(rects.intersected(Screen::bounding_rect()));
 
     if (m_invalidated_any)
         return;
@@ -1015,6 +1045,8 @@ void CompositorScreenData::draw_cursor(Screen& screen, Gfx::IntRect const& curso
     m_back_painter->blit(cursor_blit_pos, current_cursor.bitmap(screen.scale_factor()), cursor_src_rect);
 
     m_flush_special_rects.add(Gfx::IntRect(cursor_rect.location(), cursor_rect.size()).intersected(screen.rect()));
+    if (compositor.m_screen_capture_damage_tracking)
+        compositor.m_screen_capture_damage.add(cursor_rect.intersected(screen.rect()));
     m_have_flush_rects = true;
     m_last_cursor_rect = cursor_rect;
     VERIFY(compositor.m_current_cursor_screen == &screen);
@@ -1029,6 +1061,9 @@ bool CompositorScreenData::restore_cursor_back(Screen& screen, Gfx::IntRect& las
     last_cursor_rect = m_last_cursor_rect.intersected(screen.rect());
     m_back_painter->blit(last_cursor_rect.location(), *m_cursor_back_bitmap, { { 0, 0 }, last_cursor_rect.size() });
     m_flush_special_rects.add(last_cursor_rect.intersected(screen.rect()));
+    auto& compositor = Compositor::the();
+    if (compositor.m_screen_capture_damage_tracking)
+        compositor.m_screen_capture_damage.add(last_cursor_rect.intersected(screen.rect()));
     m_have_flush_rects = true;
     m_cursor_back_is_valid = false;
     return true;
@@ -181,6 +181,7 @@ public:
     Gfx::Bitmap const* cursor_bitmap_for_screenshot(Badge<ConnectionFromClient>, Screen&) const;
     Gfx::Bitmap const& front_bitmap_for_screenshot(Badge<ConnectionFromClient>, Screen&) const;
     Gfx::Color color_at_position(Badge<ConnectionFromClient>, Screen&, Gfx::IntPoint) const;
+    Gfx::IntRect take_screen_capture_damage(Badge<ConnectionFromClient>, Screen&);
 
     void register_animation(Badge<Animation>, Animation&);
     void unregister_animation(Badge<Animation>, Animation&);
@@ -229,6 +230,11 @@ private:
     IntrusiveList<&Overlay::m_list_node> m_overlay_list;
     Gfx::DisjointIntRectSet m_overlay_rects;
     Gfx::DisjointIntRectSet m_dirty_screen_rects;
+
+    // Damage accumulated for screen capture clients since their last capture.
+    // Tracking starts lazily with the first take_screen_capture_damage() call.
+    bool m_screen_capture_damage_tracking { false };
+    Gfx::DisjointIntRectSet m_screen_capture_damage;
     Gfx::DisjointIntRectSet m_opaque_wallpaper_rects;
     Gfx::DisjointIntRectSet m_transparent_wallpaper_rects;
 
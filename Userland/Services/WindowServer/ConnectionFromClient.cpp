@@ -1184,6 +1184,45 @@ Messages::WindowServer::GetScreenBitmapResponse ConnectionFromClient::get_screen
     return { Gfx::ShareableBitmap() };
 }
 
+Messages::WindowServer::GetScreenBitmapDeltaResponse ConnectionFromClient::get_screen_bitmap_delta(u32 screen_index, Optional<u32> const& downscale_factor)
+{
+    auto* screen = Screen::find_by_index(screen_index);
+    if (!screen) {
+        dbgln("get_screen_bitmap_delta: Screen {} does not exist!", screen_index);
+        return { Gfx::ShareableBitmap(), Gfx::IntRect() };
+    }
+
+    // The first call returns the whole screen; later calls return only the
+    // bounding rect of what changed since the previous one, so continuous
+    // capture only pays for the pixels that actually moved.
+    auto damage_rect = Compositor::the().take_screen_capture_damage({}, *screen);
+    if (damage_rect.is_empty())
+        return { Gfx::ShareableBitmap(), Gfx::IntRect() };
+
+    auto& front_bitmap = Compositor::the().front_bitmap_for_screenshot({}, *screen);
+
+    u32 factor = max(1u, downscale_factor.value_or(1));
+    if (factor == 1) {
+        auto bitmap_or_error = front_bitmap.cropped(damage_rect);
+        if (bitmap_or_error.is_error()) {
+            dbgln("get_screen_bitmap_delta: Failed to crop damage rect: {}", bitmap_or_error.error());
+            return { Gfx::ShareableBitmap(), Gfx::IntRect() };
+        }
+        return { bitmap_or_error.release_value()->to_shareable_bitmap(), damage_rect };
+    }
+
+    Gfx::IntSize scaled_size { max(1, damage_rect.width() / (int)factor), max(1, damage_rect.height() / (int)factor) };
+    auto bitmap_or_error = Gfx::Bitmap::try_create(Gfx::BitmapFormat::BGRx8888, scaled_size, 1);
+    if (bitmap_or_error.is_error()) {
+        dbgln("get_screen_bitmap_delta: Failed to allocate scaled bitmap: {}", bitmap_or_error.error());
+        return { Gfx::ShareableBitmap(), Gfx::IntRect() };
+    }
+    auto bitmap = bitmap_or_error.release_value_but_fixme_should_propagate_errors();
+    Gfx::Painter painter(*bitmap);
+    painter.draw_scaled_bitmap({ {}, scaled_size }, front_bitmap, damage_rect, 1.0f, Gfx::Painter::ScalingMode::BilinearBlend);
+    return { bitmap->to_shareable_bitmap(), damage_rect };
+}
+
 Messages::WindowServer::GetScreenBitmapAroundCursorResponse ConnectionFromClient::get_screen_bitmap_around_cursor(Gfx::IntSize size)
 {
     return get_screen_bitmap_around_location(size, ScreenInput::the().cursor_location()).bitmap();
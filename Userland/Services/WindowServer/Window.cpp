@@ -656,6 +656,7 @@ void Window::prepare_dirty_rects()
                     m_dirty_rects.add(rects);
             }
         }
+        m_dirty_rects.coalesce();
     }
 }
 
@@ -742,10 +742,47 @@ ErrorOr<RefPtr<Job>> Shell::run_command(const AST::Command& command)
 
     argv.append(nullptr);
 
-    auto sync_pipe = TRY(Core::System::pipe2(0));
+    // Simple external commands never run shell code after the fork, so the
+    // child can go straight to exec(): it puts itself in the right process
+    // group and grabs the terminal instead of handshaking with us over a sync
+    // pipe, and it skips tearing down inherited shell state, which would only
+    // fault in copies of our heap pages for exec() to throw away.
+    bool use_spawn_fast_path = !command.argv.is_empty()
+        && !command.should_immediately_execute_next
+        && !has_builtin(command.argv.first())
+        && !has_function(command.argv.first());
+
+    Array<int, 2> sync_pipe { -1, -1 };
+    if (!use_spawn_fast_path)
+        sync_pipe = TRY(Core::System::pipe2(0));
     auto child = TRY(Core::System::fork());
 
     if (child == 0) {
+        if (use_spawn_fast_path) {
+            if (auto result = apply_rewirings(); result.is_error()) {
+                warnln("Shell: Failed to apply rewirings in {}: {}", copy_argv[0], result.error());
+                _exit(126);
+            }
+            fds.collect();
+
+            pid_t pgid = command.pipeline && command.pipeline->pgid != -1 ? command.pipeline->pgid : getpid();
+            if (!m_is_subshell || command.pipeline)
+                (void)setpgid(0, pgid);
+            if (!m_is_subshell) {
+                // We're still in a background process group at this point, so
+                // keep tcsetpgrp() from raising SIGTTOU while we grab the terminal.
+                signal(SIGTTOU, SIG_IGN);
+                tcsetpgrp(STDOUT_FILENO, pgid);
+                tcsetpgrp(STDIN_FILENO, pgid);
+                signal(SIGTTOU, SIG_DFL);
+                if (command.should_wait)
+                    tcsetattr(0, TCSANOW, &default_termios);
+            }
+
+            execute_process(move(argv));
+            VERIFY_NOT_REACHED();
+        }
+
         close(sync_pipe[1]);
 
         m_pid = getpid();
@@ -802,7 +839,8 @@ ErrorOr<RefPtr<Job>> Shell::run_command(const AST::Command& command)
         VERIFY_NOT_REACHED();
     }
 
-    close(sync_pipe[0]);
+    if (!use_spawn_fast_path)
+        close(sync_pipe[0]);
 
     bool is_first = !command.pipeline || (command.pipeline && command.pipeline->pgid == -1);
 
@@ -815,10 +853,13 @@ ErrorOr<RefPtr<Job>> Shell::run_command(const AST::Command& command)
     pid_t pgid = is_first ? child : (command.pipeline ? command.pipeline->pgid : child);
     if (!m_is_subshell || command.pipeline) {
         auto result = Core::System::setpgid(child, pgid);
-        if (result.is_error() && m_is_interactive)
+        // In the fast path the child races us to exec() and may win, in which
+        // case it has already put itself in the right process group and our
+        // setpgid() fails with EACCES - that's fine.
+        if (result.is_error() && m_is_interactive && !use_spawn_fast_path)
             warnln("Shell: {}", result.error());
 
-        if (!m_is_subshell) {
+        if (!m_is_subshell && !use_spawn_fast_path) {
             // There's no reason to care about the errors here
             // either we're in a tty, we're interactive, and this works
             // or we're not, and it fails - in which case, we don't need
@@ -828,15 +869,17 @@ ErrorOr<RefPtr<Job>> Shell::run_command(const AST::Command& command)
         }
     }
 
-    while (write(sync_pipe[1], "x", 1) < 0) {
-        if (errno != EINTR) {
-            warnln("Shell: Failed to sync with {}: {}", copy_argv[0], Error::from_syscall("write"sv, -errno));
-            // There's nothing interesting we can do here.
-            break;
+    if (!use_spawn_fast_path) {
+        while (write(sync_pipe[1], "x", 1) < 0) {
+            if (errno != EINTR) {
+                warnln("Shell: Failed to sync with {}: {}", copy_argv[0], Error::from_syscall("write"sv, -errno));
+                // There's nothing interesting we can do here.
+                break;
+            }
         }
-    }
 
-    close(sync_pipe[1]);
+        close(sync_pipe[1]);
+    }
 
     StringBuilder cmd;
     cmd.join(' ', command.argv);
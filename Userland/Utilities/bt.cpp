@@ -17,7 +17,8 @@
 
 ErrorOr<int> serenity_main(Main::Arguments arguments)
 {
-    TRY(Core::System::pledge("stdio rpath"));
+    // "unix" is for talking to SymbolServer, if one is running.
+    TRY(Core::System::pledge("stdio rpath unix"));
     auto hostname = TRY(Core::System::gethostname());
 
     Core::ArgsParser args_parser;
@@ -6,7 +6,9 @@
 
 #include <AK/DeprecatedString.h>
 #include <AK/LexicalPath.h>
+#include <AK/NonnullOwnPtr.h>
 #include <AK/NumberFormat.h>
+#include <AK/Optional.h>
 #include <AK/Vector.h>
 #include <LibCore/ArgsParser.h>
 #include <LibCore/DateTime.h>
@@ -14,6 +16,9 @@
 #include <LibCore/Stream.h>
 #include <LibCore/System.h>
 #include <LibMain/Main.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibThreading/Mutex.h>
+#include <LibThreading/ThreadPool.h>
 #include <limits.h>
 #include <string.h>
 
@@ -36,8 +41,29 @@ struct DuOption {
     size_t max_depth = SIZE_MAX;
 };
 
+struct TreeNode {
+    explicit TreeNode(DeprecatedString path)
+        : path(move(path))
+    {
+    }
+
+    DeprecatedString path;
+    struct stat path_stat { };
+    Optional<Error> stat_error;
+    int directory_error { 0 };
+    bool is_directory { false };
+    Vector<NonnullOwnPtr<TreeNode>> children;
+};
+
+struct TraversalState {
+    Threading::Mutex mutex;
+    Threading::ConditionVariable all_done { mutex };
+    size_t pending_nodes { 0 };
+};
+
 static ErrorOr<void> parse_args(Main::Arguments arguments, Vector<DeprecatedString>& files, DuOption& du_option);
-static ErrorOr<u64> print_space_usage(DeprecatedString const& path, DuOption const& du_option, size_t current_depth, bool inside_dir = false);
+static void collect_tree(TreeNode& node, TraversalState& state);
+static ErrorOr<u64> report_space_usage(TreeNode& node, DuOption const& du_option, size_t current_depth, bool inside_dir = false);
 
 ErrorOr<int> serenity_main(Main::Arguments arguments)
 {
@@ -46,8 +72,22 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
 
     TRY(parse_args(arguments, files, du_option));
 
-    for (auto const& file : files)
-        TRY(print_space_usage(file, du_option, 0));
+    for (auto const& file : files) {
+        // Collect the tree first, with sibling subtrees statted in parallel on
+        // the thread pool, then report on it sequentially so that the output
+        // (and which error aborts the run) stays in traversal order.
+        auto root = make<TreeNode>(file);
+        TraversalState state;
+        state.mutex.lock();
+        state.pending_nodes = 1;
+        state.mutex.unlock();
+        Threading::ThreadPool::the().submit([&] { collect_tree(*root, state); });
+        state.mutex.lock();
+        state.all_done.wait_while([&] { return state.pending_nodes > 0; });
+        state.mutex.unlock();
+
+        TRY(report_space_usage(*root, du_option, 0));
+    }
 
     return 0;
 }
@@ -135,24 +175,63 @@ ErrorOr<void> parse_args(Main::Arguments arguments, Vector<DeprecatedString>& fi
     return {};
 }
 
-ErrorOr<u64> print_space_usage(DeprecatedString const& path, DuOption const& du_option, size_t current_depth, bool inside_dir)
+void collect_tree(TreeNode& node, TraversalState& state)
 {
-    u64 size = 0;
-    struct stat path_stat = TRY(Core::System::lstat(path));
-    bool const is_directory = S_ISDIR(path_stat.st_mode);
-    if (is_directory) {
-        auto di = Core::DirIterator(path, Core::DirIterator::SkipParentAndBaseDir);
+    auto stat_or_error = Core::System::lstat(node.path);
+    if (stat_or_error.is_error()) {
+        node.stat_error = stat_or_error.release_error();
+    } else {
+        node.path_stat = stat_or_error.release_value();
+        node.is_directory = S_ISDIR(node.path_stat.st_mode);
+    }
+
+    if (node.is_directory) {
+        auto di = Core::DirIterator(node.path, Core::DirIterator::SkipParentAndBaseDir);
         if (di.has_error()) {
-            outln("du: cannot read directory '{}': {}", path, di.error_string());
-            return Error::from_string_literal("An error occurred. See previous error.");
+            node.directory_error = di.error();
+        } else {
+            while (di.has_next())
+                node.children.append(make<TreeNode>(di.next_full_path()));
         }
+    }
 
-        while (di.has_next()) {
-            auto const child_path = di.next_full_path();
-            size += TRY(print_space_usage(child_path, du_option, current_depth + 1, true));
+    // Each child subtree becomes its own job. This node's job is the only
+    // writer of its children vector and the child jobs each touch only their
+    // own node, so the tree needs no locking of its own.
+    if (!node.children.is_empty()) {
+        state.mutex.lock();
+        state.pending_nodes += node.children.size();
+        state.mutex.unlock();
+        for (auto& child : node.children) {
+            Threading::ThreadPool::the().submit([&child = *child, &state] {
+                collect_tree(child, state);
+            });
         }
     }
 
+    state.mutex.lock();
+    if (--state.pending_nodes == 0)
+        state.all_done.signal();
+    state.mutex.unlock();
+}
+
+ErrorOr<u64> report_space_usage(TreeNode& node, DuOption const& du_option, size_t current_depth, bool inside_dir)
+{
+    u64 size = 0;
+    if (node.stat_error.has_value())
+        return node.stat_error.release_value();
+    auto const& path = node.path;
+    auto const& path_stat = node.path_stat;
+    if (node.is_directory) {
+        if (node.directory_error != 0) {
+            outln("du: cannot read directory '{}': {}", path, strerror(node.directory_error));
+            return Error::from_string_literal("An error occurred. See previous error.");
+        }
+
+        for (auto& child : node.children)
+            size += TRY(report_space_usage(*child, du_option, current_depth + 1, true));
+    }
+
     auto const basename = LexicalPath::basename(path);
     for (auto const& pattern : du_option.excluded_patterns) {
         if (basename.matches(pattern, CaseSensitivity::CaseSensitive))
@@ -167,7 +246,7 @@ ErrorOr<u64> print_space_usage(DeprecatedString const& path, DuOption const& du_
     }
 
     bool is_beyond_depth = current_depth > du_option.max_depth;
-    bool is_inner_file = inside_dir && !is_directory;
+    bool is_inner_file = inside_dir && !node.is_directory;
     bool is_outside_threshold = (du_option.threshold > 0 && size < static_cast<u64>(du_option.threshold)) || (du_option.threshold < 0 && size > static_cast<u64>(-du_option.threshold));
 
     // All of these still count towards the full size, they are just not reported on individually.
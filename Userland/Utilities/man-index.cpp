@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2022, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/ArgsParser.h>
+#include <LibCore/System.h>
+#include <LibMain/Main.h>
+#include <LibManual/SearchIndex.h>
+
+ErrorOr<int> serenity_main(Main::Arguments arguments)
+{
+    TRY(Core::System::pledge("stdio rpath wpath cpath"));
+
+    StringView output_path = Manual::SearchIndex::default_path;
+
+    Core::ArgsParser args_parser;
+    args_parser.set_general_help("Build the manual page search index used by 'man -k'.");
+    args_parser.add_option(output_path, "Where to write the index", "output", 'o', "path");
+    args_parser.parse(arguments);
+
+    TRY(Core::System::unveil("/usr/share/man"sv, "r"sv));
+    TRY(Core::System::unveil(output_path, "wc"sv));
+    TRY(Core::System::unveil(nullptr, nullptr));
+
+    TRY(Manual::SearchIndex::build(output_path));
+    return 0;
+}
@@ -7,6 +7,7 @@
 #include <AK/Assertions.h>
 #include <AK/ByteBuffer.h>
 #include <AK/DeprecatedString.h>
+#include <AK/LexicalPath.h>
 #include <AK/Utf8View.h>
 #include <LibCore/ArgsParser.h>
 #include <LibCore/File.h>
@@ -15,6 +16,8 @@
 #include <LibMain/Main.h>
 #include <LibManual/Node.h>
 #include <LibManual/PageNode.h>
+#include <LibManual/Path.h>
+#include <LibManual/SearchIndex.h>
 #include <LibManual/SectionNode.h>
 #include <LibMarkdown/Document.h>
 #include <spawn.h>
@@ -61,13 +64,39 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     DeprecatedString section_argument;
     DeprecatedString name_argument;
     DeprecatedString pager;
+    DeprecatedString keyword;
 
     Core::ArgsParser args_parser;
     args_parser.set_general_help("Read manual pages. Try 'man man' to get started.");
-    args_parser.add_positional_argument(section_argument, "Section of the man page", "section");
+    args_parser.add_positional_argument(section_argument, "Section of the man page", "section", Core::ArgsParser::Required::No);
     args_parser.add_positional_argument(name_argument, "Name of the man page", "name", Core::ArgsParser::Required::No);
     args_parser.add_option(pager, "Pager to pipe the man page to", "pager", 'P', "pager");
+    args_parser.add_option(keyword, "List pages matching a keyword", "keyword", 'k', "keyword");
     args_parser.parse(arguments);
+
+    if (!keyword.is_empty()) {
+        auto index_or_error = Manual::SearchIndex::open();
+        if (index_or_error.is_error()) {
+            warnln("man: No search index found, run man-index to build one ({})", index_or_error.error());
+            return 1;
+        }
+        auto index = index_or_error.release_value();
+        for (auto const& path : TRY(index.search(keyword))) {
+            LexicalPath lexical_path(path.to_deprecated_string());
+            auto section_directory = lexical_path.parent();
+            auto section_name = section_directory.basename();
+            if (section_name.starts_with(Manual::top_level_section_prefix))
+                section_name = section_name.substring_view(Manual::top_level_section_prefix.length());
+            outln("{}({})", lexical_path.title(), section_name);
+        }
+        return 0;
+    }
+
+    if (section_argument.is_empty()) {
+        args_parser.print_usage(stderr, arguments.argv[0]);
+        return 1;
+    }
+
     Vector<StringView, 2> query_parameters;
     if (!section_argument.is_empty())
         query_parameters.append(section_argument);
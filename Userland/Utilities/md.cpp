@@ -6,6 +6,7 @@
 
 #include <AK/DeprecatedString.h>
 #include <LibCore/ArgsParser.h>
+#include <LibCore/MappedFile.h>
 #include <LibCore/Stream.h>
 #include <LibCore/System.h>
 #include <LibMain/Main.h>
@@ -41,15 +42,21 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
         }
     }
 
-    auto file = TRY(Core::Stream::File::open_file_or_standard_stream(filename, Core::Stream::OpenMode::Read));
-
-    TRY(Core::System::pledge("stdio"));
-
-    auto buffer = TRY(file->read_until_eof());
-    dbgln("Read size {}", buffer.size());
+    // Map named files instead of reading them into a buffer; the parser only
+    // needs a StringView, so there's no reason to copy the whole document.
+    RefPtr<Core::MappedFile> mapped_file;
+    DeprecatedString input;
+    if (!filename.is_empty() && filename != "-"sv) {
+        mapped_file = TRY(Core::MappedFile::map(filename, Core::MappedFile::AccessPattern::Sequential));
+        TRY(Core::System::pledge("stdio"));
+    } else {
+        auto file = TRY(Core::Stream::File::open_file_or_standard_stream(filename, Core::Stream::OpenMode::Read));
+        TRY(Core::System::pledge("stdio"));
+        auto buffer = TRY(file->read_until_eof());
+        input = DeprecatedString::copy(buffer);
+    }
 
-    auto input = DeprecatedString::copy(buffer);
-    auto document = Markdown::Document::parse(input);
+    auto document = Markdown::Document::parse(mapped_file ? mapped_file->string_view() : input.view());
 
     if (!document) {
         warnln("Error parsing Markdown document");
@@ -14,9 +14,13 @@
 #include <LibCore/DirIterator.h>
 #include <LibCore/Directory.h>
 #include <LibCore/File.h>
+#include <LibCore/MappedFile.h>
 #include <LibCore/Stream.h>
 #include <LibCore/System.h>
 #include <LibMain/Main.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibThreading/Mutex.h>
+#include <LibThreading/ThreadPool.h>
 #include <fcntl.h>
 #include <stdio.h>
 #include <sys/stat.h>
@@ -64,12 +68,32 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
         if (!directory.is_empty())
             TRY(Core::System::chdir(directory));
 
-        NonnullOwnPtr<Core::Stream::Stream> input_stream = TRY(Core::Stream::File::open_file_or_standard_stream(archive_file, Core::Stream::OpenMode::Read));
+        // Map plain archive files so entry contents can be written out as
+        // views into the mapping instead of being copied through a stream.
+        RefPtr<Core::MappedFile> mapped_file;
+        OwnPtr<Archive::TarInputStream> tar_stream;
+        if (!gzip && !archive_file.is_empty() && archive_file != "-"sv) {
+            mapped_file = TRY(Core::MappedFile::map(archive_file));
+            tar_stream = TRY(Archive::TarInputStream::construct(mapped_file->bytes()));
+        } else {
+            NonnullOwnPtr<Core::Stream::Stream> input_stream = TRY(Core::Stream::File::open_file_or_standard_stream(archive_file, Core::Stream::OpenMode::Read));
 
-        if (gzip)
-            input_stream = make<Compress::GzipDecompressor>(move(input_stream));
+            if (gzip)
+                input_stream = make<Compress::GzipDecompressor>(move(input_stream));
+
+            tar_stream = TRY(Archive::TarInputStream::construct(move(input_stream)));
+        }
 
-        auto tar_stream = TRY(Archive::TarInputStream::construct(move(input_stream)));
+        // File contents of a memory-backed archive are written out on the
+        // thread pool once the walk below has created all the (order-
+        // sensitive) directories and symlinks; the views stay valid for as
+        // long as the mapping is alive.
+        struct PendingFileWrite {
+            DeprecatedString absolute_path;
+            mode_t mode;
+            ReadonlyBytes contents;
+        };
+        Vector<PendingFileWrite> pending_file_writes;
 
         HashMap<DeprecatedString, DeprecatedString> global_overrides;
         HashMap<DeprecatedString, DeprecatedString> local_overrides;
@@ -159,6 +183,11 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
                 case Archive::TarFileType::AlternateNormalFile: {
                     MUST(Core::Directory::create(parent_path, Core::Directory::CreateDirectories::Yes));
 
+                    if (auto contents = tar_stream->file_contents_view(); contents.has_value()) {
+                        TRY(pending_file_writes.try_append({ absolute_path, header_mode, *contents }));
+                        break;
+                    }
+
                     int fd = TRY(Core::System::open(absolute_path, O_CREAT | O_WRONLY, header_mode));
 
                     Array<u8, buffer_size> buffer;
@@ -197,6 +226,44 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
             TRY(tar_stream->advance());
         }
 
+        if (!pending_file_writes.is_empty()) {
+            struct WriteState {
+                Threading::Mutex mutex;
+                Threading::ConditionVariable all_done { mutex };
+                size_t pending_writes { 0 };
+                Optional<Error> first_error;
+            } state;
+            state.mutex.lock();
+            state.pending_writes = pending_file_writes.size();
+            state.mutex.unlock();
+
+            for (auto& pending_write : pending_file_writes) {
+                Threading::ThreadPool::the().submit([&pending_write, &state] {
+                    auto result = [&]() -> ErrorOr<void> {
+                        int fd = TRY(Core::System::open(pending_write.absolute_path, O_CREAT | O_WRONLY, pending_write.mode));
+                        size_t bytes_written = 0;
+                        while (bytes_written < pending_write.contents.size())
+                            bytes_written += TRY(Core::System::write(fd, pending_write.contents.slice(bytes_written)));
+                        TRY(Core::System::close(fd));
+                        return {};
+                    }();
+                    state.mutex.lock();
+                    if (result.is_error() && !state.first_error.has_value())
+                        state.first_error = result.release_error();
+                    if (--state.pending_writes == 0)
+                        state.all_done.signal();
+                    state.mutex.unlock();
+                });
+            }
+
+            state.mutex.lock();
+            state.all_done.wait_while([&] { return state.pending_writes > 0; });
+            state.mutex.unlock();
+
+            if (state.first_error.has_value())
+                return state.first_error.release_value();
+        }
+
         return 0;
     }
 
@@ -7,6 +7,7 @@
 #include <AK/Assertions.h>
 #include <AK/NumberFormat.h>
 #include <AK/StringUtils.h>
+#include <AK/Vector.h>
 #include <LibArchive/Zip.h>
 #include <LibCompress/Deflate.h>
 #include <LibCore/ArgsParser.h>
@@ -15,6 +16,9 @@
 #include <LibCore/MappedFile.h>
 #include <LibCore/System.h>
 #include <LibCrypto/Checksum/CRC32.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibThreading/Mutex.h>
+#include <LibThreading/ThreadPool.h>
 #include <sys/stat.h>
 
 static bool unpack_zip_member(Archive::ZipMember zip_member, bool quiet)
@@ -123,6 +127,7 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
         TRY(Core::System::chdir(output_directory_path));
     }
 
+    Vector<Archive::ZipMember> file_members;
     auto success = TRY(zip_file->for_each_member([&](auto zip_member) {
         bool keep_file = false;
 
@@ -139,13 +144,52 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
             keep_file = true;
         }
 
-        if (keep_file) {
+        if (!keep_file)
+            return IterationDecision::Continue;
+
+        // Directories (and the parent directories of files) are created up
+        // front, in archive order, so the parallel extraction below never
+        // races on creating one.
+        if (zip_member.is_directory) {
             if (!unpack_zip_member(zip_member, quiet))
                 return IterationDecision::Break;
+            return IterationDecision::Continue;
         }
 
+        MUST(Core::Directory::create(LexicalPath(zip_member.name.to_deprecated_string()).parent(), Core::Directory::CreateDirectories::Yes));
+        file_members.append(move(zip_member));
         return IterationDecision::Continue;
     }));
 
-    return success ? 0 : 1;
+    // File members don't depend on each other, so they're inflated and
+    // written out on the thread pool.
+    struct ExtractionState {
+        Threading::Mutex mutex;
+        Threading::ConditionVariable all_done { mutex };
+        size_t pending_members { 0 };
+        bool success { true };
+    } state;
+    state.mutex.lock();
+    state.pending_members = file_members.size();
+    state.mutex.unlock();
+
+    for (auto& member : file_members) {
+        Threading::ThreadPool::the().submit([&member, &state, quiet] {
+            bool member_success = unpack_zip_member(member, quiet);
+            state.mutex.lock();
+            if (!member_success)
+                state.success = false;
+            if (--state.pending_members == 0)
+                state.all_done.signal();
+            state.mutex.unlock();
+        });
+    }
+
+    if (!file_members.is_empty()) {
+        state.mutex.lock();
+        state.all_done.wait_while([&] { return state.pending_members > 0; });
+        state.mutex.unlock();
+    }
+
+    return (success && state.success) ? 0 : 1;
 }
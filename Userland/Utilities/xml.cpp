@@ -10,6 +10,7 @@
 #include <AK/URLParser.h>
 #include <LibCore/ArgsParser.h>
 #include <LibCore/File.h>
+#include <LibCore/MappedFile.h>
 #include <LibCore/Stream.h>
 #include <LibMain/Main.h>
 #include <LibXML/DOM/Document.h>
@@ -516,10 +517,11 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     parser.parse(arguments);
 
     s_path = Core::File::real_path_for(filename);
-    auto file = TRY(Core::Stream::File::open(s_path, Core::Stream::OpenMode::Read));
-    auto contents = TRY(file->read_until_eof());
+    // The parser works on a StringView, so map the document instead of
+    // copying it into a buffer first.
+    auto mapped_file = TRY(Core::MappedFile::map(s_path, Core::MappedFile::AccessPattern::Sequential));
 
-    auto xml_parser = parse(contents);
+    auto xml_parser = parse(mapped_file->string_view());
     auto result = xml_parser.parse();
     if (result.is_error()) {
         if (xml_parser.parse_error_causes().is_empty()) {